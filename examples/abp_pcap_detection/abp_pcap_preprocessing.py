@@ -21,6 +21,7 @@ import numpy as np
 
 import cudf
 
+import morpheus._lib.stages as _stages
 from morpheus.cli.register_stage import register_stage
 from morpheus.common import TypeId
 from morpheus.config import Config
@@ -78,22 +79,18 @@ class AbpPcapPreprocessingStage(PreprocessBaseStage):
         return "preprocess-anomaly"
 
     def supports_cpp_node(self):
-        return False
+        return True
 
     @staticmethod
     def pre_process_batch(x: MultiMessage, fea_len: int, fea_cols: typing.List[str],
                           req_cols: typing.List[str]) -> MultiInferenceFILMessage:
-        # Converts the int flags field into a binary string
-        flags_bin_series = x.get_meta("flags").to_pandas().apply(lambda x: format(int(x), "05b"))
+        # Decode the [ack, psh, rst, syn, fin] bits from the int flags field, ACK being 16 and FIN being 1
+        flags = x.get_meta("flags").astype("int64")
 
-        # Expand binary string into an array
-        df = cudf.DataFrame(np.vstack(flags_bin_series.str.findall("[0-1]")).astype("int8"), index=x.get_meta().index)
+        df = cudf.DataFrame(index=flags.index)
+        for (bit, col) in enumerate(["ack", "psh", "rst", "syn", "fin"]):
+            df[col] = ((flags // (1 << (4 - bit))) % 2).astype("int8")
 
-        # adding [ack, psh, rst, syn, fin] details from the binary flag
-        rename_cols_dct = {0: "ack", 1: "psh", 2: "rst", 3: "syn", 4: "fin"}
-        df = df.rename(columns=rename_cols_dct)
-
-        df["flags_bin"] = flags_bin_series
         df["timestamp"] = x.get_meta("timestamp").astype("int64")
 
         def round_time_kernel(timestamp, rollup_time, secs):
@@ -197,4 +194,4 @@ class AbpPcapPreprocessingStage(PreprocessBaseStage):
                        req_cols=self.req_cols)
 
     def _get_preprocess_node(self, builder: mrc.Builder):
-        raise NotImplementedError("C++ node not implemented for this stage")
+        return _stages.PreprocessPcapStage(builder, self.unique_name)
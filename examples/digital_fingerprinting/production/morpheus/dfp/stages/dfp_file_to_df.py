@@ -53,6 +53,9 @@ class DFPFileToDataFrameStage(PreallocatorMixin, SinglePortStage):
         Keyword arguments to pass to the DataFrame parser.
     cache_dir : str, optional
         Directory to use for caching.
+    native_cache_max_bytes : int, optional
+        When greater than zero, cache the DataFrame parsed from each file with the native file cache, up to the given
+        total size, instead of caching whole batches. Refer to `morpheus.controllers.file_to_df_controller` for details.
     """
 
     def __init__(self,
@@ -61,7 +64,8 @@ class DFPFileToDataFrameStage(PreallocatorMixin, SinglePortStage):
                  filter_null: bool = True,
                  file_type: FileTypes = FileTypes.Auto,
                  parser_kwargs: dict = None,
-                 cache_dir: str = "./.cache/dfp"):
+                 cache_dir: str = "./.cache/dfp",
+                 native_cache_max_bytes: int = 0):
         super().__init__(config)
 
         self._controller = FileToDFController(schema=schema,
@@ -69,7 +73,8 @@ class DFPFileToDataFrameStage(PreallocatorMixin, SinglePortStage):
                                               file_type=file_type,
                                               parser_kwargs=parser_kwargs,
                                               cache_dir=cache_dir,
-                                              timestamp_column_name=config.ae.timestamp_column_name)
+                                              timestamp_column_name=config.ae.timestamp_column_name,
+                                              native_cache_max_bytes=native_cache_max_bytes)
 
     @property
     def name(self) -> str:
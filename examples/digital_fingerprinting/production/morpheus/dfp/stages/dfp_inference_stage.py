@@ -13,14 +13,18 @@
 # limitations under the License.
 """Inference stage for DFP."""
 
+import collections
+import io
 import logging
 import time
 import typing
 
 import mrc
+import torch
 from mlflow.tracking.client import MlflowClient
 from mrc.core import operators as ops
 
+from morpheus.common import ModelRegistry
 from morpheus.config import Config
 from morpheus.messages.multi_ae_message import MultiAEMessage
 from morpheus.pipeline.single_port_stage import SinglePortStage
@@ -44,9 +48,23 @@ class DFPInferenceStage(SinglePortStage):
     model_name_formatter : str, optional
         Format string to control the name of models stored in MLflow. Currently available field names are: `user_id`
         and `user_md5` which is an md5 hexadecimal digest as returned by `hash.hexdigest`.
+    model_dir : str, optional
+        Directory of models saved with `torch.save`, read instead of MLflow when set. Models are named by
+        `model_name_formatter`, which only supports the `user_id` field in this case. Models are held in memory by a
+        `morpheus.common.ModelRegistry`.
+    model_memory_budget : int, default = 1 GiB
+        Maximum number of bytes of serialized models kept in memory when `model_dir` is set.
+    model_prefetch_depth : int, default = 8
+        Number of messages held back when `model_dir` is set, the models of their users are read in the background
+        while the preceding messages are inferred.
     """
 
-    def __init__(self, c: Config, model_name_formatter: str = "dfp-{user_id}"):
+    def __init__(self,
+                 c: Config,
+                 model_name_formatter: str = "dfp-{user_id}",
+                 model_dir: str = None,
+                 model_memory_budget: int = 1 << 30,
+                 model_prefetch_depth: int = 8):
         super().__init__(c)
 
         self._client = MlflowClient()
@@ -59,6 +77,22 @@ class DFPInferenceStage(SinglePortStage):
 
         self._model_manager = ModelManager(model_name_formatter=model_name_formatter)
 
+        # Deserialized models read from `model_dir`, keyed by user as `(model, model_name, load_time)`
+        self._local_models: typing.OrderedDict[str, typing.Tuple[typing.Any, str, float]] = collections.OrderedDict()
+        self._model_prefetch_depth = model_prefetch_depth
+
+        self._model_registry: ModelRegistry = None
+        if (model_dir is not None):
+            self._model_registry = ModelRegistry(model_dir,
+                                                 model_memory_budget,
+                                                 fallback_entities=[self._fallback_user],
+                                                 model_name_formatter=model_name_formatter)
+
+    @property
+    def model_registry(self) -> ModelRegistry:
+        """Registry of the models read from `model_dir`, `None` when models are read from MLflow."""
+        return self._model_registry
+
     @property
     def name(self) -> str:
         """Stage name."""
@@ -82,6 +116,41 @@ class DFPInferenceStage(SinglePortStage):
         """
         return self._model_manager.load_user_model(self._client, user_id=user, fallback_user_ids=[self._fallback_user])
 
+    def _load_local_model(self, user_id: str) -> typing.Tuple[typing.Any, str]:
+        """
+        Return the model of the given user read from `model_dir`, falling back to the generic user, along with the
+        name of the model. Deserialized models are kept for up to `_cache_timeout_sec`, for the
+        `_model_cache_size_max` most recently used users.
+        """
+        now = time.time()
+
+        cached = self._local_models.get(user_id)
+        if (cached is not None and now - cached[2] < self._cache_timeout_sec):
+            self._local_models.move_to_end(user_id)
+            return cached[0], cached[1]
+
+        entry = self._model_registry.get(user_id)
+
+        if (entry is None):
+            raise RuntimeError(f"Could not find model for user {user_id}")
+
+        (entity, model_name, blob) = entry
+
+        # Users without a model share the model of the fallback user
+        cached = self._local_models.get(entity)
+        if (cached is not None and cached[1] == model_name and now - cached[2] < self._cache_timeout_sec):
+            model = cached[0]
+        else:
+            model = torch.load(io.BytesIO(blob))
+
+        self._local_models[user_id] = (model, model_name, now)
+        self._local_models.move_to_end(user_id)
+
+        while (len(self._local_models) > self._model_cache_size_max):
+            self._local_models.popitem(last=False)
+
+        return model, model_name
+
     def on_data(self, message: MultiDFPMessage) -> MultiDFPMessage:
         """Perform inference on the input data."""
         if (not message or message.mess_count == 0):
@@ -93,12 +162,16 @@ class DFPInferenceStage(SinglePortStage):
         user_id = message.user_id
 
         try:
-            model_cache = self.get_model(user_id)
+            if (self._model_registry is not None):
+                loaded_model, model_version = self._load_local_model(user_id)
+            else:
+                model_cache = self.get_model(user_id)
 
-            if (model_cache is None):
-                raise RuntimeError(f"Could not find model for user {user_id}")
+                if (model_cache is None):
+                    raise RuntimeError(f"Could not find model for user {user_id}")
 
-            loaded_model = model_cache.load_model()
+                loaded_model = model_cache.load_model()
+                model_version = f"{model_cache.reg_model_name}:{model_cache.reg_model_version}"
 
         except Exception:
             logger.exception("Error trying to get model", exc_info=True)
@@ -115,7 +188,7 @@ class DFPInferenceStage(SinglePortStage):
 
         output_message.set_meta(list(results_df.columns), results_df)
 
-        output_message.set_meta('model_version', f"{model_cache.reg_model_name}:{model_cache.reg_model_version}")
+        output_message.set_meta('model_version', model_version)
 
         if logger.isEnabledFor(logging.DEBUG):
             load_model_duration = (post_model_time - start_time) * 1000.0
@@ -131,7 +204,36 @@ class DFPInferenceStage(SinglePortStage):
         return output_message
 
     def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
-        node = builder.make_node(self.unique_name, ops.map(self.on_data), ops.filter(lambda x: x is not None))
+        if (self._model_registry is None):
+            node = builder.make_node(self.unique_name, ops.map(self.on_data), ops.filter(lambda x: x is not None))
+            builder.make_edge(input_node, node)
+
+            return node
+
+        # Hold back the latest messages, so that the models of their users are read while the earlier ones are inferred
+        pending: typing.Deque[MultiDFPMessage] = collections.deque()
+
+        def infer(messages: typing.List[MultiDFPMessage]) -> typing.List[MultiDFPMessage]:
+            output = [self.on_data(message) for message in messages]
+            return [message for message in output if message is not None]
+
+        def on_next(message: MultiDFPMessage) -> typing.List[MultiDFPMessage]:
+            pending.append(message)
+            self._model_registry.prefetch([message.user_id])
+
+            ready = []
+            while (len(pending) > self._model_prefetch_depth):
+                ready.append(pending.popleft())
+
+            return infer(ready)
+
+        def on_completed() -> typing.List[MultiDFPMessage]:
+            ready = list(pending)
+            pending.clear()
+
+            return infer(ready)
+
+        node = builder.make_node(self.unique_name, ops.map(on_next), ops.on_completed(on_completed), ops.flatten())
         builder.make_edge(input_node, node)
 
         # node.launch_options.pe_count = self._config.num_threads
@@ -22,30 +22,59 @@ import mrc
 import numpy as np
 from mrc.core import operators as ops
 
+from morpheus.common import AnomalyScorer
 from morpheus.common import TypeId
 from morpheus.config import Config
 from morpheus.messages.multi_ae_message import MultiAEMessage
+from morpheus.models.dfencoder.scalers import ModifiedScaler
+from morpheus.models.dfencoder.scalers import NullScaler
+from morpheus.models.dfencoder.scalers import StandardScaler
 from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
 from morpheus.pipeline.single_port_stage import SinglePortStage
 
+from ..messages.multi_dfp_message import DFPMessageMeta
+
 logger = logging.getLogger(f"morpheus.{__name__}")
 
 
 class DFPPostprocessingStage(PassThruTypeMixin, SinglePortStage):
     """
-    This stage adds a new `event_time` column to the DataFrame indicating the time which Morpheus detected the
-    anomalous messages, and replaces any `NAN` values with the a string value of `'NaN'`.
+    This stage scores the reconstruction losses of the autoencoder, optionally keeps only the anomalous rows, and adds a
+    new `event_time` column indicating the time which Morpheus detected the anomalous messages.
+
+    The scores written by the inference stage, the `<feature>_z_loss`, `max_abs_z` and `mean_abs_z` columns along with
+    `z_loss_scaler_type`, are used as is. Otherwise, when the message holds the `<feature>_loss` columns of every
+    feature, the absolute z-score of each feature along with the `max_abs_z` and `mean_abs_z` of each row are computed
+    natively from the losses and the loss scalers of the model, and written in place to those columns. Features whose
+    loss scaler isn't linear are scored from their existing `<feature>_z_loss` column.
+
+    Null values are left as is rather than replaced with the string `'NaN'`, so JSON and Kafka outputs hold nulls. Pass
+    `na_rep='NaN'` to `WriteToFileStage` to write them as `'NaN'` in CSV files.
 
     Parameters
     ----------
     c : `morpheus.config.Config`
         Pipeline configuration instance.
+    z_score_threshold : float, optional
+        When set, only rows whose `mean_abs_z` exceeds this threshold, or which exceed a threshold of
+        `feature_z_score_thresholds`, are kept.
+    feature_z_score_thresholds : dict[str, float], optional
+        Thresholds of the absolute z-score of individual features, rows exceeding any of them are kept.
     """
 
-    def __init__(self, c: Config):
+    def __init__(self,
+                 c: Config,
+                 z_score_threshold: float = None,
+                 feature_z_score_thresholds: dict[str, float] = None):
         super().__init__(c)
         self._needed_columns['event_time'] = TypeId.STRING
 
+        self._feature_columns = list(c.ae.feature_columns or [])
+        self._scorer = AnomalyScorer(self._feature_columns,
+                                     threshold=z_score_threshold,
+                                     feature_thresholds=feature_z_score_thresholds or {})
+        self._warned_missing_columns = False
+
     @property
     def name(self) -> str:
         """Stage name."""
@@ -59,12 +88,102 @@ class DFPPostprocessingStage(PassThruTypeMixin, SinglePortStage):
         """Accepted input types."""
         return (MultiAEMessage, )
 
-    def _process_events(self, message: MultiAEMessage):
-        # Assume that a filter stage preceedes this stage
-        df = message.get_meta()
-        df['event_time'] = datetime.now().strftime('%Y-%m-%dT%H:%M:%SZ')
-        df.replace(np.nan, 'NaN', regex=True, inplace=True)
-        message.set_meta(None, df)
+    @staticmethod
+    def _get_loss_scaler(model, feature: str) -> typing.Optional[typing.Tuple[float, float]]:
+        """
+        Returns the `(center, scale)` of the loss scaler of `feature`, or `None` when the scaler isn't linear.
+        """
+        try:
+            scaler = model.feature_loss_stats[feature]['scaler']
+        except (AttributeError, KeyError, TypeError):
+            return None
+
+        if isinstance(scaler, StandardScaler):
+            return (scaler.mean, scaler.std)
+
+        if isinstance(scaler, ModifiedScaler):
+            if scaler.mad == 0:
+                return (scaler.median, ModifiedScaler.MEANAD_SCALING_FACTOR * scaler.meanad)
+
+            return (scaler.median, ModifiedScaler.MAD_SCALING_FACTOR * scaler.mad)
+
+        if isinstance(scaler, NullScaler):
+            return (0.0, 1.0)
+
+        return None
+
+    def _score_events(self, message: MultiAEMessage) -> typing.Optional[typing.List[typing.Tuple[int, int]]]:
+        """
+        Writes the scores of the rows of `message` in place, returning the row ranges of the anomalies, or `None` when
+        the message can't be scored. Raises a `ValueError` when the loss columns are missing and thresholds are set,
+        since the anomalies can't be selected.
+        """
+        if len(self._feature_columns) == 0:
+            return None
+
+        column_names = set(message.get_meta_column_names())
+
+        # The inference stage already scored the rows, only the anomalies remain to be found
+        z_loss_columns = [f"{feature}_z_loss" for feature in self._feature_columns]
+        if column_names.issuperset(z_loss_columns + ["max_abs_z", "mean_abs_z", "z_loss_scaler_type"]):
+            if not self._scorer.has_thresholds():
+                return [(0, message.mess_count)]
+
+            abs_z = message.get_meta(z_loss_columns).to_numpy(dtype=np.float64)
+            mean_abs_z = message.get_meta("mean_abs_z").to_numpy(dtype=np.float64)
+
+            return self._scorer.anomaly_ranges(abs_z, mean_abs_z)
+
+        loss_columns = []
+        scalers = []
+        for feature in self._feature_columns:
+            scaler = self._get_loss_scaler(message.model, feature)
+            if scaler is not None:
+                loss_columns.append(f"{feature}_loss")
+                scalers.append(scaler)
+            else:
+                # Non-linear scalers are applied by the model, their z-scores are taken as is
+                loss_columns.append(f"{feature}_z_loss")
+                scalers.append((0.0, 1.0))
+
+        missing_columns = [column for column in loss_columns if column not in column_names]
+        if len(missing_columns) > 0:
+            if self._scorer.has_thresholds():
+                raise ValueError(f"Unable to select anomalies, the message is missing the columns {missing_columns}")
+
+            if not self._warned_missing_columns:
+                logger.warning("Anomalies are not scored, the messages are missing the columns %s", missing_columns)
+                self._warned_missing_columns = True
+
+            return None
+
+        losses = message.get_meta(loss_columns).to_numpy(dtype=np.float64)
+        scores = self._scorer.score(losses, scalers)
+
+        message.set_meta(z_loss_columns, scores["abs_z"])
+        message.set_meta("max_abs_z", scores["max_abs_z"])
+        message.set_meta("mean_abs_z", scores["mean_abs_z"])
+
+        return scores["anomaly_ranges"]
+
+    def _process_events(self, message: MultiAEMessage) -> typing.Optional[MultiAEMessage]:
+        anomaly_ranges = self._score_events(message)
+
+        if anomaly_ranges is not None and self._scorer.has_thresholds():
+            if len(anomaly_ranges) == 0:
+                return None
+
+            if anomaly_ranges != [(0, message.mess_count)]:
+                sliced_rows = message.copy_meta_ranges(anomaly_ranges)
+                message = MultiAEMessage.from_message(message,
+                                                      meta=DFPMessageMeta(sliced_rows, user_id=message.meta.user_id),
+                                                      mess_offset=0,
+                                                      mess_count=len(sliced_rows))
+
+        # Only the new column is written, leaving the rest of the DataFrame untouched
+        message.set_meta('event_time', datetime.now().strftime('%Y-%m-%dT%H:%M:%SZ'))
+
+        return message
 
     def on_data(self, message: MultiAEMessage):
         """Process a message."""
@@ -73,7 +192,9 @@ class DFPPostprocessingStage(PassThruTypeMixin, SinglePortStage):
 
         start_time = time.time()
 
-        self._process_events(message)
+        message = self._process_events(message)
+        if message is None:
+            return None
 
         duration = (time.time() - start_time) * 1000.0
 
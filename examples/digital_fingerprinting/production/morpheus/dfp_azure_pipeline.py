@@ -453,7 +453,8 @@ def run_pipeline(train_users,
         pipeline.add_stage(SerializeStage(config, exclude=['batch_count', 'origin_hash', '_row_hash', '_batch_id']))
 
         # Write all anomalies to a CSV file
-        pipeline.add_stage(WriteToFileStage(config, filename=inference_detection_file_name, overwrite=True))
+        pipeline.add_stage(
+            WriteToFileStage(config, filename=inference_detection_file_name, overwrite=True, na_rep="NaN"))
 
     # Run the pipeline
     pipeline.run()
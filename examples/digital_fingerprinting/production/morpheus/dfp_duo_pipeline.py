@@ -369,7 +369,7 @@ def run_pipeline(train_users,
         # Exclude the columns we don't want in our output
         pipeline.add_stage(SerializeStage(config, exclude=['batch_count', 'origin_hash', '_row_hash', '_batch_id']))
 
-        pipeline.add_stage(WriteToFileStage(config, filename="dfp_detections_duo.csv", overwrite=True))
+        pipeline.add_stage(WriteToFileStage(config, filename="dfp_detections_duo.csv", overwrite=True, na_rep="NaN"))
 
     # Run the pipeline
     pipeline.run()
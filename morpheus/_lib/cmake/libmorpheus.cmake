@@ -33,7 +33,9 @@ add_library(morpheus
   src/llm/llm_node.cpp
   src/llm/llm_task_handler_runner.cpp
   src/llm/llm_task.cpp
+  src/llm/structured_output_node.cpp
   src/llm/utils.cpp
+  src/messages/attachment.cpp
   src/messages/control.cpp
   src/messages/memory/inference_memory_fil.cpp
   src/messages/memory/inference_memory_nlp.cpp
@@ -52,42 +54,83 @@ add_library(morpheus
   src/messages/multi.cpp
   src/messages/raw_packet.cpp
   src/modules/data_loader_module.cpp
+  src/objects/anomaly_scorer.cpp
+  src/objects/avro_decoder.cpp
   src/objects/data_table.cpp
+  src/objects/decoded_table.cpp
   src/objects/dev_mem_info.cpp
+  src/objects/document_converter.cpp
+  src/objects/document_extractor.cpp
   src/objects/dtype.cpp
+  src/objects/feed_reader.cpp
   src/objects/fiber_queue.cpp
+  src/objects/file_batch_cache.cpp
   src/objects/file_types.cpp
+  src/objects/grok.cpp
+  src/objects/histogram.cpp
   src/objects/memory_descriptor.cpp
+  src/objects/model_registry.cpp
   src/objects/mutable_table_ctx_mgr.cpp
+  src/objects/protobuf_decoder.cpp
   src/objects/python_data_table.cpp
+  src/objects/record_decoder.cpp
+  src/objects/reference_table.cpp
   src/objects/rmm_tensor.cpp
+  src/objects/string_features.cpp
+  src/objects/syslog_parser.cpp
   src/objects/table_info.cpp
+  src/objects/table_transaction.cpp
   src/objects/tensor_object.cpp
   src/objects/tensor.cpp
+  src/objects/text_splitter.cpp
+  src/objects/timestamp_parser.cpp
+  src/objects/web_fetcher.cpp
+  src/objects/windows_event_parser.cpp
   src/objects/wrapped_tensor.cpp
   src/stages/add_classification.cpp
   src/stages/add_scores_stage_base.cpp
   src/stages/add_scores.cpp
+  src/stages/deduplicate.cpp
   src/stages/deserialize.cpp
+  src/stages/document_extractor.cpp
+  src/stages/drift_stats.cpp
+  src/stages/enrich.cpp
   src/stages/file_source.cpp
   src/stages/filter_detections.cpp
+  src/stages/grok.cpp
   src/stages/http_server_source_stage.cpp
   src/stages/inference_client_stage.cpp
+  src/stages/inference_worker_pool.cpp
   src/stages/kafka_source.cpp
+  src/stages/pii_mask.cpp
+  src/stages/preprocess_embedding.cpp
   src/stages/preprocess_fil.cpp
   src/stages/preprocess_nlp.cpp
+  src/stages/preprocess_pcap.cpp
+  src/stages/rss_source.cpp
   src/stages/serialize.cpp
+  src/stages/string_features.cpp
+  src/stages/syslog_parser.cpp
+  src/stages/text_chunker.cpp
   src/stages/triton_inference.cpp
+  src/stages/web_fetch.cpp
+  src/stages/windows_event_parser.cpp
   src/stages/write_to_file.cpp
+  src/utilities/bucket_util.cpp
+  src/utilities/column_util.cpp
   src/utilities/cudf_util.cpp
   src/utilities/cupy_util.cpp
+  src/utilities/dedup_util.cpp
   src/utilities/http_server.cpp
   src/utilities/json_types.cpp
   src/utilities/matx_util.cu
+  src/utilities/pcap_util.cpp
+  src/utilities/pii_util.cpp
   src/utilities/python_util.cpp
   src/utilities/string_util.cpp
   src/utilities/table_util.cpp
   src/utilities/tensor_util.cpp
+  src/utilities/timestamp_util.cpp
 )
 
 add_library(${PROJECT_NAME}::morpheus ALIAS morpheus)
@@ -95,7 +138,7 @@ add_library(${PROJECT_NAME}::morpheus ALIAS morpheus)
 target_link_libraries(morpheus
   PRIVATE
     matx::matx
-    $<$<CONFIG:Debug>:ZLIB::ZLIB>
+    ZLIB::ZLIB
   PUBLIC
     $<TARGET_NAME_IF_EXISTS:conda_env>
     cudf::cudf
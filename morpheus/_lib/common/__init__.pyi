@@ -6,18 +6,30 @@
         """
 from __future__ import annotations
 import morpheus._lib.common
+import morpheus._lib.messages
 import typing
 import os
 
 __all__ = [
+    "AnomalyScorer",
+    "DocumentExtractor",
     "FiberQueue",
+    "FileBatchCache",
     "FileTypes",
     "FilterSource",
+    "HtmlDocumentConverter",
     "HttpEndpoint",
     "HttpServer",
+    "ModelRegistry",
+    "PiiMasker",
     "Tensor",
+    "TextLengthUnit",
+    "TextSplitter",
+    "TimestampParser",
     "TypeId",
+    "WebFetcher",
     "determine_file_type",
+    "normalize_bucket_lengths",
     "read_file_to_df",
     "typeid_is_fully_supported",
     "typeid_to_numpy_str",
@@ -25,6 +37,23 @@ __all__ = [
 ]
 
 
+class AnomalyScorer():
+    def __init__(self, feature_columns: typing.List[str], threshold: typing.Optional[float] = None, feature_thresholds: typing.Dict[str, float] = {}) -> None: ...
+    def anomaly_ranges(self, abs_z: object, mean_abs_z: object) -> list: ...
+    def has_thresholds(self) -> bool: ...
+    def score(self, losses: object, scalers: typing.List[typing.Tuple[float, float]]) -> dict: ...
+    @property
+    def feature_columns(self) -> typing.List[str]:
+        """
+        :type: typing.List[str]
+        """
+    pass
+class DocumentExtractor():
+    def __init__(self, converters: dict = {}, csv_text_columns: typing.List[str] = ['content'], csv_delimiter: str = ',', num_threads: int = 0) -> None: ...
+    def extract(self, paths: typing.List[str]) -> dict: ...
+    @staticmethod
+    def get_file_type(path: str) -> str: ...
+    pass
 class FiberQueue():
     def __enter__(self) -> FiberQueue: ...
     def __exit__(self, arg0: object, arg1: object, arg2: object) -> None: ...
@@ -34,6 +63,15 @@ class FiberQueue():
     def is_closed(self) -> bool: ...
     def put(self, item: object, block: bool = True, timeout: float = 0.0) -> None: ...
     pass
+class FileBatchCache():
+    def __init__(self, cache_dir: os.PathLike, max_bytes: int, schema_version: str = '') -> None: ...
+    def contains(self, key: str) -> bool: ...
+    def get(self, key: str) -> object: ...
+    def get_bytes(self, key: str) -> object: ...
+    def key(self, path: str, size: int, modified: str) -> str: ...
+    def put(self, key: str, meta: morpheus._lib.messages.MessageMeta) -> None: ...
+    def stats(self) -> dict: ...
+    pass
 class FileTypes():
     """
     The type of files that the `FileSourceStage` can read and `WriteToFileStage` can write. Use 'auto' to determine from the file extension.
@@ -47,6 +85,8 @@ class FileTypes():
       CSV
 
       PARQUET
+
+      AVRO
     """
     def __eq__(self, other: object) -> bool: ...
     def __getstate__(self) -> int: ...
@@ -67,11 +107,12 @@ class FileTypes():
         """
         :type: int
         """
+    AVRO: morpheus._lib.common.FileTypes # value = <FileTypes.AVRO: 4>
     Auto: morpheus._lib.common.FileTypes # value = <FileTypes.Auto: 0>
     CSV: morpheus._lib.common.FileTypes # value = <FileTypes.CSV: 2>
     JSON: morpheus._lib.common.FileTypes # value = <FileTypes.JSON: 1>
     PARQUET: morpheus._lib.common.FileTypes # value = <FileTypes.PARQUET: 3>
-    __members__: dict # value = {'Auto': <FileTypes.Auto: 0>, 'JSON': <FileTypes.JSON: 1>, 'CSV': <FileTypes.CSV: 2>, 'PARQUET': <FileTypes.PARQUET: 3>}
+    __members__: dict # value = {'Auto': <FileTypes.Auto: 0>, 'JSON': <FileTypes.JSON: 1>, 'CSV': <FileTypes.CSV: 2>, 'PARQUET': <FileTypes.PARQUET: 3>, 'AVRO': <FileTypes.AVRO: 4>}
     pass
 class FilterSource():
     """
@@ -109,6 +150,10 @@ class FilterSource():
     TENSOR: morpheus._lib.common.FilterSource # value = <FilterSource.TENSOR: 1>
     __members__: dict # value = {'Auto': <FilterSource.Auto: 0>, 'TENSOR': <FilterSource.TENSOR: 1>, 'DATAFRAME': <FilterSource.DATAFRAME: 2>}
     pass
+class HtmlDocumentConverter():
+    def __init__(self, remove_boilerplate: bool = False) -> None: ...
+    def convert(self, data: str) -> typing.List[str]: ...
+    pass
 class HttpEndpoint():
     def __init__(self, py_parse_fn: function, url: str, method: str) -> None: ...
     pass
@@ -120,6 +165,19 @@ class HttpServer():
     def start(self) -> None: ...
     def stop(self) -> None: ...
     pass
+class ModelRegistry():
+    def __init__(self, model_dir: os.PathLike, memory_budget: int, fallback_entities: typing.List[str] = [], model_name_formatter: str = '{user_id}', num_threads: int = 1) -> None: ...
+    def get(self, entity: str) -> object: ...
+    def is_resident(self, model_name: str) -> bool: ...
+    def model_name(self, entity: str) -> str: ...
+    def prefetch(self, entities: typing.List[str]) -> None: ...
+    def stats(self) -> dict: ...
+    def wait_for_prefetch(self) -> None: ...
+    pass
+class PiiMasker():
+    def __init__(self, entities: typing.List[str], literals: typing.Dict[str, str] = {}, patterns: typing.Dict[str, str] = {}, pseudonymize: bool = False, key: str = '') -> None: ...
+    def mask(self, text: str) -> str: ...
+    pass
 class Tensor():
     @staticmethod
     def from_cupy(arg0: object) -> Tensor: ...
@@ -130,6 +188,61 @@ class Tensor():
         :type: dict
         """
     pass
+class TextLengthUnit():
+    """
+    Unit used to measure the size of text chunks
+
+    Members:
+
+      CHARACTERS
+
+      WORDS
+    """
+    def __eq__(self, other: object) -> bool: ...
+    def __getstate__(self) -> int: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __init__(self, value: int) -> None: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: object) -> bool: ...
+    def __repr__(self) -> str: ...
+    def __setstate__(self, state: int) -> None: ...
+    @property
+    def name(self) -> str:
+        """
+        :type: str
+        """
+    @property
+    def value(self) -> int:
+        """
+        :type: int
+        """
+    CHARACTERS: morpheus._lib.common.TextLengthUnit # value = <TextLengthUnit.CHARACTERS: 0>
+    WORDS: morpheus._lib.common.TextLengthUnit # value = <TextLengthUnit.WORDS: 1>
+    __members__: dict # value = {'CHARACTERS': <TextLengthUnit.CHARACTERS: 0>, 'WORDS': <TextLengthUnit.WORDS: 1>}
+    pass
+class TextSplitter():
+    def __init__(self, chunk_size: int = 4000, chunk_overlap: int = 200, separators: typing.List[str] = [], keep_separator: bool = True, strip_whitespace: bool = True, length_unit: TextLengthUnit = TextLengthUnit.CHARACTERS) -> None: ...
+    def length(self, text: str) -> int: ...
+    def split_text(self, text: str) -> typing.List[str]: ...
+    def split_text_with_offsets(self, text: str) -> typing.List[typing.Tuple[str, int]]: ...
+    @property
+    def chunk_overlap(self) -> int:
+        """
+        :type: int
+        """
+    @property
+    def chunk_size(self) -> int:
+        """
+        :type: int
+        """
+    pass
+class TimestampParser():
+    def __init__(self, sample_size: int = 64, syslog_year: int = 0) -> None: ...
+    def get_format(self, column: str) -> str: ...
+    def parse(self, column: str, values: typing.Sequence) -> object: ...
+    def parse_dataframe(self, df: object, column: str) -> object: ...
+    pass
 class TypeId():
     """
     Supported Morpheus types
@@ -161,6 +274,8 @@ class TypeId():
       BOOL8
 
       STRING
+
+      FLOAT16
     """
     def __eq__(self, other: object) -> bool: ...
     def __getstate__(self) -> int: ...
@@ -183,6 +298,7 @@ class TypeId():
         """
     BOOL8: morpheus._lib.common.TypeId # value = <TypeId.BOOL8: 11>
     EMPTY: morpheus._lib.common.TypeId # value = <TypeId.EMPTY: 0>
+    FLOAT16: morpheus._lib.common.TypeId # value = <TypeId.FLOAT16: 13>
     FLOAT32: morpheus._lib.common.TypeId # value = <TypeId.FLOAT32: 9>
     FLOAT64: morpheus._lib.common.TypeId # value = <TypeId.FLOAT64: 10>
     INT16: morpheus._lib.common.TypeId # value = <TypeId.INT16: 2>
@@ -194,7 +310,16 @@ class TypeId():
     UINT32: morpheus._lib.common.TypeId # value = <TypeId.UINT32: 7>
     UINT64: morpheus._lib.common.TypeId # value = <TypeId.UINT64: 8>
     UINT8: morpheus._lib.common.TypeId # value = <TypeId.UINT8: 5>
-    __members__: dict # value = {'EMPTY': <TypeId.EMPTY: 0>, 'INT8': <TypeId.INT8: 1>, 'INT16': <TypeId.INT16: 2>, 'INT32': <TypeId.INT32: 3>, 'INT64': <TypeId.INT64: 4>, 'UINT8': <TypeId.UINT8: 5>, 'UINT16': <TypeId.UINT16: 6>, 'UINT32': <TypeId.UINT32: 7>, 'UINT64': <TypeId.UINT64: 8>, 'FLOAT32': <TypeId.FLOAT32: 9>, 'FLOAT64': <TypeId.FLOAT64: 10>, 'BOOL8': <TypeId.BOOL8: 11>, 'STRING': <TypeId.STRING: 12>}
+    __members__: dict # value = {'EMPTY': <TypeId.EMPTY: 0>, 'INT8': <TypeId.INT8: 1>, 'INT16': <TypeId.INT16: 2>, 'INT32': <TypeId.INT32: 3>, 'INT64': <TypeId.INT64: 4>, 'UINT8': <TypeId.UINT8: 5>, 'UINT16': <TypeId.UINT16: 6>, 'UINT32': <TypeId.UINT32: 7>, 'UINT64': <TypeId.UINT64: 8>, 'FLOAT32': <TypeId.FLOAT32: 9>, 'FLOAT64': <TypeId.FLOAT64: 10>, 'BOOL8': <TypeId.BOOL8: 11>, 'STRING': <TypeId.STRING: 12>, 'FLOAT16': <TypeId.FLOAT16: 13>}
+    pass
+class WebFetcher():
+    def __init__(self, max_connections: int = 16, timeout: float = 30.0, user_agent: str = 'Morpheus', max_redirects: int = 5, max_body_size: int = 16777216, cache_dir: str = '', fallback_fn: object = None) -> None: ...
+    def fetch(self, urls: typing.List[str]) -> list: ...
+    @property
+    def num_idle_connections(self) -> int:
+        """
+        :type: int
+        """
     pass
 @typing.overload
 def determine_file_type(filename: os.PathLike) -> FileTypes:
@@ -202,6 +327,8 @@ def determine_file_type(filename: os.PathLike) -> FileTypes:
 @typing.overload
 def determine_file_type(filename: str) -> FileTypes:
     pass
+def normalize_bucket_lengths(bucket_lengths: typing.List[int], max_length: int) -> typing.List[int]:
+    pass
 def read_file_to_df(filename: str, file_type: FileTypes = FileTypes.Auto) -> object:
     pass
 def typeid_is_fully_supported(arg0: TypeId) -> bool:
@@ -22,14 +22,24 @@
 #include "morpheus/io/loaders/payload.hpp"
 #include "morpheus/io/loaders/rest.hpp"
 #include "morpheus/io/serializers.hpp"
+#include "morpheus/objects/anomaly_scorer.hpp"
+#include "morpheus/objects/document_converter.hpp"
+#include "morpheus/objects/document_extractor.hpp"
 #include "morpheus/objects/dtype.hpp"  // for TypeId
 #include "morpheus/objects/fiber_queue.hpp"
+#include "morpheus/objects/file_batch_cache.hpp"
 #include "morpheus/objects/file_types.hpp"  // for FileTypes, determine_file_type
 #include "morpheus/objects/filter_source.hpp"
+#include "morpheus/objects/model_registry.hpp"
 #include "morpheus/objects/tensor_object.hpp"  // for TensorObject
+#include "morpheus/objects/text_splitter.hpp"
+#include "morpheus/objects/timestamp_parser.hpp"
+#include "morpheus/objects/web_fetcher.hpp"
 #include "morpheus/objects/wrapped_tensor.hpp"
+#include "morpheus/utilities/bucket_util.hpp"  // for BucketUtil
 #include "morpheus/utilities/cudf_util.hpp"
 #include "morpheus/utilities/http_server.hpp"
+#include "morpheus/utilities/pii_util.hpp"
 #include "morpheus/version.hpp"
 
 #include <mrc/utils/string_utils.hpp>
@@ -42,9 +52,12 @@
 #include <pybind11/stl/filesystem.h>  // IWYU pragma: keep
 
 #include <filesystem>  // for std::filesystem::path
+#include <map>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace morpheus {
 namespace py = pybind11;
@@ -115,7 +128,8 @@ PYBIND11_MODULE(common, _module)
         .value("FLOAT32", TypeId::FLOAT32)
         .value("FLOAT64", TypeId::FLOAT64)
         .value("BOOL8", TypeId::BOOL8)
-        .value("STRING", TypeId::STRING);
+        .value("STRING", TypeId::STRING)
+        .value("FLOAT16", TypeId::FLOAT16);
 
     py::enum_<FileTypes>(_module,
                          "FileTypes",
@@ -124,7 +138,8 @@ PYBIND11_MODULE(common, _module)
         .value("Auto", FileTypes::Auto)
         .value("JSON", FileTypes::JSON)
         .value("CSV", FileTypes::CSV)
-        .value("PARQUET", FileTypes::PARQUET);
+        .value("PARQUET", FileTypes::PARQUET)
+        .value("AVRO", FileTypes::AVRO);
 
     _module.def("typeid_to_numpy_str", [](TypeId tid) {
         return DType(tid).type_str();
@@ -134,6 +149,11 @@ PYBIND11_MODULE(common, _module)
         return DType(tid).is_fully_supported();
     });
 
+    _module.def("normalize_bucket_lengths",
+                &BucketUtil::normalize_bucket_lengths,
+                py::arg("bucket_lengths"),
+                py::arg("max_length"));
+
     _module.def(
         "determine_file_type", py::overload_cast<const std::string&>(&determine_file_type), py::arg("filename"));
     _module.def("determine_file_type",
@@ -146,6 +166,28 @@ PYBIND11_MODULE(common, _module)
                 py::arg("filename"),
                 py::arg("file_type") = FileTypes::Auto);
 
+    py::class_<AnomalyScorer, std::shared_ptr<AnomalyScorer>>(_module, "AnomalyScorer")
+        .def(py::init<std::vector<std::string>, std::optional<double>, const std::map<std::string, double>&>(),
+             py::arg("feature_columns"),
+             py::arg("threshold")          = py::none(),
+             py::arg("feature_thresholds") = std::map<std::string, double>{})
+        .def_property_readonly("feature_columns", &AnomalyScorer::feature_columns)
+        .def("anomaly_ranges", &AnomalyScorerInterfaceProxy::anomaly_ranges, py::arg("abs_z"), py::arg("mean_abs_z"))
+        .def("has_thresholds", &AnomalyScorer::has_thresholds)
+        .def("score", &AnomalyScorerInterfaceProxy::score, py::arg("losses"), py::arg("scalers"));
+
+    py::class_<FileBatchCache, std::shared_ptr<FileBatchCache>>(_module, "FileBatchCache")
+        .def(py::init<std::filesystem::path, std::size_t, std::string>(),
+             py::arg("cache_dir"),
+             py::arg("max_bytes"),
+             py::arg("schema_version") = "")
+        .def("key", &FileBatchCache::key, py::arg("path"), py::arg("size"), py::arg("modified"))
+        .def("contains", &FileBatchCache::contains, py::arg("key"))
+        .def("get", &FileBatchCacheInterfaceProxy::get, py::arg("key"))
+        .def("get_bytes", &FileBatchCacheInterfaceProxy::get_bytes, py::arg("key"))
+        .def("put", &FileBatchCacheInterfaceProxy::put, py::arg("key"), py::arg("meta"))
+        .def("stats", &FileBatchCacheInterfaceProxy::stats);
+
     py::enum_<FilterSource>(
         _module, "FilterSource", "Enum to indicate which source the FilterDetectionsStage should operate on.")
         .value("Auto", FilterSource::Auto)
@@ -169,6 +211,91 @@ PYBIND11_MODULE(common, _module)
         .def("__enter__", &HttpServerInterfaceProxy::enter, py::return_value_policy::reference)
         .def("__exit__", &HttpServerInterfaceProxy::exit);
 
+    py::class_<ModelRegistry, std::shared_ptr<ModelRegistry>>(_module, "ModelRegistry")
+        .def(py::init<std::filesystem::path, std::size_t, std::vector<std::string>, std::string, std::size_t>(),
+             py::arg("model_dir"),
+             py::arg("memory_budget"),
+             py::arg("fallback_entities")    = py::list(),
+             py::arg("model_name_formatter") = "{user_id}",
+             py::arg("num_threads")          = 1)
+        .def("model_name", &ModelRegistry::model_name, py::arg("entity"))
+        .def("get", &ModelRegistryInterfaceProxy::get, py::arg("entity"))
+        .def("prefetch",
+             &ModelRegistry::prefetch,
+             py::arg("entities"),
+             py::call_guard<py::gil_scoped_release>())
+        .def("wait_for_prefetch", &ModelRegistry::wait_for_prefetch, py::call_guard<py::gil_scoped_release>())
+        .def("is_resident", &ModelRegistry::is_resident, py::arg("model_name"))
+        .def("stats", &ModelRegistryInterfaceProxy::stats);
+
+    py::class_<PiiMasker, std::shared_ptr<PiiMasker>>(_module, "PiiMasker")
+        .def(py::init<const std::vector<std::string>&,
+                      const std::map<std::string, std::string>&,
+                      const std::map<std::string, std::string>&,
+                      bool,
+                      const std::string&>(),
+             py::arg("entities"),
+             py::arg("literals")     = py::dict(),
+             py::arg("patterns")     = py::dict(),
+             py::arg("pseudonymize") = false,
+             py::arg("key")          = "")
+        .def("mask", &PiiMasker::mask, py::arg("text"));
+
+    py::class_<TimestampParser, std::shared_ptr<TimestampParser>>(_module, "TimestampParser")
+        .def(py::init<std::size_t, int>(), py::arg("sample_size") = 64, py::arg("syslog_year") = 0)
+        .def("get_format", &TimestampParserInterfaceProxy::get_format, py::arg("column"))
+        .def("parse", &TimestampParserInterfaceProxy::parse, py::arg("column"), py::arg("values"))
+        .def("parse_dataframe", &TimestampParserInterfaceProxy::parse_dataframe, py::arg("df"), py::arg("column"));
+
+    py::class_<DocumentExtractor, std::shared_ptr<DocumentExtractor>>(_module, "DocumentExtractor")
+        .def(py::init<>(&DocumentExtractorInterfaceProxy::init),
+             py::arg("converters")       = py::dict(),
+             py::arg("csv_text_columns") = std::vector<std::string>{"content"},
+             py::arg("csv_delimiter")    = ',',
+             py::arg("num_threads")      = 0)
+        .def("extract", &DocumentExtractorInterfaceProxy::extract, py::arg("paths"))
+        .def_static("get_file_type", &DocumentExtractor::get_file_type, py::arg("path"));
+
+    py::class_<HtmlDocumentConverter, std::shared_ptr<HtmlDocumentConverter>>(_module, "HtmlDocumentConverter")
+        .def(py::init<bool>(), py::arg("remove_boilerplate") = false)
+        .def("convert", &HtmlDocumentConverter::convert, py::arg("data"));
+
+    py::class_<WebFetcher, std::shared_ptr<WebFetcher>>(_module, "WebFetcher")
+        .def(py::init<>(&WebFetcherInterfaceProxy::init),
+             py::arg("max_connections") = 16,
+             py::arg("timeout")         = 30.0,
+             py::arg("user_agent")      = "Morpheus",
+             py::arg("max_redirects")   = 5,
+             py::arg("max_body_size")   = 16 * 1024 * 1024,
+             py::arg("cache_dir")       = "",
+             py::arg("fallback_fn")     = py::none())
+        .def("fetch", &WebFetcherInterfaceProxy::fetch, py::arg("urls"))
+        .def_property_readonly("num_idle_connections", &WebFetcher::num_idle_connections);
+
+    py::enum_<TextLengthUnit>(_module, "TextLengthUnit", "Unit used to measure the size of text chunks")
+        .value("CHARACTERS", TextLengthUnit::Characters)
+        .value("WORDS", TextLengthUnit::Words);
+
+    py::class_<TextSplitter, std::shared_ptr<TextSplitter>>(_module, "TextSplitter")
+        .def(py::init<std::size_t, std::size_t, std::vector<std::string>, bool, bool, TextLengthUnit>(),
+             py::arg("chunk_size")       = 4000,
+             py::arg("chunk_overlap")    = 200,
+             py::arg("separators")       = py::list(),
+             py::arg("keep_separator")   = true,
+             py::arg("strip_whitespace") = true,
+             py::arg("length_unit")      = TextLengthUnit::Characters)
+        .def("split_text",
+             &TextSplitter::split_text,
+             py::arg("text"),
+             py::call_guard<py::gil_scoped_release>())
+        .def("split_text_with_offsets",
+             &TextSplitter::split_text_with_offsets,
+             py::arg("text"),
+             py::call_guard<py::gil_scoped_release>())
+        .def("length", &TextSplitter::length, py::arg("text"))
+        .def_property_readonly("chunk_size", &TextSplitter::chunk_size)
+        .def_property_readonly("chunk_overlap", &TextSplitter::chunk_overlap);
+
     _module.attr("__version__") =
         MRC_CONCAT_STR(morpheus_VERSION_MAJOR << "." << morpheus_VERSION_MINOR << "." << morpheus_VERSION_PATCH);
 }
@@ -46,12 +46,14 @@ namespace morpheus {
  * @param include_header : Determines whether or not to include the header
  * @param include_index_col : Determines whether or not to include the dataframe index
  * @param flush : When `true` flush `out_stream`.
+ * @param na_rep : String written for null values
  */
 void MORPHEUS_EXPORT df_to_csv(const TableInfo& tbl,
                                std::ostream& out_stream,
                                bool include_header,
-                               bool include_index_col = true,
-                               bool flush             = false);
+                               bool include_index_col    = true,
+                               bool flush                = false,
+                               const std::string& na_rep = "");
 
 /**
  * @brief Serialize a dataframe to an output stream in JSON format
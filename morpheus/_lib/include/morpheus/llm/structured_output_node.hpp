@@ -0,0 +1,172 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/llm/fwd.hpp"
+#include "morpheus/llm/llm_node_base.hpp"
+#include "morpheus/types.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace morpheus::llm {
+
+/**
+ * @brief Type of a field declared in the schema of a `StructuredOutputParser`
+ */
+enum class StructuredFieldType : std::uint8_t
+{
+    String,
+    Integer,
+    Float,
+    Boolean,
+    List,
+    Object,
+};
+
+/**
+ * @brief Per-row result of `StructuredOutputParser::parse`, the first error encountered is reported
+ */
+enum class StructuredOutputError : std::int32_t
+{
+    Ok           = 0,
+    NoStructure  = 1,  // The response contains neither a JSON object nor any `key: value` lines of the schema
+    Malformed    = 2,  // A JSON object was found but could not be parsed, even after repair
+    MissingField = 3,  // A required field is missing or null
+    TypeMismatch = 4,  // A field could not be converted to its declared type
+};
+
+/**
+ * @brief A single field of the schema of a `StructuredOutputParser`
+ */
+struct MORPHEUS_EXPORT StructuredField
+{
+    std::string name;
+    StructuredFieldType type{StructuredFieldType::String};
+    bool required{true};
+};
+
+/**
+ * @brief Extracts JSON objects from LLM responses and validates them against a schema.
+ *
+ * The object is taken from the first fenced code block of the response when present, otherwise from the first `{` of
+ * the response which starts a parsable object. Parsing tolerates the common mistakes of LLM output: single quoted
+ * strings, unquoted keys, trailing and missing commas, comments, and the Python literals `True`, `False` and `None`.
+ * When the response contains no object, `key: value` lines whose key names a field of the schema are used instead.
+ *
+ * Keys are matched to fields exactly first, then ignoring case and treating spaces and hyphens as underscores. Values
+ * are converted to the declared type of their field where this is lossless, e.g. `"42"` to an integer.
+ */
+class MORPHEUS_EXPORT StructuredOutputParser
+{
+  public:
+    /**
+     * @brief Result of parsing a single response
+     */
+    struct Result
+    {
+        nlohmann::json fields;  // Object of every field of the schema, missing and invalid fields are null
+        StructuredOutputError error{StructuredOutputError::Ok};
+    };
+
+    /**
+     * @brief Construct a new StructuredOutputParser object
+     *
+     * @param schema : Fields to extract from each response
+     * @param allow_key_value : Whether to fall back to `key: value` lines when a response contains no JSON object
+     */
+    StructuredOutputParser(std::vector<StructuredField> schema, bool allow_key_value = true);
+
+    /**
+     * @brief The fields extracted from each response
+     */
+    const std::vector<StructuredField>& schema() const;
+
+    /**
+     * @brief Parse a single response
+     */
+    Result parse(std::string_view response) const;
+
+    /**
+     * @brief Parse a list of responses, returning an object with a list of values for every field of the schema, and
+     * a list of the `StructuredOutputError` codes of each response under `error_name`. Elements of `responses` which
+     * are not strings are reported as `StructuredOutputError::NoStructure`.
+     */
+    nlohmann::json parse_batch(const nlohmann::json& responses, const std::string& error_name) const;
+
+    /**
+     * @brief Tolerantly parse the JSON value at the start of `text`, ignoring leading whitespace and anything after
+     * the value. Returns `std::nullopt` if no value could be parsed.
+     */
+    static std::optional<nlohmann::json> parse_lenient(std::string_view text);
+
+    /**
+     * @brief Convert `value` to `type`, returning `std::nullopt` if this isn't possible without loss
+     */
+    static std::optional<nlohmann::json> coerce(const nlohmann::json& value, StructuredFieldType type);
+
+    /**
+     * @brief Parse the name of a field type, one of `str`, `int`, `float`, `bool`, `list` or `dict`. The JSON schema
+     * names `string`, `integer`, `number`, `boolean`, `array` and `object` are also accepted.
+     */
+    static StructuredFieldType type_from_string(const std::string& type_name);
+
+  private:
+    std::vector<StructuredField> m_schema;
+    bool m_allow_key_value;
+};
+
+/**
+ * @brief Node which parses the structured output of LLM responses without returning to Python for each response.
+ *
+ * The input is a list of response strings, typically the output of an `LLMGenerateNode`. The output is an object with
+ * a list of values for every field of the schema, converted to their declared type, along with a list of per-row
+ * `StructuredOutputError` codes.
+ */
+class MORPHEUS_EXPORT StructuredOutputNode : public LLMNodeBase
+{
+  public:
+    /**
+     * @brief Construct a new StructuredOutputNode object
+     *
+     * @param parser : Parser used for each response
+     * @param input_name : Name of the input holding the responses
+     * @param error_name : Name of the output holding the error codes
+     */
+    StructuredOutputNode(StructuredOutputParser parser,
+                         std::string input_name = "response",
+                         std::string error_name = "error_code");
+
+    std::vector<std::string> get_input_names() const override;
+
+    Task<std::shared_ptr<LLMContext>> execute(std::shared_ptr<LLMContext> context) override;
+
+  private:
+    StructuredOutputParser m_parser;
+    std::string m_input_name;
+    std::string m_error_name;
+};
+
+}  // namespace morpheus::llm
@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"                   // for MORPHEUS_EXPORT
+#include "morpheus/objects/tensor_object.hpp"  // for TensorObject
+
+#include <pybind11/buffer_info.h>  // for buffer_info
+#include <pybind11/pytypes.h>      // for object, bytes
+
+#include <cstddef>      // for size_t
+#include <memory>       // for shared_ptr
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** MessageAttachment***********************************/
+
+/**
+ * @addtogroup messages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Immutable binary buffer attached to a `ControlMessage` by name, held either in host memory or as a device
+ * tensor. Attachments are shared by reference, copies of a message hold the same attachments without copying their
+ * data, and unlike metadata they are never converted to JSON.
+ */
+class MORPHEUS_EXPORT MessageAttachment
+{
+  public:
+    /**
+     * @brief Construct a host attachment holding `data`
+     */
+    explicit MessageAttachment(std::string data);
+
+    /**
+     * @brief Construct a device attachment holding `tensor`
+     */
+    explicit MessageAttachment(TensorObject tensor);
+
+    /**
+     * @brief Whether the attachment is held in device memory
+     */
+    bool is_device() const;
+
+    /**
+     * @brief Size of the attachment in bytes
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Data of a host attachment
+     *
+     * @throws std::runtime_error If the attachment is held in device memory
+     */
+    std::string_view host_data() const;
+
+    /**
+     * @brief Tensor of a device attachment
+     *
+     * @throws std::runtime_error If the attachment is held in host memory
+     */
+    const TensorObject& tensor() const;
+
+  private:
+    std::string m_host_data;
+    std::optional<TensorObject> m_tensor;
+};
+
+/****** MessageAttachmentInterfaceProxy*********************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT MessageAttachmentInterfaceProxy
+{
+    /**
+     * @brief Create an attachment from a cupy array, held in device memory, or from any object supporting the buffer
+     * protocol such as `bytes`, held in host memory.
+     */
+    static std::shared_ptr<MessageAttachment> init(pybind11::object data);
+
+    /**
+     * @brief Read-only buffer over the data of a host attachment, allowing zero-copy access through `memoryview`
+     */
+    static pybind11::buffer_info buffer(MessageAttachment& self);
+
+    /**
+     * @brief Copy of the data of the attachment as `bytes`, device attachments are copied to host memory
+     */
+    static pybind11::bytes to_bytes(MessageAttachment& self);
+
+    /**
+     * @brief Cupy array viewing the tensor of a device attachment, without copying it
+     */
+    static pybind11::object to_cupy(MessageAttachment& self);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "morpheus/export.h"                  // for MORPHEUS_EXPORT
+#include "morpheus/messages/attachment.hpp"   // for MessageAttachment
 #include "morpheus/messages/meta.hpp"         // for MessageMeta
 #include "morpheus/utilities/json_types.hpp"  // for json_t
 
@@ -179,7 +180,7 @@ class MORPHEUS_EXPORT ControlMessage
     ControlMessage();
     explicit ControlMessage(const morpheus::utilities::json_t& config);
 
-    ControlMessage(const ControlMessage& other);  // Copies config and metadata, but not payload
+    ControlMessage(const ControlMessage& other);  // Copies config and metadata, shares attachments, but not payload
 
     /**
      * @brief Set the configuration object for the control message.
@@ -264,6 +265,47 @@ class MORPHEUS_EXPORT ControlMessage
      */
     [[nodiscard]] std::vector<std::string> list_metadata() const;
 
+    /**
+     * @brief Attach a named binary buffer to the control message, replacing any attachment with the same name.
+     *
+     * Unlike metadata, attachments are not stored as JSON, making them suitable for large binary values such as
+     * serialized models. Attachments are immutable and shared by copies of the message without copying their data.
+     *
+     * @param name A string naming the attachment.
+     * @param attachment A shared pointer to the attachment.
+     */
+    void set_attachment(const std::string& name, std::shared_ptr<const MessageAttachment> attachment);
+
+    /**
+     * @brief Check if an attachment with the given name exists in the control message.
+     * @param name A string naming the attachment.
+     * @return True if the attachment exists, false otherwise.
+     */
+    [[nodiscard]] bool has_attachment(const std::string& name) const;
+
+    /**
+     * @brief Get the attachment with the given name.
+     *
+     * @param name A string naming the attachment.
+     * @param fail_on_nonexist If true, throws an exception when the attachment does not exist.
+     *                         If false, returns nullptr for non-existing attachments.
+     * @return A shared pointer to the attachment, or nullptr if it does not exist.
+     */
+    [[nodiscard]] std::shared_ptr<const MessageAttachment> get_attachment(const std::string& name,
+                                                                          bool fail_on_nonexist = false) const;
+
+    /**
+     * @brief Remove and return the attachment with the given name.
+     * @param name A string naming the attachment.
+     * @return A shared pointer to the removed attachment, or nullptr if it does not exist.
+     */
+    std::shared_ptr<const MessageAttachment> remove_attachment(const std::string& name);
+
+    /**
+     * @brief Lists the names of all attachments of the control message.
+     */
+    [[nodiscard]] std::vector<std::string> list_attachments() const;
+
     /**
      * @brief Retrieves the current payload object of the control message.
      *
@@ -376,6 +418,7 @@ class MORPHEUS_EXPORT ControlMessage
     morpheus::utilities::json_t m_config{};
 
     std::map<std::string, time_point_t> m_timestamps{};
+    std::map<std::string, std::shared_ptr<const MessageAttachment>> m_attachments{};
 };
 
 struct MORPHEUS_EXPORT ControlMessageProxy
@@ -421,6 +464,37 @@ struct MORPHEUS_EXPORT ControlMessageProxy
      */
     static pybind11::list list_metadata(ControlMessage& self);
 
+    /**
+     * @brief Attaches a named binary buffer to the ControlMessage.
+     *
+     * @param self Reference to the underlying ControlMessage object.
+     * @param name The name of the attachment.
+     * @param data A MessageAttachment, a cupy array which is held in device memory, or any object supporting the
+     * buffer protocol such as `bytes` which is copied once into host memory.
+     */
+    static void set_attachment(ControlMessage& self, const std::string& name, pybind11::object data);
+
+    /**
+     * @brief Retrieves an attachment by name, with an optional default value.
+     *
+     * @param self Reference to the underlying ControlMessage object.
+     * @param name The name of the attachment.
+     * @param default_value The value to return if the attachment does not exist.
+     * @return The MessageAttachment, or the default value if the attachment is not found.
+     */
+    static pybind11::object get_attachment(ControlMessage& self,
+                                           const std::string& name,
+                                           pybind11::object default_value);
+
+    /**
+     * @brief Removes and returns an attachment by name.
+     *
+     * @param self Reference to the underlying ControlMessage object.
+     * @param name The name of the attachment.
+     * @return The removed MessageAttachment, or None if the attachment is not found.
+     */
+    static pybind11::object remove_attachment(ControlMessage& self, const std::string& name);
+
     /**
      * @brief Set the payload object given a Python instance of MessageMeta
      * @param meta
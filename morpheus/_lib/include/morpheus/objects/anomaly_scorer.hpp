@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+
+#include <pybind11/pytypes.h>
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** AnomalyScorer***************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Linear scaling of the reconstruction loss of a feature into a z-score, `z = (loss - center) / scale`
+ */
+struct MORPHEUS_EXPORT LossScaler
+{
+    double center{0.0};
+    double scale{1.0};
+};
+
+/**
+ * @brief Scores of a batch of rows computed by `AnomalyScorer::score`
+ */
+struct MORPHEUS_EXPORT AnomalyScores
+{
+    std::size_t num_rows{0};
+
+    // Absolute z-score of each feature, column major, the scores of feature `i` start at `i * num_rows`
+    std::vector<double> feature_abs_z;
+    std::vector<double> max_abs_z;
+    std::vector<double> mean_abs_z;
+
+    // Row ranges, in the form `[start, stop)`, of the rows exceeding a threshold
+    std::vector<std::pair<std::size_t, std::size_t>> anomaly_ranges;
+};
+
+/**
+ * @brief Computes the per-feature and overall anomaly scores of autoencoder reconstruction losses, and finds the rows
+ * exceeding the configured thresholds.
+ *
+ * The absolute z-score of each feature is computed from its loss with the `LossScaler` of the feature, the overall
+ * scores of a row are the max and the mean of the absolute z-scores of its features, skipping null (NaN) losses. A row
+ * is an anomaly when its mean absolute z-score exceeds `threshold`, or when the absolute z-score of any feature exceeds
+ * the threshold of that feature in `feature_thresholds`. Without any threshold every row is an anomaly.
+ *
+ * Instances are immutable and safe to use from multiple threads.
+ */
+class MORPHEUS_EXPORT AnomalyScorer
+{
+  public:
+    /**
+     * @brief Construct a new AnomalyScorer object
+     *
+     * @param feature_columns : Names of the scored features, in the order of the losses passed to `score`
+     * @param threshold : Threshold of the mean absolute z-score of a row
+     * @param feature_thresholds : Thresholds of the absolute z-score of individual features, by feature name
+     *
+     * @throws std::invalid_argument If a feature threshold names a feature not in `feature_columns`
+     */
+    AnomalyScorer(std::vector<std::string> feature_columns,
+                  std::optional<double> threshold                         = std::nullopt,
+                  const std::map<std::string, double>& feature_thresholds = {});
+
+    const std::vector<std::string>& feature_columns() const;
+
+    /**
+     * @brief Whether any threshold was configured, when `false` every row is an anomaly
+     */
+    bool has_thresholds() const;
+
+    /**
+     * @brief Score `num_rows` rows
+     *
+     * @param losses : Losses of each feature, `losses[i]` points to the `num_rows` losses of feature `i`
+     * @param num_rows : Number of rows
+     * @param scalers : Scaler of each feature
+     *
+     * @throws std::invalid_argument If the number of losses or scalers doesn't match the number of features
+     */
+    AnomalyScores score(const std::vector<const double*>& losses,
+                        std::size_t num_rows,
+                        const std::vector<LossScaler>& scalers) const;
+
+    /**
+     * @brief Find the anomalies among `num_rows` rows which were already scored, such as by the model itself
+     *
+     * @param feature_abs_z : Absolute z-scores of each feature, `feature_abs_z[i]` points to the `num_rows` scores of
+     * feature `i`
+     * @param mean_abs_z : Mean absolute z-score of each row
+     * @param num_rows : Number of rows
+     * @return Row ranges, in the form `[start, stop)`, of the rows exceeding a threshold
+     *
+     * @throws std::invalid_argument If the number of scores doesn't match the number of features
+     */
+    std::vector<std::pair<std::size_t, std::size_t>> anomaly_ranges(const std::vector<const double*>& feature_abs_z,
+                                                                    const double* mean_abs_z,
+                                                                    std::size_t num_rows) const;
+
+  private:
+    std::vector<std::string> m_feature_columns;
+    std::optional<double> m_threshold;
+
+    // Indexed like `m_feature_columns`, features without a threshold hold `std::nullopt`
+    std::vector<std::optional<double>> m_feature_thresholds;
+};
+
+/****** AnomalyScorerInterfaceProxy*************************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT AnomalyScorerInterfaceProxy
+{
+    /**
+     * @brief Score the rows of `losses`, a 2-D array with one column per feature, using the `(center, scale)` tuples
+     * of `scalers`. Returns a dictionary holding the `abs_z` 2-D array along with the `max_abs_z` and `mean_abs_z`
+     * arrays as `float64`, and the `anomaly_ranges` as a list of `(start, stop)` tuples. The GIL is released while
+     * scoring.
+     */
+    static pybind11::dict score(AnomalyScorer& self,
+                                pybind11::object losses,
+                                const std::vector<std::pair<double, double>>& scalers);
+
+    /**
+     * @brief Find the anomalies among rows which were already scored, `abs_z` is a 2-D array with one column per
+     * feature and `mean_abs_z` holds the mean of each row. Returns the `(start, stop)` row ranges of the anomalies. The
+     * GIL is released while searching.
+     */
+    static pybind11::list anomaly_ranges(AnomalyScorer& self, pybind11::object abs_z, pybind11::object mean_abs_z);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/objects/decoded_table.hpp"
+#include "morpheus/objects/record_decoder.hpp"
+
+#include <nlohmann/json_fwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** AvroRecordDecoder***********************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Decoder of records in the Avro binary encoding.
+ *
+ * Records are flattened into columns, a union of null and a single other type is a nullable value of that type.
+ * Booleans, ints, longs, floats and doubles are written to columns of the matching type, the `date`,
+ * `timestamp-millis` and `timestamp-micros` logical types to timestamp columns, and strings, bytes, fixed and enum
+ * symbols to string columns. Arrays, maps, other unions and recursive records are written as JSON strings.
+ */
+class MORPHEUS_EXPORT AvroRecordDecoder : public RecordDecoder
+{
+  public:
+    /**
+     * @brief Compile the Avro schema `schema` given as JSON. Throws `std::invalid_argument` when the schema is invalid
+     * or its top level type isn't a record.
+     */
+    AvroRecordDecoder(const std::string& schema);
+
+    void decode(std::string_view record,
+                DecodedTable& table,
+                const std::vector<std::size_t>& column_indices) const override;
+
+  private:
+    enum class Kind : std::uint8_t
+    {
+        Null,
+        Boolean,
+        Int,
+        Long,
+        Float,
+        Double,
+        Bytes,
+        String,
+        Record,
+        Enum,
+        Array,
+        Map,
+        Union,
+        Fixed
+    };
+
+    struct Type
+    {
+        Kind kind;
+        std::string name;  // Full name of named types
+        std::string logical_type;
+        std::vector<std::string> symbols;  // Enum
+        std::size_t size{0};               // Fixed
+        std::vector<std::string> field_names;
+        std::vector<const Type*> children;  // Record fields, union branches or array and map items
+    };
+
+    // A position in the schema of a record, compiled from the types
+    struct Node
+    {
+        const Type* type{nullptr};
+        std::size_t column{0};       // Column of a leaf
+        bool is_leaf{true};          // Leafs write a value to a column, others are records and nullable unions
+        std::size_t null_branch{0};  // Branch of a nullable union which is null
+        std::vector<Node> children;  // Fields of a record, or the value of a nullable union
+    };
+
+    class Reader;
+
+    // Kind of the primitive type `name`, `std::nullopt` when it isn't a primitive type
+    static std::optional<Kind> primitive_kind(const std::string& name);
+
+    const Type* parse_type(const nlohmann::json& schema, const std::string& enclosing_namespace);
+    Node compile(const Type* type, const std::string& name, std::vector<const Type*>& records);
+
+    void decode_node(const Node& node, Reader& reader, DecodedTable& table, const std::vector<std::size_t>& columns)
+        const;
+    void decode_leaf(const Node& node, Reader& reader, DecodedTable& table, std::size_t column) const;
+    nlohmann::json to_json(const Type* type, Reader& reader, std::size_t depth = 0) const;
+
+    // Whether values of `type`, such as nulls and records of nulls, are encoded in zero bytes
+    static bool is_zero_size(const Type* type, std::size_t depth = 0);
+
+    std::deque<Type> m_types;
+    std::map<std::string, const Type*> m_named_types;
+    Node m_root;
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>     // for size_t
+#include <deque>       // for deque
+#include <functional>  // for hash
+#include <string_view>
+#include <unordered_set>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** BoundedHashSet**************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Set of the 64 bit hashes of strings which forgets the oldest hash once `capacity` hashes are stored, used to
+ * remember the keys seen recently with a fixed amount of memory regardless of the size of the keys. Distinct keys with
+ * the same hash are considered equal. A capacity of zero disables the set. Not thread safe, callers are responsible for
+ * locking.
+ */
+class BoundedHashSet
+{
+  public:
+    BoundedHashSet(std::size_t capacity) : m_capacity(capacity) {}
+
+    /**
+     * @brief Insert `key`, evicting the oldest key when full. Returns false if the key was already in the set.
+     */
+    bool insert(std::string_view key)
+    {
+        if (m_capacity == 0)
+        {
+            return true;
+        }
+
+        const auto hash = std::hash<std::string_view>{}(key);
+        if (!m_hashes.insert(hash).second)
+        {
+            return false;
+        }
+
+        if (m_order.size() == m_capacity)
+        {
+            m_hashes.erase(m_order.front());
+            m_order.pop_front();
+        }
+
+        m_order.push_back(hash);
+
+        return true;
+    }
+
+    bool contains(std::string_view key) const
+    {
+        return m_hashes.find(std::hash<std::string_view>{}(key)) != m_hashes.end();
+    }
+
+    std::size_t size() const
+    {
+        return m_order.size();
+    }
+
+    std::size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+  private:
+    std::size_t m_capacity;
+
+    // Oldest hashes are at the front
+    std::deque<std::size_t> m_order;
+    std::unordered_set<std::size_t> m_hashes;
+};
+/** @} */  // end of group
+}  // namespace morpheus
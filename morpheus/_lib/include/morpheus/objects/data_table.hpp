@@ -17,11 +17,14 @@
 
 #pragma once
 
+#include <cudf/column/column.hpp>  // for column
 #include <cudf/types.hpp>
 #include <pybind11/pytypes.h>
 
 #include <memory>
 #include <shared_mutex>
+#include <string>
+#include <vector>
 
 namespace morpheus {
 
@@ -38,6 +41,21 @@ struct MutableTableInfo;
  * @file
  */
 
+/**
+ * @brief Column of a table once a `TableTransaction` is applied, either an existing column, possibly renamed, or a new
+ * column
+ */
+struct TableColumn
+{
+    std::string name;
+
+    // Index of the existing column among the columns of the table, or -1 for a new column
+    cudf::size_type source_idx{-1};
+
+    // Data of a new column
+    std::unique_ptr<cudf::column> column;
+};
+
 /**
  * @brief Owning object which owns a unique_ptr<cudf::table>, table_metadata, and index information
  * Why this doesn't exist in cudf is beyond me
@@ -92,9 +110,9 @@ struct IDataTable : public std::enable_shared_from_this<IDataTable>
      * @brief Direct access to the underlying python object. Use only when absolutely necessary. `get_mutable_info()`
      * provides better checking when using the python object directly.
      *
-     * @return const pybind11::object&
+     * @return pybind11::object
      */
-    virtual const pybind11::object& get_py_object() const = 0;
+    virtual pybind11::object get_py_object() const = 0;
 
   private:
     /**
@@ -105,9 +123,19 @@ struct IDataTable : public std::enable_shared_from_this<IDataTable>
      */
     virtual TableInfoData get_table_data() const = 0;
 
+    /**
+     * @brief Replaces the columns of the table with `columns`, keeping the index, where `table` is the data of the
+     * whole table. Called by `MutableTableInfo` while holding the exclusive lock, must not require the GIL. Must be
+     * implemented by derived classes.
+     */
+    virtual void set_table_columns(const TableInfoData& table, std::vector<TableColumn>&& columns) const = 0;
+
     // Used to prevent locking to shared resources. Will need to be a boost fibers
     // supported mutex if we support C++ nodes with Fiber runables in the future
     mutable std::shared_mutex m_mutex{};
+
+    // Commits transactions and refreshes its views with `get_table_data`
+    friend MutableTableInfo;
 };
 /** @} */  // end of group
 }  // namespace morpheus
@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+
+#include <cudf/io/types.hpp>  // for table_with_metadata
+#include <cudf/types.hpp>     // for type_id, size_type
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** DecodedTable****************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Name and type of a column written by a record decoder
+ */
+struct MORPHEUS_EXPORT DecodedColumnSpec
+{
+    std::string name;
+    cudf::type_id type;
+};
+
+/**
+ * @brief Host side columnar builder of the rows decoded from binary records.
+ *
+ * Rows are written one at a time, a value is written into each column of the row at most once and the columns which
+ * aren't written are null. Columns can be added at any point, such as when a batch holds records of several versions
+ * of a schema, the rows written before a column was added are null. Integral, boolean and timestamp values are held
+ * as 64-bit integers and narrowed when the table is converted to a cuDF table.
+ */
+class MORPHEUS_EXPORT DecodedTable
+{
+  public:
+    /**
+     * @brief Index of the column `name`, which is added when the table doesn't hold it. Throws `std::invalid_argument`
+     * when the table holds the column with a different type.
+     */
+    std::size_t get_column(const std::string& name, cudf::type_id type);
+
+    /**
+     * @brief Indices of the columns of `specs`, in the same order
+     */
+    std::vector<std::size_t> get_columns(const std::vector<DecodedColumnSpec>& specs);
+
+    /**
+     * @brief Start writing a new row
+     */
+    void begin_row();
+
+    /**
+     * @brief Complete the current row, the columns which weren't written are null
+     */
+    void end_row();
+
+    /**
+     * @brief Discard the values written to the current row, used when a record fails to decode part way through
+     */
+    void abort_row();
+
+    void set_int(std::size_t column, std::int64_t value);
+    void set_uint(std::size_t column, std::uint64_t value);
+    void set_float(std::size_t column, double value);
+    void set_string(std::size_t column, std::string_view value);
+
+    /**
+     * @brief Append the rows of `other` after the rows of this table, such as the tables decoded by several threads.
+     * The columns of `other` which this table doesn't hold are added, and the columns missing from `other` are null
+     * in its rows.
+     */
+    void append(const DecodedTable& other);
+
+    /**
+     * @brief Whether `column` was written in the current row
+     */
+    bool is_set(std::size_t column) const;
+
+    std::size_t num_rows() const;
+    std::size_t num_columns() const;
+    const DecodedColumnSpec& column_spec(std::size_t column) const;
+
+    /**
+     * @brief Value of a row of a column, null when the row is null. Strings are returned by `get_string`, unsigned
+     * 64-bit integers by `get_uint` and floating point values by `get_float`.
+     */
+    std::optional<std::int64_t> get_int(std::size_t column, std::size_t row) const;
+    std::optional<std::uint64_t> get_uint(std::size_t column, std::size_t row) const;
+    std::optional<double> get_float(std::size_t column, std::size_t row) const;
+    std::optional<std::string_view> get_string(std::size_t column, std::size_t row) const;
+
+    /**
+     * @brief Copy the table to the device, each column is converted to its type
+     */
+    cudf::io::table_with_metadata to_table() const;
+
+  private:
+    struct Column
+    {
+        DecodedColumnSpec spec;
+
+        std::vector<std::int64_t> ints;  // Integral, unsigned, boolean and timestamp values
+        std::vector<double> floats;
+        std::string chars;
+        std::vector<cudf::size_type> offsets{0};
+        std::vector<bool> valid;
+
+        std::size_t size() const;
+    };
+
+    // Append nulls to `column` until it holds `num_rows` rows
+    static void fill_nulls(Column& column, std::size_t num_rows);
+
+    // Prepare `column` for a value of the current row and return it
+    Column& prepare(std::size_t column);
+
+    // Remove the rows of `column` past `num_rows`
+    static void truncate(Column& column, std::size_t num_rows);
+
+    std::vector<Column> m_columns;
+    std::unordered_map<std::string, std::size_t> m_column_index;
+    std::size_t m_num_rows{0};
+    bool m_in_row{false};
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,188 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** DocumentConverter***********************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Interface of the converters used to extract the text of a document. Converters are shared by the threads
+ * of a `DocumentExtractor` and must be safe to call concurrently.
+ */
+class MORPHEUS_EXPORT DocumentConverter
+{
+  public:
+    virtual ~DocumentConverter() = default;
+
+    /**
+     * @brief Extract the text of a document from its raw bytes. Most formats produce a single text, record based
+     * formats such as CSV produce one text per record. Throws when the document can't be converted.
+     */
+    virtual std::vector<std::string> convert(std::string_view data) const = 0;
+};
+
+/**
+ * @brief Returns the content of the document unchanged, with the exception of a leading UTF-8 byte order mark. The
+ * document is expected to be UTF-8.
+ */
+class MORPHEUS_EXPORT TextDocumentConverter : public DocumentConverter
+{
+  public:
+    std::vector<std::string> convert(std::string_view data) const override;
+};
+
+/**
+ * @brief Converts each record of a CSV document into a text by joining the values of `text_columns` with a space, in
+ * the sorted order of the column names. The first record holds the column names, blank lines are skipped and quoted
+ * values may contain delimiters, newlines and escaped quotes (`""`).
+ */
+class MORPHEUS_EXPORT CsvDocumentConverter : public DocumentConverter
+{
+  public:
+    /**
+     * @brief Construct a new CsvDocumentConverter object
+     *
+     * @param text_columns : Columns joined into the text of each record, all of which must exist in the document
+     * @param delimiter : Character separating the values of a record
+     */
+    CsvDocumentConverter(std::vector<std::string> text_columns = {"content"}, char delimiter = ',');
+
+    std::vector<std::string> convert(std::string_view data) const override;
+
+    /**
+     * @brief Split a CSV document into records of values
+     */
+    static std::vector<std::vector<std::string>> parse(std::string_view data, char delimiter = ',');
+
+  private:
+    std::vector<std::string> m_text_columns;
+    char m_delimiter;
+};
+
+/**
+ * @brief Extracts the visible text of an HTML document. Tags, comments and the content of `script`, `style`,
+ * `noscript` and `template` elements are removed and character references are decoded. Block level elements start a
+ * new line, runs of whitespace within a line are collapsed to a single space and blank lines are dropped.
+ */
+class MORPHEUS_EXPORT HtmlDocumentConverter : public DocumentConverter
+{
+  public:
+    /**
+     * @brief Construct a new HtmlDocumentConverter object
+     *
+     * @param remove_boilerplate : Also remove the content of the `nav`, `header`, `footer`, `aside`, `form`, `menu`
+     * and `dialog` elements, which on most web pages hold the site navigation rather than the page content
+     */
+    HtmlDocumentConverter(bool remove_boilerplate = false);
+
+    std::vector<std::string> convert(std::string_view data) const override;
+
+  private:
+    bool m_remove_boilerplate;
+};
+
+/**
+ * @brief Extracts the text of the paragraphs of a Word (DOCX) document, one line per paragraph. The main document part
+ * `word/document.xml` is read from the zip archive, stored and deflated entries are supported. Tabs and line breaks
+ * within a paragraph are kept, deleted text from tracked changes is not. Unlike `python-docx` the paragraphs of tables
+ * are included.
+ */
+class MORPHEUS_EXPORT DocxDocumentConverter : public DocumentConverter
+{
+  public:
+    std::vector<std::string> convert(std::string_view data) const override;
+
+    /**
+     * @brief Read the uncompressed content of the entry `name` of a zip archive. Throws if the entry can't be found.
+     */
+    static std::string read_zip_entry(std::string_view archive, std::string_view name);
+};
+
+/**
+ * @brief Adapts a function into a `DocumentConverter`, used to plug in converters for other formats.
+ */
+class MORPHEUS_EXPORT FunctionDocumentConverter : public DocumentConverter
+{
+  public:
+    using convert_fn_t = std::function<std::vector<std::string>(std::string_view)>;
+
+    FunctionDocumentConverter(convert_fn_t convert_fn);
+
+    std::vector<std::string> convert(std::string_view data) const override;
+
+  private:
+    convert_fn_t m_convert_fn;
+};
+
+/****** DocumentConverterRegistry***************************/
+
+/**
+ * @brief Maps file types, the lower case extension of a file without the leading dot, to the converter of the type.
+ */
+class MORPHEUS_EXPORT DocumentConverterRegistry
+{
+  public:
+    /**
+     * @brief Registry holding the native converters: `txt`, `csv`, `html`, `htm` and `docx`. The text converter is
+     * the default for types without a converter.
+     *
+     * @param csv_text_columns : Columns joined into the text of each record of CSV documents
+     * @param csv_delimiter : Character separating the values of CSV documents
+     */
+    static DocumentConverterRegistry create_default(std::vector<std::string> csv_text_columns = {"content"},
+                                                    char csv_delimiter                     = ',');
+
+    /**
+     * @brief Register the converter of `file_type`, replacing the existing converter of the type
+     */
+    void register_converter(const std::string& file_type, std::shared_ptr<DocumentConverter> converter);
+
+    /**
+     * @brief Set the converter used for types without a converter, nullptr skips those documents
+     */
+    void set_default_converter(std::shared_ptr<DocumentConverter> converter);
+
+    /**
+     * @brief The converter of `file_type`, the default converter if the type has no converter
+     */
+    std::shared_ptr<DocumentConverter> find_converter(const std::string& file_type) const;
+
+    std::vector<std::string> file_types() const;
+
+  private:
+    std::map<std::string, std::shared_ptr<DocumentConverter>> m_converters;
+    std::shared_ptr<DocumentConverter> m_default_converter;
+};
+/** @} */  // end of group
+}  // namespace morpheus
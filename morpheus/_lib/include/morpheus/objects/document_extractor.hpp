@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/objects/document_converter.hpp"
+
+#include <pybind11/pytypes.h>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** DocumentExtractor***********************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Texts extracted from a set of files along with the metadata of the file of each text, stored by column
+ */
+struct MORPHEUS_EXPORT ExtractedDocuments
+{
+    std::vector<std::string> file_path;
+    std::vector<std::string> file_name;
+    std::vector<std::string> file_type;
+    std::vector<std::string> content;
+
+    // Problem found while extracting the file of each text, such as invalid UTF-8, null when there was none
+    std::vector<std::optional<std::string>> error;
+
+    std::size_t size() const;
+};
+
+/**
+ * @brief Reads files and extracts their text with the converter registered for the type of each file. Files are
+ * handed out one at a time to a pool of threads, so that a few large documents don't hold up the rest of the batch.
+ *
+ * The type of a file is the lower case extension of its name, `none` for files without an extension. Files which
+ * can't be read, have no converter, or fail to convert are logged and skipped, as are empty texts. Invalid UTF-8
+ * sequences in the texts of a file, such as a binary file read as text, are replaced with U+FFFD and recorded in the
+ * `error` of its texts.
+ */
+class MORPHEUS_EXPORT DocumentExtractor
+{
+  public:
+    /**
+     * @brief Construct a new DocumentExtractor object
+     *
+     * @param converters : Converters of each file type
+     * @param num_threads : Number of threads reading and converting files, 0 uses the number of hardware threads
+     */
+    DocumentExtractor(DocumentConverterRegistry converters, std::size_t num_threads = 0);
+
+    /**
+     * @brief Extract the texts of `paths`, in the order of `paths` and the order of the texts within each file
+     */
+    ExtractedDocuments extract(const std::vector<std::string>& paths) const;
+
+    /**
+     * @brief Type of the file at `path`, the lower case extension without the leading dot or `none`
+     */
+    static std::string get_file_type(const std::string& path);
+
+    const DocumentConverterRegistry& converters() const;
+
+  private:
+    std::vector<std::string> extract_file(const std::string& path, const std::string& file_type) const;
+
+    DocumentConverterRegistry m_converters;
+    std::size_t m_num_threads;
+};
+
+/****** DocumentExtractorInterfaceProxy*********************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT DocumentExtractorInterfaceProxy
+{
+    /**
+     * @brief Create a DocumentExtractor with the native converters, along with Python converters for other types
+     *
+     * @param converters : Dictionary of file type to a callable receiving the `bytes` of a file and returning either a
+     * `str` or a list of `str`. These replace the native converter of the same type. Python converters hold the GIL
+     * while converting and don't run concurrently.
+     * @param csv_text_columns : Columns joined into the text of each record of CSV files
+     * @param csv_delimiter : Character separating the values of CSV files
+     * @param num_threads : Number of threads reading and converting files, 0 uses the number of hardware threads
+     */
+    static std::shared_ptr<DocumentExtractor> init(pybind11::dict converters,
+                                                   std::vector<std::string> csv_text_columns,
+                                                   char csv_delimiter,
+                                                   std::size_t num_threads);
+
+    /**
+     * @brief Extract the texts of `paths`, returning a dictionary of lists keyed by `file_path`, `file_name`,
+     * `file_type`, `content` and `error`
+     */
+    static pybind11::dict extract(DocumentExtractor& self, const std::vector<std::string>& paths);
+};
+/** @} */  // end of group
+}  // namespace morpheus
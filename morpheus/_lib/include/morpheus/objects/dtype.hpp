@@ -67,6 +67,7 @@ enum class MORPHEUS_EXPORT TypeId : int32_t
     FLOAT64,  ///< 8 byte floating point
     BOOL8,    ///< Boolean using one byte per value, 0 == false, else true
     STRING,   ///< String elements, not supported by cupy
+    FLOAT16,  ///< 2 byte floating point, only supported by tensors, not by cudf DataFrame columns
 
     //   TIMESTAMP_DAYS,          ///< point in time in days since Unix Epoch in int32
     //   TIMESTAMP_SECONDS,       ///< point in time in seconds since Unix Epoch in int64
@@ -189,6 +190,22 @@ struct MORPHEUS_EXPORT DType
      */
     bool is_fully_supported() const;
 
+    /**
+     * @brief Check if the DType object is a signed or unsigned integer type.
+     *
+     * @return True if the DType object is an integer type, false otherwise.
+     */
+    bool is_integral() const;
+
+    /**
+     * @brief Check if every value of this type can be represented by `other` without loss, following the numpy "safe"
+     * casting rules.
+     *
+     * @param other The DType to convert to.
+     * @return True if the conversion never loses data, false otherwise.
+     */
+    bool can_safely_cast_to(const DType& other) const;
+
     /**
      * @brief Construct a DType object from a C++ type.
      *
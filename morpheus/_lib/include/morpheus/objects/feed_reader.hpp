@@ -0,0 +1,189 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/objects/bounded_hash_set.hpp"
+#include "morpheus/objects/web_fetcher.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** FeedParser******************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief An item of an RSS feed or an entry of an Atom feed. Missing fields are empty.
+ */
+struct MORPHEUS_EXPORT FeedEntry
+{
+    std::string id;  // `guid` or `id`, the link or else the title when the entry has neither
+    std::string title;
+    std::string link;
+    std::string summary;  // `description` or `summary`
+    std::string content;  // `content:encoded` or `content`
+    std::string published;
+    std::string updated;
+    std::string author;
+
+    bool operator==(const FeedEntry& other) const = default;
+};
+
+/**
+ * @brief Incremental parser of RSS 0.9x, 1.0 and 2.0 and Atom 1.0 feeds.
+ *
+ * The document is tokenized as it is received into a stream of start tag, end tag and text events, only the fields of
+ * the entry being parsed are held in memory besides the incomplete markup at the end of the data received so far.
+ * Comments, processing instructions and declarations are skipped, CDATA sections are read as text and character
+ * references are decoded. Namespace prefixes are ignored except for `content:encoded`, `dc:creator` and `dc:date`.
+ */
+class MORPHEUS_EXPORT FeedParser
+{
+  public:
+    /**
+     * @brief Parse the next part of the document, the parts may be split anywhere
+     */
+    void feed(std::string_view data);
+
+    /**
+     * @brief Complete the document and return its entries. Throws `std::invalid_argument` when the document ends
+     * within markup or isn't an RSS or Atom feed.
+     */
+    std::vector<FeedEntry> finish();
+
+    /**
+     * @brief Parse a complete document
+     */
+    static std::vector<FeedEntry> parse(std::string_view document);
+
+  private:
+    struct Attribute
+    {
+        std::string_view name;
+        std::string value;
+    };
+
+    void on_start(std::string_view name, const std::vector<Attribute>& attributes, bool self_closing);
+    void on_end();
+    void on_text(std::string_view text, bool decode);
+
+    std::string m_buffer;  // Data received but not yet tokenized
+    std::size_t m_depth{0};
+    bool m_is_feed{false};
+
+    std::vector<FeedEntry> m_entries;
+    FeedEntry m_entry;
+    std::size_t m_entry_depth{0};  // Depth of the current entry's element, zero outside of entries
+    std::string* m_field{nullptr};
+    std::size_t m_field_depth{0};
+    std::size_t m_skip_depth{0};  // Depth of an element within a field whose text is ignored
+};
+
+/****** FeedReader******************************************/
+struct MORPHEUS_EXPORT FeedReaderConfig
+{
+    // URLs or paths of local files
+    std::vector<std::string> feeds;
+
+    // Number of threads reading and parsing feeds, zero uses the number of hardware threads
+    std::size_t num_threads{0};
+
+    // Number of entry ids remembered to skip entries which were already read
+    std::size_t max_seen_entries{100000};
+
+    // Feeds which failed are skipped until this interval has elapsed
+    std::chrono::milliseconds cooldown_interval{std::chrono::seconds(600)};
+
+    // Replace the markup of the title, summary and content with its text
+    bool strip_markup{false};
+};
+
+/**
+ * @brief Counts of the successful and failed reads of a feed
+ */
+struct MORPHEUS_EXPORT FeedStats
+{
+    std::size_t success_count{0};
+    std::size_t failure_count{0};
+    std::string last_error;
+    std::chrono::steady_clock::time_point last_failure;
+};
+
+/**
+ * @brief Polls a set of RSS and Atom feeds, returning the entries which weren't returned by a previous poll.
+ *
+ * Feeds given as a URL are downloaded in a single batch with the fetch function, such as `WebFetcher::fetch`, while
+ * local files are read in parts as they are parsed. The feeds are parsed concurrently by a pool of threads. Entries are
+ * identified by their id, the ids of the most recent `max_seen_entries` entries are remembered across polls in a
+ * `BoundedHashSet`.
+ */
+class MORPHEUS_EXPORT FeedReader
+{
+  public:
+    using fetch_fn_t = std::function<std::vector<WebResponse>(const std::vector<std::string>& urls)>;
+
+    /**
+     * @brief Construct a new Feed Reader object, throws `std::invalid_argument` when a feed is neither a URL nor an
+     * existing file. Duplicate feeds are read once.
+     *
+     * @param config : Feeds and options of the reader
+     * @param fetch_fn : Function downloading the feeds given as a URL, required when there are any
+     */
+    FeedReader(FeedReaderConfig config, fetch_fn_t fetch_fn = nullptr);
+
+    /**
+     * @brief Read all feeds which aren't cooling down after a failure, returning their new entries in the order of the
+     * feeds. Feeds which can't be read or parsed are logged and skipped.
+     */
+    std::vector<FeedEntry> poll();
+
+    const std::vector<std::string>& feeds() const;
+
+    /**
+     * @brief Stats of `feed`, throws `std::invalid_argument` if it isn't one of the feeds of the reader
+     */
+    FeedStats feed_stats(const std::string& feed) const;
+
+    /**
+     * @brief Whether `feed` is a URL rather than a file path
+     */
+    static bool is_url(std::string_view feed);
+
+  private:
+    FeedReaderConfig m_config;
+    fetch_fn_t m_fetch_fn;
+
+    mutable std::mutex m_mutex;
+    BoundedHashSet m_seen;
+    std::map<std::string, FeedStats> m_stats;
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,180 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/meta.hpp"
+
+#include <pybind11/pytypes.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** FileBatchCache**************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Counters of a `FileBatchCache`
+ */
+struct MORPHEUS_EXPORT FileBatchCacheStats
+{
+    std::size_t hits{0};
+    std::size_t misses{0};
+    std::size_t writes{0};
+    std::size_t evictions{0};
+    std::size_t entries{0};
+    std::size_t bytes{0};
+};
+
+/**
+ * @brief On-disk cache of the DataFrames parsed from individual input files, used to avoid re-reading and re-parsing
+ * files which are part of more than one batch or of a previous run.
+ *
+ * Each DataFrame is stored as a Parquet file named by a 64-bit hash of the path, size and modification time of its
+ * input file together with the schema version of the cache, so that a changed file, or a change to how files are
+ * parsed, results in a new entry. Entries are read by memory mapping the cached file and handed out as `MessageMeta`,
+ * or as the bytes of the file for callers parsing it on the host.
+ * The total size of the cached files is kept within `max_bytes` by removing the least recently used entries, the use
+ * order is persisted through the modification time of the cached files. Thread safe.
+ */
+class MORPHEUS_EXPORT FileBatchCache
+{
+  public:
+    /**
+     * @brief Construct a new FileBatchCache object, indexing the entries already present in `cache_dir`
+     *
+     * @param cache_dir : Directory holding the cached files, created if needed
+     * @param max_bytes : Maximum total size of the cached files
+     * @param schema_version : Identifies how the cached DataFrames were parsed, part of every key
+     */
+    FileBatchCache(std::filesystem::path cache_dir, std::size_t max_bytes, std::string schema_version = "");
+
+    /**
+     * @brief Key of the entry for the input file at `path` with the given size and modification time. `modified` is
+     * any string identifying the modification time, as reported by the file system holding the file.
+     */
+    std::string key(const std::string& path, std::size_t size, const std::string& modified) const;
+
+    /**
+     * @brief Whether an entry for `key` exists
+     */
+    bool contains(const std::string& key) const;
+
+    /**
+     * @brief DataFrame cached for `key`, or nullptr when there is none
+     */
+    std::shared_ptr<MessageMeta> get(const std::string& key);
+
+    /**
+     * @brief Contents of the Parquet file cached for `key`, or `std::nullopt` when there is none. Used by callers which
+     * parse the DataFrame on the host, avoiding a copy to the device and back.
+     */
+    std::optional<std::string> get_bytes(const std::string& key);
+
+    /**
+     * @brief Cache the columns of `meta` for `key`, replacing any existing entry. The index is not cached. Entries
+     * larger than `max_bytes` are not kept.
+     */
+    void put(const std::string& key, const MessageMeta& meta);
+
+    FileBatchCacheStats stats() const;
+
+  private:
+    struct Entry
+    {
+        std::string key;
+        std::size_t bytes;
+
+        // Tells an entry apart from those later stored for the same key
+        std::uint64_t generation;
+    };
+
+    using entry_list_t = std::list<Entry>;
+
+    std::filesystem::path entry_path(const std::string& key) const;
+
+    // Calls `read` with the path of the entry for `key`, updating the use order and the counters. Entries which can't
+    // be read are removed. Returns false when there is no entry or it couldn't be read.
+    bool read_entry(const std::string& key, const std::function<void(const std::filesystem::path&)>& read);
+
+    // All require `m_mutex` to be held
+    void insert(const std::string& key, std::size_t bytes);
+    void erase(const std::string& key);
+    void evict();
+
+    std::filesystem::path m_cache_dir;
+    std::size_t m_max_bytes;
+    std::string m_schema_version;
+
+    mutable std::mutex m_mutex;
+
+    // Most recently used entries are at the front
+    entry_list_t m_entries;
+    std::unordered_map<std::string, entry_list_t::iterator> m_index;
+    std::size_t m_bytes{0};
+    std::uint64_t m_tmp_counter{0};
+    std::uint64_t m_generation{0};
+
+    FileBatchCacheStats m_stats;
+};
+
+/****** FileBatchCacheInterfaceProxy************************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT FileBatchCacheInterfaceProxy
+{
+    /**
+     * @brief DataFrame cached for `key` as a `MessageMeta`, or `None` when there is none. The GIL is released while the
+     * entry is read.
+     */
+    static pybind11::object get(FileBatchCache& self, const std::string& key);
+
+    /**
+     * @brief Contents of the Parquet file cached for `key` as `bytes`, or `None` when there is none. The GIL is
+     * released while the entry is read.
+     */
+    static pybind11::object get_bytes(FileBatchCache& self, const std::string& key);
+
+    /**
+     * @brief Cache the columns of `meta` for `key`, the GIL is released while the entry is written
+     */
+    static void put(FileBatchCache& self, const std::string& key, std::shared_ptr<MessageMeta> meta);
+
+    /**
+     * @brief Counters of the cache as a dictionary
+     */
+    static pybind11::dict stats(FileBatchCache& self);
+};
+/** @} */  // end of group
+}  // namespace morpheus
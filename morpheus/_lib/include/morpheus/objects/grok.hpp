@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/objects/decoded_table.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** GrokLibrary*****************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief A regular expression expanded from a Grok pattern, along with the columns of its named captures
+ */
+struct MORPHEUS_EXPORT GrokExpansion
+{
+    std::string regex;
+    std::vector<DecodedColumnSpec> captures;
+};
+
+/**
+ * @brief Named Grok patterns, which are referenced by other patterns as `%{NAME}`, `%{NAME:field}` or
+ * `%{NAME:field:type}`. The type is one of `str`, `int`, `float`, `bool` and `timestamp`, `str` by default.
+ */
+class MORPHEUS_EXPORT GrokLibrary
+{
+  public:
+    /**
+     * @brief Add the pattern `name`, replacing a pattern of the same name
+     */
+    void add_pattern(const std::string& name, std::string pattern);
+
+    /**
+     * @brief Add the patterns of a pattern file, each line holding a name followed by whitespace and the pattern.
+     * Blank lines and lines starting with `#` are skipped.
+     */
+    void load_file(const std::filesystem::path& path);
+
+    /**
+     * @brief Expand the references of `pattern` recursively. A reference naming a field becomes a named group
+     * `(?<field>...)`, which is the only kind of group captured by `GrokMatcher`. Throws `std::invalid_argument` for
+     * unknown and recursive references, and for a field used with two different types.
+     */
+    GrokExpansion expand(std::string_view pattern) const;
+
+  private:
+    void expand(std::string_view pattern, std::vector<std::string>& stack, GrokExpansion& expansion) const;
+
+    std::map<std::string, std::string, std::less<>> m_patterns;
+};
+
+/****** GrokMatcher*****************************************/
+/**
+ * @brief The pattern of a `GrokMatcher` which matched and the byte range `[begin, end)` of its match
+ */
+struct MORPHEUS_EXPORT GrokMatch
+{
+    std::size_t pattern;
+    std::size_t begin;
+    std::size_t end;
+};
+
+/**
+ * @brief Matches lines against a list of Grok patterns, extracting the named captures of the first pattern which
+ * matches into typed columns.
+ *
+ * The patterns are compiled into a single program. A lazily built DFA, shared by all of the threads using the matcher,
+ * scans each line once to find the first matching pattern without tracking captures, and the captures of that pattern
+ * alone are then extracted by a bounded backtracker visiting each instruction at most once at each position. Lines
+ * whose DFA states or backtracking bitmap would exceed fixed memory bounds are matched by a Pike VM instead. Matching
+ * takes time linear in the length of the line whatever the patterns. Each pattern finds the same match as a
+ * backtracking engine (leftmost, preferring the first alternative, honouring greedy and lazy quantifiers and ending a
+ * loop once an iteration matches the empty string), and the first of the patterns in list order which matches anywhere
+ * in the line wins.
+ *
+ * The supported syntax is the subset of Oniguruma used by Grok pattern libraries: literals and escapes, `.`, classes
+ * including POSIX bracket expressions, `\d \w \s \b` and their negations, `^ $ \A \z \Z` anchors, groups, alternation,
+ * greedy, lazy and possessive quantifiers, and `(?i)`. Lookarounds are limited to a single character or class, such
+ * as `(?<![0-9])`. Atomic groups and possessive quantifiers are matched as regular groups and quantifiers, which only
+ * differs from Oniguruma for patterns that rely on them to fail a match. Matching is byte oriented, classes and `\w`
+ * are ASCII. Trailing line breaks are removed from lines before matching.
+ *
+ * Instances are immutable and safe to use from multiple threads.
+ */
+class MORPHEUS_EXPORT GrokMatcher
+{
+  public:
+    /**
+     * @brief Construct a new GrokMatcher object
+     *
+     * @param library : Patterns referenced by `patterns`
+     * @param patterns : Grok patterns, in order of preference
+     * @param syslog_year : Year of RFC 3164 timestamps captured as `timestamp`, 0 infers the year from the current date
+     */
+    GrokMatcher(const GrokLibrary& library, const std::vector<std::string>& patterns, int syslog_year = 0);
+
+    /**
+     * @brief Columns of the named captures of all of the patterns, in order of first appearance. Captures of the same
+     * name in several patterns share a column.
+     */
+    const std::vector<DecodedColumnSpec>& columns() const;
+
+    std::size_t num_patterns() const;
+
+    /**
+     * @brief Match `line` against the patterns, writing the captures of the first matching pattern to the current row
+     * of `table`. The column `i` of the matcher is the column `column_indices[i]` of the table, as returned by
+     * `DecodedTable::get_columns(columns())`. Captures which didn't participate in the match, and values which can't
+     * be converted to the type of their column, are null.
+     *
+     * @return Index of the matching pattern, `std::nullopt` when none of the patterns match
+     */
+    std::optional<std::size_t> match(std::string_view line,
+                                     DecodedTable& table,
+                                     const std::vector<std::size_t>& column_indices) const;
+
+    /**
+     * @brief Find the first of the patterns which matches `text` at or after the byte `start`, along with the range of
+     * its leftmost match. The bytes preceding `start` are seen by assertions, such as `\b`, but aren't matched. Unlike
+     * `match`, trailing line breaks are kept. Takes time linear in the length of the text, like `match`.
+     *
+     * @return The matching pattern and the range of its match, `std::nullopt` when none of the patterns match
+     */
+    std::optional<GrokMatch> find(std::string_view text, std::size_t start = 0) const;
+
+  private:
+    // Compiled patterns, see grok.cpp
+    struct Program;
+
+    std::shared_ptr<const Program> m_program;
+    std::vector<DecodedColumnSpec> m_columns;
+    int m_syslog_year;
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
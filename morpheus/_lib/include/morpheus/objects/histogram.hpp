@@ -0,0 +1,145 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+
+#include <cmath>    // for isnan
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** FixedWidthHistogram ********************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Distribution shift statistics between a reference and a current histogram
+ */
+struct MORPHEUS_EXPORT DriftMetrics
+{
+    // Population Stability Index
+    double psi{0.0};
+
+    // Kullback-Leibler divergence of the current distribution from the reference distribution
+    double kl{0.0};
+
+    // Kolmogorov-Smirnov statistic, the largest absolute difference between the two cumulative distributions
+    double ks{0.0};
+};
+
+/**
+ * @brief Histogram with a fixed number of equal width buckets over the range `[lower, upper]`. Values outside of the
+ * range are clamped into the first or last bucket and NaN values are ignored.
+ */
+class MORPHEUS_EXPORT FixedWidthHistogram
+{
+  public:
+    /**
+     * @brief Construct a new Fixed Width Histogram object
+     *
+     * @param num_buckets : Number of buckets, must be greater than zero
+     * @param lower : Lower bound of the first bucket
+     * @param upper : Upper bound of the last bucket, must be greater than `lower`
+     */
+    FixedWidthHistogram(std::size_t num_buckets, double lower, double upper);
+
+    /**
+     * @brief Add a single value to the histogram
+     */
+    void add(double value)
+    {
+        if (std::isnan(value))
+        {
+            return;
+        }
+
+        double pos = (value - m_lower) * m_scale;
+
+        std::size_t bucket = 0;
+        if (pos >= static_cast<double>(m_last_bucket))
+        {
+            bucket = m_last_bucket;
+        }
+        else if (pos > 0)
+        {
+            bucket = static_cast<std::size_t>(pos);
+        }
+
+        ++m_counts[bucket];
+        ++m_total;
+    }
+
+    /**
+     * @brief Add `count` values, `stride` elements apart, starting at `values`
+     */
+    void add(const double* values, std::size_t count, std::size_t stride = 1);
+
+    /**
+     * @brief Add the counts of another histogram with the same bucket layout to this one
+     */
+    void merge(const FixedWidthHistogram& other);
+
+    /**
+     * @brief Reset all bucket counts to zero
+     */
+    void clear();
+
+    std::size_t num_buckets() const;
+
+    double lower() const;
+
+    double upper() const;
+
+    const std::vector<std::uint64_t>& counts() const;
+
+    std::uint64_t total() const;
+
+    /**
+     * @brief Fraction of the total count in each bucket. Every bucket is given a minimum proportion of `epsilon` so
+     * that empty buckets do not produce infinite divergences.
+     */
+    std::vector<double> proportions(double epsilon = 1e-6) const;
+
+    /**
+     * @brief Compute the drift of this histogram relative to `reference`, which must have the same number of buckets
+     */
+    DriftMetrics compare(const FixedWidthHistogram& reference, double epsilon = 1e-6) const;
+
+    /**
+     * @brief Compute the drift of `current` relative to `reference` where both are bucket proportions summing to one
+     */
+    static DriftMetrics compare(const std::vector<double>& reference, const std::vector<double>& current);
+
+  private:
+    double m_lower;
+    double m_upper;
+    double m_scale;
+    std::size_t m_last_bucket;
+    std::uint64_t m_total{0};
+    std::vector<std::uint64_t> m_counts;
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>  // for size_t
+#include <list>
+#include <unordered_map>
+#include <utility>  // for move
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** LRUCache********************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Bounded key/value cache which evicts the least recently used entry once `capacity` entries are stored. A
+ * capacity of zero disables the cache. Not thread safe, callers are responsible for locking.
+ */
+template <typename KeyT, typename ValueT>
+class LRUCache
+{
+  public:
+    LRUCache(std::size_t capacity) : m_capacity(capacity) {}
+
+    /**
+     * @brief Returns a pointer to the value stored for `key` marking it as the most recently used entry, or nullptr if
+     * the key is not in the cache. The pointer is invalidated by the next call to `put`.
+     */
+    const ValueT* get(const KeyT& key)
+    {
+        auto found = m_index.find(key);
+        if (found == m_index.end())
+        {
+            ++m_misses;
+            return nullptr;
+        }
+
+        ++m_hits;
+        m_entries.splice(m_entries.begin(), m_entries, found->second);
+
+        return &found->second->second;
+    }
+
+    /**
+     * @brief Insert or replace the value stored for `key`, evicting the least recently used entry when full
+     */
+    void put(const KeyT& key, ValueT value)
+    {
+        if (m_capacity == 0)
+        {
+            return;
+        }
+
+        auto found = m_index.find(key);
+        if (found != m_index.end())
+        {
+            found->second->second = std::move(value);
+            m_entries.splice(m_entries.begin(), m_entries, found->second);
+            return;
+        }
+
+        if (m_entries.size() == m_capacity)
+        {
+            m_index.erase(m_entries.back().first);
+            m_entries.pop_back();
+        }
+
+        m_entries.emplace_front(key, std::move(value));
+        m_index.emplace(key, m_entries.begin());
+    }
+
+    std::size_t size() const
+    {
+        return m_entries.size();
+    }
+
+    std::size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    std::size_t hits() const
+    {
+        return m_hits;
+    }
+
+    std::size_t misses() const
+    {
+        return m_misses;
+    }
+
+  private:
+    using entry_list_t = std::list<std::pair<KeyT, ValueT>>;
+
+    std::size_t m_capacity;
+    std::size_t m_hits{0};
+    std::size_t m_misses{0};
+
+    // Most recently used entries are at the front
+    entry_list_t m_entries;
+    std::unordered_map<KeyT, typename entry_list_t::iterator> m_index;
+};
+/** @} */  // end of group
+}  // namespace morpheus
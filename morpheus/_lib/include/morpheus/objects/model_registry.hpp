@@ -0,0 +1,210 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+
+#include <pybind11/pytypes.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** ModelRegistry***************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Serialized model resolved for an entity, which is the model of a fallback entity when the entity has none
+ */
+struct MORPHEUS_EXPORT ModelEntry
+{
+    std::string entity;
+    std::string model_name;
+    std::shared_ptr<const std::string> blob;
+};
+
+/**
+ * @brief Counters of a `ModelRegistry`. Lookups served from memory are hits, lookups which had to wait for a model to
+ * be read are misses, including models which were still being prefetched.
+ */
+struct MORPHEUS_EXPORT ModelRegistryStats
+{
+    std::size_t hits{0};
+    std::size_t misses{0};
+    std::size_t not_found{0};
+    std::size_t loads{0};
+    std::size_t prefetches{0};
+    std::size_t evictions{0};
+    double total_load_ms{0};
+    double max_load_ms{0};
+    std::size_t resident_models{0};
+    std::size_t resident_bytes{0};
+};
+
+/**
+ * @brief Holds the serialized models of entities, such as the per-user models of DFP, read from a local directory.
+ *
+ * The model of an entity is the file named by substituting `{user_id}` in `model_name_formatter` with the entity.
+ * Entities without a model resolve to the first of `fallback_entities` having one. Models are kept in memory up to
+ * `memory_budget` bytes, evicting the least recently used models once exceeded, a model larger than the budget is
+ * returned without being kept.
+ *
+ * Models are read on demand by `get`, or ahead of time by `prefetch` which hands the reads to a pool of background
+ * threads so that the entities of the next batches are resident by the time they are needed. A lookup of a model
+ * which is already being read waits for that read rather than reading the model again. Thread safe.
+ */
+class MORPHEUS_EXPORT ModelRegistry
+{
+  public:
+    /**
+     * @brief Construct a new ModelRegistry object
+     *
+     * @param model_dir : Directory holding the serialized models
+     * @param memory_budget : Maximum number of bytes of models kept in memory, 0 keeps no models
+     * @param fallback_entities : Entities whose models are used, in order, for entities without a model
+     * @param model_name_formatter : File name of the model of an entity, `{user_id}` is replaced with the entity
+     * @param num_threads : Number of threads prefetching models, 0 uses the number of hardware threads
+     */
+    ModelRegistry(std::filesystem::path model_dir,
+                  std::size_t memory_budget,
+                  std::vector<std::string> fallback_entities = {},
+                  std::string model_name_formatter           = "{user_id}",
+                  std::size_t num_threads                    = 1);
+
+    ~ModelRegistry();
+
+    ModelRegistry(const ModelRegistry&)            = delete;
+    ModelRegistry& operator=(const ModelRegistry&) = delete;
+
+    /**
+     * @brief File name of the model of `entity`
+     */
+    std::string model_name(const std::string& entity) const;
+
+    /**
+     * @brief Model of `entity`, or of its first fallback entity with a model. Reads the model when it isn't resident,
+     * returns `std::nullopt` when neither the entity nor any fallback entity has a model. Throws
+     * `std::invalid_argument` when the model name of the entity resolves outside of the model directory.
+     */
+    std::optional<ModelEntry> get(const std::string& entity);
+
+    /**
+     * @brief Queue the models of `entities` to be read in the background, entities which are already resident or
+     * queued are ignored. Returns immediately.
+     */
+    void prefetch(const std::vector<std::string>& entities);
+
+    /**
+     * @brief Block until all queued prefetches have completed
+     */
+    void wait_for_prefetch();
+
+    /**
+     * @brief Whether the model named `model_name` is currently held in memory
+     */
+    bool is_resident(const std::string& model_name) const;
+
+    ModelRegistryStats stats() const;
+
+  private:
+    using blob_t        = std::shared_ptr<const std::string>;
+    using entry_list_t  = std::list<std::pair<std::string, blob_t>>;
+    using pending_map_t = std::unordered_map<std::string, std::shared_future<blob_t>>;
+
+    /**
+     * @brief Model named `model_name`, reading it unless it is resident or being read. Returns nullptr when the model
+     * doesn't exist.
+     */
+    blob_t load(const std::string& model_name, bool is_prefetch);
+
+    /**
+     * @brief Path of the model named `model_name`, throws `std::invalid_argument` when the path resolves outside of
+     * the model directory.
+     */
+    std::filesystem::path model_path(const std::string& model_name) const;
+
+    blob_t read_model(const std::string& model_name);
+
+    // Both require `m_mutex` to be held
+    void insert(const std::string& model_name, blob_t blob);
+    void evict();
+
+    void worker();
+
+    std::filesystem::path m_model_dir;
+    std::size_t m_memory_budget;
+    std::vector<std::string> m_fallback_entities;
+    std::string m_model_name_formatter;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_queue_cv;
+    std::condition_variable m_idle_cv;
+
+    // Most recently used models are at the front
+    entry_list_t m_entries;
+    std::unordered_map<std::string, entry_list_t::iterator> m_index;
+    std::size_t m_resident_bytes{0};
+
+    // Models being read, so that concurrent lookups of the same model share a single read
+    pending_map_t m_pending;
+
+    std::deque<std::string> m_queue;
+    std::size_t m_active_prefetches{0};
+    bool m_stopping{false};
+
+    ModelRegistryStats m_stats;
+    std::vector<std::thread> m_workers;
+};
+
+/****** ModelRegistryInterfaceProxy*************************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT ModelRegistryInterfaceProxy
+{
+    /**
+     * @brief Model of `entity` as a `(entity, model_name, bytes)` tuple, where `entity` is the entity the model
+     * belongs to, or `None` when neither the entity nor any fallback entity has a model. The GIL is released while the
+     * model is read.
+     */
+    static pybind11::object get(ModelRegistry& self, const std::string& entity);
+
+    /**
+     * @brief Counters of the registry as a dictionary
+     */
+    static pybind11::dict stats(ModelRegistry& self);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/objects/decoded_table.hpp"
+#include "morpheus/objects/record_decoder.hpp"
+
+#include <nlohmann/json_fwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** ProtobufSchema**************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Messages and enums of a Protobuf schema parsed from the text of a `.proto` file.
+ *
+ * Both `proto2` and `proto3` syntax are understood, including nested types, `oneof`, `map` and `optional` fields.
+ * Imports, groups, extensions, services and options are ignored, so fields whose type is defined in an imported file
+ * can't be resolved.
+ */
+class MORPHEUS_EXPORT ProtobufSchema
+{
+  public:
+    enum class FieldType : std::uint8_t
+    {
+        Double,
+        Float,
+        Int32,
+        Int64,
+        UInt32,
+        UInt64,
+        SInt32,
+        SInt64,
+        Fixed32,
+        Fixed64,
+        SFixed32,
+        SFixed64,
+        Bool,
+        String,
+        Bytes,
+        Enum,
+        Message
+    };
+
+    struct Enum
+    {
+        std::string name;  // Fully qualified name
+        std::map<std::int32_t, std::string> values;
+    };
+
+    struct Message;
+
+    struct Field
+    {
+        std::string name;
+        std::uint32_t number{0};
+        FieldType type{FieldType::Int32};
+        std::string type_name;  // Name of enum and message types as written in the schema
+        bool repeated{false};
+        bool has_presence{false};  // Whether the field is null rather than its default when it is absent
+        bool is_map{false};        // The field is a map, its type is the message of the entries
+
+        const Enum* enum_type{nullptr};
+        const Message* message_type{nullptr};
+    };
+
+    struct Message
+    {
+        std::string name;  // Fully qualified name
+        std::vector<Field> fields;
+        std::vector<std::string> nested;  // Names of the nested messages, in the order they are defined
+        std::unordered_map<std::uint32_t, std::size_t> field_index;  // Index of each field number in `fields`
+    };
+
+    /**
+     * @brief Parse the text of a `.proto` file. Throws `std::invalid_argument` when the text is invalid or the type
+     * of a field can't be resolved.
+     */
+    ProtobufSchema(std::string_view text);
+
+    /**
+     * @brief The message `name`, which may be fully qualified or not. Throws `std::invalid_argument` when the schema
+     * doesn't define it.
+     */
+    const Message& message(const std::string& name) const;
+
+    /**
+     * @brief The message of the Confluent wire format message indices, the first is the index of a top level message
+     * and each following one the index of a message nested in the previous one. An empty list is the first message.
+     */
+    const Message& message(const std::vector<std::int64_t>& indices) const;
+
+  private:
+    class Parser;
+
+    void parse_message(Parser& parser, const std::string& scope, Message* parent);
+    void parse_enum(Parser& parser, const std::string& scope);
+    void parse_field(
+        Parser& parser, Message& message, const std::string& label, const std::string& type, bool in_oneof);
+    void resolve(Message& message);
+
+    std::string m_package;
+    bool m_proto3{false};
+    std::deque<Message> m_messages;
+    std::deque<Enum> m_enums;
+    std::vector<std::string> m_top_level;  // Names of the top level messages, in the order they are defined
+    std::map<std::string, Message*> m_message_names;
+    std::map<std::string, Enum*> m_enum_names;
+};
+
+/****** ProtobufRecordDecoder*******************************/
+/**
+ * @brief Decoder of records in the Protobuf binary encoding.
+ *
+ * Singular fields of nested messages are flattened into columns, an absent nested message is null. Integral, boolean
+ * and floating point fields are written to columns of the matching type, strings, bytes and enum names to string
+ * columns. Repeated fields, maps and recursive messages are written as JSON strings, and are null when they are
+ * absent. An absent singular field is null when it has presence, such as `proto2` and `optional` fields and the
+ * members of a `oneof`, and its default otherwise. Unknown fields are skipped.
+ */
+class MORPHEUS_EXPORT ProtobufRecordDecoder : public RecordDecoder
+{
+  public:
+    ProtobufRecordDecoder(std::shared_ptr<const ProtobufSchema> schema, const std::string& message_name);
+
+    void decode(std::string_view record,
+                DecodedTable& table,
+                const std::vector<std::size_t>& column_indices) const override;
+
+  private:
+    // A message of the record, compiled from the schema
+    struct Node
+    {
+        const ProtobufSchema::Message* message{nullptr};
+        std::vector<std::size_t> columns;  // Column of each field, unused for fields which are flattened messages
+        std::vector<std::unique_ptr<Node>> children;  // Flattened message of each field, null for other fields
+    };
+
+    void compile(Node& node, const std::string& prefix, std::vector<const ProtobufSchema::Message*>& messages);
+
+    void decode_message(const Node& node,
+                        std::string_view data,
+                        DecodedTable& table,
+                        const std::vector<std::size_t>& columns,
+                        std::map<std::size_t, nlohmann::json>& repeated) const;
+
+    std::shared_ptr<const ProtobufSchema> m_schema;
+    Node m_root;
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -20,8 +20,15 @@
 #include "morpheus/objects/data_table.hpp"  // for IDataTable
 #include "morpheus/objects/table_info_data.hpp"
 
-#include <cudf/types.hpp>      // for size_type
-#include <pybind11/pytypes.h>  // for object
+#include <cudf/column/column.hpp>  // for column
+#include <cudf/types.hpp>          // for size_type
+#include <pybind11/pytypes.h>      // for object
+
+#include <memory>    // for unique_ptr
+#include <mutex>     // for mutex, unique_lock
+#include <optional>  // for optional
+#include <string>    // for string
+#include <vector>    // for vector
 
 namespace morpheus {
 /****** Component public implementations *******************/
@@ -34,7 +41,9 @@ namespace morpheus {
  */
 
 /**
- * TODO(Documentation)
+ * @brief Data table backed by a Python DataFrame. Columns committed natively with a `TableTransaction` are held in C++
+ * along with the previous DataFrame, which owns the unchanged columns, and are only converted into a new DataFrame the
+ * next time the Python object is needed. This lets C++ stages commit and read their changes without the GIL.
  */
 struct PyDataTable : public IDataTable
 {
@@ -54,16 +63,42 @@ struct PyDataTable : public IDataTable
     cudf::size_type count() const override;
 
     /**
-     * Get cuDF table info
+     * @brief Get the Python DataFrame, converting any natively committed columns first
      *
-     * @return TableInfo
+     * @return pybind11::object
      */
-    const pybind11::object& get_py_object() const override;
+    pybind11::object get_py_object() const override;
 
   private:
+    // Column of the native table, owned by the Python DataFrame when `column` is null. `py_name` and `py_idx` are the
+    // name and position of the column in the Python DataFrame.
+    struct NativeColumn
+    {
+        std::string py_name;
+        cudf::size_type py_idx{-1};
+        std::unique_ptr<cudf::column> column;
+    };
+
+    struct NativeTable
+    {
+        TableInfoData data;
+        std::vector<NativeColumn> columns;
+    };
+
     TableInfoData get_table_data() const override;
 
-    pybind11::object m_py_table;
+    void set_table_columns(const TableInfoData& table, std::vector<TableColumn>&& columns) const override;
+
+    // Locks `m_native_mutex` without holding the GIL, which converting the native table requires
+    std::unique_lock<std::mutex> lock_native() const;
+
+    // Converts the native table into a new DataFrame, `m_native_mutex` must be held
+    void convert_native_table() const;
+
+    mutable pybind11::object m_py_table;
+
+    mutable std::mutex m_native_mutex;
+    mutable std::optional<NativeTable> m_native_table;
 };
 /** @} */  // end of group
 }  // namespace morpheus
@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/objects/decoded_table.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** RecordDecoder***************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Decoder of the binary records of a single schema into the rows of a `DecodedTable`.
+ *
+ * The schema is compiled once into a list of columns, the fields of nested records are flattened into columns named
+ * with the path of the field joined by '.'. Fields which can't be flattened, such as arrays and maps, are written as
+ * JSON strings.
+ */
+class MORPHEUS_EXPORT RecordDecoder
+{
+  public:
+    virtual ~RecordDecoder() = default;
+
+    /**
+     * @brief Columns written by the decoder
+     */
+    const std::vector<DecodedColumnSpec>& columns() const;
+
+    /**
+     * @brief Decode `record` into the current row of `table`. The column `i` of the decoder is the column
+     * `column_indices[i]` of the table, as returned by `DecodedTable::get_columns(columns())`. Throws
+     * `std::runtime_error` when the record is malformed.
+     */
+    virtual void decode(std::string_view record,
+                        DecodedTable& table,
+                        const std::vector<std::size_t>& column_indices) const = 0;
+
+  protected:
+    std::vector<DecodedColumnSpec> m_columns;
+};
+
+/****** SchemaRegistry**************************************/
+/**
+ * @brief Source of the schemas of the records, looked up by the schema id of the Confluent wire format
+ */
+class MORPHEUS_EXPORT SchemaRegistry
+{
+  public:
+    virtual ~SchemaRegistry() = default;
+
+    /**
+     * @brief Text of the schema `schema_id`, throws `std::out_of_range` when the registry doesn't hold it
+     */
+    virtual std::string get_schema(std::int32_t schema_id) = 0;
+};
+
+/**
+ * @brief Schema registry held in memory, a stand-in for a schema registry service
+ */
+class MORPHEUS_EXPORT LocalSchemaRegistry : public SchemaRegistry
+{
+  public:
+    LocalSchemaRegistry(std::map<std::int32_t, std::string> schemas);
+
+    /**
+     * @brief Create a registry holding the contents of the files `schema_files`, keyed by schema id. Throws
+     * `std::invalid_argument` when a file can't be read.
+     */
+    static std::shared_ptr<LocalSchemaRegistry> from_files(const std::map<std::int32_t, std::string>& schema_files);
+
+    std::string get_schema(std::int32_t schema_id) override;
+
+  private:
+    std::map<std::int32_t, std::string> m_schemas;
+};
+
+/****** PayloadDecoder**************************************/
+enum class PayloadFormat : std::uint8_t
+{
+    JSON,
+    Avro,
+    Protobuf
+};
+
+/**
+ * @brief Parse the name of a payload format, one of `json`, `avro` and `protobuf`. Throws `std::invalid_argument`
+ * for unknown names.
+ */
+MORPHEUS_EXPORT PayloadFormat parse_payload_format(const std::string& name);
+
+struct MORPHEUS_EXPORT PayloadDecoderConfig
+{
+    // Either `PayloadFormat::Avro` or `PayloadFormat::Protobuf`
+    PayloadFormat format{PayloadFormat::Avro};
+
+    // Whether the payloads start with the magic byte and schema id of the Confluent wire format, followed by the
+    // indices of the message for Protobuf. Otherwise every payload is a bare record of the schema `schema_id`.
+    bool confluent_framing{true};
+
+    std::int32_t schema_id{0};
+
+    // Fully qualified name of the Protobuf message of bare payloads, the first message of the schema when empty
+    std::string message_name;
+};
+
+class ProtobufSchema;
+
+/**
+ * @brief Decoder of batches of Avro or Protobuf payloads into a `DecodedTable`.
+ *
+ * The schemas are fetched from the registry the first time their id is seen and compiled into a `RecordDecoder`,
+ * which is kept for the life of the decoder. A batch can hold records of several schemas, the table holds the union
+ * of their columns.
+ */
+class MORPHEUS_EXPORT PayloadDecoder
+{
+  public:
+    PayloadDecoder(PayloadDecoderConfig config, std::shared_ptr<SchemaRegistry> registry);
+    ~PayloadDecoder();
+
+    /**
+     * @brief Decode each of `payloads` into a row of the returned table. Payloads which are malformed or whose schema
+     * can't be fetched are logged and skipped, `decoded[i]` is set to whether payload `i` produced a row.
+     */
+    DecodedTable decode(const std::vector<std::string_view>& payloads, std::vector<bool>& decoded);
+
+  private:
+    // Decoder of the records of `schema_id`, `message_indices` select the Protobuf message of the schema
+    const RecordDecoder& get_decoder(std::int32_t schema_id, const std::vector<std::int64_t>& message_indices);
+
+    PayloadDecoderConfig m_config;
+    std::shared_ptr<SchemaRegistry> m_registry;
+
+    std::map<std::int32_t, std::shared_ptr<const ProtobufSchema>> m_protobuf_schemas;
+    std::map<std::pair<std::int32_t, std::vector<std::int64_t>>, std::unique_ptr<RecordDecoder>> m_decoders;
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
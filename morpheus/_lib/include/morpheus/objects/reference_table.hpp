@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/file_types.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** ReferenceTable**************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief How rows without a matching reference row are handled
+ */
+enum class MORPHEUS_EXPORT JoinType : std::int32_t
+{
+    Left,  // Rows without a match are kept, the reference columns are null
+    Inner  // Rows without a match are dropped
+};
+
+/**
+ * @brief Describes a reference table and how it is joined to incoming rows
+ */
+struct MORPHEUS_EXPORT ReferenceTableConfig
+{
+    // File holding the reference table, in any of the formats supported by `load_table_from_file`
+    std::filesystem::path path;
+    FileTypes file_type{FileTypes::Auto};
+
+    // Columns of the incoming rows matched against `reference_key_columns`, in order
+    std::vector<std::string> key_columns;
+
+    // Key columns of the reference table, when empty the names of `key_columns` are used
+    std::vector<std::string> reference_key_columns;
+
+    // Reference columns appended to the incoming rows, when empty all non-key columns are appended
+    std::vector<std::string> columns;
+
+    // Prepended to the names of the appended columns
+    std::string prefix;
+
+    JoinType how{JoinType::Left};
+};
+
+/**
+ * @brief Immutable snapshot of a reference table loaded from a file, along with a hash index over its key columns which
+ * is built once when the table is loaded and then probed by every batch.
+ *
+ * Reference keys are expected to be unique, when a key occurs more than once only its first row is kept so that each
+ * incoming row matches at most one reference row. Null keys never match.
+ */
+class MORPHEUS_EXPORT ReferenceTable
+{
+  public:
+    /**
+     * @brief Load the reference table described by `config`
+     *
+     * @throws std::invalid_argument If a key column or appended column doesn't exist in the file
+     */
+    static std::shared_ptr<const ReferenceTable> load(const ReferenceTableConfig& config);
+
+    ReferenceTable(const ReferenceTable&)            = delete;
+    ReferenceTable& operator=(const ReferenceTable&) = delete;
+
+    const ReferenceTableConfig& config() const;
+
+    /**
+     * @brief Modification time of the file at the time it was loaded
+     */
+    std::filesystem::file_time_type modified() const;
+
+    /**
+     * @brief Number of unique reference rows
+     */
+    cudf::size_type num_rows() const;
+
+    /**
+     * @brief Names of the appended columns, including the prefix
+     */
+    const std::vector<std::string>& column_names() const;
+
+    /**
+     * @brief Probe the hash index with the key columns of a batch, returning the index of the matching reference row of
+     * each row of the batch, or a negative value when there is no match.
+     *
+     * @throws std::invalid_argument If the number or the types of the key columns don't match the reference keys
+     */
+    std::unique_ptr<cudf::column> probe(const cudf::table_view& keys) const;
+
+    /**
+     * @brief Appended columns of the reference rows at `row_map` as returned by `probe`, rows without a match are null
+     */
+    std::unique_ptr<cudf::table> gather(const cudf::column_view& row_map) const;
+
+  private:
+    ReferenceTable(ReferenceTableConfig config,
+                   std::filesystem::file_time_type modified,
+                   std::unique_ptr<cudf::table> keys,
+                   std::unique_ptr<cudf::table> values,
+                   std::vector<std::string> column_names);
+
+    ReferenceTableConfig m_config;
+    std::filesystem::file_time_type m_modified;
+
+    std::unique_ptr<cudf::table> m_keys;
+    std::unique_ptr<cudf::table> m_values;
+    std::vector<std::string> m_column_names;
+
+    // Holds a view of `m_keys`, declared after it so that it is destroyed first
+    std::unique_ptr<cudf::hash_join> m_index;
+};
+
+/**
+ * @brief Join the rows of `meta` to each of `tables`, returning a new `MessageMeta` holding the rows of `meta` followed
+ * by the appended columns of every table. Existing columns with the name of an appended column are replaced. Rows
+ * without a match in a table joined with `JoinType::Inner` are dropped, returns `nullptr` when no rows are left.
+ */
+std::shared_ptr<MessageMeta> MORPHEUS_EXPORT
+enrich_message_meta(const MessageMeta& meta, const std::vector<std::shared_ptr<const ReferenceTable>>& tables);
+/** @} */  // end of group
+}  // namespace morpheus
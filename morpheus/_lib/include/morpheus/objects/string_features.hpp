@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** StringFeatureExtractor******************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Numeric feature computed from a string
+ */
+enum class StringFeatureType : std::uint8_t
+{
+    Length,            // Unicode code points, the same as Python's `len`
+    Entropy,           // Shannon entropy in bits of the distribution of the code points
+    DigitRatio,        // Fraction of the code points which are ASCII digits
+    UpperRatio,        // Fraction of the code points which are ASCII uppercase letters
+    NgramHash,         // Counts of the code point n-grams, hashed into `num_buckets` buckets
+    DomainLabelCount,  // Non-empty dot separated labels of the host of a URL or domain name
+    PathDepth,         // Non-empty segments of the path of a URL or file path
+};
+
+/**
+ * @brief A feature to compute from the string column `column`, stored in the column `name`. N-gram hashes are stored in
+ * the `num_buckets` columns `name_0` to `name_{num_buckets - 1}`.
+ */
+struct MORPHEUS_EXPORT StringFeature
+{
+    std::string column;
+    StringFeatureType type;
+    std::string name;
+    std::size_t ngram_size{3};
+    std::size_t num_buckets{16};
+
+    /**
+     * @brief Names of the output columns of the feature
+     */
+    std::vector<std::string> output_names() const;
+
+    /**
+     * @brief Whether the feature is a count stored as INT32, otherwise it is stored as FLOAT32
+     */
+    bool is_integral() const;
+};
+
+/**
+ * @brief Computes the features of a single string column in one pass over the code points of each string. Null and
+ * empty strings produce zero for every feature. Strings are expected to be UTF-8, each byte of an invalid sequence is
+ * counted as one code point.
+ *
+ * N-grams are hashed with 32-bit FNV-1a over their UTF-8 bytes, the same function as
+ * `morpheus.stages.preprocess.string_features_stage.fnv1a_32`, so that the Python implementation produces the same
+ * buckets.
+ */
+class MORPHEUS_EXPORT StringFeatureExtractor
+{
+  public:
+    /**
+     * @brief Construct a new StringFeatureExtractor object
+     *
+     * @param features : Features to compute, all of the same column
+     */
+    explicit StringFeatureExtractor(std::vector<StringFeature> features);
+
+    /**
+     * @brief Total number of output columns of the features
+     */
+    std::size_t num_outputs() const;
+
+    const std::vector<StringFeature>& features() const;
+
+    /**
+     * @brief Compute the features of `text`, writing `num_outputs()` values to `out` in the order of the features
+     */
+    void extract(std::string_view text, double* out) const;
+
+  private:
+    std::vector<StringFeature> m_features;
+    std::size_t m_num_outputs{0};
+
+    // Offset of the first output of each feature
+    std::vector<std::size_t> m_output_offsets;
+    bool m_needs_histogram{false};
+    std::size_t m_max_ngram_size{0};
+};
+
+/**
+ * @brief 32-bit FNV-1a hash of `bytes`
+ */
+MORPHEUS_EXPORT std::uint32_t fnv1a_32(std::string_view bytes);
+
+/**
+ * @brief Parse the name of a feature type, one of `length`, `entropy`, `digit_ratio`, `upper_ratio`, `ngram_hash`,
+ * `domain_label_count` or `path_depth`
+ */
+MORPHEUS_EXPORT StringFeatureType parse_string_feature_type(const std::string& name);
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/objects/decoded_table.hpp"
+
+#include <cudf/types.hpp>  // for type_id
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** SyslogParser****************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Header fields of a log line, each is written to the column of the same name
+ */
+enum class LogHeaderField : std::uint8_t
+{
+    LogFormat,         // `syslog`, `cef` or `leef`
+    LogFormatVersion,  // Version of the CEF or LEEF event
+    SyslogFacility,    // INT32, from the priority
+    SyslogSeverity,    // INT32, from the priority
+    SyslogTimestamp,   // TIMESTAMP_NANOSECONDS
+    SyslogHostname,
+    SyslogAppName,         // RFC 5424 APP-NAME or RFC 3164 TAG
+    SyslogProcId,
+    SyslogMsgId,           // RFC 5424 only
+    SyslogStructuredData,  // RFC 5424 only, the raw text of the elements
+    SyslogMessage,         // Message following the syslog header, including the CEF or LEEF event
+    DeviceVendor,
+    DeviceProduct,
+    DeviceVersion,
+    EventId,        // CEF Signature ID or LEEF EventID
+    EventName,      // CEF only
+    EventSeverity,  // CEF only, a string since it may be a name such as `High`
+};
+
+/**
+ * @brief A key of the CEF or LEEF extension written to the column `name` of the type `type`, one of STRING, INT64,
+ * FLOAT64, BOOL8 and TIMESTAMP_NANOSECONDS
+ */
+struct MORPHEUS_EXPORT LogExtensionField
+{
+    std::string key;
+    std::string name;
+    cudf::type_id type{cudf::type_id::STRING};
+};
+
+/**
+ * @brief Parses raw log lines into header fields and CEF or LEEF extension values.
+ *
+ * A line holds an RFC 5424 or RFC 3164 syslog header followed by a message, a bare CEF or LEEF event, or a syslog
+ * header wrapping a CEF or LEEF event. The escapes of CEF are decoded, `\|` and `\\` in the header and `\=`, `\\`,
+ * `\n` and `\r` in the extension. LEEF doesn't define escapes and its values are taken as they are, the extension is
+ * split on tabs or on the delimiter declared by LEEF 2.0 events.
+ *
+ * Only the configured extension keys are decoded, the other pairs are skipped. A value which can't be converted to
+ * the type of its column, and a key missing from the event, is null. Timestamps are parsed with
+ * `TimestampUtil::parse_any`, the year of RFC 3164 timestamps is inferred as described there.
+ *
+ * Instances are immutable and safe to use from multiple threads.
+ */
+class MORPHEUS_EXPORT SyslogParser
+{
+  public:
+    /**
+     * @brief Construct a new SyslogParser object
+     *
+     * @param header_fields : Header fields to write, in this order
+     * @param extension_fields : Extension keys to write, after the header fields
+     * @param column_prefix : Prepended to the names of the header columns
+     * @param syslog_year : Year of RFC 3164 timestamps, 0 infers the year from the current date
+     */
+    SyslogParser(std::vector<LogHeaderField> header_fields,
+                 std::vector<LogExtensionField> extension_fields,
+                 const std::string& column_prefix = "",
+                 int syslog_year                  = 0);
+
+    /**
+     * @brief Columns written by the parser
+     */
+    const std::vector<DecodedColumnSpec>& columns() const;
+
+    /**
+     * @brief Parse `line` into the current row of `table`. The column `i` of the parser is the column
+     * `column_indices[i]` of the table, as returned by `DecodedTable::get_columns(columns())`. Throws
+     * `std::runtime_error` when the line is malformed, in which case the row may be partly written.
+     */
+    void parse(std::string_view line, DecodedTable& table, const std::vector<std::size_t>& column_indices) const;
+
+  private:
+    // Parsed parts of a line
+    struct Event;
+
+    // Parse the syslog header of `line` when it has one, returning the message following it
+    static std::string_view parse_syslog(std::string_view line, Event& event);
+
+    // Parse the header of a CEF or LEEF event, returning the extension following it
+    static std::string_view parse_cef(std::string_view text, Event& event);
+    static std::string_view parse_leef(std::string_view text, Event& event, char& delimiter);
+
+    // Parse the `key=value` pairs of a CEF extension
+    void parse_cef_extension(std::string_view text, Event& event) const;
+    void parse_leef_extension(std::string_view text, char delimiter, Event& event) const;
+
+    // Store the extension `value` of `key` when the key is configured, unescaping CEF values
+    void set_extension(std::string_view key, std::string_view value, bool unescape, Event& event) const;
+
+    std::vector<LogHeaderField> m_header_fields;
+    std::vector<LogExtensionField> m_extension_fields;
+    std::vector<DecodedColumnSpec> m_columns;
+    int m_syslog_year;
+
+    // Fields of each configured extension key
+    std::map<std::string, std::vector<std::size_t>, std::less<>> m_extension_index;
+};
+
+/**
+ * @brief Name of a header field, also the name of its column, e.g. `syslog_hostname` for
+ * `LogHeaderField::SyslogHostname`
+ */
+MORPHEUS_EXPORT std::string log_header_field_name(LogHeaderField field);
+
+/**
+ * @brief Parse the name of a header field, the inverse of `log_header_field_name`
+ */
+MORPHEUS_EXPORT LogHeaderField parse_log_header_field(const std::string& name);
+
+/**
+ * @brief All of the header fields, in the order of `LogHeaderField`
+ */
+MORPHEUS_EXPORT std::vector<LogHeaderField> all_log_header_fields();
+
+/**
+ * @brief Parse the name of the type of an extension field, one of `str`, `int`, `float`, `bool` and `timestamp`
+ */
+MORPHEUS_EXPORT cudf::type_id parse_log_extension_type(const std::string& name);
+
+/**
+ * @brief Write the text `value` to `column` of the current row of `table` converted to `type`, one of the types
+ * returned by `parse_log_extension_type`. Values which can't be converted are left null, timestamps are parsed with
+ * `TimestampUtil::parse_any` and RFC 3164 timestamps are in the year `syslog_year`.
+ */
+MORPHEUS_EXPORT void set_log_value(
+    DecodedTable& table, std::size_t column, cudf::type_id type, std::string_view value, int syslog_year);
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -21,6 +21,7 @@
 #include "morpheus/objects/data_table.hpp"
 #include "morpheus/objects/dtype.hpp"
 #include "morpheus/objects/table_info_data.hpp"
+#include "morpheus/objects/table_transaction.hpp"
 
 #include <cudf/column/column_view.hpp>  // for column_view
 #include <cudf/table/table_view.hpp>
@@ -171,12 +172,17 @@ struct MORPHEUS_EXPORT MutableTableInfo : public TableInfoBase
                                std::vector<std::string> column_names = {}) &&;
 
     /**
-     * TODO(Documentation)
+     * @brief Append zero filled columns, empty strings for string columns, with the given names and types. The columns
+     * are committed natively without the GIL. A slice of some of the columns views the inserted columns as well.
+     *
+     * @param columns : Names and types of the columns
      */
     void insert_columns(const std::vector<std::tuple<std::string, morpheus::DType>>& columns);
 
     /**
-     * TODO(Documentation)
+     * @brief Append the columns which don't already exist, see `insert_columns`
+     *
+     * @param columns : Names and types of the columns
      */
     void insert_missing_columns(const std::vector<std::tuple<std::string, morpheus::DType>>& columns);
 
@@ -205,11 +211,40 @@ struct MORPHEUS_EXPORT MutableTableInfo : public TableInfoBase
      */
     std::optional<std::string> ensure_sliceable_index();
 
+    /**
+     * @brief Apply the changes of `transaction` to the whole table at once, under the lock which is already held and
+     * without the GIL. Added and replaced columns must have as many rows as the whole table, even when this object is a
+     * slice, which then views the added columns along with its own. Either all of the changes are applied or, when any
+     * of them is invalid, none of them. Views of the table obtained before the commit, including from the python
+     * object, don't see the changes.
+     *
+     * @throws std::invalid_argument
+     * If a column doesn't exist, already exists or has the wrong number of rows
+     *
+     * @throws std::runtime_error
+     * If the python object is checked out
+     *
+     * @param transaction : Changes to apply
+     */
+    void commit(TableTransaction&& transaction);
+
   private:
+    // Reads the data of the whole table again after the python object was checked out
+    void refresh_table_data();
+
     // We use a unique_lock here to enforce exclusive access
     std::unique_lock<std::shared_mutex> m_lock;
 
     mutable int m_checked_out_ref_count{-1};
+
+    // Data of the whole table, which `commit` applies to, out of date once the python object is checked out
+    TableInfoData m_table_data;
+    bool m_table_data_stale{false};
+
+    // Rows and columns of the whole table viewed by this object, all columns when `m_slice_columns` is empty
+    cudf::size_type m_slice_start{0};
+    cudf::size_type m_slice_stop{-1};
+    std::vector<std::string> m_slice_columns;
 };
 
 /** @} */  // end of group
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+
+#include <cudf/column/column.hpp>  // for column
+
+#include <cstddef>  // for size_t
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace morpheus {
+
+struct MutableTableInfo;
+
+/****** Component public implementations *******************/
+/****** TableTransaction************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Changes to the columns of a table which are staged without locking the table or holding the GIL, then applied
+ * at once by `MutableTableInfo::commit`. The changes are applied in the order they were staged, each one seeing the
+ * result of the previous ones, so that a column can be renamed and a new column added with its former name.
+ */
+class MORPHEUS_EXPORT TableTransaction
+{
+  public:
+    /**
+     * @brief Append the column `name`, which must not exist
+     */
+    TableTransaction& add_column(std::string name, std::unique_ptr<cudf::column> column);
+
+    /**
+     * @brief Replace the data of the existing column `name`, keeping its position
+     */
+    TableTransaction& replace_column(std::string name, std::unique_ptr<cudf::column> column);
+
+    /**
+     * @brief Remove the existing column `name`
+     */
+    TableTransaction& drop_column(std::string name);
+
+    /**
+     * @brief Rename the existing column `name` to `new_name`, which must not exist
+     */
+    TableTransaction& rename_column(std::string name, std::string new_name);
+
+    /**
+     * @brief Number of staged changes
+     */
+    std::size_t size() const;
+
+    bool empty() const;
+
+  private:
+    enum class ChangeType
+    {
+        Add,
+        Replace,
+        Drop,
+        Rename
+    };
+
+    struct Change
+    {
+        ChangeType type;
+        std::string name;
+        std::string new_name;
+        std::unique_ptr<cudf::column> column;
+    };
+
+    std::vector<Change> m_changes;
+
+    friend MutableTableInfo;
+};
+/** @} */  // end of group
+}  // namespace morpheus
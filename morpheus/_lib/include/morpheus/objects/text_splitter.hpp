@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** TextSplitter****************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Unit used to measure the size of chunks
+ */
+enum class TextLengthUnit : std::uint8_t
+{
+    Characters,  // Unicode code points, the same as Python's `len`
+    Words,       // Whitespace separated words, the same as `len(text.split())`
+};
+
+/**
+ * @brief Splits text into overlapping chunks, producing the same chunks as LangChain's
+ * `RecursiveCharacterTextSplitter` configured with the same parameters and literal separators.
+ *
+ * The text is split on the first separator which occurs in it, and consecutive pieces are merged into chunks of at most
+ * `chunk_size` with up to `chunk_overlap` of the previous chunk repeated at the start of the next. Pieces which are
+ * still too large are split recursively with the remaining separators. Text is expected to be UTF-8.
+ */
+class MORPHEUS_EXPORT TextSplitter
+{
+  public:
+    /**
+     * @brief Construct a new TextSplitter object
+     *
+     * @param chunk_size : Maximum size of a chunk, measured in `length_unit`
+     * @param chunk_overlap : Maximum overlap between consecutive chunks, must not exceed `chunk_size`
+     * @param separators : Separators tried in order, an empty separator splits between characters. Empty uses
+     * `{"\n\n", "\n", " ", ""}`
+     * @param keep_separator : Keep each separator at the start of the piece following it
+     * @param strip_whitespace : Strip leading and trailing whitespace from each chunk
+     * @param length_unit : Unit of `chunk_size` and `chunk_overlap`
+     */
+    TextSplitter(std::size_t chunk_size              = 4000,
+                 std::size_t chunk_overlap           = 200,
+                 std::vector<std::string> separators = {},
+                 bool keep_separator                 = true,
+                 bool strip_whitespace               = true,
+                 TextLengthUnit length_unit          = TextLengthUnit::Characters);
+
+    /**
+     * @brief Split `text` into chunks
+     */
+    std::vector<std::string> split_text(std::string_view text) const;
+
+    /**
+     * @brief Split `text` into chunks along with the character offset of each chunk in `text`. Offsets are found the
+     * same way as LangChain's `add_start_index` option, -1 if the chunk isn't a substring of `text`.
+     */
+    std::vector<std::pair<std::string, std::int64_t>> split_text_with_offsets(std::string_view text) const;
+
+    /**
+     * @brief Size of `text` in the unit of the splitter
+     */
+    std::size_t length(std::string_view text) const;
+
+    std::size_t chunk_size() const;
+    std::size_t chunk_overlap() const;
+
+  private:
+    void split_recursive(std::string_view text, std::size_t first_separator, std::vector<std::string>& chunks) const;
+
+    void merge_splits(const std::vector<std::string_view>& splits,
+                      std::string_view separator,
+                      std::vector<std::string>& chunks) const;
+
+    std::size_t m_chunk_size;
+    std::size_t m_chunk_overlap;
+    std::vector<std::string> m_separators;
+    bool m_keep_separator;
+    bool m_strip_whitespace;
+    TextLengthUnit m_length_unit;
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
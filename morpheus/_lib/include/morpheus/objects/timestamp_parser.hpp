@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/utilities/timestamp_util.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <pybind11/pytypes.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** TimestampParser*************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Parses string columns into UTC timestamps. The format of each column is detected once from a sample of its
+ * values and cached by column name, after which values are parsed with the strict fixed layout parser of that format.
+ * Values which don't match the detected format fall back to the general parser of `TimestampUtil::parse_any`. When
+ * the majority of a batch requires the fallback the cached format is discarded and re-detected on the next batch.
+ *
+ * Instances are safe to use from multiple threads.
+ */
+class MORPHEUS_EXPORT TimestampParser
+{
+  public:
+    /**
+     * @brief Construct a new TimestampParser object
+     *
+     * @param sample_size : Number of non-null values used to detect the format of a column
+     * @param syslog_year : Year of syslog timestamps, 0 infers the year from the current date
+     */
+    TimestampParser(std::size_t sample_size = 64, int syslog_year = 0);
+
+    /**
+     * @brief The cached format of `column`, `TimestampFormat::Unknown` if it hasn't been detected
+     */
+    TimestampFormat get_format(const std::string& column) const;
+
+    /**
+     * @brief Parse `values` of `column`, returning nanoseconds since the Unix epoch. Null and unparsable values are
+     * returned as `TimestampUtil::NaT`.
+     */
+    std::vector<std::int64_t> parse(const std::string& column,
+                                    const std::vector<std::optional<std::string_view>>& values);
+
+    /**
+     * @brief Parse a strings column, returning a `TIMESTAMP_NANOSECONDS` column. Null and unparsable values are null.
+     */
+    std::unique_ptr<cudf::column> parse_column(const std::string& column, const cudf::column_view& strings);
+
+  private:
+    TimestampFormat detect(const std::string& column, const std::vector<std::optional<std::string_view>>& values);
+
+    std::size_t m_sample_size;
+    int m_syslog_year;
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, TimestampFormat> m_formats;
+};
+
+/****** TimestampParserInterfaceProxy***********************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT TimestampParserInterfaceProxy
+{
+    /**
+     * @brief Name of the cached format of `column`
+     */
+    static std::string get_format(TimestampParser& self, const std::string& column);
+
+    /**
+     * @brief Parse a sequence of Python strings, returning a numpy `int64` array of nanoseconds since the Unix epoch.
+     * Values which are not strings, and strings which can't be parsed, are returned as `NaT`.
+     */
+    static pybind11::object parse(TimestampParser& self, const std::string& column, const pybind11::sequence& values);
+
+    /**
+     * @brief Parse `column` of a cudf DataFrame, returning a DataFrame with a single `datetime64[ns]` column of the
+     * same name.
+     */
+    static pybind11::object parse_dataframe(TimestampParser& self, pybind11::object df, const std::string& column);
+};
+/** @} */  // end of group
+}  // namespace morpheus
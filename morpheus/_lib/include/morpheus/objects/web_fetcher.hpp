@@ -0,0 +1,188 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+
+#include <pybind11/pytypes.h>
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** WebFetcher******************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief The parts of an absolute `http` or `https` URL
+ */
+struct MORPHEUS_EXPORT ParsedUrl
+{
+    std::string scheme;  // Lower case
+    std::string host;    // Lower case, without the brackets of IPv6 addresses
+    std::string port;    // The default port of the scheme when the URL has none
+    std::string target;  // Path and query, `/` when the URL has no path, without the fragment
+
+    /**
+     * @brief Parse an absolute URL, returns an empty optional when `url` isn't an `http` or `https` URL
+     */
+    static std::optional<ParsedUrl> parse(std::string_view url);
+
+    /**
+     * @brief Resolve the value of a `Location` header, which may be relative, against this URL
+     */
+    std::optional<ParsedUrl> resolve(std::string_view location) const;
+
+    std::string str() const;
+};
+
+/**
+ * @brief Result of fetching a URL
+ */
+struct MORPHEUS_EXPORT WebResponse
+{
+    std::string url;        // Requested URL
+    std::string final_url;  // URL of the response after following redirects
+    int status{0};          // HTTP status, 0 when the request failed
+    std::string content_type;
+    std::string body;
+    std::string etag;           // `ETag` header of the response, empty when the server sent none
+    std::string last_modified;  // `Last-Modified` header of the response, empty when the server sent none
+    bool from_cache{false};  // The server confirmed the cached response is current
+    std::string error;       // Why the request failed, empty when a response was received
+
+    /**
+     * @brief Whether a response with a 2xx status was received
+     */
+    bool ok() const;
+};
+
+struct MORPHEUS_EXPORT WebFetcherConfig
+{
+    // Maximum number of requests in flight at once
+    std::size_t max_connections{16};
+    std::chrono::milliseconds timeout{std::chrono::seconds(30)};
+    std::string user_agent{"Morpheus"};
+    std::size_t max_redirects{5};
+    std::size_t max_body_size{16 * 1024 * 1024};
+
+    // Directory of the response cache, an empty path disables caching
+    std::filesystem::path cache_dir;
+};
+
+/**
+ * @brief Fetches batches of `http` URLs concurrently with a pool of keep-alive connections, which persists across
+ * batches so that pages of the same site reuse their connections.
+ *
+ * All requests of a batch are multiplexed on a single thread with asynchronous I/O, up to `max_connections` at a time.
+ * Redirects are followed and a failed request on a reused connection, which the server may have closed while it was
+ * idle, is retried once on a new connection.
+ *
+ * Responses carrying an `ETag` or `Last-Modified` validator are written to the on-disk cache, keyed by the URL and the
+ * validator. Requests for a cached URL are sent with the matching `If-None-Match` or `If-Modified-Since` header and a
+ * `304 Not Modified` response is answered from the cache.
+ *
+ * URLs of other schemes, notably `https`, are passed to the fallback function when one is given, after the `http`
+ * requests of the batch have completed, and fail otherwise. The fallback function is called from up to
+ * `max_connections` threads at once, with the conditional headers of the cached response of the URL, if any. Batches
+ * are fetched one at a time.
+ */
+class MORPHEUS_EXPORT WebFetcher
+{
+  public:
+    // Receives the URL and additional request headers, must be safe to call concurrently
+    using fallback_fn_t =
+        std::function<WebResponse(const std::string& url, const std::map<std::string, std::string>& headers)>;
+
+    WebFetcher(WebFetcherConfig config = {}, fallback_fn_t fallback_fn = nullptr);
+    ~WebFetcher();
+
+    WebFetcher(const WebFetcher&)            = delete;
+    WebFetcher& operator=(const WebFetcher&) = delete;
+
+    /**
+     * @brief Fetch `urls`, returning a response for each URL in the same order. Never throws for a failed request, the
+     * `error` of its response is set instead.
+     */
+    std::vector<WebResponse> fetch(const std::vector<std::string>& urls);
+
+    const WebFetcherConfig& config() const;
+
+    /**
+     * @brief Number of idle connections held by the pool
+     */
+    std::size_t num_idle_connections() const;
+
+  private:
+    struct Impl;
+
+    WebFetcherConfig m_config;
+    fallback_fn_t m_fallback_fn;
+    std::unique_ptr<Impl> m_impl;
+};
+
+/****** WebFetcherInterfaceProxy****************************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT WebFetcherInterfaceProxy
+{
+    /**
+     * @brief Create a WebFetcher
+     *
+     * @param max_connections : Maximum number of requests in flight at once
+     * @param timeout : Timeout in seconds of each step of a request
+     * @param user_agent : Value of the `User-Agent` header
+     * @param max_redirects : Maximum number of redirects followed for each URL
+     * @param max_body_size : Maximum size in bytes of a response body
+     * @param cache_dir : Directory of the response cache, an empty string disables caching
+     * @param fallback_fn : Callable receiving a URL which isn't an `http` URL and a dictionary `headers` of additional
+     * request headers, returning a dictionary with the keys `status`, `content_type`, `body` and optionally
+     * `final_url`, `etag` and `last_modified`, or raising an exception if the request failed. Called from several
+     * threads at once, each call holds the GIL.
+     */
+    static std::shared_ptr<WebFetcher> init(std::size_t max_connections,
+                                            double timeout,
+                                            std::string user_agent,
+                                            std::size_t max_redirects,
+                                            std::size_t max_body_size,
+                                            std::string cache_dir,
+                                            pybind11::object fallback_fn);
+
+    /**
+     * @brief Fetch `urls`, returning a list of dictionaries with the keys `url`, `final_url`, `status`, `content_type`,
+     * `body` (`bytes`), `from_cache` and `error`. The GIL is released while fetching.
+     */
+    static pybind11::list fetch(WebFetcher& self, const std::vector<std::string>& urls);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/objects/decoded_table.hpp"
+
+#include <cudf/types.hpp>  // for type_id
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** WindowsEventParser**********************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief A flattened key of a Windows event written to the column `name` of the type `type`, one of STRING, INT64,
+ * FLOAT64, BOOL8 and TIMESTAMP_NANOSECONDS. A field with `event_ids` is only written for events with one of those
+ * IDs, a field without is written for every event.
+ */
+struct MORPHEUS_EXPORT WindowsEventField
+{
+    std::string key;
+    std::string name;
+    cudf::type_id type{cudf::type_id::STRING};
+    std::vector<std::int64_t> event_ids;
+};
+
+/**
+ * @brief Flattens Windows events rendered as XML, or as JSON by collection agents, into typed columns.
+ *
+ * XML events are read in a single pass without building a document, values are views of the event unless they hold
+ * entity references or CDATA sections. The keys of an XML event are the dotted paths of its leaf elements below the
+ * root element, with the `System` and `EventData` sections and the `UserData` section along with its wrapper element
+ * left out. An attribute is keyed by its element followed by a dot and the attribute name, and the `Data` elements of
+ * `EventData` are keyed by their `Name` attribute, so `EventID`, `TimeCreated.SystemTime`, `Security.UserID`,
+ * `TargetUserName` and `RenderingInfo.Message` are all keys. Namespace prefixes are dropped.
+ *
+ * The keys of a JSON event are the dotted paths of its scalar values, and a configured key matches a path equal to it
+ * or ending with a dot followed by it, so both `event_data.LogonType` and `LogonType` match the Winlogbeat path
+ * `winlog.event_data.LogonType`. The `@` prefix of attribute names and `#text` members produced by XML converters are
+ * dropped, and an object holding a `Name` and a `#text` or `Value` member is also keyed by its name.
+ *
+ * The first value of each column in document order is written. A value which can't be converted to the type of its
+ * column, and a key missing from the event, is null. Timestamps are parsed with `TimestampUtil::parse_any`.
+ *
+ * Instances are immutable and safe to use from multiple threads.
+ */
+class MORPHEUS_EXPORT WindowsEventParser
+{
+  public:
+    /**
+     * @brief Construct a new WindowsEventParser object
+     *
+     * @param fields : Keys to write. Fields naming the same column, such as the fields of several event IDs, share it
+     * and must have the same type.
+     * @param event_id_key : Key holding the ID of an event, which selects the fields restricted to some event IDs
+     */
+    WindowsEventParser(std::vector<WindowsEventField> fields, std::string event_id_key = "EventID");
+
+    /**
+     * @brief Columns written by the parser, in order of first appearance in the fields
+     */
+    const std::vector<DecodedColumnSpec>& columns() const;
+
+    /**
+     * @brief Parse `event` into the current row of `table`. The column `i` of the parser is the column
+     * `column_indices[i]` of the table, as returned by `DecodedTable::get_columns(columns())`. Throws
+     * `std::runtime_error` when the event is malformed, in which case nothing is written.
+     */
+    void parse(std::string_view event, DecodedTable& table, const std::vector<std::size_t>& column_indices) const;
+
+  private:
+    // Where the values of a key are written
+    struct Target
+    {
+        std::size_t column;
+        cudf::type_id type;
+        std::vector<std::int64_t> event_ids;
+    };
+
+    std::vector<DecodedColumnSpec> m_columns;
+
+    // Targets of each configured key, the event ID key is always present
+    std::map<std::string, std::vector<Target>, std::less<>> m_keys;
+    std::string m_event_id_key;
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/control.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** DeduplicateStage************************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Hashes the `columns` of each row in the payload and records the row hash and the index of the first row in
+ * the batch with the same hash into the `DedupUtil::HashColumn` and `DedupUtil::IndexColumn` columns. Downstream
+ * `PreprocessNLPStage`, `PreprocessFILStage` and `InferenceClientStage` use these columns to only process the unique
+ * rows of the batch. Both columns are expected to be preallocated.
+ */
+class MORPHEUS_EXPORT DeduplicateStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<ControlMessage>, std::shared_ptr<ControlMessage>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<ControlMessage>, std::shared_ptr<ControlMessage>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new Deduplicate Stage object
+     *
+     * @param columns : Columns used to identify duplicate rows, when empty all columns are used
+     */
+    DeduplicateStage(std::vector<std::string> columns);
+
+  private:
+    source_type_t on_data(sink_type_t x);
+
+    std::vector<std::string> m_columns;
+};
+
+/****** DeduplicateStageInterfaceProxy**********************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT DeduplicateStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a DeduplicateStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param columns : Columns used to identify duplicate rows, when empty all columns are used
+     * @return std::shared_ptr<mrc::segment::Object<DeduplicateStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<DeduplicateStage>> init(mrc::segment::Builder& builder,
+                                                                        const std::string& name,
+                                                                        std::vector<std::string> columns);
+};
+/** @} */  // end of group
+}  // namespace morpheus
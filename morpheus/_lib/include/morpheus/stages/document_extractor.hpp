@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/control.hpp"
+#include "morpheus/objects/document_extractor.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pybind11/pytypes.h>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** DocumentExtractorStage******************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Extracts the text of the files listed in the `path_column` of the payload with a `DocumentExtractor`,
+ * replacing the payload with a table holding one row per extracted text. The table has the string columns
+ * `file_path`, `file_name`, `file_type`, `content` and `error`, ready to be split by the `TextChunkerStage`.
+ */
+class MORPHEUS_EXPORT DocumentExtractorStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<ControlMessage>, std::shared_ptr<ControlMessage>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<ControlMessage>, std::shared_ptr<ControlMessage>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new DocumentExtractor Stage object
+     *
+     * @param extractor : Extractor used to read and convert the files
+     * @param path_column : String column holding the paths of the files, null paths are ignored
+     */
+    DocumentExtractorStage(std::shared_ptr<DocumentExtractor> extractor, std::string path_column);
+
+  private:
+    source_type_t on_data(sink_type_t x);
+
+    std::vector<std::string> get_paths(const std::shared_ptr<MessageMeta>& payload) const;
+
+    std::shared_ptr<DocumentExtractor> m_extractor;
+    std::string m_path_column;
+};
+
+/****** DocumentExtractorStageInterfaceProxy****************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT DocumentExtractorStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a DocumentExtractorStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param path_column : String column holding the paths of the files
+     * @param converters : Dictionary of file type to a Python callable receiving the `bytes` of a file and returning
+     * either a `str` or a list of `str`
+     * @param csv_text_columns : Columns joined into the text of each record of CSV files
+     * @param csv_delimiter : Character separating the values of CSV files
+     * @param num_threads : Number of threads reading and converting files, 0 uses the number of hardware threads
+     * @return std::shared_ptr<mrc::segment::Object<DocumentExtractorStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<DocumentExtractorStage>> init(
+        mrc::segment::Builder& builder,
+        const std::string& name,
+        std::string path_column,
+        pybind11::dict converters,
+        std::vector<std::string> csv_text_columns,
+        char csv_delimiter,
+        std::size_t num_threads);
+};
+/** @} */  // end of group
+}  // namespace morpheus
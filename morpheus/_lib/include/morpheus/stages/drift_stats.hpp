@@ -0,0 +1,193 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/control.hpp"
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/messages/multi_response.hpp"
+#include "morpheus/objects/histogram.hpp"
+#include "morpheus/types.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** DriftStatsStage*************************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Maintains fixed width histograms of the model outputs and a set of numeric feature columns, and computes
+ * PSI, KL and KS statistics against a reference distribution over tumbling windows of `window_size` rows. One
+ * `MessageMeta` is emitted per completed window with one row per tracked column containing the columns `window`,
+ * `name`, `count`, `psi`, `kl` and `ks`.
+ *
+ * When no reference distribution is provided, the first `reference_windows` windows are used as the reference and do
+ * not produce any output.
+ */
+template <typename InputT>
+class MORPHEUS_EXPORT DriftStatsStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<InputT>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<InputT>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new Drift Stats Stage object
+     *
+     * @param tensor_name : Name of the output tensor to track, each column of the tensor is tracked separately
+     * @param labels : Names for the columns of the output tensor, unnamed columns are named by their index
+     * @param feature_ranges : Numeric DataFrame columns to track mapped to the `(lower, upper)` range of their buckets
+     * @param window_size : Number of rows in each tumbling window
+     * @param num_buckets : Number of histogram buckets for each tracked column
+     * @param reference_windows : Number of initial windows used to build the reference when `reference` is empty
+     * @param reference : Reference bucket proportions keyed by label or feature name
+     */
+    DriftStatsStage(std::string tensor_name,
+                    std::vector<std::string> labels,
+                    std::map<std::string, std::pair<double, double>> feature_ranges,
+                    TensorIndex window_size,
+                    std::size_t num_buckets,
+                    std::size_t reference_windows,
+                    std::map<std::string, std::vector<double>> reference);
+
+  private:
+    struct TrackedColumn
+    {
+        std::string name;
+        FixedWidthHistogram current;
+        FixedWidthHistogram reference;
+        std::vector<double> reference_proportions;
+    };
+
+    subscribe_fn_t build_operator();
+
+    /**
+     * @brief Accumulate the rows of the incoming message, emitting metrics each time a window is completed
+     */
+    void on_data(sink_type_t x, rxcpp::subscriber<source_type_t>& output);
+
+    /**
+     * @brief Closes the current window, returns nullptr if the window was used to build the reference
+     */
+    std::shared_ptr<MessageMeta> close_window();
+
+    TrackedColumn make_tracked_column(const std::string& name, double lower, double upper) const;
+    void ensure_tensor_columns(std::size_t num_columns);
+
+    std::string m_tensor_name;
+    std::vector<std::string> m_labels;
+    std::map<std::string, std::pair<double, double>> m_feature_ranges;
+    TensorIndex m_window_size;
+    std::size_t m_num_buckets;
+    std::size_t m_reference_windows;
+    std::map<std::string, std::vector<double>> m_reference;
+
+    std::vector<TrackedColumn> m_tensor_columns;
+    std::vector<TrackedColumn> m_feature_columns;
+
+    TensorIndex m_window_rows{0};
+    std::size_t m_windows_closed{0};
+    std::int64_t m_window_id{0};
+};
+
+using DriftStatsStageMM =  // NOLINT(readability-identifier-naming)
+    DriftStatsStage<MultiResponseMessage>;
+using DriftStatsStageCM =  // NOLINT(readability-identifier-naming)
+    DriftStatsStage<ControlMessage>;
+
+/****** DriftStatsStageInterfaceProxy***********************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT DriftStatsStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a DriftStatsStage that receives MultiResponseMessage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param tensor_name : Name of the output tensor to track
+     * @param labels : Names for the columns of the output tensor
+     * @param feature_ranges : Numeric DataFrame columns to track mapped to the `(lower, upper)` range of their buckets
+     * @param window_size : Number of rows in each tumbling window
+     * @param num_buckets : Number of histogram buckets for each tracked column
+     * @param reference_windows : Number of initial windows used to build the reference when `reference` is empty
+     * @param reference : Reference bucket proportions keyed by label or feature name
+     * @return std::shared_ptr<mrc::segment::Object<DriftStatsStageMM>>
+     */
+    static std::shared_ptr<mrc::segment::Object<DriftStatsStageMM>> init_multi(
+        mrc::segment::Builder& builder,
+        const std::string& name,
+        std::string tensor_name,
+        std::vector<std::string> labels,
+        std::map<std::string, std::pair<double, double>> feature_ranges,
+        TensorIndex window_size,
+        std::size_t num_buckets,
+        std::size_t reference_windows,
+        std::map<std::string, std::vector<double>> reference);
+
+    /**
+     * @brief Create and initialize a DriftStatsStage that receives ControlMessage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param tensor_name : Name of the output tensor to track
+     * @param labels : Names for the columns of the output tensor
+     * @param feature_ranges : Numeric DataFrame columns to track mapped to the `(lower, upper)` range of their buckets
+     * @param window_size : Number of rows in each tumbling window
+     * @param num_buckets : Number of histogram buckets for each tracked column
+     * @param reference_windows : Number of initial windows used to build the reference when `reference` is empty
+     * @param reference : Reference bucket proportions keyed by label or feature name
+     * @return std::shared_ptr<mrc::segment::Object<DriftStatsStageCM>>
+     */
+    static std::shared_ptr<mrc::segment::Object<DriftStatsStageCM>> init_cm(
+        mrc::segment::Builder& builder,
+        const std::string& name,
+        std::string tensor_name,
+        std::vector<std::string> labels,
+        std::map<std::string, std::pair<double, double>> feature_ranges,
+        TensorIndex window_size,
+        std::size_t num_buckets,
+        std::size_t reference_windows,
+        std::map<std::string, std::vector<double>> reference);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/reference_table.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pybind11/pytypes.h>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** EnrichStage*****************************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Enriches each `MessageMeta` by joining its rows to one or more reference tables, such as an asset inventory or
+ * a user directory, appending the selected reference columns. See `enrich_message_meta`.
+ *
+ * Each reference table is loaded once into a hash index keyed on its key columns. When `refresh_interval` is non-zero
+ * a background thread checks the modification time of the reference files at that interval, loads the changed files
+ * and atomically swaps in the new tables. Batches already being joined keep using the tables they started with, and a
+ * file which fails to load leaves the previous table in place.
+ */
+class MORPHEUS_EXPORT EnrichStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new Enrich Stage object, loading the reference tables
+     *
+     * @param references : Reference tables joined to each message, in order
+     * @param refresh_interval : Interval at which the reference files are checked for changes, zero disables refreshing
+     */
+    EnrichStage(std::vector<ReferenceTableConfig> references, std::chrono::milliseconds refresh_interval);
+
+    ~EnrichStage() override;
+
+    /**
+     * @brief Current snapshot of the reference tables
+     */
+    std::vector<std::shared_ptr<const ReferenceTable>> tables() const;
+
+    /**
+     * @brief Reload the reference tables whose files changed since they were loaded
+     *
+     * @return Number of reloaded tables
+     */
+    std::size_t refresh();
+
+  private:
+    subscribe_fn_t build_operator();
+
+    void watch();
+
+    mutable std::mutex m_mutex;
+    std::vector<std::shared_ptr<const ReferenceTable>> m_tables;
+
+    std::chrono::milliseconds m_refresh_interval;
+    std::condition_variable m_stop_cv;
+    bool m_stopping{false};
+    std::thread m_watcher;
+};
+
+/****** EnrichStageInterfaceProxy***************************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT EnrichStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize an EnrichStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param references : Reference tables as dictionaries holding the `path`, `on`, and optionally the `reference_on`,
+     * `columns`, `prefix`, `how` ('left' or 'inner') and `file_type` of each table
+     * @param refresh_interval : Interval in seconds at which the reference files are checked for changes, zero disables
+     * refreshing
+     * @return std::shared_ptr<mrc::segment::Object<EnrichStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<EnrichStage>> init(mrc::segment::Builder& builder,
+                                                                   const std::string& name,
+                                                                   const pybind11::list& references,
+                                                                   double refresh_interval);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/grok.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/io/types.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** GrokStage*******************************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Matches a column of raw log lines against a list of Grok patterns, appending the named captures of the first
+ * matching pattern to the message as typed columns, along with the index of that pattern. Lines matching none of the
+ * patterns, and null lines, are null in every new column. The rows are split across `num_threads` host threads sharing
+ * the compiled patterns, and the new columns are committed with a `TableTransaction`.
+ */
+class MORPHEUS_EXPORT GrokStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new Grok Stage object
+     *
+     * @param matcher : Compiled patterns, which define the captured columns
+     * @param column : Strings column holding the raw lines
+     * @param pattern_column : Name of the `int32` column holding the index of the matching pattern
+     * @param num_threads : Number of host threads used to match the lines, 0 uses the number of hardware threads
+     */
+    GrokStage(GrokMatcher matcher, std::string column, std::string pattern_column, std::size_t num_threads);
+
+  private:
+    source_type_t on_data(sink_type_t x);
+
+    /**
+     * @brief Match each row of the strings `column`, returning the captured columns followed by the pattern column
+     */
+    cudf::io::table_with_metadata match_column(const cudf::column_view& column) const;
+
+    GrokMatcher m_matcher;
+    std::string m_column;
+    std::string m_pattern_column;
+    std::size_t m_num_threads;
+};
+
+/****** GrokStageInterfaceProxy*****************************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT GrokStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a GrokStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param column : Strings column holding the raw lines
+     * @param patterns : Grok patterns, in order of preference
+     * @param pattern_files : Pattern files loaded in order, defining the patterns referenced by `patterns`
+     * @param custom_patterns : Additional named patterns, replacing those of the pattern files
+     * @param pattern_column : Name of the `int32` column holding the index of the matching pattern
+     * @param syslog_year : Year of RFC 3164 timestamps captured as `timestamp`, 0 infers the year from the current date
+     * @param num_threads : Number of host threads used to match the lines, 0 uses the number of hardware threads
+     * @return std::shared_ptr<mrc::segment::Object<GrokStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<GrokStage>> init(
+        mrc::segment::Builder& builder,
+        const std::string& name,
+        std::string column,
+        const std::vector<std::string>& patterns,
+        const std::vector<std::string>& pattern_files,
+        const std::map<std::string, std::string>& custom_patterns,
+        std::string pattern_column,
+        int syslog_year,
+        std::size_t num_threads);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -21,7 +21,9 @@
 #include "morpheus/messages/control.hpp"
 #include "morpheus/messages/multi_inference.hpp"
 #include "morpheus/messages/multi_response.hpp"
+#include "morpheus/objects/lru_cache.hpp"
 #include "morpheus/types.hpp"
+#include "morpheus/utilities/dedup_util.hpp"
 
 #include <boost/fiber/policy.hpp>
 #include <mrc/coroutines/async_generator.hpp>
@@ -33,6 +35,7 @@
 #include <pymrc/asyncio_runnable.hpp>
 #include <rxcpp/rx.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -114,12 +117,15 @@ class MORPHEUS_EXPORT InferenceClientStage
      * @param force_convert_inputs : Determines if inputs should be converted to the model's input format.
      * @param inout_mapping : Dictionary used to map pipeline input/output names to Triton input/output names. Use this
      * if the Morpheus names do not match the model.
+     * @param dedup_cache_size : Maximum number of row hashes kept in the cross-batch result cache used for messages
+     * which have been processed by `DeduplicateStage`. A value of zero disables the cache.
      */
     InferenceClientStage(std::unique_ptr<IInferenceClient>&& client,
                          std::string model_name,
                          bool needs_logits,
                          std::vector<TensorModelMapping> input_mapping,
-                         std::vector<TensorModelMapping> output_mapping);
+                         std::vector<TensorModelMapping> output_mapping,
+                         std::size_t dedup_cache_size = 0);
 
     /**
      * Process a single InputT by running the constructor-provided inference client against it's Tensor,
@@ -137,6 +143,11 @@ class MORPHEUS_EXPORT InferenceClientStage
     std::vector<TensorModelMapping> m_output_mapping;
     std::mutex m_session_mutex;
 
+    // Model outputs of recently seen rows keyed by the row hash written by `DeduplicateStage`
+    using dedup_cache_t = LRUCache<std::uint64_t, DedupCacheEntry>;
+    dedup_cache_t m_dedup_cache;
+    std::mutex m_dedup_cache_mutex;
+
     int32_t m_retry_max = 10;
 };
 
@@ -182,6 +193,7 @@ struct MORPHEUS_EXPORT InferenceClientStageInterfaceProxy
      * @param force_convert_inputs : Determines if inputs should be converted to the model's input format.
      * @param inout_mapping : Dictionary used to map pipeline input/output names to Triton input/output names. Use this
      * if the Morpheus names do not match the model.
+     * @param dedup_cache_size : Maximum number of row hashes kept in the cross-batch result cache, zero disables it.
      * @return std::shared_ptr<mrc::segment::Object<InferenceClientStage<ControlMessage, ControlMessage>>>
      */
     static std::shared_ptr<mrc::segment::Object<InferenceClientStage<ControlMessage, ControlMessage>>> init_cm(
@@ -192,7 +204,8 @@ struct MORPHEUS_EXPORT InferenceClientStageInterfaceProxy
         bool needs_logits,
         bool force_convert_inputs,
         std::map<std::string, std::string> input_mapping,
-        std::map<std::string, std::string> output_mapping);
+        std::map<std::string, std::string> output_mapping,
+        std::size_t dedup_cache_size);
 };
 /** @} */  // end of group
 
@@ -0,0 +1,270 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/control.hpp"
+#include "morpheus/messages/multi_inference.hpp"
+#include "morpheus/messages/multi_response.hpp"
+#include "morpheus/types.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pybind11/pytypes.h>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** InferenceWorkerPoolStage****************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Point in time snapshot of the state of an `InferenceWorkerPool`
+ */
+struct MORPHEUS_EXPORT InferenceWorkerPoolStats
+{
+    std::size_t num_workers{0};
+    std::size_t busy_workers{0};
+    std::size_t queue_depth{0};
+    std::size_t max_queue_depth{0};
+    std::size_t batches_processed{0};
+    std::size_t messages_processed{0};
+
+    /**
+     * @brief Fraction of the pool's wall-clock time, since the first batch was submitted, that workers spent inside of
+     * the Python worker's `process` method. In the range [0, 1].
+     */
+    double worker_utilization{0.0};
+};
+
+/**
+ * @brief Owns a set of native threads each of which drives its own Python `InferenceWorker` instance. Batches are
+ * submitted through a bounded queue and each batch is processed with a single GIL acquisition.
+ */
+class MORPHEUS_EXPORT InferenceWorkerPool
+{
+  public:
+    /**
+     * @brief Construct a new Inference Worker Pool object. No threads are started until the first call to `submit`.
+     *
+     * @param worker_factory : Python callable returning a new `InferenceWorker` each time it is called
+     * @param num_workers : Number of worker threads, each with its own `InferenceWorker`
+     * @param max_queue_size : Maximum number of batches waiting to be processed before `submit` blocks
+     */
+    InferenceWorkerPool(pybind11::function worker_factory, std::size_t num_workers, std::size_t max_queue_size);
+    InferenceWorkerPool(const InferenceWorkerPool&)            = delete;
+    InferenceWorkerPool& operator=(const InferenceWorkerPool&) = delete;
+    ~InferenceWorkerPool();
+
+    /**
+     * @brief Queue a batch for inference. Blocks while the queue is full.
+     *
+     * @param batch : Inference batch passed to the Python worker's `process` method
+     * @return std::future<TensorMap> : Resolves to the tensors returned through the worker callback. Holds an exception
+     * when the pool has been shut down, or when a worker failed to be created or initialized.
+     */
+    std::future<TensorMap> submit(std::shared_ptr<MultiInferenceMessage> batch);
+
+    /**
+     * @brief Signals the workers to exit once the queue has been drained, calls `stop` on each Python worker, and
+     * joins the threads. Safe to call more than once.
+     */
+    void shutdown();
+
+    /**
+     * @brief Increments the count of pipeline messages that have been fully assembled.
+     */
+    void record_message();
+
+    InferenceWorkerPoolStats get_stats() const;
+
+  private:
+    struct WorkItem
+    {
+        std::shared_ptr<MultiInferenceMessage> batch;
+        std::shared_ptr<std::promise<TensorMap>> result;
+    };
+
+    void start();
+    void run_worker();
+    void process_item(pybind11::object& worker, WorkItem& item);
+
+    /**
+     * @brief Called when a worker could not be created, fails the queued batches and every batch submitted afterwards
+     * with `error`
+     */
+    void fail(std::exception_ptr error);
+
+    pybind11::function m_worker_factory;
+    std::size_t m_num_workers;
+    std::size_t m_max_queue_size;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_item_available;
+    std::condition_variable m_space_available;
+    std::deque<WorkItem> m_queue;
+    std::vector<std::thread> m_threads;
+    bool m_started{false};
+    bool m_closed{false};
+    std::exception_ptr m_error;
+
+    std::size_t m_max_queue_depth{0};
+    std::size_t m_busy_workers{0};
+    std::size_t m_batches_processed{0};
+    std::size_t m_messages_processed{0};
+    std::chrono::nanoseconds m_busy_time{0};
+    std::chrono::steady_clock::time_point m_start_time;
+};
+
+/**
+ * @brief Native replacement for the Python batching, queueing and response assembly performed by `InferenceStage`
+ * for Python-backed inference workers. Each incoming message is split into batches of at most `max_batch_size` tensor
+ * rows, dispatched to an `InferenceWorkerPool` and the returned tensors are assembled into a single response with one
+ * row per message.
+ */
+template <typename InputT, typename OutputT>
+class MORPHEUS_EXPORT InferenceWorkerPoolStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<InputT>, std::shared_ptr<OutputT>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<InputT>, std::shared_ptr<OutputT>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new Inference Worker Pool Stage object
+     *
+     * @param worker_factory : Python callable returning a new `InferenceWorker` each time it is called
+     * @param num_workers : Number of worker threads
+     * @param max_batch_size : Maximum number of tensor rows sent to the worker in a single call to `process`
+     * @param max_queue_size : Maximum number of queued batches. Defaults to twice the number of workers when zero
+     */
+    InferenceWorkerPoolStage(pybind11::function worker_factory,
+                             std::size_t num_workers,
+                             TensorIndex max_batch_size,
+                             std::size_t max_queue_size = 0);
+
+    /**
+     * @brief Get a snapshot of the queue depth and worker utilization of the underlying pool
+     */
+    InferenceWorkerPoolStats get_stats() const;
+
+    /**
+     * @brief Stop the worker threads once all queued batches have been processed
+     */
+    void shutdown();
+
+    /**
+     * Called every time a message is passed to this stage
+     */
+    source_type_t on_data(sink_type_t x);
+
+  private:
+    std::shared_ptr<MultiInferenceMessage> to_inference_message(sink_type_t& x) const;
+    source_type_t make_response(sink_type_t& x, TensorMap&& outputs) const;
+
+    TensorIndex m_max_batch_size;
+    std::shared_ptr<InferenceWorkerPool> m_pool;
+};
+
+using InferenceWorkerPoolStageMM =  // NOLINT(readability-identifier-naming)
+    InferenceWorkerPoolStage<MultiInferenceMessage, MultiResponseMessage>;
+using InferenceWorkerPoolStageCM =  // NOLINT(readability-identifier-naming)
+    InferenceWorkerPoolStage<ControlMessage, ControlMessage>;
+
+/****** InferenceWorkerPoolStageInterfaceProxy**************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT InferenceWorkerPoolStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize an InferenceWorkerPoolStage that receives MultiInferenceMessage and emits
+     * MultiResponseMessage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param worker_factory : Python callable returning a new `InferenceWorker` each time it is called
+     * @param num_workers : Number of worker threads
+     * @param max_batch_size : Maximum number of tensor rows sent to the worker in a single call to `process`
+     * @param max_queue_size : Maximum number of queued batches. Defaults to twice the number of workers when zero
+     * @return std::shared_ptr<mrc::segment::Object<InferenceWorkerPoolStageMM>>
+     */
+    static std::shared_ptr<mrc::segment::Object<InferenceWorkerPoolStageMM>> init_multi(
+        mrc::segment::Builder& builder,
+        const std::string& name,
+        pybind11::function worker_factory,
+        std::size_t num_workers,
+        TensorIndex max_batch_size,
+        std::size_t max_queue_size);
+
+    /**
+     * @brief Create and initialize an InferenceWorkerPoolStage that receives and emits ControlMessage, and return the
+     * result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param worker_factory : Python callable returning a new `InferenceWorker` each time it is called
+     * @param num_workers : Number of worker threads
+     * @param max_batch_size : Maximum number of tensor rows sent to the worker in a single call to `process`
+     * @param max_queue_size : Maximum number of queued batches. Defaults to twice the number of workers when zero
+     * @return std::shared_ptr<mrc::segment::Object<InferenceWorkerPoolStageCM>>
+     */
+    static std::shared_ptr<mrc::segment::Object<InferenceWorkerPoolStageCM>> init_cm(mrc::segment::Builder& builder,
+                                                                                     const std::string& name,
+                                                                                     pybind11::function worker_factory,
+                                                                                     std::size_t num_workers,
+                                                                                     TensorIndex max_batch_size,
+                                                                                     std::size_t max_queue_size);
+
+    /**
+     * @brief Get the queue-depth and worker-utilization statistics of the stage as a python dict
+     */
+    static pybind11::dict get_stats(mrc::segment::Object<InferenceWorkerPoolStageMM>& self);
+    static pybind11::dict get_stats(mrc::segment::Object<InferenceWorkerPoolStageCM>& self);
+
+    /**
+     * @brief Stop the worker threads of the stage once all queued batches have been processed
+     */
+    static void shutdown(mrc::segment::Object<InferenceWorkerPoolStageMM>& self);
+    static void shutdown(mrc::segment::Object<InferenceWorkerPoolStageCM>& self);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -19,6 +19,7 @@
 
 #include "morpheus/export.h"
 #include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/record_decoder.hpp"
 #include "morpheus/types.hpp"
 
 #include <boost/fiber/context.hpp>
@@ -38,6 +39,7 @@
 #include <optional>
 #include <string>
 #include <thread>
+#include <unordered_set>
 #include <vector>
 
 namespace morpheus {
@@ -61,6 +63,29 @@ class MORPHEUS_EXPORT KafkaOAuthCallback : public RdKafka::OAuthBearerTokenRefre
   private:
     const std::function<std::map<std::string, std::string>()>& m_oauth_callback;
 };
+/**
+ * @brief Metadata of the Kafka records added to the messages of a `KafkaSourceStage` as columns, and filters applied to
+ * the keys and headers of the records before their payload is parsed. Records rejected by the filters are skipped, but
+ * their offsets are still committed.
+ */
+struct MORPHEUS_EXPORT KafkaRecordOptions
+{
+    // Fields of the records added as columns named `{column_prefix}{field}`, any of `key`, `topic`, `partition`,
+    // `offset`, `timestamp` and `timestamp_type`
+    std::vector<std::string> metadata_columns;
+
+    // Headers added as string columns named `{column_prefix}header_{name}`, null when a record doesn't hold the header
+    std::vector<std::string> header_columns;
+
+    std::string column_prefix{"kafka_"};
+
+    // Accepted keys, empty accepts every record
+    std::vector<std::string> key_filter;
+
+    // Accepted values of each header, a record must hold an accepted value of every header
+    std::map<std::string, std::vector<std::string>> header_filters;
+};
+
 /**
  * This class loads messages from the Kafka cluster by serving as a Kafka consumer.
  */
@@ -85,6 +110,9 @@ class MORPHEUS_EXPORT KafkaSourceStage : public mrc::pymrc::PythonSource<std::sh
      * @param stop_after : Stops ingesting after emitting `stop_after` records (rows in the table).
      * Useful for testing. Disabled if `0`
      * @param async_commits : Asynchronously acknowledge consuming Kafka messages
+     * @param oauth_callback : Callback used when an OAuth token needs to be generated.
+     * @param record_options : Metadata columns added to the messages and filters applied to the records
+     * @param payload_decoder : Decoder of Avro or Protobuf payloads, when null the payloads are parsed as JSON
      */
     KafkaSourceStage(TensorIndex max_batch_size,
                      std::string topic,
@@ -94,7 +122,9 @@ class MORPHEUS_EXPORT KafkaSourceStage : public mrc::pymrc::PythonSource<std::sh
                      bool disable_pre_filtering                         = false,
                      std::size_t stop_after                             = 0,
                      bool async_commits                                 = true,
-                     std::unique_ptr<KafkaOAuthCallback> oauth_callback = nullptr);
+                     std::unique_ptr<KafkaOAuthCallback> oauth_callback = nullptr,
+                     KafkaRecordOptions record_options                  = {},
+                     std::shared_ptr<PayloadDecoder> payload_decoder    = nullptr);
 
     /**
      * @brief Construct a new Kafka Source Stage object
@@ -110,6 +140,9 @@ class MORPHEUS_EXPORT KafkaSourceStage : public mrc::pymrc::PythonSource<std::sh
      * @param stop_after : Stops ingesting after emitting `stop_after` records (rows in the table).
      * Useful for testing. Disabled if `0`
      * @param async_commits : Asynchronously acknowledge consuming Kafka messages
+     * @param oauth_callback : Callback used when an OAuth token needs to be generated.
+     * @param record_options : Metadata columns added to the messages and filters applied to the records
+     * @param payload_decoder : Decoder of Avro or Protobuf payloads, when null the payloads are parsed as JSON
      */
     KafkaSourceStage(TensorIndex max_batch_size,
                      std::vector<std::string> topics,
@@ -119,7 +152,9 @@ class MORPHEUS_EXPORT KafkaSourceStage : public mrc::pymrc::PythonSource<std::sh
                      bool disable_pre_filtering                         = false,
                      std::size_t stop_after                             = 0,
                      bool async_commits                                 = true,
-                     std::unique_ptr<KafkaOAuthCallback> oauth_callback = nullptr);
+                     std::unique_ptr<KafkaOAuthCallback> oauth_callback = nullptr,
+                     KafkaRecordOptions record_options                  = {},
+                     std::shared_ptr<PayloadDecoder> payload_decoder    = nullptr);
 
     ~KafkaSourceStage() override = default;
 
@@ -165,7 +200,8 @@ class MORPHEUS_EXPORT KafkaSourceStage : public mrc::pymrc::PythonSource<std::sh
 
     /**
      * @brief This function combines JSON messages from Kafka, parses them, then loads them onto a MessageMeta.
-     * and returns the shared pointer as a result.
+     * and returns the shared pointer as a result. Avro and Protobuf messages are decoded by the payload decoder
+     * instead.
      *
      * @param message_batch : Reference of a message batch that needs to be processed.
      * @return std::shared_ptr<morpheus::MessageMeta>
@@ -173,6 +209,22 @@ class MORPHEUS_EXPORT KafkaSourceStage : public mrc::pymrc::PythonSource<std::sh
     std::shared_ptr<morpheus::MessageMeta> process_batch(
         std::vector<std::unique_ptr<RdKafka::Message>>&& message_batch);
 
+    /**
+     * @brief Check that the metadata columns of the record options are known fields of a record
+     */
+    void check_record_options() const;
+
+    /**
+     * @brief Whether the key and headers of `message` are accepted by the filters of the record options
+     */
+    bool accept_record(RdKafka::Message& message) const;
+
+    /**
+     * @brief Append the metadata columns of the record options to `table`, which holds one row for each of `messages`
+     */
+    void add_metadata_columns(cudf::io::table_with_metadata& table,
+                              const std::vector<RdKafka::Message*>& messages) const;
+
     TensorIndex m_max_batch_size{128};
     uint32_t m_batch_timeout_ms{100};
 
@@ -188,6 +240,11 @@ class MORPHEUS_EXPORT KafkaSourceStage : public mrc::pymrc::PythonSource<std::sh
     void* m_rebalancer;
 
     std::unique_ptr<KafkaOAuthCallback> m_oauth_callback;
+
+    KafkaRecordOptions m_record_options;
+    std::shared_ptr<PayloadDecoder> m_payload_decoder;
+    std::unordered_set<std::string> m_key_filter;
+    std::map<std::string, std::unordered_set<std::string>> m_header_filters;
 };
 
 /****** KafkaSourceStageInferenceProxy**********************/
@@ -213,6 +270,21 @@ struct MORPHEUS_EXPORT KafkaSourceStageInterfaceProxy
      * Useful for testing. Disabled if `0`
      * @param async_commits : Asynchronously acknowledge consuming Kafka messages
      * @param oauth_callback : Callback used when an OAuth token needs to be generated.
+     * @param metadata_columns : Fields of the records added as columns, any of `key`, `topic`, `partition`, `offset`,
+     * `timestamp` and `timestamp_type`
+     * @param header_columns : Headers of the records added as string columns
+     * @param column_prefix : Prepended to the names of the metadata and header columns
+     * @param key_filter : Accepted keys, empty accepts every record
+     * @param header_filters : Accepted values of each header, a record must hold an accepted value of every header
+     * @param payload_format : Format of the payloads, one of `json`, `avro` and `protobuf`
+     * @param schema_files : Files holding the Avro or Protobuf schema of each schema id
+     * @param schema_registry : Callable returning the text of the schema of a schema id, used instead of
+     * `schema_files` to fetch the schemas from a schema registry
+     * @param confluent_framing : Whether the payloads start with the magic byte and schema id of the Confluent wire
+     * format, otherwise every payload is a bare record of the schema `schema_id`
+     * @param schema_id : Schema of the payloads when `confluent_framing` is disabled
+     * @param message_name : Protobuf message of the payloads when `confluent_framing` is disabled, the first message of
+     * the schema when empty
      */
     static std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> init_with_single_topic(
         mrc::segment::Builder& builder,
@@ -223,9 +295,20 @@ struct MORPHEUS_EXPORT KafkaSourceStageInterfaceProxy
         std::map<std::string, std::string> config,
         bool disable_commit,
         bool disable_pre_filtering,
-        std::size_t stop_after                           = 0,
-        bool async_commits                               = true,
-        std::optional<pybind11::function> oauth_callback = std::nullopt);
+        std::size_t stop_after                                         = 0,
+        bool async_commits                                             = true,
+        std::optional<pybind11::function> oauth_callback               = std::nullopt,
+        std::vector<std::string> metadata_columns                      = {},
+        std::vector<std::string> header_columns                        = {},
+        std::string column_prefix                                      = "kafka_",
+        std::vector<std::string> key_filter                            = {},
+        std::map<std::string, std::vector<std::string>> header_filters = {},
+        std::string payload_format                                     = "json",
+        std::map<std::int32_t, std::string> schema_files               = {},
+        std::optional<pybind11::function> schema_registry              = std::nullopt,
+        bool confluent_framing                                         = true,
+        std::int32_t schema_id                                         = 0,
+        std::string message_name                                       = "");
 
     /**
      * @brief Create and initialize a KafkaSourceStage, and return the result
@@ -244,6 +327,21 @@ struct MORPHEUS_EXPORT KafkaSourceStageInterfaceProxy
      * Useful for testing. Disabled if `0`
      * @param async_commits : Asynchronously acknowledge consuming Kafka messages
      * @param oauth_callback : Callback used when an OAuth token needs to be generated.
+     * @param metadata_columns : Fields of the records added as columns, any of `key`, `topic`, `partition`, `offset`,
+     * `timestamp` and `timestamp_type`
+     * @param header_columns : Headers of the records added as string columns
+     * @param column_prefix : Prepended to the names of the metadata and header columns
+     * @param key_filter : Accepted keys, empty accepts every record
+     * @param header_filters : Accepted values of each header, a record must hold an accepted value of every header
+     * @param payload_format : Format of the payloads, one of `json`, `avro` and `protobuf`
+     * @param schema_files : Files holding the Avro or Protobuf schema of each schema id
+     * @param schema_registry : Callable returning the text of the schema of a schema id, used instead of
+     * `schema_files` to fetch the schemas from a schema registry
+     * @param confluent_framing : Whether the payloads start with the magic byte and schema id of the Confluent wire
+     * format, otherwise every payload is a bare record of the schema `schema_id`
+     * @param schema_id : Schema of the payloads when `confluent_framing` is disabled
+     * @param message_name : Protobuf message of the payloads when `confluent_framing` is disabled, the first message of
+     * the schema when empty
      */
     static std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> init_with_multiple_topics(
         mrc::segment::Builder& builder,
@@ -254,9 +352,20 @@ struct MORPHEUS_EXPORT KafkaSourceStageInterfaceProxy
         std::map<std::string, std::string> config,
         bool disable_commit,
         bool disable_pre_filtering,
-        std::size_t stop_after                           = 0,
-        bool async_commits                               = true,
-        std::optional<pybind11::function> oauth_callback = std::nullopt);
+        std::size_t stop_after                                         = 0,
+        bool async_commits                                             = true,
+        std::optional<pybind11::function> oauth_callback               = std::nullopt,
+        std::vector<std::string> metadata_columns                      = {},
+        std::vector<std::string> header_columns                        = {},
+        std::string column_prefix                                      = "kafka_",
+        std::vector<std::string> key_filter                            = {},
+        std::map<std::string, std::vector<std::string>> header_filters = {},
+        std::string payload_format                                     = "json",
+        std::map<std::int32_t, std::string> schema_files               = {},
+        std::optional<pybind11::function> schema_registry              = std::nullopt,
+        bool confluent_framing                                         = true,
+        std::int32_t schema_id                                         = 0,
+        std::string message_name                                       = "");
 
   private:
     /**
@@ -267,6 +376,17 @@ struct MORPHEUS_EXPORT KafkaSourceStageInterfaceProxy
      */
     static std::unique_ptr<KafkaOAuthCallback> make_kafka_oauth_callback(
         std::optional<pybind11::function>&& oauth_callback);
+
+    /**
+     * @brief Create the decoder of Avro or Protobuf payloads, or return nullptr for JSON payloads. The schemas are
+     * fetched by calling `schema_registry` when it is set, and read from `schema_files` otherwise.
+     */
+    static std::shared_ptr<PayloadDecoder> make_payload_decoder(const std::string& payload_format,
+                                                                const std::map<std::int32_t, std::string>& schema_files,
+                                                                std::optional<pybind11::function>&& schema_registry,
+                                                                bool confluent_framing,
+                                                                std::int32_t schema_id,
+                                                                const std::string& message_name);
 };
 /** @} */  // end of group
 }  // namespace morpheus
@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/control.hpp"
+#include "morpheus/utilities/pii_util.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** PiiMaskStage****************************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Masks PII in the string `columns` of the payload using a `PiiMasker`. The host path masks each value in a
+ * single pass, splitting the rows of a batch across `num_threads` threads. The optional device path uses cudf regular
+ * expressions instead and only supports redaction. The card numbers it finds are copied to the host for the Luhn check,
+ * only the valid ones are then replaced.
+ */
+class MORPHEUS_EXPORT PiiMaskStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<ControlMessage>, std::shared_ptr<ControlMessage>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<ControlMessage>, std::shared_ptr<ControlMessage>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new PiiMask Stage object
+     *
+     * @param columns : String columns to mask
+     * @param entities : Built-in entities to detect, see `PiiEntity`
+     * @param literals : Map of literal values to their label
+     * @param patterns : Map of regular expressions to their label
+     * @param pseudonymize : Replace matches with keyed-hash pseudonyms instead of redaction tokens
+     * @param key : Key of the pseudonym hash, required when `pseudonymize` is true
+     * @param num_threads : Number of host threads used to mask a batch, 0 uses the number of hardware threads
+     * @param use_gpu : Mask on the device with cudf regular expressions
+     */
+    PiiMaskStage(std::vector<std::string> columns,
+                 const std::vector<std::string>& entities,
+                 const std::map<std::string, std::string>& literals,
+                 const std::map<std::string, std::string>& patterns,
+                 bool pseudonymize,
+                 const std::string& key,
+                 std::size_t num_threads,
+                 bool use_gpu);
+
+  private:
+    source_type_t on_data(sink_type_t x);
+
+    std::unique_ptr<cudf::column> mask_host(const cudf::column_view& column) const;
+    std::unique_ptr<cudf::column> mask_device(const cudf::column_view& column) const;
+    std::unique_ptr<cudf::column> mask_device_credit_cards(const cudf::column_view& column) const;
+
+    std::vector<std::string> m_columns;
+    PiiMasker m_masker;
+
+    // Masks the rows holding card number candidates on the device path
+    PiiMasker m_credit_card_masker;
+    std::size_t m_num_threads;
+    bool m_use_gpu;
+
+    // Device path regular expressions and their redaction tokens
+    std::vector<std::string> m_device_patterns;
+    std::vector<std::string> m_device_replacements;
+    bool m_device_credit_card;
+    bool m_device_username;
+};
+
+/****** PiiMaskStageInterfaceProxy**************************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT PiiMaskStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a PiiMaskStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param columns : String columns to mask
+     * @param entities : Built-in entities to detect, see `PiiEntity`
+     * @param literals : Map of literal values to their label
+     * @param patterns : Map of regular expressions to their label
+     * @param pseudonymize : Replace matches with keyed-hash pseudonyms instead of redaction tokens
+     * @param key : Key of the pseudonym hash, required when `pseudonymize` is true
+     * @param num_threads : Number of host threads used to mask a batch, 0 uses the number of hardware threads
+     * @param use_gpu : Mask on the device with cudf regular expressions
+     * @return std::shared_ptr<mrc::segment::Object<PiiMaskStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<PiiMaskStage>> init(mrc::segment::Builder& builder,
+                                                                    const std::string& name,
+                                                                    std::vector<std::string> columns,
+                                                                    const std::vector<std::string>& entities,
+                                                                    const std::map<std::string, std::string>& literals,
+                                                                    const std::map<std::string, std::string>& patterns,
+                                                                    bool pseudonymize,
+                                                                    const std::string& key,
+                                                                    std::size_t num_threads,
+                                                                    bool use_gpu);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,165 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/control.hpp"
+#include "morpheus/objects/dtype.hpp"          // for TypeId, DType
+#include "morpheus/objects/tensor_object.hpp"  // for TensorObject
+#include "morpheus/types.hpp"                  // for TensorIndex
+
+#include <boost/fiber/context.hpp>
+#include <cudf/strings/strings_column_view.hpp>  // for strings_column_view
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <nvtext/subword_tokenize.hpp>  // for hashed_vocabulary
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>  // for pair
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** PreprocessEmbeddingStage****************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Tokenizes a string column for embedding models, producing one sequence per row.
+ *
+ * Rows are truncated to `max_length` tokens, ordered by their number of tokens and grouped into buckets (see
+ * `BucketUtil`), such that each bucket is only padded to its bucket length instead of `max_length`. One
+ * `ControlMessage` is emitted per bucket, split into messages of at most `batch_size` rows. The payload of each message
+ * holds the rows of the bucket along with the `row_index_column` holding the position of each row in the incoming
+ * payload, which can be used to restore the original order once the embeddings have been computed. The `input_ids`,
+ * `input_mask` and `seq_ids` tensors of each message line up with the rows of its payload.
+ *
+ * Copies of the config and metadata of the incoming message are attached to each emitted message, messages with an
+ * empty payload don't produce any output.
+ */
+class MORPHEUS_EXPORT PreprocessEmbeddingStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<ControlMessage>, std::shared_ptr<ControlMessage>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<ControlMessage>, std::shared_ptr<ControlMessage>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new Preprocess Embedding Stage object
+     *
+     * @param vocab_hash_file : Path to hash file containing vocabulary of words with token-ids. This can be created
+     * from the raw vocabulary using the `cudf.utils.hash_vocab_utils.hash_vocab` function.
+     * @param max_length : Maximum number of tokens of a sequence, longer rows are truncated
+     * @param do_lower_case : If set to true, original text will be lowercased before encoding.
+     * @param bucket_lengths : Lengths the sequences are padded to, normalized with
+     * `BucketUtil::normalize_bucket_lengths`. An empty list uses powers of two from 16 up to `max_length`.
+     * @param batch_size : Maximum number of rows of each emitted message, 0 doesn't limit the number of rows
+     * @param column : Name of the string column to tokenize
+     * @param row_index_column : Name of the INT64 column added to the payload holding the position of each row in the
+     * incoming payload
+     * @param input_ids_type : Integral type of the `input_ids` tensor
+     * @param input_mask_type : Integral type of the `input_mask` tensor
+     */
+    PreprocessEmbeddingStage(std::string vocab_hash_file,
+                             TensorIndex max_length,
+                             bool do_lower_case,
+                             std::vector<TensorIndex> bucket_lengths = {},
+                             TensorIndex batch_size                  = 0,
+                             std::string column                      = "content",
+                             std::string row_index_column            = "_row_index",
+                             TypeId input_ids_type                   = TypeId::INT32,
+                             TypeId input_mask_type                  = TypeId::INT32);
+
+  private:
+    subscribe_fn_t build_operator();
+
+    void on_data(sink_type_t x, rxcpp::subscriber<source_type_t>& output);
+
+    /**
+     * @brief Tokenize `strings` truncated to `m_max_length` tokens, returns the token ids and attention mask of each
+     * row as `[num_rows, m_max_length]` UINT32 device tensors
+     */
+    std::pair<TensorObject, TensorObject> tokenize(const cudf::strings_column_view& strings) const;
+
+    /**
+     * @brief Number of tokens of each row of `attention_mask`, computed on the device
+     */
+    std::vector<TensorIndex> sequence_lengths(const TensorObject& attention_mask) const;
+
+    std::string m_vocab_hash_file;
+    TensorIndex m_max_length;
+    bool m_do_lower_case;
+    std::vector<TensorIndex> m_bucket_lengths;
+    TensorIndex m_batch_size;
+    std::string m_column;
+    std::string m_row_index_column;
+    DType m_input_ids_dtype;
+    DType m_input_mask_dtype;
+
+    std::unique_ptr<nvtext::hashed_vocabulary> m_vocab;
+};
+
+/****** PreprocessEmbeddingStageInterfaceProxy**************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT PreprocessEmbeddingStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a PreprocessEmbeddingStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param vocab_hash_file : Path to hash file containing vocabulary of words with token-ids
+     * @param max_length : Maximum number of tokens of a sequence, longer rows are truncated
+     * @param do_lower_case : If set to true, original text will be lowercased before encoding.
+     * @param bucket_lengths : Lengths the sequences are padded to, empty uses powers of two up to `max_length`
+     * @param batch_size : Maximum number of rows of each emitted message, 0 doesn't limit the number of rows
+     * @param column : Name of the string column to tokenize
+     * @param row_index_column : Name of the column holding the position of each row in the incoming payload
+     * @param input_ids_type : Integral type of the `input_ids` tensor
+     * @param input_mask_type : Integral type of the `input_mask` tensor
+     * @return std::shared_ptr<mrc::segment::Object<PreprocessEmbeddingStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<PreprocessEmbeddingStage>> init(
+        mrc::segment::Builder& builder,
+        const std::string& name,
+        std::string vocab_hash_file,
+        TensorIndex max_length,
+        bool do_lower_case,
+        std::vector<TensorIndex> bucket_lengths,
+        TensorIndex batch_size,
+        std::string column,
+        std::string row_index_column,
+        TypeId input_ids_type,
+        TypeId input_mask_type);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -21,12 +21,15 @@
 #include "morpheus/messages/control.hpp"
 #include "morpheus/messages/multi.hpp"
 #include "morpheus/messages/multi_inference.hpp"
+#include "morpheus/objects/dtype.hpp"
 #include "morpheus/objects/table_info.hpp"
+#include "morpheus/types.hpp"
 
 #include <boost/fiber/context.hpp>
 #include <mrc/segment/builder.hpp>
 #include <mrc/segment/object.hpp>
 #include <pymrc/node.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rxcpp/rx.hpp>
 
 #include <memory>
@@ -64,8 +67,10 @@ class MORPHEUS_EXPORT PreprocessFILStage
      * @brief Constructor for a class `PreprocessFILStage`
      *
      * @param features : Reference to the features that are required for model inference
+     * @param input_type : Floating point type of the `input__0` tensor, `TypeId::FLOAT16` halves the size of the
+     * tensor sent to inference.
      */
-    PreprocessFILStage(const std::vector<std::string>& features);
+    PreprocessFILStage(const std::vector<std::string>& features, TypeId input_type = TypeId::FLOAT32);
 
     /**
      * Called every time a message is passed to this stage
@@ -77,9 +82,11 @@ class MORPHEUS_EXPORT PreprocessFILStage
     std::shared_ptr<ControlMessage> on_control_message(std::shared_ptr<ControlMessage> x);
     void transform_bad_columns(std::vector<std::string>& fea_cols, morpheus::MutableTableInfo& mutable_info);
     TableInfo fix_bad_columns(sink_type_t x);
+    std::shared_ptr<rmm::device_buffer> cast_input(std::shared_ptr<rmm::device_buffer> input, TensorIndex num_rows);
 
     std::vector<std::string> m_fea_cols;
     std::string m_vocab_file;
+    DType m_input_dtype;
 };
 
 using PreprocessFILStageMM =  // NOLINT(readability-identifier-naming)
@@ -100,10 +107,14 @@ struct MORPHEUS_EXPORT PreprocessFILStageInterfaceProxy
      * @param builder : Pipeline context object reference
      * @param name : Name of a stage reference
      * @param features : Reference to the features that are required for model inference
+     * @param input_type : Floating point type of the `input__0` tensor
      * @return std::shared_ptr<mrc::segment::Object<PreprocessFILStage<MultiMessage, MultiInferenceMessage>>>
      */
     static std::shared_ptr<mrc::segment::Object<PreprocessFILStage<MultiMessage, MultiInferenceMessage>>> init_multi(
-        mrc::segment::Builder& builder, const std::string& name, const std::vector<std::string>& features);
+        mrc::segment::Builder& builder,
+        const std::string& name,
+        const std::vector<std::string>& features,
+        TypeId input_type = TypeId::FLOAT32);
 
     /**
      * @brief Create and initialize a PreprocessFILStage, and return the result
@@ -111,10 +122,14 @@ struct MORPHEUS_EXPORT PreprocessFILStageInterfaceProxy
      * @param builder : Pipeline context object reference
      * @param name : Name of a stage reference
      * @param features : Reference to the features that are required for model inference
+     * @param input_type : Floating point type of the `input__0` tensor
      * @return std::shared_ptr<mrc::segment::Object<PreprocessFILStage<ControlMessage, ControlMessage>>>
      */
     static std::shared_ptr<mrc::segment::Object<PreprocessFILStage<ControlMessage, ControlMessage>>> init_cm(
-        mrc::segment::Builder& builder, const std::string& name, const std::vector<std::string>& features);
+        mrc::segment::Builder& builder,
+        const std::string& name,
+        const std::vector<std::string>& features,
+        TypeId input_type = TypeId::FLOAT32);
 };
 /** @} */  // end of group
 }  // namespace morpheus
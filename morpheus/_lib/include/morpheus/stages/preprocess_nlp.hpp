@@ -21,6 +21,7 @@
 #include "morpheus/messages/control.hpp"          // for ControlMessage
 #include "morpheus/messages/multi.hpp"            // for MultiMessage
 #include "morpheus/messages/multi_inference.hpp"  // for MultiInferenceMessage
+#include "morpheus/objects/dtype.hpp"             // for DType, TypeId
 
 #include <boost/fiber/context.hpp>                   // for operator<<
 #include <cudf/strings/strings_column_view.hpp>      // for strings_column_view
@@ -78,14 +79,19 @@ class MORPHEUS_EXPORT PreprocessNLPStage
      * equal to stride there are no duplicated-id tokens. If stride is 80% of max_length, 20% of the first sequence will
      * be repeated on the second sequence and so on until the entire sentence is encoded.
      * @param column : Name of the string column to operate on, defaults to "data".
+     * @param input_ids_type : Integral type of the `input_ids` tensor, defaults to `TypeId::INT32`. A batch holding a
+     * token id past the range of a narrower type throws `std::invalid_argument`.
+     * @param input_mask_type : Integral type of the `input_mask` tensor, defaults to `TypeId::INT32`.
      */
     PreprocessNLPStage(std::string vocab_hash_file,
                        uint32_t sequence_length,
                        bool truncation,
                        bool do_lower_case,
                        bool add_special_token,
-                       int stride         = -1,
-                       std::string column = "data");
+                       int stride             = -1,
+                       std::string column     = "data",
+                       TypeId input_ids_type  = TypeId::INT32,
+                       TypeId input_mask_type = TypeId::INT32);
 
     /**
      * Called every time a message is passed to this stage
@@ -109,6 +115,8 @@ class MORPHEUS_EXPORT PreprocessNLPStage
     bool m_do_lower_case;
     bool m_add_special_token;
     int m_stride{-1};
+    DType m_input_ids_dtype;
+    DType m_input_mask_dtype;
 };
 
 using PreprocessNLPStageMM =  // NOLINT(readability-identifier-naming)
@@ -142,6 +150,9 @@ struct MORPHEUS_EXPORT PreprocessNLPStageInterfaceProxy
      * equal to stride there are no duplicated-id tokens. If stride is 80% of max_length, 20% of the first sequence will
      * be repeated on the second sequence and so on until the entire sentence is encoded.
      * @param column : Name of the string column to operate on, defaults to "data".
+     * @param input_ids_type : Integral type of the `input_ids` tensor, defaults to `TypeId::INT32`. A batch holding a
+     * token id past the range of a narrower type throws `std::invalid_argument`.
+     * @param input_mask_type : Integral type of the `input_mask` tensor, defaults to `TypeId::INT32`.
      * @return std::shared_ptr<mrc::segment::Object<PreprocessNLPStage<MultiMessage, MultiInferenceMessage>>>
      */
     static std::shared_ptr<mrc::segment::Object<PreprocessNLPStage<MultiMessage, MultiInferenceMessage>>> init_multi(
@@ -152,8 +163,10 @@ struct MORPHEUS_EXPORT PreprocessNLPStageInterfaceProxy
         bool truncation,
         bool do_lower_case,
         bool add_special_token,
-        int stride         = -1,
-        std::string column = "data");
+        int stride             = -1,
+        std::string column     = "data",
+        TypeId input_ids_type  = TypeId::INT32,
+        TypeId input_mask_type = TypeId::INT32);
     /**
      * @brief Create and initialize a ProcessNLPStage that receives ControlMessage and emits ControlMessage, and return
      * the result
@@ -174,6 +187,9 @@ struct MORPHEUS_EXPORT PreprocessNLPStageInterfaceProxy
      * equal to stride there are no duplicated-id tokens. If stride is 80% of max_length, 20% of the first sequence will
      * be repeated on the second sequence and so on until the entire sentence is encoded.
      * @param column : Name of the string column to operate on, defaults to "data".
+     * @param input_ids_type : Integral type of the `input_ids` tensor, defaults to `TypeId::INT32`. A batch holding a
+     * token id past the range of a narrower type throws `std::invalid_argument`.
+     * @param input_mask_type : Integral type of the `input_mask` tensor, defaults to `TypeId::INT32`.
      * @return std::shared_ptr<mrc::segment::Object<PreprocessNLPStage<ControlMessage, ControlMessage>>>
      */
     static std::shared_ptr<mrc::segment::Object<PreprocessNLPStage<ControlMessage, ControlMessage>>> init_cm(
@@ -184,8 +200,10 @@ struct MORPHEUS_EXPORT PreprocessNLPStageInterfaceProxy
         bool truncation,
         bool do_lower_case,
         bool add_special_token,
-        int stride         = -1,
-        std::string column = "data");
+        int stride             = -1,
+        std::string column     = "data",
+        TypeId input_ids_type  = TypeId::INT32,
+        TypeId input_mask_type = TypeId::INT32);
 };
 /** @} */  // end of group
 }  // namespace morpheus
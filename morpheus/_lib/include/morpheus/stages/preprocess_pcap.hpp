@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/multi.hpp"
+#include "morpheus/messages/multi_inference.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <memory>
+#include <string>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** PreprocessPcapStage*********************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Preprocessing of the PCAP data of the ABP detection pipeline. Packets are aggregated per flow and one minute
+ * roll-up window with `PcapUtil`, and the per-flow features of each packet are written to the `input__0` tensor. The
+ * `flow_id` and `rollup_time` string columns of the payload are set for each packet.
+ *
+ * The payload requires the `timestamp`, `flags`, `src_ip`, `src_port`, `dest_ip`, `dest_port` and `data_len` columns.
+ */
+class MORPHEUS_EXPORT PreprocessPcapStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<MultiMessage>, std::shared_ptr<MultiInferenceMessage>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MultiMessage>, std::shared_ptr<MultiInferenceMessage>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new PreprocessPcap Stage object
+     */
+    PreprocessPcapStage();
+
+  private:
+    source_type_t on_data(sink_type_t x);
+};
+
+/****** PreprocessPcapStageInterfaceProxy*******************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT PreprocessPcapStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a PreprocessPcapStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @return std::shared_ptr<mrc::segment::Object<PreprocessPcapStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<PreprocessPcapStage>> init(mrc::segment::Builder& builder,
+                                                                           const std::string& name);
+};
+/** @} */  // end of group
+}  // namespace morpheus
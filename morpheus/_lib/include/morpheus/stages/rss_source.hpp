@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/feed_reader.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** RSSSourceStage**************************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Polls RSS and Atom feeds with a `FeedReader`, emitting the new entries of each poll in messages of up to
+ * `batch_size` rows with the string columns `id`, `title`, `link`, `summary`, `content`, `published`, `updated` and
+ * `author`, where missing fields are null.
+ */
+class MORPHEUS_EXPORT RSSSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonSource<std::shared_ptr<MessageMeta>>;
+    using typename base_t::source_type_t;
+    using typename base_t::subscriber_fn_t;
+
+    /**
+     * @brief Construct a new RSS Source Stage object
+     *
+     * @param reader : Reader of the feeds
+     * @param interval : Interval between polls
+     * @param stop_after : Stop after emitting this many rows, zero to disable
+     * @param run_indefinitely : Keep polling the feeds, otherwise they are polled once
+     * @param batch_size : Maximum number of rows of each message, zero emits the entries of each poll in one message
+     */
+    RSSSourceStage(std::shared_ptr<FeedReader> reader,
+                   std::chrono::milliseconds interval,
+                   std::size_t stop_after,
+                   bool run_indefinitely,
+                   std::size_t batch_size);
+
+    /**
+     * @brief Build a message from `entries`
+     */
+    static std::shared_ptr<MessageMeta> make_message(const std::vector<FeedEntry>& entries);
+
+  private:
+    subscriber_fn_t build();
+
+    std::shared_ptr<FeedReader> m_reader;
+    std::chrono::milliseconds m_interval;
+    std::size_t m_stop_after;
+    bool m_run_indefinitely;
+    std::size_t m_batch_size;
+};
+
+/****** RSSSourceStageInterfaceProxy************************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT RSSSourceStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a RSSSourceStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param feed_input : URLs or paths of local files of the feeds
+     * @param interval_secs : Interval in seconds between polls
+     * @param stop_after : Stop after emitting this many rows, zero to disable
+     * @param run_indefinitely : Keep polling the feeds, otherwise they are polled once
+     * @param batch_size : Maximum number of rows of each message, zero emits the entries of each poll in one message
+     * @param cooldown_interval : Interval in seconds during which a feed which failed isn't read
+     * @param strip_markup : Replace the markup of the title, summary and content with its text
+     * @param max_seen_entries : Number of entry ids remembered to skip entries which were already emitted
+     * @param num_threads : Number of threads reading and parsing feeds, zero uses the number of hardware threads
+     * @param fetcher : Downloads the feeds given as a URL, required when there are any
+     * @return std::shared_ptr<mrc::segment::Object<RSSSourceStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<RSSSourceStage>> init(mrc::segment::Builder& builder,
+                                                                      const std::string& name,
+                                                                      std::vector<std::string> feed_input,
+                                                                      double interval_secs,
+                                                                      std::size_t stop_after,
+                                                                      bool run_indefinitely,
+                                                                      std::size_t batch_size,
+                                                                      double cooldown_interval,
+                                                                      bool strip_markup,
+                                                                      std::size_t max_seen_entries,
+                                                                      std::size_t num_threads,
+                                                                      std::shared_ptr<WebFetcher> fetcher);
+};
+/** @} */  // end of group
+}  // namespace morpheus
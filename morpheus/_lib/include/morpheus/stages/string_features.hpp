@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/string_features.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pybind11/pytypes.h>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** StringFeaturesStage*********************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Computes numeric features of string columns, appending them to the message as INT32 and FLOAT32 columns
+ * ready to be packed into the input tensor of a FIL or autoencoder model. All of the features of a column are computed
+ * in a single pass over its strings on the host, with the rows split across `num_threads` threads. The new columns are
+ * committed with a `TableTransaction`, without converting the DataFrame in Python.
+ */
+class MORPHEUS_EXPORT StringFeaturesStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new StringFeatures Stage object
+     *
+     * @param features : Features to compute, the output columns are appended in this order
+     * @param num_threads : Number of host threads used to compute the features of a column, 0 uses the number of
+     * hardware threads
+     */
+    StringFeaturesStage(std::vector<StringFeature> features, std::size_t num_threads);
+
+  private:
+    source_type_t on_data(sink_type_t x);
+
+    /**
+     * @brief Compute the features of `extractor` for each row of the strings `column`, returning one column per output
+     */
+    std::vector<std::unique_ptr<cudf::column>> compute_features(const StringFeatureExtractor& extractor,
+                                                                const cudf::column_view& column) const;
+
+    // Output column of a feature, as the index of its extractor and of the output within the extractor's columns
+    struct OutputColumn
+    {
+        std::string name;
+        std::size_t extractor;
+        std::size_t output;
+    };
+
+    // Features grouped by column, in order of the first feature of each column
+    std::vector<StringFeatureExtractor> m_extractors;
+
+    // Output columns in the order of the features
+    std::vector<OutputColumn> m_output_columns;
+    std::size_t m_num_threads;
+};
+
+/****** StringFeaturesStageInterfaceProxy*******************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT StringFeaturesStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a StringFeaturesStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param features : Features as dictionaries holding the `column`, `type` and `name` of each feature, and for the
+     * `ngram_hash` type optionally `n` and `num_buckets`
+     * @param num_threads : Number of host threads used to compute the features of a column, 0 uses the number of
+     * hardware threads
+     * @return std::shared_ptr<mrc::segment::Object<StringFeaturesStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<StringFeaturesStage>> init(mrc::segment::Builder& builder,
+                                                                           const std::string& name,
+                                                                           const pybind11::list& features,
+                                                                           std::size_t num_threads);
+};
+/** @} */  // end of group
+}  // namespace morpheus
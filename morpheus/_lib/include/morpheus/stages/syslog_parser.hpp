@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/syslog_parser.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/io/types.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pybind11/pytypes.h>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** SyslogParserStage***********************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Parses a column of raw syslog, CEF and LEEF lines into header fields and the configured extension keys,
+ * appending them to the message as typed columns. Each line is parsed in a single pass on the host, with the rows split
+ * across `num_threads` threads. Lines which can't be parsed are null in every parsed column and the reason is written
+ * to the error column, which is null for the other lines. The new columns are committed with a `TableTransaction`.
+ */
+class MORPHEUS_EXPORT SyslogParserStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new SyslogParser Stage object
+     *
+     * @param parser : Parser of the lines, which defines the parsed columns
+     * @param column : Strings column holding the raw lines
+     * @param error_column : Name of the column holding the reason a line couldn't be parsed
+     * @param num_threads : Number of host threads used to parse the lines, 0 uses the number of hardware threads
+     */
+    SyslogParserStage(SyslogParser parser, std::string column, std::string error_column, std::size_t num_threads);
+
+  private:
+    source_type_t on_data(sink_type_t x);
+
+    /**
+     * @brief Parse each row of the strings `column`, returning the parsed columns followed by the error column
+     */
+    cudf::io::table_with_metadata parse_column(const cudf::column_view& column) const;
+
+    SyslogParser m_parser;
+    std::string m_column;
+    std::string m_error_column;
+    std::size_t m_num_threads;
+};
+
+/****** SyslogParserStageInterfaceProxy*********************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT SyslogParserStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a SyslogParserStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param column : Strings column holding the raw lines
+     * @param header_fields : Names of the header fields to write, such as `syslog_hostname` or `device_vendor`
+     * @param extension_fields : Extension keys to write as dictionaries holding the `key`, and optionally the `name`
+     * of the column and the `type` of its values, one of `str`, `int`, `float`, `bool` and `timestamp`
+     * @param column_prefix : Prepended to the names of the header columns
+     * @param error_column : Name of the column holding the reason a line couldn't be parsed
+     * @param syslog_year : Year of RFC 3164 timestamps, 0 infers the year from the current date
+     * @param num_threads : Number of host threads used to parse the lines, 0 uses the number of hardware threads
+     * @return std::shared_ptr<mrc::segment::Object<SyslogParserStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<SyslogParserStage>> init(mrc::segment::Builder& builder,
+                                                                         const std::string& name,
+                                                                         std::string column,
+                                                                         const std::vector<std::string>& header_fields,
+                                                                         const pybind11::list& extension_fields,
+                                                                         const std::string& column_prefix,
+                                                                         std::string error_column,
+                                                                         int syslog_year,
+                                                                         std::size_t num_threads);
+};
+/** @} */  // end of group
+}  // namespace morpheus
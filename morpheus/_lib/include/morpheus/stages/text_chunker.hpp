@@ -0,0 +1,139 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/control.hpp"
+#include "morpheus/objects/text_splitter.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <cudf/column/column_view.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** TextChunkerStage************************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Splits the text `column` of the payload into chunks with a `TextSplitter`, replacing the payload with a table
+ * holding one row per chunk. The other columns are repeated for each chunk of their row, and two columns are added:
+ * `row_id_column` with the position of the source row in the incoming payload, and `offset_column` with the character
+ * offset of the chunk in the source text. Rows are split in parallel across `num_threads` threads.
+ */
+class MORPHEUS_EXPORT TextChunkerStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<ControlMessage>, std::shared_ptr<ControlMessage>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<ControlMessage>, std::shared_ptr<ControlMessage>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new TextChunker Stage object
+     *
+     * @param column : String column holding the text to split
+     * @param splitter : Splitter applied to each row
+     * @param row_id_column : Name of the output column holding the position of the source row
+     * @param offset_column : Name of the output column holding the character offset of each chunk
+     * @param num_threads : Number of host threads used to split a batch, 0 uses the number of hardware threads
+     */
+    TextChunkerStage(std::string column,
+                     TextSplitter splitter,
+                     std::string row_id_column,
+                     std::string offset_column,
+                     std::size_t num_threads);
+
+  private:
+    /**
+     * @brief Chunks of a strings column, `rows` holds the row each chunk was split from
+     */
+    struct Chunks
+    {
+        std::string chars;
+        std::vector<std::int32_t> lengths;
+        std::vector<std::int32_t> rows;
+        std::vector<std::int64_t> offsets;
+    };
+
+    source_type_t on_data(sink_type_t x);
+
+    Chunks split_column(const cudf::column_view& column) const;
+
+    std::string m_column;
+    TextSplitter m_splitter;
+    std::string m_row_id_column;
+    std::string m_offset_column;
+    std::size_t m_num_threads;
+};
+
+/****** TextChunkerStageInterfaceProxy**********************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT TextChunkerStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a TextChunkerStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param column : String column holding the text to split
+     * @param chunk_size : Maximum size of a chunk, measured in `length_unit`
+     * @param chunk_overlap : Maximum overlap between consecutive chunks
+     * @param separators : Separators tried in order, empty uses the `TextSplitter` defaults
+     * @param keep_separator : Keep each separator at the start of the piece following it
+     * @param strip_whitespace : Strip leading and trailing whitespace from each chunk
+     * @param length_unit : Unit of `chunk_size` and `chunk_overlap`
+     * @param row_id_column : Name of the output column holding the position of the source row
+     * @param offset_column : Name of the output column holding the character offset of each chunk
+     * @param num_threads : Number of host threads used to split a batch, 0 uses the number of hardware threads
+     * @return std::shared_ptr<mrc::segment::Object<TextChunkerStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<TextChunkerStage>> init(mrc::segment::Builder& builder,
+                                                                        const std::string& name,
+                                                                        std::string column,
+                                                                        std::size_t chunk_size,
+                                                                        std::size_t chunk_overlap,
+                                                                        std::vector<std::string> separators,
+                                                                        bool keep_separator,
+                                                                        bool strip_whitespace,
+                                                                        TextLengthUnit length_unit,
+                                                                        std::string row_id_column,
+                                                                        std::string offset_column,
+                                                                        std::size_t num_threads);
+};
+/** @} */  // end of group
+}  // namespace morpheus
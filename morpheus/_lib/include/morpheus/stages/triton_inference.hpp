@@ -18,6 +18,7 @@
 #pragma once
 
 #include "morpheus/export.h"
+#include "morpheus/objects/dtype.hpp"
 #include "morpheus/objects/triton_in_out.hpp"
 #include "morpheus/stages/inference_client_stage.hpp"
 #include "morpheus/types.hpp"
@@ -31,6 +32,7 @@
 
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -160,6 +162,13 @@ class MORPHEUS_EXPORT TritonInferenceClientSession : public IInferenceClientSess
     std::vector<TritonInOut> m_model_outputs;
     std::shared_ptr<ITritonClient> m_client;
     bool m_force_convert_inputs;
+    std::mutex m_notified_mutex;
+    std::set<std::string> m_notified_inputs;
+
+    /**
+     * @brief Warns, once per input, that the input is automatically widened to the type the model expects
+     */
+    void notify_converted_input(const TritonInOut& model_input, const DType& input_type);
 
   public:
     TritonInferenceClientSession(std::shared_ptr<ITritonClient> client,
@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/document_converter.hpp"
+#include "morpheus/objects/web_fetcher.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** WebFetchStage***************************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Fetches the pages linked by the `link_column` of each `MessageMeta` with a `WebFetcher` and extracts their
+ * readable text, typically ahead of the `TextChunkerStage` when building a vector database.
+ *
+ * HTML pages are converted with the `HtmlDocumentConverter`, other `text` types are kept as is. Each row whose page was
+ * fetched and produced a non-empty text is emitted with the extracted text in `content_column`, along with the
+ * `final_url`, `status_code` and `content_type` columns describing the response. Rows with a null link, a failed
+ * request, an error status or an unsupported content type are logged and dropped, as are messages left without rows.
+ */
+class MORPHEUS_EXPORT WebFetchStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new WebFetch Stage object
+     *
+     * @param fetcher : Fetcher used to download the pages
+     * @param link_column : String column holding the URLs of the pages
+     * @param content_column : Column receiving the extracted text
+     * @param remove_boilerplate : Remove the navigation, headers, footers and forms of HTML pages
+     */
+    WebFetchStage(std::shared_ptr<WebFetcher> fetcher,
+                  std::string link_column,
+                  std::string content_column,
+                  bool remove_boilerplate);
+
+    /**
+     * @brief Text of a response, or an empty optional when its content type isn't supported
+     */
+    std::optional<std::string> extract_text(const WebResponse& response) const;
+
+  private:
+    subscribe_fn_t build_operator();
+
+    std::shared_ptr<MessageMeta> on_data(const MessageMeta& meta);
+
+    std::shared_ptr<WebFetcher> m_fetcher;
+    std::string m_link_column;
+    std::string m_content_column;
+
+    HtmlDocumentConverter m_html_converter;
+    TextDocumentConverter m_text_converter;
+};
+
+/****** WebFetchStageInterfaceProxy*************************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT WebFetchStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a WebFetchStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param fetcher : Fetcher used to download the pages
+     * @param link_column : String column holding the URLs of the pages
+     * @param content_column : Column receiving the extracted text
+     * @param remove_boilerplate : Remove the navigation, headers, footers and forms of HTML pages
+     * @return std::shared_ptr<mrc::segment::Object<WebFetchStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<WebFetchStage>> init(mrc::segment::Builder& builder,
+                                                                     const std::string& name,
+                                                                     std::shared_ptr<WebFetcher> fetcher,
+                                                                     std::string link_column,
+                                                                     std::string content_column,
+                                                                     bool remove_boilerplate);
+};
+/** @} */  // end of group
+}  // namespace morpheus
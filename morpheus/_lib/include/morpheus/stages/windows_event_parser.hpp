@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/windows_event_parser.hpp"
+
+#include <boost/fiber/context.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/io/types.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pybind11/pytypes.h>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** WindowsEventParserStage*****************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Normalizes a column of Windows events, rendered as XML or as JSON by collection agents, into the configured
+ * typed columns appended to the message, see `WindowsEventParser`. Each event is parsed in a single pass on the host,
+ * with the rows split across `num_threads` threads. Events which can't be parsed are null in every parsed column and
+ * the reason is written to the error column, which is null for the other events. The new columns are committed with a
+ * `TableTransaction`.
+ */
+class MORPHEUS_EXPORT WindowsEventParserStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new WindowsEventParser Stage object
+     *
+     * @param parser : Parser of the events, which defines the parsed columns
+     * @param column : Strings column holding the raw events
+     * @param error_column : Name of the column holding the reason an event couldn't be parsed
+     * @param num_threads : Number of host threads used to parse the events, 0 uses the number of hardware threads
+     */
+    WindowsEventParserStage(WindowsEventParser parser,
+                            std::string column,
+                            std::string error_column,
+                            std::size_t num_threads);
+
+  private:
+    source_type_t on_data(sink_type_t x);
+
+    /**
+     * @brief Parse each row of the strings `column`, returning the parsed columns followed by the error column
+     */
+    cudf::io::table_with_metadata parse_column(const cudf::column_view& column) const;
+
+    WindowsEventParser m_parser;
+    std::string m_column;
+    std::string m_error_column;
+    std::size_t m_num_threads;
+};
+
+/****** WindowsEventParserStageInterfaceProxy***************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MORPHEUS_EXPORT WindowsEventParserStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a WindowsEventParserStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param column : Strings column holding the raw events
+     * @param fields : Keys written for every event as dictionaries holding the `key`, and optionally the `name` of the
+     * column and the `type` of its values, one of `str`, `int`, `float`, `bool` and `timestamp`
+     * @param schemas : Keys written only for events of a given ID, in the same form as `fields`, by event ID
+     * @param event_id_key : Key holding the ID of an event
+     * @param error_column : Name of the column holding the reason an event couldn't be parsed
+     * @param num_threads : Number of host threads used to parse the events, 0 uses the number of hardware threads
+     * @return std::shared_ptr<mrc::segment::Object<WindowsEventParserStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<WindowsEventParserStage>> init(mrc::segment::Builder& builder,
+                                                                               const std::string& name,
+                                                                               std::string column,
+                                                                               const pybind11::list& fields,
+                                                                               const pybind11::dict& schemas,
+                                                                               std::string event_id_key,
+                                                                               std::string error_column,
+                                                                               std::size_t num_threads);
+};
+/** @} */  // end of group
+}  // namespace morpheus
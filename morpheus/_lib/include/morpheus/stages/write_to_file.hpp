@@ -64,12 +64,14 @@ class MORPHEUS_EXPORT WriteToFileStage
      * @param file_type : FileTypes
      * @param include_index_col : Write out the index as a column, by default true
      * @param flush : When `true` flush the output buffer to disk on each message.
+     * @param na_rep : String written for null values of CSV files
      */
     WriteToFileStage(const std::string& filename,
                      std::ios::openmode mode = std::ios::out,
                      FileTypes file_type     = FileTypes::Auto,
                      bool include_index_col  = true,
-                     bool flush              = false);
+                     bool flush              = false,
+                     std::string na_rep      = "");
 
   private:
     /**
@@ -103,6 +105,7 @@ class MORPHEUS_EXPORT WriteToFileStage
     bool m_is_first{};
     bool m_include_index_col;
     bool m_flush;
+    std::string m_na_rep;
     std::ofstream m_fstream;
     std::function<void(sink_type_t&)> m_write_func;
 };
@@ -123,15 +126,17 @@ struct MORPHEUS_EXPORT WriteToFileStageInterfaceProxy
      * @param file_type : FileTypes
      * @param include_index_col : Write out the index as a column, by default true
      * @param flush : When `true` flush the output buffer to disk on each message.
+     * @param na_rep : String written for null values of CSV files
      * @return std::shared_ptr<mrc::segment::Object<WriteToFileStage>>
      */
     static std::shared_ptr<mrc::segment::Object<WriteToFileStage>> init(mrc::segment::Builder& builder,
                                                                         const std::string& name,
                                                                         const std::string& filename,
-                                                                        const std::string& mode = "w",
-                                                                        FileTypes file_type     = FileTypes::Auto,
-                                                                        bool include_index_col  = true,
-                                                                        bool flush              = false);
+                                                                        const std::string& mode   = "w",
+                                                                        FileTypes file_type       = FileTypes::Auto,
+                                                                        bool include_index_col    = true,
+                                                                        bool flush                = false,
+                                                                        const std::string& na_rep = "");
 };
 /** @} */  // end of group
 }  // namespace morpheus
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"   // for MORPHEUS_EXPORT
+#include "morpheus/types.hpp"  // for TensorIndex
+
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** BucketUtil******************************************/
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief A group of rows padded to the same length, `rows` holds the index of each row in the batch
+ */
+struct MORPHEUS_EXPORT LengthBucket
+{
+    TensorIndex padded_length;
+    std::vector<TensorIndex> rows;
+};
+
+/**
+ * @brief Utilities for grouping the rows of a batch of token sequences by length, such that each group only needs to
+ * be padded to the length of the bucket it falls into rather than the longest sequence of the batch.
+ */
+struct MORPHEUS_EXPORT BucketUtil
+{
+    /**
+     * @brief Powers of two from 16 up to, and including, `max_length`
+     */
+    static std::vector<TensorIndex> default_bucket_lengths(TensorIndex max_length);
+
+    /**
+     * @brief Sort and deduplicate `bucket_lengths`, dropping lengths longer than `max_length` and adding `max_length`
+     * as the last bucket. An empty list returns `default_bucket_lengths(max_length)`.
+     */
+    static std::vector<TensorIndex> normalize_bucket_lengths(std::vector<TensorIndex> bucket_lengths,
+                                                             TensorIndex max_length);
+
+    /**
+     * @brief Indices of the rows ordered by ascending length, rows of the same length keep their order in the batch
+     */
+    static std::vector<TensorIndex> stable_length_order(const std::vector<TensorIndex>& lengths);
+
+    /**
+     * @brief Smallest of the ascending `bucket_lengths` which holds a sequence of `length` tokens
+     *
+     * @throws std::invalid_argument if `length` is longer than the last bucket
+     */
+    static TensorIndex padded_length(TensorIndex length, const std::vector<TensorIndex>& bucket_lengths);
+
+    /**
+     * @brief Group the rows of the batch by the bucket their length falls into, in ascending order of length. Buckets
+     * holding more than `max_rows` rows are split, a `max_rows` of 0 doesn't limit the size of the buckets.
+     *
+     * Concatenating the `rows` of the returned buckets gives `stable_length_order(lengths)`.
+     */
+    static std::vector<LengthBucket> make_buckets(const std::vector<TensorIndex>& lengths,
+                                                  const std::vector<TensorIndex>& bucket_lengths,
+                                                  TensorIndex max_rows = 0);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,170 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"  // for MORPHEUS_EXPORT
+
+#include <cudf/column/column.hpp>       // for column
+#include <cudf/column/column_view.hpp>  // for column_view
+#include <cudf/io/types.hpp>            // for table_with_metadata
+#include <cudf/types.hpp>               // for size_type, type_id, bitmask_type, data_type
+#include <rmm/cuda_stream_view.hpp>     // for cuda_stream_per_thread
+#include <rmm/device_buffer.hpp>        // for device_buffer
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for int64_t
+#include <functional>  // for function
+#include <memory>      // for make_unique, unique_ptr
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>  // for move
+#include <vector>
+
+namespace morpheus {
+
+class DecodedTable;
+
+/****** Component public implementations *******************/
+/****** HostStringsColumn***********************************/
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Host copy of the offsets, characters and null mask of a cuDF strings column, used by the stages which
+ * process the rows of a strings column on the CPU.
+ */
+class MORPHEUS_EXPORT HostStringsColumn
+{
+  public:
+    /**
+     * @brief Copy `column`, which must be a strings column, to the host
+     */
+    explicit HostStringsColumn(const cudf::column_view& column);
+
+    std::size_t size() const;
+
+    /**
+     * @brief Whether `row` isn't null
+     */
+    bool is_valid(std::size_t row) const;
+
+    /**
+     * @brief Value of `row`, which is empty for a null row. The view is valid for the lifetime of this object.
+     */
+    std::string_view get(std::size_t row) const;
+
+  private:
+    std::vector<cudf::size_type> m_offsets;
+    std::string m_chars;
+    std::vector<cudf::bitmask_type> m_null_mask;
+    cudf::size_type m_offset{0};
+};
+
+/****** ColumnUtil******************************************/
+
+/**
+ * @brief Utilities for copying cuDF columns to and from host values and for processing the rows of a column on
+ * several threads.
+ */
+struct MORPHEUS_EXPORT ColumnUtil
+{
+    using parse_rows_fn_t =
+        std::function<void(const HostStringsColumn& strings, std::size_t start, std::size_t stop, DecodedTable& table)>;
+
+    // Below this many rows per thread the cost of starting a thread outweighs the work
+    static constexpr std::size_t MinRowsPerThread = 64;
+
+    /**
+     * @brief Number of ranges `parallel_for_rows` splits `num_rows` rows into, at least one
+     */
+    static std::size_t num_row_chunks(std::size_t num_rows,
+                                      std::size_t num_threads,
+                                      std::size_t min_rows_per_thread = MinRowsPerThread);
+
+    /**
+     * @brief Split `num_rows` rows into `num_row_chunks` contiguous ranges and call `fn(chunk, start, stop)` for each
+     * of them. The calling thread handles the first range and every other range runs on its own thread. All of the
+     * ranges have completed when this returns, an exception thrown by a range is rethrown.
+     */
+    static void parallel_for_rows(std::size_t num_rows,
+                                  std::size_t num_threads,
+                                  const std::function<void(std::size_t chunk, std::size_t start, std::size_t stop)>& fn,
+                                  std::size_t min_rows_per_thread = MinRowsPerThread);
+
+    /**
+     * @brief Parse the rows of the strings column `column` on up to `num_threads` threads. Each range of rows is
+     * parsed by `parse_rows(strings, start, stop, table)` into its own table, and the tables are appended in order.
+     */
+    static cudf::io::table_with_metadata parse_strings_column_parallel(const cudf::column_view& column,
+                                                                       std::size_t num_threads,
+                                                                       const parse_rows_fn_t& parse_rows);
+
+    /**
+     * @brief Host copy of the values of the integer or boolean column `column` as int64, the null rows are
+     * `std::nullopt`
+     */
+    static std::vector<std::optional<std::int64_t>> integers_to_host(const cudf::column_view& column);
+
+    /**
+     * @brief Device null mask of `valid`, which is empty when every row is valid. `null_count` is set to the number of
+     * null rows.
+     */
+    static rmm::device_buffer make_null_mask(const std::vector<bool>& valid, cudf::size_type& null_count);
+
+    /**
+     * @brief Column of type `type`, whose storage type is `T`, holding `values`. The rows which are false in `valid`
+     * are null, an empty `valid` makes every row valid.
+     */
+    template <typename T>
+    static std::unique_ptr<cudf::column> make_numeric_column(const std::vector<T>& values,
+                                                             cudf::type_id type,
+                                                             const std::vector<bool>& valid = {})
+    {
+        cudf::size_type null_count = 0;
+        auto null_mask             = make_null_mask(valid, null_count);
+
+        return std::make_unique<cudf::column>(
+            cudf::data_type{type},
+            static_cast<cudf::size_type>(values.size()),
+            rmm::device_buffer(values.data(), values.size() * sizeof(T), rmm::cuda_stream_per_thread),
+            std::move(null_mask),
+            null_count);
+    }
+
+    /**
+     * @brief Strings column of the concatenated `chars`, where row `i` spans `[offsets[i], offsets[i + 1])`. The rows
+     * which are false in `valid` are null, an empty `valid` makes every row valid.
+     */
+    static std::unique_ptr<cudf::column> make_strings_column(const std::string& chars,
+                                                             const std::vector<cudf::size_type>& offsets,
+                                                             const std::vector<bool>& valid = {});
+
+    static std::unique_ptr<cudf::column> make_strings_column(const std::vector<std::string>& values);
+
+    /**
+     * @brief Strings column of `values`, the missing values are null
+     */
+    static std::unique_ptr<cudf::column> make_strings_column(const std::vector<std::optional<std::string>>& values);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"                   // for MORPHEUS_EXPORT
+#include "morpheus/objects/dtype.hpp"          // for DType
+#include "morpheus/objects/tensor_object.hpp"  // for TensorObject
+#include "morpheus/types.hpp"                  // for TensorIndex, RangeType, ShapeType
+
+#include <cudf/table/table.hpp>       // IWYU pragma: keep
+#include <cudf/table/table_view.hpp>  // for table_view
+
+#include <cstdint>  // for uint64_t, uint8_t
+#include <map>
+#include <memory>  // for unique_ptr
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace morpheus {
+
+class MessageMeta;
+
+/****** Component public implementations *******************/
+/****** DedupUtil*******************************************/
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Identifies the duplicate rows of a batch. For each row `representative` holds the index of the first row in
+ * the batch with the same contents, which is the row itself for the first occurrence.
+ */
+struct MORPHEUS_EXPORT DedupIndex
+{
+    std::vector<std::uint64_t> hashes;
+    std::vector<TensorIndex> representative;
+
+    /**
+     * @brief Ascending indices of the rows which are their own representative
+     */
+    std::vector<TensorIndex> unique_rows() const;
+
+    /**
+     * @brief Returns true when at least one row is a duplicate of an earlier row
+     */
+    bool has_duplicates() const;
+};
+
+/**
+ * @brief A single row of an output tensor stored in the cross-batch result cache of `InferenceClientStage`
+ */
+struct MORPHEUS_EXPORT DedupCachedRow
+{
+    DType dtype;
+
+    // Shape of the row, the shape of the tensor without the first dimension
+    ShapeType row_shape;
+
+    // Row-major contents of the row
+    std::vector<std::uint8_t> data;
+};
+
+/**
+ * @brief Model outputs of a row in the cross-batch result cache of `InferenceClientStage`. Rows are looked up by their
+ * hash, `inputs` holds the rows of the input tensors the outputs were inferred from and is compared on each hit.
+ */
+struct MORPHEUS_EXPORT DedupCacheEntry
+{
+    std::vector<std::uint8_t> inputs;
+    std::map<std::string, DedupCachedRow> outputs;
+};
+
+/**
+ * @brief Utilities for sending only the unique rows of a batch through preprocessing and inference, and scattering
+ * the results back to the duplicate rows.
+ *
+ * `DeduplicateStage` records the row hashes and representatives in the `DedupUtil::HashColumn` and
+ * `DedupUtil::IndexColumn` columns of the payload, the native preprocessing and inference stages use the presence of
+ * these columns to skip the duplicate rows.
+ */
+struct MORPHEUS_EXPORT DedupUtil
+{
+    static constexpr const char* HashColumn  = "_dedup_hash";
+    static constexpr const char* IndexColumn = "_dedup_index";
+
+    /**
+     * @brief Compute a 64-bit hash of each row of `table`
+     */
+    static std::vector<std::uint64_t> hash_rows(const cudf::table_view& table);
+
+    /**
+     * @brief Build the representative of each row from the row hashes
+     */
+    static DedupIndex build_index(std::vector<std::uint64_t> hashes);
+
+    /**
+     * @brief Compare each row of `table` with its representative in `index` on the device. Rows which only share the
+     * hash of their representative become their own representative.
+     */
+    static void verify_index(const cudf::table_view& table, DedupIndex& index);
+
+    /**
+     * @brief Read the dedup columns written by `DeduplicateStage` from `meta`, returns `std::nullopt` when the columns
+     * are not present
+     */
+    static std::optional<DedupIndex> read_index(const MessageMeta& meta);
+
+    /**
+     * @brief Convert a list of row indices into the fewest `[start, stop)` ranges selecting the same rows in order
+     */
+    static std::vector<RangeType> to_row_ranges(const std::vector<TensorIndex>& rows);
+
+    /**
+     * @brief Gather the rows of `table` listed in `rows`
+     */
+    static std::unique_ptr<cudf::table> gather_rows(const cudf::table_view& table,
+                                                    const std::vector<TensorIndex>& rows);
+
+    /**
+     * @brief Replace the message ids, stored in the first column of a `seq_ids` tensor, which index into the unique
+     * rows with the index of the row in the batch. `unique_rows` is the list of rows which were gathered.
+     */
+    static void remap_seq_ids(TensorObject& seq_ids, const std::vector<TensorIndex>& unique_rows);
+
+    /**
+     * @brief Return a compact copy of the two dimensional `tensor` where row `i` is row `source_rows[i]` of the input,
+     * gathered on the device
+     */
+    static TensorObject gather_tensor_rows(const TensorObject& tensor, const std::vector<TensorIndex>& source_rows);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -116,6 +116,16 @@ struct MatxUtil
                                                           const ShapeType& seq_ids,
                                                           TensorIndex seq_id_offset,
                                                           const ShapeType& output_shape);
+
+    /**
+     * @brief Returns a compact row-major buffer holding the rows of the two dimensional `input` listed in `rows`, row
+     * `i` of the output being row `rows[i]` of the input. Rows may be listed more than once and in any order.
+     *
+     * @param input
+     * @param rows
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> gather_rows(const DevMemInfo& input, const ShapeType& rows);
 };
 /** @} */  // end of group
 }  // namespace morpheus
@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"  // for MORPHEUS_EXPORT
+
+#include <cstdint>  // for int64_t
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** PcapUtil********************************************/
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Flow features of a batch of packets, one entry per packet
+ */
+struct MORPHEUS_EXPORT PcapFlowFeatures
+{
+    // Minute of the roll-up window of each packet, formatted as `%Y-%m-%d %H:%M`
+    std::vector<std::string> rollup_time;
+
+    // Row-major `[num_packets, PcapUtil::feature_names().size()]` features of the flow of each packet
+    std::vector<float> features;
+};
+
+/**
+ * @brief Computes the per-flow features of the ABP PCAP detection model.
+ *
+ * Packets are grouped by flow, `src_ip:src_port=dest_ip:dest_port`, and one minute roll-up window. The ACK, PSH, RST,
+ * SYN and FIN flags are decoded from the low five bits of the TCP flags. Each packet receives the features of its
+ * group: the flag counts, the number of packets (`ppm`), the sum of `data_len`, the bytes per packet and the ratios of
+ * the flag counts to the total number of flags. Packets without a flow id have NaN features.
+ */
+struct MORPHEUS_EXPORT PcapUtil
+{
+    static constexpr std::int64_t RollupMicroseconds = 60'000'000;
+
+    /**
+     * @brief Names of the features in the order they are computed
+     */
+    static const std::vector<std::string>& feature_names();
+
+    /**
+     * @brief End of the roll-up window of a timestamp in microseconds. Computed with the same floating point arithmetic
+     * as the Python stage, such that timestamps on a minute boundary fall into the following minute.
+     */
+    static std::int64_t rollup_time(std::int64_t timestamp);
+
+    /**
+     * @brief Format a timestamp in microseconds as `%Y-%m-%d %H:%M`
+     */
+    static std::string format_minute(std::int64_t timestamp);
+
+    /**
+     * @brief Id of the flow between two endpoints, `src_ip:src_port=dest_ip:dest_port`
+     */
+    static std::string flow_id(std::string_view src_ip,
+                               std::string_view src_port,
+                               std::string_view dest_ip,
+                               std::string_view dest_port);
+
+    /**
+     * @brief Compute the features of each packet with a single hash aggregation over the packets of the batch
+     *
+     * @param timestamps : Packet timestamps in microseconds since the Unix epoch
+     * @param flags : TCP flags of each packet
+     * @param data_len : Payload size of each packet, truncated to 16 bits like the `int16` cast of the Python stage
+     * @param flow_ids : Flow id of each packet, see `flow_id`
+     */
+    static PcapFlowFeatures compute_features(const std::vector<std::int64_t>& timestamps,
+                                             const std::vector<std::int64_t>& flags,
+                                             const std::vector<std::int64_t>& data_len,
+                                             const std::vector<std::optional<std::string>>& flow_ids);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,172 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"        // for MORPHEUS_EXPORT
+#include "morpheus/objects/grok.hpp"  // for GrokMatcher
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <map>
+#include <memory>  // for shared_ptr
+#include <string>
+#include <string_view>
+#include <utility>  // for pair
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** PiiMasker*******************************************/
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Names of the built-in entity scanners, also used as the label of their matches
+ */
+struct MORPHEUS_EXPORT PiiEntity
+{
+    static constexpr const char* Email      = "EMAIL";
+    static constexpr const char* IpAddress  = "IP_ADDRESS";
+    static constexpr const char* CreditCard = "CREDIT_CARD";
+    static constexpr const char* Username   = "USERNAME";
+    static constexpr const char* Hostname   = "HOSTNAME";
+
+    /**
+     * @brief All of the built-in entities
+     */
+    static std::vector<std::string> all();
+};
+
+/**
+ * @brief A single detected entity, the `[begin, end)` byte range of the value within the scanned text
+ */
+struct MORPHEUS_EXPORT PiiMatch
+{
+    std::size_t begin;
+    std::size_t end;
+    std::string label;
+};
+
+/**
+ * @brief Detects PII in text and replaces it, either with a `[LABEL]` redaction token or with a `LABEL_<hex>`
+ * pseudonym computed with a keyed hash of the value. Pseudonyms are stable for a given key, allowing masked values to
+ * still be joined and counted downstream.
+ *
+ * The built-in entities are detected by hand-written scanners in a single left-to-right pass over the text: emails
+ * and hostnames by their grammar, IPv4 and IPv6 addresses, 13 to 19 digit card numbers passing the Luhn check,
+ * usernames following a `user=`/`username:` style key and the user part of `DOMAIN\user`. Additional literals (i.e.
+ * known usernames or hostnames) and regular expressions can be mapped to a label. Literals are matched on word
+ * boundaries as part of the same pass, regular expressions are more expensive and require a separate search. Regular
+ * expressions are matched by a `GrokMatcher`, in time linear in the length of the text, and are limited to its syntax.
+ *
+ * Instances are immutable after construction and safe to use from multiple threads.
+ */
+class MORPHEUS_EXPORT PiiMasker
+{
+  public:
+    /**
+     * @brief Construct a new PiiMasker object
+     *
+     * @param entities : Built-in entities to detect, see `PiiEntity`
+     * @param literals : Map of literal values to their label
+     * @param patterns : Map of regular expressions to their label
+     * @param pseudonymize : When true matches are replaced with keyed-hash pseudonyms instead of redaction tokens
+     * @param key : Key of the pseudonym hash
+     */
+    PiiMasker(const std::vector<std::string>& entities,
+              const std::map<std::string, std::string>& literals = {},
+              const std::map<std::string, std::string>& patterns = {},
+              bool pseudonymize                                  = false,
+              const std::string& key                             = "");
+
+    /**
+     * @brief Detect the entities in `text`, matches are returned in order and never overlap
+     */
+    std::vector<PiiMatch> scan(std::string_view text) const;
+
+    /**
+     * @brief Returns `text` with every detected entity replaced
+     */
+    std::string mask(std::string_view text) const;
+
+    /**
+     * @brief Appends the masked `text` to `output`, avoiding a temporary string when masking many values
+     */
+    void mask_into(std::string_view text, std::string& output) const;
+
+    /**
+     * @brief The replacement for `value` detected as `label`
+     */
+    std::string replacement(std::string_view label, std::string_view value) const;
+
+  private:
+    struct TrieNode;
+
+    std::size_t match_literal(std::string_view text, std::size_t pos, std::string& label) const;
+
+    bool m_email;
+    bool m_ip_address;
+    bool m_credit_card;
+    bool m_username;
+    bool m_hostname;
+
+    std::shared_ptr<TrieNode> m_literals;
+    std::vector<std::pair<GrokMatcher, std::string>> m_patterns;
+
+    bool m_pseudonymize;
+    std::uint64_t m_key0{0};
+    std::uint64_t m_key1{0};
+};
+
+/**
+ * @brief Stateless helpers shared by `PiiMasker` and the device implementation of `PiiMaskStage`
+ */
+struct MORPHEUS_EXPORT PiiUtil
+{
+    /**
+     * @brief Returns true if the digits of `number` pass the Luhn checksum, non-digit characters are skipped
+     */
+    static bool luhn_valid(std::string_view number);
+
+    /**
+     * @brief SipHash-2-4 of `data` with the 128-bit key `(key0, key1)`
+     */
+    static std::uint64_t siphash(std::uint64_t key0, std::uint64_t key1, std::string_view data);
+
+    /**
+     * @brief Keys whose value is detected as a username, i.e. `user=alice`. Compared case-insensitively.
+     */
+    static const std::vector<std::string>& username_keys();
+
+    /**
+     * @brief Top level domains of two label hostnames, names with three or more labels may end in any alphabetic label
+     */
+    static const std::vector<std::string>& hostname_tlds();
+
+    /**
+     * @brief Derives the 128-bit pseudonym key from a user supplied key of any length
+     */
+    static std::pair<std::uint64_t, std::uint64_t> derive_key(std::string_view key);
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
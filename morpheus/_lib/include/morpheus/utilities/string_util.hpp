@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include <initializer_list>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 namespace morpheus {
 
@@ -127,6 +129,28 @@ struct StringUtil
      * @return True if `str` contains `search_str`, false otherwise.
      */
     static bool str_contains(const std::string& str, const std::string& search_str);
+
+    /**
+     * @brief Replace each invalid UTF-8 sequence of `text` with U+FFFD, the same as Python's `errors="replace"`.
+     *
+     * Overlong encodings, surrogates and code points above U+10FFFF are invalid. Each maximal prefix of a valid
+     * sequence, or a single byte when the first byte can't start a sequence, is replaced.
+     *
+     * @param text The text to check, replaced in place.
+     * @return True if any sequence was replaced.
+     */
+    static bool replace_invalid_utf8(std::string& text);
+
+    /**
+     * @brief Hash a sequence of fields with 64-bit FNV-1a, for use as a cache key.
+     *
+     * Each field is terminated by 0xff, which doesn't occur in UTF-8 text, so that moving characters from one field to
+     * the next changes the hash.
+     *
+     * @param fields The fields to hash.
+     * @return The hash as 16 lower case hexadecimal digits.
+     */
+    static std::string hash_fields(std::initializer_list<std::string_view> fields);
 };
 /** @} */  // end of group
 }  // namespace morpheus
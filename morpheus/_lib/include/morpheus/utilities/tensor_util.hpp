@@ -18,9 +18,11 @@
 #pragma once
 
 #include "morpheus/export.h"
-#include "morpheus/types.hpp"  // for ShapeType, TensorIndex
+#include "morpheus/objects/dtype.hpp"  // for DType
+#include "morpheus/types.hpp"          // for ShapeType, TensorIndex
 
 #include <algorithm>   // IWYU pragma: keep
+#include <cstdint>     // for uint8_t
 #include <functional>  // for multiplies
 #include <iosfwd>      // for ostream
 #include <numeric>     // for accumulate
@@ -119,6 +121,32 @@ struct MORPHEUS_EXPORT TensorUtils
     {
         return std::accumulate(shape.begin(), shape.end(), TensorSize{1}, std::multiplies<>());
     }
+
+    /**
+     * @brief Splits the rows of an inference tensor into batches of at most `max_batch_size` rows without splitting
+     * the rows belonging to a single message across batches. The rows of a message are identified by sharing the same
+     * value in `seq_ids` (the first column of the `seq_ids` tensor). A single message with more than `max_batch_size`
+     * rows is emitted as its own batch.
+     *
+     * @param seq_ids Message ID of each tensor row
+     * @param max_batch_size Maximum number of tensor rows in a batch
+     * @return std::vector<RangeType> The `[start, stop)` tensor row ranges of each batch
+     */
+    static std::vector<RangeType> split_seq_id_batches(const ShapeType& seq_ids, TensorIndex max_batch_size);
+
+    /**
+     * @brief Host counterpart of `MatxUtil::cast`, converts contiguous values held in host memory from `input_type` to
+     * `output_type`. Used to widen compact tensors after they have been copied off of the device, so that only the
+     * compact values are transferred.
+     *
+     * @param input Values of type `input_type`
+     * @param input_type Type of the values in `input`
+     * @param output_type Type to convert the values to
+     * @return std::vector<uint8_t> The converted values
+     */
+    static std::vector<uint8_t> cast_host(const std::vector<uint8_t>& input,
+                                          const DType& input_type,
+                                          const DType& output_type);
 };
 
 /** @} */  // end of group
@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"  // for MORPHEUS_EXPORT
+
+#include <cstdint>  // for int64_t, uint8_t
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** TimestampUtil***************************************/
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Timestamp formats recognized by `TimestampUtil`
+ */
+enum class TimestampFormat : std::uint8_t
+{
+    Unknown,
+    Iso8601,       // 2024-03-01T12:34:56.789+02:00, also a space separator and date only values, including 20240301
+    Rfc2822,       // Fri, 01 Mar 2024 12:34:56 +0200
+    CommonLog,     // 01/Mar/2024:12:34:56 +0200
+    Syslog,        // Mar  1 12:34:56, the year is not part of the value
+    EpochSeconds,  // 1709296496 or 1709296496.789
+    EpochMillis,   // 1709296496789
+    EpochMicros,   // 1709296496789000
+    EpochNanos,    // 1709296496789000000
+    FileTime,      // Windows FILETIME, 100ns intervals since 1601-01-01, decimal or 0x prefixed hex
+};
+
+/**
+ * @brief Parses timestamps into nanoseconds since the Unix epoch in UTC. Values with a time zone offset are converted
+ * to UTC, values without one are assumed to already be UTC.
+ *
+ * Each format has a strict parser which only accepts the canonical layout of the format, reading fields from fixed
+ * offsets without searching. These are used once the format of a column is known. `parse_any` is the slower general
+ * parser used to detect the format of a value, it also tolerates surrounding whitespace, lowercase designators,
+ * `UTC`/`GMT` suffixes and missing seconds.
+ */
+struct MORPHEUS_EXPORT TimestampUtil
+{
+    /**
+     * @brief Value used for missing and unparsable timestamps, the same as numpy's `NaT`
+     */
+    static constexpr std::int64_t NaT = std::numeric_limits<std::int64_t>::min();
+
+    /**
+     * @brief Returns the format of a single value or `TimestampFormat::Unknown`
+     */
+    static TimestampFormat classify(std::string_view value);
+
+    /**
+     * @brief Returns the most common format among the values of `sample`, ignoring values which can't be classified
+     */
+    static TimestampFormat detect_format(const std::vector<std::string_view>& sample);
+
+    /**
+     * @brief Parse `value` with the strict parser of `format`
+     *
+     * @param value : Timestamp string
+     * @param format : Expected format of `value`
+     * @param nanos : Set to the nanoseconds since the Unix epoch on success
+     * @param syslog_year : Year of `TimestampFormat::Syslog` values, 0 uses the current year unless the result would be
+     * more than a day in the future, in which case the previous year is used.
+     * @return true if `value` was parsed
+     */
+    static bool parse(std::string_view value, TimestampFormat format, std::int64_t& nanos, int syslog_year = 0);
+
+    /**
+     * @brief Parse `value` in any of the supported formats, the epoch unit is inferred from the magnitude of the value
+     *
+     * @return true if `value` was parsed
+     */
+    static bool parse_any(std::string_view value, std::int64_t& nanos, int syslog_year = 0);
+
+    /**
+     * @brief Days between the Unix epoch and the given date of the proleptic Gregorian calendar
+     */
+    static std::int64_t days_from_civil(std::int64_t year, unsigned month, unsigned day);
+
+    /**
+     * @brief Date of the proleptic Gregorian calendar `days` after the Unix epoch, the inverse of `days_from_civil`
+     */
+    static void civil_from_days(std::int64_t days, std::int64_t& year, unsigned& month, unsigned& day);
+
+    /**
+     * @brief Name of `format`, e.g. `"ISO8601"`
+     */
+    static std::string format_name(TimestampFormat format);
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -22,7 +22,9 @@ __all__ = [
     "LLMNodeBase",
     "LLMNodeRunner",
     "LLMTask",
-    "LLMTaskHandler"
+    "LLMTaskHandler",
+    "StructuredOutputError",
+    "StructuredOutputNode"
 ]
 
 
@@ -232,3 +234,50 @@ class LLMTaskHandler():
         """
     pass
 __version__ = '24.10.0'
+class StructuredOutputError():
+    """
+    Per-row error codes of `StructuredOutputNode`
+
+    Members:
+
+      OK
+
+      NO_STRUCTURE
+
+      MALFORMED
+
+      MISSING_FIELD
+
+      TYPE_MISMATCH
+    """
+    def __eq__(self, other: object) -> bool: ...
+    def __getstate__(self) -> int: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __init__(self, value: int) -> None: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: object) -> bool: ...
+    def __repr__(self) -> str: ...
+    def __setstate__(self, state: int) -> None: ...
+    @property
+    def name(self) -> str:
+        """
+        :type: str
+        """
+    @property
+    def value(self) -> int:
+        """
+        :type: int
+        """
+    MALFORMED: morpheus._lib.llm.StructuredOutputError # value = <StructuredOutputError.MALFORMED: 2>
+    MISSING_FIELD: morpheus._lib.llm.StructuredOutputError # value = <StructuredOutputError.MISSING_FIELD: 3>
+    NO_STRUCTURE: morpheus._lib.llm.StructuredOutputError # value = <StructuredOutputError.NO_STRUCTURE: 1>
+    OK: morpheus._lib.llm.StructuredOutputError # value = <StructuredOutputError.OK: 0>
+    TYPE_MISMATCH: morpheus._lib.llm.StructuredOutputError # value = <StructuredOutputError.TYPE_MISMATCH: 4>
+    __members__: dict # value = {'OK': <StructuredOutputError.OK: 0>, 'NO_STRUCTURE': <StructuredOutputError.NO_STRUCTURE: 1>, 'MALFORMED': <StructuredOutputError.MALFORMED: 2>, 'MISSING_FIELD': <StructuredOutputError.MISSING_FIELD: 3>, 'TYPE_MISMATCH': <StructuredOutputError.TYPE_MISMATCH: 4>}
+    pass
+class StructuredOutputNode(LLMNodeBase):
+    def __init__(self, schema: dict, required: typing.Optional[typing.List[str]] = None, input_name: str = 'response', error_name: str = 'error_code', allow_key_value: bool = True) -> None: ...
+    def execute(self, context: LLMContext) -> typing.Awaitable[LLMContext]: ...
+    def get_input_names(self) -> typing.List[str]: ...
+    pass
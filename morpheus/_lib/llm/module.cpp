@@ -30,6 +30,7 @@
 #include "morpheus/llm/llm_node_runner.hpp"
 #include "morpheus/llm/llm_task.hpp"
 #include "morpheus/llm/llm_task_handler.hpp"
+#include "morpheus/llm/structured_output_node.hpp"
 #include "morpheus/messages/control.hpp"    // IWYU pragma: keep
 #include "morpheus/pybind11/input_map.hpp"  // IWYU pragma: keep
 #include "morpheus/utilities/cudf_util.hpp"
@@ -45,7 +46,9 @@
 #include <pymrc/utilities/json_values.hpp>  // for JSONValues
 #include <pymrc/utils.hpp>                  // for pymrc::import
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -333,6 +336,50 @@ PYBIND11_MODULE(llm, _module)
         .def("get_input_names", &PyLLMLambdaNode::get_input_names)
         .def("execute", &PyLLMLambdaNode::execute, py::arg("context"));
 
+    py::enum_<StructuredOutputError>(_module, "StructuredOutputError", "Per-row error codes of `StructuredOutputNode`")
+        .value("OK", StructuredOutputError::Ok)
+        .value("NO_STRUCTURE", StructuredOutputError::NoStructure)
+        .value("MALFORMED", StructuredOutputError::Malformed)
+        .value("MISSING_FIELD", StructuredOutputError::MissingField)
+        .value("TYPE_MISMATCH", StructuredOutputError::TypeMismatch);
+
+    py::class_<StructuredOutputNode, LLMNodeBase, std::shared_ptr<StructuredOutputNode>>(_module,
+                                                                                         "StructuredOutputNode")
+        .def(py::init<>([](py::dict schema,
+                           std::optional<std::vector<std::string>> required,
+                           std::string input_name,
+                           std::string error_name,
+                           bool allow_key_value) {
+                 std::vector<StructuredField> fields;
+                 for (const auto& [name, type] : schema)
+                 {
+                     // Accept both type names and the builtin types, e.g. `"int"` or `int`
+                     auto type_name = py::isinstance<py::type>(type) ? type.attr("__name__").cast<std::string>()
+                                                                      : type.cast<std::string>();
+
+                     StructuredField field{name.cast<std::string>(),
+                                           StructuredOutputParser::type_from_string(type_name)};
+                     if (required.has_value())
+                     {
+                         field.required = std::find(required->begin(), required->end(), field.name) !=
+                                          required->end();
+                     }
+
+                     fields.push_back(std::move(field));
+                 }
+
+                 return std::make_shared<StructuredOutputNode>(
+                     StructuredOutputParser(std::move(fields), allow_key_value), std::move(input_name),
+                     std::move(error_name));
+             }),
+             py::arg("schema"),
+             py::arg("required")        = py::none(),
+             py::arg("input_name")      = "response",
+             py::arg("error_name")      = "error_code",
+             py::arg("allow_key_value") = true)
+        .def("get_input_names", &StructuredOutputNode::get_input_names)
+        .def("execute", &StructuredOutputNode::execute, py::arg("context"));
+
     py::class_<mrc::segment::Object<PyLLMEngineStage>,
                mrc::segment::ObjectProperties,
                std::shared_ptr<mrc::segment::Object<PyLLMEngineStage>>>(
@@ -20,6 +20,7 @@ __all__ = [
     "InferenceMemory",
     "InferenceMemoryFIL",
     "InferenceMemoryNLP",
+    "MessageAttachment",
     "MessageMeta",
     "MultiInferenceFILMessage",
     "MultiInferenceMessage",
@@ -54,14 +55,17 @@ class ControlMessage():
         """
         Retrieve timestamps matching a regex filter within a given group.
         """
+    def get_attachment(self, name: str, default_value: object = None) -> object: ...
     def get_metadata(self, key: object = None, default_value: object = None) -> object: ...
     def get_tasks(self) -> object: ...
     def get_timestamp(self, key: str, fail_if_nonexist: bool = False) -> object: 
         """
         Retrieve the timestamp for a given group and key. Returns None if the timestamp does not exist and fail_if_nonexist is False.
         """
+    def has_attachment(self, name: str) -> bool: ...
     def has_metadata(self, key: str) -> bool: ...
     def has_task(self, task_type: str) -> bool: ...
+    def list_attachments(self) -> typing.List[str]: ...
     def list_metadata(self) -> list: ...
     @typing.overload
     def payload(self) -> MessageMeta: ...
@@ -69,7 +73,9 @@ class ControlMessage():
     def payload(self, arg0: MessageMeta) -> None: ...
     @typing.overload
     def payload(self, meta: object) -> None: ...
+    def remove_attachment(self, name: str) -> object: ...
     def remove_task(self, task_type: str) -> object: ...
+    def set_attachment(self, name: str, data: object) -> None: ...
     def set_metadata(self, key: str, value: object) -> None: ...
     def set_timestamp(self, key: str, timestamp: object) -> None: 
         """
@@ -180,6 +186,22 @@ class InferenceMemoryNLP(InferenceMemory, TensorMemory):
     def seq_ids(self, arg1: object) -> None:
         pass
     pass
+class MessageAttachment():
+    def __init__(self, data: object) -> None: ...
+    def __len__(self) -> int: ...
+    def to_bytes(self) -> bytes: ...
+    def to_cupy(self) -> object: ...
+    @property
+    def is_device(self) -> bool:
+        """
+        :type: bool
+        """
+    @property
+    def size(self) -> int:
+        """
+        :type: int
+        """
+    pass
 class MessageMeta():
     def __init__(self, df: object) -> None: ...
     def copy_dataframe(self) -> object: ...
@@ -18,6 +18,7 @@
 #include "pymrc/utilities/object_wrappers.hpp"
 
 #include "morpheus/io/data_loader_registry.hpp"
+#include "morpheus/messages/attachment.hpp"
 #include "morpheus/messages/control.hpp"
 #include "morpheus/messages/memory/inference_memory.hpp"
 #include "morpheus/messages/memory/inference_memory_fil.hpp"
@@ -402,6 +403,16 @@ PYBIND11_MODULE(messages, _module)
         .value("NONE", ControlMessageType::INFERENCE)
         .value("TRAINING", ControlMessageType::TRAINING);
 
+    py::class_<MessageAttachment, std::shared_ptr<MessageAttachment>>(
+        _module, "MessageAttachment", py::buffer_protocol())
+        .def(py::init<>(&MessageAttachmentInterfaceProxy::init), py::arg("data"))
+        .def_buffer(&MessageAttachmentInterfaceProxy::buffer)
+        .def_property_readonly("is_device", &MessageAttachment::is_device)
+        .def_property_readonly("size", &MessageAttachment::size)
+        .def("__len__", &MessageAttachment::size)
+        .def("to_bytes", &MessageAttachmentInterfaceProxy::to_bytes)
+        .def("to_cupy", &MessageAttachmentInterfaceProxy::to_cupy);
+
     py::class_<ControlMessage, std::shared_ptr<ControlMessage>>(_module, "ControlMessage")
         .def(py::init<>())
         .def(py::init(py::overload_cast<py::dict&>(&ControlMessageProxy::create)))
@@ -411,6 +422,10 @@ PYBIND11_MODULE(messages, _module)
             "config", py::overload_cast<const morpheus::utilities::json_t&>(&ControlMessage::config), py::arg("config"))
         .def("config", py::overload_cast<>(&ControlMessage::config, py::const_))
         .def("copy", &ControlMessageProxy::copy)
+        .def("get_attachment",
+             &ControlMessageProxy::get_attachment,
+             py::arg("name"),
+             py::arg("default_value") = py::none())
         .def("get_metadata",
              &ControlMessageProxy::get_metadata,
              py::arg("key")           = py::none(),
@@ -431,8 +446,10 @@ PYBIND11_MODULE(messages, _module)
              "Set a timestamp for a given key and group.",
              py::arg("key"),
              py::arg("timestamp"))
+        .def("has_attachment", &ControlMessage::has_attachment, py::arg("name"))
         .def("has_metadata", &ControlMessage::has_metadata, py::arg("key"))
         .def("has_task", &ControlMessage::has_task, py::arg("task_type"))
+        .def("list_attachments", &ControlMessage::list_attachments)
         .def("list_metadata", &ControlMessageProxy::list_metadata)
         .def("payload", pybind11::overload_cast<>(&ControlMessage::payload))
         .def("payload", pybind11::overload_cast<const std::shared_ptr<MessageMeta>&>(&ControlMessage::payload))
@@ -442,7 +459,9 @@ PYBIND11_MODULE(messages, _module)
             py::arg("meta"))
         .def("tensors", pybind11::overload_cast<>(&ControlMessage::tensors))
         .def("tensors", pybind11::overload_cast<const std::shared_ptr<TensorMemory>&>(&ControlMessage::tensors))
+        .def("remove_attachment", &ControlMessageProxy::remove_attachment, py::arg("name"))
         .def("remove_task", &ControlMessage::remove_task, py::arg("task_type"))
+        .def("set_attachment", &ControlMessageProxy::set_attachment, py::arg("name"), py::arg("data"))
         .def("set_metadata", &ControlMessage::set_metadata, py::arg("key"), py::arg("value"))
         .def("task_type", pybind11::overload_cast<>(&ControlMessage::task_type))
         .def(
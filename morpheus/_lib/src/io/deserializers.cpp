@@ -23,6 +23,7 @@
 #include "morpheus/utilities/table_util.hpp"  // for get_column_names
 
 #include <cudf/column/column.hpp>
+#include <cudf/io/avro.hpp>
 #include <cudf/io/csv.hpp>
 #include <cudf/io/json.hpp>
 #include <cudf/io/parquet.hpp>
@@ -83,6 +84,12 @@ cudf::io::table_with_metadata load_table_from_file(const std::string& filename,
         table        = cudf::io::read_parquet(options.build());
         break;
     }
+    case FileTypes::AVRO: {
+        // Avro object container files embed their schema, the records are decoded by cuDF on the device
+        auto options = cudf::io::avro_reader_options::builder(cudf::io::source_info{filename});
+        table        = cudf::io::read_avro(options.build());
+        break;
+    }
     case FileTypes::Auto:
     default:
         throw std::logic_error(MORPHEUS_CONCAT_STR("Unsupported filetype: " << file_type));
@@ -90,6 +90,10 @@ std::shared_ptr<ControlMessage> FileDataLoader::load(std::shared_ptr<ControlMess
         {
             current_df = mod_cudf.attr("read_parquet")(path.string());
         }
+        else if (extension == "avro")
+        {
+            current_df = mod_cudf.attr("read_avro")(path.string());
+        }
         else if (extension == "orc")
         {
             current_df = mod_cudf.attr("read_orc")(path.string());
@@ -86,8 +86,12 @@ class OStreamSink : public cudf::io::data_sink
     size_t m_bytest_written{0};
 };
 
-void table_to_csv(
-    const TableInfoData& tbl, std::ostream& out_stream, bool include_header, bool include_index_col, bool flush)
+void table_to_csv(const TableInfoData& tbl,
+                  std::ostream& out_stream,
+                  bool include_header,
+                  bool include_index_col,
+                  bool flush,
+                  const std::string& na_rep)
 {
     auto column_names         = tbl.column_names;
     cudf::size_type start_col = 1;
@@ -105,6 +109,7 @@ void table_to_csv(
     auto destination     = cudf::io::sink_info(&sink);
     auto options_builder = cudf::io::csv_writer_options_builder(destination, tbl_view)
                                .include_header(include_header)
+                               .na_rep(na_rep)
                                .true_value("True"s)
                                .false_value("False"s);
 
@@ -121,13 +126,19 @@ void table_to_csv(
     }
 }
 
-void df_to_csv(const TableInfo& tbl, std::ostream& out_stream, bool include_header, bool include_index_col, bool flush)
+void df_to_csv(const TableInfo& tbl,
+               std::ostream& out_stream,
+               bool include_header,
+               bool include_index_col,
+               bool flush,
+               const std::string& na_rep)
 {
     table_to_csv(TableInfoData{tbl.get_view(), tbl.get_index_names(), tbl.get_column_names()},
                  out_stream,
                  include_header,
                  include_index_col,
-                 flush);
+                 flush,
+                 na_rep);
 }
 
 std::string df_to_csv(const TableInfo& tbl, bool include_header, bool include_index_col)
@@ -276,7 +287,8 @@ void SerializersProxy::write_df_to_file(pybind11::object df,
                      out_file,
                      get_with_default(kwargs, "include_header", true),
                      get_with_default(kwargs, "include_index_col", true),
-                     get_with_default(kwargs, "flush", false));
+                     get_with_default(kwargs, "flush", false),
+                     get_with_default(kwargs, "na_rep", std::string{}));
         break;
     }
     case FileTypes::Auto:
@@ -0,0 +1,984 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/llm/structured_output_node.hpp"
+
+#include "morpheus/llm/llm_context.hpp"
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <mrc/coroutines/task.hpp>  // IWYU pragma: keep
+
+#include <algorithm>  // for find_if, transform
+#include <cctype>     // for isalnum, isdigit, isspace, tolower
+#include <charconv>   // for from_chars
+#include <cmath>      // for isfinite, trunc
+#include <coroutine>
+#include <cstdlib>    // for strtod
+#include <limits>
+#include <set>
+#include <stdexcept>  // for invalid_argument
+#include <utility>    // for move
+
+namespace morpheus::llm {
+
+namespace {
+// Limits the recursion of the parser on deeply nested or adversarial responses
+constexpr int MaxDepth = 64;
+
+// Number of `{` positions tried before a response is considered malformed
+constexpr std::size_t MaxCandidates = 16;
+
+std::string_view trim(std::string_view text)
+{
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front())) != 0)
+    {
+        text.remove_prefix(1);
+    }
+
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back())) != 0)
+    {
+        text.remove_suffix(1);
+    }
+
+    return text;
+}
+
+std::string to_lower(std::string_view text)
+{
+    std::string lower(text);
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+
+    return lower;
+}
+
+// Key used to match response keys to fields, e.g. `**Threat Level**` -> `threat_level`
+std::string normalize_key(std::string_view key)
+{
+    key = trim(key);
+    while (!key.empty() && (key.front() == '"' || key.front() == '\'' || key.front() == '*' || key.front() == '`'))
+    {
+        key.remove_prefix(1);
+    }
+
+    while (!key.empty() && (key.back() == '"' || key.back() == '\'' || key.back() == '*' || key.back() == '`'))
+    {
+        key.remove_suffix(1);
+    }
+
+    auto normalized = to_lower(trim(key));
+    for (auto& c : normalized)
+    {
+        if (c == ' ' || c == '-')
+        {
+            c = '_';
+        }
+    }
+
+    return normalized;
+}
+
+std::optional<std::int64_t> parse_integer(std::string_view text)
+{
+    if (!text.empty() && text.front() == '+')
+    {
+        text.remove_prefix(1);
+    }
+
+    std::int64_t value = 0;
+    auto [ptr, ec]     = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (text.empty() || ec != std::errc{} || ptr != text.data() + text.size())
+    {
+        return std::nullopt;
+    }
+
+    return value;
+}
+
+std::optional<double> parse_double(std::string_view text)
+{
+    if (text.empty())
+    {
+        return std::nullopt;
+    }
+
+    // strtod requires a null terminated string
+    const std::string buffer(text);
+    char* end    = nullptr;
+    double value = std::strtod(buffer.c_str(), &end);
+    if (end != buffer.c_str() + buffer.size() || !std::isfinite(value))
+    {
+        return std::nullopt;
+    }
+
+    return value;
+}
+
+void append_utf8(std::string& out, std::uint32_t code_point)
+{
+    if (code_point < 0x80)
+    {
+        out.push_back(static_cast<char>(code_point));
+    }
+    else if (code_point < 0x800)
+    {
+        out.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+    else if (code_point < 0x10000)
+    {
+        out.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+}
+
+/**
+ * @brief Recursive descent parser accepting a superset of JSON, see `StructuredOutputParser`
+ */
+class LenientJsonReader
+{
+  public:
+    explicit LenientJsonReader(std::string_view text) : m_text(text) {}
+
+    std::optional<nlohmann::json> read_value(int depth = 0)
+    {
+        skip_whitespace();
+        if (at_end() || depth > MaxDepth)
+        {
+            return std::nullopt;
+        }
+
+        const char c = peek();
+        if (c == '{')
+        {
+            return read_object(depth);
+        }
+
+        if (c == '[')
+        {
+            return read_array(depth);
+        }
+
+        if (c == '"' || c == '\'')
+        {
+            auto str = read_string();
+            if (!str.has_value())
+            {
+                return std::nullopt;
+            }
+
+            return nlohmann::json(std::move(*str));
+        }
+
+        if (c == '-' || c == '+' || c == '.' || std::isdigit(static_cast<unsigned char>(c)) != 0)
+        {
+            return read_number();
+        }
+
+        auto identifier = read_identifier();
+        if (identifier == "true" || identifier == "True")
+        {
+            return nlohmann::json(true);
+        }
+
+        if (identifier == "false" || identifier == "False")
+        {
+            return nlohmann::json(false);
+        }
+
+        if (identifier == "null" || identifier == "None" || identifier == "undefined" || identifier == "NaN")
+        {
+            return nlohmann::json(nullptr);
+        }
+
+        return std::nullopt;
+    }
+
+  private:
+    bool at_end() const
+    {
+        return m_pos >= m_text.size();
+    }
+
+    char peek() const
+    {
+        return m_text[m_pos];
+    }
+
+    void skip_whitespace()
+    {
+        while (!at_end())
+        {
+            if (std::isspace(static_cast<unsigned char>(peek())) != 0)
+            {
+                ++m_pos;
+            }
+            else if (m_text.compare(m_pos, 2, "//") == 0)
+            {
+                auto end = m_text.find('\n', m_pos);
+                m_pos    = end == std::string_view::npos ? m_text.size() : end + 1;
+            }
+            else if (m_text.compare(m_pos, 2, "/*") == 0)
+            {
+                auto end = m_text.find("*/", m_pos + 2);
+                m_pos    = end == std::string_view::npos ? m_text.size() : end + 2;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    std::optional<nlohmann::json> read_object(int depth)
+    {
+        ++m_pos;  // '{'
+        auto object = nlohmann::json::object();
+
+        while (true)
+        {
+            skip_whitespace();
+            if (at_end())
+            {
+                return std::nullopt;
+            }
+
+            const char c = peek();
+            if (c == '}')
+            {
+                ++m_pos;
+                return object;
+            }
+
+            // Commas are optional, which also accepts leading and trailing commas
+            if (c == ',')
+            {
+                ++m_pos;
+                continue;
+            }
+
+            std::optional<std::string> key;
+            if (c == '"' || c == '\'')
+            {
+                key = read_string();
+            }
+            else
+            {
+                key = read_identifier();
+            }
+
+            if (!key.has_value() || key->empty())
+            {
+                return std::nullopt;
+            }
+
+            skip_whitespace();
+            if (at_end() || peek() != ':')
+            {
+                return std::nullopt;
+            }
+
+            ++m_pos;
+            auto value = read_value(depth + 1);
+            if (!value.has_value())
+            {
+                return std::nullopt;
+            }
+
+            object[*key] = std::move(*value);
+        }
+    }
+
+    std::optional<nlohmann::json> read_array(int depth)
+    {
+        ++m_pos;  // '['
+        auto array = nlohmann::json::array();
+
+        while (true)
+        {
+            skip_whitespace();
+            if (at_end())
+            {
+                return std::nullopt;
+            }
+
+            const char c = peek();
+            if (c == ']')
+            {
+                ++m_pos;
+                return array;
+            }
+
+            if (c == ',')
+            {
+                ++m_pos;
+                continue;
+            }
+
+            auto value = read_value(depth + 1);
+            if (!value.has_value())
+            {
+                return std::nullopt;
+            }
+
+            array.push_back(std::move(*value));
+        }
+    }
+
+    std::optional<std::string> read_string()
+    {
+        const char quote = m_text[m_pos++];
+        std::string out;
+
+        while (!at_end())
+        {
+            const char c = m_text[m_pos++];
+            if (c == quote)
+            {
+                return out;
+            }
+
+            if (c != '\\')
+            {
+                // Raw control characters such as newlines are kept as is
+                out.push_back(c);
+                continue;
+            }
+
+            if (at_end())
+            {
+                return std::nullopt;
+            }
+
+            const char escaped = m_text[m_pos++];
+            switch (escaped)
+            {
+            case 'n':
+                out.push_back('\n');
+                break;
+            case 't':
+                out.push_back('\t');
+                break;
+            case 'r':
+                out.push_back('\r');
+                break;
+            case 'b':
+                out.push_back('\b');
+                break;
+            case 'f':
+                out.push_back('\f');
+                break;
+            case 'u': {
+                auto code_point = read_hex4();
+                if (!code_point.has_value())
+                {
+                    return std::nullopt;
+                }
+
+                // Combine surrogate pairs, unpaired surrogates are replaced
+                if (*code_point >= 0xD800 && *code_point <= 0xDBFF && m_text.compare(m_pos, 2, "\\u") == 0)
+                {
+                    m_pos += 2;
+                    auto low = read_hex4();
+                    if (!low.has_value())
+                    {
+                        return std::nullopt;
+                    }
+
+                    if (*low >= 0xDC00 && *low <= 0xDFFF)
+                    {
+                        *code_point = 0x10000 + ((*code_point - 0xD800) << 10) + (*low - 0xDC00);
+                    }
+                    else
+                    {
+                        append_utf8(out, 0xFFFD);
+                        *code_point = *low;
+                    }
+                }
+
+                if (*code_point >= 0xD800 && *code_point <= 0xDFFF)
+                {
+                    *code_point = 0xFFFD;
+                }
+
+                append_utf8(out, *code_point);
+                break;
+            }
+            default:
+                // Covers the `"`, `\` and `/` escapes along with invalid escapes such as `\'`
+                out.push_back(escaped);
+                break;
+            }
+        }
+
+        // Unterminated string
+        return std::nullopt;
+    }
+
+    std::optional<std::uint32_t> read_hex4()
+    {
+        if (m_pos + 4 > m_text.size())
+        {
+            return std::nullopt;
+        }
+
+        std::uint32_t value = 0;
+        auto [ptr, ec]      = std::from_chars(m_text.data() + m_pos, m_text.data() + m_pos + 4, value, 16);
+        if (ec != std::errc{} || ptr != m_text.data() + m_pos + 4)
+        {
+            return std::nullopt;
+        }
+
+        m_pos += 4;
+        return value;
+    }
+
+    std::optional<nlohmann::json> read_number()
+    {
+        const auto start = m_pos;
+        bool is_float    = false;
+        while (!at_end())
+        {
+            const char c = peek();
+            if (c == '.' || c == 'e' || c == 'E')
+            {
+                is_float = true;
+            }
+            else if (c != '-' && c != '+' && std::isdigit(static_cast<unsigned char>(c)) == 0)
+            {
+                break;
+            }
+
+            ++m_pos;
+        }
+
+        const auto token = m_text.substr(start, m_pos - start);
+        if (!is_float)
+        {
+            if (auto value = parse_integer(token); value.has_value())
+            {
+                return nlohmann::json(*value);
+            }
+        }
+
+        // Also handles integers too large for int64
+        if (auto value = parse_double(token); value.has_value())
+        {
+            return nlohmann::json(*value);
+        }
+
+        return std::nullopt;
+    }
+
+    std::string read_identifier()
+    {
+        const auto start = m_pos;
+        while (!at_end())
+        {
+            const char c = peek();
+            if (std::isalnum(static_cast<unsigned char>(c)) == 0 && c != '_' && c != '-' && c != '$' && c != '.')
+            {
+                break;
+            }
+
+            ++m_pos;
+        }
+
+        return std::string(m_text.substr(start, m_pos - start));
+    }
+
+    std::string_view m_text;
+    std::size_t m_pos{0};
+};
+
+// Returns the first object found in `text`, `saw_object` is set if any `{` was found
+std::optional<nlohmann::json> find_object_in(std::string_view text, bool& saw_object)
+{
+    auto pos = text.find('{');
+    for (std::size_t attempt = 0; pos != std::string_view::npos && attempt < MaxCandidates; ++attempt)
+    {
+        saw_object = true;
+
+        auto value = StructuredOutputParser::parse_lenient(text.substr(pos));
+        if (value.has_value() && value->is_object())
+        {
+            return value;
+        }
+
+        pos = text.find('{', pos + 1);
+    }
+
+    return std::nullopt;
+}
+
+std::optional<nlohmann::json> find_object(std::string_view response, bool& saw_object)
+{
+    // Prefer the contents of a fenced code block, e.g. ```json ... ```
+    auto fence = response.find("```");
+    if (fence != std::string_view::npos)
+    {
+        auto start = response.find('\n', fence + 3);
+        if (start != std::string_view::npos)
+        {
+            auto end   = response.find("```", start);
+            auto block = response.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start);
+
+            if (auto value = find_object_in(block, saw_object); value.has_value())
+            {
+                return value;
+            }
+        }
+    }
+
+    return find_object_in(response, saw_object);
+}
+
+// Builds an object from `key: value` (or `key = value`) lines whose key matches a field of `schema`
+std::optional<nlohmann::json> parse_key_values(std::string_view response, const std::vector<StructuredField>& schema)
+{
+    auto object = nlohmann::json::object();
+
+    std::size_t line_start = 0;
+    while (line_start < response.size())
+    {
+        auto line_end = response.find('\n', line_start);
+        if (line_end == std::string_view::npos)
+        {
+            line_end = response.size();
+        }
+
+        auto line  = trim(response.substr(line_start, line_end - line_start));
+        line_start = line_end + 1;
+
+        // Strip list bullets
+        while (!line.empty() && (line.front() == '-' || line.front() == '*' || line.front() == '>'))
+        {
+            line = trim(line.substr(1));
+        }
+
+        auto separator = line.find(':');
+        if (separator == std::string_view::npos)
+        {
+            separator = line.find('=');
+        }
+
+        if (separator == std::string_view::npos)
+        {
+            continue;
+        }
+
+        const auto key = normalize_key(line.substr(0, separator));
+        auto field     = std::find_if(schema.begin(), schema.end(), [&key](const StructuredField& f) {
+            return normalize_key(f.name) == key;
+        });
+
+        if (field == schema.end() || object.contains(field->name))
+        {
+            continue;
+        }
+
+        auto value = trim(line.substr(separator + 1));
+        if (!value.empty() && value.back() == ',')
+        {
+            value = trim(value.substr(0, value.size() - 1));
+        }
+
+        if (!value.empty() && (value.front() == '[' || value.front() == '{' || value.front() == '"' ||
+                               value.front() == '\''))
+        {
+            if (auto parsed = StructuredOutputParser::parse_lenient(value); parsed.has_value())
+            {
+                object[field->name] = std::move(*parsed);
+                continue;
+            }
+        }
+
+        object[field->name] = std::string(value);
+    }
+
+    if (object.empty())
+    {
+        return std::nullopt;
+    }
+
+    return object;
+}
+
+const nlohmann::json* find_field(const nlohmann::json& object, const StructuredField& field)
+{
+    if (auto found = object.find(field.name); found != object.end())
+    {
+        return &*found;
+    }
+
+    const auto key = normalize_key(field.name);
+    for (const auto& [name, value] : object.items())
+    {
+        if (normalize_key(name) == key)
+        {
+            return &value;
+        }
+    }
+
+    return nullptr;
+}
+}  // namespace
+
+/****** StructuredOutputParser******************************/
+StructuredOutputParser::StructuredOutputParser(std::vector<StructuredField> schema, bool allow_key_value) :
+  m_schema(std::move(schema)),
+  m_allow_key_value(allow_key_value)
+{
+    if (m_schema.empty())
+    {
+        throw std::invalid_argument("StructuredOutputParser requires at least one field");
+    }
+
+    std::set<std::string> names;
+    for (const auto& field : m_schema)
+    {
+        if (!names.insert(field.name).second)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Duplicate field '" << field.name << "' in schema"));
+        }
+    }
+}
+
+const std::vector<StructuredField>& StructuredOutputParser::schema() const
+{
+    return m_schema;
+}
+
+StructuredOutputParser::Result StructuredOutputParser::parse(std::string_view response) const
+{
+    Result result;
+    result.fields = nlohmann::json::object();
+    for (const auto& field : m_schema)
+    {
+        result.fields[field.name] = nullptr;
+    }
+
+    bool saw_object = false;
+    auto object     = find_object(response, saw_object);
+    if (!object.has_value() && m_allow_key_value)
+    {
+        object = parse_key_values(response, m_schema);
+    }
+
+    if (!object.has_value())
+    {
+        result.error = saw_object ? StructuredOutputError::Malformed : StructuredOutputError::NoStructure;
+        return result;
+    }
+
+    auto set_error = [&result](StructuredOutputError error) {
+        if (result.error == StructuredOutputError::Ok)
+        {
+            result.error = error;
+        }
+    };
+
+    for (const auto& field : m_schema)
+    {
+        const auto* value = find_field(*object, field);
+        if (value == nullptr || value->is_null())
+        {
+            if (field.required)
+            {
+                set_error(StructuredOutputError::MissingField);
+            }
+
+            continue;
+        }
+
+        auto coerced = coerce(*value, field.type);
+        if (!coerced.has_value())
+        {
+            set_error(StructuredOutputError::TypeMismatch);
+            continue;
+        }
+
+        result.fields[field.name] = std::move(*coerced);
+    }
+
+    return result;
+}
+
+nlohmann::json StructuredOutputParser::parse_batch(const nlohmann::json& responses, const std::string& error_name) const
+{
+    auto parse_value = [this](const nlohmann::json& response) {
+        if (response.is_string())
+        {
+            return parse(response.get_ref<const std::string&>());
+        }
+
+        return parse(std::string_view{});
+    };
+
+    if (!responses.is_array())
+    {
+        auto result = parse_value(responses);
+
+        auto output        = std::move(result.fields);
+        output[error_name] = static_cast<std::int32_t>(result.error);
+        return output;
+    }
+
+    auto output = nlohmann::json::object();
+    for (const auto& field : m_schema)
+    {
+        output[field.name] = nlohmann::json::array();
+    }
+
+    auto& errors = output[error_name] = nlohmann::json::array();
+
+    for (const auto& response : responses)
+    {
+        auto result = parse_value(response);
+        for (const auto& field : m_schema)
+        {
+            output[field.name].push_back(std::move(result.fields[field.name]));
+        }
+
+        errors.push_back(static_cast<std::int32_t>(result.error));
+    }
+
+    return output;
+}
+
+std::optional<nlohmann::json> StructuredOutputParser::parse_lenient(std::string_view text)
+{
+    LenientJsonReader reader(text);
+    return reader.read_value();
+}
+
+std::optional<nlohmann::json> StructuredOutputParser::coerce(const nlohmann::json& value, StructuredFieldType type)
+{
+    switch (type)
+    {
+    case StructuredFieldType::String:
+        if (value.is_string())
+        {
+            return value;
+        }
+
+        if (value.is_number() || value.is_boolean())
+        {
+            return nlohmann::json(value.dump());
+        }
+
+        break;
+    case StructuredFieldType::Integer:
+        if (value.is_number_integer())
+        {
+            return value;
+        }
+
+        {
+            std::optional<double> number;
+            if (value.is_string())
+            {
+                const auto text = trim(value.get_ref<const std::string&>());
+                if (auto integer = parse_integer(text); integer.has_value())
+                {
+                    return nlohmann::json(*integer);
+                }
+
+                number = parse_double(text);
+            }
+            else if (value.is_number_float())
+            {
+                number = value.get<double>();
+            }
+
+            // Only accept floats with an integral value, e.g. `3.0`
+            if (number.has_value() && std::isfinite(*number) && std::trunc(*number) == *number &&
+                *number >= static_cast<double>(std::numeric_limits<std::int64_t>::min()) &&
+                *number < static_cast<double>(std::numeric_limits<std::int64_t>::max()))
+            {
+                return nlohmann::json(static_cast<std::int64_t>(*number));
+            }
+        }
+
+        break;
+    case StructuredFieldType::Float:
+        if (value.is_number())
+        {
+            return nlohmann::json(value.get<double>());
+        }
+
+        if (value.is_string())
+        {
+            if (auto number = parse_double(trim(value.get_ref<const std::string&>())); number.has_value())
+            {
+                return nlohmann::json(*number);
+            }
+        }
+
+        break;
+    case StructuredFieldType::Boolean:
+        if (value.is_boolean())
+        {
+            return value;
+        }
+
+        if (value.is_number_integer())
+        {
+            auto integer = value.get<std::int64_t>();
+            if (integer == 0 || integer == 1)
+            {
+                return nlohmann::json(integer == 1);
+            }
+        }
+
+        if (value.is_string())
+        {
+            const auto text = to_lower(trim(value.get_ref<const std::string&>()));
+            if (text == "true" || text == "yes" || text == "y" || text == "1")
+            {
+                return nlohmann::json(true);
+            }
+
+            if (text == "false" || text == "no" || text == "n" || text == "0")
+            {
+                return nlohmann::json(false);
+            }
+        }
+
+        break;
+    case StructuredFieldType::List:
+        if (value.is_array())
+        {
+            return value;
+        }
+
+        if (value.is_string())
+        {
+            // Comma separated values, typically from a `key: value` line
+            auto list = nlohmann::json::array();
+            auto text = std::string_view(value.get_ref<const std::string&>());
+            while (!text.empty())
+            {
+                auto comma = text.find(',');
+                auto item  = trim(text.substr(0, comma));
+                if (!item.empty())
+                {
+                    list.push_back(std::string(item));
+                }
+
+                text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+            }
+
+            return list;
+        }
+
+        if (!value.is_object())
+        {
+            return nlohmann::json::array({value});
+        }
+
+        break;
+    case StructuredFieldType::Object:
+        if (value.is_object())
+        {
+            return value;
+        }
+
+        break;
+    }
+
+    return std::nullopt;
+}
+
+StructuredFieldType StructuredOutputParser::type_from_string(const std::string& type_name)
+{
+    const auto name = to_lower(trim(type_name));
+    if (name == "str" || name == "string")
+    {
+        return StructuredFieldType::String;
+    }
+
+    if (name == "int" || name == "integer")
+    {
+        return StructuredFieldType::Integer;
+    }
+
+    if (name == "float" || name == "number")
+    {
+        return StructuredFieldType::Float;
+    }
+
+    if (name == "bool" || name == "boolean")
+    {
+        return StructuredFieldType::Boolean;
+    }
+
+    if (name == "list" || name == "array")
+    {
+        return StructuredFieldType::List;
+    }
+
+    if (name == "dict" || name == "object")
+    {
+        return StructuredFieldType::Object;
+    }
+
+    throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unknown field type '" << type_name << "'"));
+}
+
+/****** StructuredOutputNode********************************/
+StructuredOutputNode::StructuredOutputNode(StructuredOutputParser parser,
+                                           std::string input_name,
+                                           std::string error_name) :
+  m_parser(std::move(parser)),
+  m_input_name(std::move(input_name)),
+  m_error_name(std::move(error_name))
+{
+    for (const auto& field : m_parser.schema())
+    {
+        if (field.name == m_error_name)
+        {
+            throw std::invalid_argument(
+                MORPHEUS_CONCAT_STR("Field '" << field.name << "' conflicts with the name of the error output"));
+        }
+    }
+}
+
+std::vector<std::string> StructuredOutputNode::get_input_names() const
+{
+    return {m_input_name};
+}
+
+Task<std::shared_ptr<LLMContext>> StructuredOutputNode::execute(std::shared_ptr<LLMContext> context)
+{
+    auto responses = context->get_input();
+
+    context->set_output(m_parser.parse_batch(responses.view_json(), m_error_name));
+
+    co_return context;
+}
+
+}  // namespace morpheus::llm
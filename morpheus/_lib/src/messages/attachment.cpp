@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/messages/attachment.hpp"
+
+#include "morpheus/utilities/cupy_util.hpp"    // for CupyUtil
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <pybind11/buffer_info.h>  // for buffer_info, format_descriptor
+#include <pybind11/pybind11.h>     // for buffer, bytes
+
+#include <cstdint>    // for uint8_t
+#include <stdexcept>  // for runtime_error, invalid_argument
+#include <utility>    // for move
+#include <vector>     // for vector
+
+namespace morpheus {
+
+namespace py = pybind11;
+
+/****** MessageAttachment***********************************/
+MessageAttachment::MessageAttachment(std::string data) : m_host_data(std::move(data)) {}
+
+MessageAttachment::MessageAttachment(TensorObject tensor) : m_tensor(std::move(tensor)) {}
+
+bool MessageAttachment::is_device() const
+{
+    return m_tensor.has_value();
+}
+
+std::size_t MessageAttachment::size() const
+{
+    return m_tensor.has_value() ? m_tensor->bytes() : m_host_data.size();
+}
+
+std::string_view MessageAttachment::host_data() const
+{
+    if (m_tensor.has_value())
+    {
+        throw std::runtime_error("Attachment is held in device memory");
+    }
+
+    return m_host_data;
+}
+
+const TensorObject& MessageAttachment::tensor() const
+{
+    if (!m_tensor.has_value())
+    {
+        throw std::runtime_error("Attachment is held in host memory");
+    }
+
+    return *m_tensor;
+}
+
+/****** MessageAttachmentInterfaceProxy*********************/
+std::shared_ptr<MessageAttachment> MessageAttachmentInterfaceProxy::init(py::object data)
+{
+    if (CupyUtil::is_cupy_array(data))
+    {
+        return std::make_shared<MessageAttachment>(CupyUtil::cupy_to_tensor(std::move(data)));
+    }
+
+    if (!PyObject_CheckBuffer(data.ptr()))
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR(
+            "Attachment data must be a cupy array or support the buffer protocol, got: " << py::str(data.get_type())));
+    }
+
+    auto info = py::buffer(data).request();
+
+    // Only C-contiguous buffers can be copied as a single block
+    py::ssize_t expected_stride = info.itemsize;
+    for (auto dim = info.ndim - 1; dim >= 0; --dim)
+    {
+        if (info.shape[dim] > 1 && info.strides[dim] != expected_stride)
+        {
+            throw std::invalid_argument("Attachment data must be a contiguous buffer");
+        }
+
+        expected_stride *= info.shape[dim];
+    }
+
+    return std::make_shared<MessageAttachment>(
+        std::string(static_cast<const char*>(info.ptr), static_cast<std::size_t>(info.size * info.itemsize)));
+}
+
+py::buffer_info MessageAttachmentInterfaceProxy::buffer(MessageAttachment& self)
+{
+    auto data = self.host_data();
+
+    // The buffer keeps the attachment alive, the data is never copied
+    return py::buffer_info(const_cast<char*>(data.data()),
+                           sizeof(std::uint8_t),
+                           py::format_descriptor<std::uint8_t>::format(),
+                           1,
+                           {static_cast<py::ssize_t>(data.size())},
+                           {static_cast<py::ssize_t>(sizeof(std::uint8_t))},
+                           true);
+}
+
+py::bytes MessageAttachmentInterfaceProxy::to_bytes(MessageAttachment& self)
+{
+    if (!self.is_device())
+    {
+        auto data = self.host_data();
+        return py::bytes(data.data(), data.size());
+    }
+
+    if (!self.tensor().is_compact())
+    {
+        throw std::runtime_error("Only compact device attachments can be copied to host memory");
+    }
+
+    auto host_data = self.tensor().get_host_data<std::uint8_t>();
+    return py::bytes(reinterpret_cast<const char*>(host_data.data()), host_data.size());
+}
+
+py::object MessageAttachmentInterfaceProxy::to_cupy(MessageAttachment& self)
+{
+    return CupyUtil::tensor_to_cupy(self.tensor());
+}
+
+}  // namespace morpheus
@@ -17,7 +17,8 @@
 
 #include "morpheus/messages/control.hpp"
 
-#include "morpheus/messages/meta.hpp"  // for MessageMeta, MessageMetaInterfaceProxy
+#include "morpheus/messages/attachment.hpp"  // for MessageAttachment, MessageAttachmentInterfaceProxy
+#include "morpheus/messages/meta.hpp"        // for MessageMeta, MessageMetaInterfaceProxy
 
 #include <glog/logging.h>       // for COMPACT_GOOGLE_LOG_INFO, LogMessage, VLOG
 #include <nlohmann/json.hpp>    // for basic_json, json_ref, iter_impl, operator<<
@@ -29,8 +30,8 @@
 #include <optional>   // for optional, nullopt
 #include <ostream>    // for basic_ostream, operator<<
 #include <regex>      // for regex_search, regex
-#include <stdexcept>  // for runtime_error
-#include <utility>    // for pair
+#include <stdexcept>  // for runtime_error, invalid_argument
+#include <utility>    // for pair, move
 
 namespace py = pybind11;
 using namespace py::literals;
@@ -55,6 +56,9 @@ ControlMessage::ControlMessage(const ControlMessage& other)
 {
     m_config = other.m_config;
     m_tasks  = other.m_tasks;
+
+    // Attachments are immutable, copies share them rather than their data
+    m_attachments = other.m_attachments;
 }
 
 const morpheus::utilities::json_t& ControlMessage::config() const
@@ -140,6 +144,65 @@ morpheus::utilities::json_t ControlMessage::get_metadata(const std::string& key,
     return {};
 }
 
+void ControlMessage::set_attachment(const std::string& name, std::shared_ptr<const MessageAttachment> attachment)
+{
+    if (attachment == nullptr)
+    {
+        throw std::invalid_argument("Attachment cannot be null: " + name);
+    }
+
+    if (m_attachments.contains(name))
+    {
+        VLOG(20) << "Overwriting attachment " << name;
+    }
+
+    m_attachments[name] = std::move(attachment);
+}
+
+bool ControlMessage::has_attachment(const std::string& name) const
+{
+    return m_attachments.contains(name);
+}
+
+std::shared_ptr<const MessageAttachment> ControlMessage::get_attachment(const std::string& name,
+                                                                        bool fail_on_nonexist) const
+{
+    auto it = m_attachments.find(name);
+    if (it != m_attachments.end())
+    {
+        return it->second;
+    }
+    else if (fail_on_nonexist)
+    {
+        throw std::runtime_error("Attachment does not exist: " + name);
+    }
+    return nullptr;
+}
+
+std::shared_ptr<const MessageAttachment> ControlMessage::remove_attachment(const std::string& name)
+{
+    auto node = m_attachments.extract(name);
+    if (node.empty())
+    {
+        return nullptr;
+    }
+
+    return std::move(node.mapped());
+}
+
+std::vector<std::string> ControlMessage::list_attachments() const
+{
+    std::vector<std::string> name_list{};
+    name_list.reserve(m_attachments.size());
+
+    for (const auto& [name, attachment] : m_attachments)
+    {
+        name_list.push_back(name);
+    }
+
+    return name_list;
+}
+
 morpheus::utilities::json_t ControlMessage::remove_task(const std::string& task_type)
 {
     auto& task_set = m_tasks.at(task_type);
@@ -302,6 +365,42 @@ py::list ControlMessageProxy::list_metadata(ControlMessage& self)
     return py_keys;
 }
 
+void ControlMessageProxy::set_attachment(ControlMessage& self, const std::string& name, py::object data)
+{
+    if (py::isinstance<MessageAttachment>(data))
+    {
+        self.set_attachment(name, data.cast<std::shared_ptr<MessageAttachment>>());
+        return;
+    }
+
+    self.set_attachment(name, MessageAttachmentInterfaceProxy::init(std::move(data)));
+}
+
+py::object ControlMessageProxy::get_attachment(ControlMessage& self,
+                                               const std::string& name,
+                                               py::object default_value)
+{
+    auto attachment = self.get_attachment(name);
+    if (attachment == nullptr)
+    {
+        return default_value;
+    }
+
+    // The binding holds attachments as non-const, they are never modified through it
+    return py::cast(std::const_pointer_cast<MessageAttachment>(attachment));
+}
+
+py::object ControlMessageProxy::remove_attachment(ControlMessage& self, const std::string& name)
+{
+    auto attachment = self.remove_attachment(name);
+    if (attachment == nullptr)
+    {
+        return py::none();
+    }
+
+    return py::cast(std::const_pointer_cast<MessageAttachment>(attachment));
+}
+
 py::dict ControlMessageProxy::filter_timestamp(ControlMessage& self, const std::string& regex_filter)
 {
     auto cpp_map = self.filter_timestamp(regex_filter);
@@ -0,0 +1,274 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/anomaly_scorer.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <pybind11/gil.h>    // for gil_scoped_release
+#include <pybind11/numpy.h>  // for array_t
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>  // IWYU pragma: keep
+
+#include <algorithm>  // for any_of, copy, find, max
+#include <cmath>      // for abs, isnan
+#include <iterator>   // for distance
+#include <limits>     // for numeric_limits
+#include <stdexcept>  // for invalid_argument
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace py = pybind11;
+
+/****** AnomalyScorer***************************************/
+AnomalyScorer::AnomalyScorer(std::vector<std::string> feature_columns,
+                             std::optional<double> threshold,
+                             const std::map<std::string, double>& feature_thresholds) :
+  m_feature_columns(std::move(feature_columns)),
+  m_threshold(threshold),
+  m_feature_thresholds(m_feature_columns.size())
+{
+    for (const auto& [feature, feature_threshold] : feature_thresholds)
+    {
+        auto found = std::find(m_feature_columns.begin(), m_feature_columns.end(), feature);
+        if (found == m_feature_columns.end())
+        {
+            throw std::invalid_argument(
+                MORPHEUS_CONCAT_STR("Threshold given for unknown feature column '" << feature << "'"));
+        }
+
+        m_feature_thresholds[std::distance(m_feature_columns.begin(), found)] = feature_threshold;
+    }
+}
+
+const std::vector<std::string>& AnomalyScorer::feature_columns() const
+{
+    return m_feature_columns;
+}
+
+bool AnomalyScorer::has_thresholds() const
+{
+    return m_threshold.has_value() ||
+           std::any_of(m_feature_thresholds.begin(), m_feature_thresholds.end(), [](const auto& feature_threshold) {
+               return feature_threshold.has_value();
+           });
+}
+
+AnomalyScores AnomalyScorer::score(const std::vector<const double*>& losses,
+                                   std::size_t num_rows,
+                                   const std::vector<LossScaler>& scalers) const
+{
+    const auto num_features = m_feature_columns.size();
+    if (losses.size() != num_features || scalers.size() != num_features)
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Expected losses and scalers for "
+                                                        << num_features << " features, got " << losses.size()
+                                                        << " losses and " << scalers.size() << " scalers"));
+    }
+
+    constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+    AnomalyScores scores;
+    scores.num_rows = num_rows;
+    scores.feature_abs_z.resize(num_rows * num_features);
+    scores.max_abs_z.assign(num_rows, NaN);
+    scores.mean_abs_z.assign(num_rows, NaN);
+
+    std::vector<std::size_t> num_valid(num_rows, 0);
+
+    // Features are scored one at a time, keeping the reads and writes of the inner loop sequential
+    for (std::size_t feature = 0; feature < num_features; ++feature)
+    {
+        const auto* feature_losses = losses[feature];
+        auto* feature_abs_z        = scores.feature_abs_z.data() + feature * num_rows;
+        const auto& scaler         = scalers[feature];
+
+        for (std::size_t row = 0; row < num_rows; ++row)
+        {
+            const double abs_z = std::abs((feature_losses[row] - scaler.center) / scaler.scale);
+            feature_abs_z[row] = abs_z;
+
+            if (std::isnan(abs_z))
+            {
+                continue;
+            }
+
+            if (num_valid[row]++ == 0)
+            {
+                scores.max_abs_z[row]  = abs_z;
+                scores.mean_abs_z[row] = abs_z;
+            }
+            else
+            {
+                scores.max_abs_z[row] = std::max(scores.max_abs_z[row], abs_z);
+                scores.mean_abs_z[row] += abs_z;
+            }
+        }
+    }
+
+    for (std::size_t row = 0; row < num_rows; ++row)
+    {
+        if (num_valid[row] > 0)
+        {
+            scores.mean_abs_z[row] /= static_cast<double>(num_valid[row]);
+        }
+    }
+
+    std::vector<const double*> feature_abs_z(num_features);
+    for (std::size_t feature = 0; feature < num_features; ++feature)
+    {
+        feature_abs_z[feature] = scores.feature_abs_z.data() + feature * num_rows;
+    }
+
+    scores.anomaly_ranges = anomaly_ranges(feature_abs_z, scores.mean_abs_z.data(), num_rows);
+
+    return scores;
+}
+
+std::vector<std::pair<std::size_t, std::size_t>> AnomalyScorer::anomaly_ranges(
+    const std::vector<const double*>& feature_abs_z, const double* mean_abs_z, std::size_t num_rows) const
+{
+    const auto num_features = m_feature_columns.size();
+    if (feature_abs_z.size() != num_features)
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Expected scores for " << num_features << " features, got "
+                                                                               << feature_abs_z.size()));
+    }
+
+    // Without thresholds every row is an anomaly, null (NaN) scores never exceed a threshold
+    std::vector<bool> is_anomaly(num_rows, !has_thresholds());
+
+    for (std::size_t feature = 0; feature < num_features; ++feature)
+    {
+        const auto& feature_threshold = m_feature_thresholds[feature];
+        if (!feature_threshold.has_value())
+        {
+            continue;
+        }
+
+        for (std::size_t row = 0; row < num_rows; ++row)
+        {
+            if (feature_abs_z[feature][row] > *feature_threshold)
+            {
+                is_anomaly[row] = true;
+            }
+        }
+    }
+
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+    for (std::size_t row = 0; row < num_rows; ++row)
+    {
+        if (m_threshold.has_value() && mean_abs_z[row] > *m_threshold)
+        {
+            is_anomaly[row] = true;
+        }
+
+        if (is_anomaly[row])
+        {
+            if (!ranges.empty() && ranges.back().second == row)
+            {
+                ranges.back().second = row + 1;
+            }
+            else
+            {
+                ranges.emplace_back(row, row + 1);
+            }
+        }
+    }
+
+    return ranges;
+}
+
+/****** AnomalyScorerInterfaceProxy*************************/
+py::dict AnomalyScorerInterfaceProxy::score(AnomalyScorer& self,
+                                            py::object losses,
+                                            const std::vector<std::pair<double, double>>& scalers)
+{
+    // Column major so that the losses of each feature are contiguous, copies only when the input isn't already
+    auto losses_array = py::array_t<double, py::array::f_style | py::array::forcecast>::ensure(losses);
+    if (!losses_array || losses_array.ndim() != 2)
+    {
+        throw std::invalid_argument("Expected the losses as a 2-D array with one column per feature");
+    }
+
+    const auto num_rows     = static_cast<std::size_t>(losses_array.shape(0));
+    const auto num_features = static_cast<std::size_t>(losses_array.shape(1));
+
+    std::vector<const double*> feature_losses(num_features);
+    for (std::size_t feature = 0; feature < num_features; ++feature)
+    {
+        feature_losses[feature] = losses_array.data() + feature * num_rows;
+    }
+
+    std::vector<LossScaler> loss_scalers;
+    loss_scalers.reserve(scalers.size());
+    for (const auto& [center, scale] : scalers)
+    {
+        loss_scalers.push_back(LossScaler{center, scale});
+    }
+
+    AnomalyScores scores;
+    {
+        py::gil_scoped_release nogil;
+        scores = self.score(feature_losses, num_rows, loss_scalers);
+    }
+
+    py::array_t<double, py::array::f_style> abs_z({static_cast<py::ssize_t>(num_rows),
+                                                   static_cast<py::ssize_t>(num_features)});
+    std::copy(scores.feature_abs_z.begin(), scores.feature_abs_z.end(), abs_z.mutable_data());
+
+    py::dict result;
+    result["abs_z"]          = std::move(abs_z);
+    result["max_abs_z"]      = py::array_t<double>(static_cast<py::ssize_t>(num_rows), scores.max_abs_z.data());
+    result["mean_abs_z"]     = py::array_t<double>(static_cast<py::ssize_t>(num_rows), scores.mean_abs_z.data());
+    result["anomaly_ranges"] = py::cast(scores.anomaly_ranges);
+
+    return result;
+}
+
+py::list AnomalyScorerInterfaceProxy::anomaly_ranges(AnomalyScorer& self, py::object abs_z, py::object mean_abs_z)
+{
+    // Column major so that the scores of each feature are contiguous, copies only when the input isn't already
+    auto abs_z_array      = py::array_t<double, py::array::f_style | py::array::forcecast>::ensure(abs_z);
+    auto mean_abs_z_array = py::array_t<double, py::array::c_style | py::array::forcecast>::ensure(mean_abs_z);
+    if (!abs_z_array || abs_z_array.ndim() != 2 || !mean_abs_z_array || mean_abs_z_array.ndim() != 1 ||
+        mean_abs_z_array.shape(0) != abs_z_array.shape(0))
+    {
+        throw std::invalid_argument(
+            "Expected the scores as a 2-D array with one column per feature and a 1-D array of their means");
+    }
+
+    const auto num_rows     = static_cast<std::size_t>(abs_z_array.shape(0));
+    const auto num_features = static_cast<std::size_t>(abs_z_array.shape(1));
+
+    std::vector<const double*> feature_abs_z(num_features);
+    for (std::size_t feature = 0; feature < num_features; ++feature)
+    {
+        feature_abs_z[feature] = abs_z_array.data() + feature * num_rows;
+    }
+
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+    {
+        py::gil_scoped_release nogil;
+        ranges = self.anomaly_ranges(feature_abs_z, mean_abs_z_array.data(), num_rows);
+    }
+
+    return py::cast(ranges);
+}
+
+}  // namespace morpheus
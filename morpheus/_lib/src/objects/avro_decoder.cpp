@@ -0,0 +1,616 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/avro_decoder.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>  // for all_of, find
+#include <cstring>    // for memcpy
+#include <limits>     // for numeric_limits
+#include <sstream>    // ostringstream needed by MORPHEUS_CONCAT_STR
+#include <stdexcept>  // for invalid_argument, runtime_error
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace {
+// Nesting of values within a record beyond this depth is rejected, it is only reached by recursive schemas
+constexpr std::size_t MaxDepth = 100;
+
+// Items encoded in zero bytes aren't bounded by the size of the record, the number of them in an array is limited
+constexpr std::uint64_t MaxZeroSizeItems = 1 << 20;
+}  // namespace
+
+// Component private implementations
+// ************ AvroRecordDecoder::Reader ************ //
+class AvroRecordDecoder::Reader
+{
+  public:
+    Reader(std::string_view data) : m_data(data) {}
+
+    // Variable length zig-zag encoded long
+    std::int64_t read_long()
+    {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0;; shift += 7)
+        {
+            if (m_pos >= m_data.size() || shift >= 64)
+            {
+                throw std::runtime_error("Malformed Avro record, truncated or overlong variable length integer");
+            }
+
+            const auto byte = static_cast<std::uint8_t>(m_data[m_pos++]);
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+            if ((byte & 0x80) == 0)
+            {
+                break;
+            }
+        }
+
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    std::int32_t read_int()
+    {
+        auto value = read_long();
+        if (value < std::numeric_limits<std::int32_t>::min() || value > std::numeric_limits<std::int32_t>::max())
+        {
+            throw std::runtime_error("Malformed Avro record, int out of range");
+        }
+
+        return static_cast<std::int32_t>(value);
+    }
+
+    bool read_boolean()
+    {
+        return read_fixed(1)[0] != 0;
+    }
+
+    // Floating point values are little endian, the same as the hosts we run on
+    float read_float()
+    {
+        float value;
+        std::memcpy(&value, read_fixed(sizeof(value)).data(), sizeof(value));
+
+        return value;
+    }
+
+    double read_double()
+    {
+        double value;
+        std::memcpy(&value, read_fixed(sizeof(value)).data(), sizeof(value));
+
+        return value;
+    }
+
+    std::string_view read_bytes()
+    {
+        auto size = read_long();
+        if (size < 0)
+        {
+            throw std::runtime_error("Malformed Avro record, negative length");
+        }
+
+        return read_fixed(static_cast<std::size_t>(size));
+    }
+
+    std::string_view read_fixed(std::size_t size)
+    {
+        if (size > m_data.size() - m_pos)
+        {
+            throw std::runtime_error("Malformed Avro record, truncated value");
+        }
+
+        auto value = m_data.substr(m_pos, size);
+        m_pos += size;
+
+        return value;
+    }
+
+    std::size_t remaining() const
+    {
+        return m_data.size() - m_pos;
+    }
+
+    bool at_end() const
+    {
+        return m_pos == m_data.size();
+    }
+
+  private:
+    std::string_view m_data;
+    std::size_t m_pos{0};
+};
+
+// Component public implementations
+// ************ AvroRecordDecoder ************************* //
+AvroRecordDecoder::AvroRecordDecoder(const std::string& schema)
+{
+    nlohmann::json json;
+    try
+    {
+        json = nlohmann::json::parse(schema);
+    } catch (const nlohmann::json::exception& e)
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Invalid Avro schema: " << e.what()));
+    }
+
+    const auto* root = parse_type(json, "");
+    if (root->kind != Kind::Record)
+    {
+        throw std::invalid_argument("The top level type of an Avro schema must be a record");
+    }
+
+    std::vector<const Type*> records;
+    m_root = compile(root, "", records);
+}
+
+void AvroRecordDecoder::decode(std::string_view record,
+                               DecodedTable& table,
+                               const std::vector<std::size_t>& column_indices) const
+{
+    Reader reader(record);
+    decode_node(m_root, reader, table, column_indices);
+
+    if (!reader.at_end())
+    {
+        throw std::runtime_error("Malformed Avro record, trailing bytes after the record");
+    }
+}
+
+const AvroRecordDecoder::Type* AvroRecordDecoder::parse_type(const nlohmann::json& schema,
+                                                             const std::string& enclosing_namespace)
+{
+    if (schema.is_string())
+    {
+        const auto name = schema.get<std::string>();
+
+        auto primitive = primitive_kind(name);
+        if (primitive.has_value())
+        {
+            auto& type = m_types.emplace_back();
+            type.kind  = *primitive;
+            return &type;
+        }
+
+        // A reference to a named type, relative to the enclosing namespace unless it is qualified
+        if (name.find('.') == std::string::npos && !enclosing_namespace.empty())
+        {
+            auto found = m_named_types.find(enclosing_namespace + "." + name);
+            if (found != m_named_types.end())
+            {
+                return found->second;
+            }
+        }
+
+        auto found = m_named_types.find(name);
+        if (found == m_named_types.end())
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unknown Avro type '" << name << "'"));
+        }
+
+        return found->second;
+    }
+
+    if (schema.is_array())
+    {
+        auto& type = m_types.emplace_back();
+        type.kind  = Kind::Union;
+        for (const auto& branch : schema)
+        {
+            type.children.push_back(parse_type(branch, enclosing_namespace));
+        }
+
+        return &type;
+    }
+
+    if (!schema.is_object() || !schema.contains("type"))
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Invalid Avro type: " << schema.dump()));
+    }
+
+    const auto& type_json = schema["type"];
+    if (!type_json.is_string())
+    {
+        return parse_type(type_json, enclosing_namespace);
+    }
+
+    const auto type_name = type_json.get<std::string>();
+    if (type_name == "record" || type_name == "error" || type_name == "enum" || type_name == "fixed")
+    {
+        auto name       = schema.at("name").get<std::string>();
+        auto name_space = schema.contains("namespace") ? schema["namespace"].get<std::string>() : enclosing_namespace;
+
+        auto last_dot = name.rfind('.');
+        if (last_dot != std::string::npos)
+        {
+            name_space = name.substr(0, last_dot);
+        }
+        else if (!name_space.empty())
+        {
+            name = name_space + "." + name;
+        }
+
+        auto& type = m_types.emplace_back();
+        type.name  = name;
+
+        // Named before the fields are parsed, so that the fields can refer to the record
+        m_named_types[name] = &type;
+
+        if (type_name == "enum")
+        {
+            type.kind    = Kind::Enum;
+            type.symbols = schema.at("symbols").get<std::vector<std::string>>();
+        }
+        else if (type_name == "fixed")
+        {
+            type.kind = Kind::Fixed;
+            type.size = schema.at("size").get<std::size_t>();
+        }
+        else
+        {
+            type.kind = Kind::Record;
+            for (const auto& field : schema.at("fields"))
+            {
+                type.field_names.push_back(field.at("name").get<std::string>());
+                type.children.push_back(parse_type(field.at("type"), name_space));
+            }
+        }
+
+        if (schema.contains("logicalType"))
+        {
+            type.logical_type = schema["logicalType"].get<std::string>();
+        }
+
+        return &type;
+    }
+
+    if (type_name == "array" || type_name == "map")
+    {
+        const auto* items = parse_type(schema.at(type_name == "array" ? "items" : "values"), enclosing_namespace);
+
+        auto& type = m_types.emplace_back();
+        type.kind  = type_name == "array" ? Kind::Array : Kind::Map;
+        type.children.push_back(items);
+
+        return &type;
+    }
+
+    auto primitive = primitive_kind(type_name);
+    if (!primitive.has_value())
+    {
+        return parse_type(type_json, enclosing_namespace);
+    }
+
+    auto& type = m_types.emplace_back();
+    type.kind  = *primitive;
+    if (schema.contains("logicalType"))
+    {
+        type.logical_type = schema["logicalType"].get<std::string>();
+    }
+
+    return &type;
+}
+
+std::optional<AvroRecordDecoder::Kind> AvroRecordDecoder::primitive_kind(const std::string& name)
+{
+    static const std::map<std::string, Kind> PrimitiveKinds = {{"null", Kind::Null},
+                                                               {"boolean", Kind::Boolean},
+                                                               {"int", Kind::Int},
+                                                               {"long", Kind::Long},
+                                                               {"float", Kind::Float},
+                                                               {"double", Kind::Double},
+                                                               {"bytes", Kind::Bytes},
+                                                               {"string", Kind::String}};
+
+    auto found = PrimitiveKinds.find(name);
+    if (found == PrimitiveKinds.end())
+    {
+        return std::nullopt;
+    }
+
+    return found->second;
+}
+
+AvroRecordDecoder::Node AvroRecordDecoder::compile(const Type* type,
+                                                   const std::string& name,
+                                                   std::vector<const Type*>& records)
+{
+    Node node;
+    node.type = type;
+
+    if (type->kind == Kind::Null)
+    {
+        node.is_leaf = false;
+        return node;
+    }
+
+    // Records are flattened unless they are recursive
+    if (type->kind == Kind::Record && std::find(records.begin(), records.end(), type) == records.end())
+    {
+        node.is_leaf = false;
+
+        records.push_back(type);
+        for (std::size_t i = 0; i < type->children.size(); ++i)
+        {
+            const auto field_name = name.empty() ? type->field_names[i] : name + "." + type->field_names[i];
+            node.children.push_back(compile(type->children[i], field_name, records));
+        }
+        records.pop_back();
+
+        return node;
+    }
+
+    if (type->kind == Kind::Union && type->children.size() == 2 &&
+        (type->children[0]->kind == Kind::Null) != (type->children[1]->kind == Kind::Null))
+    {
+        node.is_leaf     = false;
+        node.null_branch = type->children[0]->kind == Kind::Null ? 0 : 1;
+        node.children.push_back(compile(type->children[1 - node.null_branch], name, records));
+
+        return node;
+    }
+
+    auto column_type = cudf::type_id::STRING;
+    switch (type->kind)
+    {
+    case Kind::Boolean:
+        column_type = cudf::type_id::BOOL8;
+        break;
+    case Kind::Int:
+        column_type = type->logical_type == "date" ? cudf::type_id::TIMESTAMP_DAYS : cudf::type_id::INT32;
+        break;
+    case Kind::Long:
+        if (type->logical_type == "timestamp-millis")
+        {
+            column_type = cudf::type_id::TIMESTAMP_MILLISECONDS;
+        }
+        else if (type->logical_type == "timestamp-micros")
+        {
+            column_type = cudf::type_id::TIMESTAMP_MICROSECONDS;
+        }
+        else
+        {
+            column_type = cudf::type_id::INT64;
+        }
+        break;
+    case Kind::Float:
+        column_type = cudf::type_id::FLOAT32;
+        break;
+    case Kind::Double:
+        column_type = cudf::type_id::FLOAT64;
+        break;
+    default:
+        break;
+    }
+
+    m_columns.push_back({name, column_type});
+    node.column = m_columns.size() - 1;
+
+    return node;
+}
+
+void AvroRecordDecoder::decode_node(const Node& node,
+                                    Reader& reader,
+                                    DecodedTable& table,
+                                    const std::vector<std::size_t>& columns) const
+{
+    if (node.is_leaf)
+    {
+        decode_leaf(node, reader, table, columns[node.column]);
+        return;
+    }
+
+    if (node.type->kind == Kind::Union)
+    {
+        auto branch = reader.read_long();
+        if (branch < 0 || static_cast<std::size_t>(branch) >= node.type->children.size())
+        {
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Malformed Avro record, invalid union branch " << branch));
+        }
+
+        if (static_cast<std::size_t>(branch) != node.null_branch)
+        {
+            decode_node(node.children.front(), reader, table, columns);
+        }
+
+        return;
+    }
+
+    for (const auto& child : node.children)
+    {
+        decode_node(child, reader, table, columns);
+    }
+}
+
+void AvroRecordDecoder::decode_leaf(const Node& node, Reader& reader, DecodedTable& table, std::size_t column) const
+{
+    switch (node.type->kind)
+    {
+    case Kind::Boolean:
+        table.set_int(column, reader.read_boolean() ? 1 : 0);
+        break;
+    case Kind::Int:
+        table.set_int(column, reader.read_int());
+        break;
+    case Kind::Long:
+        table.set_int(column, reader.read_long());
+        break;
+    case Kind::Float:
+        table.set_float(column, reader.read_float());
+        break;
+    case Kind::Double:
+        table.set_float(column, reader.read_double());
+        break;
+    case Kind::Bytes:
+    case Kind::String:
+        table.set_string(column, reader.read_bytes());
+        break;
+    case Kind::Fixed:
+        table.set_string(column, reader.read_fixed(node.type->size));
+        break;
+    case Kind::Enum: {
+        auto symbol = reader.read_int();
+        if (symbol < 0 || static_cast<std::size_t>(symbol) >= node.type->symbols.size())
+        {
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Malformed Avro record, invalid enum symbol " << symbol));
+        }
+
+        table.set_string(column, node.type->symbols[symbol]);
+        break;
+    }
+    default:
+        table.set_string(column,
+                         to_json(node.type, reader).dump(-1, ' ', false, nlohmann::json::error_handler_t::replace));
+    }
+}
+
+nlohmann::json AvroRecordDecoder::to_json(const Type* type, Reader& reader, std::size_t depth) const
+{
+    if (depth > MaxDepth)
+    {
+        throw std::runtime_error("Malformed Avro record, values are nested too deeply");
+    }
+
+    switch (type->kind)
+    {
+    case Kind::Null:
+        return nullptr;
+    case Kind::Boolean:
+        return reader.read_boolean();
+    case Kind::Int:
+        return reader.read_int();
+    case Kind::Long:
+        return reader.read_long();
+    case Kind::Float:
+        return reader.read_float();
+    case Kind::Double:
+        return reader.read_double();
+    case Kind::Bytes:
+    case Kind::String:
+        return std::string(reader.read_bytes());
+    case Kind::Fixed:
+        return std::string(reader.read_fixed(type->size));
+    case Kind::Enum: {
+        auto symbol = reader.read_int();
+        if (symbol < 0 || static_cast<std::size_t>(symbol) >= type->symbols.size())
+        {
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Malformed Avro record, invalid enum symbol " << symbol));
+        }
+
+        return type->symbols[symbol];
+    }
+    case Kind::Record: {
+        auto value = nlohmann::json::object();
+        for (std::size_t i = 0; i < type->children.size(); ++i)
+        {
+            value[type->field_names[i]] = to_json(type->children[i], reader, depth + 1);
+        }
+
+        return value;
+    }
+    case Kind::Union: {
+        auto branch = reader.read_long();
+        if (branch < 0 || static_cast<std::size_t>(branch) >= type->children.size())
+        {
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Malformed Avro record, invalid union branch " << branch));
+        }
+
+        return to_json(type->children[branch], reader, depth + 1);
+    }
+    case Kind::Array:
+    case Kind::Map: {
+        auto value = type->kind == Kind::Array ? nlohmann::json::array() : nlohmann::json::object();
+
+        // Map items always hold a key
+        const bool zero_size_items = type->kind == Kind::Array && is_zero_size(type->children.front());
+        std::uint64_t num_items    = 0;
+
+        // Items are written in blocks, a negative count is followed by the size of the block in bytes
+        for (auto count = reader.read_long(); count != 0; count = reader.read_long())
+        {
+            // Negated as unsigned, which is defined for the lowest count too
+            auto block_items = static_cast<std::uint64_t>(count);
+            if (count < 0)
+            {
+                block_items = -block_items;
+                reader.read_long();
+            }
+
+            if (zero_size_items)
+            {
+                num_items += block_items;
+                if (num_items > MaxZeroSizeItems)
+                {
+                    throw std::runtime_error(MORPHEUS_CONCAT_STR(
+                        "Malformed Avro record, array holds more than " << MaxZeroSizeItems << " zero size items"));
+                }
+            }
+            else if (block_items > reader.remaining())
+            {
+                throw std::runtime_error("Malformed Avro record, more items than the remaining bytes");
+            }
+
+            for (std::uint64_t i = 0; i < block_items; ++i)
+            {
+                if (type->kind == Kind::Array)
+                {
+                    value.push_back(to_json(type->children.front(), reader, depth + 1));
+                }
+                else
+                {
+                    auto key   = std::string(reader.read_bytes());
+                    value[key] = to_json(type->children.front(), reader, depth + 1);
+                }
+            }
+        }
+
+        return value;
+    }
+    }
+
+    throw std::logic_error("Unknown Avro type kind");
+}
+
+bool AvroRecordDecoder::is_zero_size(const Type* type, std::size_t depth)
+{
+    switch (type->kind)
+    {
+    case Kind::Null:
+        return true;
+    case Kind::Fixed:
+        return type->size == 0;
+    case Kind::Record:
+        // A record containing itself other than through a union, array or map can't be decoded, see `to_json`
+        if (depth > MaxDepth)
+        {
+            return false;
+        }
+
+        return std::all_of(type->children.begin(), type->children.end(), [depth](const Type* child) {
+            return is_zero_size(child, depth + 1);
+        });
+    default:
+        return false;
+    }
+}
+
+}  // namespace morpheus
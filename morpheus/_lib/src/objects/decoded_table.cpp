@@ -0,0 +1,419 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/decoded_table.hpp"
+
+#include "morpheus/utilities/column_util.hpp"  // for ColumnUtil
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <cudf/column/column.hpp>  // for column
+#include <cudf/table/table.hpp>    // for table
+
+#include <cstdint>    // for int8_t, int16_t, int32_t, uint32_t, uint64_t
+#include <cstring>    // for memcpy
+#include <memory>     // for make_unique, unique_ptr
+#include <sstream>    // ostringstream needed by MORPHEUS_CONCAT_STR
+#include <stdexcept>  // for invalid_argument, logic_error
+#include <string>     // for to_string
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace {
+bool is_string_type(cudf::type_id type)
+{
+    return type == cudf::type_id::STRING;
+}
+
+bool is_floating_type(cudf::type_id type)
+{
+    return type == cudf::type_id::FLOAT32 || type == cudf::type_id::FLOAT64;
+}
+
+// Narrow the held values to the storage type `T` of the column
+template <typename T, typename U>
+std::unique_ptr<cudf::column> make_numeric_column(const std::vector<U>& values,
+                                                  cudf::type_id type,
+                                                  const std::vector<bool>& valid)
+{
+    return ColumnUtil::make_numeric_column(std::vector<T>(values.begin(), values.end()), type, valid);
+}
+}  // namespace
+
+// Component public implementations
+// ************ DecodedTable ************************* //
+std::size_t DecodedTable::Column::size() const
+{
+    return valid.size();
+}
+
+std::size_t DecodedTable::get_column(const std::string& name, cudf::type_id type)
+{
+    auto found = m_column_index.find(name);
+    if (found != m_column_index.end())
+    {
+        const auto& spec = m_columns[found->second].spec;
+        if (spec.type != type)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Decoded column '"
+                                                            << name << "' has conflicting types "
+                                                            << static_cast<int>(spec.type) << " and "
+                                                            << static_cast<int>(type)));
+        }
+
+        return found->second;
+    }
+
+    // The rows already written are null
+    Column column;
+    column.spec = {name, type};
+    fill_nulls(column, m_num_rows);
+
+    m_columns.push_back(std::move(column));
+    m_column_index.emplace(name, m_columns.size() - 1);
+
+    return m_columns.size() - 1;
+}
+
+std::vector<std::size_t> DecodedTable::get_columns(const std::vector<DecodedColumnSpec>& specs)
+{
+    std::vector<std::size_t> columns;
+    columns.reserve(specs.size());
+
+    for (const auto& spec : specs)
+    {
+        columns.push_back(get_column(spec.name, spec.type));
+    }
+
+    return columns;
+}
+
+void DecodedTable::begin_row()
+{
+    if (m_in_row)
+    {
+        throw std::logic_error("The previous row of the decoded table wasn't completed");
+    }
+
+    m_in_row = true;
+}
+
+void DecodedTable::end_row()
+{
+    if (!m_in_row)
+    {
+        throw std::logic_error("No row of the decoded table was started");
+    }
+
+    for (auto& column : m_columns)
+    {
+        fill_nulls(column, m_num_rows + 1);
+    }
+
+    ++m_num_rows;
+    m_in_row = false;
+}
+
+void DecodedTable::abort_row()
+{
+    for (auto& column : m_columns)
+    {
+        truncate(column, m_num_rows);
+    }
+
+    m_in_row = false;
+}
+
+void DecodedTable::set_int(std::size_t column, std::int64_t value)
+{
+    auto& col = prepare(column);
+    if (is_string_type(col.spec.type))
+    {
+        auto text = std::to_string(value);
+        col.chars.append(text);
+        col.offsets.push_back(static_cast<cudf::size_type>(col.chars.size()));
+    }
+    else if (is_floating_type(col.spec.type))
+    {
+        col.floats.push_back(static_cast<double>(value));
+    }
+    else
+    {
+        col.ints.push_back(value);
+    }
+
+    col.valid.push_back(true);
+}
+
+void DecodedTable::set_uint(std::size_t column, std::uint64_t value)
+{
+    if (m_columns[column].spec.type == cudf::type_id::UINT64)
+    {
+        // Held as the bits of the value
+        std::int64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        auto& col = prepare(column);
+        col.ints.push_back(bits);
+        col.valid.push_back(true);
+        return;
+    }
+
+    set_int(column, static_cast<std::int64_t>(value));
+}
+
+void DecodedTable::set_float(std::size_t column, double value)
+{
+    auto& col = prepare(column);
+    if (!is_floating_type(col.spec.type))
+    {
+        throw std::logic_error(MORPHEUS_CONCAT_STR("Decoded column '" << col.spec.name << "' isn't floating point"));
+    }
+
+    col.floats.push_back(value);
+    col.valid.push_back(true);
+}
+
+void DecodedTable::set_string(std::size_t column, std::string_view value)
+{
+    auto& col = prepare(column);
+    if (!is_string_type(col.spec.type))
+    {
+        throw std::logic_error(MORPHEUS_CONCAT_STR("Decoded column '" << col.spec.name << "' isn't a string column"));
+    }
+
+    col.chars.append(value);
+    col.offsets.push_back(static_cast<cudf::size_type>(col.chars.size()));
+    col.valid.push_back(true);
+}
+
+void DecodedTable::append(const DecodedTable& other)
+{
+    if (m_in_row || other.m_in_row)
+    {
+        throw std::logic_error("Decoded tables can only be appended between rows");
+    }
+
+    for (const auto& other_col : other.m_columns)
+    {
+        auto& col = m_columns[get_column(other_col.spec.name, other_col.spec.type)];
+
+        col.ints.insert(col.ints.end(), other_col.ints.begin(), other_col.ints.end());
+        col.floats.insert(col.floats.end(), other_col.floats.begin(), other_col.floats.end());
+        col.valid.insert(col.valid.end(), other_col.valid.begin(), other_col.valid.end());
+
+        const auto base = col.offsets.back();
+        col.chars.append(other_col.chars);
+        for (std::size_t row = 1; row < other_col.offsets.size(); ++row)
+        {
+            col.offsets.push_back(base + other_col.offsets[row]);
+        }
+    }
+
+    m_num_rows += other.m_num_rows;
+    for (auto& col : m_columns)
+    {
+        fill_nulls(col, m_num_rows);
+    }
+}
+
+bool DecodedTable::is_set(std::size_t column) const
+{
+    return m_in_row && m_columns[column].size() > m_num_rows;
+}
+
+std::size_t DecodedTable::num_rows() const
+{
+    return m_num_rows;
+}
+
+std::size_t DecodedTable::num_columns() const
+{
+    return m_columns.size();
+}
+
+const DecodedColumnSpec& DecodedTable::column_spec(std::size_t column) const
+{
+    return m_columns[column].spec;
+}
+
+std::optional<std::int64_t> DecodedTable::get_int(std::size_t column, std::size_t row) const
+{
+    const auto& col = m_columns[column];
+    if (!col.valid[row])
+    {
+        return std::nullopt;
+    }
+
+    return col.ints[row];
+}
+
+std::optional<std::uint64_t> DecodedTable::get_uint(std::size_t column, std::size_t row) const
+{
+    auto value = get_int(column, row);
+    if (!value.has_value())
+    {
+        return std::nullopt;
+    }
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &*value, sizeof(bits));
+
+    return bits;
+}
+
+std::optional<double> DecodedTable::get_float(std::size_t column, std::size_t row) const
+{
+    const auto& col = m_columns[column];
+    if (!col.valid[row])
+    {
+        return std::nullopt;
+    }
+
+    return col.floats[row];
+}
+
+std::optional<std::string_view> DecodedTable::get_string(std::size_t column, std::size_t row) const
+{
+    const auto& col = m_columns[column];
+    if (!col.valid[row])
+    {
+        return std::nullopt;
+    }
+
+    return std::string_view(col.chars).substr(col.offsets[row], col.offsets[row + 1] - col.offsets[row]);
+}
+
+cudf::io::table_with_metadata DecodedTable::to_table() const
+{
+    if (m_in_row)
+    {
+        throw std::logic_error("The last row of the decoded table wasn't completed");
+    }
+
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    cudf::io::table_with_metadata table;
+
+    for (const auto& col : m_columns)
+    {
+        const auto type = col.spec.type;
+        switch (type)
+        {
+        case cudf::type_id::STRING:
+            columns.push_back(ColumnUtil::make_strings_column(col.chars, col.offsets, col.valid));
+            break;
+        case cudf::type_id::FLOAT32:
+            columns.push_back(make_numeric_column<float>(col.floats, type, col.valid));
+            break;
+        case cudf::type_id::FLOAT64:
+            columns.push_back(make_numeric_column<double>(col.floats, type, col.valid));
+            break;
+        case cudf::type_id::BOOL8:
+        case cudf::type_id::INT8:
+            columns.push_back(make_numeric_column<std::int8_t>(col.ints, type, col.valid));
+            break;
+        case cudf::type_id::INT16:
+            columns.push_back(make_numeric_column<std::int16_t>(col.ints, type, col.valid));
+            break;
+        case cudf::type_id::INT32:
+        case cudf::type_id::TIMESTAMP_DAYS:
+            columns.push_back(make_numeric_column<std::int32_t>(col.ints, type, col.valid));
+            break;
+        case cudf::type_id::UINT32:
+            columns.push_back(make_numeric_column<std::uint32_t>(col.ints, type, col.valid));
+            break;
+        case cudf::type_id::UINT64:
+            columns.push_back(make_numeric_column<std::uint64_t>(col.ints, type, col.valid));
+            break;
+        case cudf::type_id::INT64:
+        case cudf::type_id::TIMESTAMP_SECONDS:
+        case cudf::type_id::TIMESTAMP_MILLISECONDS:
+        case cudf::type_id::TIMESTAMP_MICROSECONDS:
+        case cudf::type_id::TIMESTAMP_NANOSECONDS:
+            columns.push_back(make_numeric_column<std::int64_t>(col.ints, type, col.valid));
+            break;
+        default:
+            throw std::logic_error(MORPHEUS_CONCAT_STR("Unsupported type of decoded column '" << col.spec.name << "'"));
+        }
+
+        table.metadata.schema_info.emplace_back(col.spec.name);
+    }
+
+    table.tbl = std::make_unique<cudf::table>(std::move(columns));
+
+    return table;
+}
+
+void DecodedTable::fill_nulls(Column& column, std::size_t num_rows)
+{
+    while (column.size() < num_rows)
+    {
+        if (is_string_type(column.spec.type))
+        {
+            column.offsets.push_back(column.offsets.back());
+        }
+        else if (is_floating_type(column.spec.type))
+        {
+            column.floats.push_back(0.0);
+        }
+        else
+        {
+            column.ints.push_back(0);
+        }
+
+        column.valid.push_back(false);
+    }
+}
+
+DecodedTable::Column& DecodedTable::prepare(std::size_t column)
+{
+    if (!m_in_row)
+    {
+        throw std::logic_error("No row of the decoded table was started");
+    }
+
+    // A value written twice in a row replaces the first one
+    auto& col = m_columns[column];
+    truncate(col, m_num_rows);
+
+    return col;
+}
+
+void DecodedTable::truncate(Column& column, std::size_t num_rows)
+{
+    if (column.size() <= num_rows)
+    {
+        return;
+    }
+
+    column.valid.resize(num_rows);
+    if (is_string_type(column.spec.type))
+    {
+        column.offsets.resize(num_rows + 1);
+        column.chars.resize(column.offsets.back());
+    }
+    else if (is_floating_type(column.spec.type))
+    {
+        column.floats.resize(num_rows);
+    }
+    else
+    {
+        column.ints.resize(num_rows);
+    }
+}
+
+}  // namespace morpheus
@@ -0,0 +1,884 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/document_converter.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <zlib.h>  // for inflate, z_stream
+
+#include <algorithm>  // for any_of, equal, find, find_if, min, replace, sort, transform, unique
+#include <cctype>     // for isalnum, isxdigit, tolower
+#include <cstddef>    // for ptrdiff_t, size_t
+#include <cstdint>    // for uint16_t, uint32_t
+#include <iterator>   // for distance, prev
+#include <stdexcept>  // for invalid_argument, runtime_error
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace {
+constexpr std::string_view Utf8Bom = "\xEF\xBB\xBF";
+
+// Largest ratio of the inflated to the compressed size which deflate can produce
+constexpr std::size_t MaxDeflateRatio = 1032;
+
+// Elements whose content is never displayed
+const std::vector<std::string_view> HiddenHtmlElements = {"script", "style", "noscript", "template"};
+
+// Elements holding the navigation and other repeated parts of a web page rather than its content
+const std::vector<std::string_view> BoilerplateHtmlElements = {
+    "aside", "dialog", "footer", "form", "header", "menu", "nav"};
+
+// Elements which start a new line of text
+const std::vector<std::string_view> BlockHtmlElements = {
+    "address", "article", "aside", "blockquote", "br", "dd", "div", "dl", "dt", "fieldset", "figure",
+    "footer", "form", "h1", "h2", "h3", "h4", "h5", "h6", "header", "hr", "li",
+    "main", "nav", "ol", "p", "pre", "section", "table", "title", "tr", "ul"};
+
+const std::vector<std::pair<std::string_view, std::string_view>> NamedEntities = {{"amp", "&"},
+                                                                                   {"lt", "<"},
+                                                                                   {"gt", ">"},
+                                                                                   {"quot", "\""},
+                                                                                   {"apos", "'"},
+                                                                                   {"nbsp", "\xC2\xA0"},
+                                                                                   {"copy", "\xC2\xA9"},
+                                                                                   {"reg", "\xC2\xAE"},
+                                                                                   {"deg", "\xC2\xB0"},
+                                                                                   {"middot", "\xC2\xB7"},
+                                                                                   {"ndash", "\xE2\x80\x93"},
+                                                                                   {"mdash", "\xE2\x80\x94"},
+                                                                                   {"lsquo", "\xE2\x80\x98"},
+                                                                                   {"rsquo", "\xE2\x80\x99"},
+                                                                                   {"ldquo", "\xE2\x80\x9C"},
+                                                                                   {"rdquo", "\xE2\x80\x9D"},
+                                                                                   {"bull", "\xE2\x80\xA2"},
+                                                                                   {"hellip", "\xE2\x80\xA6"},
+                                                                                   {"euro", "\xE2\x82\xAC"},
+                                                                                   {"trade", "\xE2\x84\xA2"}};
+
+bool iequals(std::string_view lhs, std::string_view rhs)
+{
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](char a, char b) {
+               return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+           });
+}
+
+std::string to_lower(std::string_view text)
+{
+    std::string lower(text);
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) {
+        return std::tolower(c);
+    });
+
+    return lower;
+}
+
+void append_utf8(std::uint32_t code_point, std::string& out)
+{
+    if (code_point == 0 || code_point > 0x10FFFF || (code_point >= 0xD800 && code_point <= 0xDFFF))
+    {
+        code_point = 0xFFFD;
+    }
+
+    if (code_point < 0x80)
+    {
+        out += static_cast<char>(code_point);
+    }
+    else if (code_point < 0x800)
+    {
+        out += static_cast<char>(0xC0 | (code_point >> 6));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    else if (code_point < 0x10000)
+    {
+        out += static_cast<char>(0xE0 | (code_point >> 12));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    else
+    {
+        out += static_cast<char>(0xF0 | (code_point >> 18));
+        out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+}
+
+/**
+ * @brief Append `text` to `out` decoding character references, both numeric and the common named references.
+ * Unknown references are appended unchanged.
+ */
+void append_decoded(std::string_view text, std::string& out)
+{
+    std::size_t pos = 0;
+    while (pos < text.size())
+    {
+        auto amp = text.find('&', pos);
+        out.append(text.substr(pos, amp - pos));
+        if (amp == std::string_view::npos)
+        {
+            return;
+        }
+
+        pos      = amp + 1;
+        auto end = text.find(';', pos);
+        if (end == std::string_view::npos || end - pos > 10 || end == pos)
+        {
+            out += '&';
+            continue;
+        }
+
+        auto name = text.substr(pos, end - pos);
+        if (name.front() == '#')
+        {
+            const bool hex   = name.size() > 1 && (name[1] == 'x' || name[1] == 'X');
+            auto digits      = name.substr(hex ? 2 : 1);
+            std::uint32_t cp = 0;
+            bool valid       = !digits.empty();
+            for (char c : digits)
+            {
+                int digit = -1;
+                if (c >= '0' && c <= '9')
+                {
+                    digit = c - '0';
+                }
+                else if (hex && std::isxdigit(static_cast<unsigned char>(c)))
+                {
+                    digit = std::tolower(static_cast<unsigned char>(c)) - 'a' + 10;
+                }
+
+                if (digit < 0 || cp > 0x10FFFF)
+                {
+                    valid = false;
+                    break;
+                }
+
+                cp = cp * (hex ? 16 : 10) + static_cast<std::uint32_t>(digit);
+            }
+
+            if (valid)
+            {
+                append_utf8(cp, out);
+                pos = end + 1;
+                continue;
+            }
+        }
+        else
+        {
+            auto found = std::find_if(NamedEntities.begin(), NamedEntities.end(), [&name](const auto& entity) {
+                return entity.first == name;
+            });
+
+            if (found != NamedEntities.end())
+            {
+                out.append(found->second);
+                pos = end + 1;
+                continue;
+            }
+        }
+
+        out += '&';
+    }
+}
+
+// Position of the `>` closing the tag starting at `start`, skipping over quoted attribute values
+std::size_t find_tag_end(std::string_view data, std::size_t start)
+{
+    char quote = 0;
+    for (auto pos = start; pos < data.size(); ++pos)
+    {
+        const char c = data[pos];
+        if (quote != 0)
+        {
+            quote = c == quote ? 0 : quote;
+        }
+        else if (c == '"' || c == '\'')
+        {
+            quote = c;
+        }
+        else if (c == '>')
+        {
+            return pos;
+        }
+    }
+
+    return std::string_view::npos;
+}
+
+/**
+ * @brief A tag of a markup document
+ */
+struct Tag
+{
+    std::string_view name;
+    bool closing{false};
+    bool self_closing{false};
+    std::size_t end{0};  // Position following the tag
+};
+
+// Parse the tag starting with the `<` at `start`, the name is empty when it isn't a tag
+Tag parse_tag(std::string_view data, std::size_t start)
+{
+    Tag tag;
+    auto pos = start + 1;
+    if (pos < data.size() && data[pos] == '/')
+    {
+        tag.closing = true;
+        ++pos;
+    }
+
+    auto name_start = pos;
+    while (pos < data.size() &&
+           (std::isalnum(static_cast<unsigned char>(data[pos])) || data[pos] == ':' || data[pos] == '-'))
+    {
+        ++pos;
+    }
+
+    auto tag_end = find_tag_end(data, pos);
+    if (pos == name_start || tag_end == std::string_view::npos)
+    {
+        return tag;
+    }
+
+    tag.name         = data.substr(name_start, pos - name_start);
+    tag.self_closing = data[tag_end - 1] == '/';
+    tag.end          = tag_end + 1;
+
+    return tag;
+}
+
+bool is_html_space(std::string_view text, std::size_t pos, std::size_t& size)
+{
+    const auto c = static_cast<unsigned char>(text[pos]);
+    if (c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v')
+    {
+        size = 1;
+        return true;
+    }
+
+    // Non-breaking space
+    if (c == 0xC2 && pos + 1 < text.size() && static_cast<unsigned char>(text[pos + 1]) == 0xA0)
+    {
+        size = 2;
+        return true;
+    }
+
+    return false;
+}
+
+// Collapse the whitespace of each line to a single space and drop blank lines
+std::string normalize_lines(std::string_view text)
+{
+    std::string result;
+    std::string line;
+    std::size_t pos = 0;
+    while (pos <= text.size())
+    {
+        auto newline = std::min(text.find('\n', pos), text.size());
+        auto raw     = text.substr(pos, newline - pos);
+
+        line.clear();
+        bool pending_space = false;
+        for (std::size_t i = 0; i < raw.size();)
+        {
+            std::size_t size = 0;
+            if (is_html_space(raw, i, size))
+            {
+                pending_space = !line.empty();
+                i += size;
+                continue;
+            }
+
+            if (pending_space)
+            {
+                line += ' ';
+                pending_space = false;
+            }
+
+            line += raw[i++];
+        }
+
+        if (!line.empty())
+        {
+            if (!result.empty())
+            {
+                result += '\n';
+            }
+
+            result += line;
+        }
+
+        pos = newline + 1;
+    }
+
+    return result;
+}
+
+std::uint16_t read_u16(std::string_view data, std::size_t offset)
+{
+    if (offset + 2 > data.size())
+    {
+        throw std::runtime_error("Unexpected end of zip archive");
+    }
+
+    return static_cast<std::uint16_t>(static_cast<unsigned char>(data[offset]) |
+                                      (static_cast<unsigned char>(data[offset + 1]) << 8));
+}
+
+std::uint32_t read_u32(std::string_view data, std::size_t offset)
+{
+    return static_cast<std::uint32_t>(read_u16(data, offset)) |
+           (static_cast<std::uint32_t>(read_u16(data, offset + 2)) << 16);
+}
+
+std::string inflate_raw(std::string_view compressed, std::size_t uncompressed_size)
+{
+    // The size is read from the archive, don't allocate more than the compressed data can inflate to
+    if (uncompressed_size > compressed.size() * MaxDeflateRatio)
+    {
+        throw std::runtime_error("Failed to inflate zip entry, its size exceeds the maximum ratio of deflate");
+    }
+
+    std::string result(uncompressed_size, '\0');
+
+    z_stream stream{};
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+    {
+        throw std::runtime_error("Failed to initialize zlib");
+    }
+
+    stream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+    stream.avail_in  = static_cast<uInt>(compressed.size());
+    stream.next_out  = reinterpret_cast<Bytef*>(result.data());
+    stream.avail_out = static_cast<uInt>(result.size());
+
+    auto status = inflate(&stream, Z_FINISH);
+    inflateEnd(&stream);
+
+    if (status != Z_STREAM_END || stream.total_out != uncompressed_size)
+    {
+        throw std::runtime_error("Failed to inflate zip entry, the archive is corrupt");
+    }
+
+    return result;
+}
+}  // namespace
+
+/****** TextDocumentConverter*******************************/
+std::vector<std::string> TextDocumentConverter::convert(std::string_view data) const
+{
+    if (data.substr(0, Utf8Bom.size()) == Utf8Bom)
+    {
+        data.remove_prefix(Utf8Bom.size());
+    }
+
+    return {std::string(data)};
+}
+
+/****** CsvDocumentConverter********************************/
+CsvDocumentConverter::CsvDocumentConverter(std::vector<std::string> text_columns, char delimiter) :
+  m_text_columns(std::move(text_columns)),
+  m_delimiter(delimiter)
+{
+    if (m_text_columns.empty())
+    {
+        throw std::invalid_argument("At least one text column is required to convert CSV documents");
+    }
+
+    std::sort(m_text_columns.begin(), m_text_columns.end());
+    m_text_columns.erase(std::unique(m_text_columns.begin(), m_text_columns.end()), m_text_columns.end());
+}
+
+std::vector<std::vector<std::string>> CsvDocumentConverter::parse(std::string_view data, char delimiter)
+{
+    if (data.substr(0, Utf8Bom.size()) == Utf8Bom)
+    {
+        data.remove_prefix(Utf8Bom.size());
+    }
+
+    std::vector<std::vector<std::string>> records;
+    std::vector<std::string> record;
+    std::string value;
+    bool quoted     = false;
+    bool in_quotes  = false;
+    bool blank_line = true;
+
+    auto end_record = [&]() {
+        // Blank lines don't produce a record
+        if (!blank_line)
+        {
+            record.push_back(std::move(value));
+            records.push_back(std::move(record));
+        }
+
+        record.clear();
+        value.clear();
+        quoted     = false;
+        blank_line = true;
+    };
+
+    for (std::size_t pos = 0; pos < data.size(); ++pos)
+    {
+        const char c = data[pos];
+        if (in_quotes)
+        {
+            if (c != '"')
+            {
+                value += c;
+            }
+            else if (pos + 1 < data.size() && data[pos + 1] == '"')
+            {
+                value += '"';
+                ++pos;
+            }
+            else
+            {
+                in_quotes = false;
+            }
+
+            continue;
+        }
+
+        if (c == '\n' || c == '\r')
+        {
+            if (c == '\r' && pos + 1 < data.size() && data[pos + 1] == '\n')
+            {
+                ++pos;
+            }
+
+            end_record();
+            continue;
+        }
+
+        blank_line = false;
+        if (c == delimiter)
+        {
+            record.push_back(std::move(value));
+            value.clear();
+            quoted = false;
+        }
+        else if (c == '"' && value.empty() && !quoted)
+        {
+            in_quotes = true;
+            quoted    = true;
+        }
+        else
+        {
+            value += c;
+        }
+    }
+
+    if (in_quotes)
+    {
+        throw std::invalid_argument("Unterminated quoted value in CSV document");
+    }
+
+    end_record();
+
+    return records;
+}
+
+std::vector<std::string> CsvDocumentConverter::convert(std::string_view data) const
+{
+    auto records = parse(data, m_delimiter);
+    if (records.empty())
+    {
+        return {};
+    }
+
+    const auto& header = records.front();
+    std::vector<std::size_t> indices;
+    for (const auto& column : m_text_columns)
+    {
+        auto found = std::find(header.begin(), header.end(), column);
+        if (found == header.end())
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR(
+                "The CSV document must include the text column '" << column << "' but it was not found"));
+        }
+
+        indices.push_back(static_cast<std::size_t>(std::distance(header.begin(), found)));
+    }
+
+    std::vector<std::string> texts;
+    texts.reserve(records.size() - 1);
+    for (std::size_t i = 1; i < records.size(); ++i)
+    {
+        std::string text;
+        for (std::size_t j = 0; j < indices.size(); ++j)
+        {
+            if (j > 0)
+            {
+                text += ' ';
+            }
+
+            // Missing values are treated as empty
+            if (indices[j] < records[i].size())
+            {
+                text += records[i][indices[j]];
+            }
+        }
+
+        texts.push_back(std::move(text));
+    }
+
+    return texts;
+}
+
+/****** HtmlDocumentConverter*******************************/
+HtmlDocumentConverter::HtmlDocumentConverter(bool remove_boilerplate) : m_remove_boilerplate(remove_boilerplate) {}
+
+std::vector<std::string> HtmlDocumentConverter::convert(std::string_view data) const
+{
+    // Open boilerplate elements, the text within them is dropped. Unlike hidden elements their content is markup and
+    // may hold nested boilerplate elements, so the open elements are tracked rather than skipping to a closing tag.
+    std::vector<std::string_view> boilerplate;
+
+    // Line breaks in the text are whitespace, only block elements start a new line
+    std::string text;
+    auto append_text = [&text, &boilerplate](std::string_view content, bool decode) {
+        if (!boilerplate.empty())
+        {
+            return;
+        }
+
+        const auto start = text.size();
+        if (decode)
+        {
+            append_decoded(content, text);
+        }
+        else
+        {
+            text.append(content);
+        }
+
+        std::replace(text.begin() + static_cast<std::ptrdiff_t>(start), text.end(), '\n', ' ');
+    };
+
+    std::size_t pos = 0;
+    while (pos < data.size())
+    {
+        auto lt = data.find('<', pos);
+        append_text(data.substr(pos, lt - pos), true);
+        if (lt == std::string_view::npos)
+        {
+            break;
+        }
+
+        auto rest = data.substr(lt);
+        if (rest.substr(0, 4) == "<!--")
+        {
+            auto end = data.find("-->", lt + 4);
+            pos      = end == std::string_view::npos ? data.size() : end + 3;
+            continue;
+        }
+
+        if (rest.substr(0, 9) == "<![CDATA[")
+        {
+            auto end = data.find("]]>", lt + 9);
+            append_text(data.substr(lt + 9, end == std::string_view::npos ? end : end - lt - 9), false);
+            pos = end == std::string_view::npos ? data.size() : end + 3;
+            continue;
+        }
+
+        // Doctype declarations and processing instructions
+        if (rest.size() > 1 && (rest[1] == '!' || rest[1] == '?'))
+        {
+            auto end = data.find('>', lt);
+            pos      = end == std::string_view::npos ? data.size() : end + 1;
+            continue;
+        }
+
+        auto tag = parse_tag(data, lt);
+        if (tag.name.empty())
+        {
+            // A `<` which doesn't start a tag is text
+            append_text("<", false);
+            pos = lt + 1;
+            continue;
+        }
+
+        pos = tag.end;
+
+        auto is_name = [&tag](std::string_view name) {
+            return iequals(tag.name, name);
+        };
+
+        if (!tag.closing && !tag.self_closing &&
+            std::any_of(HiddenHtmlElements.begin(), HiddenHtmlElements.end(), is_name))
+        {
+            // Skip to the matching closing tag, the content of these elements is not markup
+            auto end = pos;
+            while ((end = data.find("</", end)) != std::string_view::npos)
+            {
+                auto closing = parse_tag(data, end);
+                if (closing.closing && iequals(closing.name, tag.name))
+                {
+                    break;
+                }
+
+                end += 2;
+            }
+
+            pos = end == std::string_view::npos ? data.size() : parse_tag(data, end).end;
+            continue;
+        }
+
+        if (m_remove_boilerplate &&
+            std::any_of(BoilerplateHtmlElements.begin(), BoilerplateHtmlElements.end(), is_name))
+        {
+            if (!tag.closing && !tag.self_closing)
+            {
+                boilerplate.push_back(tag.name);
+            }
+            else if (tag.closing)
+            {
+                // Close the innermost open element of the same name along with any unclosed elements within it
+                auto open = std::find_if(boilerplate.rbegin(), boilerplate.rend(), [&tag](std::string_view name) {
+                    return iequals(name, tag.name);
+                });
+
+                if (open != boilerplate.rend())
+                {
+                    boilerplate.erase(std::prev(open.base()), boilerplate.end());
+                }
+            }
+        }
+
+        // Table cells are separated by a space, the rows of a table by a new line
+        if (std::any_of(BlockHtmlElements.begin(), BlockHtmlElements.end(), is_name))
+        {
+            text += '\n';
+        }
+        else if (is_name("td") || is_name("th"))
+        {
+            text += ' ';
+        }
+    }
+
+    return {normalize_lines(text)};
+}
+
+/****** DocxDocumentConverter*******************************/
+std::string DocxDocumentConverter::read_zip_entry(std::string_view archive, std::string_view name)
+{
+    constexpr std::uint32_t EndOfCentralDirectory = 0x06054b50;
+    constexpr std::uint32_t CentralDirectoryEntry = 0x02014b50;
+    constexpr std::uint32_t LocalFileHeader       = 0x04034b50;
+    constexpr std::size_t EndOfCentralDirSize     = 22;
+    constexpr std::size_t MaxCommentSize          = 0xFFFF;
+
+    if (archive.size() < EndOfCentralDirSize)
+    {
+        throw std::invalid_argument("Document is not a zip archive");
+    }
+
+    // The end of central directory record is at the end of the archive, followed by an optional comment
+    auto eocd       = archive.size() - EndOfCentralDirSize;
+    const auto stop = eocd > MaxCommentSize ? eocd - MaxCommentSize : 0;
+    while (read_u32(archive, eocd) != EndOfCentralDirectory)
+    {
+        if (eocd == stop)
+        {
+            throw std::invalid_argument("Document is not a zip archive");
+        }
+
+        --eocd;
+    }
+
+    const auto num_entries = read_u16(archive, eocd + 10);
+    const auto dir_offset  = read_u32(archive, eocd + 16);
+    if (num_entries == 0xFFFF || dir_offset == 0xFFFFFFFF)
+    {
+        throw std::invalid_argument("ZIP64 archives are not supported");
+    }
+
+    std::size_t entry = dir_offset;
+    for (std::size_t i = 0; i < num_entries; ++i)
+    {
+        if (read_u32(archive, entry) != CentralDirectoryEntry)
+        {
+            throw std::invalid_argument("Corrupt zip archive central directory");
+        }
+
+        const auto flags             = read_u16(archive, entry + 8);
+        const auto method            = read_u16(archive, entry + 10);
+        const auto compressed_size   = read_u32(archive, entry + 20);
+        const auto uncompressed_size = read_u32(archive, entry + 24);
+        const auto name_size         = read_u16(archive, entry + 28);
+        const auto extra_size        = read_u16(archive, entry + 30);
+        const auto comment_size      = read_u16(archive, entry + 32);
+        const auto header_offset     = read_u32(archive, entry + 42);
+
+        if (entry + 46 + name_size > archive.size())
+        {
+            throw std::invalid_argument("Corrupt zip archive central directory");
+        }
+
+        if (archive.substr(entry + 46, name_size) == name)
+        {
+            if ((flags & 0x1) != 0)
+            {
+                throw std::invalid_argument("Encrypted zip archives are not supported");
+            }
+
+            if (read_u32(archive, header_offset) != LocalFileHeader)
+            {
+                throw std::invalid_argument("Corrupt zip archive local file header");
+            }
+
+            const auto data_offset = static_cast<std::size_t>(header_offset) + 30 +
+                                     read_u16(archive, header_offset + 26) + read_u16(archive, header_offset + 28);
+            if (data_offset + compressed_size > archive.size())
+            {
+                throw std::invalid_argument("Unexpected end of zip archive");
+            }
+
+            auto compressed = archive.substr(data_offset, compressed_size);
+            switch (method)
+            {
+            case 0:
+                return std::string(compressed);
+            case 8:
+                return inflate_raw(compressed, uncompressed_size);
+            default:
+                throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unsupported zip compression method " << method));
+            }
+        }
+
+        entry += 46 + name_size + extra_size + comment_size;
+    }
+
+    throw std::invalid_argument(MORPHEUS_CONCAT_STR("Entry '" << name << "' not found in zip archive"));
+}
+
+std::vector<std::string> DocxDocumentConverter::convert(std::string_view data) const
+{
+    const auto xml = read_zip_entry(data, "word/document.xml");
+    const std::string_view document{xml};
+
+    std::string text;
+    std::size_t num_paragraphs = 0;
+    bool in_tab_stops          = false;
+    std::size_t pos            = 0;
+    while ((pos = document.find('<', pos)) != std::string_view::npos)
+    {
+        auto tag = parse_tag(document, pos);
+        if (tag.name.empty())
+        {
+            ++pos;
+            continue;
+        }
+
+        pos = tag.end;
+        if (tag.name == "w:p" && !tag.closing)
+        {
+            // Paragraphs are separated by newlines, an empty paragraph is an empty line
+            text += num_paragraphs++ > 0 ? "\n" : "";
+        }
+        else if (tag.name == "w:t" && !tag.closing && !tag.self_closing)
+        {
+            auto end = document.find("</w:t>", pos);
+            if (end == std::string_view::npos)
+            {
+                throw std::invalid_argument("Corrupt document, unterminated text element");
+            }
+
+            append_decoded(document.substr(pos, end - pos), text);
+            pos = end + 6;
+        }
+        else if (tag.name == "w:tabs")
+        {
+            // The tab stops of the paragraph properties are also `w:tab` elements
+            in_tab_stops = !tag.closing && !tag.self_closing;
+        }
+        else if (tag.name == "w:tab" && !tag.closing && !in_tab_stops)
+        {
+            text += '\t';
+        }
+        else if ((tag.name == "w:br" || tag.name == "w:cr") && !tag.closing)
+        {
+            text += '\n';
+        }
+    }
+
+    return {std::move(text)};
+}
+
+/****** FunctionDocumentConverter***************************/
+FunctionDocumentConverter::FunctionDocumentConverter(convert_fn_t convert_fn) : m_convert_fn(std::move(convert_fn)) {}
+
+std::vector<std::string> FunctionDocumentConverter::convert(std::string_view data) const
+{
+    return m_convert_fn(data);
+}
+
+/****** DocumentConverterRegistry***************************/
+DocumentConverterRegistry DocumentConverterRegistry::create_default(std::vector<std::string> csv_text_columns,
+                                                                    char csv_delimiter)
+{
+    DocumentConverterRegistry registry;
+
+    auto text = std::make_shared<TextDocumentConverter>();
+    auto html = std::make_shared<HtmlDocumentConverter>();
+
+    registry.register_converter("txt", text);
+    registry.register_converter("csv",
+                                std::make_shared<CsvDocumentConverter>(std::move(csv_text_columns), csv_delimiter));
+    registry.register_converter("html", html);
+    registry.register_converter("htm", html);
+    registry.register_converter("docx", std::make_shared<DocxDocumentConverter>());
+    registry.set_default_converter(text);
+
+    return registry;
+}
+
+void DocumentConverterRegistry::register_converter(const std::string& file_type,
+                                                   std::shared_ptr<DocumentConverter> converter)
+{
+    if (!converter)
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Converter for file type '" << file_type << "' is null"));
+    }
+
+    m_converters[to_lower(file_type)] = std::move(converter);
+}
+
+void DocumentConverterRegistry::set_default_converter(std::shared_ptr<DocumentConverter> converter)
+{
+    m_default_converter = std::move(converter);
+}
+
+std::shared_ptr<DocumentConverter> DocumentConverterRegistry::find_converter(const std::string& file_type) const
+{
+    auto found = m_converters.find(to_lower(file_type));
+    return found == m_converters.end() ? m_default_converter : found->second;
+}
+
+std::vector<std::string> DocumentConverterRegistry::file_types() const
+{
+    std::vector<std::string> file_types;
+    for (const auto& [file_type, converter] : m_converters)
+    {
+        file_types.push_back(file_type);
+    }
+
+    return file_types;
+}
+
+}  // namespace morpheus
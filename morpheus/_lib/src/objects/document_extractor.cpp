@@ -0,0 +1,260 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/document_extractor.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for StringUtil
+
+#include <glog/logging.h>   // for LOG
+#include <pybind11/cast.h>  // for cast
+#include <pybind11/gil.h>   // for gil_scoped_acquire, gil_scoped_release
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>  // IWYU pragma: keep
+
+#include <algorithm>     // for max, min, transform
+#include <atomic>        // for atomic
+#include <cctype>        // for tolower
+#include <exception>     // for exception
+#include <filesystem>    // for path, is_regular_file
+#include <fstream>       // for ifstream
+#include <future>        // for async, future
+#include <stdexcept>     // for invalid_argument, runtime_error
+#include <system_error>  // for error_code
+#include <thread>        // for hardware_concurrency
+#include <utility>       // for move
+
+namespace morpheus {
+
+namespace py = pybind11;
+
+namespace {
+std::string read_file(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        throw std::runtime_error("Unable to open file");
+    }
+
+    std::string data(static_cast<std::size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    if (!file.read(data.data(), static_cast<std::streamsize>(data.size())))
+    {
+        throw std::runtime_error("Unable to read file");
+    }
+
+    return data;
+}
+}  // namespace
+
+/****** ExtractedDocuments**********************************/
+std::size_t ExtractedDocuments::size() const
+{
+    return content.size();
+}
+
+/****** DocumentExtractor***********************************/
+DocumentExtractor::DocumentExtractor(DocumentConverterRegistry converters, std::size_t num_threads) :
+  m_converters(std::move(converters)),
+  m_num_threads(num_threads == 0 ? std::max(1U, std::thread::hardware_concurrency()) : num_threads)
+{}
+
+const DocumentConverterRegistry& DocumentExtractor::converters() const
+{
+    return m_converters;
+}
+
+std::string DocumentExtractor::get_file_type(const std::string& path)
+{
+    auto extension = std::filesystem::path(path).extension().string();
+    if (extension.size() <= 1)
+    {
+        return "none";
+    }
+
+    std::transform(extension.begin() + 1, extension.end(), extension.begin() + 1, [](unsigned char c) {
+        return std::tolower(c);
+    });
+
+    return extension.substr(1);
+}
+
+std::vector<std::string> DocumentExtractor::extract_file(const std::string& path, const std::string& file_type) const
+{
+    auto converter = m_converters.find_converter(file_type);
+    if (!converter)
+    {
+        LOG(WARNING) << "No converter for file type '" << file_type << "', skipping " << path;
+        return {};
+    }
+
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(path, ec))
+    {
+        LOG(WARNING) << "File does not exist or is not a regular file, skipping " << path;
+        return {};
+    }
+
+    try
+    {
+        return converter->convert(read_file(path));
+    } catch (const std::exception& e)
+    {
+        LOG(ERROR) << "Error extracting the text of " << path << ": " << e.what();
+    }
+
+    return {};
+}
+
+ExtractedDocuments DocumentExtractor::extract(const std::vector<std::string>& paths) const
+{
+    std::vector<std::string> file_types;
+    file_types.reserve(paths.size());
+    for (const auto& path : paths)
+    {
+        file_types.push_back(get_file_type(path));
+    }
+
+    // Each worker takes the next file when it finishes its current one
+    std::vector<std::vector<std::string>> texts(paths.size());
+    std::vector<std::optional<std::string>> errors(paths.size());
+    std::atomic<std::size_t> next_file{0};
+    auto worker = [&]() {
+        for (auto i = next_file++; i < paths.size(); i = next_file++)
+        {
+            texts[i] = extract_file(paths[i], file_types[i]);
+
+            // Python can only receive valid UTF-8 text, one file mustn't fail the whole batch
+            bool replaced = false;
+            for (auto& text : texts[i])
+            {
+                replaced = StringUtil::replace_invalid_utf8(text) || replaced;
+            }
+
+            if (replaced)
+            {
+                LOG(WARNING) << "Replaced invalid UTF-8 in the text of " << paths[i];
+                errors[i] = "Invalid UTF-8 replaced with U+FFFD";
+            }
+        }
+    };
+
+    const auto num_workers = std::min(m_num_threads, paths.size());
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < num_workers; ++i)
+    {
+        futures.emplace_back(std::async(std::launch::async, worker));
+    }
+
+    worker();
+    for (auto& future : futures)
+    {
+        future.get();
+    }
+
+    ExtractedDocuments documents;
+    for (std::size_t i = 0; i < paths.size(); ++i)
+    {
+        const auto file_name = std::filesystem::path(paths[i]).filename().string();
+        for (auto& text : texts[i])
+        {
+            if (text.empty())
+            {
+                continue;
+            }
+
+            documents.file_path.push_back(paths[i]);
+            documents.file_name.push_back(file_name);
+            documents.file_type.push_back(file_types[i]);
+            documents.content.push_back(std::move(text));
+            documents.error.push_back(errors[i]);
+        }
+    }
+
+    return documents;
+}
+
+/****** DocumentExtractorInterfaceProxy*********************/
+std::shared_ptr<DocumentExtractor> DocumentExtractorInterfaceProxy::init(pybind11::dict converters,
+                                                                         std::vector<std::string> csv_text_columns,
+                                                                         char csv_delimiter,
+                                                                         std::size_t num_threads)
+{
+    auto registry = DocumentConverterRegistry::create_default(std::move(csv_text_columns), csv_delimiter);
+
+    for (const auto& [file_type, fn] : converters)
+    {
+        if (!PyCallable_Check(fn.ptr()))
+        {
+            throw std::invalid_argument("Converters must be callables receiving the bytes of a file");
+        }
+
+        // The function can be released from any thread, the GIL is needed to release it
+        std::shared_ptr<py::function> convert_fn(new py::function(py::reinterpret_borrow<py::function>(fn)),
+                                                 [](py::function* ptr) {
+                                                     py::gil_scoped_acquire gil;
+                                                     delete ptr;
+                                                 });
+
+        registry.register_converter(
+            py::cast<std::string>(file_type),
+            std::make_shared<FunctionDocumentConverter>([convert_fn](std::string_view data) {
+                py::gil_scoped_acquire gil;
+                try
+                {
+                    auto result = (*convert_fn)(py::bytes(data.data(), data.size()));
+                    if (result.is_none())
+                    {
+                        return std::vector<std::string>{};
+                    }
+
+                    if (py::isinstance<py::str>(result))
+                    {
+                        return std::vector<std::string>{result.cast<std::string>()};
+                    }
+
+                    return result.cast<std::vector<std::string>>();
+                } catch (const py::error_already_set& e)
+                {
+                    // Rethrow as a C++ exception, the Python error can't outlive the GIL
+                    throw std::runtime_error(e.what());
+                }
+            }));
+    }
+
+    return std::make_shared<DocumentExtractor>(std::move(registry), num_threads);
+}
+
+pybind11::dict DocumentExtractorInterfaceProxy::extract(DocumentExtractor& self, const std::vector<std::string>& paths)
+{
+    ExtractedDocuments documents;
+    {
+        py::gil_scoped_release nogil;
+        documents = self.extract(paths);
+    }
+
+    py::dict result;
+    result["file_path"] = py::cast(documents.file_path);
+    result["file_name"] = py::cast(documents.file_name);
+    result["file_type"] = py::cast(documents.file_type);
+    result["content"]   = py::cast(documents.content);
+    result["error"]     = py::cast(documents.error);
+
+    return result;
+}
+
+}  // namespace morpheus
@@ -45,7 +45,7 @@ const std::map<char, std::map<size_t, morpheus::TypeId>> StrToTypeId = {
          {8, morpheus::TypeId::UINT64},
      }},
 
-    {'f', {{4, morpheus::TypeId::FLOAT32}, {8, morpheus::TypeId::FLOAT64}}},
+    {'f', {{2, morpheus::TypeId::FLOAT16}, {4, morpheus::TypeId::FLOAT32}, {8, morpheus::TypeId::FLOAT64}}},
 
     {'O', {{1, morpheus::TypeId::STRING}}}};
 }  // namespace
@@ -75,6 +75,7 @@ size_t DType::item_size() const
         return 1;
     case TypeId::INT16:
     case TypeId::UINT16:
+    case TypeId::FLOAT16:
         return 2;
     case TypeId::INT32:
     case TypeId::UINT32:
@@ -160,6 +161,8 @@ std::string DType::triton_str() const
         return "UINT32";
     case TypeId::UINT64:
         return "UINT64";
+    case TypeId::FLOAT16:
+        return "FP16";
     case TypeId::FLOAT32:
         return "FP32";
     case TypeId::FLOAT64:
@@ -286,6 +289,10 @@ DType DType::from_triton(const std::string& type_str)
     {
         return {TypeId::UINT64};
     }
+    else if (type_str == "FP16")
+    {
+        return {TypeId::FLOAT16};
+    }
     else if (type_str == "FP32")
     {
         return {TypeId::FLOAT32};
@@ -318,6 +325,7 @@ char DType::byte_order_char() const
     case TypeId::UINT32:
     case TypeId::INT64:
     case TypeId::UINT64:
+    case TypeId::FLOAT16:
     case TypeId::FLOAT32:
     case TypeId::FLOAT64:
         return '<';
@@ -345,6 +353,7 @@ char DType::type_char() const
         return 'u';
     case TypeId::BOOL8:
         return 'b';
+    case TypeId::FLOAT16:
     case TypeId::FLOAT32:
     case TypeId::FLOAT64:
         return 'f';
@@ -374,4 +383,52 @@ bool DType::is_fully_supported() const
     return true;
 }
 
+bool DType::is_integral() const
+{
+    switch (m_type_id)
+    {
+    case TypeId::INT8:
+    case TypeId::INT16:
+    case TypeId::INT32:
+    case TypeId::INT64:
+    case TypeId::UINT8:
+    case TypeId::UINT16:
+    case TypeId::UINT32:
+    case TypeId::UINT64:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool DType::can_safely_cast_to(const DType& other) const
+{
+    if (*this == other)
+    {
+        return true;
+    }
+
+    const auto from_char = type_char();
+    const auto to_char   = other.type_char();
+    const auto from_size = item_size();
+    const auto to_size   = other.item_size();
+
+    // Like numpy, any integer can be safely converted to a double
+    const bool widens_to_float = to_char == 'f' && (to_size > from_size || to_size == 8);
+
+    switch (from_char)
+    {
+    case 'b':
+        return to_char != 'O';
+    case 'i':
+        return (to_char == 'i' && to_size > from_size) || widens_to_float;
+    case 'u':
+        return ((to_char == 'u' || to_char == 'i') && to_size > from_size) || widens_to_float;
+    case 'f':
+        return to_char == 'f' && to_size > from_size;
+    default:
+        return false;
+    }
+}
+
 }  // namespace morpheus
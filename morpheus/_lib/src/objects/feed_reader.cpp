@@ -0,0 +1,792 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/feed_reader.hpp"
+
+#include "morpheus/objects/document_converter.hpp"  // for HtmlDocumentConverter
+#include "morpheus/utilities/string_util.hpp"       // for MORPHEUS_CONCAT_STR
+
+#include <glog/logging.h>  // for LOG
+
+#include <algorithm>   // for find, find_if, min
+#include <atomic>      // for atomic
+#include <cctype>      // for isalnum, isspace, isxdigit, tolower
+#include <cstdint>     // for uint32_t
+#include <exception>   // for exception
+#include <filesystem>  // for exists
+#include <fstream>     // for ifstream
+#include <future>      // for async, future
+#include <optional>    // for optional
+#include <stdexcept>   // for invalid_argument, runtime_error
+#include <thread>      // for hardware_concurrency
+#include <utility>     // for move
+
+namespace morpheus {
+
+namespace {
+// Size of the parts in which local files are read
+constexpr std::size_t ReadSize = 64 * 1024;
+
+constexpr std::string_view CDataStart = "<![CDATA[";
+
+// Fields of an entry, by qualified name for the namespaced elements and by local name otherwise
+const std::vector<std::pair<std::string_view, std::string FeedEntry::*>> QualifiedFields = {
+    {"content:encoded", &FeedEntry::content}, {"dc:creator", &FeedEntry::author}, {"dc:date", &FeedEntry::published}};
+
+const std::vector<std::pair<std::string_view, std::string FeedEntry::*>> LocalFields = {
+    {"guid", &FeedEntry::id},
+    {"id", &FeedEntry::id},
+    {"title", &FeedEntry::title},
+    {"link", &FeedEntry::link},
+    {"description", &FeedEntry::summary},
+    {"summary", &FeedEntry::summary},
+    {"content", &FeedEntry::content},
+    {"pubDate", &FeedEntry::published},
+    {"published", &FeedEntry::published},
+    {"issued", &FeedEntry::published},
+    {"updated", &FeedEntry::updated},
+    {"modified", &FeedEntry::updated},
+    {"author", &FeedEntry::author}};
+
+std::string_view local_name(std::string_view name)
+{
+    auto colon = name.find(':');
+    return colon == std::string_view::npos ? name : name.substr(colon + 1);
+}
+
+std::string_view trim(std::string_view text)
+{
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front())))
+    {
+        text.remove_prefix(1);
+    }
+
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back())))
+    {
+        text.remove_suffix(1);
+    }
+
+    return text;
+}
+
+void append_utf8(std::uint32_t code_point, std::string& out)
+{
+    if (code_point == 0 || code_point > 0x10FFFF || (code_point >= 0xD800 && code_point <= 0xDFFF))
+    {
+        code_point = 0xFFFD;
+    }
+
+    if (code_point < 0x80)
+    {
+        out += static_cast<char>(code_point);
+    }
+    else if (code_point < 0x800)
+    {
+        out += static_cast<char>(0xC0 | (code_point >> 6));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    else if (code_point < 0x10000)
+    {
+        out += static_cast<char>(0xE0 | (code_point >> 12));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    else
+    {
+        out += static_cast<char>(0xF0 | (code_point >> 18));
+        out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+}
+
+/**
+ * @brief Append `text` to `out` decoding the predefined XML entities and numeric character references. Other
+ * references, such as HTML entities which some feeds use, are appended unchanged.
+ */
+void append_decoded(std::string_view text, std::string& out)
+{
+    static const std::vector<std::pair<std::string_view, char>> XmlEntities = {
+        {"amp", '&'}, {"lt", '<'}, {"gt", '>'}, {"quot", '"'}, {"apos", '\''}};
+
+    std::size_t pos = 0;
+    while (pos < text.size())
+    {
+        auto amp = text.find('&', pos);
+        out.append(text.substr(pos, amp - pos));
+        if (amp == std::string_view::npos)
+        {
+            return;
+        }
+
+        pos      = amp + 1;
+        auto end = text.find(';', pos);
+        if (end == std::string_view::npos || end - pos > 10 || end == pos)
+        {
+            out += '&';
+            continue;
+        }
+
+        auto name = text.substr(pos, end - pos);
+        if (name.front() == '#')
+        {
+            const bool hex   = name.size() > 1 && (name[1] == 'x' || name[1] == 'X');
+            auto digits      = name.substr(hex ? 2 : 1);
+            std::uint32_t cp = 0;
+            bool valid       = !digits.empty();
+            for (char c : digits)
+            {
+                int digit = -1;
+                if (c >= '0' && c <= '9')
+                {
+                    digit = c - '0';
+                }
+                else if (hex && std::isxdigit(static_cast<unsigned char>(c)))
+                {
+                    digit = std::tolower(static_cast<unsigned char>(c)) - 'a' + 10;
+                }
+
+                if (digit < 0 || cp > 0x10FFFF)
+                {
+                    valid = false;
+                    break;
+                }
+
+                cp = cp * (hex ? 16 : 10) + static_cast<std::uint32_t>(digit);
+            }
+
+            if (valid)
+            {
+                append_utf8(cp, out);
+                pos = end + 1;
+                continue;
+            }
+        }
+        else
+        {
+            auto found = std::find_if(XmlEntities.begin(), XmlEntities.end(), [&name](const auto& entity) {
+                return entity.first == name;
+            });
+
+            if (found != XmlEntities.end())
+            {
+                out += found->second;
+                pos = end + 1;
+                continue;
+            }
+        }
+
+        out += '&';
+    }
+}
+
+// Position of the `>` closing the tag starting at `start`, skipping over quoted attribute values
+std::size_t find_tag_end(std::string_view data, std::size_t start)
+{
+    char quote = 0;
+    for (auto pos = start; pos < data.size(); ++pos)
+    {
+        const char c = data[pos];
+        if (quote != 0)
+        {
+            quote = c == quote ? 0 : quote;
+        }
+        else if (c == '"' || c == '\'')
+        {
+            quote = c;
+        }
+        else if (c == '>')
+        {
+            return pos;
+        }
+    }
+
+    return std::string_view::npos;
+}
+
+bool is_name_char(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == ':' || c == '-' || c == '_' || c == '.' ||
+           static_cast<unsigned char>(c) >= 0x80;
+}
+
+void read_file(const std::string& path, FeedParser& parser)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("Unable to open the file");
+    }
+
+    std::string buffer(ReadSize, '\0');
+    while (file)
+    {
+        file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        parser.feed(std::string_view(buffer.data(), static_cast<std::size_t>(file.gcount())));
+    }
+
+    if (file.bad())
+    {
+        throw std::runtime_error("Unable to read the file");
+    }
+}
+}  // namespace
+
+/****** FeedParser******************************************/
+void FeedParser::feed(std::string_view data)
+{
+    m_buffer.append(data);
+
+    const std::string_view buffer = m_buffer;
+    std::size_t pos               = 0;
+
+    while (pos < buffer.size())
+    {
+        if (buffer[pos] != '<')
+        {
+            // Text is complete once the next markup starts
+            auto next = buffer.find('<', pos);
+            if (next == std::string_view::npos)
+            {
+                break;
+            }
+
+            on_text(buffer.substr(pos, next - pos), true);
+            pos = next;
+            continue;
+        }
+
+        const auto rest = buffer.substr(pos);
+        if (rest.size() < 2)
+        {
+            break;
+        }
+
+        if (rest[1] == '!')
+        {
+            // Wait until the kind of declaration is known
+            if (rest.size() < CDataStart.size() && (CDataStart.substr(0, rest.size()) == rest || rest == "<!-"))
+            {
+                break;
+            }
+
+            std::size_t end = std::string_view::npos;
+            if (rest.substr(0, 4) == "<!--")
+            {
+                end = rest.find("-->", 4);
+                end = end == std::string_view::npos ? end : end + 3;
+            }
+            else if (rest.substr(0, CDataStart.size()) == CDataStart)
+            {
+                end = rest.find("]]>", CDataStart.size());
+                if (end != std::string_view::npos)
+                {
+                    on_text(rest.substr(CDataStart.size(), end - CDataStart.size()), false);
+                    end += 3;
+                }
+            }
+            else
+            {
+                // A document type declaration, possibly with an internal subset
+                auto subset = rest.find('[');
+                auto close  = rest.find('>');
+                if (subset != std::string_view::npos && subset < close)
+                {
+                    close = rest.find("]>", subset);
+                    close = close == std::string_view::npos ? close : close + 1;
+                }
+
+                end = close == std::string_view::npos ? close : close + 1;
+            }
+
+            if (end == std::string_view::npos)
+            {
+                break;
+            }
+
+            pos += end;
+            continue;
+        }
+
+        if (rest[1] == '?')
+        {
+            auto end = rest.find("?>", 2);
+            if (end == std::string_view::npos)
+            {
+                break;
+            }
+
+            pos += end + 2;
+            continue;
+        }
+
+        auto tag_end = find_tag_end(rest, 1);
+        if (tag_end == std::string_view::npos)
+        {
+            break;
+        }
+
+        const bool closing     = rest[1] == '/';
+        std::size_t name_start = closing ? 2 : 1;
+        auto name_end          = name_start;
+        while (name_end < tag_end && is_name_char(rest[name_end]))
+        {
+            ++name_end;
+        }
+
+        if (name_end == name_start)
+        {
+            const auto markup = rest.substr(0, std::min<std::size_t>(tag_end + 1, 32));
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Invalid markup '" << markup << "'"));
+        }
+
+        const auto name = rest.substr(name_start, name_end - name_start);
+        if (closing)
+        {
+            on_end();
+        }
+        else
+        {
+            const bool self_closing = rest[tag_end - 1] == '/';
+
+            std::vector<Attribute> attributes;
+            auto attr_pos = name_end;
+            while (attr_pos < tag_end)
+            {
+                while (attr_pos < tag_end && !is_name_char(rest[attr_pos]))
+                {
+                    ++attr_pos;
+                }
+
+                auto attr_start = attr_pos;
+                while (attr_pos < tag_end && is_name_char(rest[attr_pos]))
+                {
+                    ++attr_pos;
+                }
+
+                if (attr_pos == attr_start)
+                {
+                    break;
+                }
+
+                Attribute attribute{rest.substr(attr_start, attr_pos - attr_start), {}};
+                while (attr_pos < tag_end && std::isspace(static_cast<unsigned char>(rest[attr_pos])))
+                {
+                    ++attr_pos;
+                }
+
+                if (attr_pos < tag_end && rest[attr_pos] == '=')
+                {
+                    ++attr_pos;
+                    while (attr_pos < tag_end && std::isspace(static_cast<unsigned char>(rest[attr_pos])))
+                    {
+                        ++attr_pos;
+                    }
+
+                    if (attr_pos < tag_end && (rest[attr_pos] == '"' || rest[attr_pos] == '\''))
+                    {
+                        auto value_end = rest.find(rest[attr_pos], attr_pos + 1);
+                        append_decoded(rest.substr(attr_pos + 1, value_end - attr_pos - 1), attribute.value);
+                        attr_pos = value_end + 1;
+                    }
+                }
+
+                attributes.push_back(std::move(attribute));
+            }
+
+            on_start(name, attributes, self_closing);
+        }
+
+        pos += tag_end + 1;
+    }
+
+    m_buffer.erase(0, pos);
+}
+
+std::vector<FeedEntry> FeedParser::finish()
+{
+    if (!trim(m_buffer).empty() && m_buffer.find('<') != std::string::npos)
+    {
+        throw std::invalid_argument("The feed ends within markup");
+    }
+
+    if (!m_is_feed)
+    {
+        throw std::invalid_argument("The document isn't an RSS or Atom feed");
+    }
+
+    m_buffer.clear();
+
+    return std::move(m_entries);
+}
+
+std::vector<FeedEntry> FeedParser::parse(std::string_view document)
+{
+    FeedParser parser;
+    parser.feed(document);
+
+    return parser.finish();
+}
+
+void FeedParser::on_start(std::string_view name, const std::vector<Attribute>& attributes, bool self_closing)
+{
+    ++m_depth;
+
+    const auto local = local_name(name);
+    if (m_depth == 1)
+    {
+        m_is_feed = local == "rss" || local == "feed" || local == "RDF";
+    }
+
+    if (m_entry_depth == 0)
+    {
+        if (m_is_feed && (local == "item" || local == "entry"))
+        {
+            m_entry       = FeedEntry{};
+            m_entry_depth = m_depth;
+        }
+    }
+    else if (m_field == nullptr && m_depth == m_entry_depth + 1)
+    {
+        auto qualified = std::find_if(QualifiedFields.begin(), QualifiedFields.end(), [&name](const auto& field) {
+            return field.first == name;
+        });
+
+        std::string FeedEntry::*member = nullptr;
+        if (qualified != QualifiedFields.end())
+        {
+            member = qualified->second;
+        }
+        else if (local == name || name.substr(0, name.find(':')) == "atom")
+        {
+            auto found = std::find_if(LocalFields.begin(), LocalFields.end(), [&local](const auto& field) {
+                return field.first == local;
+            });
+
+            member = found == LocalFields.end() ? nullptr : found->second;
+        }
+
+        auto find_attribute = [&attributes](std::string_view attribute_name) -> const std::string* {
+            for (const auto& attribute : attributes)
+            {
+                if (attribute.name == attribute_name)
+                {
+                    return &attribute.value;
+                }
+            }
+
+            return nullptr;
+        };
+
+        if (member == &FeedEntry::link)
+        {
+            // Atom links are attributes, the first alternate link is the link of the entry
+            if (const auto* href = find_attribute("href"))
+            {
+                const auto* rel = find_attribute("rel");
+                if (m_entry.link.empty() && (rel == nullptr || *rel == "alternate"))
+                {
+                    m_entry.link = trim(*href);
+                }
+
+                member = nullptr;
+            }
+        }
+
+        // The first occurrence of a field is kept
+        if (member != nullptr && (m_entry.*member).empty())
+        {
+            m_field       = &(m_entry.*member);
+            m_field_depth = m_depth;
+        }
+    }
+    else if (m_field == &m_entry.author && m_skip_depth == 0 && (local == "email" || local == "uri"))
+    {
+        // Atom authors hold a name along with an email address and a URI
+        m_skip_depth = m_depth;
+    }
+
+    if (self_closing)
+    {
+        on_end();
+    }
+}
+
+void FeedParser::on_end()
+{
+    if (m_depth == 0)
+    {
+        return;
+    }
+
+    if (m_skip_depth == m_depth)
+    {
+        m_skip_depth = 0;
+    }
+
+    if (m_field != nullptr && m_depth == m_field_depth)
+    {
+        *m_field = trim(*m_field);
+        m_field  = nullptr;
+    }
+
+    if (m_entry_depth != 0 && m_depth == m_entry_depth)
+    {
+        if (m_entry.id.empty())
+        {
+            m_entry.id = m_entry.link.empty() ? m_entry.title : m_entry.link;
+        }
+
+        m_entries.push_back(std::move(m_entry));
+        m_entry_depth = 0;
+    }
+
+    --m_depth;
+}
+
+void FeedParser::on_text(std::string_view text, bool decode)
+{
+    if (m_field == nullptr || m_skip_depth != 0)
+    {
+        return;
+    }
+
+    if (decode)
+    {
+        append_decoded(text, *m_field);
+    }
+    else
+    {
+        m_field->append(text);
+    }
+}
+
+/****** FeedReader******************************************/
+FeedReader::FeedReader(FeedReaderConfig config, fetch_fn_t fetch_fn) :
+  m_config(std::move(config)),
+  m_fetch_fn(std::move(fetch_fn)),
+  m_seen(m_config.max_seen_entries)
+{
+    if (m_config.num_threads == 0)
+    {
+        m_config.num_threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    std::vector<std::string> feeds;
+    for (auto& feed : m_config.feeds)
+    {
+        if (std::find(feeds.begin(), feeds.end(), feed) != feeds.end())
+        {
+            continue;
+        }
+
+        if (is_url(feed))
+        {
+            if (!m_fetch_fn)
+            {
+                throw std::invalid_argument(
+                    MORPHEUS_CONCAT_STR("A fetch function is required to read the feed '" << feed << "'"));
+            }
+        }
+        else if (!std::filesystem::exists(feed))
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Invalid URL or file path: " << feed));
+        }
+
+        m_stats.emplace(feed, FeedStats{});
+        feeds.push_back(std::move(feed));
+    }
+
+    m_config.feeds = std::move(feeds);
+}
+
+const std::vector<std::string>& FeedReader::feeds() const
+{
+    return m_config.feeds;
+}
+
+FeedStats FeedReader::feed_stats(const std::string& feed) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto found = m_stats.find(feed);
+    if (found == m_stats.end())
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("'" << feed << "' is not one of the feeds of the reader"));
+    }
+
+    return found->second;
+}
+
+bool FeedReader::is_url(std::string_view feed)
+{
+    auto scheme_end = feed.find("://");
+    return scheme_end != std::string_view::npos && scheme_end > 0 && scheme_end + 3 < feed.size() &&
+           std::all_of(feed.begin(), feed.begin() + scheme_end, [](char c) {
+               return std::isalnum(static_cast<unsigned char>(c)) || c == '+' || c == '-' || c == '.';
+           });
+}
+
+std::vector<FeedEntry> FeedReader::poll()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto now = std::chrono::steady_clock::now();
+
+    // Feeds which failed recently are skipped
+    std::vector<std::string> feeds;
+    for (const auto& feed : m_config.feeds)
+    {
+        const auto& stats = m_stats[feed];
+        if (stats.failure_count == 0 || now - stats.last_failure >= m_config.cooldown_interval)
+        {
+            feeds.push_back(feed);
+        }
+    }
+
+    // Feeds are read from the result of the fetch or else from their file
+    std::vector<std::optional<std::string>> documents(feeds.size());
+    std::vector<std::string> errors(feeds.size());
+
+    std::vector<std::string> urls;
+    std::vector<std::size_t> url_feeds;
+    for (std::size_t i = 0; i < feeds.size(); ++i)
+    {
+        if (is_url(feeds[i]))
+        {
+            urls.push_back(feeds[i]);
+            url_feeds.push_back(i);
+        }
+    }
+
+    if (!urls.empty())
+    {
+        auto responses = m_fetch_fn(urls);
+        for (std::size_t i = 0; i < url_feeds.size(); ++i)
+        {
+            auto& response = responses[i];
+            if (!response.error.empty())
+            {
+                errors[url_feeds[i]] = response.error;
+            }
+            else if (!response.ok())
+            {
+                errors[url_feeds[i]] = MORPHEUS_CONCAT_STR("The server returned status " << response.status);
+            }
+            else
+            {
+                documents[url_feeds[i]] = std::move(response.body);
+            }
+        }
+    }
+
+    // Each worker takes the next feed when it finishes its current one
+    std::vector<std::vector<FeedEntry>> entries(feeds.size());
+    std::atomic<std::size_t> next_feed{0};
+    auto worker = [&]() {
+        for (auto i = next_feed++; i < feeds.size(); i = next_feed++)
+        {
+            if (!errors[i].empty())
+            {
+                continue;
+            }
+
+            try
+            {
+                FeedParser parser;
+                if (documents[i].has_value())
+                {
+                    parser.feed(*documents[i]);
+                    documents[i].reset();
+                }
+                else
+                {
+                    read_file(feeds[i], parser);
+                }
+
+                entries[i] = parser.finish();
+            } catch (const std::exception& e)
+            {
+                errors[i] = e.what();
+            }
+        }
+    };
+
+    const auto num_workers = std::min(m_config.num_threads, feeds.size());
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < num_workers; ++i)
+    {
+        futures.emplace_back(std::async(std::launch::async, worker));
+    }
+
+    worker();
+    for (auto& future : futures)
+    {
+        future.get();
+    }
+
+    HtmlDocumentConverter markup_converter;
+    auto strip_markup = [&markup_converter](std::string& field) {
+        std::string text;
+        for (const auto& part : markup_converter.convert(field))
+        {
+            text += text.empty() || part.empty() ? "" : "\n";
+            text += part;
+        }
+
+        field = std::move(text);
+    };
+
+    std::vector<FeedEntry> new_entries;
+    for (std::size_t i = 0; i < feeds.size(); ++i)
+    {
+        auto& stats = m_stats[feeds[i]];
+        if (!errors[i].empty())
+        {
+            LOG(WARNING) << "Failed to read feed " << feeds[i] << ": " << errors[i];
+
+            ++stats.failure_count;
+            stats.last_error   = std::move(errors[i]);
+            stats.last_failure = now;
+            continue;
+        }
+
+        ++stats.success_count;
+
+        for (auto& entry : entries[i])
+        {
+            // Entries shared by several feeds are returned once
+            if (!m_seen.insert(entry.id))
+            {
+                continue;
+            }
+
+            if (m_config.strip_markup)
+            {
+                strip_markup(entry.title);
+                strip_markup(entry.summary);
+                strip_markup(entry.content);
+            }
+
+            new_entries.push_back(std::move(entry));
+        }
+    }
+
+    return new_entries;
+}
+
+}  // namespace morpheus
@@ -0,0 +1,408 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/file_batch_cache.hpp"
+
+#include "morpheus/objects/table_info.hpp"     // for TableInfo
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR, StringUtil
+
+#include <cudf/io/parquet.hpp>  // for read_parquet, write_parquet
+#include <cudf/io/types.hpp>    // for source_info, sink_info, table_input_metadata
+#include <fcntl.h>              // for open
+#include <glog/logging.h>       // for LOG
+#include <pybind11/gil.h>       // for gil_scoped_release
+#include <pybind11/pybind11.h>  // for cast
+#include <sys/mman.h>           // for mmap, munmap
+#include <unistd.h>             // for close
+
+#include <algorithm>     // for sort
+#include <iterator>      // for prev
+#include <numeric>       // for iota
+#include <optional>      // for optional, nullopt
+#include <stdexcept>     // for runtime_error
+#include <system_error>  // for error_code
+#include <utility>       // for move
+#include <vector>        // for vector
+
+namespace morpheus {
+
+namespace py = pybind11;
+
+namespace {
+
+const std::string CacheFileExtension{".parquet"};
+
+/**
+ * @brief Read-only memory mapping of a whole file, unmapped on destruction
+ */
+class MappedFile
+{
+  public:
+    explicit MappedFile(const std::filesystem::path& path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Unable to open cache file " << path));
+        }
+
+        m_size = std::filesystem::file_size(path);
+        if (m_size > 0)
+        {
+            m_data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+
+        ::close(fd);
+
+        if (m_data == MAP_FAILED)
+        {
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Unable to map cache file " << path));
+        }
+    }
+
+    ~MappedFile()
+    {
+        if (m_data != nullptr && m_data != MAP_FAILED)
+        {
+            ::munmap(m_data, m_size);
+        }
+    }
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const
+    {
+        return static_cast<const char*>(m_data);
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+  private:
+    void* m_data{nullptr};
+    std::size_t m_size{0};
+};
+
+}  // namespace
+
+/****** FileBatchCache**************************************/
+FileBatchCache::FileBatchCache(std::filesystem::path cache_dir, std::size_t max_bytes, std::string schema_version) :
+  m_cache_dir(std::move(cache_dir)),
+  m_max_bytes(max_bytes),
+  m_schema_version(std::move(schema_version))
+{
+    std::filesystem::create_directories(m_cache_dir);
+
+    // Index the entries of previous runs, most recently used first
+    std::vector<std::pair<std::filesystem::file_time_type, std::pair<std::string, std::size_t>>> existing;
+    for (const auto& dir_entry : std::filesystem::directory_iterator(m_cache_dir))
+    {
+        const auto& path = dir_entry.path();
+        if (!dir_entry.is_regular_file())
+        {
+            continue;
+        }
+
+        if (path.extension() != CacheFileExtension)
+        {
+            // Left behind by an interrupted write
+            if (path.filename().string().find(CacheFileExtension + ".tmp") != std::string::npos)
+            {
+                std::error_code ec;
+                std::filesystem::remove(path, ec);
+            }
+
+            continue;
+        }
+
+        existing.emplace_back(dir_entry.last_write_time(),
+                              std::make_pair(path.stem().string(), static_cast<std::size_t>(dir_entry.file_size())));
+    }
+
+    std::sort(existing.begin(), existing.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& [last_used, entry] : existing)
+    {
+        m_bytes += entry.second;
+        m_entries.push_back({entry.first, entry.second, m_generation++});
+        m_index[entry.first] = std::prev(m_entries.end());
+    }
+
+    evict();
+}
+
+std::string FileBatchCache::key(const std::string& path, std::size_t size, const std::string& modified) const
+{
+    return StringUtil::hash_fields({path, std::to_string(size), modified, m_schema_version});
+}
+
+bool FileBatchCache::contains(const std::string& key) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_index.find(key) != m_index.end();
+}
+
+std::shared_ptr<MessageMeta> FileBatchCache::get(const std::string& key)
+{
+    cudf::io::table_with_metadata table;
+    if (!read_entry(key, [&table](const std::filesystem::path& path) {
+            MappedFile mapped(path);
+            auto options =
+                cudf::io::parquet_reader_options::builder(cudf::io::source_info{mapped.data(), mapped.size()});
+            table = cudf::io::read_parquet(options.build());
+        }))
+    {
+        return nullptr;
+    }
+
+    return MessageMeta::create_from_cpp(std::move(table), 0);
+}
+
+std::optional<std::string> FileBatchCache::get_bytes(const std::string& key)
+{
+    std::string contents;
+    if (!read_entry(key, [&contents](const std::filesystem::path& path) {
+            MappedFile mapped(path);
+            contents.assign(mapped.data(), mapped.size());
+        }))
+    {
+        return std::nullopt;
+    }
+
+    return contents;
+}
+
+void FileBatchCache::put(const std::string& key, const MessageMeta& meta)
+{
+    const auto info          = meta.get_info();
+    const auto column_names  = info.get_column_names();
+    const auto num_index_col = static_cast<cudf::size_type>(info.get_index_names().size());
+
+    // Only the columns are cached, skipping the index
+    std::vector<cudf::size_type> column_indices(column_names.size());
+    std::iota(column_indices.begin(), column_indices.end(), num_index_col);
+    auto table_view = info.get_view().select(column_indices);
+
+    cudf::io::table_input_metadata metadata(table_view);
+    for (std::size_t i = 0; i < column_names.size(); ++i)
+    {
+        metadata.column_metadata[i].set_name(column_names[i]);
+    }
+
+    std::filesystem::path tmp_path;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        tmp_path = m_cache_dir / MORPHEUS_CONCAT_STR(key << CacheFileExtension << ".tmp" << m_tmp_counter++);
+    }
+
+    try
+    {
+        auto options = cudf::io::parquet_writer_options::builder(cudf::io::sink_info{tmp_path.string()}, table_view)
+                           .metadata(std::move(metadata));
+        cudf::io::write_parquet(options.build());
+    } catch (...)
+    {
+        std::error_code ec;
+        std::filesystem::remove(tmp_path, ec);
+        throw;
+    }
+
+    const auto bytes = static_cast<std::size_t>(std::filesystem::file_size(tmp_path));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_stats.writes;
+
+    if (bytes > m_max_bytes)
+    {
+        std::filesystem::remove(tmp_path);
+        erase(key);
+        return;
+    }
+
+    // Replacing the file is atomic, concurrent readers see either the old or the new entry
+    std::filesystem::rename(tmp_path, entry_path(key));
+    insert(key, bytes);
+}
+
+FileBatchCacheStats FileBatchCache::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto stats    = m_stats;
+    stats.entries = m_entries.size();
+    stats.bytes   = m_bytes;
+
+    return stats;
+}
+
+std::filesystem::path FileBatchCache::entry_path(const std::string& key) const
+{
+    return m_cache_dir / (key + CacheFileExtension);
+}
+
+bool FileBatchCache::read_entry(const std::string& key,
+                                const std::function<void(const std::filesystem::path&)>& read)
+{
+    std::uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = m_index.find(key);
+        if (found == m_index.end())
+        {
+            ++m_stats.misses;
+            return false;
+        }
+
+        ++m_stats.hits;
+        generation = found->second->generation;
+        m_entries.splice(m_entries.begin(), m_entries, found->second);
+    }
+
+    const auto path = entry_path(key);
+
+    try
+    {
+        read(path);
+    } catch (const std::exception& e)
+    {
+        LOG(WARNING) << "Removing unreadable cache entry " << path << ": " << e.what();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        --m_stats.hits;
+        ++m_stats.misses;
+
+        // The entry may have been replaced by a concurrent `put` while it was read
+        auto found = m_index.find(key);
+        if (found != m_index.end() && found->second->generation == generation)
+        {
+            erase(key);
+        }
+
+        return false;
+    }
+
+    // Persist the use order for the next run
+    std::error_code ec;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+    return true;
+}
+
+void FileBatchCache::insert(const std::string& key, std::size_t bytes)
+{
+    auto found = m_index.find(key);
+    if (found != m_index.end())
+    {
+        m_bytes -= found->second->bytes;
+        m_entries.erase(found->second);
+    }
+
+    m_bytes += bytes;
+    m_entries.push_front({key, bytes, m_generation++});
+    m_index[key] = m_entries.begin();
+
+    evict();
+}
+
+void FileBatchCache::erase(const std::string& key)
+{
+    auto found = m_index.find(key);
+    if (found == m_index.end())
+    {
+        return;
+    }
+
+    m_bytes -= found->second->bytes;
+    m_entries.erase(found->second);
+    m_index.erase(found);
+
+    std::error_code ec;
+    std::filesystem::remove(entry_path(key), ec);
+}
+
+void FileBatchCache::evict()
+{
+    while (m_bytes > m_max_bytes && !m_entries.empty())
+    {
+        // Copied since erasing the entry invalidates it
+        const auto key = m_entries.back().key;
+        erase(key);
+        ++m_stats.evictions;
+    }
+}
+
+/****** FileBatchCacheInterfaceProxy************************/
+py::object FileBatchCacheInterfaceProxy::get(FileBatchCache& self, const std::string& key)
+{
+    std::shared_ptr<MessageMeta> meta;
+    {
+        py::gil_scoped_release nogil;
+        meta = self.get(key);
+    }
+
+    if (meta == nullptr)
+    {
+        return py::none();
+    }
+
+    return py::cast(std::move(meta));
+}
+
+py::object FileBatchCacheInterfaceProxy::get_bytes(FileBatchCache& self, const std::string& key)
+{
+    std::optional<std::string> contents;
+    {
+        py::gil_scoped_release nogil;
+        contents = self.get_bytes(key);
+    }
+
+    if (!contents.has_value())
+    {
+        return py::none();
+    }
+
+    return py::bytes(*contents);
+}
+
+void FileBatchCacheInterfaceProxy::put(FileBatchCache& self, const std::string& key, std::shared_ptr<MessageMeta> meta)
+{
+    py::gil_scoped_release nogil;
+    self.put(key, *meta);
+}
+
+py::dict FileBatchCacheInterfaceProxy::stats(FileBatchCache& self)
+{
+    auto stats = self.stats();
+
+    py::dict result;
+    result["hits"]      = stats.hits;
+    result["misses"]    = stats.misses;
+    result["writes"]    = stats.writes;
+    result["evictions"] = stats.evictions;
+    result["entries"]   = stats.entries;
+    result["bytes"]     = stats.bytes;
+
+    return result;
+}
+
+}  // namespace morpheus
@@ -41,6 +41,10 @@ FileTypes determine_file_type(const std::string& filename)
     {
         return FileTypes::PARQUET;
     }
+    else if (filename_path.extension() == ".avro")
+    {
+        return FileTypes::AVRO;
+    }
     else
     {
         throw std::runtime_error(MORPHEUS_CONCAT_STR("Unsupported extension '"
@@ -0,0 +1,1994 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/grok.hpp"
+
+#include "morpheus/objects/syslog_parser.hpp"  // for parse_log_extension_type, set_log_value
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <cudf/types.hpp>  // for type_id
+
+#include <algorithm>  // for all_of, any_of, find, fill, none_of, sort
+#include <array>      // for array
+#include <atomic>     // for atomic
+#include <bitset>     // for bitset
+#include <cstdint>    // for int32_t, uint8_t, uint16_t, uint32_t, uint64_t
+#include <fstream>    // for ifstream
+#include <mutex>      // for mutex, lock_guard
+#include <sstream>    // ostringstream needed by MORPHEUS_CONCAT_STR
+#include <stdexcept>  // for invalid_argument
+#include <tuple>      // for tuple
+#include <utility>    // for make_pair, move, pair
+
+namespace morpheus {
+
+namespace {
+// Counted repetitions are expanded into copies of the repeated expression, these bound the size of the program
+constexpr int MaxRepeat                = 1000;
+constexpr std::size_t MaxProgramSize   = 1 << 20;
+constexpr std::int32_t NoPosition      = -1;
+constexpr std::size_t NoMatchedPattern = static_cast<std::size_t>(-1);
+
+// Bounds of the memory used by the lazy DFA and by the backtracker extracting captures, past which matching falls back
+// to the Pike VM
+constexpr std::size_t MaxDfaStates     = 10000;
+constexpr std::size_t MaxBacktrackBits = 1 << 22;
+
+using ByteSet = std::bitset<256>;
+
+enum class Op : std::uint8_t
+{
+    Byte,    // Consume `byte`
+    Set,     // Consume a byte of the set `x`
+    Split,   // Continue at `x`, and with a lower priority at `y`
+    Jump,    // Continue at `x`
+    Save,    // Record the position in the capture slot `x`
+    Assert,  // Zero width assertion, lookarounds test the set `x`
+    Match,   // The pattern `x` matched
+};
+
+enum class AssertKind : std::uint8_t
+{
+    BeginText,
+    EndText,
+    BeginLine,
+    EndLine,
+    WordBoundary,
+    NotWordBoundary,
+    Ahead,
+    NotAhead,
+    Behind,
+    NotBehind,
+};
+
+// Where a pattern can start matching
+enum class Anchor : std::uint8_t
+{
+    None,
+    Text,
+    Line,
+};
+
+struct Inst
+{
+    Op op;
+    AssertKind assert_kind{AssertKind::BeginText};
+    std::uint8_t byte{0};
+    std::int32_t x{0};
+    std::int32_t y{0};
+};
+
+struct Node
+{
+    enum class Kind : std::uint8_t
+    {
+        Set,
+        Concat,
+        Alternate,
+        Repeat,
+        Capture,
+        Assert,
+    };
+
+    Kind kind{Kind::Concat};
+    std::vector<Node> children;
+    std::size_t set{0};
+    std::size_t column{0};
+    AssertKind assert_kind{AssertKind::BeginText};
+    int min{0};
+    int max{-1};
+    bool greedy{true};
+};
+
+bool is_word(unsigned char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+int hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+
+    return -1;
+}
+
+ByteSet byte_range(unsigned char first, unsigned char last)
+{
+    ByteSet set;
+    for (unsigned int c = first; c <= last; ++c)
+    {
+        set.set(c);
+    }
+
+    return set;
+}
+
+// Add the other case of the letters of `set`
+ByteSet fold_case(const ByteSet& set)
+{
+    auto folded = set;
+    for (unsigned int c = 'a'; c <= 'z'; ++c)
+    {
+        if (set.test(c) || set.test(c - 'a' + 'A'))
+        {
+            folded.set(c);
+            folded.set(c - 'a' + 'A');
+        }
+    }
+
+    return folded;
+}
+
+// Parses the Oniguruma subset described by `GrokMatcher`. Only named groups capture, the index of their name in
+// `capture_names` is the column written by the capture.
+class RegexParser
+{
+  public:
+    RegexParser(std::string_view regex, std::vector<ByteSet>& sets, std::vector<std::string>& capture_names) :
+      m_regex(regex),
+      m_sets(sets),
+      m_capture_names(capture_names)
+    {}
+
+    Node parse()
+    {
+        auto node = parse_alternation();
+        if (m_pos < m_regex.size())
+        {
+            fail("Unmatched ')'");
+        }
+
+        return node;
+    }
+
+  private:
+    [[noreturn]] void fail(std::string_view message) const
+    {
+        throw std::invalid_argument(
+            MORPHEUS_CONCAT_STR(message << " at offset " << m_pos << " of '" << m_regex << "'"));
+    }
+
+    bool at_end() const
+    {
+        return m_pos >= m_regex.size();
+    }
+
+    bool consume(std::string_view token)
+    {
+        if (m_regex.substr(m_pos).starts_with(token))
+        {
+            m_pos += token.size();
+            return true;
+        }
+
+        return false;
+    }
+
+    Node set_node(const ByteSet& set)
+    {
+        m_sets.push_back(m_icase ? fold_case(set) : set);
+
+        Node node;
+        node.kind = Node::Kind::Set;
+        node.set  = m_sets.size() - 1;
+
+        return node;
+    }
+
+    static Node assert_node(AssertKind kind)
+    {
+        Node node;
+        node.kind        = Node::Kind::Assert;
+        node.assert_kind = kind;
+
+        return node;
+    }
+
+    Node parse_alternation()
+    {
+        std::vector<Node> alternatives;
+        alternatives.push_back(parse_concat());
+        while (consume("|"))
+        {
+            alternatives.push_back(parse_concat());
+        }
+
+        if (alternatives.size() == 1)
+        {
+            return std::move(alternatives.front());
+        }
+
+        Node node;
+        node.kind     = Node::Kind::Alternate;
+        node.children = std::move(alternatives);
+
+        return node;
+    }
+
+    Node parse_concat()
+    {
+        Node node;
+        node.kind = Node::Kind::Concat;
+
+        while (!at_end() && m_regex[m_pos] != '|' && m_regex[m_pos] != ')')
+        {
+            // Inline flags apply to the rest of the enclosing group
+            if (consume("(?i)"))
+            {
+                m_icase = true;
+                continue;
+            }
+
+            if (consume("(?-i)"))
+            {
+                m_icase = false;
+                continue;
+            }
+
+            node.children.push_back(parse_repeat());
+        }
+
+        if (node.children.size() == 1)
+        {
+            return std::move(node.children.front());
+        }
+
+        return node;
+    }
+
+    // Parse `{n}`, `{n,}`, `{,m}` or `{n,m}`, a brace which doesn't start an interval is a literal
+    bool parse_interval(int& min, int& max)
+    {
+        auto pos = m_pos + 1;
+
+        auto parse_count = [&](int& count) {
+            auto start = pos;
+            count      = 0;
+            while (pos < m_regex.size() && m_regex[pos] >= '0' && m_regex[pos] <= '9')
+            {
+                count = std::min(count * 10 + (m_regex[pos] - '0'), MaxRepeat + 1);
+                ++pos;
+            }
+
+            return pos > start;
+        };
+
+        const bool has_min = parse_count(min);
+        if (pos < m_regex.size() && m_regex[pos] == '}')
+        {
+            if (!has_min)
+            {
+                return false;
+            }
+
+            max = min;
+        }
+        else if (pos < m_regex.size() && m_regex[pos] == ',')
+        {
+            ++pos;
+            const bool has_max = parse_count(max);
+            if (!has_min && !has_max)
+            {
+                return false;
+            }
+
+            if (!has_max)
+            {
+                max = -1;
+            }
+
+            if (pos >= m_regex.size() || m_regex[pos] != '}')
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+
+        m_pos = pos + 1;
+        return true;
+    }
+
+    Node parse_repeat()
+    {
+        auto node = parse_atom();
+
+        while (!at_end())
+        {
+            int min = 0;
+            int max = -1;
+
+            const char c = m_regex[m_pos];
+            if (c == '*' || c == '+' || c == '?')
+            {
+                min = c == '+' ? 1 : 0;
+                max = c == '?' ? 1 : -1;
+                ++m_pos;
+            }
+            else if (c != '{' || !parse_interval(min, max))
+            {
+                break;
+            }
+
+            if (min > MaxRepeat || max > MaxRepeat || (max >= 0 && max < min))
+            {
+                fail("Invalid repetition count");
+            }
+
+            if (node.kind == Node::Kind::Assert)
+            {
+                fail("Nothing to repeat");
+            }
+
+            // Possessive quantifiers are matched greedily
+            bool greedy = !consume("?");
+            if (greedy)
+            {
+                consume("+");
+            }
+
+            Node repeat;
+            repeat.kind   = Node::Kind::Repeat;
+            repeat.min    = min;
+            repeat.max    = max;
+            repeat.greedy = greedy;
+            repeat.children.push_back(std::move(node));
+            node = std::move(repeat);
+        }
+
+        return node;
+    }
+
+    Node parse_atom()
+    {
+        const char c = m_regex[m_pos++];
+        switch (c)
+        {
+        case '(':
+            return parse_group();
+        case '[':
+            return set_node(parse_class());
+        case '.': {
+            ByteSet set;
+            set.set();
+            set.reset('\n');
+            return set_node(set);
+        }
+        case '^':
+            return assert_node(AssertKind::BeginLine);
+        case '$':
+            return assert_node(AssertKind::EndLine);
+        case '\\':
+            return parse_escape();
+        case '*':
+        case '+':
+        case '?':
+            --m_pos;
+            fail("Nothing to repeat");
+        default: {
+            ByteSet set;
+            set.set(static_cast<unsigned char>(c));
+            return set_node(set);
+        }
+        }
+    }
+
+    Node parse_group()
+    {
+        // Flags set within the group don't outlive it
+        const bool icase = m_icase;
+
+        Node node;
+        if (consume("?:") || consume("?>"))
+        {
+            node = parse_alternation();
+        }
+        else if (consume("?i:") || consume("?-i:"))
+        {
+            m_icase = m_regex[m_pos - 2] == 'i' && m_regex[m_pos - 3] != '-';
+            node    = parse_alternation();
+        }
+        else if (m_regex.substr(m_pos).starts_with("?=") || m_regex.substr(m_pos).starts_with("?!") ||
+                 m_regex.substr(m_pos).starts_with("?<=") || m_regex.substr(m_pos).starts_with("?<!"))
+        {
+            const bool behind = m_regex[m_pos + 1] == '<';
+            m_pos += behind ? 2 : 1;
+            const bool negate = m_regex[m_pos++] == '!';
+
+            auto body = parse_alternation();
+            if (body.kind != Node::Kind::Set)
+            {
+                fail("Lookarounds are limited to a single character or class");
+            }
+
+            node = assert_node(behind ? (negate ? AssertKind::NotBehind : AssertKind::Behind)
+                                      : (negate ? AssertKind::NotAhead : AssertKind::Ahead));
+            node.set = body.set;
+        }
+        else if (consume("?<") || consume("?P<") || consume("?'"))
+        {
+            const char terminator = m_regex[m_pos - 1] == '\'' ? '\'' : '>';
+            const auto end        = m_regex.find(terminator, m_pos);
+            if (end == std::string_view::npos || end == m_pos)
+            {
+                fail("Invalid group name");
+            }
+
+            std::string name(m_regex.substr(m_pos, end - m_pos));
+            m_pos = end + 1;
+
+            auto found = std::find(m_capture_names.begin(), m_capture_names.end(), name);
+            if (found == m_capture_names.end())
+            {
+                m_capture_names.push_back(std::move(name));
+                found = m_capture_names.end() - 1;
+            }
+
+            node.kind   = Node::Kind::Capture;
+            node.column = static_cast<std::size_t>(found - m_capture_names.begin());
+            node.children.push_back(parse_alternation());
+        }
+        else if (consume("?"))
+        {
+            fail("Unsupported group");
+        }
+        else
+        {
+            // Unnamed groups don't capture, as in Oniguruma when a pattern has named groups
+            node = parse_alternation();
+        }
+
+        if (!consume(")"))
+        {
+            fail("Missing ')'");
+        }
+
+        m_icase = icase;
+        return node;
+    }
+
+    // Parse the escape `\c` denoting a character or a class of characters, returning false for any other escape
+    bool parse_escape_set(char c, ByteSet& set)
+    {
+        switch (c)
+        {
+        case 'd':
+        case 'D':
+            set = byte_range('0', '9');
+            break;
+        case 'w':
+        case 'W':
+            set = byte_range('a', 'z') | byte_range('A', 'Z') | byte_range('0', '9');
+            set.set('_');
+            break;
+        case 's':
+        case 'S':
+            set = byte_range('\t', '\r');
+            set.set(' ');
+            break;
+        case 'h':
+        case 'H':
+            set = byte_range('0', '9') | byte_range('a', 'f') | byte_range('A', 'F');
+            break;
+        case 't':
+            set.set('\t');
+            return true;
+        case 'n':
+            set.set('\n');
+            return true;
+        case 'r':
+            set.set('\r');
+            return true;
+        case 'f':
+            set.set('\f');
+            return true;
+        case 'v':
+            set.set('\v');
+            return true;
+        case 'a':
+            set.set('\a');
+            return true;
+        case 'e':
+            set.set(0x1B);
+            return true;
+        case 'x': {
+            const bool braced = consume("{");
+            int value         = 0;
+            int digits        = 0;
+            while (!at_end() && hex_value(m_regex[m_pos]) >= 0 && (braced || digits < 2))
+            {
+                value = std::min(value * 16 + hex_value(m_regex[m_pos++]), 0x100);
+                ++digits;
+            }
+
+            if (digits == 0 || (braced && !consume("}")))
+            {
+                fail("Invalid hexadecimal escape");
+            }
+
+            if (value > 0xFF)
+            {
+                fail("Only single byte hexadecimal escapes are supported");
+            }
+
+            set.set(static_cast<std::size_t>(value));
+            return true;
+        }
+        default:
+            return false;
+        }
+
+        if (c >= 'A' && c <= 'Z')
+        {
+            set.flip();
+        }
+
+        return true;
+    }
+
+    Node parse_escape()
+    {
+        if (at_end())
+        {
+            fail("Trailing backslash");
+        }
+
+        const char c = m_regex[m_pos++];
+        switch (c)
+        {
+        case 'b':
+            return assert_node(AssertKind::WordBoundary);
+        case 'B':
+            return assert_node(AssertKind::NotWordBoundary);
+        case 'A':
+            return assert_node(AssertKind::BeginText);
+        // Lines are matched without their trailing line break, which is all `\Z` allows to follow the end
+        case 'z':
+        case 'Z':
+            return assert_node(AssertKind::EndText);
+        default:
+            break;
+        }
+
+        ByteSet set;
+        if (parse_escape_set(c, set))
+        {
+            return set_node(set);
+        }
+
+        if ((c >= '0' && c <= '9') || c == 'k' || c == 'g')
+        {
+            fail("Backreferences and subroutine calls are not supported");
+        }
+
+        if (is_word(static_cast<unsigned char>(c)))
+        {
+            fail("Unsupported escape");
+        }
+
+        set.set(static_cast<unsigned char>(c));
+        return set_node(set);
+    }
+
+    // Parse a member of a class, returning true and setting `byte` for a single character
+    bool parse_class_member(unsigned char& byte, ByteSet& set)
+    {
+        const char c = m_regex[m_pos++];
+        if (c != '\\')
+        {
+            byte = static_cast<unsigned char>(c);
+            return true;
+        }
+
+        if (at_end())
+        {
+            fail("Missing ']'");
+        }
+
+        const char escaped = m_regex[m_pos++];
+        if (escaped == 'b')
+        {
+            byte = '\b';
+            return true;
+        }
+
+        if (!parse_escape_set(escaped, set))
+        {
+            if (is_word(static_cast<unsigned char>(escaped)))
+            {
+                fail("Unsupported escape");
+            }
+
+            byte = static_cast<unsigned char>(escaped);
+            return true;
+        }
+
+        if (set.count() == 1)
+        {
+            for (std::size_t i = 0; i < set.size(); ++i)
+            {
+                if (set.test(i))
+                {
+                    byte = static_cast<unsigned char>(i);
+                }
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    ByteSet posix_class(std::string_view name)
+    {
+        ByteSet set;
+        if (name == "alpha")
+        {
+            set = byte_range('a', 'z') | byte_range('A', 'Z');
+        }
+        else if (name == "digit")
+        {
+            set = byte_range('0', '9');
+        }
+        else if (name == "alnum")
+        {
+            set = byte_range('a', 'z') | byte_range('A', 'Z') | byte_range('0', '9');
+        }
+        else if (name == "upper")
+        {
+            set = byte_range('A', 'Z');
+        }
+        else if (name == "lower")
+        {
+            set = byte_range('a', 'z');
+        }
+        else if (name == "space")
+        {
+            set = byte_range('\t', '\r');
+            set.set(' ');
+        }
+        else if (name == "blank")
+        {
+            set.set(' ');
+            set.set('\t');
+        }
+        else if (name == "xdigit")
+        {
+            set = byte_range('0', '9') | byte_range('a', 'f') | byte_range('A', 'F');
+        }
+        else if (name == "punct")
+        {
+            set = byte_range('!', '/') | byte_range(':', '@') | byte_range('[', '`') | byte_range('{', '~');
+        }
+        else if (name == "word")
+        {
+            set = byte_range('a', 'z') | byte_range('A', 'Z') | byte_range('0', '9');
+            set.set('_');
+        }
+        else if (name == "cntrl")
+        {
+            set = byte_range(0, 0x1F);
+            set.set(0x7F);
+        }
+        else if (name == "print")
+        {
+            set = byte_range(' ', '~');
+        }
+        else if (name == "graph")
+        {
+            set = byte_range('!', '~');
+        }
+        else
+        {
+            fail("Unknown POSIX class");
+        }
+
+        return set;
+    }
+
+    ByteSet parse_class()
+    {
+        const bool negate = consume("^");
+
+        ByteSet set;
+        bool first = true;
+        while (true)
+        {
+            if (at_end())
+            {
+                fail("Missing ']'");
+            }
+
+            if (m_regex[m_pos] == ']' && !first)
+            {
+                ++m_pos;
+                break;
+            }
+
+            first = false;
+
+            if (consume("&&"))
+            {
+                fail("Class intersections are not supported");
+            }
+
+            if (m_regex.substr(m_pos).starts_with("[:"))
+            {
+                const auto end = m_regex.find(":]", m_pos + 2);
+                if (end != std::string_view::npos)
+                {
+                    auto name          = m_regex.substr(m_pos + 2, end - m_pos - 2);
+                    const bool negated = name.starts_with('^');
+                    auto posix         = posix_class(negated ? name.substr(1) : name);
+
+                    set |= negated ? ~posix : posix;
+                    m_pos = end + 2;
+                    continue;
+                }
+            }
+
+            unsigned char first_byte = 0;
+            ByteSet member;
+            if (!parse_class_member(first_byte, member))
+            {
+                set |= member;
+                continue;
+            }
+
+            // A '-' which is last in the class or follows a range is a literal
+            if (m_pos + 1 < m_regex.size() && m_regex[m_pos] == '-' && m_regex[m_pos + 1] != ']')
+            {
+                ++m_pos;
+
+                unsigned char last_byte = 0;
+                ByteSet last_member;
+                if (!parse_class_member(last_byte, last_member) || last_byte < first_byte)
+                {
+                    fail("Invalid class range");
+                }
+
+                set |= byte_range(first_byte, last_byte);
+            }
+            else
+            {
+                set.set(first_byte);
+            }
+        }
+
+        if (m_icase)
+        {
+            set = fold_case(set);
+        }
+
+        return negate ? ~set : set;
+    }
+
+    std::string_view m_regex;
+    std::size_t m_pos{0};
+    bool m_icase{false};
+    std::vector<ByteSet>& m_sets;
+    std::vector<std::string>& m_capture_names;
+};
+
+Anchor leading_anchor(const Node& node)
+{
+    switch (node.kind)
+    {
+    case Node::Kind::Assert:
+        if (node.assert_kind == AssertKind::BeginText)
+        {
+            return Anchor::Text;
+        }
+
+        return node.assert_kind == AssertKind::BeginLine ? Anchor::Line : Anchor::None;
+    case Node::Kind::Concat:
+    case Node::Kind::Capture:
+        return node.children.empty() ? Anchor::None : leading_anchor(node.children.front());
+    default:
+        return Anchor::None;
+    }
+}
+
+bool can_match_empty(const Node& node)
+{
+    switch (node.kind)
+    {
+    case Node::Kind::Set:
+        return false;
+    case Node::Kind::Concat:
+        return std::all_of(node.children.begin(), node.children.end(), can_match_empty);
+    case Node::Kind::Alternate:
+        return std::any_of(node.children.begin(), node.children.end(), can_match_empty);
+    case Node::Kind::Repeat:
+        return node.min == 0 || can_match_empty(node.children.front());
+    case Node::Kind::Capture:
+        return can_match_empty(node.children.front());
+    default:
+        return true;
+    }
+}
+
+// Instructions visited while following the instructions which don't consume a byte. Visiting an instruction twice in
+// the same step can only lead to a lower priority copy of a thread.
+struct VisitedSet
+{
+    std::vector<std::uint32_t> generations;
+    std::uint32_t generation{0};
+
+    void clear(std::size_t num_insts)
+    {
+        if (generations.size() < num_insts)
+        {
+            generations.resize(num_insts, 0);
+        }
+
+        if (++generation == 0)
+        {
+            std::fill(generations.begin(), generations.end(), 0);
+            generation = 1;
+        }
+    }
+
+    bool insert(std::int32_t pc)
+    {
+        if (generations[pc] == generation)
+        {
+            return false;
+        }
+
+        generations[pc] = generation;
+        return true;
+    }
+};
+
+struct ThreadList
+{
+    std::vector<std::int32_t> pcs;
+
+    // `num_slots` capture positions for each thread of `pcs`
+    std::vector<std::int32_t> captures;
+
+    VisitedSet visited;
+
+    void clear(std::size_t num_insts)
+    {
+        pcs.clear();
+        captures.clear();
+        visited.clear(num_insts);
+    }
+};
+
+struct Frame
+{
+    std::int32_t pc;
+
+    // Restore the capture slot `slot` to `position` once the threads following `Save` are explored
+    std::int32_t slot;
+    std::int32_t position;
+};
+
+// Scratch space of a thread matching lines, reused across lines to avoid allocating for each of them
+struct Scratch
+{
+    ThreadList current;
+    ThreadList next;
+    std::vector<std::int32_t> captures;
+    std::vector<std::int32_t> best_captures;
+    std::vector<Frame> stack;
+
+    // One bit for each instruction of a pattern and position of the line explored by the backtracker, along with the
+    // words holding set bits. Only those words are cleared after each line, as few of the bits are set.
+    std::vector<std::uint64_t> explored;
+    std::vector<std::size_t> explored_words;
+};
+
+// A state of the lazy DFA, holding the instructions reached after consuming a byte. The instructions which don't
+// consume a byte are only followed by the transitions, once the next byte is known to the assertions.
+struct DfaState
+{
+    std::vector<std::int32_t> pcs;
+
+    // Class of the byte consumed to reach the state, -1 at the start of the line
+    std::int32_t prev_class;
+
+    // First pattern which matched, the patterns following it are no longer tracked
+    std::size_t best;
+
+    // None of the patterns preceding `best` can match anymore
+    bool dead;
+
+    // Transitions by byte class, the last one for the end of the line, null until computed
+    std::unique_ptr<std::atomic<const DfaState*>[]> next;
+};
+
+// States of the lazy DFA, shared by all of the threads matching lines
+struct Dfa
+{
+    std::mutex mutex;
+    std::vector<std::unique_ptr<DfaState>> states;
+    std::map<std::tuple<std::vector<std::int32_t>, std::int32_t, std::size_t, bool>, const DfaState*> index;
+
+    // Scratch space of the transitions, guarded by `mutex`
+    VisitedSet visited;
+    std::vector<std::int32_t> stack;
+    std::vector<std::int32_t> leaves;
+};
+}  // namespace
+
+// Component-private classes.
+// ************ GrokMatcher::Program *************************//
+struct GrokMatcher::Program
+{
+    std::vector<Inst> insts;
+    std::vector<ByteSet> sets;
+
+    // Pattern of each instruction
+    std::vector<std::int32_t> inst_patterns;
+
+    // First instruction and anchoring of each pattern
+    std::vector<std::int32_t> starts;
+    std::vector<Anchor> anchors;
+
+    // The first two slots hold the range of the whole match, followed by two slots for each named capture
+    std::size_t num_slots{0};
+
+    // Bytes which none of the instructions tell apart share a class, with `class_bytes` holding a byte of each class
+    std::array<std::uint16_t, 256> byte_classes{};
+    std::vector<unsigned char> class_bytes;
+
+    // First pattern which isn't anchored to the start of the line
+    std::size_t first_unanchored{0};
+
+    mutable Dfa dfa;
+    const DfaState* dfa_start{nullptr};
+
+    // Start states of searches from within a line, by the class of the preceding byte
+    std::vector<const DfaState*> dfa_class_starts;
+
+    void emit(Op op, std::int32_t x = 0, std::int32_t y = 0)
+    {
+        if (insts.size() >= MaxProgramSize)
+        {
+            throw std::invalid_argument("Grok patterns are too large, reduce the counts of repetitions");
+        }
+
+        insts.push_back({op, AssertKind::BeginText, 0, x, y});
+    }
+
+    std::int32_t size() const
+    {
+        return static_cast<std::int32_t>(insts.size());
+    }
+
+    std::int32_t pattern_end(std::size_t pattern) const
+    {
+        return pattern + 1 < starts.size() ? starts[pattern + 1] : size();
+    }
+
+    // Compile a pattern, its instructions matching from `Save 0` to `Match`
+    void compile_pattern(const Node& root, std::size_t pattern)
+    {
+        starts.push_back(size());
+        anchors.push_back(leading_anchor(root));
+        emit(Op::Save, 0);
+        compile(root);
+        emit(Op::Save, 1);
+        emit(Op::Match, static_cast<std::int32_t>(pattern));
+        inst_patterns.resize(insts.size(), static_cast<std::int32_t>(pattern));
+
+        for (const auto& [jump, copy] : consumed_jumps)
+        {
+            insts[jump].x = consumed_targets.at(copy);
+        }
+
+        consumed_jumps.clear();
+        consumed_targets.clear();
+    }
+
+    // Like backtracking engines, a loop ends once an iteration matches the empty string. The bodies of loops which can
+    // match empty are compiled twice, the first copy leaving the loop at its end and the second one repeating it. Each
+    // byte consumed within the first copy jumps to the instruction following it in the second one.
+    //
+    // `copies` tells the copies of the loop bodies being compiled apart, holding twice the index of the copy of each
+    // enclosing loop body, plus one for the first copy of the bodies which can match empty.
+    std::vector<std::int32_t> copies;
+    std::map<std::pair<const Node*, std::vector<std::int32_t>>, std::int32_t> consumed_targets;
+    std::vector<std::pair<std::int32_t, std::pair<const Node*, std::vector<std::int32_t>>>> consumed_jumps;
+
+    // Follow the byte consumed by `node`, jumping to the second copy of the loop bodies within their first copy
+    void compile_consumed(const Node& node)
+    {
+        if (std::none_of(copies.begin(), copies.end(), [](std::int32_t copy) { return copy % 2 != 0; }))
+        {
+            consumed_targets.emplace(std::make_pair(&node, copies), size());
+            return;
+        }
+
+        auto target = copies;
+        for (auto& copy : target)
+        {
+            copy &= ~1;
+        }
+
+        consumed_jumps.emplace_back(size(), std::make_pair(&node, std::move(target)));
+        emit(Op::Jump);
+    }
+
+    // Compile the copy `copy` of the body of the loop `node`, adding the jumps leaving the loop to `exits`
+    void compile_iteration(const Node& node, std::int32_t copy, std::vector<std::int32_t>& exits)
+    {
+        const auto& body = node.children.front();
+        if (!can_match_empty(body))
+        {
+            copies.push_back(2 * copy);
+            compile(body);
+            copies.pop_back();
+            return;
+        }
+
+        copies.push_back(2 * copy + 1);
+        compile(body);
+        copies.back() = 2 * copy;
+        exits.push_back(size());
+        emit(Op::Jump);
+        compile(body);
+        copies.pop_back();
+    }
+
+    void compile(const Node& node)
+    {
+        switch (node.kind)
+        {
+        case Node::Kind::Set:
+            if (sets[node.set].count() == 1)
+            {
+                emit(Op::Byte);
+                for (std::size_t c = 0; c < 256; ++c)
+                {
+                    if (sets[node.set].test(c))
+                    {
+                        insts.back().byte = static_cast<std::uint8_t>(c);
+                    }
+                }
+            }
+            else
+            {
+                emit(Op::Set, static_cast<std::int32_t>(node.set));
+            }
+
+            compile_consumed(node);
+            break;
+        case Node::Kind::Concat:
+            for (const auto& child : node.children)
+            {
+                compile(child);
+            }
+            break;
+        case Node::Kind::Alternate: {
+            std::vector<std::int32_t> jumps;
+            for (std::size_t i = 0; i + 1 < node.children.size(); ++i)
+            {
+                const auto split = size();
+                emit(Op::Split, split + 1);
+                compile(node.children[i]);
+
+                jumps.push_back(size());
+                emit(Op::Jump);
+                insts[split].y = size();
+            }
+
+            compile(node.children.back());
+            for (auto jump : jumps)
+            {
+                insts[jump].x = size();
+            }
+            break;
+        }
+        case Node::Kind::Capture:
+            emit(Op::Save, static_cast<std::int32_t>(2 * node.column + 2));
+            compile(node.children.front());
+            emit(Op::Save, static_cast<std::int32_t>(2 * node.column + 3));
+            break;
+        case Node::Kind::Assert:
+            emit(Op::Assert, static_cast<std::int32_t>(node.set));
+            insts.back().assert_kind = node.assert_kind;
+            break;
+        case Node::Kind::Repeat: {
+            for (int i = 0; i < node.min; ++i)
+            {
+                copies.push_back(2 * i);
+                compile(node.children.front());
+                copies.pop_back();
+            }
+
+            // The preferred branch of a split is the body for greedy quantifiers and the exit for lazy ones
+            auto set_branches = [&](std::int32_t split, std::int32_t body, std::int32_t exit) {
+                insts[split].x = node.greedy ? body : exit;
+                insts[split].y = node.greedy ? exit : body;
+            };
+
+            std::vector<std::int32_t> exits;
+            if (node.max < 0)
+            {
+                const auto split = size();
+                emit(Op::Split);
+                compile_iteration(node, node.min, exits);
+                emit(Op::Jump, split);
+                set_branches(split, split + 1, size());
+            }
+            else
+            {
+                std::vector<std::int32_t> splits;
+                for (int i = node.min; i < node.max; ++i)
+                {
+                    splits.push_back(size());
+                    emit(Op::Split);
+                    compile_iteration(node, i, exits);
+                }
+
+                for (auto split : splits)
+                {
+                    set_branches(split, split + 1, size());
+                }
+            }
+
+            for (auto exit : exits)
+            {
+                insts[exit].x = size();
+            }
+            break;
+        }
+        }
+    }
+
+    // Compute the byte classes and the start state of the DFA once all of the patterns are compiled
+    void finalize()
+    {
+        std::vector<ByteSet> distinctions(sets);
+        for (const auto& inst : insts)
+        {
+            if (inst.op == Op::Byte)
+            {
+                distinctions.emplace_back().set(inst.byte);
+            }
+        }
+
+        auto& word = distinctions.emplace_back();
+        for (std::size_t c = 0; c < 256; ++c)
+        {
+            word.set(c, is_word(static_cast<unsigned char>(c)));
+        }
+
+        distinctions.emplace_back().set('\n');
+
+        // Split the classes by each set in turn
+        for (const auto& set : distinctions)
+        {
+            std::map<std::pair<std::uint16_t, bool>, std::uint16_t> classes;
+            for (std::size_t c = 0; c < 256; ++c)
+            {
+                auto [found, inserted] = classes.emplace(std::make_pair(byte_classes[c], set.test(c)), classes.size());
+                byte_classes[c]        = found->second;
+            }
+        }
+
+        for (std::size_t c = 0; c < 256; ++c)
+        {
+            if (byte_classes[c] == class_bytes.size())
+            {
+                class_bytes.push_back(static_cast<unsigned char>(c));
+            }
+        }
+
+        first_unanchored = starts.size();
+        for (std::size_t pattern = starts.size(); pattern-- > 0;)
+        {
+            if (anchors[pattern] != Anchor::Text)
+            {
+                first_unanchored = pattern;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(dfa.mutex);
+        dfa_start = add_dfa_state({}, -1, starts.size(), false);
+        for (std::size_t byte_class = 0; byte_class < class_bytes.size(); ++byte_class)
+        {
+            dfa_class_starts.push_back(add_dfa_state({}, static_cast<std::int32_t>(byte_class), starts.size(), false));
+        }
+    }
+
+    // Check an assertion between the bytes `prev` and `next`, -1 standing for the start and the end of the line
+    bool check(const Inst& inst, int prev, int next) const
+    {
+        switch (inst.assert_kind)
+        {
+        case AssertKind::BeginText:
+            return prev < 0;
+        case AssertKind::EndText:
+            return next < 0;
+        case AssertKind::BeginLine:
+            return prev < 0 || prev == '\n';
+        case AssertKind::EndLine:
+            return next < 0 || next == '\n';
+        case AssertKind::WordBoundary:
+        case AssertKind::NotWordBoundary: {
+            const bool before = prev >= 0 && is_word(static_cast<unsigned char>(prev));
+            const bool after  = next >= 0 && is_word(static_cast<unsigned char>(next));
+            return (before != after) == (inst.assert_kind == AssertKind::WordBoundary);
+        }
+        case AssertKind::Ahead:
+        case AssertKind::NotAhead:
+            return (next >= 0 && sets[inst.x].test(next)) == (inst.assert_kind == AssertKind::Ahead);
+        case AssertKind::Behind:
+        case AssertKind::NotBehind:
+            return (prev >= 0 && sets[inst.x].test(prev)) == (inst.assert_kind == AssertKind::Behind);
+        }
+
+        return false;
+    }
+
+    bool check(const Inst& inst, std::string_view line, std::size_t pos) const
+    {
+        return check(inst,
+                     pos > 0 ? static_cast<unsigned char>(line[pos - 1]) : -1,
+                     pos < line.size() ? static_cast<unsigned char>(line[pos]) : -1);
+    }
+
+    bool consumes(const Inst& inst, unsigned char c) const
+    {
+        return inst.op == Op::Byte ? c == inst.byte : (inst.op == Op::Set && sets[inst.x].test(c));
+    }
+
+    // Add the state to the DFA, or return the existing state with the same instructions. Requires `dfa.mutex`.
+    const DfaState* add_dfa_state(std::vector<std::int32_t> pcs,
+                                  std::int32_t prev_class,
+                                  std::size_t best,
+                                  bool dead) const
+    {
+        if (dead)
+        {
+            pcs.clear();
+            prev_class = -1;
+        }
+
+        auto key   = std::make_tuple(std::move(pcs), prev_class, best, dead);
+        auto found = dfa.index.find(key);
+        if (found != dfa.index.end())
+        {
+            return found->second;
+        }
+
+        auto state        = std::make_unique<DfaState>();
+        state->pcs        = std::get<0>(key);
+        state->prev_class = prev_class;
+        state->best       = best;
+        state->dead       = dead;
+        state->next       = std::make_unique<std::atomic<const DfaState*>[]>(class_bytes.size() + 1);
+        for (std::size_t i = 0; i <= class_bytes.size(); ++i)
+        {
+            state->next[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        const auto* added = state.get();
+        dfa.states.push_back(std::move(state));
+        dfa.index.emplace(std::move(key), added);
+
+        return added;
+    }
+
+    // Compute the transition of `state` on the byte class `byte_class`, `class_bytes.size()` being the end of the line.
+    // Returns null once the DFA holds `MaxDfaStates` states.
+    const DfaState* dfa_transition(const DfaState& state, std::size_t byte_class) const
+    {
+        std::lock_guard<std::mutex> lock(dfa.mutex);
+
+        // Another thread may have computed the transition in the meantime
+        if (const auto* computed = state.next[byte_class].load(std::memory_order_acquire))
+        {
+            return computed;
+        }
+
+        if (dfa.states.size() >= MaxDfaStates)
+        {
+            return nullptr;
+        }
+
+        const bool at_end = byte_class == class_bytes.size();
+        const int prev    = state.prev_class < 0 ? -1 : class_bytes[state.prev_class];
+        const int next    = at_end ? -1 : class_bytes[byte_class];
+
+        auto best = state.best;
+        dfa.visited.clear(insts.size());
+        dfa.leaves.clear();
+        dfa.stack.assign(state.pcs.begin(), state.pcs.end());
+        for (std::size_t pattern = 0; pattern < best; ++pattern)
+        {
+            if (anchors[pattern] != Anchor::Text || state.prev_class < 0)
+            {
+                dfa.stack.push_back(starts[pattern]);
+            }
+        }
+
+        // Only the set of reachable instructions matters to pick the first matching pattern, so unlike the Pike VM the
+        // order of the threads isn't kept
+        while (!dfa.stack.empty())
+        {
+            const auto pc = dfa.stack.back();
+            dfa.stack.pop_back();
+
+            if (!dfa.visited.insert(pc))
+            {
+                continue;
+            }
+
+            const auto& inst = insts[pc];
+            switch (inst.op)
+            {
+            case Op::Jump:
+                dfa.stack.push_back(inst.x);
+                break;
+            case Op::Split:
+                dfa.stack.push_back(inst.x);
+                dfa.stack.push_back(inst.y);
+                break;
+            case Op::Save:
+                dfa.stack.push_back(pc + 1);
+                break;
+            case Op::Assert:
+                if (check(inst, prev, next))
+                {
+                    dfa.stack.push_back(pc + 1);
+                }
+                break;
+            case Op::Match:
+                best = std::min(best, static_cast<std::size_t>(inst.x));
+                break;
+            default:
+                dfa.leaves.push_back(pc);
+                break;
+            }
+        }
+
+        std::vector<std::int32_t> pcs;
+        if (!at_end)
+        {
+            for (auto pc : dfa.leaves)
+            {
+                if (static_cast<std::size_t>(inst_patterns[pc]) < best &&
+                    consumes(insts[pc], static_cast<unsigned char>(next)))
+                {
+                    pcs.push_back(pc + 1);
+                }
+            }
+
+            std::sort(pcs.begin(), pcs.end());
+        }
+
+        const bool dead  = at_end || (pcs.empty() && first_unanchored >= best);
+        const auto* to   = add_dfa_state(std::move(pcs), static_cast<std::int32_t>(byte_class), best, dead);
+        state.next[byte_class].store(to, std::memory_order_release);
+
+        return to;
+    }
+
+    // Find the first pattern matching `line` from `start` with the DFA, `std::nullopt` when the DFA grows too large
+    std::optional<std::size_t> run_dfa(std::string_view line, std::size_t start) const
+    {
+        const auto* state =
+            start > 0 ? dfa_class_starts[byte_classes[static_cast<unsigned char>(line[start - 1])]] : dfa_start;
+        for (std::size_t pos = start; pos <= line.size() && !state->dead; ++pos)
+        {
+            const std::size_t byte_class =
+                pos < line.size() ? byte_classes[static_cast<unsigned char>(line[pos])] : class_bytes.size();
+
+            const auto* next = state->next[byte_class].load(std::memory_order_acquire);
+            if (next == nullptr)
+            {
+                next = dfa_transition(*state, byte_class);
+                if (next == nullptr)
+                {
+                    return std::nullopt;
+                }
+            }
+
+            state = next;
+        }
+
+        return state->best < starts.size() ? state->best : NoMatchedPattern;
+    }
+
+    // Find the captures of `pattern`, known to match `line`, by exploring its threads depth first in priority order.
+    // Each instruction is explored at most once at each position, bounding the time to the size of the bitmap.
+    bool backtrack(std::size_t pattern, std::string_view line, std::size_t start, Scratch& scratch) const
+    {
+        const auto num_words = ((pattern_end(pattern) - starts[pattern]) * (line.size() + 1) + 63) / 64;
+        if (scratch.explored.size() < num_words)
+        {
+            scratch.explored.resize(num_words, 0);
+        }
+
+        scratch.captures.assign(num_slots, NoPosition);
+
+        const auto found = backtrack_from(pattern, line, start, scratch);
+        for (auto word : scratch.explored_words)
+        {
+            scratch.explored[word] = 0;
+        }
+
+        scratch.explored_words.clear();
+        scratch.stack.clear();
+
+        return found;
+    }
+
+    // Explore the threads of `pattern` from each start position in turn, `scratch.explored` being clear
+    bool backtrack_from(std::size_t pattern, std::string_view line, std::size_t first, Scratch& scratch) const
+    {
+        const auto begin = starts[pattern];
+        const auto width = line.size() + 1;
+
+        auto& stack = scratch.stack;
+        for (std::size_t start = first; start <= line.size(); ++start)
+        {
+            if (start > 0 && anchors[pattern] == Anchor::Text)
+            {
+                break;
+            }
+
+            stack.push_back({begin, NoPosition, static_cast<std::int32_t>(start)});
+            while (!stack.empty())
+            {
+                const auto frame = stack.back();
+                stack.pop_back();
+
+                if (frame.slot != NoPosition)
+                {
+                    scratch.captures[frame.slot] = frame.position;
+                    continue;
+                }
+
+                auto pc  = frame.pc;
+                auto pos = static_cast<std::size_t>(frame.position);
+                while (true)
+                {
+                    const auto bit = static_cast<std::size_t>(pc - begin) * width + pos;
+                    auto& word     = scratch.explored[bit / 64];
+                    if ((word >> (bit % 64) & 1) != 0)
+                    {
+                        break;
+                    }
+
+                    if (word == 0)
+                    {
+                        scratch.explored_words.push_back(bit / 64);
+                    }
+
+                    word |= std::uint64_t{1} << (bit % 64);
+
+                    const auto& inst = insts[pc];
+                    if (inst.op == Op::Jump)
+                    {
+                        pc = inst.x;
+                    }
+                    else if (inst.op == Op::Split)
+                    {
+                        stack.push_back({inst.y, NoPosition, static_cast<std::int32_t>(pos)});
+                        pc = inst.x;
+                    }
+                    else if (inst.op == Op::Save)
+                    {
+                        stack.push_back({0, inst.x, scratch.captures[inst.x]});
+                        scratch.captures[inst.x] = static_cast<std::int32_t>(pos);
+                        ++pc;
+                    }
+                    else if (inst.op == Op::Assert)
+                    {
+                        if (!check(inst, line, pos))
+                        {
+                            break;
+                        }
+
+                        ++pc;
+                    }
+                    else if (inst.op == Op::Match)
+                    {
+                        scratch.best_captures = scratch.captures;
+                        return true;
+                    }
+                    else
+                    {
+                        if (pos >= line.size() || !consumes(inst, static_cast<unsigned char>(line[pos])))
+                        {
+                            break;
+                        }
+
+                        ++pc;
+                        ++pos;
+                    }
+                }
+            }
+        }
+
+        return false;
+    }
+
+    // Add the thread at `pc` to `list`, following the instructions which don't consume a byte in priority order
+    void add_thread(ThreadList& list,
+                    std::int32_t start_pc,
+                    std::size_t pos,
+                    std::string_view line,
+                    std::vector<std::int32_t>& captures,
+                    std::vector<Frame>& stack) const
+    {
+        stack.push_back({start_pc, NoPosition, 0});
+        while (!stack.empty())
+        {
+            const auto frame = stack.back();
+            stack.pop_back();
+
+            if (frame.slot != NoPosition)
+            {
+                captures[frame.slot] = frame.position;
+                continue;
+            }
+
+            auto pc = frame.pc;
+            while (list.visited.insert(pc))
+            {
+                const auto& inst = insts[pc];
+                if (inst.op == Op::Jump)
+                {
+                    pc = inst.x;
+                }
+                else if (inst.op == Op::Split)
+                {
+                    stack.push_back({inst.y, NoPosition, 0});
+                    pc = inst.x;
+                }
+                else if (inst.op == Op::Save)
+                {
+                    stack.push_back({0, inst.x, captures[inst.x]});
+                    captures[inst.x] = static_cast<std::int32_t>(pos);
+                    ++pc;
+                }
+                else if (inst.op == Op::Assert)
+                {
+                    if (!check(inst, line, pos))
+                    {
+                        break;
+                    }
+
+                    ++pc;
+                }
+                else
+                {
+                    list.pcs.push_back(pc);
+                    list.captures.insert(list.captures.end(), captures.begin(), captures.end());
+                    break;
+                }
+            }
+        }
+    }
+
+    // Run all of the patterns at the same time over the line from `start` with a Pike VM, or only the pattern `only`
+    // when set
+    std::size_t run_nfa(std::string_view line,
+                        std::size_t start,
+                        Scratch& scratch,
+                        std::size_t only = NoMatchedPattern) const
+    {
+        auto* current = &scratch.current;
+        auto* next    = &scratch.next;
+
+        current->clear(insts.size());
+        scratch.captures.assign(num_slots, NoPosition);
+
+        const auto num_patterns = starts.size();
+        auto best               = NoMatchedPattern;
+
+        const auto tracked = [&](std::size_t pattern) {
+            return pattern < std::min(best, num_patterns) && (only == NoMatchedPattern || pattern == only);
+        };
+
+        for (std::size_t pos = start; pos <= line.size(); ++pos)
+        {
+            // Start a thread of each pattern which could still be preferred over the best match, as the lowest
+            // priority thread of the pattern
+            bool can_start = false;
+            for (std::size_t pattern = 0; pattern < num_patterns; ++pattern)
+            {
+                if (!tracked(pattern))
+                {
+                    continue;
+                }
+
+                const auto anchor = anchors[pattern];
+                can_start         = can_start || anchor != Anchor::Text;
+                if (anchor == Anchor::None || pos == 0 || (anchor == Anchor::Line && line[pos - 1] == '\n'))
+                {
+                    std::fill(scratch.captures.begin(), scratch.captures.end(), NoPosition);
+                    add_thread(*current, starts[pattern], pos, line, scratch.captures, scratch.stack);
+                }
+            }
+
+            if (current->pcs.empty() && !can_start)
+            {
+                break;
+            }
+
+            next->clear(insts.size());
+
+            // Threads of a pattern following one which matched have a lower priority and are cut
+            std::int32_t cut_pattern = -1;
+            for (std::size_t i = 0; i < current->pcs.size(); ++i)
+            {
+                const auto pc      = current->pcs[i];
+                const auto pattern = inst_patterns[pc];
+                if (static_cast<std::size_t>(pattern) > best || pattern == cut_pattern)
+                {
+                    continue;
+                }
+
+                const auto* thread_captures = current->captures.data() + i * num_slots;
+                const auto& inst            = insts[pc];
+                if (inst.op == Op::Match)
+                {
+                    best        = static_cast<std::size_t>(pattern);
+                    cut_pattern = pattern;
+                    scratch.best_captures.assign(thread_captures, thread_captures + num_slots);
+                    continue;
+                }
+
+                if (pos < line.size() && consumes(inst, static_cast<unsigned char>(line[pos])))
+                {
+                    scratch.captures.assign(thread_captures, thread_captures + num_slots);
+                    add_thread(*next, pc + 1, pos + 1, line, scratch.captures, scratch.stack);
+                }
+            }
+
+            std::swap(current, next);
+        }
+
+        return best;
+    }
+
+    // Find the first pattern matching `line` from `start` and its captures. The DFA picks the pattern without tracking
+    // captures, which are then extracted by running the matching pattern alone.
+    std::size_t search(std::string_view line, std::size_t start, Scratch& scratch) const
+    {
+        const auto pattern = run_dfa(line, start);
+        if (!pattern.has_value())
+        {
+            return run_nfa(line, start, scratch);
+        }
+
+        if (*pattern == NoMatchedPattern)
+        {
+            return NoMatchedPattern;
+        }
+
+        const auto num_bits = static_cast<std::size_t>(pattern_end(*pattern) - starts[*pattern]) * (line.size() + 1);
+        if (num_bits <= MaxBacktrackBits && backtrack(*pattern, line, start, scratch))
+        {
+            return *pattern;
+        }
+
+        return run_nfa(line, start, scratch, *pattern);
+    }
+};
+
+// Component public implementations
+// ************ GrokLibrary ************************* //
+void GrokLibrary::add_pattern(const std::string& name, std::string pattern)
+{
+    if (name.empty())
+    {
+        throw std::invalid_argument("Grok pattern names can't be empty");
+    }
+
+    m_patterns[name] = std::move(pattern);
+}
+
+void GrokLibrary::load_file(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unable to read the Grok pattern file " << path));
+    }
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+
+        const auto start = line.find_first_not_of(" \t");
+        if (start == std::string::npos || line[start] == '#')
+        {
+            continue;
+        }
+
+        const auto name_end      = line.find_first_of(" \t", start);
+        const auto pattern_start = name_end == std::string::npos ? name_end : line.find_first_not_of(" \t", name_end);
+        if (pattern_start == std::string::npos)
+        {
+            throw std::invalid_argument(
+                MORPHEUS_CONCAT_STR("Missing the pattern of '" << line.substr(start) << "' in the Grok pattern file "
+                                                               << path));
+        }
+
+        add_pattern(line.substr(start, name_end - start), line.substr(pattern_start));
+    }
+}
+
+GrokExpansion GrokLibrary::expand(std::string_view pattern) const
+{
+    GrokExpansion expansion;
+    std::vector<std::string> stack;
+    expand(pattern, stack, expansion);
+
+    return expansion;
+}
+
+void GrokLibrary::expand(std::string_view pattern, std::vector<std::string>& stack, GrokExpansion& expansion) const
+{
+    for (std::size_t pos = 0; pos < pattern.size();)
+    {
+        // Escaped characters are copied as they are, `\%{` isn't a reference
+        if (pattern[pos] == '\\')
+        {
+            expansion.regex.append(pattern.substr(pos, 2));
+            pos += 2;
+            continue;
+        }
+
+        if (!pattern.substr(pos).starts_with("%{"))
+        {
+            expansion.regex.push_back(pattern[pos++]);
+            continue;
+        }
+
+        const auto end = pattern.find('}', pos);
+        if (end == std::string_view::npos)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unterminated Grok reference in '" << pattern << "'"));
+        }
+
+        // NAME, NAME:field or NAME:field:type
+        auto reference        = pattern.substr(pos + 2, end - pos - 2);
+        const auto field_pos  = reference.find(':');
+        const auto name       = reference.substr(0, field_pos);
+        std::string_view field;
+        std::string_view type_name = "str";
+        if (field_pos != std::string_view::npos)
+        {
+            field           = reference.substr(field_pos + 1);
+            const auto type = field.find(':');
+            if (type != std::string_view::npos)
+            {
+                type_name = field.substr(type + 1);
+                field     = field.substr(0, type);
+            }
+        }
+
+        auto found = m_patterns.find(name);
+        if (found == m_patterns.end())
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unknown Grok pattern '" << name << "'"));
+        }
+
+        if (std::find(stack.begin(), stack.end(), name) != stack.end())
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Recursive Grok pattern '" << name << "'"));
+        }
+
+        if (field.empty())
+        {
+            expansion.regex.append("(?:");
+        }
+        else
+        {
+            if (field.find_first_of("<>'") != std::string_view::npos)
+            {
+                throw std::invalid_argument(MORPHEUS_CONCAT_STR("Invalid Grok field name '" << field << "'"));
+            }
+
+            cudf::type_id type;
+            try
+            {
+                type = parse_log_extension_type(std::string(type_name));
+            } catch (const std::invalid_argument&)
+            {
+                throw std::invalid_argument(
+                    MORPHEUS_CONCAT_STR("Unknown type '" << type_name << "' of the Grok field '" << field
+                                                         << "', must be one of: str, int, float, bool, timestamp"));
+            }
+
+            auto capture = std::find_if(expansion.captures.begin(), expansion.captures.end(), [&](const auto& spec) {
+                return spec.name == field;
+            });
+
+            if (capture == expansion.captures.end())
+            {
+                expansion.captures.push_back({std::string(field), type});
+            }
+            else if (capture->type != type)
+            {
+                throw std::invalid_argument(
+                    MORPHEUS_CONCAT_STR("The Grok field '" << field << "' is captured with different types"));
+            }
+
+            expansion.regex.append("(?<").append(field).append(">");
+        }
+
+        stack.emplace_back(name);
+        expand(found->second, stack, expansion);
+        stack.pop_back();
+
+        expansion.regex.push_back(')');
+        pos = end + 1;
+    }
+}
+
+// ************ GrokMatcher ************************* //
+GrokMatcher::GrokMatcher(const GrokLibrary& library, const std::vector<std::string>& patterns, int syslog_year) :
+  m_syslog_year(syslog_year)
+{
+    if (patterns.empty())
+    {
+        throw std::invalid_argument("At least one Grok pattern is required");
+    }
+
+    auto program = std::make_shared<Program>();
+
+    std::vector<std::string> names;
+    std::map<std::string, cudf::type_id> types;
+    for (std::size_t i = 0; i < patterns.size(); ++i)
+    {
+        auto expansion = library.expand(patterns[i]);
+        for (const auto& capture : expansion.captures)
+        {
+            auto [found, inserted] = types.emplace(capture.name, capture.type);
+            if (!inserted && found->second != capture.type)
+            {
+                throw std::invalid_argument(
+                    MORPHEUS_CONCAT_STR("The Grok field '" << capture.name << "' is captured with different types"));
+            }
+        }
+
+        Node root;
+        try
+        {
+            root = RegexParser(expansion.regex, program->sets, names).parse();
+        } catch (const std::invalid_argument& e)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Invalid Grok pattern " << i << ": " << e.what()));
+        }
+
+        program->compile_pattern(root, i);
+    }
+
+    for (const auto& name : names)
+    {
+        auto type = types.find(name);
+        m_columns.push_back({name, type == types.end() ? cudf::type_id::STRING : type->second});
+    }
+
+    program->num_slots = 2 * names.size() + 2;
+    program->finalize();
+    m_program = std::move(program);
+}
+
+const std::vector<DecodedColumnSpec>& GrokMatcher::columns() const
+{
+    return m_columns;
+}
+
+std::size_t GrokMatcher::num_patterns() const
+{
+    return m_program->starts.size();
+}
+
+std::optional<std::size_t> GrokMatcher::match(std::string_view line,
+                                              DecodedTable& table,
+                                              const std::vector<std::size_t>& column_indices) const
+{
+    thread_local Scratch scratch;
+
+    while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
+    {
+        line.remove_suffix(1);
+    }
+
+    const auto pattern = m_program->search(line, 0, scratch);
+    if (pattern == NoMatchedPattern)
+    {
+        return std::nullopt;
+    }
+
+    for (std::size_t i = 0; i < m_columns.size(); ++i)
+    {
+        const auto start = scratch.best_captures[2 * i + 2];
+        const auto end   = scratch.best_captures[2 * i + 3];
+        if (start != NoPosition && end >= start)
+        {
+            set_log_value(table, column_indices[i], m_columns[i].type, line.substr(start, end - start), m_syslog_year);
+        }
+    }
+
+    return pattern;
+}
+
+std::optional<GrokMatch> GrokMatcher::find(std::string_view text, std::size_t start) const
+{
+    thread_local Scratch scratch;
+
+    if (start > text.size())
+    {
+        return std::nullopt;
+    }
+
+    const auto pattern = m_program->search(text, start, scratch);
+    if (pattern == NoMatchedPattern)
+    {
+        return std::nullopt;
+    }
+
+    return GrokMatch{pattern,
+                     static_cast<std::size_t>(scratch.best_captures[0]),
+                     static_cast<std::size_t>(scratch.best_captures[1])};
+}
+
+}  // namespace morpheus
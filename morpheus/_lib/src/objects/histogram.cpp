@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/histogram.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <algorithm>  // for fill, max
+#include <cmath>      // for log, abs
+#include <stdexcept>  // for invalid_argument
+
+namespace morpheus {
+
+// Component public implementations
+// ************ FixedWidthHistogram ************************* //
+FixedWidthHistogram::FixedWidthHistogram(std::size_t num_buckets, double lower, double upper) :
+  m_lower(lower),
+  m_upper(upper),
+  m_scale(0.0),
+  m_last_bucket(num_buckets == 0 ? 0 : num_buckets - 1),
+  m_counts(num_buckets, 0)
+{
+    if (num_buckets == 0)
+    {
+        throw std::invalid_argument("FixedWidthHistogram requires at least one bucket");
+    }
+
+    if (!(upper > lower))
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("FixedWidthHistogram upper bound (" << upper
+                                                                                            << ") must be greater than "
+                                                                                               "the lower bound ("
+                                                                                            << lower << ")"));
+    }
+
+    m_scale = static_cast<double>(num_buckets) / (upper - lower);
+}
+
+void FixedWidthHistogram::add(const double* values, std::size_t count, std::size_t stride)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        this->add(values[i * stride]);
+    }
+}
+
+void FixedWidthHistogram::merge(const FixedWidthHistogram& other)
+{
+    if (other.m_counts.size() != m_counts.size())
+    {
+        throw std::invalid_argument("Cannot merge histograms with a different number of buckets");
+    }
+
+    for (std::size_t i = 0; i < m_counts.size(); ++i)
+    {
+        m_counts[i] += other.m_counts[i];
+    }
+
+    m_total += other.m_total;
+}
+
+void FixedWidthHistogram::clear()
+{
+    std::fill(m_counts.begin(), m_counts.end(), 0);
+    m_total = 0;
+}
+
+std::size_t FixedWidthHistogram::num_buckets() const
+{
+    return m_counts.size();
+}
+
+double FixedWidthHistogram::lower() const
+{
+    return m_lower;
+}
+
+double FixedWidthHistogram::upper() const
+{
+    return m_upper;
+}
+
+const std::vector<std::uint64_t>& FixedWidthHistogram::counts() const
+{
+    return m_counts;
+}
+
+std::uint64_t FixedWidthHistogram::total() const
+{
+    return m_total;
+}
+
+std::vector<double> FixedWidthHistogram::proportions(double epsilon) const
+{
+    std::vector<double> result(m_counts.size(), epsilon);
+
+    if (m_total == 0)
+    {
+        return result;
+    }
+
+    for (std::size_t i = 0; i < m_counts.size(); ++i)
+    {
+        result[i] = std::max(static_cast<double>(m_counts[i]) / static_cast<double>(m_total), epsilon);
+    }
+
+    return result;
+}
+
+DriftMetrics FixedWidthHistogram::compare(const FixedWidthHistogram& reference, double epsilon) const
+{
+    return FixedWidthHistogram::compare(reference.proportions(epsilon), this->proportions(epsilon));
+}
+
+DriftMetrics FixedWidthHistogram::compare(const std::vector<double>& reference, const std::vector<double>& current)
+{
+    if (reference.size() != current.size())
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Reference distribution has " << reference.size()
+                                                                                      << " buckets, expected "
+                                                                                      << current.size()));
+    }
+
+    DriftMetrics metrics;
+
+    double reference_cdf = 0.0;
+    double current_cdf   = 0.0;
+
+    for (std::size_t i = 0; i < current.size(); ++i)
+    {
+        const double ratio = std::log(current[i] / reference[i]);
+
+        metrics.psi += (current[i] - reference[i]) * ratio;
+        metrics.kl += current[i] * ratio;
+
+        reference_cdf += reference[i];
+        current_cdf += current[i];
+        metrics.ks = std::max(metrics.ks, std::abs(current_cdf - reference_cdf));
+    }
+
+    return metrics;
+}
+
+}  // namespace morpheus
@@ -0,0 +1,383 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/model_registry.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <glog/logging.h>       // for LOG
+#include <pybind11/gil.h>       // for gil_scoped_release
+#include <pybind11/pybind11.h>  // for bytes, make_tuple
+
+#include <algorithm>  // for find, max
+#include <chrono>     // for steady_clock, duration
+#include <exception>  // for current_exception, exception
+#include <fstream>    // for ifstream
+#include <iterator>   // for istreambuf_iterator
+#include <stdexcept>  // for invalid_argument, runtime_error
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace py = pybind11;
+
+/****** ModelRegistry***************************************/
+ModelRegistry::ModelRegistry(std::filesystem::path model_dir,
+                             std::size_t memory_budget,
+                             std::vector<std::string> fallback_entities,
+                             std::string model_name_formatter,
+                             std::size_t num_threads) :
+  m_model_dir(std::filesystem::weakly_canonical(model_dir)),
+  m_memory_budget(memory_budget),
+  m_fallback_entities(std::move(fallback_entities)),
+  m_model_name_formatter(std::move(model_name_formatter))
+{
+    const auto num_workers = num_threads == 0 ? std::max(1U, std::thread::hardware_concurrency()) : num_threads;
+    for (std::size_t i = 0; i < num_workers; ++i)
+    {
+        m_workers.emplace_back(&ModelRegistry::worker, this);
+    }
+}
+
+ModelRegistry::~ModelRegistry()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+        m_queue.clear();
+    }
+
+    m_queue_cv.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+std::string ModelRegistry::model_name(const std::string& entity) const
+{
+    static const std::string placeholder{"{user_id}"};
+
+    std::string name = m_model_name_formatter;
+    for (auto pos = name.find(placeholder); pos != std::string::npos;
+         pos      = name.find(placeholder, pos + entity.size()))
+    {
+        name.replace(pos, placeholder.size(), entity);
+    }
+
+    return name;
+}
+
+std::optional<ModelEntry> ModelRegistry::get(const std::string& entity)
+{
+    if (auto blob = load(model_name(entity), false))
+    {
+        return ModelEntry{entity, model_name(entity), std::move(blob)};
+    }
+
+    for (const auto& fallback : m_fallback_entities)
+    {
+        if (auto blob = load(model_name(fallback), false))
+        {
+            return ModelEntry{fallback, model_name(fallback), std::move(blob)};
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_stats.not_found;
+
+    return std::nullopt;
+}
+
+void ModelRegistry::prefetch(const std::vector<std::string>& entities)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& entity : entities)
+        {
+            if (m_index.find(model_name(entity)) != m_index.end() ||
+                std::find(m_queue.begin(), m_queue.end(), entity) != m_queue.end())
+            {
+                continue;
+            }
+
+            m_queue.push_back(entity);
+        }
+    }
+
+    m_queue_cv.notify_all();
+}
+
+void ModelRegistry::wait_for_prefetch()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle_cv.wait(lock, [this]() {
+        return m_queue.empty() && m_active_prefetches == 0;
+    });
+}
+
+bool ModelRegistry::is_resident(const std::string& model_name) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_index.find(model_name) != m_index.end();
+}
+
+ModelRegistryStats ModelRegistry::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto stats            = m_stats;
+    stats.resident_models = m_entries.size();
+    stats.resident_bytes  = m_resident_bytes;
+
+    return stats;
+}
+
+ModelRegistry::blob_t ModelRegistry::load(const std::string& model_name, bool is_prefetch)
+{
+    bool exists_checked = false;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        auto found = m_index.find(model_name);
+        if (found != m_index.end())
+        {
+            if (!is_prefetch)
+            {
+                ++m_stats.hits;
+                m_entries.splice(m_entries.begin(), m_entries, found->second);
+            }
+
+            return found->second->second;
+        }
+
+        auto pending = m_pending.find(model_name);
+        if (pending != m_pending.end())
+        {
+            auto future = pending->second;
+            if (!is_prefetch)
+            {
+                ++m_stats.misses;
+            }
+
+            lock.unlock();
+            return future.get();
+        }
+
+        if (exists_checked)
+        {
+            break;
+        }
+
+        // Check for the file without holding the lock, the model may have been read in the meantime
+        lock.unlock();
+        if (!std::filesystem::exists(model_path(model_name)))
+        {
+            return nullptr;
+        }
+
+        exists_checked = true;
+        lock.lock();
+    }
+
+    std::promise<blob_t> promise;
+    m_pending.emplace(model_name, promise.get_future().share());
+    ++(is_prefetch ? m_stats.prefetches : m_stats.misses);
+    lock.unlock();
+
+    blob_t blob;
+    const auto start = std::chrono::steady_clock::now();
+    try
+    {
+        blob = read_model(model_name);
+    } catch (...)
+    {
+        lock.lock();
+        m_pending.erase(model_name);
+        lock.unlock();
+
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+
+    const auto load_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    lock.lock();
+    ++m_stats.loads;
+    m_stats.total_load_ms += load_ms;
+    m_stats.max_load_ms = std::max(m_stats.max_load_ms, load_ms);
+
+    if (blob)
+    {
+        insert(model_name, blob);
+    }
+
+    m_pending.erase(model_name);
+    lock.unlock();
+
+    promise.set_value(blob);
+
+    return blob;
+}
+
+std::filesystem::path ModelRegistry::model_path(const std::string& model_name) const
+{
+    // Entities come from the data, a name such as `../x` or `/etc/x` must not reach files outside of the directory
+    auto path           = std::filesystem::weakly_canonical(m_model_dir / model_name);
+    const auto relative = path.lexically_relative(m_model_dir);
+    if (relative.empty() || relative == "." || *relative.begin() == "..")
+    {
+        throw std::invalid_argument(
+            MORPHEUS_CONCAT_STR("Model '" << model_name << "' is outside of the model directory " << m_model_dir));
+    }
+
+    return path;
+}
+
+ModelRegistry::blob_t ModelRegistry::read_model(const std::string& model_name)
+{
+    const auto path = model_path(model_name);
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        // Removed since checking for it
+        return nullptr;
+    }
+
+    auto blob = std::make_shared<std::string>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    if (file.bad())
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR("Error reading model '" << path << "'"));
+    }
+
+    return blob;
+}
+
+void ModelRegistry::insert(const std::string& model_name, blob_t blob)
+{
+    // Models which don't fit in the budget are handed out without being kept
+    if (blob->size() > m_memory_budget)
+    {
+        return;
+    }
+
+    m_resident_bytes += blob->size();
+    m_entries.emplace_front(model_name, std::move(blob));
+    m_index[model_name] = m_entries.begin();
+
+    evict();
+}
+
+void ModelRegistry::evict()
+{
+    while (m_resident_bytes > m_memory_budget && !m_entries.empty())
+    {
+        auto& [name, blob] = m_entries.back();
+
+        m_resident_bytes -= blob->size();
+        m_index.erase(name);
+        m_entries.pop_back();
+        ++m_stats.evictions;
+    }
+}
+
+void ModelRegistry::worker()
+{
+    while (true)
+    {
+        std::string entity;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_queue_cv.wait(lock, [this]() {
+                return m_stopping || !m_queue.empty();
+            });
+
+            if (m_stopping)
+            {
+                return;
+            }
+
+            entity = std::move(m_queue.front());
+            m_queue.pop_front();
+            ++m_active_prefetches;
+        }
+
+        try
+        {
+            if (!load(model_name(entity), true))
+            {
+                for (const auto& fallback : m_fallback_entities)
+                {
+                    if (load(model_name(fallback), true))
+                    {
+                        break;
+                    }
+                }
+            }
+        } catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Error prefetching the model of '" << entity << "': " << e.what();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_active_prefetches;
+        }
+
+        m_idle_cv.notify_all();
+    }
+}
+
+/****** ModelRegistryInterfaceProxy*************************/
+py::object ModelRegistryInterfaceProxy::get(ModelRegistry& self, const std::string& entity)
+{
+    std::optional<ModelEntry> entry;
+    {
+        py::gil_scoped_release nogil;
+        entry = self.get(entity);
+    }
+
+    if (!entry.has_value())
+    {
+        return py::none();
+    }
+
+    return py::make_tuple(entry->entity, entry->model_name, py::bytes(*entry->blob));
+}
+
+py::dict ModelRegistryInterfaceProxy::stats(ModelRegistry& self)
+{
+    auto stats = self.stats();
+
+    py::dict result;
+    result["hits"]            = stats.hits;
+    result["misses"]          = stats.misses;
+    result["not_found"]       = stats.not_found;
+    result["loads"]           = stats.loads;
+    result["prefetches"]      = stats.prefetches;
+    result["evictions"]       = stats.evictions;
+    result["total_load_ms"]   = stats.total_load_ms;
+    result["max_load_ms"]     = stats.max_load_ms;
+    result["resident_models"] = stats.resident_models;
+    result["resident_bytes"]  = stats.resident_bytes;
+
+    return result;
+}
+
+}  // namespace morpheus
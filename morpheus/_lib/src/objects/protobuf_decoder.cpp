@@ -0,0 +1,1050 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/protobuf_decoder.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>  // for find
+#include <cctype>     // for isalnum, isspace, toupper
+#include <cstring>    // for memcpy
+#include <sstream>    // ostringstream needed by MORPHEUS_CONCAT_STR
+#include <stdexcept>  // for invalid_argument, runtime_error
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace {
+using FieldType = ProtobufSchema::FieldType;
+
+// Nesting of messages within a record beyond this depth is rejected, it is only reached by recursive messages
+constexpr std::size_t MaxDepth = 100;
+
+enum WireType : std::uint32_t
+{
+    Varint = 0,
+    I64    = 1,
+    Len    = 2,
+    I32    = 5
+};
+
+const std::map<std::string, FieldType> ScalarTypes = {{"double", FieldType::Double},
+                                                      {"float", FieldType::Float},
+                                                      {"int32", FieldType::Int32},
+                                                      {"int64", FieldType::Int64},
+                                                      {"uint32", FieldType::UInt32},
+                                                      {"uint64", FieldType::UInt64},
+                                                      {"sint32", FieldType::SInt32},
+                                                      {"sint64", FieldType::SInt64},
+                                                      {"fixed32", FieldType::Fixed32},
+                                                      {"fixed64", FieldType::Fixed64},
+                                                      {"sfixed32", FieldType::SFixed32},
+                                                      {"sfixed64", FieldType::SFixed64},
+                                                      {"bool", FieldType::Bool},
+                                                      {"string", FieldType::String},
+                                                      {"bytes", FieldType::Bytes}};
+
+// Wire type of the values of a field, the values of repeated scalar fields may also be packed
+WireType wire_type(FieldType type)
+{
+    switch (type)
+    {
+    case FieldType::Double:
+    case FieldType::Fixed64:
+    case FieldType::SFixed64:
+        return I64;
+    case FieldType::Float:
+    case FieldType::Fixed32:
+    case FieldType::SFixed32:
+        return I32;
+    case FieldType::String:
+    case FieldType::Bytes:
+    case FieldType::Message:
+        return Len;
+    default:
+        return Varint;
+    }
+}
+
+class WireReader
+{
+  public:
+    WireReader(std::string_view data) : m_data(data) {}
+
+    std::uint64_t read_varint()
+    {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0;; shift += 7)
+        {
+            if (m_pos >= m_data.size() || shift >= 64)
+            {
+                throw std::runtime_error("Malformed Protobuf record, truncated or overlong varint");
+            }
+
+            const auto byte = static_cast<std::uint8_t>(m_data[m_pos++]);
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+    }
+
+    // Fixed width values are little endian, the same as the hosts we run on
+    template <typename T>
+    T read_fixed()
+    {
+        T value;
+        std::memcpy(&value, read_raw(sizeof(T)).data(), sizeof(T));
+
+        return value;
+    }
+
+    std::string_view read_bytes()
+    {
+        return read_raw(read_varint());
+    }
+
+    void skip(std::uint32_t wire)
+    {
+        switch (wire)
+        {
+        case Varint:
+            read_varint();
+            break;
+        case I64:
+            read_raw(8);
+            break;
+        case Len:
+            read_bytes();
+            break;
+        case I32:
+            read_raw(4);
+            break;
+        default:
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Unsupported Protobuf wire type " << wire));
+        }
+    }
+
+    bool at_end() const
+    {
+        return m_pos == m_data.size();
+    }
+
+  private:
+    std::string_view read_raw(std::uint64_t size)
+    {
+        if (size > m_data.size() - m_pos)
+        {
+            throw std::runtime_error("Malformed Protobuf record, truncated value");
+        }
+
+        auto value = m_data.substr(m_pos, size);
+        m_pos += size;
+
+        return value;
+    }
+
+    std::string_view m_data;
+    std::size_t m_pos{0};
+};
+
+// Check that a value of `field` is encoded with `wire`
+void check_wire_type(const ProtobufSchema::Field& field, std::uint32_t wire)
+{
+    if (wire_type(field.type) != wire)
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR("Malformed Protobuf record, field '"
+                                                     << field.name << "' has the wrong wire type " << wire));
+    }
+}
+
+std::string enum_name(const ProtobufSchema::Enum& enum_type, std::int32_t value)
+{
+    auto found = enum_type.values.find(value);
+    return found != enum_type.values.end() ? found->second : std::to_string(value);
+}
+
+std::int64_t zigzag(std::uint64_t value)
+{
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+nlohmann::json message_to_json(const ProtobufSchema::Message& message, std::string_view data, std::size_t depth);
+
+// A single value of `field`
+nlohmann::json value_to_json(const ProtobufSchema::Field& field,
+                             WireReader& reader,
+                             std::uint32_t wire,
+                             std::size_t depth)
+{
+    check_wire_type(field, wire);
+
+    switch (field.type)
+    {
+    case FieldType::Double:
+        return reader.read_fixed<double>();
+    case FieldType::Float:
+        return reader.read_fixed<float>();
+    case FieldType::Int32:
+        return static_cast<std::int32_t>(reader.read_varint());
+    case FieldType::Int64:
+        return static_cast<std::int64_t>(reader.read_varint());
+    case FieldType::UInt32:
+        return static_cast<std::uint32_t>(reader.read_varint());
+    case FieldType::UInt64:
+        return reader.read_varint();
+    case FieldType::SInt32:
+    case FieldType::SInt64:
+        return zigzag(reader.read_varint());
+    case FieldType::Fixed32:
+        return reader.read_fixed<std::uint32_t>();
+    case FieldType::Fixed64:
+        return reader.read_fixed<std::uint64_t>();
+    case FieldType::SFixed32:
+        return reader.read_fixed<std::int32_t>();
+    case FieldType::SFixed64:
+        return reader.read_fixed<std::int64_t>();
+    case FieldType::Bool:
+        return reader.read_varint() != 0;
+    case FieldType::String:
+    case FieldType::Bytes:
+        return std::string(reader.read_bytes());
+    case FieldType::Enum:
+        return enum_name(*field.enum_type, static_cast<std::int32_t>(reader.read_varint()));
+    case FieldType::Message:
+        return message_to_json(*field.message_type, reader.read_bytes(), depth + 1);
+    }
+
+    throw std::logic_error("Unknown Protobuf field type");
+}
+
+// Default value of the field `field` of a map entry
+nlohmann::json default_json(const ProtobufSchema::Field& field)
+{
+    switch (field.type)
+    {
+    case FieldType::Double:
+    case FieldType::Float:
+        return 0.0;
+    case FieldType::Bool:
+        return false;
+    case FieldType::String:
+    case FieldType::Bytes:
+        return "";
+    case FieldType::Enum:
+        return enum_name(*field.enum_type, 0);
+    case FieldType::Message:
+        return nlohmann::json::object();
+    default:
+        return 0;
+    }
+}
+
+// Append a value of the repeated field `field` to `values`, an object for maps and an array otherwise
+void append_repeated(const ProtobufSchema::Field& field,
+                     WireReader& reader,
+                     std::uint32_t wire,
+                     nlohmann::json& values,
+                     std::size_t depth)
+{
+    if (field.is_map)
+    {
+        check_wire_type(field, wire);
+
+        const auto& entry = *field.message_type;
+        auto json         = message_to_json(entry, reader.read_bytes(), depth + 1);
+
+        auto key   = json.contains("key") ? json["key"] : default_json(entry.fields[0]);
+        auto value = json.contains("value") ? json["value"] : default_json(entry.fields[1]);
+
+        values[key.is_string() ? key.get<std::string>() : key.dump()] = std::move(value);
+        return;
+    }
+
+    // Repeated scalars are usually packed into a single length delimited value
+    if (wire == Len && wire_type(field.type) != Len)
+    {
+        WireReader packed(reader.read_bytes());
+        while (!packed.at_end())
+        {
+            values.push_back(value_to_json(field, packed, wire_type(field.type), depth));
+        }
+
+        return;
+    }
+
+    values.push_back(value_to_json(field, reader, wire, depth));
+}
+
+nlohmann::json message_to_json(const ProtobufSchema::Message& message, std::string_view data, std::size_t depth)
+{
+    if (depth > MaxDepth)
+    {
+        throw std::runtime_error("Malformed Protobuf record, messages are nested too deeply");
+    }
+
+    auto json = nlohmann::json::object();
+
+    WireReader reader(data);
+    while (!reader.at_end())
+    {
+        const auto key  = reader.read_varint();
+        const auto wire = static_cast<std::uint32_t>(key & 7);
+
+        auto found = message.field_index.find(static_cast<std::uint32_t>(key >> 3));
+        if (found == message.field_index.end())
+        {
+            reader.skip(wire);
+            continue;
+        }
+
+        const auto& field = message.fields[found->second];
+        if (field.repeated)
+        {
+            auto& values = json[field.name];
+            if (values.is_null())
+            {
+                values = field.is_map ? nlohmann::json::object() : nlohmann::json::array();
+            }
+
+            append_repeated(field, reader, wire, values, depth);
+        }
+        else if (field.type == FieldType::Message && json.contains(field.name))
+        {
+            // A message which appears more than once is merged
+            json[field.name].update(message_to_json(*field.message_type, reader.read_bytes(), depth + 1));
+        }
+        else
+        {
+            json[field.name] = value_to_json(field, reader, wire, depth);
+        }
+    }
+
+    return json;
+}
+
+// Write a value of the singular field `field` to `column`
+void write_value(
+    const ProtobufSchema::Field& field, WireReader& reader, std::uint32_t wire, DecodedTable& table, std::size_t column)
+{
+    check_wire_type(field, wire);
+
+    switch (field.type)
+    {
+    case FieldType::Double:
+        table.set_float(column, reader.read_fixed<double>());
+        break;
+    case FieldType::Float:
+        table.set_float(column, reader.read_fixed<float>());
+        break;
+    case FieldType::Int32:
+        table.set_int(column, static_cast<std::int32_t>(reader.read_varint()));
+        break;
+    case FieldType::Int64:
+        table.set_int(column, static_cast<std::int64_t>(reader.read_varint()));
+        break;
+    case FieldType::UInt32:
+        table.set_uint(column, static_cast<std::uint32_t>(reader.read_varint()));
+        break;
+    case FieldType::UInt64:
+        table.set_uint(column, reader.read_varint());
+        break;
+    case FieldType::SInt32:
+    case FieldType::SInt64:
+        table.set_int(column, zigzag(reader.read_varint()));
+        break;
+    case FieldType::Fixed32:
+        table.set_uint(column, reader.read_fixed<std::uint32_t>());
+        break;
+    case FieldType::Fixed64:
+        table.set_uint(column, reader.read_fixed<std::uint64_t>());
+        break;
+    case FieldType::SFixed32:
+        table.set_int(column, reader.read_fixed<std::int32_t>());
+        break;
+    case FieldType::SFixed64:
+        table.set_int(column, reader.read_fixed<std::int64_t>());
+        break;
+    case FieldType::Bool:
+        table.set_int(column, reader.read_varint() != 0 ? 1 : 0);
+        break;
+    case FieldType::String:
+    case FieldType::Bytes:
+        table.set_string(column, reader.read_bytes());
+        break;
+    case FieldType::Enum:
+        table.set_string(column, enum_name(*field.enum_type, static_cast<std::int32_t>(reader.read_varint())));
+        break;
+    case FieldType::Message:
+        // Recursive messages aren't flattened
+        table.set_string(column,
+                         message_to_json(*field.message_type, reader.read_bytes(), 1)
+                             .dump(-1, ' ', false, nlohmann::json::error_handler_t::replace));
+        break;
+    }
+}
+
+// Write the default value of the singular field `field` to `column`
+void write_default(const ProtobufSchema::Field& field, DecodedTable& table, std::size_t column)
+{
+    switch (field.type)
+    {
+    case FieldType::Double:
+    case FieldType::Float:
+        table.set_float(column, 0.0);
+        break;
+    case FieldType::String:
+    case FieldType::Bytes:
+        table.set_string(column, "");
+        break;
+    case FieldType::Enum:
+        table.set_string(column, enum_name(*field.enum_type, 0));
+        break;
+    case FieldType::Message:
+        break;
+    default:
+        table.set_int(column, 0);
+    }
+}
+}  // namespace
+
+// Component private implementations
+// ************ ProtobufSchema::Parser ************ //
+class ProtobufSchema::Parser
+{
+  public:
+    Parser(std::string_view text) : m_text(text) {}
+
+    // The next token, an identifier, number, quoted string or a single symbol. Empty at the end of the text.
+    std::string peek()
+    {
+        skip_space();
+        if (m_pos >= m_text.size())
+        {
+            return {};
+        }
+
+        auto is_word = [](char c) {
+            return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '.';
+        };
+
+        std::size_t end = m_pos + 1;
+        if (m_text[m_pos] == '"' || m_text[m_pos] == '\'')
+        {
+            while (end < m_text.size() && m_text[end] != m_text[m_pos])
+            {
+                end += m_text[end] == '\\' ? 2 : 1;
+            }
+
+            if (end >= m_text.size())
+            {
+                throw std::invalid_argument("Invalid Protobuf schema, unterminated string");
+            }
+
+            ++end;
+        }
+        else if (is_word(m_text[m_pos]))
+        {
+            while (end < m_text.size() && is_word(m_text[end]))
+            {
+                ++end;
+            }
+        }
+
+        return std::string(m_text.substr(m_pos, end - m_pos));
+    }
+
+    std::string next()
+    {
+        auto token = peek();
+        if (token.empty())
+        {
+            throw std::invalid_argument("Invalid Protobuf schema, unexpected end of the schema");
+        }
+
+        m_pos += token.size();
+
+        return token;
+    }
+
+    void expect(const std::string& expected)
+    {
+        auto token = next();
+        if (token != expected)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Invalid Protobuf schema, expected '"
+                                                            << expected << "' but found '" << token << "'"));
+        }
+    }
+
+    std::int32_t next_number()
+    {
+        auto token    = next();
+        bool negative = token == "-";
+        if (negative)
+        {
+            token = next();
+        }
+
+        try
+        {
+            auto value = std::stoll(token, nullptr, 0);
+            return static_cast<std::int32_t>(negative ? -value : value);
+        } catch (const std::exception&)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Invalid Protobuf schema, expected a number but found '"
+                                                            << token << "'"));
+        }
+    }
+
+    // Skip the rest of a statement, up to and including the next ';' outside of braces
+    void skip_statement()
+    {
+        for (int depth = 0;;)
+        {
+            auto token = next();
+            if (token == "{")
+            {
+                ++depth;
+            }
+            else if (token == "}")
+            {
+                --depth;
+            }
+            else if (token == ";" && depth == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    // Skip the rest of a block, up to and including its closing brace
+    void skip_block()
+    {
+        while (next() != "{") {}
+
+        for (int depth = 1; depth > 0;)
+        {
+            auto token = next();
+            depth += token == "{" ? 1 : (token == "}" ? -1 : 0);
+        }
+    }
+
+    // Skip the options of a field or enum value, enclosed in brackets
+    void skip_options()
+    {
+        if (peek() == "[")
+        {
+            while (next() != "]") {}
+        }
+    }
+
+    bool at_end()
+    {
+        return peek().empty();
+    }
+
+  private:
+    void skip_space()
+    {
+        while (m_pos < m_text.size())
+        {
+            if (std::isspace(static_cast<unsigned char>(m_text[m_pos])))
+            {
+                ++m_pos;
+            }
+            else if (m_text.substr(m_pos, 2) == "//")
+            {
+                auto end = m_text.find('\n', m_pos);
+                m_pos    = end == std::string_view::npos ? m_text.size() : end;
+            }
+            else if (m_text.substr(m_pos, 2) == "/*")
+            {
+                auto end = m_text.find("*/", m_pos + 2);
+                m_pos    = end == std::string_view::npos ? m_text.size() : end + 2;
+            }
+            else
+            {
+                return;
+            }
+        }
+    }
+
+    std::string_view m_text;
+    std::size_t m_pos{0};
+};
+
+// Component public implementations
+// ************ ProtobufSchema ************************* //
+ProtobufSchema::ProtobufSchema(std::string_view text)
+{
+    Parser parser(text);
+
+    while (!parser.at_end())
+    {
+        auto token = parser.next();
+        if (token == "syntax")
+        {
+            parser.expect("=");
+            m_proto3 = parser.next().find("proto3") != std::string::npos;
+            parser.expect(";");
+        }
+        else if (token == "package")
+        {
+            m_package = parser.next();
+            parser.expect(";");
+        }
+        else if (token == "message")
+        {
+            parse_message(parser, m_package, nullptr);
+        }
+        else if (token == "enum")
+        {
+            parse_enum(parser, m_package);
+        }
+        else if (token == "service" || token == "extend")
+        {
+            parser.skip_block();
+        }
+        else if (token == "import" || token == "option" || token == "edition")
+        {
+            parser.skip_statement();
+        }
+        else if (token != ";")
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Invalid Protobuf schema, unexpected '" << token << "'"));
+        }
+    }
+
+    for (auto& message : m_messages)
+    {
+        resolve(message);
+    }
+}
+
+const ProtobufSchema::Message& ProtobufSchema::message(const std::string& name) const
+{
+    auto qualified = name.starts_with('.') ? name.substr(1) : name;
+
+    auto found = m_message_names.find(qualified);
+    if (found == m_message_names.end() && !m_package.empty())
+    {
+        found = m_message_names.find(m_package + "." + qualified);
+    }
+
+    if (found == m_message_names.end())
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unknown Protobuf message '" << name << "'"));
+    }
+
+    return *found->second;
+}
+
+const ProtobufSchema::Message& ProtobufSchema::message(const std::vector<std::int64_t>& indices) const
+{
+    const auto* names = &m_top_level;
+    const Message* message{nullptr};
+
+    for (std::size_t i = 0; i < std::max<std::size_t>(indices.size(), 1); ++i)
+    {
+        auto index = indices.empty() ? 0 : indices[i];
+        if (index < 0 || static_cast<std::size_t>(index) >= names->size())
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Invalid Protobuf message index " << index));
+        }
+
+        message = m_message_names.at((*names)[index]);
+        names   = &message->nested;
+    }
+
+    return *message;
+}
+
+void ProtobufSchema::parse_message(Parser& parser, const std::string& scope, Message* parent)
+{
+    auto name = parser.next();
+
+    auto& message = m_messages.emplace_back();
+    message.name  = scope.empty() ? name : scope + "." + name;
+    m_message_names.emplace(message.name, &message);
+    (parent != nullptr ? parent->nested : m_top_level).push_back(message.name);
+
+    parser.expect("{");
+    for (auto token = parser.next(); token != "}"; token = parser.next())
+    {
+        if (token == "message")
+        {
+            parse_message(parser, message.name, &message);
+        }
+        else if (token == "enum")
+        {
+            parse_enum(parser, message.name);
+        }
+        else if (token == "oneof")
+        {
+            parser.next();
+            parser.expect("{");
+            for (auto member = parser.next(); member != "}"; member = parser.next())
+            {
+                if (member == "option")
+                {
+                    parser.skip_statement();
+                }
+                else
+                {
+                    parse_field(parser, message, "", member, true);
+                }
+            }
+        }
+        else if (token == "map")
+        {
+            // Maps are repeated entries of a message holding the key and the value
+            parser.expect("<");
+            auto key_type = parser.next();
+            parser.expect(",");
+            auto value_type = parser.next();
+            parser.expect(">");
+
+            auto field_name = parser.peek();
+            std::string entry_name;
+            bool upper = true;
+            for (char c : field_name)
+            {
+                if (c == '_')
+                {
+                    upper = true;
+                    continue;
+                }
+
+                entry_name += upper ? static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : c;
+                upper = false;
+            }
+
+            auto& entry = m_messages.emplace_back();
+            entry.name  = message.name + "." + entry_name + "Entry";
+            m_message_names.emplace(entry.name, &entry);
+
+            entry.fields.push_back({"key", 1, FieldType::Int32, key_type, false, false});
+            entry.fields.push_back({"value", 2, FieldType::Int32, value_type, false, false});
+
+            parse_field(parser, message, "repeated", "." + entry.name, false);
+            message.fields.back().is_map = true;
+        }
+        else if (token == "option" || token == "reserved" || token == "extensions")
+        {
+            parser.skip_statement();
+        }
+        else if (token == "extend")
+        {
+            parser.skip_block();
+        }
+        else if (token == "group")
+        {
+            throw std::invalid_argument("Protobuf groups aren't supported");
+        }
+        else if (token == "repeated" || token == "optional" || token == "required")
+        {
+            parse_field(parser, message, token, parser.next(), false);
+        }
+        else if (token != ";")
+        {
+            parse_field(parser, message, "", token, false);
+        }
+    }
+}
+
+void ProtobufSchema::parse_enum(Parser& parser, const std::string& scope)
+{
+    auto name = parser.next();
+
+    auto& enum_type = m_enums.emplace_back();
+    enum_type.name  = scope.empty() ? name : scope + "." + name;
+    m_enum_names.emplace(enum_type.name, &enum_type);
+
+    parser.expect("{");
+    for (auto token = parser.next(); token != "}"; token = parser.next())
+    {
+        if (token == "option" || token == "reserved")
+        {
+            parser.skip_statement();
+        }
+        else if (token != ";")
+        {
+            parser.expect("=");
+            auto value = parser.next_number();
+            parser.skip_options();
+            parser.expect(";");
+
+            // The first name of an aliased value is used
+            enum_type.values.emplace(value, token);
+        }
+    }
+}
+
+void ProtobufSchema::parse_field(
+    Parser& parser, Message& message, const std::string& label, const std::string& type, bool in_oneof)
+{
+    Field field;
+    field.name = parser.next();
+    parser.expect("=");
+    field.number = static_cast<std::uint32_t>(parser.next_number());
+    parser.skip_options();
+    parser.expect(";");
+
+    field.repeated = label == "repeated";
+
+    // Only the singular fields of proto3 which aren't marked optional have no presence
+    field.has_presence = !field.repeated && (label == "optional" || in_oneof || !m_proto3);
+
+    auto scalar = ScalarTypes.find(type);
+    if (scalar != ScalarTypes.end())
+    {
+        field.type = scalar->second;
+    }
+    else
+    {
+        field.type_name = type;
+    }
+
+    message.fields.push_back(std::move(field));
+}
+
+void ProtobufSchema::resolve(Message& message)
+{
+    for (std::size_t i = 0; i < message.fields.size(); ++i)
+    {
+        auto& field = message.fields[i];
+        message.field_index.emplace(field.number, i);
+
+        if (field.type_name.empty())
+        {
+            continue;
+        }
+
+        auto scalar = ScalarTypes.find(field.type_name);
+        if (scalar != ScalarTypes.end())
+        {
+            // The key and value of map entries
+            field.type = scalar->second;
+            continue;
+        }
+
+        // Names are relative to the enclosing scopes, searched from the innermost one, unless they start with '.'
+        std::vector<std::string> candidates;
+        if (field.type_name.starts_with('.'))
+        {
+            candidates.push_back(field.type_name.substr(1));
+        }
+        else
+        {
+            for (auto scope = message.name;;)
+            {
+                candidates.push_back(scope.empty() ? field.type_name : scope + "." + field.type_name);
+                if (scope.empty())
+                {
+                    break;
+                }
+
+                auto last_dot = scope.rfind('.');
+                scope         = last_dot == std::string::npos ? "" : scope.substr(0, last_dot);
+            }
+        }
+
+        bool resolved = false;
+        for (const auto& candidate : candidates)
+        {
+            if (auto found = m_message_names.find(candidate); found != m_message_names.end())
+            {
+                field.type         = FieldType::Message;
+                field.message_type = found->second;
+                field.has_presence = !field.repeated;
+                resolved           = true;
+                break;
+            }
+
+            if (auto found = m_enum_names.find(candidate); found != m_enum_names.end())
+            {
+                field.type      = FieldType::Enum;
+                field.enum_type = found->second;
+                resolved        = true;
+                break;
+            }
+        }
+
+        if (!resolved)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR(
+                "Unknown Protobuf type '" << field.type_name << "' of field '" << field.name << "'"));
+        }
+    }
+}
+
+// ************ ProtobufRecordDecoder ************************* //
+ProtobufRecordDecoder::ProtobufRecordDecoder(std::shared_ptr<const ProtobufSchema> schema,
+                                             const std::string& message_name) :
+  m_schema(std::move(schema))
+{
+    m_root.message = message_name.empty() ? &m_schema->message(std::vector<std::int64_t>{})
+                                          : &m_schema->message(message_name);
+
+    std::vector<const ProtobufSchema::Message*> messages;
+    compile(m_root, "", messages);
+}
+
+void ProtobufRecordDecoder::decode(std::string_view record,
+                                   DecodedTable& table,
+                                   const std::vector<std::size_t>& column_indices) const
+{
+    std::map<std::size_t, nlohmann::json> repeated;
+    decode_message(m_root, record, table, column_indices, repeated);
+
+    for (const auto& [column, values] : repeated)
+    {
+        table.set_string(column_indices[column],
+                         values.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace));
+    }
+}
+
+void ProtobufRecordDecoder::compile(Node& node,
+                                    const std::string& prefix,
+                                    std::vector<const ProtobufSchema::Message*>& messages)
+{
+    messages.push_back(node.message);
+
+    for (const auto& field : node.message->fields)
+    {
+        const auto name = prefix + field.name;
+
+        // Singular messages are flattened unless they are recursive
+        if (field.type == ProtobufSchema::FieldType::Message && !field.repeated &&
+            std::find(messages.begin(), messages.end(), field.message_type) == messages.end())
+        {
+            auto child     = std::make_unique<Node>();
+            child->message = field.message_type;
+            compile(*child, name + ".", messages);
+
+            node.columns.push_back(0);
+            node.children.push_back(std::move(child));
+            continue;
+        }
+
+        auto column_type = cudf::type_id::STRING;
+        if (!field.repeated)
+        {
+            switch (field.type)
+            {
+            case FieldType::Double:
+                column_type = cudf::type_id::FLOAT64;
+                break;
+            case FieldType::Float:
+                column_type = cudf::type_id::FLOAT32;
+                break;
+            case FieldType::Int32:
+            case FieldType::SInt32:
+            case FieldType::SFixed32:
+                column_type = cudf::type_id::INT32;
+                break;
+            case FieldType::Int64:
+            case FieldType::SInt64:
+            case FieldType::SFixed64:
+                column_type = cudf::type_id::INT64;
+                break;
+            case FieldType::UInt32:
+            case FieldType::Fixed32:
+                column_type = cudf::type_id::UINT32;
+                break;
+            case FieldType::UInt64:
+            case FieldType::Fixed64:
+                column_type = cudf::type_id::UINT64;
+                break;
+            case FieldType::Bool:
+                column_type = cudf::type_id::BOOL8;
+                break;
+            default:
+                break;
+            }
+        }
+
+        m_columns.push_back({name, column_type});
+        node.columns.push_back(m_columns.size() - 1);
+        node.children.push_back(nullptr);
+    }
+
+    messages.pop_back();
+}
+
+void ProtobufRecordDecoder::decode_message(const Node& node,
+                                           std::string_view data,
+                                           DecodedTable& table,
+                                           const std::vector<std::size_t>& columns,
+                                           std::map<std::size_t, nlohmann::json>& repeated) const
+{
+    const auto& fields = node.message->fields;
+
+    WireReader reader(data);
+    while (!reader.at_end())
+    {
+        const auto key  = reader.read_varint();
+        const auto wire = static_cast<std::uint32_t>(key & 7);
+
+        auto found = node.message->field_index.find(static_cast<std::uint32_t>(key >> 3));
+        if (found == node.message->field_index.end())
+        {
+            reader.skip(wire);
+            continue;
+        }
+
+        const auto index  = found->second;
+        const auto& field = fields[index];
+
+        if (node.children[index] != nullptr)
+        {
+            check_wire_type(field, wire);
+            decode_message(*node.children[index], reader.read_bytes(), table, columns, repeated);
+        }
+        else if (field.repeated)
+        {
+            auto& values = repeated[node.columns[index]];
+            if (values.is_null())
+            {
+                values = field.is_map ? nlohmann::json::object() : nlohmann::json::array();
+            }
+
+            append_repeated(field, reader, wire, values, 0);
+        }
+        else
+        {
+            write_value(field, reader, wire, table, columns[node.columns[index]]);
+        }
+    }
+
+    // Absent fields without presence hold their default value
+    for (std::size_t i = 0; i < fields.size(); ++i)
+    {
+        if (node.children[i] == nullptr && !fields[i].repeated && !fields[i].has_presence &&
+            !table.is_set(columns[node.columns[i]]))
+        {
+            write_default(fields[i], table, columns[node.columns[i]]);
+        }
+    }
+}
+
+}  // namespace morpheus
@@ -19,13 +19,36 @@
 
 #include "morpheus/utilities/cudf_util.hpp"
 
-#include <cudf/types.hpp>
-#include <pybind11/gil.h>
-#include <pybind11/pybind11.h>
+#include <cudf/column/column_view.hpp>  // for column_view
+#include <cudf/io/types.hpp>            // for table_with_metadata, table_metadata
+#include <cudf/table/table.hpp>         // for table
+#include <cudf/table/table_view.hpp>    // for table_view
+#include <cudf/types.hpp>               // for size_type
+#include <glog/logging.h>               // for DCHECK_EQ
+#include <pybind11/gil.h>               // for gil_scoped_acquire, gil_scoped_release
+#include <pybind11/pybind11.h>          // for module_
+#include <pybind11/pytypes.h>           // for dict, object, tuple
 
+#include <cstddef>  // for size_t
+#include <memory>   // for make_unique
+#include <string>
 #include <utility>
 
 namespace morpheus {
+
+namespace {
+// Column names of `TableInfoData` use an empty string for unnamed columns
+pybind11::object py_column_name(const std::string& name)
+{
+    if (name.empty())
+    {
+        return pybind11::none();
+    }
+
+    return pybind11::str(name);
+}
+}  // namespace
+
 /****** Component public implementations *******************/
 /****** PyDataTable****************************************/
 PyDataTable::PyDataTable(pybind11::object&& py_table) : m_py_table(std::move(py_table)) {}
@@ -43,22 +66,177 @@ PyDataTable::~PyDataTable()
 
 cudf::size_type PyDataTable::count() const
 {
+    {
+        auto lock = lock_native();
+        if (m_native_table.has_value())
+        {
+            return m_native_table->data.table_view.num_rows();
+        }
+    }
+
     pybind11::gil_scoped_acquire gil;
 
     return m_py_table.attr("shape").attr("__getitem__")(0).cast<cudf::size_type>();
 }
 
-const pybind11::object& PyDataTable::get_py_object() const
+pybind11::object PyDataTable::get_py_object() const
 {
+    auto lock = lock_native();
+    if (m_native_table.has_value())
+    {
+        convert_native_table();
+    }
+
+    // Return a new reference, `m_py_table` is replaced the next time a native table is converted
+    pybind11::gil_scoped_acquire gil;
+
     return m_py_table;
 }
 
 TableInfoData PyDataTable::get_table_data() const
 {
+    {
+        auto lock = lock_native();
+        if (m_native_table.has_value())
+        {
+            return m_native_table->data;
+        }
+    }
+
     pybind11::gil_scoped_acquire gil;
 
     auto info = CudfHelper::table_info_data_from_table(m_py_table);
 
     return info;
 }
+
+void PyDataTable::set_table_columns(const TableInfoData& table, std::vector<TableColumn>&& columns) const
+{
+    auto lock = lock_native();
+
+    // Until a transaction is committed, all of the columns are owned by the DataFrame
+    std::vector<NativeColumn> current_columns;
+    if (m_native_table.has_value())
+    {
+        current_columns = std::move(m_native_table->columns);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < table.column_names.size(); ++i)
+        {
+            current_columns.push_back({table.column_names[i], static_cast<cudf::size_type>(i), nullptr});
+        }
+    }
+
+    DCHECK_EQ(current_columns.size(), table.column_names.size()) << "The table data is out of date";
+
+    const auto num_indices = static_cast<cudf::size_type>(table.index_names.size());
+
+    std::vector<cudf::column_view> views;
+    std::vector<std::string> column_names;
+    NativeTable native_table;
+
+    for (cudf::size_type i = 0; i < num_indices; ++i)
+    {
+        views.push_back(table.table_view.column(i));
+    }
+
+    for (auto& column : columns)
+    {
+        if (column.source_idx >= 0)
+        {
+            // Moving the column keeps its data, the views of `table` remain valid
+            views.push_back(table.table_view.column(num_indices + column.source_idx));
+            native_table.columns.push_back(std::move(current_columns[column.source_idx]));
+        }
+        else
+        {
+            views.push_back(column.column->view());
+            native_table.columns.push_back({{}, -1, std::move(column.column)});
+        }
+
+        column_names.push_back(std::move(column.name));
+    }
+
+    native_table.data = TableInfoData(cudf::table_view(views), table.index_names, std::move(column_names));
+
+    m_native_table = std::move(native_table);
+}
+
+std::unique_lock<std::mutex> PyDataTable::lock_native() const
+{
+    std::unique_lock lock(m_native_mutex, std::defer_lock);
+
+    // Another thread may hold the lock while waiting for the GIL to convert the native table
+    if (PyGILState_Check() != 0)
+    {
+        pybind11::gil_scoped_release no_gil;
+        lock.lock();
+    }
+    else
+    {
+        lock.lock();
+    }
+
+    return lock;
+}
+
+void PyDataTable::convert_native_table() const
+{
+    pybind11::gil_scoped_acquire gil;
+
+    auto& native_table       = *m_native_table;
+    const auto& column_names = native_table.data.column_names;
+
+    // Hand the new columns over to a DataFrame, without copying them
+    std::vector<bool> is_new_column;
+    std::vector<std::unique_ptr<cudf::column>> new_columns;
+    cudf::io::table_metadata metadata;
+
+    for (std::size_t i = 0; i < native_table.columns.size(); ++i)
+    {
+        is_new_column.push_back(native_table.columns[i].column != nullptr);
+        if (is_new_column.back())
+        {
+            new_columns.push_back(std::move(native_table.columns[i].column));
+            metadata.schema_info.emplace_back(column_names[i]);
+        }
+    }
+
+    pybind11::tuple new_df_columns;
+    if (!new_columns.empty())
+    {
+        auto new_df = CudfHelper::table_from_table_with_metadata(
+            cudf::io::table_with_metadata{std::make_unique<cudf::table>(std::move(new_columns)), std::move(metadata)},
+            0);
+        new_df_columns = pybind11::tuple(new_df.attr("_data").attr("columns"));
+    }
+
+    // Build the DataFrame from the columns of both DataFrames, keeping the index. The columns of the current DataFrame
+    // are found by position, since their names are stringified, and keep their original label unless renamed.
+    pybind11::tuple py_columns = m_py_table.attr("_data").attr("columns");
+    pybind11::tuple py_labels  = m_py_table.attr("_data").attr("names");
+
+    pybind11::dict data;
+    std::size_t new_idx = 0;
+    for (std::size_t i = 0; i < column_names.size(); ++i)
+    {
+        if (is_new_column[i])
+        {
+            data[py_column_name(column_names[i])] = new_df_columns[new_idx++];
+            continue;
+        }
+
+        const auto& native_column = native_table.columns[i];
+        const auto py_idx         = static_cast<std::size_t>(native_column.py_idx);
+
+        pybind11::object label = native_column.py_name == column_names[i] ? pybind11::object(py_labels[py_idx])
+                                                                            : py_column_name(column_names[i]);
+
+        data[label] = py_columns[py_idx];
+    }
+
+    m_py_table = pybind11::module_::import("cudf").attr("DataFrame").attr("_from_data")(data, m_py_table.attr("index"));
+    m_native_table.reset();
+}
 }  // namespace morpheus
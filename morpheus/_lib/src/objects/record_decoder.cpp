@@ -0,0 +1,256 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/record_decoder.hpp"
+
+#include "morpheus/objects/avro_decoder.hpp"      // for AvroRecordDecoder
+#include "morpheus/objects/protobuf_decoder.hpp"  // for ProtobufSchema, ProtobufRecordDecoder
+#include "morpheus/utilities/string_util.hpp"     // for MORPHEUS_CONCAT_STR
+
+#include <glog/logging.h>
+
+#include <exception>  // for exception
+#include <fstream>    // for ifstream
+#include <iterator>   // for istreambuf_iterator
+#include <sstream>    // ostringstream needed by MORPHEUS_CONCAT_STR
+#include <stdexcept>  // for invalid_argument, out_of_range, runtime_error
+
+namespace morpheus {
+
+namespace {
+// Magic byte and big endian schema id which start the payloads of the Confluent wire format
+constexpr std::size_t ConfluentHeaderSize = 5;
+
+std::int64_t read_zigzag_varint(std::string_view& data)
+{
+    std::uint64_t value = 0;
+    for (unsigned shift = 0;; shift += 7)
+    {
+        if (data.empty() || shift >= 64)
+        {
+            throw std::runtime_error("Malformed Protobuf message indices");
+        }
+
+        const auto byte = static_cast<std::uint8_t>(data.front());
+        data.remove_prefix(1);
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+        if ((byte & 0x80) == 0)
+        {
+            return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+        }
+    }
+}
+}  // namespace
+
+// Component public implementations
+// ************ RecordDecoder ************************* //
+const std::vector<DecodedColumnSpec>& RecordDecoder::columns() const
+{
+    return m_columns;
+}
+
+// ************ LocalSchemaRegistry ************************* //
+LocalSchemaRegistry::LocalSchemaRegistry(std::map<std::int32_t, std::string> schemas) : m_schemas(std::move(schemas))
+{}
+
+std::shared_ptr<LocalSchemaRegistry> LocalSchemaRegistry::from_files(
+    const std::map<std::int32_t, std::string>& schema_files)
+{
+    std::map<std::int32_t, std::string> schemas;
+    for (const auto& [schema_id, filename] : schema_files)
+    {
+        std::ifstream file(filename);
+        if (!file)
+        {
+            throw std::invalid_argument(
+                MORPHEUS_CONCAT_STR("Unable to read the file '" << filename << "' of schema " << schema_id));
+        }
+
+        schemas.emplace(schema_id, std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+    }
+
+    return std::make_shared<LocalSchemaRegistry>(std::move(schemas));
+}
+
+std::string LocalSchemaRegistry::get_schema(std::int32_t schema_id)
+{
+    auto found = m_schemas.find(schema_id);
+    if (found == m_schemas.end())
+    {
+        throw std::out_of_range(MORPHEUS_CONCAT_STR("Unknown schema id " << schema_id));
+    }
+
+    return found->second;
+}
+
+// ************ PayloadDecoder ************************* //
+PayloadFormat parse_payload_format(const std::string& name)
+{
+    if (name == "json")
+    {
+        return PayloadFormat::JSON;
+    }
+
+    if (name == "avro")
+    {
+        return PayloadFormat::Avro;
+    }
+
+    if (name == "protobuf")
+    {
+        return PayloadFormat::Protobuf;
+    }
+
+    throw std::invalid_argument(
+        MORPHEUS_CONCAT_STR("Unknown payload format '" << name << "', must be one of: json, avro, protobuf"));
+}
+
+PayloadDecoder::PayloadDecoder(PayloadDecoderConfig config, std::shared_ptr<SchemaRegistry> registry) :
+  m_config(std::move(config)),
+  m_registry(std::move(registry))
+{
+    if (m_config.format == PayloadFormat::JSON)
+    {
+        throw std::invalid_argument("JSON payloads are parsed by cuDF, not by a payload decoder");
+    }
+
+    if (m_registry == nullptr)
+    {
+        throw std::invalid_argument("Avro and Protobuf payloads require a schema registry");
+    }
+}
+
+PayloadDecoder::~PayloadDecoder() = default;
+
+DecodedTable PayloadDecoder::decode(const std::vector<std::string_view>& payloads, std::vector<bool>& decoded)
+{
+    DecodedTable table;
+    decoded.assign(payloads.size(), false);
+
+    // Columns of the table written by each decoder, looked up once per batch
+    std::map<const RecordDecoder*, std::vector<std::size_t>> decoder_columns;
+
+    for (std::size_t i = 0; i < payloads.size(); ++i)
+    {
+        auto payload = payloads[i];
+
+        try
+        {
+            auto schema_id = m_config.schema_id;
+            std::vector<std::int64_t> message_indices;
+
+            if (m_config.confluent_framing)
+            {
+                if (payload.size() < ConfluentHeaderSize || payload[0] != 0)
+                {
+                    throw std::runtime_error("Payload doesn't start with the magic byte of the Confluent wire format");
+                }
+
+                std::uint32_t id = 0;
+                for (std::size_t byte = 1; byte < ConfluentHeaderSize; ++byte)
+                {
+                    id = (id << 8) | static_cast<std::uint8_t>(payload[byte]);
+                }
+
+                schema_id = static_cast<std::int32_t>(id);
+                payload.remove_prefix(ConfluentHeaderSize);
+
+                // Protobuf payloads are followed by the path of the message in the schema, a count of zero is the
+                // path of the first message
+                if (m_config.format == PayloadFormat::Protobuf)
+                {
+                    auto count = read_zigzag_varint(payload);
+                    if (count < 0 || static_cast<std::size_t>(count) > payload.size())
+                    {
+                        throw std::runtime_error("Malformed Protobuf message indices");
+                    }
+
+                    for (std::int64_t index = 0; index < count; ++index)
+                    {
+                        message_indices.push_back(read_zigzag_varint(payload));
+                    }
+                }
+            }
+
+            const auto& decoder = get_decoder(schema_id, message_indices);
+
+            auto columns = decoder_columns.find(&decoder);
+            if (columns == decoder_columns.end())
+            {
+                columns = decoder_columns.emplace(&decoder, table.get_columns(decoder.columns())).first;
+            }
+
+            table.begin_row();
+            try
+            {
+                decoder.decode(payload, table, columns->second);
+            } catch (...)
+            {
+                table.abort_row();
+                throw;
+            }
+
+            table.end_row();
+            decoded[i] = true;
+        } catch (const std::exception& e)
+        {
+            LOG(ERROR) << "Failed to decode " << (m_config.format == PayloadFormat::Avro ? "an Avro" : "a Protobuf")
+                       << " payload: " << e.what();
+        }
+    }
+
+    return table;
+}
+
+const RecordDecoder& PayloadDecoder::get_decoder(std::int32_t schema_id,
+                                                 const std::vector<std::int64_t>& message_indices)
+{
+    auto key   = std::make_pair(schema_id, message_indices);
+    auto found = m_decoders.find(key);
+    if (found != m_decoders.end())
+    {
+        return *found->second;
+    }
+
+    std::unique_ptr<RecordDecoder> decoder;
+    if (m_config.format == PayloadFormat::Avro)
+    {
+        decoder = std::make_unique<AvroRecordDecoder>(m_registry->get_schema(schema_id));
+    }
+    else
+    {
+        // Each message of a Protobuf schema has its own decoder, the schema is parsed once
+        auto& schema = m_protobuf_schemas[schema_id];
+        if (schema == nullptr)
+        {
+            schema = std::make_shared<const ProtobufSchema>(m_registry->get_schema(schema_id));
+        }
+
+        const auto& message = !m_config.confluent_framing && !m_config.message_name.empty()
+                                  ? schema->message(m_config.message_name)
+                                  : schema->message(message_indices);
+
+        decoder = std::make_unique<ProtobufRecordDecoder>(schema, message.name);
+    }
+
+    VLOG(10) << "Compiled schema " << schema_id << " into " << decoder->columns().size() << " columns";
+
+    return *m_decoders.emplace(std::move(key), std::move(decoder)).first->second;
+}
+
+}  // namespace morpheus
@@ -0,0 +1,328 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/reference_table.hpp"
+
+#include "morpheus/io/deserializers.hpp"       // for load_table_from_file, get_index_col_count
+#include "morpheus/objects/table_info.hpp"     // for TableInfo
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <cudf/binaryop.hpp>                   // for binary_operation
+#include <cudf/column/column_factories.hpp>    // for make_numeric_column
+#include <cudf/column/column_view.hpp>         // for column_view
+#include <cudf/copying.hpp>                    // for gather, scatter
+#include <cudf/io/types.hpp>                   // for table_with_metadata
+#include <cudf/scalar/scalar.hpp>              // for numeric_scalar
+#include <cudf/stream_compaction.hpp>          // for distinct, apply_boolean_mask
+#include <cudf/types.hpp>                      // for size_type, data_type
+#include <cudf/utilities/type_dispatcher.hpp>  // for type_to_id, type_to_name
+#include <glog/logging.h>                      // for LOG
+
+#include <algorithm>  // for find
+#include <cstddef>    // for size_t
+#include <iterator>   // for distance, make_move_iterator
+#include <numeric>    // for iota
+#include <stdexcept>  // for invalid_argument
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace {
+
+const cudf::data_type RowMapType{cudf::type_to_id<cudf::size_type>()};
+
+cudf::size_type find_column(const std::vector<std::string>& names,
+                            cudf::size_type first,
+                            const std::string& name,
+                            const std::string& table_name)
+{
+    auto found = std::find(names.begin() + first, names.end(), name);
+    if (found == names.end())
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Column '" << name << "' not found in " << table_name));
+    }
+
+    return static_cast<cudf::size_type>(std::distance(names.begin(), found));
+}
+
+}  // namespace
+
+/****** ReferenceTable**************************************/
+std::shared_ptr<const ReferenceTable> ReferenceTable::load(const ReferenceTableConfig& config)
+{
+    if (config.key_columns.empty())
+    {
+        throw std::invalid_argument("At least one key column is required to join a reference table");
+    }
+
+    const auto& reference_key_columns =
+        config.reference_key_columns.empty() ? config.key_columns : config.reference_key_columns;
+    if (reference_key_columns.size() != config.key_columns.size())
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Expected " << config.key_columns.size()
+                                                                    << " key columns for reference table "
+                                                                    << config.path << ", got "
+                                                                    << reference_key_columns.size()));
+    }
+
+    // Read the modification time first, a change made while the file is being read is picked up by the next refresh
+    const auto modified = std::filesystem::last_write_time(config.path);
+
+    auto table            = load_table_from_file(config.path.string(), config.file_type);
+    const auto num_index  = get_index_col_count(table);
+    const auto all_names  = get_column_names_from_table(table);
+    const auto table_name = MORPHEUS_CONCAT_STR("reference table " << config.path);
+
+    std::vector<cudf::size_type> selected;
+    for (const auto& name : reference_key_columns)
+    {
+        selected.push_back(find_column(all_names, num_index, name, table_name));
+    }
+
+    const auto num_keys = static_cast<cudf::size_type>(selected.size());
+
+    std::vector<std::string> value_names = config.columns;
+    if (value_names.empty())
+    {
+        for (auto i = static_cast<std::size_t>(num_index); i < all_names.size(); ++i)
+        {
+            if (std::find(reference_key_columns.begin(), reference_key_columns.end(), all_names[i]) ==
+                reference_key_columns.end())
+            {
+                value_names.push_back(all_names[i]);
+            }
+        }
+    }
+
+    std::vector<std::string> column_names;
+    for (const auto& name : value_names)
+    {
+        selected.push_back(find_column(all_names, num_index, name, table_name));
+        column_names.push_back(config.prefix + name);
+    }
+
+    // Keep the first row of each key so that every incoming row matches at most one reference row
+    std::vector<cudf::size_type> key_indices(num_keys);
+    std::iota(key_indices.begin(), key_indices.end(), 0);
+
+    const auto selected_view = table.tbl->view().select(selected);
+    auto unique              = cudf::distinct(
+        selected_view, key_indices, cudf::duplicate_keep_option::KEEP_FIRST, cudf::null_equality::UNEQUAL);
+
+    if (unique->num_rows() < selected_view.num_rows())
+    {
+        LOG(WARNING) << "Dropped " << selected_view.num_rows() - unique->num_rows()
+                     << " rows with duplicate keys from " << table_name;
+    }
+
+    auto columns = unique->release();
+    std::vector<std::unique_ptr<cudf::column>> key_columns(std::make_move_iterator(columns.begin()),
+                                                           std::make_move_iterator(columns.begin() + num_keys));
+    std::vector<std::unique_ptr<cudf::column>> value_columns(std::make_move_iterator(columns.begin() + num_keys),
+                                                             std::make_move_iterator(columns.end()));
+
+    auto keys   = std::make_unique<cudf::table>(std::move(key_columns));
+    auto values = std::make_unique<cudf::table>(std::move(value_columns));
+
+    return std::shared_ptr<const ReferenceTable>(
+        new ReferenceTable(config, modified, std::move(keys), std::move(values), std::move(column_names)));
+}
+
+ReferenceTable::ReferenceTable(ReferenceTableConfig config,
+                               std::filesystem::file_time_type modified,
+                               std::unique_ptr<cudf::table> keys,
+                               std::unique_ptr<cudf::table> values,
+                               std::vector<std::string> column_names) :
+  m_config(std::move(config)),
+  m_modified(modified),
+  m_keys(std::move(keys)),
+  m_values(std::move(values)),
+  m_column_names(std::move(column_names)),
+  m_index(std::make_unique<cudf::hash_join>(m_keys->view(), cudf::null_equality::UNEQUAL))
+{}
+
+const ReferenceTableConfig& ReferenceTable::config() const
+{
+    return m_config;
+}
+
+std::filesystem::file_time_type ReferenceTable::modified() const
+{
+    return m_modified;
+}
+
+cudf::size_type ReferenceTable::num_rows() const
+{
+    return m_keys->num_rows();
+}
+
+const std::vector<std::string>& ReferenceTable::column_names() const
+{
+    return m_column_names;
+}
+
+std::unique_ptr<cudf::column> ReferenceTable::probe(const cudf::table_view& keys) const
+{
+    if (keys.num_columns() != m_keys->num_columns())
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Expected " << m_keys->num_columns()
+                                                                    << " key columns to probe reference table "
+                                                                    << m_config.path << ", got "
+                                                                    << keys.num_columns()));
+    }
+
+    for (cudf::size_type i = 0; i < keys.num_columns(); ++i)
+    {
+        if (keys.column(i).type() != m_keys->get_column(i).type())
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR(
+                "Type of key column '" << m_config.key_columns[i] << "' (" << cudf::type_to_name(keys.column(i).type())
+                                       << ") doesn't match the type of the reference key column ("
+                                       << cudf::type_to_name(m_keys->get_column(i).type()) << ") of "
+                                       << m_config.path));
+        }
+    }
+
+    auto row_map = cudf::make_numeric_column(RowMapType, keys.num_rows());
+    if (keys.num_rows() == 0)
+    {
+        return row_map;
+    }
+
+    // Reference keys are unique, so every probe row occurs exactly once in the result of the left join. Unmatched rows
+    // hold `cudf::JoinNoneValue`, which is negative.
+    auto [probe_rows, reference_rows] = m_index->left_join(keys);
+
+    const cudf::column_view probe_view(
+        RowMapType, static_cast<cudf::size_type>(probe_rows->size()), probe_rows->data(), nullptr, 0);
+    const cudf::column_view reference_view(
+        RowMapType, static_cast<cudf::size_type>(reference_rows->size()), reference_rows->data(), nullptr, 0);
+
+    // The join doesn't preserve the order of the probe rows, scatter the matches back into row order
+    auto scattered = cudf::scatter(cudf::table_view({reference_view}), probe_view, cudf::table_view({row_map->view()}));
+
+    return std::move(scattered->release()[0]);
+}
+
+std::unique_ptr<cudf::table> ReferenceTable::gather(const cudf::column_view& row_map) const
+{
+    return cudf::gather(m_values->view(), row_map, cudf::out_of_bounds_policy::NULLIFY);
+}
+
+/****** enrich_message_meta*********************************/
+std::shared_ptr<MessageMeta> enrich_message_meta(const MessageMeta& meta,
+                                                 const std::vector<std::shared_ptr<const ReferenceTable>>& tables)
+{
+    const auto info        = meta.get_info();
+    const auto num_indices = info.num_indices();
+
+    // Columns of the result by position, starting with the index and columns of `meta`
+    std::vector<std::string> names = info.get_index_names();
+    for (const auto& name : info.get_column_names())
+    {
+        names.push_back(name);
+    }
+
+    std::vector<cudf::column_view> columns;
+    for (cudf::size_type i = 0; i < info.get_view().num_columns(); ++i)
+    {
+        columns.push_back(info.get_view().column(i));
+    }
+
+    // Owns the appended columns until the result is copied
+    std::vector<std::unique_ptr<cudf::table>> appended;
+    std::unique_ptr<cudf::column> row_mask;
+
+    for (const auto& table : tables)
+    {
+        const auto& config = table->config();
+
+        // Keys may refer to the columns appended by a previous table
+        std::vector<cudf::column_view> key_columns;
+        for (const auto& key : config.key_columns)
+        {
+            key_columns.push_back(columns[find_column(names, num_indices, key, "the incoming message")]);
+        }
+
+        auto row_map = table->probe(cudf::table_view(key_columns));
+        appended.push_back(table->gather(row_map->view()));
+
+        if (config.how == JoinType::Inner)
+        {
+            auto matched = cudf::binary_operation(row_map->view(),
+                                                  cudf::numeric_scalar<cudf::size_type>(0),
+                                                  cudf::binary_operator::GREATER_EQUAL,
+                                                  cudf::data_type{cudf::type_id::BOOL8});
+
+            if (row_mask)
+            {
+                matched = cudf::binary_operation(row_mask->view(),
+                                                 matched->view(),
+                                                 cudf::binary_operator::LOGICAL_AND,
+                                                 cudf::data_type{cudf::type_id::BOOL8});
+            }
+
+            row_mask = std::move(matched);
+        }
+
+        const auto& column_names = table->column_names();
+        for (std::size_t i = 0; i < column_names.size(); ++i)
+        {
+            const auto column = appended.back()->get_column(static_cast<cudf::size_type>(i)).view();
+
+            auto found = std::find(names.begin() + num_indices, names.end(), column_names[i]);
+            if (found != names.end())
+            {
+                columns[std::distance(names.begin(), found)] = column;
+            }
+            else
+            {
+                names.push_back(column_names[i]);
+                columns.push_back(column);
+            }
+        }
+    }
+
+    const cudf::table_view result_view(columns);
+
+    std::unique_ptr<cudf::table> result;
+    if (row_mask)
+    {
+        result = cudf::apply_boolean_mask(result_view, row_mask->view());
+        if (result->num_rows() == 0)
+        {
+            return nullptr;
+        }
+    }
+    else
+    {
+        result = std::make_unique<cudf::table>(result_view);
+    }
+
+    auto metadata = cudf::io::table_metadata{};
+    metadata.schema_info.reserve(names.size());
+    for (const auto& name : names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    cudf::io::table_with_metadata table = {std::move(result), std::move(metadata)};
+
+    return MessageMeta::create_from_cpp(std::move(table), num_indices);
+}
+
+}  // namespace morpheus
@@ -0,0 +1,372 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/string_features.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <algorithm>  // for fill_n, max
+#include <array>
+#include <cmath>      // for log2
+#include <stdexcept>  // for invalid_argument
+#include <unordered_map>
+#include <utility>  // for move
+
+namespace morpheus {
+
+namespace {
+const std::vector<std::pair<std::string, StringFeatureType>> FeatureTypeNames = {
+    {"length", StringFeatureType::Length},
+    {"entropy", StringFeatureType::Entropy},
+    {"digit_ratio", StringFeatureType::DigitRatio},
+    {"upper_ratio", StringFeatureType::UpperRatio},
+    {"ngram_hash", StringFeatureType::NgramHash},
+    {"domain_label_count", StringFeatureType::DomainLabelCount},
+    {"path_depth", StringFeatureType::PathDepth}};
+
+bool is_continuation_byte(char c)
+{
+    return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+
+// Length in bytes of the code point starting at `pos`, each byte of an invalid sequence is a code point of its own
+std::size_t code_point_length(std::string_view text, std::size_t pos)
+{
+    const auto lead = static_cast<unsigned char>(text[pos]);
+
+    std::size_t length = 1;
+    if (lead >= 0xF0 && lead < 0xF8)
+    {
+        length = 4;
+    }
+    else if (lead >= 0xE0)
+    {
+        length = 3;
+    }
+    else if (lead >= 0xC0)
+    {
+        length = 2;
+    }
+
+    if (lead >= 0xF8 || pos + length > text.size())
+    {
+        return 1;
+    }
+
+    for (std::size_t i = 1; i < length; ++i)
+    {
+        if (!is_continuation_byte(text[pos + i]))
+        {
+            return 1;
+        }
+    }
+
+    return length;
+}
+
+std::uint32_t decode(std::string_view sequence)
+{
+    const auto lead = static_cast<unsigned char>(sequence.front());
+    switch (sequence.size())
+    {
+    case 2:
+        return ((lead & 0x1F) << 6) | (static_cast<unsigned char>(sequence[1]) & 0x3F);
+    case 3:
+        return ((lead & 0x0F) << 12) | ((static_cast<unsigned char>(sequence[1]) & 0x3F) << 6) |
+               (static_cast<unsigned char>(sequence[2]) & 0x3F);
+    case 4:
+        return ((lead & 0x07) << 18) | ((static_cast<unsigned char>(sequence[1]) & 0x3F) << 12) |
+               ((static_cast<unsigned char>(sequence[2]) & 0x3F) << 6) |
+               (static_cast<unsigned char>(sequence[3]) & 0x3F);
+    default:
+        return lead;
+    }
+}
+
+// Number of non-empty pieces of `text` separated by any of `separators`
+std::size_t count_segments(std::string_view text, std::string_view separators)
+{
+    std::size_t count = 0;
+    bool in_segment   = false;
+    for (char c : text)
+    {
+        const bool is_separator = separators.find(c) != std::string_view::npos;
+        if (!is_separator && !in_segment)
+        {
+            ++count;
+        }
+
+        in_segment = !is_separator;
+    }
+
+    return count;
+}
+
+// The host of a URL, or the whole of `text` when it is a domain name
+std::string_view url_host(std::string_view text)
+{
+    if (auto scheme_end = text.find("://"); scheme_end != std::string_view::npos)
+    {
+        text.remove_prefix(scheme_end + 3);
+    }
+
+    text = text.substr(0, text.find_first_of("/?#"));
+
+    if (auto user_end = text.rfind('@'); user_end != std::string_view::npos)
+    {
+        text.remove_prefix(user_end + 1);
+    }
+
+    // IPv6 addresses are a single label
+    if (!text.empty() && text.front() == '[')
+    {
+        const auto close = text.find(']');
+        return text.substr(0, close == std::string_view::npos ? close : close + 1);
+    }
+
+    return text.substr(0, text.find(':'));
+}
+
+// The path of a URL, or the whole of `text` when it is a file path
+std::string_view url_path(std::string_view text)
+{
+    if (auto scheme_end = text.find("://"); scheme_end != std::string_view::npos)
+    {
+        text.remove_prefix(scheme_end + 3);
+
+        auto path_start = text.find_first_of("/?#");
+        text            = path_start == std::string_view::npos ? std::string_view{} : text.substr(path_start);
+        text            = text.substr(0, text.find_first_of("?#"));
+    }
+
+    return text;
+}
+}  // namespace
+
+/****** Component public implementations *******************/
+/****** StringFeature***************************************/
+std::vector<std::string> StringFeature::output_names() const
+{
+    if (type != StringFeatureType::NgramHash)
+    {
+        return {name};
+    }
+
+    std::vector<std::string> names;
+    names.reserve(num_buckets);
+    for (std::size_t i = 0; i < num_buckets; ++i)
+    {
+        names.push_back(MORPHEUS_CONCAT_STR(name << "_" << i));
+    }
+
+    return names;
+}
+
+bool StringFeature::is_integral() const
+{
+    return type == StringFeatureType::Length || type == StringFeatureType::DomainLabelCount ||
+           type == StringFeatureType::PathDepth;
+}
+
+/****** StringFeatureExtractor******************************/
+StringFeatureExtractor::StringFeatureExtractor(std::vector<StringFeature> features) : m_features(std::move(features))
+{
+    for (const auto& feature : m_features)
+    {
+        if (feature.column != m_features.front().column)
+        {
+            throw std::invalid_argument("The features of a StringFeatureExtractor must all be of the same column");
+        }
+
+        if (feature.name.empty())
+        {
+            throw std::invalid_argument(
+                MORPHEUS_CONCAT_STR("A feature of column '" << feature.column << "' has an empty name"));
+        }
+
+        if (feature.type == StringFeatureType::NgramHash)
+        {
+            if (feature.ngram_size == 0 || feature.num_buckets == 0)
+            {
+                throw std::invalid_argument(MORPHEUS_CONCAT_STR(
+                    "The n-gram size and number of buckets of feature '" << feature.name << "' must be positive"));
+            }
+
+            m_max_ngram_size = std::max(m_max_ngram_size, feature.ngram_size);
+        }
+
+        m_needs_histogram = m_needs_histogram || feature.type == StringFeatureType::Entropy;
+        m_output_offsets.push_back(m_num_outputs);
+        m_num_outputs += feature.type == StringFeatureType::NgramHash ? feature.num_buckets : 1;
+    }
+}
+
+std::size_t StringFeatureExtractor::num_outputs() const
+{
+    return m_num_outputs;
+}
+
+const std::vector<StringFeature>& StringFeatureExtractor::features() const
+{
+    return m_features;
+}
+
+void StringFeatureExtractor::extract(std::string_view text, double* out) const
+{
+    std::fill_n(out, m_num_outputs, 0.0);
+    if (text.empty())
+    {
+        return;
+    }
+
+    std::array<std::size_t, 128> ascii_counts{};
+    std::unordered_map<std::uint32_t, std::size_t> other_counts;
+
+    // Byte offsets of the starts of the last `m_max_ngram_size` code points
+    std::vector<std::size_t> starts(m_max_ngram_size, 0);
+
+    std::size_t num_code_points = 0;
+    std::size_t num_digits      = 0;
+    std::size_t num_upper       = 0;
+
+    for (std::size_t pos = 0; pos < text.size();)
+    {
+        const auto length = code_point_length(text, pos);
+        const auto end    = pos + length;
+
+        if (length == 1)
+        {
+            const auto byte = static_cast<unsigned char>(text[pos]);
+            num_digits += (byte >= '0' && byte <= '9') ? 1 : 0;
+            num_upper += (byte >= 'A' && byte <= 'Z') ? 1 : 0;
+        }
+
+        if (m_needs_histogram)
+        {
+            const auto code_point = decode(text.substr(pos, length));
+            if (code_point < ascii_counts.size() && length == 1)
+            {
+                ++ascii_counts[code_point];
+            }
+            else
+            {
+                // Invalid bytes are kept apart from the code points they would decode to
+                ++other_counts[length == 1 ? code_point | 0x80000000U : code_point];
+            }
+        }
+
+        if (m_max_ngram_size > 0)
+        {
+            starts[num_code_points % m_max_ngram_size] = pos;
+        }
+
+        ++num_code_points;
+
+        for (std::size_t i = 0; i < m_features.size(); ++i)
+        {
+            const auto& feature = m_features[i];
+            if (feature.type != StringFeatureType::NgramHash || num_code_points < feature.ngram_size)
+            {
+                continue;
+            }
+
+            const auto start = starts[(num_code_points - feature.ngram_size) % m_max_ngram_size];
+            const auto hash  = fnv1a_32(text.substr(start, end - start));
+            out[m_output_offsets[i] + hash % feature.num_buckets] += 1.0;
+        }
+
+        pos = end;
+    }
+
+    double entropy = 0.0;
+    if (m_needs_histogram)
+    {
+        const auto total = static_cast<double>(num_code_points);
+        auto add_count   = [&](std::size_t count) {
+            if (count > 0)
+            {
+                const auto p = static_cast<double>(count) / total;
+                entropy -= p * std::log2(p);
+            }
+        };
+
+        for (auto count : ascii_counts)
+        {
+            add_count(count);
+        }
+
+        for (const auto& [code_point, count] : other_counts)
+        {
+            add_count(count);
+        }
+    }
+
+    for (std::size_t i = 0; i < m_features.size(); ++i)
+    {
+        auto& value = out[m_output_offsets[i]];
+        switch (m_features[i].type)
+        {
+        case StringFeatureType::Length:
+            value = static_cast<double>(num_code_points);
+            break;
+        case StringFeatureType::Entropy:
+            value = entropy;
+            break;
+        case StringFeatureType::DigitRatio:
+            value = static_cast<double>(num_digits) / static_cast<double>(num_code_points);
+            break;
+        case StringFeatureType::UpperRatio:
+            value = static_cast<double>(num_upper) / static_cast<double>(num_code_points);
+            break;
+        case StringFeatureType::DomainLabelCount:
+            value = static_cast<double>(count_segments(url_host(text), "."));
+            break;
+        case StringFeatureType::PathDepth:
+            value = static_cast<double>(count_segments(url_path(text), "/\\"));
+            break;
+        case StringFeatureType::NgramHash:
+            break;
+        }
+    }
+}
+
+std::uint32_t fnv1a_32(std::string_view bytes)
+{
+    std::uint32_t hash = 2166136261U;
+    for (char c : bytes)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+StringFeatureType parse_string_feature_type(const std::string& name)
+{
+    for (const auto& [type_name, type] : FeatureTypeNames)
+    {
+        if (type_name == name)
+        {
+            return type;
+        }
+    }
+
+    throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unknown string feature type '" << name << "'"));
+}
+
+}  // namespace morpheus
@@ -0,0 +1,856 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/syslog_parser.hpp"
+
+#include "morpheus/utilities/string_util.hpp"     // for MORPHEUS_CONCAT_STR
+#include "morpheus/utilities/timestamp_util.hpp"  // for TimestampUtil
+
+#include <algorithm>     // for min
+#include <array>         // for array
+#include <charconv>      // for from_chars
+#include <deque>         // for deque
+#include <optional>      // for optional, nullopt
+#include <set>           // for set
+#include <sstream>       // ostringstream needed by MORPHEUS_CONCAT_STR
+#include <stdexcept>     // for invalid_argument, runtime_error
+#include <system_error>  // for errc
+#include <utility>       // for move
+
+namespace morpheus {
+
+namespace {
+constexpr std::size_t NumHeaderFields = static_cast<std::size_t>(LogHeaderField::EventSeverity) + 1;
+
+const std::array<std::string, NumHeaderFields> HeaderFieldNames = {"log_format",
+                                                                   "log_format_version",
+                                                                   "syslog_facility",
+                                                                   "syslog_severity",
+                                                                   "syslog_timestamp",
+                                                                   "syslog_hostname",
+                                                                   "syslog_app_name",
+                                                                   "syslog_proc_id",
+                                                                   "syslog_msg_id",
+                                                                   "syslog_structured_data",
+                                                                   "syslog_message",
+                                                                   "device_vendor",
+                                                                   "device_product",
+                                                                   "device_version",
+                                                                   "event_id",
+                                                                   "event_name",
+                                                                   "event_severity"};
+
+const std::array<std::string_view, 12> MonthNames = {
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+cudf::type_id header_field_type(LogHeaderField field)
+{
+    switch (field)
+    {
+    case LogHeaderField::SyslogFacility:
+    case LogHeaderField::SyslogSeverity:
+        return cudf::type_id::INT32;
+    case LogHeaderField::SyslogTimestamp:
+        return cudf::type_id::TIMESTAMP_NANOSECONDS;
+    default:
+        return cudf::type_id::STRING;
+    }
+}
+
+bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// Characters of the keys of a CEF extension
+bool is_key_char(char c)
+{
+    return is_digit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == '.' || c == '-' ||
+           c == '[' || c == ']';
+}
+
+std::string_view trim_trailing_spaces(std::string_view text)
+{
+    while (!text.empty() && text.back() == ' ')
+    {
+        text.remove_suffix(1);
+    }
+
+    return text;
+}
+
+// Length of the timestamp at the start of an RFC 3164 header, either `Mmm dd hh:mm:ss` with optional fractional
+// seconds or an ISO 8601 timestamp written by many devices instead, 0 when `text` doesn't start with a timestamp
+std::size_t rfc3164_timestamp_length(std::string_view text)
+{
+    if (text.size() >= 11 && is_digit(text[0]) && is_digit(text[1]) && is_digit(text[2]) && is_digit(text[3]) &&
+        text[4] == '-' && text[7] == '-' && text[10] == 'T')
+    {
+        return std::min(text.find(' '), text.size());
+    }
+
+    if (text.size() < 15 || text[3] != ' ' || text[6] != ' ' || text[9] != ':' || text[12] != ':')
+    {
+        return 0;
+    }
+
+    bool is_month = false;
+    for (const auto& month : MonthNames)
+    {
+        is_month = is_month || text.starts_with(month);
+    }
+
+    for (std::size_t i : {5, 7, 8, 10, 11, 13, 14})
+    {
+        if (!is_digit(text[i]))
+        {
+            return 0;
+        }
+    }
+
+    if (!is_month || (text[4] != ' ' && !is_digit(text[4])))
+    {
+        return 0;
+    }
+
+    std::size_t length = 15;
+    if (length + 1 < text.size() && text[length] == '.' && is_digit(text[length + 1]))
+    {
+        ++length;
+        while (length < text.size() && is_digit(text[length]))
+        {
+            ++length;
+        }
+    }
+
+    return length;
+}
+
+std::optional<bool> parse_bool(std::string_view value)
+{
+    std::string lower;
+    for (char c : value)
+    {
+        lower.push_back(c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c);
+    }
+
+    if (lower == "true" || lower == "1" || lower == "yes")
+    {
+        return true;
+    }
+
+    if (lower == "false" || lower == "0" || lower == "no")
+    {
+        return false;
+    }
+
+    return std::nullopt;
+}
+
+template <typename T>
+std::optional<T> parse_number(std::string_view value)
+{
+    while (!value.empty() && value.front() == ' ')
+    {
+        value.remove_prefix(1);
+    }
+
+    value = trim_trailing_spaces(value);
+
+    // from_chars doesn't accept a leading plus sign
+    if (value.starts_with('+'))
+    {
+        value.remove_prefix(1);
+    }
+
+    T number{};
+    auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), number);
+    if (value.empty() || error != std::errc{} || end != value.data() + value.size())
+    {
+        return std::nullopt;
+    }
+
+    return number;
+}
+}  // namespace
+
+// Component-private classes.
+// ************ SyslogParser::Event *************************//
+struct SyslogParser::Event
+{
+    std::array<std::optional<std::string_view>, NumHeaderFields> header;
+    std::optional<std::int32_t> facility;
+    std::optional<std::int32_t> severity;
+
+    // Value of each configured extension field
+    std::vector<std::optional<std::string_view>> extensions;
+
+    // Unescaped values, which are referenced by `header` and `extensions`
+    std::deque<std::string> buffer;
+
+    std::optional<std::string_view>& operator[](LogHeaderField field)
+    {
+        return header[static_cast<std::size_t>(field)];
+    }
+
+    // Replace the escape sequences of CEF, a backslash followed by any other character is kept as it is
+    std::string_view unescape(std::string_view text, bool is_extension)
+    {
+        auto& unescaped = buffer.emplace_back();
+        unescaped.reserve(text.size());
+
+        for (std::size_t i = 0; i < text.size(); ++i)
+        {
+            if (text[i] != '\\' || i + 1 == text.size())
+            {
+                unescaped.push_back(text[i]);
+                continue;
+            }
+
+            const char next = text[i + 1];
+            if (next == '\\' || (!is_extension && next == '|') || (is_extension && next == '='))
+            {
+                unescaped.push_back(next);
+            }
+            else if (is_extension && next == 'n')
+            {
+                unescaped.push_back('\n');
+            }
+            else if (is_extension && next == 'r')
+            {
+                unescaped.push_back('\r');
+            }
+            else
+            {
+                unescaped.append(text.substr(i, 2));
+            }
+
+            ++i;
+        }
+
+        return unescaped;
+    }
+};
+
+// Component public implementations
+// ************ SyslogParser ************************* //
+SyslogParser::SyslogParser(std::vector<LogHeaderField> header_fields,
+                           std::vector<LogExtensionField> extension_fields,
+                           const std::string& column_prefix,
+                           int syslog_year) :
+  m_header_fields(std::move(header_fields)),
+  m_extension_fields(std::move(extension_fields)),
+  m_syslog_year(syslog_year)
+{
+    for (auto field : m_header_fields)
+    {
+        m_columns.push_back({column_prefix + log_header_field_name(field), header_field_type(field)});
+    }
+
+    for (std::size_t i = 0; i < m_extension_fields.size(); ++i)
+    {
+        auto& field = m_extension_fields[i];
+        if (field.key.empty())
+        {
+            throw std::invalid_argument("Log extension keys can't be empty");
+        }
+
+        if (field.name.empty())
+        {
+            field.name = field.key;
+        }
+
+        if (field.type != cudf::type_id::STRING && field.type != cudf::type_id::INT64 &&
+            field.type != cudf::type_id::FLOAT64 && field.type != cudf::type_id::BOOL8 &&
+            field.type != cudf::type_id::TIMESTAMP_NANOSECONDS)
+        {
+            throw std::invalid_argument(
+                MORPHEUS_CONCAT_STR("Unsupported type of the log extension key '" << field.key << "'"));
+        }
+
+        m_columns.push_back({field.name, field.type});
+        m_extension_index[field.key].push_back(i);
+    }
+
+    std::set<std::string> names;
+    for (const auto& column : m_columns)
+    {
+        if (!names.insert(column.name).second)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Duplicate log column '" << column.name << "'"));
+        }
+    }
+}
+
+const std::vector<DecodedColumnSpec>& SyslogParser::columns() const
+{
+    return m_columns;
+}
+
+void SyslogParser::parse(std::string_view line,
+                         DecodedTable& table,
+                         const std::vector<std::size_t>& column_indices) const
+{
+    // Trailing line breaks of lines read from files
+    while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
+    {
+        line.remove_suffix(1);
+    }
+
+    Event event;
+    event.extensions.resize(m_extension_fields.size());
+
+    auto message = parse_syslog(line, event);
+    while (!message.empty() && message.front() == ' ')
+    {
+        message.remove_prefix(1);
+    }
+
+    if (message.starts_with("CEF:"))
+    {
+        event[LogHeaderField::LogFormat] = "cef";
+        parse_cef_extension(parse_cef(message.substr(4), event), event);
+    }
+    else if (message.starts_with("LEEF:"))
+    {
+        event[LogHeaderField::LogFormat] = "leef";
+
+        char delimiter = '\t';
+        auto extension = parse_leef(message.substr(5), event, delimiter);
+        parse_leef_extension(extension, delimiter, event);
+    }
+    else if (!event[LogHeaderField::LogFormat].has_value())
+    {
+        throw std::runtime_error("Unrecognized log line, expected a syslog header or a CEF or LEEF event");
+    }
+
+    for (std::size_t i = 0; i < m_header_fields.size(); ++i)
+    {
+        const auto column = column_indices[i];
+        const auto field  = m_header_fields[i];
+
+        if (field == LogHeaderField::SyslogFacility || field == LogHeaderField::SyslogSeverity)
+        {
+            const auto& value = field == LogHeaderField::SyslogFacility ? event.facility : event.severity;
+            if (value.has_value())
+            {
+                table.set_int(column, *value);
+            }
+
+            continue;
+        }
+
+        const auto& value = event[field];
+        if (!value.has_value())
+        {
+            continue;
+        }
+
+        if (field == LogHeaderField::SyslogTimestamp)
+        {
+            std::int64_t nanos = 0;
+            if (TimestampUtil::parse_any(*value, nanos, m_syslog_year))
+            {
+                table.set_int(column, nanos);
+            }
+        }
+        else
+        {
+            table.set_string(column, *value);
+        }
+    }
+
+    for (std::size_t i = 0; i < m_extension_fields.size(); ++i)
+    {
+        const auto& value = event.extensions[i];
+        if (!value.has_value())
+        {
+            continue;
+        }
+
+        const auto column = column_indices[m_header_fields.size() + i];
+        set_log_value(table, column, m_extension_fields[i].type, *value, m_syslog_year);
+    }
+}
+
+std::string_view SyslogParser::parse_syslog(std::string_view line, Event& event)
+{
+    auto rest       = line;
+    bool has_header = false;
+
+    if (rest.starts_with('<'))
+    {
+        auto close = rest.find('>');
+        if (close == std::string_view::npos || close < 2 || close > 4)
+        {
+            throw std::runtime_error("Invalid syslog priority");
+        }
+
+        std::int32_t priority = 0;
+        for (char c : rest.substr(1, close - 1))
+        {
+            if (!is_digit(c))
+            {
+                throw std::runtime_error("Invalid syslog priority");
+            }
+
+            priority = priority * 10 + (c - '0');
+        }
+
+        if (priority > 191)
+        {
+            throw std::runtime_error("Invalid syslog priority");
+        }
+
+        event.facility = priority / 8;
+        event.severity = priority % 8;
+        rest.remove_prefix(close + 1);
+        has_header = true;
+
+        // RFC 5424 headers start with a version, RFC 3164 headers with a timestamp
+        std::size_t digits = 0;
+        while (digits < rest.size() && digits < 3 && is_digit(rest[digits]))
+        {
+            ++digits;
+        }
+
+        if (digits > 0 && digits < rest.size() && rest[digits] == ' ' && rest[0] != '0')
+        {
+            rest.remove_prefix(digits + 1);
+            event[LogHeaderField::LogFormat] = "syslog";
+
+            // TIMESTAMP HOSTNAME APP-NAME PROCID MSGID, each of which is `-` when it is nil
+            for (auto field : {LogHeaderField::SyslogTimestamp,
+                               LogHeaderField::SyslogHostname,
+                               LogHeaderField::SyslogAppName,
+                               LogHeaderField::SyslogProcId,
+                               LogHeaderField::SyslogMsgId})
+            {
+                auto end = rest.find(' ');
+                if (end == std::string_view::npos || end == 0)
+                {
+                    throw std::runtime_error("Malformed RFC 5424 header");
+                }
+
+                if (rest.substr(0, end) != "-")
+                {
+                    event[field] = rest.substr(0, end);
+                }
+
+                rest.remove_prefix(end + 1);
+            }
+
+            // STRUCTURED-DATA is `-` or a sequence of `[id name="value" ...]` elements, the values escape `"`, `\`
+            // and `]` with a backslash
+            std::size_t pos = 0;
+            if (rest.starts_with('-'))
+            {
+                pos = 1;
+            }
+            else
+            {
+                while (pos < rest.size() && rest[pos] == '[')
+                {
+                    bool quoted = false;
+                    for (++pos; pos < rest.size() && (quoted || rest[pos] != ']'); ++pos)
+                    {
+                        if (quoted && rest[pos] == '\\')
+                        {
+                            ++pos;
+                        }
+                        else if (rest[pos] == '"')
+                        {
+                            quoted = !quoted;
+                        }
+                    }
+
+                    if (pos >= rest.size())
+                    {
+                        throw std::runtime_error("Malformed RFC 5424 structured data");
+                    }
+
+                    ++pos;
+                }
+
+                if (pos == 0)
+                {
+                    throw std::runtime_error("Malformed RFC 5424 structured data");
+                }
+
+                event[LogHeaderField::SyslogStructuredData] = rest.substr(0, pos);
+            }
+
+            rest.remove_prefix(pos);
+            if (rest.empty())
+            {
+                return rest;
+            }
+
+            if (rest.front() != ' ')
+            {
+                throw std::runtime_error("Malformed RFC 5424 structured data");
+            }
+
+            rest.remove_prefix(1);
+
+            // The message may start with a UTF-8 byte order mark
+            if (rest.starts_with("\xEF\xBB\xBF"))
+            {
+                rest.remove_prefix(3);
+            }
+
+            event[LogHeaderField::SyslogMessage] = rest;
+
+            return rest;
+        }
+    }
+
+    auto timestamp_length = rfc3164_timestamp_length(rest);
+    if (timestamp_length > 0)
+    {
+        has_header                                    = true;
+        event[LogHeaderField::SyslogTimestamp]        = rest.substr(0, timestamp_length);
+        rest.remove_prefix(std::min(timestamp_length + 1, rest.size()));
+
+        // The hostname is missing when the timestamp is followed by the tag or the event
+        auto end   = std::min(rest.find(' '), rest.size());
+        auto token = rest.substr(0, end);
+        if (!token.empty() && !token.ends_with(':') && !token.starts_with("CEF:") && !token.starts_with("LEEF:"))
+        {
+            event[LogHeaderField::SyslogHostname] = token;
+            rest.remove_prefix(std::min(end + 1, rest.size()));
+        }
+
+        // TAG, optionally followed by the process id in brackets, and a colon
+        end   = std::min(rest.find(' '), rest.size());
+        token = rest.substr(0, end);
+        if (token.size() > 1 && token.ends_with(':') && !token.starts_with("CEF:") && !token.starts_with("LEEF:"))
+        {
+            token.remove_suffix(1);
+
+            auto open = token.find('[');
+            if (open != std::string_view::npos && token.ends_with(']'))
+            {
+                event[LogHeaderField::SyslogProcId] = token.substr(open + 1, token.size() - open - 2);
+                token                               = token.substr(0, open);
+            }
+
+            event[LogHeaderField::SyslogAppName] = token;
+            rest.remove_prefix(std::min(end + 1, rest.size()));
+        }
+    }
+
+    if (!has_header)
+    {
+        return line;
+    }
+
+    // Without a timestamp the text following the priority is the message
+    event[LogHeaderField::LogFormat]     = "syslog";
+    event[LogHeaderField::SyslogMessage] = rest;
+
+    return rest;
+}
+
+std::string_view SyslogParser::parse_cef(std::string_view text, Event& event)
+{
+    // Version|Device Vendor|Device Product|Device Version|Signature ID|Name|Severity|Extension
+    std::size_t pos = 0;
+    for (auto field : {LogHeaderField::LogFormatVersion,
+                       LogHeaderField::DeviceVendor,
+                       LogHeaderField::DeviceProduct,
+                       LogHeaderField::DeviceVersion,
+                       LogHeaderField::EventId,
+                       LogHeaderField::EventName,
+                       LogHeaderField::EventSeverity})
+    {
+        const auto start = pos;
+        bool escaped     = false;
+        for (; pos < text.size() && text[pos] != '|'; ++pos)
+        {
+            if (text[pos] == '\\' && pos + 1 < text.size())
+            {
+                escaped = true;
+                ++pos;
+            }
+        }
+
+        if (pos >= text.size())
+        {
+            throw std::runtime_error("Malformed CEF header, expected 7 fields separated by '|'");
+        }
+
+        auto value   = text.substr(start, pos - start);
+        event[field] = escaped ? event.unescape(value, false) : value;
+        ++pos;
+    }
+
+    return text.substr(pos);
+}
+
+std::string_view SyslogParser::parse_leef(std::string_view text, Event& event, char& delimiter)
+{
+    // Version|Vendor|Product|Version|EventID|Extension, LEEF 2.0 may declare the delimiter before the extension
+    std::size_t pos = 0;
+    for (auto field : {LogHeaderField::LogFormatVersion,
+                       LogHeaderField::DeviceVendor,
+                       LogHeaderField::DeviceProduct,
+                       LogHeaderField::DeviceVersion,
+                       LogHeaderField::EventId})
+    {
+        auto end = text.find('|', pos);
+        if (end == std::string_view::npos)
+        {
+            throw std::runtime_error("Malformed LEEF header, expected 5 fields separated by '|'");
+        }
+
+        event[field] = text.substr(pos, end - pos);
+        pos          = end + 1;
+    }
+
+    auto extension = text.substr(pos);
+    auto end       = extension.find('|');
+
+    // A field holding '=' is already the extension of an event without a delimiter
+    if (!event[LogHeaderField::LogFormatVersion]->starts_with('2') || end == std::string_view::npos ||
+        extension.substr(0, end).find('=') != std::string_view::npos)
+    {
+        return extension;
+    }
+
+    // The delimiter is a single character or its hexadecimal code, such as `0x5E` or `x5E`, tabs by default
+    auto spec = extension.substr(0, end);
+    if (spec.size() == 1)
+    {
+        delimiter = spec[0];
+    }
+    else if (!spec.empty())
+    {
+        auto hex = spec;
+        if (hex.starts_with("0x") || hex.starts_with("0X"))
+        {
+            hex.remove_prefix(2);
+        }
+        else if (hex.starts_with('x') || hex.starts_with('X'))
+        {
+            hex.remove_prefix(1);
+        }
+
+        std::uint8_t code = 0;
+        auto [hex_end, error] = std::from_chars(hex.data(), hex.data() + hex.size(), code, 16);
+        if (hex.empty() || hex.size() == spec.size() || error != std::errc{} || hex_end != hex.data() + hex.size())
+        {
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Invalid LEEF delimiter '" << spec << "'"));
+        }
+
+        delimiter = static_cast<char>(code);
+    }
+
+    return extension.substr(end + 1);
+}
+
+void SyslogParser::parse_cef_extension(std::string_view text, Event& event) const
+{
+    // A key is a run of key characters preceded by a space or the start of the extension and followed by an unescaped
+    // '=', its value extends to the space preceding the next key. Other '=' characters are part of the values.
+    std::string_view key;
+    std::size_t value_start = std::string_view::npos;
+    bool escaped            = false;
+
+    for (std::size_t pos = 0; pos < text.size(); ++pos)
+    {
+        if (text[pos] == '\\')
+        {
+            escaped = true;
+            ++pos;
+            continue;
+        }
+
+        if (text[pos] != '=')
+        {
+            continue;
+        }
+
+        auto key_start = pos;
+        while (key_start > 0 && is_key_char(text[key_start - 1]))
+        {
+            --key_start;
+        }
+
+        if (key_start == pos || (key_start > 0 && text[key_start - 1] != ' ') ||
+            (value_start != std::string_view::npos && key_start <= value_start))
+        {
+            continue;
+        }
+
+        if (value_start != std::string_view::npos)
+        {
+            set_extension(key, trim_trailing_spaces(text.substr(value_start, key_start - value_start)), escaped, event);
+        }
+        else if (text.substr(0, key_start).find_first_not_of(' ') != std::string_view::npos)
+        {
+            throw std::runtime_error("Malformed CEF extension, expected key=value pairs");
+        }
+
+        key         = text.substr(key_start, pos - key_start);
+        value_start = pos + 1;
+        escaped     = false;
+    }
+
+    if (value_start != std::string_view::npos)
+    {
+        set_extension(key, trim_trailing_spaces(text.substr(value_start)), escaped, event);
+    }
+    else if (text.find_first_not_of(' ') != std::string_view::npos)
+    {
+        throw std::runtime_error("Malformed CEF extension, expected key=value pairs");
+    }
+}
+
+void SyslogParser::parse_leef_extension(std::string_view text, char delimiter, Event& event) const
+{
+    while (!text.empty())
+    {
+        auto end  = std::min(text.find(delimiter), text.size());
+        auto pair = text.substr(0, end);
+        text.remove_prefix(std::min(end + 1, text.size()));
+
+        // Pairs without a key are skipped
+        auto equals = pair.find('=');
+        if (equals != std::string_view::npos && equals > 0)
+        {
+            set_extension(pair.substr(0, equals), pair.substr(equals + 1), false, event);
+        }
+    }
+}
+
+void SyslogParser::set_extension(std::string_view key, std::string_view value, bool unescape, Event& event) const
+{
+    auto found = m_extension_index.find(key);
+    if (found == m_extension_index.end())
+    {
+        return;
+    }
+
+    if (unescape)
+    {
+        value = event.unescape(value, true);
+    }
+
+    // The last value of a repeated key wins
+    for (auto field : found->second)
+    {
+        event.extensions[field] = value;
+    }
+}
+
+std::string log_header_field_name(LogHeaderField field)
+{
+    return HeaderFieldNames[static_cast<std::size_t>(field)];
+}
+
+LogHeaderField parse_log_header_field(const std::string& name)
+{
+    for (std::size_t i = 0; i < HeaderFieldNames.size(); ++i)
+    {
+        if (HeaderFieldNames[i] == name)
+        {
+            return static_cast<LogHeaderField>(i);
+        }
+    }
+
+    throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unknown log header field '" << name << "'"));
+}
+
+std::vector<LogHeaderField> all_log_header_fields()
+{
+    std::vector<LogHeaderField> fields;
+    for (std::size_t i = 0; i < NumHeaderFields; ++i)
+    {
+        fields.push_back(static_cast<LogHeaderField>(i));
+    }
+
+    return fields;
+}
+
+cudf::type_id parse_log_extension_type(const std::string& name)
+{
+    if (name == "str")
+    {
+        return cudf::type_id::STRING;
+    }
+
+    if (name == "int")
+    {
+        return cudf::type_id::INT64;
+    }
+
+    if (name == "float")
+    {
+        return cudf::type_id::FLOAT64;
+    }
+
+    if (name == "bool")
+    {
+        return cudf::type_id::BOOL8;
+    }
+
+    if (name == "timestamp")
+    {
+        return cudf::type_id::TIMESTAMP_NANOSECONDS;
+    }
+
+    throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unknown log extension type '"
+                                                    << name << "', must be one of: str, int, float, bool, timestamp"));
+}
+
+void set_log_value(DecodedTable& table, std::size_t column, cudf::type_id type, std::string_view value, int syslog_year)
+{
+    switch (type)
+    {
+    case cudf::type_id::INT64:
+        if (auto number = parse_number<std::int64_t>(value))
+        {
+            table.set_int(column, *number);
+        }
+        break;
+    case cudf::type_id::FLOAT64:
+        if (auto number = parse_number<double>(value))
+        {
+            table.set_float(column, *number);
+        }
+        break;
+    case cudf::type_id::BOOL8:
+        if (auto flag = parse_bool(value))
+        {
+            table.set_int(column, *flag ? 1 : 0);
+        }
+        break;
+    case cudf::type_id::TIMESTAMP_NANOSECONDS: {
+        std::int64_t nanos = 0;
+        if (TimestampUtil::parse_any(value, nanos, syslog_year))
+        {
+            table.set_int(column, nanos);
+        }
+        break;
+    }
+    default:
+        table.set_string(column, value);
+    }
+}
+
+}  // namespace morpheus
@@ -18,15 +18,21 @@
 #include "morpheus/objects/table_info.hpp"
 
 #include "morpheus/objects/dtype.hpp"
-
-#include <cudf/copying.hpp>
-#include <cudf/table/table_view.hpp>
-#include <cudf/types.hpp>
-#include <glog/logging.h>
-#include <pybind11/gil.h>       // for gil_scoped_acquire
-#include <pybind11/pybind11.h>  // IWYU pragma: keep
-#include <pybind11/pytypes.h>
-#include <pybind11/stl.h>  // IWYU pragma: keep
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <cuda_runtime.h>                    // for cudaMemset
+#include <cudf/column/column.hpp>            // for column
+#include <cudf/column/column_factories.hpp>  // for make_column_from_scalar, make_fixed_width_column
+#include <cudf/copying.hpp>                  // for slice
+#include <cudf/scalar/scalar.hpp>            // for string_scalar
+#include <cudf/table/table_view.hpp>         // for table_view
+#include <cudf/types.hpp>                    // for size_type, size_of
+#include <glog/logging.h>                    // for CHECK
+#include <mrc/cuda/common.hpp>               // for MRC_CHECK_CUDA
+#include <pybind11/gil.h>                    // for gil_scoped_acquire
+#include <pybind11/pybind11.h>               // IWYU pragma: keep
+#include <pybind11/pytypes.h>                // for object
+#include <pybind11/stl.h>                    // IWYU pragma: keep
 
 #include <algorithm>  // for find, transform
 #include <cstddef>    // for size_t
@@ -126,6 +132,25 @@ TableInfoData get_table_info_data_slice(const TableInfoData& table,
     return {table_view_out, table.index_names, column_names};
 }
 
+namespace {
+// Column of zeros, or of empty strings for string columns
+std::unique_ptr<cudf::column> make_zero_column(const DType& dtype, cudf::size_type num_rows)
+{
+    if (dtype.type_id() == TypeId::STRING)
+    {
+        return cudf::make_column_from_scalar(cudf::string_scalar(""), num_rows);
+    }
+
+    auto column = cudf::make_fixed_width_column(cudf::data_type{dtype.cudf_type_id()}, num_rows);
+    if (num_rows > 0)
+    {
+        MRC_CHECK_CUDA(cudaMemset(column->mutable_view().head(), 0, num_rows * cudf::size_of(column->type())));
+    }
+
+    return column;
+}
+}  // namespace
+
 /****** Component public implementations *******************/
 /****** TableInfoBase****************************************/
 TableInfoBase::TableInfoBase(std::shared_ptr<const IDataTable> parent, TableInfoData data) :
@@ -220,8 +245,9 @@ TableInfo TableInfo::get_slice(cudf::size_type start, cudf::size_type stop, std:
 MutableTableInfo::MutableTableInfo(std::shared_ptr<const IDataTable> parent,
                                    std::unique_lock<std::shared_mutex> lock,
                                    TableInfoData data) :
-  TableInfoBase(parent, std::move(data)),
-  m_lock(std::move(lock))
+  TableInfoBase(parent, data),
+  m_lock(std::move(lock)),
+  m_table_data(std::move(data))
 {}
 
 MutableTableInfo::~MutableTableInfo()
@@ -236,40 +262,48 @@ MutableTableInfo MutableTableInfo::get_slice(cudf::size_type start,
                                              cudf::size_type stop,
                                              std::vector<std::string> column_names) &&
 {
+    // Keep track of the rows and columns of the whole table being viewed, for `commit`
+    const auto slice_start  = m_slice_start + start;
+    const auto slice_stop   = m_slice_start + (stop < 0 ? this->num_rows() : stop);
+    auto slice_column_names = column_names.empty() ? m_slice_columns : column_names;
+    auto slice_data         = get_table_info_data_slice(this->get_data(), start, stop, std::move(column_names));
+
     // Create a new Table info, (moving the unique_lock)
-    return {
-        this->get_parent(), std::move(m_lock), get_table_info_data_slice(this->get_data(), start, stop, column_names)};
+    MutableTableInfo slice{this->get_parent(), std::move(m_lock), std::move(slice_data)};
+    slice.m_table_data       = std::move(m_table_data);
+    slice.m_table_data_stale = m_table_data_stale;
+    slice.m_slice_start      = slice_start;
+    slice.m_slice_stop       = slice_stop;
+    slice.m_slice_columns    = std::move(slice_column_names);
+
+    return slice;
 }
 
 void MutableTableInfo::insert_columns(const std::vector<std::tuple<std::string, morpheus::DType>>& columns)
 {
-    const auto num_existing_cols = this->get_data().column_names.size();
-    const auto num_rows          = this->get_data().table_view.num_rows();
+    this->refresh_table_data();
 
-    // TODO(mdemoret): figure out how to do this without the gil
-    {
-        py::gil_scoped_acquire gil;
-        py::object cudf_scalar = py::module_::import("cudf").attr("Scalar");
+    const auto num_rows = m_table_data.table_view.num_rows();
 
-        auto table = this->get_parent()->get_py_object();
-
-        for (std::size_t i = 0; i < columns.size(); ++i)
-        {
-            auto scalar = cudf_scalar(0, std::get<1>(columns[i]).type_str());
-            table.attr("insert")(num_existing_cols + i, std::get<0>(columns[i]), scalar);
-            this->get_data().column_names.push_back(std::get<0>(columns[i]));
-        }
+    TableTransaction transaction;
+    for (const auto& [name, dtype] : columns)
+    {
+        transaction.add_column(name, make_zero_column(dtype, num_rows));
     }
+
+    this->commit(std::move(transaction));
 }
 
 void MutableTableInfo::insert_missing_columns(const std::vector<std::tuple<std::string, morpheus::DType>>& columns)
 {
+    // A slice may not view all of the existing columns, only those missing from the whole table are inserted
+    this->refresh_table_data();
+
     std::vector<std::tuple<std::string, morpheus::DType>> missing_columns;
     for (const auto& column : columns)
     {
-        if (std::find(this->get_data().column_names.begin(),
-                      this->get_data().column_names.end(),
-                      std::get<0>(column)) == this->get_data().column_names.end())
+        if (std::find(m_table_data.column_names.begin(), m_table_data.column_names.end(), std::get<0>(column)) ==
+            m_table_data.column_names.end())
         {
             missing_columns.push_back(column);
         }
@@ -297,6 +331,9 @@ void MutableTableInfo::return_obj(std::unique_ptr<pybind11::object>&& obj)
 {
     obj.reset(nullptr);
     m_checked_out_ref_count = -1;
+
+    // The python object may have been modified
+    m_table_data_stale = true;
 }
 
 std::optional<std::string> MutableTableInfo::ensure_sliceable_index()
@@ -344,4 +381,125 @@ std::optional<std::string> MutableTableInfo::ensure_sliceable_index()
     return old_index_col_name;
 }
 
+void MutableTableInfo::refresh_table_data()
+{
+    if (m_table_data_stale)
+    {
+        m_table_data       = this->get_parent()->get_table_data();
+        m_table_data_stale = false;
+    }
+}
+
+void MutableTableInfo::commit(TableTransaction&& transaction)
+{
+    if (m_checked_out_ref_count >= 0)
+    {
+        throw std::runtime_error("Cannot commit a transaction while the python object is checked out");
+    }
+
+    if (transaction.empty())
+    {
+        return;
+    }
+
+    this->refresh_table_data();
+
+    const auto num_rows = m_table_data.table_view.num_rows();
+
+    // Apply the changes to a description of the columns first, so that the table is only modified once all of them
+    // are known to be valid. Keep the names of the existing columns to update the columns of a slice.
+    std::vector<TableColumn> columns;
+    std::vector<std::optional<std::string>> former_names;
+    for (std::size_t i = 0; i < m_table_data.column_names.size(); ++i)
+    {
+        columns.push_back({m_table_data.column_names[i], static_cast<cudf::size_type>(i), nullptr});
+        former_names.push_back(m_table_data.column_names[i]);
+    }
+
+    auto find_column = [&columns](const std::string& name) {
+        return std::find_if(columns.begin(), columns.end(), [&name](const TableColumn& column) {
+            return column.name == name;
+        });
+    };
+
+    for (auto& change : transaction.m_changes)
+    {
+        auto found = find_column(change.name);
+        if (change.type == TableTransaction::ChangeType::Add)
+        {
+            if (found != columns.end())
+            {
+                throw std::invalid_argument("Column already exists: " + change.name);
+            }
+        }
+        else if (found == columns.end())
+        {
+            throw std::invalid_argument("Unknown column: " + change.name);
+        }
+
+        if (change.column != nullptr && change.column->size() != num_rows)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR(
+                "Column '" << change.name << "' has " << change.column->size() << " rows, expected " << num_rows));
+        }
+
+        switch (change.type)
+        {
+        case TableTransaction::ChangeType::Add:
+            columns.push_back({change.name, -1, std::move(change.column)});
+            former_names.emplace_back();
+            break;
+        case TableTransaction::ChangeType::Replace:
+            found->source_idx = -1;
+            found->column     = std::move(change.column);
+            break;
+        case TableTransaction::ChangeType::Drop:
+            former_names.erase(former_names.begin() + (found - columns.begin()));
+            columns.erase(found);
+            break;
+        case TableTransaction::ChangeType::Rename:
+            if (change.new_name != change.name && find_column(change.new_name) != columns.end())
+            {
+                throw std::invalid_argument("Column already exists: " + change.new_name);
+            }
+
+            found->name = change.new_name;
+            break;
+        }
+    }
+
+    this->get_parent()->set_table_columns(m_table_data, std::move(columns));
+
+    // Refresh the views, the parent no longer needs the GIL for this
+    m_table_data = this->get_parent()->get_table_data();
+
+    if (m_slice_start == 0 && m_slice_stop < 0 && m_slice_columns.empty())
+    {
+        this->get_data() = m_table_data;
+        return;
+    }
+
+    // A slice keeps viewing its columns which still exist, under their new names, followed by the columns it added
+    std::vector<std::string> slice_columns;
+    for (const auto& name : m_slice_columns)
+    {
+        auto found = std::find(former_names.begin(), former_names.end(), name);
+        if (found != former_names.end())
+        {
+            slice_columns.push_back(m_table_data.column_names[found - former_names.begin()]);
+        }
+    }
+
+    for (std::size_t i = 0; i < former_names.size(); ++i)
+    {
+        if (!former_names[i].has_value())
+        {
+            slice_columns.push_back(m_table_data.column_names[i]);
+        }
+    }
+
+    m_slice_columns  = std::move(slice_columns);
+    this->get_data() = get_table_info_data_slice(m_table_data, m_slice_start, m_slice_stop, m_slice_columns);
+}
+
 }  // namespace morpheus
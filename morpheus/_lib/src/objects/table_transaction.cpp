@@ -0,0 +1,77 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/table_transaction.hpp"
+
+#include <stdexcept>  // for invalid_argument
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace {
+void check_column(const std::string& name, const std::unique_ptr<cudf::column>& column)
+{
+    if (column == nullptr)
+    {
+        throw std::invalid_argument("The column '" + name + "' is null");
+    }
+}
+}  // namespace
+
+/****** Component public implementations *******************/
+/****** TableTransaction************************************/
+TableTransaction& TableTransaction::add_column(std::string name, std::unique_ptr<cudf::column> column)
+{
+    check_column(name, column);
+    m_changes.push_back({ChangeType::Add, std::move(name), {}, std::move(column)});
+
+    return *this;
+}
+
+TableTransaction& TableTransaction::replace_column(std::string name, std::unique_ptr<cudf::column> column)
+{
+    check_column(name, column);
+    m_changes.push_back({ChangeType::Replace, std::move(name), {}, std::move(column)});
+
+    return *this;
+}
+
+TableTransaction& TableTransaction::drop_column(std::string name)
+{
+    m_changes.push_back({ChangeType::Drop, std::move(name), {}, nullptr});
+
+    return *this;
+}
+
+TableTransaction& TableTransaction::rename_column(std::string name, std::string new_name)
+{
+    m_changes.push_back({ChangeType::Rename, std::move(name), std::move(new_name), nullptr});
+
+    return *this;
+}
+
+std::size_t TableTransaction::size() const
+{
+    return m_changes.size();
+}
+
+bool TableTransaction::empty() const
+{
+    return m_changes.empty();
+}
+
+}  // namespace morpheus
@@ -0,0 +1,428 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/text_splitter.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <glog/logging.h>  // for LOG
+
+#include <algorithm>  // for lower_bound, max, min, remove_if
+#include <deque>
+#include <iterator>   // for distance
+#include <stdexcept>  // for invalid_argument
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace {
+bool is_continuation_byte(char c)
+{
+    return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+
+// Length in bytes of the UTF-8 sequence starting with `lead`
+std::size_t sequence_length(char lead)
+{
+    const auto byte = static_cast<unsigned char>(lead);
+    if (byte >= 0xF0)
+    {
+        return 4;
+    }
+
+    if (byte >= 0xE0)
+    {
+        return 3;
+    }
+
+    if (byte >= 0xC0)
+    {
+        return 2;
+    }
+
+    return 1;
+}
+
+std::uint32_t decode(std::string_view sequence)
+{
+    const auto lead = static_cast<unsigned char>(sequence.front());
+    switch (sequence.size())
+    {
+    case 2:
+        return ((lead & 0x1F) << 6) | (static_cast<unsigned char>(sequence[1]) & 0x3F);
+    case 3:
+        return ((lead & 0x0F) << 12) | ((static_cast<unsigned char>(sequence[1]) & 0x3F) << 6) |
+               (static_cast<unsigned char>(sequence[2]) & 0x3F);
+    case 4:
+        return ((lead & 0x07) << 18) | ((static_cast<unsigned char>(sequence[1]) & 0x3F) << 12) |
+               ((static_cast<unsigned char>(sequence[2]) & 0x3F) << 6) |
+               (static_cast<unsigned char>(sequence[3]) & 0x3F);
+    default:
+        return lead;
+    }
+}
+
+// The characters of Python's `str.isspace`
+bool is_space(std::uint32_t code_point)
+{
+    return (code_point >= 0x09 && code_point <= 0x0D) || (code_point >= 0x1C && code_point <= 0x20) ||
+           code_point == 0x85 || code_point == 0xA0 || code_point == 0x1680 ||
+           (code_point >= 0x2000 && code_point <= 0x200A) || code_point == 0x2028 || code_point == 0x2029 ||
+           code_point == 0x202F || code_point == 0x205F || code_point == 0x3000;
+}
+
+// Length of the whitespace character at the start of `text`, 0 if it doesn't start with whitespace
+std::size_t leading_space(std::string_view text)
+{
+    if (text.empty())
+    {
+        return 0;
+    }
+
+    const auto size = std::min(sequence_length(text.front()), text.size());
+    return is_space(decode(text.substr(0, size))) ? size : 0;
+}
+
+// Length of the whitespace character at the end of `text`, 0 if it doesn't end with whitespace
+std::size_t trailing_space(std::string_view text)
+{
+    if (text.empty())
+    {
+        return 0;
+    }
+
+    auto start = text.size() - 1;
+    while (start > 0 && text.size() - start < 4 && is_continuation_byte(text[start]))
+    {
+        --start;
+    }
+
+    return is_space(decode(text.substr(start))) ? text.size() - start : 0;
+}
+
+std::string_view strip(std::string_view text)
+{
+    while (auto size = leading_space(text))
+    {
+        text.remove_prefix(size);
+    }
+
+    while (auto size = trailing_space(text))
+    {
+        text.remove_suffix(size);
+    }
+
+    return text;
+}
+
+std::size_t count_characters(std::string_view text)
+{
+    std::size_t count = 0;
+    for (char c : text)
+    {
+        count += is_continuation_byte(c) ? 0 : 1;
+    }
+
+    return count;
+}
+
+std::size_t count_words(std::string_view text)
+{
+    std::size_t count = 0;
+    bool in_word      = false;
+    while (!text.empty())
+    {
+        if (auto size = leading_space(text))
+        {
+            in_word = false;
+            text.remove_prefix(size);
+            continue;
+        }
+
+        count += in_word ? 0 : 1;
+        in_word = true;
+        text.remove_prefix(std::min(sequence_length(text.front()), text.size()));
+    }
+
+    return count;
+}
+
+/**
+ * @brief Split `text` on the literal `separator` the same way as LangChain's `_split_text_with_regex`, the pieces are
+ * views of `text`. With `keep_separator` each separator is kept at the start of the piece following it.
+ */
+std::vector<std::string_view> split_on_separator(std::string_view text, std::string_view separator, bool keep_separator)
+{
+    std::vector<std::string_view> splits;
+
+    if (separator.empty())
+    {
+        while (!text.empty())
+        {
+            auto size = std::min(sequence_length(text.front()), text.size());
+            splits.push_back(text.substr(0, size));
+            text.remove_prefix(size);
+        }
+
+        return splits;
+    }
+
+    std::size_t start = 0;
+    auto found        = text.find(separator);
+    while (found != std::string_view::npos)
+    {
+        splits.push_back(text.substr(start, found - start));
+
+        // The next piece starts at the separator when it is kept
+        start = keep_separator ? found : found + separator.size();
+        found = text.find(separator, found + separator.size());
+    }
+
+    splits.push_back(text.substr(start));
+
+    splits.erase(std::remove_if(splits.begin(),
+                                splits.end(),
+                                [](std::string_view split) {
+                                    return split.empty();
+                                }),
+                 splits.end());
+
+    return splits;
+}
+}  // namespace
+
+/****** TextSplitter****************************************/
+TextSplitter::TextSplitter(std::size_t chunk_size,
+                           std::size_t chunk_overlap,
+                           std::vector<std::string> separators,
+                           bool keep_separator,
+                           bool strip_whitespace,
+                           TextLengthUnit length_unit) :
+  m_chunk_size(chunk_size),
+  m_chunk_overlap(chunk_overlap),
+  m_separators(std::move(separators)),
+  m_keep_separator(keep_separator),
+  m_strip_whitespace(strip_whitespace),
+  m_length_unit(length_unit)
+{
+    if (m_chunk_overlap > m_chunk_size)
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Got a larger chunk overlap ("
+                                                        << m_chunk_overlap << ") than chunk size (" << m_chunk_size
+                                                        << "), should be smaller."));
+    }
+
+    if (m_separators.empty())
+    {
+        m_separators = {"\n\n", "\n", " ", ""};
+    }
+}
+
+std::size_t TextSplitter::chunk_size() const
+{
+    return m_chunk_size;
+}
+
+std::size_t TextSplitter::chunk_overlap() const
+{
+    return m_chunk_overlap;
+}
+
+std::size_t TextSplitter::length(std::string_view text) const
+{
+    return m_length_unit == TextLengthUnit::Words ? count_words(text) : count_characters(text);
+}
+
+std::vector<std::string> TextSplitter::split_text(std::string_view text) const
+{
+    std::vector<std::string> chunks;
+    split_recursive(text, 0, chunks);
+
+    return chunks;
+}
+
+std::vector<std::pair<std::string, std::int64_t>> TextSplitter::split_text_with_offsets(std::string_view text) const
+{
+    auto chunks = split_text(text);
+
+    // Byte offset of each character, the search below is done in characters to match Python
+    std::vector<std::size_t> char_offsets;
+    char_offsets.reserve(text.size() + 1);
+    for (std::size_t i = 0; i < text.size(); ++i)
+    {
+        if (!is_continuation_byte(text[i]))
+        {
+            char_offsets.push_back(i);
+        }
+    }
+
+    char_offsets.push_back(text.size());
+
+    std::vector<std::pair<std::string, std::int64_t>> results;
+    results.reserve(chunks.size());
+
+    std::int64_t index              = 0;
+    std::int64_t previous_chunk_len = 0;
+    for (auto& chunk : chunks)
+    {
+        auto start = std::max<std::int64_t>(0, index + previous_chunk_len - static_cast<std::int64_t>(m_chunk_overlap));
+        start      = std::min<std::int64_t>(start, static_cast<std::int64_t>(char_offsets.size() - 1));
+
+        auto found = text.find(chunk, char_offsets[start]);
+        if (found == std::string_view::npos)
+        {
+            index = -1;
+        }
+        else
+        {
+            index = static_cast<std::int64_t>(
+                std::distance(char_offsets.begin(), std::lower_bound(char_offsets.begin(), char_offsets.end(), found)));
+        }
+
+        previous_chunk_len = static_cast<std::int64_t>(count_characters(chunk));
+        results.emplace_back(std::move(chunk), index);
+    }
+
+    return results;
+}
+
+void TextSplitter::split_recursive(std::string_view text,
+                                   std::size_t first_separator,
+                                   std::vector<std::string>& chunks) const
+{
+    // Use the first separator found in the text, an empty separator always matches
+    auto separator_idx  = m_separators.size() - 1;
+    auto next_separator = m_separators.size();
+    for (std::size_t i = first_separator; i < m_separators.size(); ++i)
+    {
+        if (m_separators[i].empty())
+        {
+            separator_idx = i;
+            break;
+        }
+
+        if (text.find(m_separators[i]) != std::string_view::npos)
+        {
+            separator_idx  = i;
+            next_separator = i + 1;
+            break;
+        }
+    }
+
+    const std::string_view separator = m_separators[separator_idx];
+    const auto splits                = split_on_separator(text, separator, m_keep_separator);
+    const auto merge_separator       = m_keep_separator ? std::string_view{} : separator;
+
+    std::vector<std::string_view> good_splits;
+    for (const auto& split : splits)
+    {
+        if (length(split) < m_chunk_size)
+        {
+            good_splits.push_back(split);
+            continue;
+        }
+
+        if (!good_splits.empty())
+        {
+            merge_splits(good_splits, merge_separator, chunks);
+            good_splits.clear();
+        }
+
+        if (next_separator >= m_separators.size())
+        {
+            chunks.emplace_back(split);
+        }
+        else
+        {
+            split_recursive(split, next_separator, chunks);
+        }
+    }
+
+    if (!good_splits.empty())
+    {
+        merge_splits(good_splits, merge_separator, chunks);
+    }
+}
+
+void TextSplitter::merge_splits(const std::vector<std::string_view>& splits,
+                                std::string_view separator,
+                                std::vector<std::string>& chunks) const
+{
+    const auto separator_len = length(separator);
+
+    // Splits of the chunk being built along with their lengths
+    std::deque<std::pair<std::string_view, std::size_t>> current;
+    std::size_t total = 0;
+
+    auto join_current = [&]() {
+        std::string joined;
+        for (std::size_t i = 0; i < current.size(); ++i)
+        {
+            if (i > 0)
+            {
+                joined += separator;
+            }
+
+            joined += current[i].first;
+        }
+
+        std::string_view chunk = joined;
+        if (m_strip_whitespace)
+        {
+            chunk = strip(chunk);
+        }
+
+        if (!chunk.empty())
+        {
+            chunks.emplace_back(chunk);
+        }
+    };
+
+    for (const auto& split : splits)
+    {
+        const auto split_len = length(split);
+
+        if (total + split_len + (current.empty() ? 0 : separator_len) > m_chunk_size)
+        {
+            if (total > m_chunk_size)
+            {
+                LOG(WARNING) << "Created a chunk of size " << total << ", which is longer than the specified "
+                             << m_chunk_size;
+            }
+
+            if (!current.empty())
+            {
+                join_current();
+
+                // Drop splits from the front until the remainder fits within the overlap, and the next split fits
+                while (total > m_chunk_overlap ||
+                       (total + split_len + (current.empty() ? 0 : separator_len) > m_chunk_size && total > 0))
+                {
+                    total -= current.front().second + (current.size() > 1 ? separator_len : 0);
+                    current.pop_front();
+                }
+            }
+        }
+
+        current.emplace_back(split, split_len);
+        total += split_len + (current.size() > 1 ? separator_len : 0);
+    }
+
+    join_current();
+}
+
+}  // namespace morpheus
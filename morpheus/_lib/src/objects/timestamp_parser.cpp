@@ -0,0 +1,233 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/timestamp_parser.hpp"
+
+#include "morpheus/objects/table_info_data.hpp"  // for TableInfoData
+#include "morpheus/utilities/column_util.hpp"    // for ColumnUtil, HostStringsColumn
+#include "morpheus/utilities/cudf_util.hpp"      // for CudfHelper
+#include "morpheus/utilities/string_util.hpp"    // for MORPHEUS_CONCAT_STR
+
+#include <cudf/io/types.hpp>     // for table_with_metadata, table_metadata
+#include <cudf/table/table.hpp>  // for table
+#include <cudf/types.hpp>        // for size_type, type_id
+#include <glog/logging.h>        // for CHECK, VLOG
+#include <pybind11/gil.h>        // for gil_scoped_release
+#include <pybind11/numpy.h>      // for array_t
+#include <pybind11/pybind11.h>
+
+#include <algorithm>  // for find
+#include <iterator>   // for distance
+#include <stdexcept>  // for invalid_argument
+#include <utility>    // for move
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** TimestampParser*************************************/
+TimestampParser::TimestampParser(std::size_t sample_size, int syslog_year) :
+  m_sample_size(sample_size),
+  m_syslog_year(syslog_year)
+{
+    CHECK(m_sample_size > 0) << "TimestampParser sample_size must be greater than zero";
+}
+
+TimestampFormat TimestampParser::get_format(const std::string& column) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto found = m_formats.find(column);
+    return found == m_formats.end() ? TimestampFormat::Unknown : found->second;
+}
+
+TimestampFormat TimestampParser::detect(const std::string& column,
+                                        const std::vector<std::optional<std::string_view>>& values)
+{
+    if (auto format = get_format(column); format != TimestampFormat::Unknown)
+    {
+        return format;
+    }
+
+    std::vector<std::string_view> sample;
+    for (const auto& value : values)
+    {
+        if (sample.size() == m_sample_size)
+        {
+            break;
+        }
+
+        if (value.has_value())
+        {
+            sample.push_back(*value);
+        }
+    }
+
+    auto format = TimestampUtil::detect_format(sample);
+    if (format != TimestampFormat::Unknown)
+    {
+        VLOG(10) << "Detected timestamp format " << TimestampUtil::format_name(format) << " for column '" << column
+                 << "'";
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_formats[column] = format;
+    }
+
+    return format;
+}
+
+std::vector<std::int64_t> TimestampParser::parse(const std::string& column,
+                                                 const std::vector<std::optional<std::string_view>>& values)
+{
+    const auto format = detect(column, values);
+
+    std::vector<std::int64_t> timestamps(values.size(), TimestampUtil::NaT);
+    std::size_t num_parsed   = 0;
+    std::size_t num_fallback = 0;
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if (!values[i].has_value())
+        {
+            continue;
+        }
+
+        if (TimestampUtil::parse(*values[i], format, timestamps[i], m_syslog_year))
+        {
+            ++num_parsed;
+            continue;
+        }
+
+        ++num_fallback;
+        if (!TimestampUtil::parse_any(*values[i], timestamps[i], m_syslog_year))
+        {
+            timestamps[i] = TimestampUtil::NaT;
+        }
+    }
+
+    if (format != TimestampFormat::Unknown && num_fallback > num_parsed)
+    {
+        // The format of the column has changed, or the sample wasn't representative
+        VLOG(10) << "Discarding timestamp format " << TimestampUtil::format_name(format) << " for column '" << column
+                 << "', " << num_fallback << " of " << (num_parsed + num_fallback) << " values didn't match";
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_formats.erase(column);
+    }
+
+    return timestamps;
+}
+
+std::unique_ptr<cudf::column> TimestampParser::parse_column(const std::string& column, const cudf::column_view& strings)
+{
+    if (strings.type().id() != cudf::type_id::STRING)
+    {
+        throw std::invalid_argument(
+            MORPHEUS_CONCAT_STR("Timestamp parsing requires a string column, column '" << column << "' is not"));
+    }
+
+    const HostStringsColumn host_strings{strings};
+    const auto num_rows = host_strings.size();
+
+    // The views point into `host_strings`
+    std::vector<std::optional<std::string_view>> values(num_rows);
+    for (std::size_t row = 0; row < num_rows; ++row)
+    {
+        if (host_strings.is_valid(row))
+        {
+            values[row] = host_strings.get(row);
+        }
+    }
+
+    auto timestamps = parse(column, values);
+
+    // Values which can't be parsed are null
+    std::vector<bool> valid(num_rows);
+    for (std::size_t row = 0; row < num_rows; ++row)
+    {
+        valid[row] = timestamps[row] != TimestampUtil::NaT;
+    }
+
+    return ColumnUtil::make_numeric_column(timestamps, cudf::type_id::TIMESTAMP_NANOSECONDS, valid);
+}
+
+/****** TimestampParserInterfaceProxy***********************/
+std::string TimestampParserInterfaceProxy::get_format(TimestampParser& self, const std::string& column)
+{
+    return TimestampUtil::format_name(self.get_format(column));
+}
+
+pybind11::object TimestampParserInterfaceProxy::parse(TimestampParser& self,
+                                                      const std::string& column,
+                                                      const pybind11::sequence& values)
+{
+    // The views point into the UTF-8 buffers cached by the str objects, which are kept alive by `values`
+    std::vector<std::optional<std::string_view>> views(values.size());
+    for (std::size_t i = 0; i < views.size(); ++i)
+    {
+        pybind11::object value = values[i];
+        if (pybind11::isinstance<pybind11::str>(value))
+        {
+            Py_ssize_t size  = 0;
+            const char* data = PyUnicode_AsUTF8AndSize(value.ptr(), &size);
+            if (data == nullptr)
+            {
+                throw pybind11::error_already_set();
+            }
+
+            views[i] = std::string_view(data, static_cast<std::size_t>(size));
+        }
+    }
+
+    std::vector<std::int64_t> timestamps;
+    {
+        pybind11::gil_scoped_release no_gil;
+        timestamps = self.parse(column, views);
+    }
+
+    return pybind11::array_t<std::int64_t>(static_cast<pybind11::ssize_t>(timestamps.size()), timestamps.data());
+}
+
+pybind11::object TimestampParserInterfaceProxy::parse_dataframe(TimestampParser& self,
+                                                                pybind11::object df,
+                                                                const std::string& column)
+{
+    auto info = CudfHelper::table_info_data_from_table(df);
+
+    auto found = std::find(info.column_names.begin(), info.column_names.end(), column);
+    if (found == info.column_names.end())
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Column '" << column << "' not found"));
+    }
+
+    // The table view starts with the index columns
+    const auto column_idx = info.index_names.size() +
+                            info.column_indices[std::distance(info.column_names.begin(), found)];
+
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    {
+        // `df` owns the memory of the view and remains referenced by the caller
+        pybind11::gil_scoped_release no_gil;
+        columns.push_back(self.parse_column(column, info.table_view.column(column_idx)));
+    }
+
+    cudf::io::table_metadata metadata;
+    metadata.schema_info.emplace_back(column);
+
+    return CudfHelper::table_from_table_with_metadata(
+        cudf::io::table_with_metadata{std::make_unique<cudf::table>(std::move(columns)), std::move(metadata)}, 0);
+}
+
+}  // namespace morpheus
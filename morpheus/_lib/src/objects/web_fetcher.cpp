@@ -0,0 +1,976 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/web_fetcher.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR, StringUtil
+
+#include <boost/asio/io_context.hpp>         // for io_context
+#include <boost/asio/ip/tcp.hpp>             // for tcp
+#include <boost/beast/core/error.hpp>        // for error_code
+#include <boost/beast/core/flat_buffer.hpp>  // for flat_buffer
+#include <boost/beast/core/tcp_stream.hpp>   // for tcp_stream
+#include <boost/beast/http.hpp>              // for async_read, async_write, request, response_parser
+#include <glog/logging.h>                    // for LOG
+#include <pybind11/cast.h>                   // for cast
+#include <pybind11/gil.h>                    // for gil_scoped_acquire, gil_scoped_release
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>  // IWYU pragma: keep
+
+#include <algorithm>     // for all_of, min, transform
+#include <atomic>        // for atomic
+#include <cctype>        // for isdigit, isspace, tolower
+#include <cstdint>       // for uint64_t
+#include <exception>     // for exception
+#include <fstream>       // for ifstream, ofstream
+#include <map>           // for multimap
+#include <mutex>         // for mutex, lock_guard
+#include <optional>      // for optional
+#include <sstream>       // for ostringstream
+#include <stdexcept>     // for invalid_argument
+#include <system_error>  // for error_code
+#include <thread>        // for thread
+#include <utility>       // for move, pair
+
+namespace morpheus {
+
+namespace py    = pybind11;
+namespace beast = boost::beast;
+namespace http  = beast::http;
+namespace net   = boost::asio;
+using tcp       = net::ip::tcp;
+
+namespace {
+std::string to_lower(std::string_view value)
+{
+    std::string result(value);
+    std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) {
+        return std::tolower(c);
+    });
+
+    return result;
+}
+
+std::string_view trim(std::string_view value)
+{
+    while (!value.empty() && std::isspace(static_cast<unsigned char>(value.front())))
+    {
+        value.remove_prefix(1);
+    }
+
+    while (!value.empty() && std::isspace(static_cast<unsigned char>(value.back())))
+    {
+        value.remove_suffix(1);
+    }
+
+    return value;
+}
+
+std::string default_port(const std::string& scheme)
+{
+    return scheme == "https" ? "443" : "80";
+}
+
+// The host and port of a URL as written in a URL and in the `Host` header, the port is omitted when it is the default
+std::string authority(const ParsedUrl& url)
+{
+    std::string result = url.host.find(':') != std::string::npos ? "[" + url.host + "]" : url.host;
+    if (url.port != default_port(url.scheme))
+    {
+        result += ":" + url.port;
+    }
+
+    return result;
+}
+
+bool is_redirect(unsigned status)
+{
+    return status == 301 || status == 302 || status == 303 || status == 307 || status == 308;
+}
+
+/**
+ * @brief Validator and content type of the cached response of a URL
+ */
+struct CacheEntry
+{
+    http::field validator_field;  // `ETag` or `Last-Modified`
+    std::string validator;
+    std::string content_type;
+};
+
+/**
+ * @brief On-disk cache of responses. The entry of each URL is a small file named by the hash of the URL, holding the
+ * URL, the validator and the content type of the response. The body is stored in a file named by the hash of the URL
+ * and the validator. Files are replaced by renaming, so that concurrent readers never see a partially written file.
+ */
+class ResponseCache
+{
+  public:
+    ResponseCache(std::filesystem::path cache_dir) : m_cache_dir(std::move(cache_dir))
+    {
+        std::filesystem::create_directories(m_cache_dir);
+    }
+
+    std::optional<CacheEntry> find(const std::string& url) const
+    {
+        std::ifstream file(entry_path(url));
+        std::string cached_url;
+        std::string field;
+        CacheEntry entry;
+        if (!std::getline(file, cached_url) || !std::getline(file, field) || !std::getline(file, entry.validator) ||
+            !std::getline(file, entry.content_type))
+        {
+            return std::nullopt;
+        }
+
+        // Guards against hash collisions
+        if (cached_url != url)
+        {
+            return std::nullopt;
+        }
+
+        entry.validator_field = field == "etag" ? http::field::etag : http::field::last_modified;
+
+        return entry;
+    }
+
+    std::optional<std::string> read_body(const std::string& url, const CacheEntry& entry) const
+    {
+        std::ifstream file(body_path(url, entry.validator), std::ios::binary);
+        if (!file)
+        {
+            return std::nullopt;
+        }
+
+        std::ostringstream body;
+        body << file.rdbuf();
+        return body.str();
+    }
+
+    void store(const std::string& url, const CacheEntry& entry, const std::string& body)
+    {
+        auto previous = find(url);
+
+        // The body is written first, so that an entry always refers to an existing body
+        write_file(body_path(url, entry.validator), body);
+        write_file(entry_path(url),
+                   MORPHEUS_CONCAT_STR(url << '\n'
+                                           << (entry.validator_field == http::field::etag ? "etag" : "last-modified")
+                                           << '\n'
+                                           << entry.validator << '\n'
+                                           << entry.content_type << '\n'));
+
+        if (previous.has_value() && previous->validator != entry.validator)
+        {
+            std::error_code ec;
+            std::filesystem::remove(body_path(url, previous->validator), ec);
+        }
+    }
+
+  private:
+    std::filesystem::path entry_path(const std::string& url) const
+    {
+        return m_cache_dir / (StringUtil::hash_fields({url, {}}) + ".entry");
+    }
+
+    std::filesystem::path body_path(const std::string& url, const std::string& validator) const
+    {
+        return m_cache_dir / (StringUtil::hash_fields({url, validator}) + ".body");
+    }
+
+    void write_file(const std::filesystem::path& path, const std::string& data)
+    {
+        auto tmp_path = path;
+        tmp_path += MORPHEUS_CONCAT_STR(".tmp" << m_tmp_counter++);
+        {
+            std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+            file.write(data.data(), static_cast<std::streamsize>(data.size()));
+            if (!file)
+            {
+                throw std::runtime_error(MORPHEUS_CONCAT_STR("Unable to write cache file " << tmp_path));
+            }
+        }
+
+        std::filesystem::rename(tmp_path, path);
+    }
+
+    std::filesystem::path m_cache_dir;
+    std::atomic<std::uint64_t> m_tmp_counter{0};
+};
+
+// Caches the response of `url` under its validator, responses without one can't be revalidated and aren't cached
+void store_response(ResponseCache& cache, const std::string& url, const WebResponse& response)
+{
+    CacheEntry entry{http::field::etag, response.etag, response.content_type};
+    if (entry.validator.empty())
+    {
+        entry = {http::field::last_modified, response.last_modified, response.content_type};
+    }
+
+    if (entry.validator.empty())
+    {
+        return;
+    }
+
+    try
+    {
+        cache.store(url, entry, response.body);
+    } catch (const std::exception& e)
+    {
+        LOG(WARNING) << "Unable to cache the response of '" << url << "': " << e.what();
+    }
+}
+
+// Answers a `304 Not Modified` response of `url` from the cache, returns false when the cached body can't be read
+bool read_cached_body(const ResponseCache& cache,
+                      const std::string& url,
+                      const CacheEntry& entry,
+                      WebResponse& response)
+{
+    auto body = cache.read_body(url, entry);
+    if (!body.has_value())
+    {
+        return false;
+    }
+
+    response.status       = 200;
+    response.content_type = entry.content_type;
+    response.body         = std::move(*body);
+    response.from_cache   = true;
+    return true;
+}
+
+// Fetches `url` with the fallback function, revalidating its cached response if there is one
+WebResponse fetch_with_fallback(const WebFetcher::fallback_fn_t& fallback_fn,
+                                ResponseCache* cache,
+                                const std::string& url)
+{
+    std::optional<CacheEntry> cached;
+    if (cache != nullptr)
+    {
+        cached = cache->find(url);
+    }
+
+    std::map<std::string, std::string> headers;
+    if (cached.has_value())
+    {
+        headers.emplace(cached->validator_field == http::field::etag ? "If-None-Match" : "If-Modified-Since",
+                        cached->validator);
+    }
+
+    auto response = fallback_fn(url, headers);
+    if (response.status == 304 && cached.has_value())
+    {
+        if (read_cached_body(*cache, url, *cached, response))
+        {
+            return response;
+        }
+
+        LOG(WARNING) << "Unable to read the cached response of '" << url << "', fetching it again";
+        response = fallback_fn(url, {});
+    }
+
+    if (response.status == 200 && cache != nullptr)
+    {
+        store_response(*cache, url, response);
+    }
+
+    return response;
+}
+
+/**
+ * @brief Idle keep-alive connections keyed by `host:port`
+ */
+class ConnectionPool
+{
+  public:
+    ConnectionPool(std::size_t max_idle_per_host) : m_max_idle_per_host(max_idle_per_host) {}
+
+    std::optional<beast::tcp_stream> take(const std::string& key)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = m_idle.find(key);
+        if (found == m_idle.end())
+        {
+            return std::nullopt;
+        }
+
+        std::optional<beast::tcp_stream> stream(std::move(found->second));
+        m_idle.erase(found);
+        return stream;
+    }
+
+    void give(const std::string& key, beast::tcp_stream stream)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_idle.count(key) < m_max_idle_per_host)
+        {
+            m_idle.emplace(key, std::move(stream));
+        }
+    }
+
+    std::size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_idle.size();
+    }
+
+  private:
+    std::size_t m_max_idle_per_host;
+
+    mutable std::mutex m_mutex;
+    std::multimap<std::string, beast::tcp_stream> m_idle;
+};
+
+/**
+ * @brief State of a batch shared by its sessions, only accessed from the thread running the batch
+ */
+struct Batch
+{
+    const WebFetcherConfig& config;
+    net::io_context& io_context;
+    ConnectionPool& pool;
+    ResponseCache* cache;
+
+    std::vector<WebResponse>& responses;
+
+    // Indices of the `http` URLs and the next one to fetch
+    std::vector<std::size_t> pending;
+    std::size_t next{0};
+
+    // Index and URL, possibly the target of a redirect, of the requests passed to the fallback function
+    std::vector<std::pair<std::size_t, std::string>> fallback;
+};
+
+/**
+ * @brief Fetches URLs of a batch one after the other over a single connection at a time, reusing the connection while
+ * consecutive URLs are on the same host. Each step is asynchronous, sessions run concurrently on the batch's thread.
+ */
+class Session : public std::enable_shared_from_this<Session>
+{
+  public:
+    Session(Batch& batch) : m_batch(batch), m_resolver(batch.io_context) {}
+
+    void start()
+    {
+        next();
+    }
+
+  private:
+    WebResponse& response()
+    {
+        return m_batch.responses[m_index];
+    }
+
+    std::string key() const
+    {
+        return m_url.host + ":" + m_url.port;
+    }
+
+    void next()
+    {
+        if (m_batch.next == m_batch.pending.size())
+        {
+            release_connection();
+            return;
+        }
+
+        m_index     = m_batch.pending[m_batch.next++];
+        m_url       = *ParsedUrl::parse(response().url);
+        m_redirects   = 0;
+        m_retried     = false;
+        m_conditional = true;
+
+        request();
+    }
+
+    void request()
+    {
+        response().final_url = m_url.str();
+
+        m_cached.reset();
+        if (m_batch.cache != nullptr && m_conditional)
+        {
+            m_cached = m_batch.cache->find(response().final_url);
+        }
+
+        m_request = http::request<http::empty_body>(http::verb::get, m_url.target, 11);
+        m_request.set(http::field::host, authority(m_url));
+        m_request.set(http::field::user_agent, m_batch.config.user_agent);
+        m_request.set(http::field::accept, "*/*");
+        m_request.set(http::field::accept_encoding, "identity");
+        if (m_cached.has_value())
+        {
+            m_request.set(m_cached->validator_field == http::field::etag ? http::field::if_none_match
+                                                                         : http::field::if_modified_since,
+                          m_cached->validator);
+        }
+
+        // Keep the current connection when the request is for the same host
+        if (m_stream.has_value() && m_stream_key == key())
+        {
+            m_reused = true;
+            write();
+            return;
+        }
+
+        release_connection();
+
+        if (auto idle = m_batch.pool.take(key()))
+        {
+            m_stream.emplace(std::move(*idle));
+            m_stream_key = key();
+            m_reused     = true;
+            write();
+            return;
+        }
+
+        connect();
+    }
+
+    void connect()
+    {
+        m_stream.reset();
+        m_stream_key = key();
+        m_reused     = false;
+
+        auto on_resolve = [self = shared_from_this()](beast::error_code ec, tcp::resolver::results_type results) {
+            if (ec)
+            {
+                return self->fail(MORPHEUS_CONCAT_STR("Unable to resolve host: " << ec.message()));
+            }
+
+            self->m_stream.emplace(self->m_batch.io_context);
+            self->m_stream->expires_after(self->m_batch.config.timeout);
+            self->m_stream->async_connect(results, [self](beast::error_code ec, const tcp::endpoint&) {
+                if (ec)
+                {
+                    self->m_stream.reset();
+                    return self->fail(MORPHEUS_CONCAT_STR("Unable to connect: " << ec.message()));
+                }
+
+                self->write();
+            });
+        };
+
+        m_resolver.async_resolve(m_url.host, m_url.port, std::move(on_resolve));
+    }
+
+    void write()
+    {
+        m_stream->expires_after(m_batch.config.timeout);
+        http::async_write(*m_stream, m_request, [self = shared_from_this()](beast::error_code ec, std::size_t) {
+            if (ec)
+            {
+                return self->on_error(ec, "sending the request");
+            }
+
+            self->read();
+        });
+    }
+
+    void read()
+    {
+        m_buffer.consume(m_buffer.size());
+        m_parser.emplace();
+        m_parser->body_limit(m_batch.config.max_body_size);
+
+        m_stream->expires_after(m_batch.config.timeout);
+        auto on_read = [self = shared_from_this()](beast::error_code ec, std::size_t) {
+            if (ec)
+            {
+                return self->on_error(ec, "reading the response");
+            }
+
+            self->on_response();
+        };
+
+        http::async_read(*m_stream, m_buffer, *m_parser, std::move(on_read));
+    }
+
+    void on_error(beast::error_code ec, const char* step)
+    {
+        m_stream.reset();
+
+        // The server may have closed a reused connection while it was idle, try once more on a new connection
+        if (m_reused && !m_retried && ec != http::error::body_limit)
+        {
+            m_retried = true;
+            connect();
+            return;
+        }
+
+        fail(MORPHEUS_CONCAT_STR("Error " << step << ": " << ec.message()));
+    }
+
+    void fail(std::string error)
+    {
+        LOG(WARNING) << "Error fetching '" << response().final_url << "': " << error;
+
+        response().status = 0;
+        response().error  = std::move(error);
+        next();
+    }
+
+    void on_response()
+    {
+        auto res = m_parser->release();
+        m_parser.reset();
+        m_retried = false;
+
+        if (!res.keep_alive())
+        {
+            m_stream.reset();
+        }
+
+        const auto status = res.result_int();
+        auto location     = res.find(http::field::location);
+        if (is_redirect(status) && location != res.end())
+        {
+            if (++m_redirects > m_batch.config.max_redirects)
+            {
+                return fail("Too many redirects");
+            }
+
+            auto target = m_url.resolve(std::string_view(location->value().data(), location->value().size()));
+            if (!target.has_value())
+            {
+                return fail(MORPHEUS_CONCAT_STR("Invalid redirect location '" << location->value() << "'"));
+            }
+
+            if (target->scheme != "http")
+            {
+                m_batch.fallback.emplace_back(m_index, target->str());
+                return next();
+            }
+
+            m_url = std::move(*target);
+            return request();
+        }
+
+        auto& result         = response();
+        result.status        = static_cast<int>(status);
+        result.content_type  = std::string(res[http::field::content_type]);
+        result.etag          = std::string(res[http::field::etag]);
+        result.last_modified = std::string(res[http::field::last_modified]);
+
+        if (status == 304 && m_cached.has_value())
+        {
+            // The cached body may have been removed since the entry was read, request the whole response again
+            if (!read_cached_body(*m_batch.cache, result.final_url, *m_cached, result))
+            {
+                LOG(WARNING) << "Unable to read the cached response of '" << result.final_url << "', fetching it again";
+                m_conditional = false;
+                return request();
+            }
+        }
+        else
+        {
+            result.body = std::move(res.body());
+
+            if (status == 200 && m_batch.cache != nullptr)
+            {
+                store_response(*m_batch.cache, result.final_url, result);
+            }
+        }
+
+        next();
+    }
+
+    void release_connection()
+    {
+        if (m_stream.has_value())
+        {
+            m_batch.pool.give(m_stream_key, std::move(*m_stream));
+            m_stream.reset();
+        }
+    }
+
+    Batch& m_batch;
+    tcp::resolver m_resolver;
+
+    std::optional<beast::tcp_stream> m_stream;
+    std::string m_stream_key;
+    bool m_reused{false};
+    bool m_retried{false};
+
+    // Cleared to request the whole response when the cached body of a `304 Not Modified` response can't be read
+    bool m_conditional{true};
+
+    std::size_t m_index{0};
+    ParsedUrl m_url;
+    std::size_t m_redirects{0};
+    std::optional<CacheEntry> m_cached;
+
+    http::request<http::empty_body> m_request;
+    beast::flat_buffer m_buffer;
+    std::optional<http::response_parser<http::string_body>> m_parser;
+};
+}  // namespace
+
+/****** ParsedUrl*******************************************/
+std::optional<ParsedUrl> ParsedUrl::parse(std::string_view url)
+{
+    url = trim(url);
+
+    const auto scheme_end = url.find("://");
+    if (scheme_end == std::string_view::npos)
+    {
+        return std::nullopt;
+    }
+
+    ParsedUrl result;
+    result.scheme = to_lower(url.substr(0, scheme_end));
+    if (result.scheme != "http" && result.scheme != "https")
+    {
+        return std::nullopt;
+    }
+
+    auto rest = url.substr(scheme_end + 3);
+    rest      = rest.substr(0, rest.find('#'));
+
+    const auto authority_end = std::min(rest.find_first_of("/?"), rest.size());
+    auto authority           = rest.substr(0, authority_end);
+
+    // User info isn't sent
+    if (auto at = authority.rfind('@'); at != std::string_view::npos)
+    {
+        authority.remove_prefix(at + 1);
+    }
+
+    std::string_view port;
+    if (!authority.empty() && authority.front() == '[')
+    {
+        const auto close = authority.find(']');
+        if (close == std::string_view::npos)
+        {
+            return std::nullopt;
+        }
+
+        result.host = to_lower(authority.substr(1, close - 1));
+        auto after  = authority.substr(close + 1);
+        if (!after.empty())
+        {
+            if (after.front() != ':')
+            {
+                return std::nullopt;
+            }
+
+            port = after.substr(1);
+        }
+    }
+    else if (auto colon = authority.rfind(':'); colon != std::string_view::npos)
+    {
+        result.host = to_lower(authority.substr(0, colon));
+        port        = authority.substr(colon + 1);
+    }
+    else
+    {
+        result.host = to_lower(authority);
+    }
+
+    if (result.host.empty() || !std::all_of(port.begin(), port.end(), [](unsigned char c) {
+            return std::isdigit(c);
+        }))
+    {
+        return std::nullopt;
+    }
+
+    result.port   = port.empty() ? default_port(result.scheme) : std::string(port);
+    result.target = std::string(rest.substr(authority_end));
+    if (result.target.empty() || result.target.front() != '/')
+    {
+        result.target.insert(0, "/");
+    }
+
+    return result;
+}
+
+std::optional<ParsedUrl> ParsedUrl::resolve(std::string_view location) const
+{
+    location = trim(location);
+    location = location.substr(0, location.find('#'));
+
+    if (location.substr(0, 2) == "//")
+    {
+        return parse(scheme + ":" + std::string(location));
+    }
+
+    // A scheme is followed by a colon before any path, query or fragment
+    const auto colon = location.find(':');
+    if (colon != std::string_view::npos && colon < location.find_first_of("/?"))
+    {
+        return parse(location);
+    }
+
+    ParsedUrl result = *this;
+    if (location.empty())
+    {
+        return result;
+    }
+
+    if (location.front() == '/')
+    {
+        result.target = std::string(location);
+    }
+    else if (location.front() == '?')
+    {
+        result.target = target.substr(0, target.find('?')) + std::string(location);
+    }
+    else
+    {
+        // Relative to the directory of the current path
+        const auto path = target.substr(0, target.find('?'));
+        result.target   = path.substr(0, path.rfind('/') + 1) + std::string(location);
+    }
+
+    return result;
+}
+
+std::string ParsedUrl::str() const
+{
+    return scheme + "://" + authority(*this) + target;
+}
+
+/****** WebResponse*****************************************/
+bool WebResponse::ok() const
+{
+    return error.empty() && status >= 200 && status < 300;
+}
+
+/****** WebFetcher******************************************/
+struct WebFetcher::Impl
+{
+    Impl(const WebFetcherConfig& config) : pool(config.max_connections)
+    {
+        if (!config.cache_dir.empty())
+        {
+            cache.emplace(config.cache_dir);
+        }
+    }
+
+    // Batches are fetched one at a time on the thread calling `fetch`
+    std::mutex fetch_mutex;
+    net::io_context io_context;
+
+    // Declared after `io_context` so that the idle connections are closed first
+    ConnectionPool pool;
+    std::optional<ResponseCache> cache;
+};
+
+WebFetcher::WebFetcher(WebFetcherConfig config, fallback_fn_t fallback_fn) :
+  m_config(std::move(config)),
+  m_fallback_fn(std::move(fallback_fn))
+{
+    if (m_config.max_connections == 0)
+    {
+        throw std::invalid_argument("max_connections must be greater than zero");
+    }
+
+    m_impl = std::make_unique<Impl>(m_config);
+}
+
+WebFetcher::~WebFetcher() = default;
+
+const WebFetcherConfig& WebFetcher::config() const
+{
+    return m_config;
+}
+
+std::size_t WebFetcher::num_idle_connections() const
+{
+    return m_impl->pool.size();
+}
+
+std::vector<WebResponse> WebFetcher::fetch(const std::vector<std::string>& urls)
+{
+    std::lock_guard<std::mutex> lock(m_impl->fetch_mutex);
+
+    std::vector<WebResponse> responses(urls.size());
+    Batch batch{
+        m_config, m_impl->io_context, m_impl->pool, m_impl->cache ? &*m_impl->cache : nullptr, responses, {}, 0, {}};
+
+    for (std::size_t i = 0; i < urls.size(); ++i)
+    {
+        responses[i].url       = urls[i];
+        responses[i].final_url = urls[i];
+
+        auto url = ParsedUrl::parse(urls[i]);
+        if (!url.has_value())
+        {
+            responses[i].error = "Invalid URL";
+            continue;
+        }
+
+        if (url->scheme == "http")
+        {
+            batch.pending.push_back(i);
+        }
+        else
+        {
+            batch.fallback.emplace_back(i, urls[i]);
+        }
+    }
+
+    const auto num_sessions = std::min(m_config.max_connections, batch.pending.size());
+    for (std::size_t i = 0; i < num_sessions; ++i)
+    {
+        std::make_shared<Session>(batch)->start();
+    }
+
+    // Returns once every session has run out of URLs, idle connections hold no pending operations
+    m_impl->io_context.restart();
+    m_impl->io_context.run();
+
+    if (!m_fallback_fn)
+    {
+        for (const auto& [index, url] : batch.fallback)
+        {
+            responses[index].error =
+                MORPHEUS_CONCAT_STR("Unsupported URL '" << url << "', only http URLs are fetched natively");
+        }
+
+        return responses;
+    }
+
+    // The fallback function blocks for the whole request, requests are made from several threads to overlap them
+    std::atomic<std::size_t> next_fallback{0};
+    auto fetch_fallback = [&]() {
+        for (auto i = next_fallback++; i < batch.fallback.size(); i = next_fallback++)
+        {
+            const auto& [index, url] = batch.fallback[i];
+            auto& response           = responses[index];
+            try
+            {
+                auto result      = fetch_with_fallback(m_fallback_fn, batch.cache, url);
+                result.url       = response.url;
+                result.final_url = result.final_url.empty() ? url : result.final_url;
+                response         = std::move(result);
+            } catch (const std::exception& e)
+            {
+                LOG(WARNING) << "Error fetching '" << url << "': " << e.what();
+
+                response.final_url = url;
+                response.error     = e.what();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < std::min(m_config.max_connections, batch.fallback.size()); ++i)
+    {
+        threads.emplace_back(fetch_fallback);
+    }
+
+    fetch_fallback();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return responses;
+}
+
+/****** WebFetcherInterfaceProxy****************************/
+std::shared_ptr<WebFetcher> WebFetcherInterfaceProxy::init(std::size_t max_connections,
+                                                           double timeout,
+                                                           std::string user_agent,
+                                                           std::size_t max_redirects,
+                                                           std::size_t max_body_size,
+                                                           std::string cache_dir,
+                                                           pybind11::object fallback_fn)
+{
+    WebFetcherConfig config;
+    config.max_connections = max_connections;
+    config.timeout         = std::chrono::milliseconds(static_cast<std::int64_t>(timeout * 1000));
+    config.user_agent      = std::move(user_agent);
+    config.max_redirects   = max_redirects;
+    config.max_body_size   = max_body_size;
+    config.cache_dir       = std::move(cache_dir);
+
+    if (fallback_fn.is_none())
+    {
+        return std::make_shared<WebFetcher>(std::move(config));
+    }
+
+    if (!PyCallable_Check(fallback_fn.ptr()))
+    {
+        throw std::invalid_argument("fallback_fn must be a callable receiving a URL");
+    }
+
+    // The function can be released from any thread, the GIL is needed to release it
+    std::shared_ptr<py::function> fetch_fn(new py::function(py::reinterpret_borrow<py::function>(fallback_fn)),
+                                           [](py::function* ptr) {
+                                               py::gil_scoped_acquire gil;
+                                               delete ptr;
+                                           });
+
+    auto fallback = [fetch_fn](const std::string& url, const std::map<std::string, std::string>& headers) {
+        py::gil_scoped_acquire gil;
+        try
+        {
+            auto result = (*fetch_fn)(url, py::arg("headers") = headers).cast<py::dict>();
+
+            auto optional_field = [&result](const char* key) {
+                return result.contains(key) && !result[key].is_none() ? result[key].cast<std::string>() : std::string();
+            };
+
+            WebResponse response;
+            response.status        = result["status"].cast<int>();
+            response.content_type  = optional_field("content_type");
+            response.body          = result["body"].cast<std::string>();
+            response.final_url     = optional_field("final_url");
+            response.etag          = optional_field("etag");
+            response.last_modified = optional_field("last_modified");
+
+            return response;
+        } catch (const py::error_already_set& e)
+        {
+            // Rethrow as a C++ exception, the Python error can't outlive the GIL
+            throw std::runtime_error(e.what());
+        }
+    };
+
+    return std::make_shared<WebFetcher>(std::move(config), std::move(fallback));
+}
+
+pybind11::list WebFetcherInterfaceProxy::fetch(WebFetcher& self, const std::vector<std::string>& urls)
+{
+    std::vector<WebResponse> responses;
+    {
+        py::gil_scoped_release nogil;
+        responses = self.fetch(urls);
+    }
+
+    py::list result;
+    for (const auto& response : responses)
+    {
+        py::dict item;
+        item["url"]          = response.url;
+        item["final_url"]    = response.final_url;
+        item["status"]       = response.status;
+        item["content_type"] = response.content_type;
+        item["body"]         = py::bytes(response.body);
+        item["from_cache"]   = response.from_cache;
+        item["error"]        = response.error;
+        result.append(std::move(item));
+    }
+
+    return result;
+}
+
+}  // namespace morpheus
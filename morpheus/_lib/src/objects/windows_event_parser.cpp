@@ -0,0 +1,1066 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/windows_event_parser.hpp"
+
+#include "morpheus/objects/syslog_parser.hpp"  // for set_log_value
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <algorithm>     // for find, find_if
+#include <charconv>      // for from_chars
+#include <optional>      // for optional, nullopt
+#include <sstream>       // ostringstream needed by MORPHEUS_CONCAT_STR
+#include <stdexcept>     // for invalid_argument, runtime_error
+#include <system_error>  // for errc
+#include <utility>       // for move
+
+namespace morpheus {
+
+namespace {
+// Deeper JSON events are rejected rather than recursing further
+constexpr std::size_t MaxJsonDepth = 64;
+
+// How a value has to be decoded before it is written
+enum class ValueEncoding : std::uint8_t
+{
+    Plain,
+    Xml,           // Text holding entity references, CDATA sections or carriage returns
+    XmlAttribute,  // Attribute value holding entity references or whitespace other than spaces
+    Json,          // Holds escapes
+};
+
+// An open XML element
+struct XmlElement
+{
+    std::string_view name;  // Qualified name, to match the end tag
+    std::size_t content_start;
+    bool has_children;
+    std::string_view data_name;  // `Name` attribute of the `Data` elements of `EventData`
+};
+
+// Buffers reused by the events parsed on the same thread, parsing doesn't allocate once they have grown
+struct Scratch
+{
+    std::string key;
+    std::string decoded;
+    std::vector<XmlElement> elements;
+    std::vector<std::pair<std::string_view, std::string_view>> attributes;
+    std::vector<std::string_view> path;
+    std::vector<std::size_t> path_offsets;
+};
+
+bool is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+std::string_view trim(std::string_view value)
+{
+    while (!value.empty() && is_space(value.front()))
+    {
+        value.remove_prefix(1);
+    }
+
+    while (!value.empty() && is_space(value.back()))
+    {
+        value.remove_suffix(1);
+    }
+
+    return value;
+}
+
+std::string_view local_name(std::string_view name)
+{
+    const auto colon = name.rfind(':');
+    return colon == std::string_view::npos ? name : name.substr(colon + 1);
+}
+
+void append_utf8(std::uint32_t code_point, std::string& out)
+{
+    if (code_point < 0x80)
+    {
+        out.push_back(static_cast<char>(code_point));
+    }
+    else if (code_point < 0x800)
+    {
+        out.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+    else if (code_point < 0x10000)
+    {
+        out.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+}
+
+// Decode the entity references and CDATA sections of XML text or of an attribute value, skipping comments and
+// processing instructions. Line breaks are normalized to `\n`, and whitespace in attribute values to spaces, the same
+// as an XML processor. The markup has already been checked by `read_xml`.
+void decode_xml(std::string_view text, bool is_attribute, std::string& out)
+{
+    std::size_t pos = 0;
+    while (pos < text.size())
+    {
+        const auto special = text.find_first_of("&<\r\n\t", pos);
+        out.append(text.substr(pos, special - pos));
+        if (special == std::string_view::npos)
+        {
+            return;
+        }
+
+        auto rest = text.substr(special);
+        if (rest[0] == '\r' || rest[0] == '\n' || rest[0] == '\t')
+        {
+            const bool is_crlf = rest.starts_with("\r\n");
+            out.push_back(is_attribute ? ' ' : rest[0] == '\t' ? '\t' : '\n');
+            pos = special + (is_crlf ? 2 : 1);
+        }
+        else if (rest.starts_with("<![CDATA["))
+        {
+            const auto end = rest.find("]]>");
+            out.append(rest.substr(9, end - 9));
+            pos = special + end + 3;
+        }
+        else if (rest.starts_with("<!--"))
+        {
+            pos = special + rest.find("-->") + 3;
+        }
+        else if (rest.starts_with("<?"))
+        {
+            pos = special + rest.find("?>") + 2;
+        }
+        else
+        {
+            const auto end = rest.find(';');
+            if (end == std::string_view::npos)
+            {
+                throw std::runtime_error("Malformed XML event, unterminated entity reference");
+            }
+
+            const auto entity = rest.substr(1, end - 1);
+            if (entity == "lt")
+            {
+                out.push_back('<');
+            }
+            else if (entity == "gt")
+            {
+                out.push_back('>');
+            }
+            else if (entity == "amp")
+            {
+                out.push_back('&');
+            }
+            else if (entity == "quot")
+            {
+                out.push_back('"');
+            }
+            else if (entity == "apos")
+            {
+                out.push_back('\'');
+            }
+            else if (entity.starts_with('#'))
+            {
+                const bool hex  = entity.starts_with("#x");
+                const auto code = entity.substr(hex ? 2 : 1);
+
+                std::uint32_t code_point{};
+                auto [last, error] = std::from_chars(code.data(), code.data() + code.size(), code_point, hex ? 16 : 10);
+                if (code.empty() || error != std::errc{} || last != code.data() + code.size() || code_point == 0 ||
+                    code_point > 0x10FFFF || (code_point >= 0xD800 && code_point < 0xE000))
+                {
+                    throw std::runtime_error("Malformed XML event, invalid character reference");
+                }
+
+                append_utf8(code_point, out);
+            }
+            else
+            {
+                throw std::runtime_error(MORPHEUS_CONCAT_STR("Malformed XML event, unknown entity '" << entity << "'"));
+            }
+
+            pos = special + end + 1;
+        }
+    }
+}
+
+std::optional<std::uint32_t> parse_hex4(std::string_view text)
+{
+    std::uint32_t value{};
+    auto [last, error] = std::from_chars(text.data(), text.data() + text.size(), value, 16);
+    if (text.size() != 4 || error != std::errc{} || last != text.data() + 4)
+    {
+        return std::nullopt;
+    }
+
+    return value;
+}
+
+// Decode the escapes of a JSON string, which have already been checked by `JsonReader`. Unpaired surrogates become the
+// replacement character.
+void decode_json(std::string_view text, std::string& out)
+{
+    std::size_t pos = 0;
+    while (pos < text.size())
+    {
+        const auto escape = text.find('\\', pos);
+        out.append(text.substr(pos, escape - pos));
+        if (escape == std::string_view::npos)
+        {
+            return;
+        }
+
+        const char c = text[escape + 1];
+        pos          = escape + 2;
+        switch (c)
+        {
+        case 'b':
+            out.push_back('\b');
+            break;
+        case 'f':
+            out.push_back('\f');
+            break;
+        case 'n':
+            out.push_back('\n');
+            break;
+        case 'r':
+            out.push_back('\r');
+            break;
+        case 't':
+            out.push_back('\t');
+            break;
+        case 'u': {
+            auto code_point = *parse_hex4(text.substr(pos, 4));
+            pos += 4;
+            if (code_point >= 0xD800 && code_point < 0xDC00 && text.substr(pos, 2) == "\\u")
+            {
+                auto low = *parse_hex4(text.substr(pos + 2, 4));
+                if (low >= 0xDC00 && low < 0xE000)
+                {
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                    pos += 6;
+                }
+            }
+
+            append_utf8(code_point >= 0xD800 && code_point < 0xE000 ? 0xFFFD : code_point, out);
+            break;
+        }
+        default:
+            out.push_back(c);
+        }
+    }
+}
+
+// Key of the element at the top of `elements` below the root element, see `WindowsEventParser`
+void xml_element_key(const std::vector<XmlElement>& elements, std::string& key)
+{
+    key.clear();
+
+    std::size_t first = 1;
+    if (elements.size() > 1)
+    {
+        const auto section = local_name(elements[1].name);
+        if (section == "System" || section == "EventData")
+        {
+            first = 2;
+        }
+        else if (section == "UserData")
+        {
+            first = 3;
+        }
+    }
+
+    if (!elements.back().data_name.empty())
+    {
+        key.append(elements.back().data_name);
+        return;
+    }
+
+    for (std::size_t i = first; i < elements.size(); ++i)
+    {
+        if (!key.empty())
+        {
+            key.push_back('.');
+        }
+
+        key.append(local_name(elements[i].name));
+    }
+}
+
+std::size_t skip_past(std::string_view xml, std::size_t pos, std::string_view terminator)
+{
+    const auto end = xml.find(terminator, pos);
+    if (end == std::string_view::npos)
+    {
+        throw std::runtime_error("Malformed XML event, unterminated markup");
+    }
+
+    return end + terminator.size();
+}
+
+std::string_view read_xml_name(std::string_view xml, std::size_t& pos)
+{
+    const auto start = pos;
+    while (pos < xml.size() && !is_space(xml[pos]) && xml[pos] != '>' && xml[pos] != '/' && xml[pos] != '=' &&
+           xml[pos] != '<' && xml[pos] != '"' && xml[pos] != '\'')
+    {
+        ++pos;
+    }
+
+    if (pos == start)
+    {
+        throw std::runtime_error("Malformed XML event, expected a name");
+    }
+
+    return xml.substr(start, pos - start);
+}
+
+void skip_xml_space(std::string_view xml, std::size_t& pos)
+{
+    while (pos < xml.size() && is_space(xml[pos]))
+    {
+        ++pos;
+    }
+}
+
+ValueEncoding xml_text_encoding(std::string_view text)
+{
+    return text.find_first_of("&<\r") == std::string_view::npos ? ValueEncoding::Plain : ValueEncoding::Xml;
+}
+
+ValueEncoding xml_attribute_encoding(std::string_view value)
+{
+    return value.find_first_of("&\r\n\t") == std::string_view::npos ? ValueEncoding::Plain
+                                                                    : ValueEncoding::XmlAttribute;
+}
+
+// Read an XML event in a single pass, calling `emit(key, value, encoding)` with each attribute and the text of each
+// leaf element
+template <typename EmitT>
+void read_xml(std::string_view xml, Scratch& scratch, EmitT&& emit)
+{
+    auto& elements = scratch.elements;
+    elements.clear();
+
+    bool seen_root  = false;
+    std::size_t pos = 0;
+    while (true)
+    {
+        const auto open = xml.find('<', pos);
+        if (elements.empty() && !trim(xml.substr(pos, open - pos)).empty())
+        {
+            throw std::runtime_error("Malformed XML event, text outside of the root element");
+        }
+
+        if (open == std::string_view::npos)
+        {
+            break;
+        }
+
+        const auto markup = xml.substr(open);
+        if (markup.starts_with("<?"))
+        {
+            pos = skip_past(xml, open + 2, "?>");
+        }
+        else if (markup.starts_with("<!--"))
+        {
+            pos = skip_past(xml, open + 4, "-->");
+        }
+        else if (markup.starts_with("<![CDATA["))
+        {
+            if (elements.empty())
+            {
+                throw std::runtime_error("Malformed XML event, text outside of the root element");
+            }
+
+            pos = skip_past(xml, open + 9, "]]>");
+        }
+        else if (markup.starts_with("<!"))
+        {
+            // Document type declaration
+            pos = skip_past(xml, open + 2, ">");
+        }
+        else if (markup.starts_with("</"))
+        {
+            pos             = open + 2;
+            const auto name = read_xml_name(xml, pos);
+            skip_xml_space(xml, pos);
+            if (pos >= xml.size() || xml[pos] != '>' || elements.empty() || elements.back().name != name)
+            {
+                throw std::runtime_error("Malformed XML event, mismatched end tag");
+            }
+
+            const auto& element = elements.back();
+            if (!element.has_children)
+            {
+                xml_element_key(elements, scratch.key);
+                const auto text = xml.substr(element.content_start, open - element.content_start);
+                emit(scratch.key, text, xml_text_encoding(text));
+            }
+
+            elements.pop_back();
+            ++pos;
+        }
+        else
+        {
+            if (elements.empty() && seen_root)
+            {
+                throw std::runtime_error("Malformed XML event, more than one root element");
+            }
+
+            pos             = open + 1;
+            const auto name = read_xml_name(xml, pos);
+
+            auto& attributes = scratch.attributes;
+            attributes.clear();
+
+            bool self_closing = false;
+            while (true)
+            {
+                skip_xml_space(xml, pos);
+                if (pos >= xml.size())
+                {
+                    throw std::runtime_error("Malformed XML event, unterminated start tag");
+                }
+
+                if (xml[pos] == '>')
+                {
+                    ++pos;
+                    break;
+                }
+
+                if (xml.substr(pos).starts_with("/>"))
+                {
+                    self_closing = true;
+                    pos += 2;
+                    break;
+                }
+
+                const auto attribute = read_xml_name(xml, pos);
+                skip_xml_space(xml, pos);
+                if (pos >= xml.size() || xml[pos] != '=')
+                {
+                    throw std::runtime_error("Malformed XML event, expected '=' after an attribute name");
+                }
+
+                ++pos;
+                skip_xml_space(xml, pos);
+                if (pos >= xml.size() || (xml[pos] != '"' && xml[pos] != '\''))
+                {
+                    throw std::runtime_error("Malformed XML event, expected a quoted attribute value");
+                }
+
+                const auto end = xml.find(xml[pos], pos + 1);
+                if (end == std::string_view::npos)
+                {
+                    throw std::runtime_error("Malformed XML event, unterminated attribute value");
+                }
+
+                attributes.emplace_back(attribute, xml.substr(pos + 1, end - pos - 1));
+                pos = end + 1;
+            }
+
+            if (!elements.empty())
+            {
+                elements.back().has_children = true;
+            }
+
+            elements.push_back({name, pos, false, {}});
+            seen_root = true;
+
+            const bool is_data = elements.size() == 3 && local_name(elements[1].name) == "EventData" &&
+                                 local_name(name) == "Data";
+            if (is_data)
+            {
+                auto found = std::find_if(attributes.begin(), attributes.end(), [](const auto& attribute) {
+                    return attribute.first == "Name";
+                });
+
+                if (found != attributes.end())
+                {
+                    elements.back().data_name = found->second;
+                }
+            }
+
+            xml_element_key(elements, scratch.key);
+            const auto key_size = scratch.key.size();
+            for (const auto& [attribute, value] : attributes)
+            {
+                if (attribute == "xmlns" || attribute.starts_with("xmlns:") ||
+                    (is_data && !elements.back().data_name.empty() && attribute == "Name"))
+                {
+                    continue;
+                }
+
+                scratch.key.resize(key_size);
+                if (key_size > 0)
+                {
+                    scratch.key.push_back('.');
+                }
+
+                scratch.key.append(local_name(attribute));
+                emit(scratch.key, value, xml_attribute_encoding(value));
+            }
+
+            if (self_closing)
+            {
+                xml_element_key(elements, scratch.key);
+                emit(scratch.key, xml.substr(pos, 0), ValueEncoding::Plain);
+                elements.pop_back();
+            }
+        }
+    }
+
+    if (!elements.empty())
+    {
+        throw std::runtime_error("Malformed XML event, unterminated element");
+    }
+
+    if (!seen_root)
+    {
+        throw std::runtime_error("Malformed XML event, no root element");
+    }
+}
+
+// Reads a JSON event in a single pass, calling `emit(key, value, encoding)` with each scalar for each of the suffixes
+// of its path
+template <typename EmitT>
+class JsonReader
+{
+  public:
+    JsonReader(std::string_view json, Scratch& scratch, EmitT& emit) : m_json(json), m_scratch(scratch), m_emit(emit)
+    {
+        m_scratch.path.clear();
+    }
+
+    void read()
+    {
+        skip_space();
+        if (m_pos >= m_json.size() || m_json[m_pos] != '{')
+        {
+            throw std::runtime_error("Malformed JSON event, expected an object");
+        }
+
+        read_value(0);
+        skip_space();
+        if (m_pos != m_json.size())
+        {
+            throw std::runtime_error("Malformed JSON event, unexpected characters after the event");
+        }
+    }
+
+  private:
+    // A scalar value, strings are without their quotes
+    struct Scalar
+    {
+        std::string_view value;
+        ValueEncoding encoding{ValueEncoding::Plain};
+        bool present{false};
+    };
+
+    void skip_space()
+    {
+        while (m_pos < m_json.size() && is_space(m_json[m_pos]))
+        {
+            ++m_pos;
+        }
+    }
+
+    void expect(char c)
+    {
+        skip_space();
+        if (m_pos >= m_json.size() || m_json[m_pos] != c)
+        {
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Malformed JSON event, expected '" << c << "'"));
+        }
+
+        ++m_pos;
+    }
+
+    Scalar read_string()
+    {
+        const auto start = ++m_pos;
+        Scalar scalar{{}, ValueEncoding::Plain, true};
+        while (true)
+        {
+            if (m_pos >= m_json.size())
+            {
+                throw std::runtime_error("Malformed JSON event, unterminated string");
+            }
+
+            const char c = m_json[m_pos];
+            if (c == '"')
+            {
+                break;
+            }
+
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                throw std::runtime_error("Malformed JSON event, control character in a string");
+            }
+
+            if (c == '\\')
+            {
+                scalar.encoding = ValueEncoding::Json;
+                const char escaped = m_pos + 1 < m_json.size() ? m_json[m_pos + 1] : '\0';
+                if (escaped == 'u')
+                {
+                    if (!parse_hex4(m_json.substr(m_pos + 2, 4)))
+                    {
+                        throw std::runtime_error("Malformed JSON event, invalid unicode escape");
+                    }
+
+                    m_pos += 6;
+                    continue;
+                }
+
+                if (escaped == '\0' || std::string_view("\"\\/bfnrt").find(escaped) == std::string_view::npos)
+                {
+                    throw std::runtime_error("Malformed JSON event, invalid escape");
+                }
+
+                m_pos += 2;
+                continue;
+            }
+
+            ++m_pos;
+        }
+
+        scalar.value = m_json.substr(start, m_pos - start);
+        ++m_pos;
+
+        return scalar;
+    }
+
+    // Skip the digits at the current position, returning how many there were
+    std::size_t skip_digits()
+    {
+        const auto start = m_pos;
+        while (m_pos < m_json.size() && m_json[m_pos] >= '0' && m_json[m_pos] <= '9')
+        {
+            ++m_pos;
+        }
+
+        return m_pos - start;
+    }
+
+    std::string_view read_number()
+    {
+        const auto start = m_pos;
+        if (m_json[m_pos] == '-')
+        {
+            ++m_pos;
+        }
+
+        const auto integer_start  = m_pos;
+        const auto integer_digits = skip_digits();
+        bool valid                = integer_digits > 0 && (integer_digits == 1 || m_json[integer_start] != '0');
+
+        if (valid && m_pos < m_json.size() && m_json[m_pos] == '.')
+        {
+            ++m_pos;
+            valid = skip_digits() > 0;
+        }
+
+        if (valid && m_pos < m_json.size() && (m_json[m_pos] == 'e' || m_json[m_pos] == 'E'))
+        {
+            ++m_pos;
+            if (m_pos < m_json.size() && (m_json[m_pos] == '+' || m_json[m_pos] == '-'))
+            {
+                ++m_pos;
+            }
+
+            valid = skip_digits() > 0;
+        }
+
+        if (!valid)
+        {
+            throw std::runtime_error("Malformed JSON event, invalid number");
+        }
+
+        return m_json.substr(start, m_pos - start);
+    }
+
+    Scalar read_value(std::size_t depth)
+    {
+        skip_space();
+        if (m_pos >= m_json.size())
+        {
+            throw std::runtime_error("Malformed JSON event, unexpected end of the event");
+        }
+
+        if (depth > MaxJsonDepth)
+        {
+            throw std::runtime_error("Malformed JSON event, nested too deeply");
+        }
+
+        const char c = m_json[m_pos];
+        if (c == '{')
+        {
+            read_object(depth);
+            return {};
+        }
+
+        if (c == '[')
+        {
+            ++m_pos;
+            skip_space();
+            if (m_pos < m_json.size() && m_json[m_pos] == ']')
+            {
+                ++m_pos;
+                return {};
+            }
+
+            // The elements of an array share the path of the array
+            while (true)
+            {
+                read_value(depth + 1);
+                skip_space();
+                if (m_pos < m_json.size() && m_json[m_pos] == ',')
+                {
+                    ++m_pos;
+                    continue;
+                }
+
+                expect(']');
+                return {};
+            }
+        }
+
+        Scalar scalar;
+        if (c == '"')
+        {
+            scalar = read_string();
+        }
+        else if (m_json.substr(m_pos).starts_with("null"))
+        {
+            m_pos += 4;
+            return {};
+        }
+        else
+        {
+            for (std::string_view literal : {"true", "false"})
+            {
+                if (m_json.substr(m_pos).starts_with(literal))
+                {
+                    scalar = {m_json.substr(m_pos, literal.size()), ValueEncoding::Plain, true};
+                    m_pos += literal.size();
+                    break;
+                }
+            }
+
+            if (!scalar.present)
+            {
+                scalar = {read_number(), ValueEncoding::Plain, true};
+            }
+        }
+
+        emit_path(scalar);
+        return scalar;
+    }
+
+    void read_object(std::size_t depth)
+    {
+        ++m_pos;
+        skip_space();
+        if (m_pos < m_json.size() && m_json[m_pos] == '}')
+        {
+            ++m_pos;
+            return;
+        }
+
+        // Members of objects produced from `Data` elements, such as `{"@Name": "LogonType", "#text": "2"}`
+        Scalar data_name;
+        Scalar data_value;
+        while (true)
+        {
+            skip_space();
+            if (m_pos >= m_json.size() || m_json[m_pos] != '"')
+            {
+                throw std::runtime_error("Malformed JSON event, expected a member name");
+            }
+
+            auto name = read_string().value;
+            expect(':');
+
+            // Attribute names and text produced by XML converters
+            if (name.starts_with('@'))
+            {
+                name.remove_prefix(1);
+            }
+
+            const bool is_text = name == "#text";
+            if (!is_text)
+            {
+                m_scratch.path.push_back(name);
+            }
+
+            auto value = read_value(depth + 1);
+            if (!is_text)
+            {
+                m_scratch.path.pop_back();
+            }
+
+            if (name == "Name")
+            {
+                data_name = value;
+            }
+            else if (is_text || name == "Value")
+            {
+                data_value = value;
+            }
+
+            skip_space();
+            if (m_pos < m_json.size() && m_json[m_pos] == ',')
+            {
+                ++m_pos;
+                continue;
+            }
+
+            expect('}');
+            break;
+        }
+
+        if (data_name.present && data_value.present)
+        {
+            auto& key = m_scratch.key;
+            key.clear();
+            if (data_name.encoding == ValueEncoding::Json)
+            {
+                decode_json(data_name.value, key);
+            }
+            else
+            {
+                key.append(data_name.value);
+            }
+
+            m_emit(key, data_value.value, data_value.encoding);
+        }
+    }
+
+    // Emit a scalar for the path of its member and for each suffix of the path
+    void emit_path(const Scalar& scalar)
+    {
+        auto& key     = m_scratch.key;
+        auto& offsets = m_scratch.path_offsets;
+        key.clear();
+        offsets.clear();
+        for (const auto& name : m_scratch.path)
+        {
+            if (!key.empty())
+            {
+                key.push_back('.');
+            }
+
+            offsets.push_back(key.size());
+            key.append(name);
+        }
+
+        for (auto offset : offsets)
+        {
+            m_emit(std::string_view(key).substr(offset), scalar.value, scalar.encoding);
+        }
+    }
+
+    std::string_view m_json;
+    std::size_t m_pos{0};
+    Scratch& m_scratch;
+    EmitT& m_emit;
+};
+}  // namespace
+
+// Component public implementations
+// ************ WindowsEventParser ************************* //
+WindowsEventParser::WindowsEventParser(std::vector<WindowsEventField> fields, std::string event_id_key) :
+  m_event_id_key(std::move(event_id_key))
+{
+    if (m_event_id_key.empty())
+    {
+        throw std::invalid_argument("The Windows event ID key can't be empty");
+    }
+
+    m_keys[m_event_id_key];
+
+    for (auto& field : fields)
+    {
+        if (field.key.empty())
+        {
+            throw std::invalid_argument("Windows event keys can't be empty");
+        }
+
+        if (field.name.empty())
+        {
+            field.name = field.key;
+        }
+
+        if (field.type != cudf::type_id::STRING && field.type != cudf::type_id::INT64 &&
+            field.type != cudf::type_id::FLOAT64 && field.type != cudf::type_id::BOOL8 &&
+            field.type != cudf::type_id::TIMESTAMP_NANOSECONDS)
+        {
+            throw std::invalid_argument(
+                MORPHEUS_CONCAT_STR("Unsupported type of the Windows event key '" << field.key << "'"));
+        }
+
+        auto found = std::find_if(m_columns.begin(), m_columns.end(), [&field](const auto& column) {
+            return column.name == field.name;
+        });
+
+        if (found == m_columns.end())
+        {
+            m_columns.push_back({field.name, field.type});
+            found = m_columns.end() - 1;
+        }
+        else if (found->type != field.type)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("The Windows event column '"
+                                                            << field.name << "' is declared with different types"));
+        }
+
+        m_keys[field.key].push_back(
+            {static_cast<std::size_t>(found - m_columns.begin()), field.type, std::move(field.event_ids)});
+    }
+}
+
+const std::vector<DecodedColumnSpec>& WindowsEventParser::columns() const
+{
+    return m_columns;
+}
+
+void WindowsEventParser::parse(std::string_view event,
+                               DecodedTable& table,
+                               const std::vector<std::size_t>& column_indices) const
+{
+    // A value of a configured key, either a view of the event or a range of the decoded values
+    struct Hit
+    {
+        const std::vector<Target>* targets;
+        bool decoded;
+        std::size_t offset;
+        std::size_t length;
+    };
+
+    thread_local Scratch scratch;
+    thread_local std::vector<Hit> hits;
+    thread_local std::vector<bool> written;
+
+    scratch.decoded.clear();
+    hits.clear();
+
+    // Values are only decoded for the configured keys
+    auto emit = [&](std::string_view key, std::string_view value, ValueEncoding encoding) {
+        auto found = m_keys.find(key);
+        if (found == m_keys.end())
+        {
+            return;
+        }
+
+        if (encoding == ValueEncoding::Plain)
+        {
+            const auto offset = static_cast<std::size_t>(value.data() - event.data());
+            hits.push_back({&found->second, false, offset, value.size()});
+            return;
+        }
+
+        const auto start = scratch.decoded.size();
+        if (encoding == ValueEncoding::Xml || encoding == ValueEncoding::XmlAttribute)
+        {
+            decode_xml(value, encoding == ValueEncoding::XmlAttribute, scratch.decoded);
+        }
+        else
+        {
+            decode_json(value, scratch.decoded);
+        }
+
+        hits.push_back({&found->second, true, start, scratch.decoded.size() - start});
+    };
+
+    // A byte order mark and line breaks of events read from files
+    if (event.starts_with("\xEF\xBB\xBF"))
+    {
+        event.remove_prefix(3);
+    }
+
+    event = trim(event);
+    if (event.starts_with('<'))
+    {
+        read_xml(event, scratch, emit);
+    }
+    else if (event.starts_with('{'))
+    {
+        JsonReader<decltype(emit)>(event, scratch, emit).read();
+    }
+    else
+    {
+        throw std::runtime_error("Unrecognized Windows event, expected XML or JSON");
+    }
+
+    auto value_of = [&](const Hit& hit) {
+        return hit.decoded ? std::string_view(scratch.decoded).substr(hit.offset, hit.length)
+                           : event.substr(hit.offset, hit.length);
+    };
+
+    const auto* event_id_targets = &m_keys.find(m_event_id_key)->second;
+
+    std::optional<std::int64_t> event_id;
+    for (const auto& hit : hits)
+    {
+        if (hit.targets == event_id_targets)
+        {
+            const auto value = trim(value_of(hit));
+
+            std::int64_t id{};
+            auto [last, error] = std::from_chars(value.data(), value.data() + value.size(), id);
+            if (!value.empty() && error == std::errc{} && last == value.data() + value.size())
+            {
+                event_id = id;
+            }
+
+            break;
+        }
+    }
+
+    written.assign(m_columns.size(), false);
+    for (const auto& hit : hits)
+    {
+        for (const auto& target : *hit.targets)
+        {
+            if (written[target.column])
+            {
+                continue;
+            }
+
+            if (!target.event_ids.empty() &&
+                (!event_id.has_value() ||
+                 std::find(target.event_ids.begin(), target.event_ids.end(), *event_id) == target.event_ids.end()))
+            {
+                continue;
+            }
+
+            set_log_value(table, column_indices[target.column], target.type, value_of(hit), 0);
+            written[target.column] = true;
+        }
+    }
+}
+
+}  // namespace morpheus
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/deduplicate.hpp"
+
+#include "morpheus/messages/meta.hpp"          // for MessageMeta
+#include "morpheus/objects/dtype.hpp"          // for DType
+#include "morpheus/objects/table_info.hpp"     // for TableInfo
+#include "morpheus/objects/tensor.hpp"         // for Tensor
+#include "morpheus/objects/tensor_object.hpp"  // for TensorObject
+#include "morpheus/types.hpp"                  // for TensorIndex
+#include "morpheus/utilities/dedup_util.hpp"   // for DedupUtil, DedupIndex
+
+#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_per_thread
+#include <rmm/device_buffer.hpp>     // for device_buffer
+
+#include <algorithm>  // for copy_if
+#include <cstdint>    // for uint64_t
+#include <iterator>   // for back_inserter
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace {
+template <typename T>
+TensorObject host_to_column_tensor(const std::vector<T>& values)
+{
+    auto buffer =
+        std::make_shared<rmm::device_buffer>(values.data(), values.size() * sizeof(T), rmm::cuda_stream_per_thread);
+
+    return Tensor::create(std::move(buffer), DType::create<T>(), {static_cast<TensorIndex>(values.size()), 1}, {1, 1});
+}
+}  // namespace
+
+// Component public implementations
+// ************ DeduplicateStage **************************** //
+DeduplicateStage::DeduplicateStage(std::vector<std::string> columns) :
+  base_t(rxcpp::operators::map([this](sink_type_t x) {
+      return this->on_data(std::move(x));
+  })),
+  m_columns(std::move(columns))
+{}
+
+DeduplicateStage::source_type_t DeduplicateStage::on_data(sink_type_t x)
+{
+    auto payload = x->payload();
+
+    auto columns = m_columns;
+    if (columns.empty())
+    {
+        // Hash every column except for the ones we are about to write
+        auto all_columns = payload->get_column_names();
+        std::copy_if(all_columns.begin(), all_columns.end(), std::back_inserter(columns), [](const std::string& name) {
+            return name != DedupUtil::HashColumn && name != DedupUtil::IndexColumn;
+        });
+    }
+
+    DedupIndex index;
+    {
+        auto info = payload->get_info(columns);
+
+        // Rows are matched by their hash, the contents of the matched rows are compared to rule out collisions
+        index = DedupUtil::build_index(DedupUtil::hash_rows(info.get_view()));
+        DedupUtil::verify_index(info.get_view(), index);
+    }
+
+    payload->set_data({DedupUtil::HashColumn, DedupUtil::IndexColumn},
+                      {host_to_column_tensor(index.hashes), host_to_column_tensor(index.representative)});
+
+    return x;
+}
+
+// ************ DeduplicateStageInterfaceProxy ************* //
+std::shared_ptr<mrc::segment::Object<DeduplicateStage>> DeduplicateStageInterfaceProxy::init(
+    mrc::segment::Builder& builder, const std::string& name, std::vector<std::string> columns)
+{
+    return builder.construct_object<DeduplicateStage>(name, std::move(columns));
+}
+
+}  // namespace morpheus
@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/document_extractor.hpp"
+
+#include "morpheus/messages/meta.hpp"          // for MessageMeta
+#include "morpheus/objects/table_info.hpp"     // for TableInfo
+#include "morpheus/utilities/column_util.hpp"  // for ColumnUtil, HostStringsColumn
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <cudf/column/column.hpp>  // for column
+#include <cudf/io/types.hpp>       // for table_with_metadata, table_metadata
+#include <cudf/table/table.hpp>    // for table
+#include <cudf/types.hpp>          // for size_type, type_id
+
+#include <algorithm>  // for find
+#include <iterator>   // for distance
+#include <stdexcept>  // for invalid_argument
+#include <utility>    // for move
+
+namespace morpheus {
+
+// Component public implementations
+// ************ DocumentExtractorStage ********************** //
+DocumentExtractorStage::DocumentExtractorStage(std::shared_ptr<DocumentExtractor> extractor, std::string path_column) :
+  base_t(rxcpp::operators::map([this](sink_type_t x) {
+      return this->on_data(std::move(x));
+  })),
+  m_extractor(std::move(extractor)),
+  m_path_column(std::move(path_column))
+{}
+
+std::vector<std::string> DocumentExtractorStage::get_paths(const std::shared_ptr<MessageMeta>& payload) const
+{
+    auto info         = payload->get_info();
+    auto column_names = info.get_column_names();
+
+    auto found = std::find(column_names.begin(), column_names.end(), m_path_column);
+    if (found == column_names.end())
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Column '" << m_path_column << "' not found"));
+    }
+
+    const auto& column = info.get_column(static_cast<cudf::size_type>(std::distance(column_names.begin(), found)));
+    if (column.type().id() != cudf::type_id::STRING)
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Document extraction requires a string column, column '"
+                                                        << m_path_column << "' is not"));
+    }
+
+    const HostStringsColumn strings{column};
+
+    std::vector<std::string> paths;
+    paths.reserve(strings.size());
+    for (std::size_t row = 0; row < strings.size(); ++row)
+    {
+        // Null rows don't hold a path
+        if (strings.is_valid(row))
+        {
+            paths.emplace_back(strings.get(row));
+        }
+    }
+
+    return paths;
+}
+
+DocumentExtractorStage::source_type_t DocumentExtractorStage::on_data(sink_type_t x)
+{
+    auto documents = m_extractor->extract(get_paths(x->payload()));
+
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    cudf::io::table_metadata metadata;
+    for (const auto& [name, values] : {std::pair{"file_path", &documents.file_path},
+                                       std::pair{"file_name", &documents.file_name},
+                                       std::pair{"file_type", &documents.file_type},
+                                       std::pair{"content", &documents.content}})
+    {
+        columns.push_back(ColumnUtil::make_strings_column(*values));
+        metadata.schema_info.emplace_back(name);
+    }
+
+    columns.push_back(ColumnUtil::make_strings_column(documents.error));
+    metadata.schema_info.emplace_back("error");
+
+    x->payload(MessageMeta::create_from_cpp(
+        cudf::io::table_with_metadata{std::make_unique<cudf::table>(std::move(columns)), std::move(metadata)}, 0));
+
+    return x;
+}
+
+// ************ DocumentExtractorStageInterfaceProxy ******** //
+std::shared_ptr<mrc::segment::Object<DocumentExtractorStage>> DocumentExtractorStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::string path_column,
+    pybind11::dict converters,
+    std::vector<std::string> csv_text_columns,
+    char csv_delimiter,
+    std::size_t num_threads)
+{
+    auto extractor = DocumentExtractorInterfaceProxy::init(
+        std::move(converters), std::move(csv_text_columns), csv_delimiter, num_threads);
+
+    return builder.construct_object<DocumentExtractorStage>(name, std::move(extractor), std::move(path_column));
+}
+
+}  // namespace morpheus
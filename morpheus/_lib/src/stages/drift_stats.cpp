@@ -0,0 +1,424 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/drift_stats.hpp"
+
+#include "morpheus/messages/memory/tensor_memory.hpp"  // for TensorMemory
+#include "morpheus/objects/dtype.hpp"                  // for DType
+#include "morpheus/objects/table_info.hpp"             // for TableInfo
+#include "morpheus/objects/tensor_object.hpp"          // for TensorObject
+#include "morpheus/utilities/column_util.hpp"          // for ColumnUtil
+#include "morpheus/utilities/string_util.hpp"          // for MORPHEUS_CONCAT_STR
+#include "morpheus/utilities/tensor_util.hpp"          // for TensorUtils
+
+#include <cuda_runtime.h>               // for cudaMemcpy, cudaMemcpyDeviceToHost
+#include <cudf/column/column_view.hpp>  // for column_view
+#include <cudf/io/types.hpp>            // for table_with_metadata, table_metadata
+#include <cudf/replace.hpp>             // for replace_nulls
+#include <cudf/scalar/scalar.hpp>       // for numeric_scalar
+#include <cudf/table/table.hpp>         // for table
+#include <cudf/unary.hpp>               // for cast
+#include <glog/logging.h>               // for CHECK
+#include <mrc/cuda/common.hpp>          // for MRC_CHECK_CUDA
+#include <rxcpp/rx.hpp>                 // for make_observer
+
+#include <algorithm>    // for max, min
+#include <cmath>        // for isfinite
+#include <cstdint>      // for int64_t
+#include <exception>    // for exception_ptr
+#include <limits>       // for numeric_limits
+#include <stdexcept>    // for invalid_argument
+#include <string>       // for to_string
+#include <type_traits>  // for is_same_v
+
+namespace {
+using namespace morpheus;
+
+std::vector<double> column_to_host(const cudf::column_view& column)
+{
+    std::unique_ptr<cudf::column> converted;
+    cudf::column_view view = column;
+
+    if (view.type().id() != cudf::type_id::FLOAT64)
+    {
+        converted = cudf::cast(view, cudf::data_type(cudf::type_id::FLOAT64));
+        view      = converted->view();
+    }
+
+    // Null rows are replaced with NaN which are skipped by the histograms
+    if (view.has_nulls())
+    {
+        converted = cudf::replace_nulls(view, cudf::numeric_scalar<double>(std::numeric_limits<double>::quiet_NaN()));
+        view      = converted->view();
+    }
+
+    std::vector<double> host_values(view.size());
+    MRC_CHECK_CUDA(cudaMemcpy(
+        host_values.data(), view.data<double>(), host_values.size() * sizeof(double), cudaMemcpyDeviceToHost));
+
+    return host_values;
+}
+
+// Column of the values of a drift metric, values which aren't finite are null
+std::unique_ptr<cudf::column> metric_column(const std::vector<double>& values)
+{
+    std::vector<bool> valid(values.size());
+    for (std::size_t row = 0; row < values.size(); ++row)
+    {
+        valid[row] = std::isfinite(values[row]);
+    }
+
+    return ColumnUtil::make_numeric_column(values, cudf::type_id::FLOAT64, valid);
+}
+
+}  // namespace
+
+namespace morpheus {
+
+// Component public implementations
+// ************ DriftStatsStage **************************** //
+template <typename InputT>
+DriftStatsStage<InputT>::DriftStatsStage(std::string tensor_name,
+                                         std::vector<std::string> labels,
+                                         std::map<std::string, std::pair<double, double>> feature_ranges,
+                                         TensorIndex window_size,
+                                         std::size_t num_buckets,
+                                         std::size_t reference_windows,
+                                         std::map<std::string, std::vector<double>> reference) :
+  base_t(base_t::op_factory_from_sub_fn(build_operator())),
+  m_tensor_name(std::move(tensor_name)),
+  m_labels(std::move(labels)),
+  m_feature_ranges(std::move(feature_ranges)),
+  m_window_size(window_size),
+  m_num_buckets(num_buckets),
+  m_reference_windows(reference_windows),
+  m_reference(std::move(reference))
+{
+    CHECK(m_window_size > 0) << "window_size must be greater than zero";
+    CHECK(m_num_buckets > 0) << "num_buckets must be greater than zero";
+    CHECK(!m_reference.empty() || m_reference_windows > 0)
+        << "Either a reference distribution or a number of reference windows must be provided";
+
+    for (const auto& [name, range] : m_feature_ranges)
+    {
+        m_feature_columns.emplace_back(this->make_tracked_column(name, range.first, range.second));
+    }
+}
+
+template <typename InputT>
+typename DriftStatsStage<InputT>::TrackedColumn DriftStatsStage<InputT>::make_tracked_column(const std::string& name,
+                                                                                             double lower,
+                                                                                             double upper) const
+{
+    TrackedColumn column{name,
+                         FixedWidthHistogram(m_num_buckets, lower, upper),
+                         FixedWidthHistogram(m_num_buckets, lower, upper),
+                         {}};
+
+    auto reference = m_reference.find(name);
+    if (reference != m_reference.end())
+    {
+        if (reference->second.size() != m_num_buckets)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Reference distribution for '"
+                                                            << name << "' has " << reference->second.size()
+                                                            << " buckets, expected " << m_num_buckets));
+        }
+
+        // Apply the same floor used for the window proportions so empty reference buckets remain finite
+        column.reference_proportions.reserve(m_num_buckets);
+        for (auto proportion : reference->second)
+        {
+            column.reference_proportions.push_back(std::max(proportion, 1e-6));
+        }
+    }
+
+    return column;
+}
+
+template <typename InputT>
+void DriftStatsStage<InputT>::ensure_tensor_columns(std::size_t num_columns)
+{
+    // Model outputs are probabilities, so the buckets always cover [0, 1]
+    for (std::size_t i = m_tensor_columns.size(); i < num_columns; ++i)
+    {
+        auto name = i < m_labels.size() ? m_labels[i] : std::to_string(i);
+        m_tensor_columns.emplace_back(this->make_tracked_column(name, 0.0, 1.0));
+    }
+}
+
+template <typename InputT>
+typename DriftStatsStage<InputT>::subscribe_fn_t DriftStatsStage<InputT>::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t x) {
+                this->on_data(std::move(x), output);
+            },
+            [&](std::exception_ptr error_ptr) {
+                output.on_error(error_ptr);
+            },
+            [&]() {
+                // Emit the final, partial, window
+                if (m_window_rows > 0)
+                {
+                    auto metrics = this->close_window();
+                    if (metrics)
+                    {
+                        output.on_next(std::move(metrics));
+                    }
+                }
+
+                output.on_completed();
+            }));
+    };
+}
+
+template <typename InputT>
+void DriftStatsStage<InputT>::on_data(sink_type_t x, rxcpp::subscriber<source_type_t>& output)
+{
+    TensorObject tensor;
+    TableInfo features;
+
+    std::vector<std::string> feature_names;
+    for (const auto& column : m_feature_columns)
+    {
+        feature_names.push_back(column.name);
+    }
+
+    if constexpr (std::is_same_v<InputT, MultiResponseMessage>)
+    {
+        tensor = x->get_output(m_tensor_name);
+
+        if (!feature_names.empty())
+        {
+            features = x->get_meta(feature_names);
+        }
+    }
+    else if constexpr (std::is_same_v<InputT, ControlMessage>)
+    {
+        tensor = x->tensors()->get_tensor(m_tensor_name);
+
+        if (!feature_names.empty())
+        {
+            features = x->payload()->get_info(feature_names);
+        }
+    }
+    else
+    {
+        // sink_type_t not supported
+        static_assert(!sizeof(sink_type_t), "DriftStatsStage receives unsupported input type");
+    }
+
+    // Copy everything to the host once per message, the histograms are then filled with a single pass over the rows
+    if (tensor.rank() == 1)
+    {
+        tensor.swap(tensor.reshape({tensor.shape(0), 1}));
+    }
+
+    CHECK(tensor.rank() == 2) << "DriftStatsStage expects the '" << m_tensor_name << "' tensor to be two dimensional";
+
+    auto host_tensor = tensor.as_type(DType::create<double>());
+    if (!host_tensor.is_compact())
+    {
+        host_tensor.swap(host_tensor.deep_copy());
+    }
+
+    const auto num_rows    = static_cast<std::size_t>(host_tensor.shape(0));
+    const auto num_columns = static_cast<std::size_t>(host_tensor.shape(1));
+    const auto stride      = TensorUtils::get_element_stride(host_tensor.get_stride());
+    const auto tensor_data = host_tensor.get_host_data<double>();
+
+    this->ensure_tensor_columns(num_columns);
+
+    std::vector<std::vector<double>> feature_data;
+    for (std::size_t i = 0; i < m_feature_columns.size(); ++i)
+    {
+        feature_data.emplace_back(column_to_host(features.get_column(i)));
+
+        CHECK(feature_data.back().size() == num_rows)
+            << "Feature column '" << m_feature_columns[i].name << "' has " << feature_data.back().size()
+            << " rows, expected " << num_rows;
+    }
+
+    std::size_t row = 0;
+    while (row < num_rows)
+    {
+        const auto window_remaining = static_cast<std::size_t>(m_window_size - m_window_rows);
+        const auto chunk_rows       = std::min(window_remaining, num_rows - row);
+
+        for (std::size_t col = 0; col < num_columns; ++col)
+        {
+            m_tensor_columns[col].current.add(
+                tensor_data.data() + row * stride[0] + col * stride[1], chunk_rows, stride[0]);
+        }
+
+        for (std::size_t i = 0; i < m_feature_columns.size(); ++i)
+        {
+            m_feature_columns[i].current.add(feature_data[i].data() + row, chunk_rows);
+        }
+
+        row += chunk_rows;
+        m_window_rows += static_cast<TensorIndex>(chunk_rows);
+
+        if (m_window_rows == m_window_size)
+        {
+            auto metrics = this->close_window();
+            if (metrics)
+            {
+                output.on_next(std::move(metrics));
+            }
+        }
+    }
+}
+
+template <typename InputT>
+std::shared_ptr<MessageMeta> DriftStatsStage<InputT>::close_window()
+{
+    const auto window_id   = m_window_id++;
+    const auto window_rows = m_window_rows;
+    m_window_rows          = 0;
+
+    // Without an explicit reference the first windows are merged into the reference
+    if (m_reference.empty() && m_windows_closed < m_reference_windows)
+    {
+        ++m_windows_closed;
+
+        for (auto* columns : {&m_tensor_columns, &m_feature_columns})
+        {
+            for (auto& column : *columns)
+            {
+                column.reference.merge(column.current);
+                column.current.clear();
+
+                if (m_windows_closed == m_reference_windows)
+                {
+                    column.reference_proportions = column.reference.proportions();
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    ++m_windows_closed;
+
+    std::vector<std::string> names;
+    std::vector<double> psi;
+    std::vector<double> kl;
+    std::vector<double> ks;
+
+    for (auto* columns : {&m_tensor_columns, &m_feature_columns})
+    {
+        for (auto& column : *columns)
+        {
+            // Columns which appeared after the reference was built, or without an explicit reference, are skipped
+            if (!column.reference_proportions.empty())
+            {
+                auto drift = FixedWidthHistogram::compare(column.reference_proportions, column.current.proportions());
+
+                names.push_back(column.name);
+                psi.push_back(drift.psi);
+                kl.push_back(drift.kl);
+                ks.push_back(drift.ks);
+            }
+
+            column.current.clear();
+        }
+    }
+
+    if (names.empty())
+    {
+        return nullptr;
+    }
+
+    const auto num_rows = names.size();
+
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    cudf::io::table_metadata metadata;
+
+    columns.push_back(
+        ColumnUtil::make_numeric_column(std::vector<std::int64_t>(num_rows, window_id), cudf::type_id::INT64));
+    metadata.schema_info.emplace_back("window");
+
+    columns.push_back(ColumnUtil::make_strings_column(names));
+    metadata.schema_info.emplace_back("name");
+
+    columns.push_back(
+        ColumnUtil::make_numeric_column(std::vector<std::int64_t>(num_rows, window_rows), cudf::type_id::INT64));
+    metadata.schema_info.emplace_back("count");
+
+    columns.push_back(metric_column(psi));
+    metadata.schema_info.emplace_back("psi");
+
+    columns.push_back(metric_column(kl));
+    metadata.schema_info.emplace_back("kl");
+
+    columns.push_back(metric_column(ks));
+    metadata.schema_info.emplace_back("ks");
+
+    return MessageMeta::create_from_cpp(
+        cudf::io::table_with_metadata{std::make_unique<cudf::table>(std::move(columns)), std::move(metadata)}, 0);
+}
+
+template class DriftStatsStage<MultiResponseMessage>;
+template class DriftStatsStage<ControlMessage>;
+
+// ************ DriftStatsStageInterfaceProxy ************* //
+std::shared_ptr<mrc::segment::Object<DriftStatsStageMM>> DriftStatsStageInterfaceProxy::init_multi(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::string tensor_name,
+    std::vector<std::string> labels,
+    std::map<std::string, std::pair<double, double>> feature_ranges,
+    TensorIndex window_size,
+    std::size_t num_buckets,
+    std::size_t reference_windows,
+    std::map<std::string, std::vector<double>> reference)
+{
+    return builder.construct_object<DriftStatsStageMM>(name,
+                                                       std::move(tensor_name),
+                                                       std::move(labels),
+                                                       std::move(feature_ranges),
+                                                       window_size,
+                                                       num_buckets,
+                                                       reference_windows,
+                                                       std::move(reference));
+}
+
+std::shared_ptr<mrc::segment::Object<DriftStatsStageCM>> DriftStatsStageInterfaceProxy::init_cm(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::string tensor_name,
+    std::vector<std::string> labels,
+    std::map<std::string, std::pair<double, double>> feature_ranges,
+    TensorIndex window_size,
+    std::size_t num_buckets,
+    std::size_t reference_windows,
+    std::map<std::string, std::vector<double>> reference)
+{
+    return builder.construct_object<DriftStatsStageCM>(name,
+                                                       std::move(tensor_name),
+                                                       std::move(labels),
+                                                       std::move(feature_ranges),
+                                                       window_size,
+                                                       num_buckets,
+                                                       reference_windows,
+                                                       std::move(reference));
+}
+
+}  // namespace morpheus
@@ -0,0 +1,219 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/enrich.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <glog/logging.h>       // for LOG
+#include <pybind11/pybind11.h>  // for cast
+#include <pybind11/stl.h>       // IWYU pragma: keep
+
+#include <exception>  // for exception
+#include <filesystem>
+#include <stdexcept>  // for invalid_argument
+#include <system_error>
+#include <utility>  // for move
+
+namespace morpheus {
+
+namespace py = pybind11;
+
+// Component public implementations
+// ************ EnrichStage ********************************* //
+EnrichStage::EnrichStage(std::vector<ReferenceTableConfig> references, std::chrono::milliseconds refresh_interval) :
+  PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
+  m_refresh_interval(refresh_interval)
+{
+    for (auto& config : references)
+    {
+        m_tables.push_back(ReferenceTable::load(config));
+    }
+
+    if (m_refresh_interval.count() > 0)
+    {
+        m_watcher = std::thread(&EnrichStage::watch, this);
+    }
+}
+
+EnrichStage::~EnrichStage()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+
+    m_stop_cv.notify_all();
+
+    if (m_watcher.joinable())
+    {
+        m_watcher.join();
+    }
+}
+
+std::vector<std::shared_ptr<const ReferenceTable>> EnrichStage::tables() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_tables;
+}
+
+std::size_t EnrichStage::refresh()
+{
+    std::size_t num_reloaded = 0;
+
+    for (const auto& table : tables())
+    {
+        const auto& config = table->config();
+
+        std::error_code ec;
+        const auto modified = std::filesystem::last_write_time(config.path, ec);
+        if (ec || modified == table->modified())
+        {
+            // A missing file is usually being replaced, keep the current table until it reappears
+            continue;
+        }
+
+        std::shared_ptr<const ReferenceTable> reloaded;
+        try
+        {
+            reloaded = ReferenceTable::load(config);
+        } catch (const std::exception& e)
+        {
+            LOG(ERROR) << "Failed to reload reference table " << config.path << ", keeping the previous table: "
+                       << e.what();
+            continue;
+        }
+
+        // The index is built before the lock is taken, swapping the table is all that happens while holding it
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& current : m_tables)
+        {
+            if (current == table)
+            {
+                current = std::move(reloaded);
+                ++num_reloaded;
+                break;
+            }
+        }
+    }
+
+    return num_reloaded;
+}
+
+void EnrichStage::watch()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop_cv.wait_for(lock, m_refresh_interval, [this]() {
+        return m_stopping;
+    }))
+    {
+        lock.unlock();
+        auto num_reloaded = refresh();
+        lock.lock();
+
+        if (num_reloaded > 0)
+        {
+            LOG(INFO) << "Reloaded " << num_reloaded << " reference table(s)";
+        }
+    }
+}
+
+EnrichStage::subscribe_fn_t EnrichStage::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t msg) {
+                // Snapshot the tables so a concurrent refresh doesn't affect this batch
+                auto enriched = enrich_message_meta(*msg, this->tables());
+
+                // An inner join may leave no rows
+                if (enriched != nullptr)
+                {
+                    output.on_next(std::move(enriched));
+                }
+            },
+            [&](std::exception_ptr error_ptr) {
+                output.on_error(error_ptr);
+            },
+            [&]() {
+                output.on_completed();
+            }));
+    };
+}
+
+// ************ EnrichStageInterfaceProxy ****************** //
+std::shared_ptr<mrc::segment::Object<EnrichStage>> EnrichStageInterfaceProxy::init(mrc::segment::Builder& builder,
+                                                                                    const std::string& name,
+                                                                                    const py::list& references,
+                                                                                    double refresh_interval)
+{
+    std::vector<ReferenceTableConfig> configs;
+    for (const auto& item : references)
+    {
+        auto reference = item.cast<py::dict>();
+
+        ReferenceTableConfig config;
+        config.path        = reference["path"].cast<std::string>();
+        config.key_columns = reference["on"].cast<std::vector<std::string>>();
+
+        if (reference.contains("reference_on") && !reference["reference_on"].is_none())
+        {
+            config.reference_key_columns = reference["reference_on"].cast<std::vector<std::string>>();
+        }
+
+        if (reference.contains("columns") && !reference["columns"].is_none())
+        {
+            config.columns = reference["columns"].cast<std::vector<std::string>>();
+        }
+
+        if (reference.contains("prefix") && !reference["prefix"].is_none())
+        {
+            config.prefix = reference["prefix"].cast<std::string>();
+        }
+
+        if (reference.contains("file_type") && !reference["file_type"].is_none())
+        {
+            config.file_type = reference["file_type"].cast<FileTypes>();
+        }
+
+        if (reference.contains("how") && !reference["how"].is_none())
+        {
+            const auto how = reference["how"].cast<std::string>();
+            if (how == "left")
+            {
+                config.how = JoinType::Left;
+            }
+            else if (how == "inner")
+            {
+                config.how = JoinType::Inner;
+            }
+            else
+            {
+                throw std::invalid_argument(
+                    MORPHEUS_CONCAT_STR("Unsupported join type '" << how << "', must be either 'left' or 'inner'"));
+            }
+        }
+
+        configs.push_back(std::move(config));
+    }
+
+    const auto interval = std::chrono::milliseconds(static_cast<std::int64_t>(refresh_interval * 1000));
+
+    return builder.construct_object<EnrichStage>(name, std::move(configs), interval);
+}
+
+}  // namespace morpheus
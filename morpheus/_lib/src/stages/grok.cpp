@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/grok.hpp"
+
+#include "morpheus/objects/decoded_table.hpp"      // for DecodedTable
+#include "morpheus/objects/table_info.hpp"         // for TableInfo, MutableTableInfo
+#include "morpheus/objects/table_transaction.hpp"  // for TableTransaction
+#include "morpheus/utilities/column_util.hpp"      // for ColumnUtil, HostStringsColumn
+#include "morpheus/utilities/string_util.hpp"      // for MORPHEUS_CONCAT_STR
+
+#include <cudf/column/column.hpp>  // for column
+#include <cudf/table/table.hpp>    // for table
+#include <cudf/types.hpp>          // for size_type, type_id
+
+#include <algorithm>  // for find, max
+#include <cstdint>    // for int64_t
+#include <stdexcept>  // for invalid_argument
+#include <thread>     // for hardware_concurrency
+#include <utility>    // for move
+
+namespace morpheus {
+
+// Component public implementations
+// ************ GrokStage ************************* //
+GrokStage::GrokStage(GrokMatcher matcher, std::string column, std::string pattern_column, std::size_t num_threads) :
+  base_t(rxcpp::operators::map([this](sink_type_t x) {
+      return this->on_data(std::move(x));
+  })),
+  m_matcher(std::move(matcher)),
+  m_column(std::move(column)),
+  m_pattern_column(std::move(pattern_column)),
+  m_num_threads(num_threads == 0 ? std::max(1U, std::thread::hardware_concurrency()) : num_threads)
+{
+    for (const auto& spec : m_matcher.columns())
+    {
+        if (spec.name == m_pattern_column)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Duplicate Grok column '" << m_pattern_column << "'"));
+        }
+    }
+}
+
+cudf::io::table_with_metadata GrokStage::match_column(const cudf::column_view& column) const
+{
+    return ColumnUtil::parse_strings_column_parallel(
+        column,
+        m_num_threads,
+        [this](const HostStringsColumn& strings, std::size_t start, std::size_t stop, DecodedTable& table) {
+            const auto columns        = table.get_columns(m_matcher.columns());
+            const auto pattern_column = table.get_column(m_pattern_column, cudf::type_id::INT32);
+
+            for (std::size_t row = start; row < stop; ++row)
+            {
+                table.begin_row();
+
+                if (strings.is_valid(row))
+                {
+                    if (auto pattern = m_matcher.match(strings.get(row), table, columns))
+                    {
+                        table.set_int(pattern_column, static_cast<std::int64_t>(*pattern));
+                    }
+                }
+
+                table.end_row();
+            }
+        });
+}
+
+GrokStage::source_type_t GrokStage::on_data(sink_type_t x)
+{
+    TableTransaction transaction;
+
+    {
+        auto info         = x->get_info();
+        auto column_names = info.get_column_names();
+
+        auto found = std::find(column_names.begin(), column_names.end(), m_column);
+        if (found == column_names.end())
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Column '" << m_column << "' not found"));
+        }
+
+        const auto& column = info.get_column(static_cast<cudf::size_type>(found - column_names.begin()));
+        if (column.type().id() != cudf::type_id::STRING)
+        {
+            throw std::invalid_argument(
+                MORPHEUS_CONCAT_STR("Grok matching requires a string column, column '" << m_column << "' is not"));
+        }
+
+        auto matched = match_column(column);
+        auto columns = matched.tbl->release();
+        for (std::size_t i = 0; i < columns.size(); ++i)
+        {
+            transaction.add_column(matched.metadata.schema_info[i].name, std::move(columns[i]));
+        }
+    }
+
+    x->get_mutable_info().commit(std::move(transaction));
+
+    return x;
+}
+
+// ************ GrokStageInterfaceProxy ********** //
+std::shared_ptr<mrc::segment::Object<GrokStage>> GrokStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::string column,
+    const std::vector<std::string>& patterns,
+    const std::vector<std::string>& pattern_files,
+    const std::map<std::string, std::string>& custom_patterns,
+    std::string pattern_column,
+    int syslog_year,
+    std::size_t num_threads)
+{
+    GrokLibrary library;
+    for (const auto& pattern_file : pattern_files)
+    {
+        library.load_file(pattern_file);
+    }
+
+    for (const auto& [pattern_name, pattern] : custom_patterns)
+    {
+        library.add_pattern(pattern_name, pattern);
+    }
+
+    GrokMatcher matcher(library, patterns, syslog_year);
+
+    return builder.construct_object<GrokStage>(
+        name, std::move(matcher), std::move(column), std::move(pattern_column), num_threads);
+}
+
+}  // namespace morpheus
@@ -29,18 +29,25 @@
 #include "morpheus/objects/tensor.hpp"
 #include "morpheus/objects/tensor_object.hpp"
 #include "morpheus/stages/triton_inference.hpp"
+#include "morpheus/utilities/dedup_util.hpp"
 #include "morpheus/utilities/matx_util.hpp"
 
 #include <cuda_runtime.h>
 #include <glog/logging.h>
 #include <mrc/cuda/common.hpp>
 #include <pybind11/pybind11.h>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <compare>
 #include <coroutine>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <ostream>
 #include <ratio>
 #include <stdexcept>
@@ -172,6 +179,328 @@ static void reduce_outputs(std::shared_ptr<ControlMessage> const& message, Tenso
     }
 }
 
+// Rows of a payload processed by `DeduplicateStage` which still need to be inferred
+struct DedupBatch
+{
+    DedupIndex index;
+
+    // Rows of the payload sent to inference, in ascending order
+    std::vector<TensorIndex> inferred_rows;
+
+    // Position in `inferred_rows` for each row of the payload, -1 for rows which are not inferred
+    std::vector<TensorIndex> inferred_slot;
+
+    // Outputs of the unique rows which were found in the result cache
+    std::map<TensorIndex, std::map<std::string, DedupCachedRow>> cached_rows;
+
+    // Rows of the input tensors of each unique row, only collected when the result cache is enabled
+    std::map<TensorIndex, std::vector<std::uint8_t>> row_inputs;
+
+    // Rows of the input tensors which need to be inferred, and the position in `inferred_rows` of each
+    TensorIndex num_input_rows{0};
+    std::vector<TensorIndex> input_rows;
+    ShapeType input_slots;
+};
+
+using result_cache_t = LRUCache<std::uint64_t, DedupCacheEntry>;
+
+// Host copy of the rows of the input tensors belonging to each of `rows`. Rows are only matched with the result cache
+// by their hash, their inputs are compared on each hit. The seq_ids are skipped since they index into the payload.
+static std::map<TensorIndex, std::vector<std::uint8_t>> get_row_inputs(const std::shared_ptr<ControlMessage>& message,
+                                                                        const ShapeType& host_seq_ids,
+                                                                        const std::vector<TensorIndex>& rows)
+{
+    std::map<TensorIndex, std::vector<std::uint8_t>> row_inputs;
+    for (auto row : rows)
+    {
+        row_inputs[row];
+    }
+
+    const auto num_input_rows = static_cast<TensorIndex>(host_seq_ids.size());
+    if (num_input_rows == 0)
+    {
+        return row_inputs;
+    }
+
+    for (const auto& [name, tensor] : message->tensors()->get_tensors())
+    {
+        if (name == "seq_ids")
+        {
+            continue;
+        }
+
+        // copy_rows always produces a compact row-major tensor
+        auto host_data = tensor.copy_rows({{0, num_input_rows}}, num_input_rows).get_host_data<std::uint8_t>();
+
+        const auto row_bytes = host_data.size() / num_input_rows;
+
+        for (TensorIndex i = 0; i < num_input_rows; ++i)
+        {
+            auto found = row_inputs.find(host_seq_ids[i]);
+            if (found != row_inputs.end())
+            {
+                auto row_begin = host_data.begin() + i * row_bytes;
+                found->second.insert(found->second.end(), row_begin, row_begin + row_bytes);
+            }
+        }
+    }
+
+    return row_inputs;
+}
+
+static std::optional<DedupBatch> make_dedup_batch(const std::shared_ptr<MultiInferenceMessage>& message,
+                                                  result_cache_t& cache,
+                                                  std::mutex& cache_mutex)
+{
+    // MultiInferenceMessage requires the seq_ids to be contiguous, only ControlMessage is deduplicated
+    return std::nullopt;
+}
+
+static std::optional<DedupBatch> make_dedup_batch(const std::shared_ptr<ControlMessage>& message,
+                                                  result_cache_t& cache,
+                                                  std::mutex& cache_mutex)
+{
+    auto index = DedupUtil::read_index(*message->payload());
+
+    if (!index.has_value())
+    {
+        return std::nullopt;
+    }
+
+    DedupBatch batch;
+    batch.index = std::move(*index);
+    batch.inferred_slot.assign(batch.index.representative.size(), -1);
+
+    auto unique_rows = batch.index.unique_rows();
+
+    // The first column of seq_ids holds the payload row each row of the input tensors belongs to
+    auto host_seq_ids    = get_seq_ids(message);
+    batch.num_input_rows = static_cast<TensorIndex>(host_seq_ids.size());
+
+    if (cache.capacity() > 0)
+    {
+        batch.row_inputs = get_row_inputs(message, host_seq_ids, unique_rows);
+
+        auto lock = std::unique_lock(cache_mutex);
+
+        for (auto row : unique_rows)
+        {
+            const auto* cached = cache.get(batch.index.hashes[row]);
+            if (cached != nullptr && cached->inputs == batch.row_inputs[row])
+            {
+                batch.cached_rows.emplace(row, cached->outputs);
+            }
+        }
+    }
+
+    for (auto row : unique_rows)
+    {
+        if (!batch.cached_rows.contains(row))
+        {
+            batch.inferred_slot[row] = static_cast<TensorIndex>(batch.inferred_rows.size());
+            batch.inferred_rows.push_back(row);
+        }
+    }
+
+    for (TensorIndex i = 0; i < batch.num_input_rows; ++i)
+    {
+        auto slot = batch.inferred_slot[host_seq_ids[i]];
+        if (slot >= 0)
+        {
+            batch.input_rows.push_back(i);
+            batch.input_slots.push_back(slot);
+        }
+    }
+
+    return batch;
+}
+
+static void filter_dedup_inputs(const DedupBatch& batch, TensorMap& input_tensors)
+{
+    const auto num_rows = static_cast<TensorIndex>(batch.input_rows.size());
+
+    if (num_rows == batch.num_input_rows)
+    {
+        return;
+    }
+
+    // Drop the rows whose output is already in the result cache
+    for (auto& mapping : input_tensors)
+    {
+        mapping.second.swap(DedupUtil::gather_tensor_rows(mapping.second, batch.input_rows));
+    }
+}
+
+static void reduce_dedup_outputs(const DedupBatch& batch, TensorMap& output_tensors)
+{
+    const auto num_inferred = static_cast<TensorIndex>(batch.inferred_rows.size());
+
+    if (static_cast<TensorIndex>(batch.input_slots.size()) == num_inferred)
+    {
+        return;
+    }
+
+    // Same as `reduce_outputs` except the rows are reduced into one row per inferred payload row
+    for (auto& mapping : output_tensors)
+    {
+        auto& output_tensor = mapping.second;
+
+        ShapeType shape  = output_tensor.get_shape();
+        ShapeType stride = output_tensor.get_stride();
+
+        ShapeType reduced_shape{shape};
+        reduced_shape[0] = num_inferred;
+
+        auto reduced_buffer = MatxUtil::reduce_max(
+            DevMemInfo{output_tensor.data(), output_tensor.dtype(), output_tensor.get_memory(), shape, stride},
+            batch.input_slots,
+            0,
+            reduced_shape);
+
+        output_tensor.swap(Tensor::create(std::move(reduced_buffer), output_tensor.dtype(), reduced_shape, stride, 0));
+    }
+}
+
+static TensorMap scatter_dedup_outputs(const DedupBatch& batch,
+                                       TensorMap&& output_tensors,
+                                       result_cache_t& cache,
+                                       std::mutex& cache_mutex)
+{
+    const auto& representative = batch.index.representative;
+    const auto num_rows        = static_cast<TensorIndex>(representative.size());
+    const auto num_inferred    = batch.inferred_rows.size();
+
+    if (num_rows == 0 || (output_tensors.empty() && batch.cached_rows.empty()))
+    {
+        // No rows, or no outputs to scatter to them
+        return std::move(output_tensors);
+    }
+
+    if (batch.cached_rows.empty() && cache.capacity() == 0)
+    {
+        // Every unique row was inferred, copy the output of each unique row to its duplicates on the device
+        std::vector<TensorIndex> source_rows(num_rows);
+        for (TensorIndex i = 0; i < num_rows; ++i)
+        {
+            source_rows[i] = batch.inferred_slot[representative[i]];
+        }
+
+        if (batch.index.has_duplicates())
+        {
+            for (auto& mapping : output_tensors)
+            {
+                mapping.second.swap(DedupUtil::gather_tensor_rows(mapping.second, source_rows));
+            }
+        }
+
+        return std::move(output_tensors);
+    }
+
+    // Mixing inferred and cached rows, and filling the cache, is done on the host
+    std::vector<std::string> names;
+    if (!output_tensors.empty())
+    {
+        for (const auto& mapping : output_tensors)
+        {
+            names.push_back(mapping.first);
+        }
+    }
+    else
+    {
+        for (const auto& cached : batch.cached_rows.begin()->second)
+        {
+            names.push_back(cached.first);
+        }
+    }
+
+    TensorMap scattered;
+    std::vector<DedupCacheEntry> new_entries(num_inferred);
+
+    for (const auto& name : names)
+    {
+        std::vector<std::uint8_t> inferred_data;
+        std::optional<DType> dtype;
+        ShapeType row_shape;
+
+        auto found = output_tensors.find(name);
+        if (found != output_tensors.end())
+        {
+            const auto& tensor = found->second;
+            auto shape         = tensor.get_shape();
+
+            dtype.emplace(tensor.dtype());
+            row_shape.assign(shape.begin() + 1, shape.end());
+
+            // copy_rows always produces a compact row-major tensor
+            inferred_data = tensor.copy_rows({{0, shape[0]}}, shape[0]).get_host_data<std::uint8_t>();
+        }
+        else
+        {
+            CHECK(num_inferred == 0) << "Model output '" << name << "' is missing from the inference results";
+
+            const auto& cached = batch.cached_rows.begin()->second.at(name);
+            dtype.emplace(cached.dtype);
+            row_shape = cached.row_shape;
+        }
+
+        std::size_t row_bytes = dtype->item_size();
+        for (auto dim : row_shape)
+        {
+            row_bytes *= dim;
+        }
+
+        std::vector<std::uint8_t> host_data(num_rows * row_bytes);
+
+        for (TensorIndex i = 0; i < num_rows; ++i)
+        {
+            auto slot = batch.inferred_slot[representative[i]];
+
+            const std::uint8_t* source = nullptr;
+            if (slot >= 0)
+            {
+                source = inferred_data.data() + slot * row_bytes;
+            }
+            else
+            {
+                const auto& cached = batch.cached_rows.at(representative[i]).at(name);
+                CHECK(cached.data.size() == row_bytes) << "Cached output for '" << name << "' has an unexpected shape";
+                source = cached.data.data();
+            }
+
+            std::copy(source, source + row_bytes, host_data.begin() + i * row_bytes);
+        }
+
+        for (std::size_t slot = 0; slot < num_inferred; ++slot)
+        {
+            auto row_begin = inferred_data.begin() + slot * row_bytes;
+            new_entries[slot].outputs.emplace(
+                name, DedupCachedRow{*dtype, row_shape, std::vector<std::uint8_t>(row_begin, row_begin + row_bytes)});
+        }
+
+        ShapeType shape{num_rows};
+        shape.insert(shape.end(), row_shape.begin(), row_shape.end());
+
+        auto buffer = std::make_shared<rmm::device_buffer>(
+            host_data.data(), host_data.size(), rmm::cuda_stream_per_thread);
+
+        scattered.emplace(name, Tensor::create(std::move(buffer), *dtype, shape, {}, 0));
+    }
+
+    if (cache.capacity() > 0)
+    {
+        auto lock = std::unique_lock(cache_mutex);
+
+        for (std::size_t slot = 0; slot < num_inferred; ++slot)
+        {
+            const auto row          = batch.inferred_rows[slot];
+            new_entries[slot].inputs = batch.row_inputs.at(row);
+            cache.put(batch.index.hashes[row], std::move(new_entries[slot]));
+        }
+    }
+
+    return scattered;
+}
+
 static void apply_logits(TensorMap& output_tensors)
 {
     for (auto& mapping : output_tensors)
@@ -198,12 +527,14 @@ InferenceClientStage<InputT, OutputT>::InferenceClientStage(std::unique_ptr<IInf
                                                             std::string model_name,
                                                             bool needs_logits,
                                                             std::vector<TensorModelMapping> input_mapping,
-                                                            std::vector<TensorModelMapping> output_mapping) :
+                                                            std::vector<TensorModelMapping> output_mapping,
+                                                            std::size_t dedup_cache_size) :
   m_model_name(std::move(model_name)),
   m_client(std::move(client)),
   m_needs_logits(needs_logits),
   m_input_mapping(std::move(input_mapping)),
-  m_output_mapping(std::move(output_mapping))
+  m_output_mapping(std::move(output_mapping)),
+  m_dedup_cache(dedup_cache_size)
 {}
 
 struct ExponentialBackoff
@@ -260,6 +591,9 @@ mrc::coroutines::AsyncGenerator<std::shared_ptr<OutputT>> InferenceClientStage<I
 
     auto backoff = ExponentialBackoff(on, 100ms, 4000ms);
 
+    // Payloads processed by `DeduplicateStage` only infer the unique rows which are not in the result cache
+    auto dedup_batch = make_dedup_batch(message, m_dedup_cache, m_dedup_cache_mutex);
+
     while (true)
     {
         auto message_session = m_session;
@@ -300,11 +634,29 @@ mrc::coroutines::AsyncGenerator<std::shared_ptr<OutputT>> InferenceClientStage<I
                 }
             }
 
-            auto model_output_tensors = co_await message_session->infer(std::move(model_input_tensors));
+            TensorMap model_output_tensors;
+
+            if (dedup_batch.has_value())
+            {
+                filter_dedup_inputs(*dedup_batch, model_input_tensors);
+            }
+
+            // Skip the request entirely when every row was found in the result cache
+            if (!dedup_batch.has_value() || !dedup_batch->inferred_rows.empty())
+            {
+                model_output_tensors = co_await message_session->infer(std::move(model_input_tensors));
 
-            co_await on->yield();
+                co_await on->yield();
+            }
 
-            reduce_outputs(message, model_output_tensors);
+            if (dedup_batch.has_value())
+            {
+                reduce_dedup_outputs(*dedup_batch, model_output_tensors);
+            }
+            else
+            {
+                reduce_outputs(message, model_output_tensors);
+            }
 
             // If we need to do logits, do that here
             if (m_needs_logits)
@@ -327,6 +679,12 @@ mrc::coroutines::AsyncGenerator<std::shared_ptr<OutputT>> InferenceClientStage<I
                 }
             }
 
+            if (dedup_batch.has_value())
+            {
+                output_tensor_map = scatter_dedup_outputs(
+                    *dedup_batch, std::move(output_tensor_map), m_dedup_cache, m_dedup_cache_mutex);
+            }
+
             auto result = make_response(message, std::move(output_tensor_map));
 
             co_yield result;
@@ -416,7 +774,8 @@ InferenceClientStageInterfaceProxy::init_cm(mrc::segment::Builder& builder,
                                             bool needs_logits,
                                             bool force_convert_inputs,
                                             std::map<std::string, std::string> input_mappings,
-                                            std::map<std::string, std::string> output_mappings)
+                                            std::map<std::string, std::string> output_mappings,
+                                            std::size_t dedup_cache_size)
 {
     std::vector<TensorModelMapping> input_mappings_{};
     std::vector<TensorModelMapping> output_mappings_{};
@@ -435,7 +794,13 @@ InferenceClientStageInterfaceProxy::init_cm(mrc::segment::Builder& builder,
     auto triton_inference_client =
         std::make_unique<TritonInferenceClient>(std::move(triton_client), model_name, force_convert_inputs);
     auto stage = builder.construct_object<InferenceClientStage<ControlMessage, ControlMessage>>(
-        name, std::move(triton_inference_client), model_name, needs_logits, input_mappings_, output_mappings_);
+        name,
+        std::move(triton_inference_client),
+        model_name,
+        needs_logits,
+        input_mappings_,
+        output_mappings_,
+        dedup_cache_size);
 
     return stage;
 }
@@ -0,0 +1,594 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/inference_worker_pool.hpp"
+
+#include "morpheus/messages/control.hpp"                  // for ControlMessage
+#include "morpheus/messages/memory/response_memory.hpp"   // for ResponseMemory
+#include "morpheus/messages/memory/tensor_memory.hpp"     // for TensorMemory
+#include "morpheus/messages/meta.hpp"                     // for MessageMeta
+#include "morpheus/messages/multi_inference.hpp"          // for MultiInferenceMessage
+#include "morpheus/messages/multi_response.hpp"           // for MultiResponseMessage
+#include "morpheus/objects/dev_mem_info.hpp"              // for DevMemInfo
+#include "morpheus/objects/tensor.hpp"                    // for Tensor
+#include "morpheus/objects/tensor_object.hpp"             // for TensorObject
+#include "morpheus/types.hpp"                             // for TensorIndex, TensorMap, ShapeType, RangeType
+#include "morpheus/utilities/cupy_util.hpp"               // for CupyUtil
+#include "morpheus/utilities/matx_util.hpp"               // for MatxUtil
+#include "morpheus/utilities/string_util.hpp"             // for MORPHEUS_CONCAT_STR
+#include "morpheus/utilities/tensor_util.hpp"             // for TensorUtils
+
+#include <cuda_runtime.h>            // for cudaMemcpy2D, cudaMemset, cudaMemcpyDeviceToHost
+#include <glog/logging.h>            // for CHECK
+#include <mrc/cuda/common.hpp>       // for MRC_CHECK_CUDA
+#include <mrc/segment/builder.hpp>   // for Builder
+#include <pybind11/gil.h>            // for gil_scoped_acquire, gil_scoped_release, PyGILState_Check
+#include <pybind11/pybind11.h>       // for cpp_function, isinstance
+#include <pybind11/stl.h>            // IWYU pragma: keep
+#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_per_thread
+#include <rmm/device_buffer.hpp>     // for device_buffer
+
+#include <algorithm>  // for max
+#include <atomic>     // for atomic_bool
+#include <exception>  // for exception_ptr, current_exception, make_exception_ptr
+#include <optional>   // for optional
+#include <stdexcept>  // for runtime_error
+#include <tuple>      // for tuple
+#include <utility>    // for move
+
+namespace {
+using namespace morpheus;
+namespace py = pybind11;
+
+ShapeType get_host_seq_ids(const MultiInferenceMessage& message)
+{
+    // Only the first column of seq_ids is needed to map tensor rows back to rows in the dataframe
+    auto seq_ids         = message.get_input("seq_ids");
+    const auto item_size = seq_ids.dtype().item_size();
+
+    CHECK(seq_ids.dtype().type_id() == DType::create<TensorIndex>().type_id())
+        << "InferenceWorkerPoolStage requires the 'seq_ids' tensor to be of type "
+        << DType::create<TensorIndex>().name();
+
+    ShapeType host_seq_ids(message.count);
+    MRC_CHECK_CUDA(cudaMemcpy2D(host_seq_ids.data(),
+                                item_size,
+                                seq_ids.data(),
+                                seq_ids.stride(0) * item_size,
+                                item_size,
+                                host_seq_ids.size(),
+                                cudaMemcpyDeviceToHost));
+
+    return host_seq_ids;
+}
+
+TensorMap tensors_from_response(py::object response)
+{
+    // Workers implemented against the C++ messages return the bound TensorMemory, pure python workers return the
+    // python `TensorMemory` dataclass which holds cupy arrays
+    if (py::isinstance<TensorMemory>(response))
+    {
+        return response.cast<std::shared_ptr<TensorMemory>>()->get_tensors();
+    }
+
+    auto py_tensors = response.attr("get_tensors")().cast<CupyUtil::py_tensor_map_t>();
+
+    return CupyUtil::cupy_to_tensors(py_tensors);
+}
+
+/**
+ * @brief Copies the tensors returned for a single batch into the rows of `outputs` belonging to the batch, allocating
+ * the output tensors from the shape and type of the first response.
+ */
+void assemble_batch_response(const MultiInferenceMessage& message,
+                             const MultiInferenceMessage& batch,
+                             const ShapeType& batch_seq_ids,
+                             TensorMap&& batch_tensors,
+                             TensorMap& outputs)
+{
+    const TensorIndex row_offset = batch.mess_offset - message.mess_offset;
+
+    for (auto& [name, response_tensor] : batch_tensors)
+    {
+        // Ensure we always have a [rows, cols] layout
+        if (response_tensor.rank() == 1)
+        {
+            response_tensor.swap(response_tensor.reshape({response_tensor.shape(0), 1}));
+        }
+
+        if (response_tensor.shape(0) != batch.count)
+        {
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Inference worker returned " << response_tensor.shape(0)
+                                                                                      << " rows for tensor '" << name
+                                                                                      << "', expected "
+                                                                                      << batch.count));
+        }
+
+        // When a message was split across several tensor rows, take the max of each output across those rows
+        if (batch.count != batch.mess_count)
+        {
+            ShapeType reduced_shape{batch.mess_count, response_tensor.shape(1)};
+
+            auto reduced_buffer = MatxUtil::reduce_max(DevMemInfo{response_tensor.data(),
+                                                                  response_tensor.dtype(),
+                                                                  response_tensor.get_memory(),
+                                                                  response_tensor.get_shape(),
+                                                                  response_tensor.get_stride()},
+                                                       batch_seq_ids,
+                                                       0,
+                                                       reduced_shape);
+
+            response_tensor.swap(
+                Tensor::create(std::move(reduced_buffer), response_tensor.dtype(), reduced_shape, {}, 0));
+        }
+
+        auto output = outputs.find(name);
+
+        if (output == outputs.end())
+        {
+            ShapeType output_shape{message.mess_count, response_tensor.shape(1)};
+
+            auto output_buffer = std::make_shared<rmm::device_buffer>(
+                TensorUtils::get_elem_count(output_shape) * response_tensor.dtype_size(), rmm::cuda_stream_per_thread);
+
+            MRC_CHECK_CUDA(cudaMemset(output_buffer->data(), 0, output_buffer->size()));
+
+            auto output_tensor = Tensor::create(std::move(output_buffer), response_tensor.dtype(), output_shape, {}, 0);
+
+            output = outputs.emplace(name, std::move(output_tensor)).first;
+        }
+
+        auto output_slice = output->second.slice({row_offset, 0}, {row_offset + batch.mess_count, -1});
+
+        if (response_tensor.get_stride() != output_slice.get_stride())
+        {
+            response_tensor.swap(response_tensor.deep_copy());
+        }
+
+        output_slice = response_tensor;
+    }
+}
+
+}  // namespace
+
+namespace morpheus {
+
+// ************ InferenceWorkerPool ************************ //
+InferenceWorkerPool::InferenceWorkerPool(pybind11::function worker_factory,
+                                         std::size_t num_workers,
+                                         std::size_t max_queue_size) :
+  m_worker_factory(std::move(worker_factory)),
+  m_num_workers(std::max<std::size_t>(num_workers, 1)),
+  m_max_queue_size(max_queue_size == 0 ? 2 * std::max<std::size_t>(num_workers, 1) : max_queue_size)
+{}
+
+InferenceWorkerPool::~InferenceWorkerPool()
+{
+    this->shutdown();
+
+    py::gil_scoped_acquire gil;
+    m_worker_factory = py::function();
+}
+
+void InferenceWorkerPool::start()
+{
+    // Must be called with m_mutex held
+    m_started    = true;
+    m_start_time = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < m_num_workers; ++i)
+    {
+        m_threads.emplace_back(&InferenceWorkerPool::run_worker, this);
+    }
+}
+
+std::future<TensorMap> InferenceWorkerPool::submit(std::shared_ptr<MultiInferenceMessage> batch)
+{
+    auto result = std::make_shared<std::promise<TensorMap>>();
+    auto future = result->get_future();
+
+    {
+        std::unique_lock lock(m_mutex);
+
+        if (!m_started && !m_closed)
+        {
+            this->start();
+        }
+
+        m_space_available.wait(lock, [this]() {
+            return m_queue.size() < m_max_queue_size || m_closed || m_error;
+        });
+
+        if (m_error)
+        {
+            result->set_exception(m_error);
+            return future;
+        }
+
+        if (m_closed)
+        {
+            result->set_exception(std::make_exception_ptr(
+                std::runtime_error("Cannot submit inference batches after the worker pool has been shut down")));
+            return future;
+        }
+
+        m_queue.push_back(WorkItem{std::move(batch), std::move(result)});
+        m_max_queue_depth = std::max(m_max_queue_depth, m_queue.size());
+    }
+
+    m_item_available.notify_one();
+
+    return future;
+}
+
+void InferenceWorkerPool::run_worker()
+{
+    py::object worker;
+
+    try
+    {
+        py::gil_scoped_acquire gil;
+
+        // Each worker thread owns its own python worker, the same as a python `InferenceStage` with `num_threads`
+        worker = m_worker_factory();
+        worker.attr("init")();
+    } catch (...)
+    {
+        auto error = std::current_exception();
+
+        {
+            py::gil_scoped_acquire gil;
+            worker = py::object();
+        }
+
+        this->fail(std::move(error));
+        return;
+    }
+
+    while (true)
+    {
+        WorkItem item;
+
+        {
+            std::unique_lock lock(m_mutex);
+
+            m_item_available.wait(lock, [this]() {
+                return !m_queue.empty() || m_closed;
+            });
+
+            if (m_queue.empty())
+            {
+                // Closed and fully drained
+                break;
+            }
+
+            item = std::move(m_queue.front());
+            m_queue.pop_front();
+            ++m_busy_workers;
+        }
+
+        m_space_available.notify_one();
+
+        auto start_time = std::chrono::steady_clock::now();
+
+        this->process_item(worker, item);
+
+        auto busy_time = std::chrono::steady_clock::now() - start_time;
+
+        {
+            std::lock_guard lock(m_mutex);
+            --m_busy_workers;
+            ++m_batches_processed;
+            m_busy_time += std::chrono::duration_cast<std::chrono::nanoseconds>(busy_time);
+        }
+    }
+
+    py::gil_scoped_acquire gil;
+
+    try
+    {
+        worker.attr("stop")();
+    } catch (const std::exception& e)
+    {
+        LOG(ERROR) << "Exception while stopping inference worker: " << e.what();
+    }
+
+    worker = py::object();
+}
+
+void InferenceWorkerPool::process_item(pybind11::object& worker, WorkItem& item)
+{
+    // The worker may invoke the callback asynchronously, possibly after `process` has raised. Ensure the promise is
+    // only ever satisfied once.
+    auto result    = item.result;
+    auto completed = std::make_shared<std::atomic_bool>(false);
+
+    py::gil_scoped_acquire gil;
+
+    try
+    {
+        auto callback = py::cpp_function([result, completed](py::object response) {
+            auto tensors = tensors_from_response(std::move(response));
+
+            if (!completed->exchange(true))
+            {
+                result->set_value(std::move(tensors));
+            }
+        });
+
+        worker.attr("process")(item.batch, callback);
+    } catch (...)
+    {
+        if (!completed->exchange(true))
+        {
+            result->set_exception(std::current_exception());
+        }
+    }
+}
+
+void InferenceWorkerPool::fail(std::exception_ptr error)
+{
+    LOG(ERROR) << "Inference worker failed to start, failing all queued and future batches";
+
+    std::deque<WorkItem> queued;
+
+    {
+        std::lock_guard lock(m_mutex);
+
+        if (!m_error)
+        {
+            m_error = error;
+        }
+
+        queued.swap(m_queue);
+    }
+
+    m_space_available.notify_all();
+
+    for (auto& item : queued)
+    {
+        item.result->set_exception(error);
+    }
+}
+
+void InferenceWorkerPool::shutdown()
+{
+    {
+        std::lock_guard lock(m_mutex);
+
+        if (m_closed)
+        {
+            return;
+        }
+
+        m_closed = true;
+    }
+
+    m_item_available.notify_all();
+    m_space_available.notify_all();
+
+    // The workers need the GIL to exit, release it if we are being called from python
+    std::optional<py::gil_scoped_release> nogil;
+    if (PyGILState_Check() != 0)
+    {
+        nogil.emplace();
+    }
+
+    for (auto& thread : m_threads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+}
+
+void InferenceWorkerPool::record_message()
+{
+    std::lock_guard lock(m_mutex);
+    ++m_messages_processed;
+}
+
+InferenceWorkerPoolStats InferenceWorkerPool::get_stats() const
+{
+    std::lock_guard lock(m_mutex);
+
+    InferenceWorkerPoolStats stats;
+    stats.num_workers        = m_num_workers;
+    stats.busy_workers       = m_busy_workers;
+    stats.queue_depth        = m_queue.size();
+    stats.max_queue_depth    = m_max_queue_depth;
+    stats.batches_processed  = m_batches_processed;
+    stats.messages_processed = m_messages_processed;
+
+    if (m_started)
+    {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                            m_start_time);
+
+        if (elapsed.count() > 0)
+        {
+            stats.worker_utilization = static_cast<double>(m_busy_time.count()) /
+                                       (static_cast<double>(elapsed.count()) * static_cast<double>(m_num_workers));
+        }
+    }
+
+    return stats;
+}
+
+// ************ InferenceWorkerPoolStage ******************* //
+template <typename InputT, typename OutputT>
+InferenceWorkerPoolStage<InputT, OutputT>::InferenceWorkerPoolStage(pybind11::function worker_factory,
+                                                                    std::size_t num_workers,
+                                                                    TensorIndex max_batch_size,
+                                                                    std::size_t max_queue_size) :
+  base_t(rxcpp::operators::map([this](sink_type_t x) {
+      return this->on_data(std::move(x));
+  })),
+  m_max_batch_size(max_batch_size),
+  m_pool(std::make_shared<InferenceWorkerPool>(std::move(worker_factory), num_workers, max_queue_size))
+{
+    CHECK(m_max_batch_size > 0) << "max_batch_size must be greater than zero";
+}
+
+template <typename InputT, typename OutputT>
+InferenceWorkerPoolStats InferenceWorkerPoolStage<InputT, OutputT>::get_stats() const
+{
+    return m_pool->get_stats();
+}
+
+template <typename InputT, typename OutputT>
+void InferenceWorkerPoolStage<InputT, OutputT>::shutdown()
+{
+    m_pool->shutdown();
+}
+
+template <typename InputT, typename OutputT>
+std::shared_ptr<MultiInferenceMessage> InferenceWorkerPoolStage<InputT, OutputT>::to_inference_message(
+    sink_type_t& x) const
+{
+    if constexpr (std::is_same_v<InputT, MultiInferenceMessage>)
+    {
+        return x;
+    }
+    else
+    {
+        // Present the control message to the python worker as a MultiInferenceMessage over the entire payload
+        auto memory = x->tensors();
+        return std::make_shared<MultiInferenceMessage>(
+            x->payload(), 0, x->payload()->count(), memory, 0, memory->count);
+    }
+}
+
+template <typename InputT, typename OutputT>
+typename InferenceWorkerPoolStage<InputT, OutputT>::source_type_t
+InferenceWorkerPoolStage<InputT, OutputT>::make_response(sink_type_t& x, TensorMap&& outputs) const
+{
+    if constexpr (std::is_same_v<InputT, MultiInferenceMessage>)
+    {
+        auto response_mem = std::make_shared<ResponseMemory>(x->mess_count, std::move(outputs));
+
+        return std::make_shared<MultiResponseMessage>(
+            x->meta, x->mess_offset, x->mess_count, std::move(response_mem), 0, x->mess_count);
+    }
+    else
+    {
+        x->tensors(std::make_shared<TensorMemory>(x->payload()->count(), std::move(outputs)));
+        return x;
+    }
+}
+
+template <typename InputT, typename OutputT>
+typename InferenceWorkerPoolStage<InputT, OutputT>::source_type_t InferenceWorkerPoolStage<InputT, OutputT>::on_data(
+    sink_type_t x)
+{
+    auto message      = this->to_inference_message(x);
+    auto host_seq_ids = get_host_seq_ids(*message);
+
+    // Queue up every batch before waiting on any of them so the workers can run concurrently
+    std::vector<std::tuple<std::shared_ptr<MultiInferenceMessage>, RangeType, std::future<TensorMap>>> pending;
+
+    for (const auto& range : TensorUtils::split_seq_id_batches(host_seq_ids, m_max_batch_size))
+    {
+        auto batch  = message->get_slice(range.first, range.second);
+        auto future = m_pool->submit(batch);
+
+        pending.emplace_back(std::move(batch), range, std::move(future));
+    }
+
+    TensorMap outputs;
+
+    for (auto& [batch, range, future] : pending)
+    {
+        ShapeType batch_seq_ids(host_seq_ids.begin() + range.first, host_seq_ids.begin() + range.second);
+
+        assemble_batch_response(*message, *batch, batch_seq_ids, future.get(), outputs);
+    }
+
+    m_pool->record_message();
+
+    return this->make_response(x, std::move(outputs));
+}
+
+template class InferenceWorkerPoolStage<MultiInferenceMessage, MultiResponseMessage>;
+template class InferenceWorkerPoolStage<ControlMessage, ControlMessage>;
+
+// ************ InferenceWorkerPoolStageInterfaceProxy ***** //
+std::shared_ptr<mrc::segment::Object<InferenceWorkerPoolStageMM>> InferenceWorkerPoolStageInterfaceProxy::init_multi(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    pybind11::function worker_factory,
+    std::size_t num_workers,
+    TensorIndex max_batch_size,
+    std::size_t max_queue_size)
+{
+    auto stage = builder.construct_object<InferenceWorkerPoolStageMM>(
+        name, std::move(worker_factory), num_workers, max_batch_size, max_queue_size);
+
+    return stage;
+}
+
+std::shared_ptr<mrc::segment::Object<InferenceWorkerPoolStageCM>> InferenceWorkerPoolStageInterfaceProxy::init_cm(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    pybind11::function worker_factory,
+    std::size_t num_workers,
+    TensorIndex max_batch_size,
+    std::size_t max_queue_size)
+{
+    auto stage = builder.construct_object<InferenceWorkerPoolStageCM>(
+        name, std::move(worker_factory), num_workers, max_batch_size, max_queue_size);
+
+    return stage;
+}
+
+namespace {
+py::dict stats_to_dict(const InferenceWorkerPoolStats& stats)
+{
+    using namespace py::literals;
+
+    return py::dict("num_workers"_a        = stats.num_workers,
+                    "busy_workers"_a       = stats.busy_workers,
+                    "queue_depth"_a        = stats.queue_depth,
+                    "max_queue_depth"_a    = stats.max_queue_depth,
+                    "batches_processed"_a  = stats.batches_processed,
+                    "messages_processed"_a = stats.messages_processed,
+                    "worker_utilization"_a = stats.worker_utilization);
+}
+}  // namespace
+
+pybind11::dict InferenceWorkerPoolStageInterfaceProxy::get_stats(mrc::segment::Object<InferenceWorkerPoolStageMM>& self)
+{
+    return stats_to_dict(self.object().get_stats());
+}
+
+pybind11::dict InferenceWorkerPoolStageInterfaceProxy::get_stats(mrc::segment::Object<InferenceWorkerPoolStageCM>& self)
+{
+    return stats_to_dict(self.object().get_stats());
+}
+
+void InferenceWorkerPoolStageInterfaceProxy::shutdown(mrc::segment::Object<InferenceWorkerPoolStageMM>& self)
+{
+    self.object().shutdown();
+}
+
+void InferenceWorkerPoolStageInterfaceProxy::shutdown(mrc::segment::Object<InferenceWorkerPoolStageCM>& self)
+{
+    self.object().shutdown();
+}
+
+}  // namespace morpheus
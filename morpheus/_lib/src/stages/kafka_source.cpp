@@ -21,12 +21,17 @@
 #include "pymrc/utilities/function_wrappers.hpp"  // for PyFuncWrapper
 
 #include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/decoded_table.hpp"  // for DecodedTable
+#include "morpheus/utilities/column_util.hpp"  // for ColumnUtil
 #include "morpheus/utilities/stage_util.hpp"
 #include "morpheus/utilities/string_util.hpp"
 
 #include <boost/fiber/operations.hpp>  // for sleep_for, yield
 #include <boost/fiber/recursive_mutex.hpp>
+#include <cudf/column/column.hpp>  // for column
 #include <cudf/io/json.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>  // for size_type, type_id
 #include <glog/logging.h>
 #include <librdkafka/rdkafkacpp.h>
 #include <mrc/runnable/context.hpp>
@@ -50,6 +55,7 @@
 #include <optional>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -107,6 +113,25 @@ class KafkaSourceStageUnsubscribedException : public std::exception
 class KafkaSourceStageStopAfter : public std::exception
 {};
 
+// ************ KafkaSourceStage__SchemaRegistry *********************//
+// Fetches the schemas from a Python callable, such as a client of a Confluent schema registry
+class KafkaSourceStage__SchemaRegistry : public SchemaRegistry  // NOLINT
+{
+  public:
+    KafkaSourceStage__SchemaRegistry(mrc::pymrc::PyFuncWrapper get_schema_fn) :
+      m_get_schema_fn(std::move(get_schema_fn))
+    {}
+
+    std::string get_schema(std::int32_t schema_id) override
+    {
+        pybind11::gil_scoped_acquire gil;
+        return m_get_schema_fn.operator()<std::string, std::int32_t>(schema_id);
+    }
+
+  private:
+    mrc::pymrc::PyFuncWrapper m_get_schema_fn;
+};
+
 // ************ KafkaSourceStage__Rebalancer *************************//
 class KafkaSourceStage__Rebalancer : public RdKafka::RebalanceCb  // NOLINT
 {
@@ -284,6 +309,39 @@ class KafkaRebalancer : public RdKafka::RebalanceCb
     std::unique_ptr<RdKafka::KafkaConsumer> m_consumer;
 };
 
+namespace {
+const std::vector<std::string> MetadataFields = {"key", "topic", "partition", "offset", "timestamp", "timestamp_type"};
+
+// Value of the last header `name` of a record, null when the record doesn't hold it or its value is null
+std::optional<std::string> header_value(RdKafka::Headers* headers, const std::string& name)
+{
+    if (headers == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    auto header = headers->get_last(name);
+    if (header.err() != RdKafka::ERR_NO_ERROR || header.value() == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    return std::string(static_cast<const char*>(header.value()), header.value_size());
+}
+
+std::map<std::string, std::unordered_set<std::string>> make_header_filters(
+    const std::map<std::string, std::vector<std::string>>& header_filters)
+{
+    std::map<std::string, std::unordered_set<std::string>> filters;
+    for (const auto& [name, values] : header_filters)
+    {
+        filters[name].insert(values.begin(), values.end());
+    }
+
+    return filters;
+}
+}  // namespace
+
 // Component public implementations
 // ************ KafkaStage ************************* //
 KafkaSourceStage::KafkaSourceStage(TensorIndex max_batch_size,
@@ -294,7 +352,9 @@ KafkaSourceStage::KafkaSourceStage(TensorIndex max_batch_size,
                                    bool disable_pre_filtering,
                                    std::size_t stop_after,
                                    bool async_commits,
-                                   std::unique_ptr<KafkaOAuthCallback> oauth_callback) :
+                                   std::unique_ptr<KafkaOAuthCallback> oauth_callback,
+                                   KafkaRecordOptions record_options,
+                                   std::shared_ptr<PayloadDecoder> payload_decoder) :
   PythonSource(build()),
   m_max_batch_size(max_batch_size),
   m_topics(std::vector<std::string>{std::move(topic)}),
@@ -304,8 +364,14 @@ KafkaSourceStage::KafkaSourceStage(TensorIndex max_batch_size,
   m_disable_pre_filtering(disable_pre_filtering),
   m_stop_after{stop_after},
   m_async_commits(async_commits),
-  m_oauth_callback(std::move(oauth_callback))
-{}
+  m_oauth_callback(std::move(oauth_callback)),
+  m_record_options(std::move(record_options)),
+  m_payload_decoder(std::move(payload_decoder)),
+  m_key_filter(m_record_options.key_filter.begin(), m_record_options.key_filter.end()),
+  m_header_filters(make_header_filters(m_record_options.header_filters))
+{
+    check_record_options();
+}
 
 KafkaSourceStage::KafkaSourceStage(TensorIndex max_batch_size,
                                    std::vector<std::string> topics,
@@ -315,7 +381,9 @@ KafkaSourceStage::KafkaSourceStage(TensorIndex max_batch_size,
                                    bool disable_pre_filtering,
                                    std::size_t stop_after,
                                    bool async_commits,
-                                   std::unique_ptr<KafkaOAuthCallback> oauth_callback) :
+                                   std::unique_ptr<KafkaOAuthCallback> oauth_callback,
+                                   KafkaRecordOptions record_options,
+                                   std::shared_ptr<PayloadDecoder> payload_decoder) :
   PythonSource(build()),
   m_max_batch_size(max_batch_size),
   m_topics(std::move(topics)),
@@ -325,8 +393,14 @@ KafkaSourceStage::KafkaSourceStage(TensorIndex max_batch_size,
   m_disable_pre_filtering(disable_pre_filtering),
   m_stop_after{stop_after},
   m_async_commits(async_commits),
-  m_oauth_callback(std::move(oauth_callback))
-{}
+  m_oauth_callback(std::move(oauth_callback)),
+  m_record_options(std::move(record_options)),
+  m_payload_decoder(std::move(payload_decoder)),
+  m_key_filter(m_record_options.key_filter.begin(), m_record_options.key_filter.end()),
+  m_header_filters(make_header_filters(m_record_options.header_filters))
+{
+    check_record_options();
+}
 
 KafkaSourceStage::subscriber_fn_t KafkaSourceStage::build()
 {
@@ -372,6 +446,12 @@ KafkaSourceStage::subscriber_fn_t KafkaSourceStage::build()
                     return false;
                 }
 
+                // Every record of the batch was rejected by the filters, their offsets are still committed
+                if (batch == nullptr)
+                {
+                    return m_requires_commit;
+                }
+
                 auto num_records = batch->count();
                 sub.on_next(std::move(batch));
                 records_emitted += num_records;
@@ -622,13 +702,20 @@ cudf::io::table_with_metadata KafkaSourceStage::load_table(const std::string& bu
 }
 
 template <bool EnableFilter>
-std::string concat_message_batch(std::vector<std::unique_ptr<RdKafka::Message>> const& message_batch)
+std::string concat_message_batch(std::vector<RdKafka::Message*>& messages, bool single_line)
 {
     std::ostringstream buffer;
 
-    for (auto& msg : message_batch)
+    // Remove the records which aren't parsed, so that the rows of the table match the remaining records
+    std::vector<RdKafka::Message*> parsed;
+    for (auto* msg : messages)
     {
-        auto s = static_cast<char*>(msg->payload());
+        if (msg->payload() == nullptr || msg->len() == 0)
+        {
+            continue;
+        }
+
+        std::string s(static_cast<const char*>(msg->payload()), msg->len());
 
         if constexpr (EnableFilter)
         {
@@ -639,26 +726,266 @@ std::string concat_message_batch(std::vector<std::unique_ptr<RdKafka::Message>>
             }
         }
 
+        // Line breaks are only allowed between the tokens of a JSON document, the metadata columns need each record
+        // on a single line. Otherwise a record may hold several JSON lines, each of which is a row.
+        if (single_line)
+        {
+            std::replace_if(
+                s.begin(),
+                s.end(),
+                [](char c) {
+                    return c == '\n' || c == '\r';
+                },
+                ' ');
+        }
+
         buffer << s << "\n";
+        parsed.push_back(msg);
     }
 
+    messages = std::move(parsed);
+
     return buffer.str();
 }
 
 std::shared_ptr<morpheus::MessageMeta> KafkaSourceStage::process_batch(
     std::vector<std::unique_ptr<RdKafka::Message>>&& message_batch)
 {
-    // concat the kafka json messages
-    auto json_lines = !this->m_disable_pre_filtering ? concat_message_batch<true>(message_batch)
-                                                     : concat_message_batch<false>(message_batch);
+    // Apply the key and header filters before any payload is parsed
+    std::vector<RdKafka::Message*> messages;
+    for (auto& msg : message_batch)
+    {
+        if (this->accept_record(*msg))
+        {
+            messages.push_back(msg.get());
+        }
+    }
+
+    cudf::io::table_with_metadata data_table;
+    if (m_payload_decoder != nullptr)
+    {
+        // Decode the Avro or Protobuf payloads straight into columns, skipping the JSON reader
+        std::vector<std::string_view> payloads;
+        payloads.reserve(messages.size());
+        for (auto* msg : messages)
+        {
+            payloads.emplace_back(static_cast<const char*>(msg->payload()), msg->payload() == nullptr ? 0 : msg->len());
+        }
+
+        std::vector<bool> decoded;
+        auto table = m_payload_decoder->decode(payloads, decoded);
+
+        // Remove the records which aren't decoded, so that the rows of the table match the remaining records
+        std::vector<RdKafka::Message*> decoded_messages;
+        for (std::size_t i = 0; i < messages.size(); ++i)
+        {
+            if (decoded[i])
+            {
+                decoded_messages.push_back(messages[i]);
+            }
+        }
 
-    // parse the json
-    auto data_table = this->load_table(json_lines);
+        messages = std::move(decoded_messages);
+        if (messages.empty())
+        {
+            return nullptr;
+        }
+
+        data_table = table.to_table();
+    }
+    else
+    {
+        // concat the kafka json messages
+        const bool single_line =
+            !m_record_options.metadata_columns.empty() || !m_record_options.header_columns.empty();
+        auto json_lines = !this->m_disable_pre_filtering ? concat_message_batch<true>(messages, single_line)
+                                                         : concat_message_batch<false>(messages, single_line);
+
+        if (messages.empty())
+        {
+            return nullptr;
+        }
+
+        // parse the json
+        data_table = this->load_table(json_lines);
+    }
+
+    this->add_metadata_columns(data_table, messages);
 
     // Next, create the message metadata. This gets reused for repeats
     return MessageMeta::create_from_cpp(std::move(data_table), 0);
 }
 
+void KafkaSourceStage::check_record_options() const
+{
+    for (const auto& field : m_record_options.metadata_columns)
+    {
+        if (std::find(MetadataFields.begin(), MetadataFields.end(), field) == MetadataFields.end())
+        {
+            const auto fields = StringUtil::join(MetadataFields.begin(), MetadataFields.end(), ", ");
+            throw std::invalid_argument(
+                MORPHEUS_CONCAT_STR("Unknown Kafka metadata column '" << field << "', must be one of: " << fields));
+        }
+    }
+}
+
+bool KafkaSourceStage::accept_record(RdKafka::Message& message) const
+{
+    if (!m_key_filter.empty())
+    {
+        const auto* key = static_cast<const char*>(message.key_pointer());
+        if (key == nullptr || !m_key_filter.contains(std::string(key, message.key_len())))
+        {
+            return false;
+        }
+    }
+
+    for (const auto& [name, values] : m_header_filters)
+    {
+        auto value = header_value(message.headers(), name);
+        if (!value.has_value() || !values.contains(*value))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void KafkaSourceStage::add_metadata_columns(cudf::io::table_with_metadata& table,
+                                            const std::vector<RdKafka::Message*>& messages) const
+{
+    if (m_record_options.metadata_columns.empty() && m_record_options.header_columns.empty())
+    {
+        return;
+    }
+
+    const auto num_rows = static_cast<std::size_t>(table.tbl->num_rows());
+    if (num_rows != messages.size())
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR("Parsed " << num_rows << " rows from " << messages.size()
+                                                               << " records, metadata columns require one row each"));
+    }
+
+    auto columns = table.tbl->release();
+
+    // A payload field with the name of a metadata column is replaced by the metadata
+    auto add_column = [&](const std::string& name, std::unique_ptr<cudf::column> column) {
+        auto& schema_info = table.metadata.schema_info;
+        auto found        = std::find_if(schema_info.begin(), schema_info.end(), [&name](const auto& info) {
+            return info.name == name;
+        });
+
+        if (found != schema_info.end())
+        {
+            LOG(WARNING) << "Replacing the payload column '" << name << "' with Kafka metadata";
+            columns[std::distance(schema_info.begin(), found)] = std::move(column);
+        }
+        else
+        {
+            columns.push_back(std::move(column));
+            schema_info.emplace_back(name);
+        }
+    };
+
+    for (const auto& field : m_record_options.metadata_columns)
+    {
+        const auto name = m_record_options.column_prefix + field;
+
+        if (field == "key")
+        {
+            std::vector<std::optional<std::string>> keys;
+            for (auto* msg : messages)
+            {
+                const auto* key = static_cast<const char*>(msg->key_pointer());
+                keys.push_back(key != nullptr ? std::optional<std::string>(std::string(key, msg->key_len()))
+                                              : std::nullopt);
+            }
+
+            add_column(name, ColumnUtil::make_strings_column(keys));
+        }
+        else if (field == "topic")
+        {
+            std::vector<std::optional<std::string>> topics;
+            for (auto* msg : messages)
+            {
+                topics.emplace_back(msg->topic_name());
+            }
+
+            add_column(name, ColumnUtil::make_strings_column(topics));
+        }
+        else if (field == "partition")
+        {
+            std::vector<std::int32_t> partitions;
+            for (auto* msg : messages)
+            {
+                partitions.push_back(msg->partition());
+            }
+
+            add_column(name, ColumnUtil::make_numeric_column(partitions, cudf::type_id::INT32));
+        }
+        else if (field == "offset")
+        {
+            std::vector<std::int64_t> offsets;
+            for (auto* msg : messages)
+            {
+                offsets.push_back(msg->offset());
+            }
+
+            add_column(name, ColumnUtil::make_numeric_column(offsets, cudf::type_id::INT64));
+        }
+        else if (field == "timestamp")
+        {
+            // Either the time the record was created by the producer or appended to the log by the broker, depending
+            // on the configuration of the topic
+            std::vector<std::int64_t> timestamps;
+            std::vector<bool> valid;
+            for (auto* msg : messages)
+            {
+                auto timestamp = msg->timestamp();
+                timestamps.push_back(timestamp.timestamp);
+                valid.push_back(timestamp.type != RdKafka::MessageTimestamp::MSG_TIMESTAMP_NOT_AVAILABLE);
+            }
+
+            add_column(name,
+                       ColumnUtil::make_numeric_column(timestamps, cudf::type_id::TIMESTAMP_MILLISECONDS, valid));
+        }
+        else if (field == "timestamp_type")
+        {
+            std::vector<std::optional<std::string>> types;
+            for (auto* msg : messages)
+            {
+                switch (msg->timestamp().type)
+                {
+                case RdKafka::MessageTimestamp::MSG_TIMESTAMP_CREATE_TIME:
+                    types.emplace_back("create_time");
+                    break;
+                case RdKafka::MessageTimestamp::MSG_TIMESTAMP_LOG_APPEND_TIME:
+                    types.emplace_back("log_append_time");
+                    break;
+                default:
+                    types.emplace_back(std::nullopt);
+                }
+            }
+
+            add_column(name, ColumnUtil::make_strings_column(types));
+        }
+    }
+
+    for (const auto& header : m_record_options.header_columns)
+    {
+        std::vector<std::optional<std::string>> values;
+        for (auto* msg : messages)
+        {
+            values.push_back(header_value(msg->headers(), header));
+        }
+
+        add_column(m_record_options.column_prefix + "header_" + header, ColumnUtil::make_strings_column(values));
+    }
+
+    table.tbl = std::make_unique<cudf::table>(std::move(columns));
+}
+
 // ************ KafkaStageInterfaceProxy ************ //
 std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> KafkaSourceStageInterfaceProxy::init_with_single_topic(
     mrc::segment::Builder& builder,
@@ -671,9 +998,29 @@ std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> KafkaSourceStageInterfac
     bool disable_pre_filtering,
     std::size_t stop_after,
     bool async_commits,
-    std::optional<pybind11::function> oauth_callback)
+    std::optional<pybind11::function> oauth_callback,
+    std::vector<std::string> metadata_columns,
+    std::vector<std::string> header_columns,
+    std::string column_prefix,
+    std::vector<std::string> key_filter,
+    std::map<std::string, std::vector<std::string>> header_filters,
+    std::string payload_format,
+    std::map<std::int32_t, std::string> schema_files,
+    std::optional<pybind11::function> schema_registry,
+    bool confluent_framing,
+    std::int32_t schema_id,
+    std::string message_name)
 {
     auto oauth_callback_cpp = KafkaSourceStageInterfaceProxy::make_kafka_oauth_callback(std::move(oauth_callback));
+    auto payload_decoder    = KafkaSourceStageInterfaceProxy::make_payload_decoder(
+        payload_format, schema_files, std::move(schema_registry), confluent_framing, schema_id, message_name);
+
+    KafkaRecordOptions record_options;
+    record_options.metadata_columns = std::move(metadata_columns);
+    record_options.header_columns   = std::move(header_columns);
+    record_options.column_prefix    = std::move(column_prefix);
+    record_options.key_filter       = std::move(key_filter);
+    record_options.header_filters   = std::move(header_filters);
 
     auto stage = builder.construct_object<KafkaSourceStage>(name,
                                                             max_batch_size,
@@ -684,7 +1031,9 @@ std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> KafkaSourceStageInterfac
                                                             disable_pre_filtering,
                                                             stop_after,
                                                             async_commits,
-                                                            std::move(oauth_callback_cpp));
+                                                            std::move(oauth_callback_cpp),
+                                                            std::move(record_options),
+                                                            std::move(payload_decoder));
 
     return stage;
 }
@@ -700,9 +1049,29 @@ std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> KafkaSourceStageInterfac
     bool disable_pre_filtering,
     std::size_t stop_after,
     bool async_commits,
-    std::optional<pybind11::function> oauth_callback)
+    std::optional<pybind11::function> oauth_callback,
+    std::vector<std::string> metadata_columns,
+    std::vector<std::string> header_columns,
+    std::string column_prefix,
+    std::vector<std::string> key_filter,
+    std::map<std::string, std::vector<std::string>> header_filters,
+    std::string payload_format,
+    std::map<std::int32_t, std::string> schema_files,
+    std::optional<pybind11::function> schema_registry,
+    bool confluent_framing,
+    std::int32_t schema_id,
+    std::string message_name)
 {
     auto oauth_callback_cpp = KafkaSourceStageInterfaceProxy::make_kafka_oauth_callback(std::move(oauth_callback));
+    auto payload_decoder    = KafkaSourceStageInterfaceProxy::make_payload_decoder(
+        payload_format, schema_files, std::move(schema_registry), confluent_framing, schema_id, message_name);
+
+    KafkaRecordOptions record_options;
+    record_options.metadata_columns = std::move(metadata_columns);
+    record_options.header_columns   = std::move(header_columns);
+    record_options.column_prefix    = std::move(column_prefix);
+    record_options.key_filter       = std::move(key_filter);
+    record_options.header_filters   = std::move(header_filters);
 
     auto stage = builder.construct_object<KafkaSourceStage>(name,
                                                             max_batch_size,
@@ -713,7 +1082,9 @@ std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> KafkaSourceStageInterfac
                                                             disable_pre_filtering,
                                                             stop_after,
                                                             async_commits,
-                                                            std::move(oauth_callback_cpp));
+                                                            std::move(oauth_callback_cpp),
+                                                            std::move(record_options),
+                                                            std::move(payload_decoder));
 
     return stage;
 }
@@ -739,4 +1110,48 @@ std::unique_ptr<KafkaOAuthCallback> KafkaSourceStageInterfaceProxy::make_kafka_o
     });
 }
 
+std::shared_ptr<PayloadDecoder> KafkaSourceStageInterfaceProxy::make_payload_decoder(
+    const std::string& payload_format,
+    const std::map<std::int32_t, std::string>& schema_files,
+    std::optional<pybind11::function>&& schema_registry,
+    bool confluent_framing,
+    std::int32_t schema_id,
+    const std::string& message_name)
+{
+    PayloadDecoderConfig config;
+    config.format = parse_payload_format(payload_format);
+    if (config.format == PayloadFormat::JSON)
+    {
+        return nullptr;
+    }
+
+    config.confluent_framing = confluent_framing;
+    config.schema_id         = schema_id;
+    config.message_name      = message_name;
+
+    std::shared_ptr<SchemaRegistry> registry;
+    if (schema_registry.has_value())
+    {
+        if (!schema_files.empty())
+        {
+            throw std::invalid_argument("Only one of schema_files and schema_registry can be set");
+        }
+
+        registry = std::make_shared<KafkaSourceStage__SchemaRegistry>(
+            mrc::pymrc::PyFuncWrapper(std::move(schema_registry.value())));
+    }
+    else
+    {
+        if (schema_files.empty())
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR(
+                "Payload format '" << payload_format << "' requires either schema_files or a schema_registry"));
+        }
+
+        registry = LocalSchemaRegistry::from_files(schema_files);
+    }
+
+    return std::make_shared<PayloadDecoder>(std::move(config), std::move(registry));
+}
+
 }  // namespace morpheus
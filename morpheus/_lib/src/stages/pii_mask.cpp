@@ -0,0 +1,378 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/pii_mask.hpp"
+
+#include "morpheus/messages/meta.hpp"              // for MessageMeta
+#include "morpheus/objects/table_info.hpp"         // for TableInfo, MutableTableInfo
+#include "morpheus/objects/table_transaction.hpp"  // for TableTransaction
+#include "morpheus/utilities/column_util.hpp"      // for ColumnUtil, HostStringsColumn
+#include "morpheus/utilities/string_util.hpp"      // for MORPHEUS_CONCAT_STR
+
+#include <cudf/copying.hpp>                      // for gather, scatter
+#include <cudf/filling.hpp>                      // for sequence
+#include <cudf/null_mask.hpp>                    // for copy_bitmask
+#include <cudf/scalar/scalar.hpp>                // for numeric_scalar
+#include <cudf/stream_compaction.hpp>            // for apply_boolean_mask
+#include <cudf/strings/contains.hpp>             // for contains_re
+#include <cudf/strings/regex/regex_program.hpp>  // for regex_program
+#include <cudf/strings/replace_re.hpp>           // for replace_re, replace_with_backrefs
+#include <cudf/strings/strings_column_view.hpp>  // for strings_column_view
+#include <cudf/table/table.hpp>                  // for table
+#include <cudf/table/table_view.hpp>             // for table_view
+#include <cudf/types.hpp>                        // for size_type, type_id
+#include <glog/logging.h>                        // for CHECK
+
+#include <algorithm>  // for max
+#include <cctype>     // for isalnum, isalpha, tolower, toupper
+#include <limits>     // for numeric_limits
+#include <stdexcept>  // for invalid_argument
+#include <string_view>
+#include <thread>   // for hardware_concurrency
+#include <utility>  // for move
+
+namespace morpheus {
+
+namespace {
+// Masking threads are only started for batches with at least this many rows per thread
+constexpr std::size_t MinRowsPerThread = 1024;
+
+const char* const DeviceIpv4Octet  = "(?:25[0-5]|2[0-4][0-9]|1[0-9][0-9]|[1-9]?[0-9])";
+const char* const DeviceDnsLabel   = "[A-Za-z0-9](?:[A-Za-z0-9-]*[A-Za-z0-9])?";
+const char* const DeviceCreditCard = "[0-9](?:[ -]?[0-9]){12}";
+
+std::string escape_regex(const std::string& literal)
+{
+    static const std::string_view SpecialChars = R"(\^$.|?*+()[]{})";
+
+    std::string escaped;
+    for (char c : literal)
+    {
+        if (SpecialChars.find(c) != std::string_view::npos)
+        {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+
+    return escaped;
+}
+
+bool is_word_char(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_';
+}
+
+// Case-insensitive alternation of the username keys, the device regex engine has no ignore case flag
+std::string case_insensitive(const std::string& word)
+{
+    std::string pattern;
+    for (char c : word)
+    {
+        if (std::isalpha(static_cast<unsigned char>(c)) != 0)
+        {
+            pattern += MORPHEUS_CONCAT_STR("[" << static_cast<char>(std::tolower(c))
+                                               << static_cast<char>(std::toupper(c)) << "]");
+        }
+        else
+        {
+            pattern.push_back(c);
+        }
+    }
+
+    return pattern;
+}
+
+/**
+ * @brief Masked values of a contiguous range of rows, `lengths` holds the size of each masked value in `chars`
+ */
+struct MaskedChunk
+{
+    std::string chars;
+    std::vector<cudf::size_type> lengths;
+};
+
+}  // namespace
+
+// Component public implementations
+// ************ PiiMaskStage ******************************* //
+PiiMaskStage::PiiMaskStage(std::vector<std::string> columns,
+                           const std::vector<std::string>& entities,
+                           const std::map<std::string, std::string>& literals,
+                           const std::map<std::string, std::string>& patterns,
+                           bool pseudonymize,
+                           const std::string& key,
+                           std::size_t num_threads,
+                           bool use_gpu) :
+  base_t(rxcpp::operators::map([this](sink_type_t x) {
+      return this->on_data(std::move(x));
+  })),
+  m_columns(std::move(columns)),
+  m_masker(entities, literals, patterns, pseudonymize, key),
+  m_credit_card_masker({PiiEntity::CreditCard}),
+  m_num_threads(num_threads == 0 ? std::max(1U, std::thread::hardware_concurrency()) : num_threads),
+  m_use_gpu(use_gpu),
+  m_device_credit_card(false),
+  m_device_username(false)
+{
+    if (!m_use_gpu)
+    {
+        return;
+    }
+
+    if (pseudonymize)
+    {
+        throw std::invalid_argument("Pseudonymization is only supported by the host implementation");
+    }
+
+    // Literals and user patterns come first, at each position cudf replaces the first pattern which matches
+    for (const auto& [literal, label] : literals)
+    {
+        auto pattern = escape_regex(literal);
+        if (!literal.empty() && is_word_char(literal.front()))
+        {
+            pattern = "\\b" + pattern;
+        }
+        if (!literal.empty() && is_word_char(literal.back()))
+        {
+            pattern += "\\b";
+        }
+
+        m_device_patterns.push_back(pattern);
+        m_device_replacements.push_back(m_masker.replacement(label, literal));
+    }
+
+    for (const auto& [pattern, label] : patterns)
+    {
+        m_device_patterns.push_back(pattern);
+        m_device_replacements.push_back(m_masker.replacement(label, ""));
+    }
+
+    for (const auto& entity : entities)
+    {
+        std::string pattern;
+        if (entity == PiiEntity::Email)
+        {
+            pattern = MORPHEUS_CONCAT_STR("[A-Za-z0-9_][A-Za-z0-9._%+-]*@" << DeviceDnsLabel << "(?:\\."
+                                                                           << DeviceDnsLabel << ")*\\.[A-Za-z]{2,}");
+        }
+        else if (entity == PiiEntity::IpAddress)
+        {
+            pattern = MORPHEUS_CONCAT_STR("\\b(?:" << DeviceIpv4Octet << "\\.){3}" << DeviceIpv4Octet
+                                                   << "\\b|(?:[0-9A-Fa-f]{1,4}:){7}[0-9A-Fa-f]{1,4}|"
+                                                   << "(?:[0-9A-Fa-f]{1,4}:){1,7}:(?:[0-9A-Fa-f]{1,4}(?::[0-9A-Fa-f]{1,"
+                                                   << "4}){0,6})?|::(?:[0-9A-Fa-f]{1,4}(?::[0-9A-Fa-f]{1,4}){0,6})?");
+        }
+        else if (entity == PiiEntity::CreditCard)
+        {
+            // Handled separately since the candidates are validated on the host
+            m_device_credit_card = true;
+            continue;
+        }
+        else if (entity == PiiEntity::Hostname)
+        {
+            std::string tlds;
+            for (const auto& tld : PiiUtil::hostname_tlds())
+            {
+                tlds += (tlds.empty() ? "" : "|") + tld;
+            }
+
+            pattern = MORPHEUS_CONCAT_STR("\\b" << DeviceDnsLabel << "(?:\\." << DeviceDnsLabel << ")*\\.(?:" << tlds
+                                                << ")\\b");
+        }
+        else if (entity == PiiEntity::Username)
+        {
+            // Handled separately since only the value following the key is replaced
+            m_device_username = true;
+            continue;
+        }
+
+        m_device_patterns.push_back(pattern);
+        m_device_replacements.push_back(m_masker.replacement(entity, ""));
+    }
+}
+
+std::unique_ptr<cudf::column> PiiMaskStage::mask_host(const cudf::column_view& column) const
+{
+    const auto num_rows = static_cast<std::size_t>(column.size());
+    if (num_rows == 0)
+    {
+        return std::make_unique<cudf::column>(column);
+    }
+
+    const HostStringsColumn strings{column};
+
+    std::vector<MaskedChunk> chunks(ColumnUtil::num_row_chunks(num_rows, m_num_threads, MinRowsPerThread));
+    ColumnUtil::parallel_for_rows(
+        num_rows,
+        m_num_threads,
+        [&](std::size_t index, std::size_t start, std::size_t stop) {
+            auto& chunk = chunks[index];
+            chunk.lengths.reserve(stop - start);
+
+            for (std::size_t row = start; row < stop; ++row)
+            {
+                auto before = chunk.chars.size();
+                m_masker.mask_into(strings.get(row), chunk.chars);
+                chunk.lengths.push_back(static_cast<cudf::size_type>(chunk.chars.size() - before));
+            }
+        },
+        MinRowsPerThread);
+
+    std::string masked_chars;
+    std::vector<cudf::size_type> masked_offsets{0};
+    masked_offsets.reserve(num_rows + 1);
+
+    std::size_t total_size = 0;
+    for (const auto& chunk : chunks)
+    {
+        total_size += chunk.chars.size();
+    }
+
+    CHECK(total_size <= static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()))
+        << "Masked strings column exceeds the maximum size of a cudf strings column";
+
+    masked_chars.reserve(total_size);
+    for (const auto& chunk : chunks)
+    {
+        masked_chars += chunk.chars;
+        for (auto length : chunk.lengths)
+        {
+            masked_offsets.push_back(masked_offsets.back() + length);
+        }
+    }
+
+    // Null rows stay null, their masked value is empty
+    auto masked = ColumnUtil::make_strings_column(masked_chars, masked_offsets);
+    masked->set_null_mask(cudf::copy_bitmask(column), column.null_count());
+
+    return masked;
+}
+
+std::unique_ptr<cudf::column> PiiMaskStage::mask_device(const cudf::column_view& column) const
+{
+    std::unique_ptr<cudf::column> result = std::make_unique<cudf::column>(column);
+
+    if (!m_device_patterns.empty())
+    {
+        auto replacements = ColumnUtil::make_strings_column(m_device_replacements);
+        result            = cudf::strings::replace_re(cudf::strings_column_view{result->view()},
+                                           m_device_patterns,
+                                           cudf::strings_column_view{replacements->view()});
+    }
+
+    if (m_device_credit_card)
+    {
+        result = mask_device_credit_cards(result->view());
+    }
+
+    if (m_device_username)
+    {
+        std::string keys;
+        for (const auto& key : PiiUtil::username_keys())
+        {
+            keys += (keys.empty() ? "" : "|") + case_insensitive(key);
+        }
+
+        auto prog = cudf::strings::regex_program::create(
+            MORPHEUS_CONCAT_STR("(\\b(?:" << keys << ") *[=:] *[\"']?)[^\\s\"',;&|]+"));
+        result = cudf::strings::replace_with_backrefs(
+            cudf::strings_column_view{result->view()}, *prog, "\\1" + m_masker.replacement(PiiEntity::Username, ""));
+    }
+
+    return result;
+}
+
+std::unique_ptr<cudf::column> PiiMaskStage::mask_device_credit_cards(const cudf::column_view& column) const
+{
+    // Only the rows holding a run of at least 13 digits can hold a card number. These rows are few compared to the
+    // column, they are masked on the host where the candidates are checked and scattered back into the column.
+    auto prog          = cudf::strings::regex_program::create(DeviceCreditCard);
+    auto has_candidate = cudf::strings::contains_re(cudf::strings_column_view{column}, *prog);
+
+    auto zero       = cudf::numeric_scalar<cudf::size_type>(0);
+    auto row_ids    = cudf::sequence(column.size(), zero);
+    auto selected   = cudf::apply_boolean_mask(cudf::table_view({row_ids->view()}), has_candidate->view());
+    const auto rows = selected->get_column(0).view();
+    if (rows.size() == 0)
+    {
+        return std::make_unique<cudf::column>(column);
+    }
+
+    auto candidates = cudf::gather(cudf::table_view({column}), rows);
+    const HostStringsColumn strings{candidates->get_column(0).view()};
+
+    std::string masked_chars;
+    std::vector<cudf::size_type> masked_offsets{0};
+    masked_offsets.reserve(strings.size() + 1);
+    for (std::size_t row = 0; row < strings.size(); ++row)
+    {
+        m_credit_card_masker.mask_into(strings.get(row), masked_chars);
+        masked_offsets.push_back(static_cast<cudf::size_type>(masked_chars.size()));
+    }
+
+    auto masked    = ColumnUtil::make_strings_column(masked_chars, masked_offsets);
+    auto scattered = cudf::scatter(cudf::table_view({masked->view()}), rows, cudf::table_view({column}));
+
+    return std::move(scattered->release().front());
+}
+
+PiiMaskStage::source_type_t PiiMaskStage::on_data(sink_type_t x)
+{
+    auto payload = x->payload();
+
+    TableTransaction transaction;
+
+    {
+        auto info = payload->get_info(m_columns);
+
+        for (cudf::size_type i = 0; i < info.num_columns(); ++i)
+        {
+            const auto& column = info.get_column(i);
+            if (column.type().id() != cudf::type_id::STRING)
+            {
+                throw std::invalid_argument(MORPHEUS_CONCAT_STR("PII masking requires string columns, column '"
+                                                                << m_columns[i] << "' is not"));
+            }
+
+            transaction.replace_column(m_columns[i], m_use_gpu ? mask_device(column) : mask_host(column));
+        }
+    }
+
+    payload->get_mutable_info().commit(std::move(transaction));
+
+    return x;
+}
+
+// ************ PiiMaskStageInterfaceProxy ***************** //
+std::shared_ptr<mrc::segment::Object<PiiMaskStage>> PiiMaskStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::vector<std::string> columns,
+    const std::vector<std::string>& entities,
+    const std::map<std::string, std::string>& literals,
+    const std::map<std::string, std::string>& patterns,
+    bool pseudonymize,
+    const std::string& key,
+    std::size_t num_threads,
+    bool use_gpu)
+{
+    return builder.construct_object<PiiMaskStage>(
+        name, std::move(columns), entities, literals, patterns, pseudonymize, key, num_threads, use_gpu);
+}
+
+}  // namespace morpheus
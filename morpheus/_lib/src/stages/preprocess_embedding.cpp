@@ -0,0 +1,298 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/preprocess_embedding.hpp"
+
+#include "morpheus/messages/memory/tensor_memory.hpp"  // for TensorMemory
+#include "morpheus/messages/meta.hpp"                  // for MessageMeta
+#include "morpheus/objects/table_info.hpp"             // for TableInfo
+#include "morpheus/objects/tensor.hpp"                 // for Tensor
+#include "morpheus/objects/tensor_object.hpp"          // for TensorObject
+#include "morpheus/utilities/bucket_util.hpp"          // for BucketUtil
+#include "morpheus/utilities/column_util.hpp"          // for ColumnUtil
+#include "morpheus/utilities/dedup_util.hpp"           // for DedupUtil
+#include "morpheus/utilities/string_util.hpp"          // for MORPHEUS_CONCAT_STR
+
+#include <cuda_runtime.h>                         // for cudaMemcpy
+#include <cudf/aggregation.hpp>                   // for make_sum_aggregation, segmented_reduce_aggregation
+#include <cudf/column/column.hpp>                 // for column
+#include <cudf/column/column_factories.hpp>       // for make_column_from_scalar
+#include <cudf/column/column_view.hpp>            // for column_view
+#include <cudf/filling.hpp>                       // for sequence
+#include <cudf/io/types.hpp>                      // for table_with_metadata, table_metadata
+#include <cudf/reduction.hpp>                     // for segmented_reduce
+#include <cudf/scalar/scalar.hpp>                 // for numeric_scalar
+#include <cudf/table/table.hpp>                   // for table
+#include <cudf/table/table_view.hpp>              // for table_view
+#include <cudf/types.hpp>                         // for type_id, data_type, null_policy
+#include <cudf/utilities/span.hpp>                // for device_span
+#include <cudf/utilities/type_dispatcher.hpp>     // for type_to_id
+#include <glog/logging.h>                         // for CHECK
+#include <mrc/cuda/common.hpp>                    // for MRC_CHECK_CUDA
+#include <nvtext/normalize.hpp>                   // for normalize_spaces
+#include <rmm/cuda_stream_view.hpp>               // for cuda_stream_per_thread
+#include <rmm/device_buffer.hpp>                  // for device_buffer
+#include <rmm/mr/device/per_device_resource.hpp>  // for get_current_device_resource
+
+#include <algorithm>  // for find, max
+#include <cstdint>    // for int64_t, uint32_t
+#include <exception>  // for exception_ptr
+#include <iterator>   // for distance
+#include <stdexcept>  // for invalid_argument
+#include <utility>    // for move
+#include <vector>     // for vector
+
+namespace morpheus {
+
+namespace {
+template <typename T>
+TensorObject make_tensor(const std::vector<T>& values, ShapeType shape)
+{
+    auto buffer = std::make_shared<rmm::device_buffer>(
+        values.data(), values.size() * sizeof(T), rmm::cuda_stream_per_thread);
+
+    return Tensor::create(std::move(buffer), DType::create<T>(), std::move(shape), {}, 0);
+}
+}  // namespace
+
+// Component public implementations
+// ************ PreprocessEmbeddingStage ******************** //
+PreprocessEmbeddingStage::PreprocessEmbeddingStage(std::string vocab_hash_file,
+                                                   TensorIndex max_length,
+                                                   bool do_lower_case,
+                                                   std::vector<TensorIndex> bucket_lengths,
+                                                   TensorIndex batch_size,
+                                                   std::string column,
+                                                   std::string row_index_column,
+                                                   TypeId input_ids_type,
+                                                   TypeId input_mask_type) :
+  base_t(base_t::op_factory_from_sub_fn(build_operator())),
+  m_vocab_hash_file(std::move(vocab_hash_file)),
+  m_max_length(max_length),
+  m_do_lower_case(do_lower_case),
+  m_bucket_lengths(BucketUtil::normalize_bucket_lengths(std::move(bucket_lengths), max_length)),
+  m_batch_size(batch_size),
+  m_column(std::move(column)),
+  m_row_index_column(std::move(row_index_column)),
+  m_input_ids_dtype(input_ids_type),
+  m_input_mask_dtype(input_mask_type)
+{
+    CHECK(m_batch_size >= 0) << "batch_size must not be negative";
+    CHECK(m_input_ids_dtype.is_integral()) << "input_ids_type must be an integral type";
+    CHECK(m_input_mask_dtype.is_integral()) << "input_mask_type must be an integral type";
+
+    m_vocab = nvtext::load_vocabulary_file(m_vocab_hash_file);
+}
+
+PreprocessEmbeddingStage::subscribe_fn_t PreprocessEmbeddingStage::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t x) {
+                this->on_data(std::move(x), output);
+            },
+            [&](std::exception_ptr error_ptr) {
+                output.on_error(error_ptr);
+            },
+            [&]() {
+                output.on_completed();
+            }));
+    };
+}
+
+std::pair<TensorObject, TensorObject> PreprocessEmbeddingStage::tokenize(const cudf::strings_column_view& strings) const
+{
+    const auto num_rows = static_cast<TensorIndex>(strings.size());
+    const auto shape    = ShapeType{num_rows, m_max_length};
+
+    // remove leading and trailing whitespace
+    auto normalized      = nvtext::normalize_spaces(strings);
+    auto normalized_view = cudf::strings_column_view{normalized->view()};
+
+    // The tokenizer fails when none of the strings contain any characters, every row is then an empty sequence
+    if (normalized_view.chars_size(rmm::cuda_stream_per_thread) == 0)
+    {
+        auto zero = cudf::numeric_scalar<std::uint32_t>(0, true, rmm::cuda_stream_per_thread);
+        auto ids  = cudf::make_column_from_scalar(zero, num_rows * m_max_length)->release();
+        auto mask = cudf::make_column_from_scalar(zero, num_rows * m_max_length)->release();
+
+        return {Tensor::create(std::move(ids.data), DType::create<std::uint32_t>(), shape, {}, 0),
+                Tensor::create(std::move(mask.data), DType::create<std::uint32_t>(), shape, {}, 0)};
+    }
+
+    // With truncation each string produces exactly one sequence, so the stride is unused
+    auto token_results = nvtext::subword_tokenize(normalized_view,
+                                                  *m_vocab,
+                                                  static_cast<std::uint32_t>(m_max_length),
+                                                  static_cast<std::uint32_t>(m_max_length),
+                                                  m_do_lower_case,
+                                                  true,
+                                                  rmm::mr::get_current_device_resource());
+
+    CHECK(token_results.nrows_tensor == static_cast<std::uint32_t>(strings.size()))
+        << "Expected one sequence per row, got " << token_results.nrows_tensor << " for " << strings.size() << " rows";
+
+    auto ids  = token_results.tensor_token_ids->release();
+    auto mask = token_results.tensor_attention_mask->release();
+
+    return {Tensor::create(std::move(ids.data), DType::create<std::uint32_t>(), shape, {}, 0),
+            Tensor::create(std::move(mask.data), DType::create<std::uint32_t>(), shape, {}, 0)};
+}
+
+std::vector<TensorIndex> PreprocessEmbeddingStage::sequence_lengths(const TensorObject& attention_mask) const
+{
+    const auto num_rows = attention_mask.shape(0);
+
+    // Sequences are padded at the end, the number of tokens of each row is the sum of its mask
+    auto mask_view = cudf::column_view(cudf::data_type{cudf::type_id::UINT32},
+                                       num_rows * m_max_length,
+                                       attention_mask.data(),
+                                       nullptr,
+                                       0);
+    auto offsets   = cudf::sequence(num_rows + 1,
+                                  cudf::numeric_scalar<cudf::size_type>(0),
+                                  cudf::numeric_scalar<cudf::size_type>(m_max_length));
+
+    auto device_lengths =
+        cudf::segmented_reduce(mask_view,
+                               cudf::device_span<const cudf::size_type>(offsets->view().data<cudf::size_type>(),
+                                                                        static_cast<std::size_t>(num_rows + 1)),
+                               *cudf::make_sum_aggregation<cudf::segmented_reduce_aggregation>(),
+                               cudf::data_type{cudf::type_to_id<TensorIndex>()},
+                               cudf::null_policy::EXCLUDE);
+
+    std::vector<TensorIndex> lengths(num_rows);
+    MRC_CHECK_CUDA(cudaMemcpy(lengths.data(),
+                              device_lengths->view().data<TensorIndex>(),
+                              lengths.size() * sizeof(TensorIndex),
+                              cudaMemcpyDeviceToHost));
+
+    return lengths;
+}
+
+void PreprocessEmbeddingStage::on_data(sink_type_t x, rxcpp::subscriber<source_type_t>& output)
+{
+    auto info         = x->payload()->get_info();
+    auto column_names = info.get_column_names();
+
+    auto found = std::find(column_names.begin(), column_names.end(), m_column);
+    if (found == column_names.end())
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Column '" << m_column << "' not found"));
+    }
+
+    if (std::find(column_names.begin(), column_names.end(), m_row_index_column) != column_names.end())
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Output column '" << m_row_index_column << "' already exists"));
+    }
+
+    const auto& text = info.get_column(static_cast<cudf::size_type>(std::distance(column_names.begin(), found)));
+    if (text.type().id() != cudf::type_id::STRING)
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Embedding preprocessing requires a string column, column '"
+                                                        << m_column << "' is not"));
+    }
+
+    const auto num_rows = static_cast<TensorIndex>(info.num_rows());
+    if (num_rows == 0)
+    {
+        return;
+    }
+
+    // Only the number of tokens of each row is copied to the host, to build the buckets
+    auto [token_ids, attention_mask] = tokenize(cudf::strings_column_view{text});
+    auto lengths                     = sequence_lengths(attention_mask);
+
+    std::vector<cudf::column_view> views;
+    for (cudf::size_type i = 0; i < info.num_columns(); ++i)
+    {
+        views.push_back(info.get_column(i));
+    }
+
+    cudf::table_view table{views};
+
+    for (const auto& bucket : BucketUtil::make_buckets(lengths, m_bucket_lengths, m_batch_size))
+    {
+        const auto bucket_rows = static_cast<TensorIndex>(bucket.rows.size());
+        const auto padded      = bucket.padded_length;
+
+        std::vector<TensorIndex> seq_ids(bucket_rows * 3);
+        for (TensorIndex i = 0; i < bucket_rows; ++i)
+        {
+            seq_ids[i * 3]     = i;
+            seq_ids[i * 3 + 1] = 0;
+            seq_ids[i * 3 + 2] = std::max<TensorIndex>(lengths[bucket.rows[i]] - 1, 0);
+        }
+
+        // Every token of the rows is within their first `padded` values, the rest is padding
+        auto bucket_ids  = DedupUtil::gather_tensor_rows(token_ids.slice({0, 0}, {num_rows, padded}), bucket.rows);
+        auto bucket_mask = DedupUtil::gather_tensor_rows(attention_mask.slice({0, 0}, {num_rows, padded}), bucket.rows);
+
+        auto memory = std::make_shared<TensorMemory>(bucket_rows);
+        memory->set_tensor("input_ids", bucket_ids.as_type(m_input_ids_dtype));
+        memory->set_tensor("input_mask", bucket_mask.as_type(m_input_mask_dtype));
+        memory->set_tensor("seq_ids", make_tensor(seq_ids, {bucket_rows, 3}));
+
+        auto columns = DedupUtil::gather_rows(table, bucket.rows)->release();
+        cudf::io::table_metadata metadata;
+        for (const auto& name : column_names)
+        {
+            metadata.schema_info.emplace_back(name);
+        }
+
+        // The row index column is INT64, widen the row positions rather than viewing them as such
+        std::vector<std::int64_t> row_index(bucket.rows.begin(), bucket.rows.end());
+        columns.push_back(ColumnUtil::make_numeric_column(row_index, cudf::type_id::INT64));
+        metadata.schema_info.emplace_back(m_row_index_column);
+
+        // Copies the config and metadata of the incoming message, but not the payload
+        auto message = std::make_shared<ControlMessage>(*x);
+        message->payload(MessageMeta::create_from_cpp(
+            cudf::io::table_with_metadata{std::make_unique<cudf::table>(std::move(columns)), std::move(metadata)}, 0));
+        message->tensors(memory);
+
+        output.on_next(std::move(message));
+    }
+}
+
+// ************ PreprocessEmbeddingStageInterfaceProxy ****** //
+std::shared_ptr<mrc::segment::Object<PreprocessEmbeddingStage>> PreprocessEmbeddingStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::string vocab_hash_file,
+    TensorIndex max_length,
+    bool do_lower_case,
+    std::vector<TensorIndex> bucket_lengths,
+    TensorIndex batch_size,
+    std::string column,
+    std::string row_index_column,
+    TypeId input_ids_type,
+    TypeId input_mask_type)
+{
+    return builder.construct_object<PreprocessEmbeddingStage>(name,
+                                                              std::move(vocab_hash_file),
+                                                              max_length,
+                                                              do_lower_case,
+                                                              std::move(bucket_lengths),
+                                                              batch_size,
+                                                              std::move(column),
+                                                              std::move(row_index_column),
+                                                              input_ids_type,
+                                                              input_mask_type);
+}
+
+}  // namespace morpheus
@@ -31,13 +31,17 @@
 #include "morpheus/objects/tensor.hpp"                        // for Tensor
 #include "morpheus/objects/tensor_object.hpp"                 // for TensorObject
 #include "morpheus/types.hpp"                                 // for TensorIndex
+#include "morpheus/utilities/dedup_util.hpp"                  // for DedupUtil
 #include "morpheus/utilities/matx_util.hpp"                   // for MatxUtil
 
 #include <cuda_runtime.h>               // for cudaMemcpy, cudaMemcpyKind
 #include <cudf/column/column.hpp>       // for column
 #include <cudf/column/column_view.hpp>  // for column_view
+#include <cudf/table/table.hpp>         // for table
+#include <cudf/table/table_view.hpp>    // for table_view
 #include <cudf/types.hpp>               // for type_id, data_type
 #include <cudf/unary.hpp>               // for cast
+#include <glog/logging.h>               // for CHECK
 #include <mrc/cuda/common.hpp>          // for __check_cuda_errors, MRC_CHECK_CUDA
 #include <mrc/segment/builder.hpp>      // for Builder
 #include <pybind11/gil.h>               // for gil_scoped_acquire
@@ -56,12 +60,33 @@ namespace morpheus {
 // Component public implementations
 // ************ PreprocessFILStage ************************* //
 template <typename InputT, typename OutputT>
-PreprocessFILStage<InputT, OutputT>::PreprocessFILStage(const std::vector<std::string>& features) :
+PreprocessFILStage<InputT, OutputT>::PreprocessFILStage(const std::vector<std::string>& features,
+                                                        TypeId input_type) :
   base_t(rxcpp::operators::map([this](sink_type_t x) {
       return this->on_data(std::move(x));
   })),
-  m_fea_cols(std::move(features))
-{}
+  m_fea_cols(std::move(features)),
+  m_input_dtype(input_type)
+{
+    CHECK(m_input_dtype.type_id() == TypeId::FLOAT16 || m_input_dtype.type_id() == TypeId::FLOAT32 ||
+          m_input_dtype.type_id() == TypeId::FLOAT64)
+        << "input_type must be a floating point type";
+}
+
+template <typename InputT, typename OutputT>
+std::shared_ptr<rmm::device_buffer> PreprocessFILStage<InputT, OutputT>::cast_input(
+    std::shared_ptr<rmm::device_buffer> input, TensorIndex num_rows)
+{
+    if (m_input_dtype.type_id() == TypeId::FLOAT32)
+    {
+        return input;
+    }
+
+    const auto fea_len = static_cast<TensorIndex>(m_fea_cols.size());
+
+    return MatxUtil::cast(DevMemInfo{std::move(input), TypeId::FLOAT32, {num_rows, fea_len}, {fea_len, 1}},
+                          m_input_dtype.type_id());
+}
 
 template <typename InputT, typename OutputT>
 void PreprocessFILStage<InputT, OutputT>::transform_bad_columns(std::vector<std::string>& fea_cols,
@@ -205,8 +230,11 @@ std::shared_ptr<MultiInferenceMessage> PreprocessFILStage<MultiMessage, MultiInf
                                                           {x->mess_count, 1}});
 
     // Create the tensor which will be row-major and size [row_count, fea_len]
-    auto input__0 = Tensor::create(
-        transposed_data, DType::create<float>(), {x->mess_count, static_cast<TensorIndex>(m_fea_cols.size())}, {}, 0);
+    auto input__0 = Tensor::create(cast_input(std::move(transposed_data), x->mess_count),
+                                   m_input_dtype,
+                                   {x->mess_count, static_cast<TensorIndex>(m_fea_cols.size())},
+                                   {},
+                                   0);
 
     auto seq_id_dtype = DType::create<TensorIndex>();
     auto seq_ids      = Tensor::create(
@@ -231,15 +259,29 @@ std::shared_ptr<ControlMessage> PreprocessFILStage<ControlMessage, ControlMessag
     std::shared_ptr<ControlMessage> x)
 
 {
-    auto df_meta        = this->fix_bad_columns(x);
-    const auto num_rows = df_meta.num_rows();
+    auto df_meta = this->fix_bad_columns(x);
+
+    // When the payload has been deduplicated only the first occurrence of each row is sent to inference
+    auto dedup_index = DedupUtil::read_index(*x->payload());
+    std::vector<TensorIndex> unique_rows;
+    std::unique_ptr<cudf::table> unique_table;
+    cudf::table_view features = df_meta.get_view();
+
+    if (dedup_index.has_value() && dedup_index->has_duplicates())
+    {
+        unique_rows  = dedup_index->unique_rows();
+        unique_table = DedupUtil::gather_rows(features, unique_rows);
+        features     = unique_table->view();
+    }
+
+    const TensorIndex num_rows = features.num_rows();
 
     auto packed_data =
         std::make_shared<rmm::device_buffer>(m_fea_cols.size() * num_rows * sizeof(float), rmm::cuda_stream_per_thread);
 
-    for (size_t i = 0; i < df_meta.num_columns(); ++i)
+    for (cudf::size_type i = 0; i < features.num_columns(); ++i)
     {
-        auto curr_col = df_meta.get_column(i);
+        auto curr_col = features.column(i);
         auto curr_ptr = static_cast<float*>(packed_data->data()) + i * num_rows;
 
         // Check if we are something other than float
@@ -264,8 +306,11 @@ std::shared_ptr<ControlMessage> PreprocessFILStage<ControlMessage, ControlMessag
         packed_data, TypeId::FLOAT32, {static_cast<TensorIndex>(m_fea_cols.size()), num_rows}, {num_rows, 1}});
 
     // Create the tensor which will be row-major and size [row_count, fea_len]
-    auto input__0 = Tensor::create(
-        transposed_data, DType::create<float>(), {num_rows, static_cast<TensorIndex>(m_fea_cols.size())}, {}, 0);
+    auto input__0 = Tensor::create(cast_input(std::move(transposed_data), num_rows),
+                                   m_input_dtype,
+                                   {num_rows, static_cast<TensorIndex>(m_fea_cols.size())},
+                                   {},
+                                   0);
 
     auto seq_id_dtype = DType::create<TensorIndex>();
     auto seq_ids      = Tensor::create(
@@ -275,6 +320,11 @@ std::shared_ptr<ControlMessage> PreprocessFILStage<ControlMessage, ControlMessag
         {},
         0);
 
+    if (!unique_rows.empty())
+    {
+        DedupUtil::remap_seq_ids(seq_ids, unique_rows);
+    }
+
     // Build the results
     auto memory = std::make_shared<TensorMemory>(num_rows);
     memory->set_tensor("input__0", std::move(input__0));
@@ -289,17 +339,23 @@ template class PreprocessFILStage<ControlMessage, ControlMessage>;
 
 // ************ PreprocessFILStageInterfaceProxy *********** //
 std::shared_ptr<mrc::segment::Object<PreprocessFILStageMM>> PreprocessFILStageInterfaceProxy::init_multi(
-    mrc::segment::Builder& builder, const std::string& name, const std::vector<std::string>& features)
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    const std::vector<std::string>& features,
+    TypeId input_type)
 {
-    auto stage = builder.construct_object<PreprocessFILStageMM>(name, features);
+    auto stage = builder.construct_object<PreprocessFILStageMM>(name, features, input_type);
 
     return stage;
 }
 
 std::shared_ptr<mrc::segment::Object<PreprocessFILStageCM>> PreprocessFILStageInterfaceProxy::init_cm(
-    mrc::segment::Builder& builder, const std::string& name, const std::vector<std::string>& features)
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    const std::vector<std::string>& features,
+    TypeId input_type)
 {
-    auto stage = builder.construct_object<PreprocessFILStageCM>(name, features);
+    auto stage = builder.construct_object<PreprocessFILStageCM>(name, features, input_type);
 
     return stage;
 }
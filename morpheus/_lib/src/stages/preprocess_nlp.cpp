@@ -30,18 +30,23 @@
 #include "morpheus/objects/table_info.hpp"                // for TableInfo
 #include "morpheus/objects/tensor.hpp"                    // for Tensor
 #include "morpheus/types.hpp"                             // for TensorIndex
+#include "morpheus/utilities/dedup_util.hpp"              // for DedupUtil
 #include "morpheus/utilities/matx_util.hpp"               // for MatxUtil
+#include "morpheus/utilities/string_util.hpp"             // for MORPHEUS_CONCAT_STR
 
 #include <cudf/column/column.hpp>                 // for column
 #include <cudf/column/column_factories.hpp>       // for make_column_from_scalar
 #include <cudf/column/column_view.hpp>            // for column_view
 #include <cudf/filling.hpp>                       // for sequence
+#include <cudf/reduction.hpp>                     // for minmax
 #include <cudf/reshape.hpp>                       // for interleave_columns
 #include <cudf/scalar/scalar.hpp>                 // for numeric_scalar
 #include <cudf/strings/strings_column_view.hpp>   // for strings_column_view
+#include <cudf/table/table.hpp>                   // for table
 #include <cudf/table/table_view.hpp>              // for table_view
 #include <cudf/types.hpp>                         // for type_id, data_type
 #include <cudf/unary.hpp>                         // for cast
+#include <glog/logging.h>                         // for CHECK
 #include <mrc/segment/builder.hpp>                // for Builder
 #include <nvtext/normalize.hpp>                   // for normalize_spaces
 #include <nvtext/subword_tokenize.hpp>            // for tokenizer_result, load_vocabulary_file, subword_tok...
@@ -49,13 +54,56 @@
 #include <rmm/device_buffer.hpp>                  // for device_buffer
 #include <rmm/mr/device/per_device_resource.hpp>  // for get_current_device_resource
 
-#include <cstdint>      // for uint32_t, int32_t
+#include <cstdint>      // for uint32_t, int32_t, uint64_t
+#include <limits>       // for numeric_limits
 #include <memory>       // for shared_ptr, unique_ptr, __shared_ptr_access, make_s...
+#include <stdexcept>    // for invalid_argument
 #include <type_traits>  // for is_same_v
 #include <utility>      // for move
 #include <vector>       // for vector
 
 namespace morpheus {
+namespace {
+// The tokenizer produces uint32 token ids, casting them to an input_ids type narrower than 32 bits would silently wrap
+// any id past its range, such as the ids of a vocabulary with more than 32767 entries with int16
+void check_token_ids_fit(const cudf::column_view& token_ids, const DType& input_ids_dtype)
+{
+    std::uint64_t max_limit = 0;
+    switch (input_ids_dtype.type_id())
+    {
+    case TypeId::INT8:
+        max_limit = std::numeric_limits<int8_t>::max();
+        break;
+    case TypeId::INT16:
+        max_limit = std::numeric_limits<int16_t>::max();
+        break;
+    case TypeId::UINT8:
+        max_limit = std::numeric_limits<uint8_t>::max();
+        break;
+    case TypeId::UINT16:
+        max_limit = std::numeric_limits<uint16_t>::max();
+        break;
+    default:
+        return;
+    }
+
+    if (token_ids.is_empty())
+    {
+        return;
+    }
+
+    auto [min_id, max_id] = cudf::minmax(token_ids);
+    const auto max_value  = static_cast<cudf::numeric_scalar<uint32_t>&>(*max_id).value();
+
+    if (max_value > max_limit)
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Token id " << max_value << " does not fit in input_ids_type "
+                                                                    << input_ids_dtype.name()
+                                                                    << ", use a wider type for this vocabulary"));
+    }
+}
+}  // namespace
+
 // Component public implementations
 // ************ PreprocessNLPStage ************************* //
 template <typename InputT, typename OutputT>
@@ -65,7 +113,9 @@ PreprocessNLPStage<InputT, OutputT>::PreprocessNLPStage(std::string vocab_hash_f
                                                         bool do_lower_case,
                                                         bool add_special_token,
                                                         int stride,
-                                                        std::string column) :
+                                                        std::string column,
+                                                        TypeId input_ids_type,
+                                                        TypeId input_mask_type) :
   base_t(rxcpp::operators::map([this](sink_type_t x) {
       return this->on_data(std::move(x));
   })),
@@ -74,8 +124,14 @@ PreprocessNLPStage<InputT, OutputT>::PreprocessNLPStage(std::string vocab_hash_f
   m_truncation(truncation),
   m_do_lower_case(do_lower_case),
   m_add_special_token(add_special_token),
-  m_column(std::move(column))
+  m_column(std::move(column)),
+  m_input_ids_dtype(input_ids_type),
+  m_input_mask_dtype(input_mask_type)
 {
+    // Token ids and masks are small non-negative integers, allowing them to be stored in a narrower type than int32
+    CHECK(m_input_ids_dtype.is_integral()) << "input_ids_type must be an integral type";
+    CHECK(m_input_mask_dtype.is_integral()) << "input_mask_type must be an integral type";
+
     // Auto calc stride to be 75% of sequence length
     if (stride < 0)
     {
@@ -125,23 +181,27 @@ std::shared_ptr<MultiInferenceMessage> PreprocessNLPStage<MultiMessage, MultiInf
     // Build the results
     auto memory = std::make_shared<InferenceMemory>(token_results.nrows_tensor);
 
+    check_token_ids_fit(token_results.tensor_token_ids->view(), m_input_ids_dtype);
+
     TensorIndex length = token_results.tensor_token_ids->size() / token_results.sequence_length;
     auto input_ids_released =
-        cudf::cast(token_results.tensor_token_ids->view(), cudf::data_type(cudf::type_id::INT32))->release();
+        cudf::cast(token_results.tensor_token_ids->view(), cudf::data_type(m_input_ids_dtype.cudf_type_id()))
+            ->release();
 
     memory->set_tensor("input_ids",
                        Tensor::create(std::move(input_ids_released.data),
-                                      DType::create<int32_t>(),
+                                      m_input_ids_dtype,
                                       {length, static_cast<TensorIndex>(token_results.sequence_length)},
                                       {},
                                       0));
 
     length = token_results.tensor_attention_mask->size() / token_results.sequence_length;
     auto input_mask_released =
-        cudf::cast(token_results.tensor_attention_mask->view(), cudf::data_type(cudf::type_id::INT32))->release();
+        cudf::cast(token_results.tensor_attention_mask->view(), cudf::data_type(m_input_mask_dtype.cudf_type_id()))
+            ->release();
     memory->set_tensor("input_mask",
                        Tensor::create(std::move(input_mask_released.data),
-                                      DType::create<int32_t>(),
+                                      m_input_mask_dtype,
                                       {length, static_cast<TensorIndex>(token_results.sequence_length)},
                                       {},
                                       0));
@@ -176,7 +236,20 @@ std::shared_ptr<ControlMessage> PreprocessNLPStage<ControlMessage, ControlMessag
     // Convert to string view
     auto meta = x->payload()->get_info(this->m_column);
 
-    auto col        = meta.get_column(0);
+    auto col = meta.get_column(0);
+
+    // When the payload has been deduplicated only tokenize the first occurrence of each row
+    auto dedup_index = DedupUtil::read_index(*x->payload());
+    std::vector<TensorIndex> unique_rows;
+    std::unique_ptr<cudf::table> unique_table;
+
+    if (dedup_index.has_value() && dedup_index->has_duplicates())
+    {
+        unique_rows  = dedup_index->unique_rows();
+        unique_table = DedupUtil::gather_rows(meta.get_view(), unique_rows);
+        col          = unique_table->get_column(0).view();
+    }
+
     auto string_col = cudf::strings_column_view{col};
 
     auto token_results = subword_tokenize(this->m_vocab_hash_file,
@@ -190,22 +263,26 @@ std::shared_ptr<ControlMessage> PreprocessNLPStage<ControlMessage, ControlMessag
     // Build the results
     auto memory = std::make_shared<TensorMemory>(token_results.nrows_tensor);
 
+    check_token_ids_fit(token_results.tensor_token_ids->view(), m_input_ids_dtype);
+
     TensorIndex length = token_results.tensor_token_ids->size() / token_results.sequence_length;
     auto input_ids_released =
-        cudf::cast(token_results.tensor_token_ids->view(), cudf::data_type(cudf::type_id::INT32))->release();
+        cudf::cast(token_results.tensor_token_ids->view(), cudf::data_type(m_input_ids_dtype.cudf_type_id()))
+            ->release();
     memory->set_tensor("input_ids",
                        Tensor::create(std::move(input_ids_released.data),
-                                      DType::create<int32_t>(),
+                                      m_input_ids_dtype,
                                       {length, static_cast<TensorIndex>(token_results.sequence_length)},
                                       {},
                                       0));
 
     length = token_results.tensor_attention_mask->size() / token_results.sequence_length;
     auto input_mask_released =
-        cudf::cast(token_results.tensor_attention_mask->view(), cudf::data_type(cudf::type_id::INT32))->release();
+        cudf::cast(token_results.tensor_attention_mask->view(), cudf::data_type(m_input_mask_dtype.cudf_type_id()))
+            ->release();
     memory->set_tensor("input_mask",
                        Tensor::create(std::move(input_mask_released.data),
-                                      DType::create<int32_t>(),
+                                      m_input_mask_dtype,
                                       {length, static_cast<TensorIndex>(token_results.sequence_length)},
                                       {},
                                       0));
@@ -218,7 +295,15 @@ std::shared_ptr<ControlMessage> PreprocessNLPStage<ControlMessage, ControlMessag
 
     std::shared_ptr<rmm::device_buffer> seq_ids_data = std::move(seq_ids_released.data);
 
-    memory->set_tensor("seq_ids", Tensor::create(seq_ids_data, tensor_index_dtype, {length, 3}, {}, 0));
+    auto seq_ids = Tensor::create(seq_ids_data, tensor_index_dtype, {length, 3}, {}, 0);
+
+    if (!unique_rows.empty())
+    {
+        // Point each sequence at the row in the payload it was tokenized from
+        DedupUtil::remap_seq_ids(seq_ids, unique_rows);
+    }
+
+    memory->set_tensor("seq_ids", std::move(seq_ids));
 
     auto next = x;
     next->tensors(memory);
@@ -292,10 +377,21 @@ std::shared_ptr<mrc::segment::Object<PreprocessNLPStageMM>> PreprocessNLPStageIn
     bool do_lower_case,
     bool add_special_token,
     int stride,
-    std::string column)
+    std::string column,
+    TypeId input_ids_type,
+    TypeId input_mask_type)
 {
     auto stage = builder.construct_object<PreprocessNLPStageMM>(
-        name, vocab_hash_file, sequence_length, truncation, do_lower_case, add_special_token, stride, column);
+        name,
+        vocab_hash_file,
+        sequence_length,
+        truncation,
+        do_lower_case,
+        add_special_token,
+        stride,
+        column,
+        input_ids_type,
+        input_mask_type);
 
     return stage;
 }
@@ -309,10 +405,21 @@ std::shared_ptr<mrc::segment::Object<PreprocessNLPStageCM>> PreprocessNLPStageIn
     bool do_lower_case,
     bool add_special_token,
     int stride,
-    std::string column)
+    std::string column,
+    TypeId input_ids_type,
+    TypeId input_mask_type)
 {
     auto stage = builder.construct_object<PreprocessNLPStageCM>(
-        name, vocab_hash_file, sequence_length, truncation, do_lower_case, add_special_token, stride, column);
+        name,
+        vocab_hash_file,
+        sequence_length,
+        truncation,
+        do_lower_case,
+        add_special_token,
+        stride,
+        column,
+        input_ids_type,
+        input_mask_type);
 
     return stage;
 }
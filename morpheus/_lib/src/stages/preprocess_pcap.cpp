@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/preprocess_pcap.hpp"
+
+#include "morpheus/messages/memory/inference_memory_fil.hpp"  // for InferenceMemoryFIL
+#include "morpheus/messages/multi.hpp"                        // for MultiMessage, MultiMessageInterfaceProxy
+#include "morpheus/messages/multi_inference.hpp"              // for MultiInferenceMessage
+#include "morpheus/objects/dtype.hpp"                         // for DType
+#include "morpheus/objects/table_info.hpp"                    // for TableInfo
+#include "morpheus/objects/tensor.hpp"                        // for Tensor
+#include "morpheus/types.hpp"                                 // for TensorIndex
+#include "morpheus/utilities/column_util.hpp"                 // for ColumnUtil, HostStringsColumn
+#include "morpheus/utilities/cudf_util.hpp"                   // for CudfHelper
+#include "morpheus/utilities/matx_util.hpp"                   // for MatxUtil
+#include "morpheus/utilities/pcap_util.hpp"                   // for PcapUtil
+#include "morpheus/utilities/string_util.hpp"                 // for MORPHEUS_CONCAT_STR
+
+#include <cudf/column/column.hpp>                     // for column
+#include <cudf/io/types.hpp>                          // for table_with_metadata, table_metadata
+#include <cudf/strings/convert/convert_integers.hpp>  // for from_integers
+#include <cudf/table/table.hpp>                       // for table
+#include <cudf/types.hpp>                             // for type_id
+#include <pybind11/gil.h>                             // for gil_scoped_acquire
+#include <pybind11/pytypes.h>                         // for object, str
+#include <rmm/cuda_stream_view.hpp>                   // for cuda_stream_per_thread
+#include <rmm/device_buffer.hpp>                      // for device_buffer
+
+#include <algorithm>  // for find
+#include <cstdint>    // for int64_t
+#include <optional>   // for optional
+#include <stdexcept>  // for invalid_argument
+#include <string>     // for string
+#include <utility>    // for move
+#include <vector>     // for vector
+
+namespace morpheus {
+
+namespace {
+const std::vector<std::string> InputColumns{
+    "timestamp", "flags", "src_ip", "src_port", "dest_ip", "dest_port", "data_len"};
+
+// Host copy of a string or integer column, integer ports are converted on the device matching `astype("str")`
+HostStringsColumn strings_to_host(const cudf::column_view& column)
+{
+    if (column.type().id() == cudf::type_id::STRING)
+    {
+        return HostStringsColumn{column};
+    }
+
+    return HostStringsColumn{cudf::strings::from_integers(column)->view()};
+}
+
+std::vector<std::int64_t> require_values(std::vector<std::optional<std::int64_t>>&& values, const std::string& name)
+{
+    std::vector<std::int64_t> result;
+    result.reserve(values.size());
+    for (const auto& value : values)
+    {
+        if (!value.has_value())
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("PCAP preprocessing requires column '"
+                                                            << name << "' to not contain null values"));
+        }
+
+        result.push_back(*value);
+    }
+
+    return result;
+}
+
+}  // namespace
+
+// Component public implementations
+// ************ PreprocessPcapStage ************************* //
+PreprocessPcapStage::PreprocessPcapStage() :
+  base_t(rxcpp::operators::map([this](sink_type_t x) {
+      return this->on_data(std::move(x));
+  }))
+{}
+
+PreprocessPcapStage::source_type_t PreprocessPcapStage::on_data(sink_type_t x)
+{
+    auto column_names = x->get_meta_column_names();
+    for (const auto& name : InputColumns)
+    {
+        if (std::find(column_names.begin(), column_names.end(), name) == column_names.end())
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Column '" << name << "' not found"));
+        }
+    }
+
+    std::vector<std::int64_t> timestamps;
+    std::vector<std::int64_t> flags;
+    std::vector<std::int64_t> data_len;
+    std::vector<std::optional<std::string>> flow_ids;
+
+    {
+        auto info = x->get_meta(InputColumns);
+
+        timestamps = require_values(ColumnUtil::integers_to_host(info.get_column(0)), InputColumns[0]);
+        flags      = require_values(ColumnUtil::integers_to_host(info.get_column(1)), InputColumns[1]);
+
+        const auto src_ip    = strings_to_host(info.get_column(2));
+        const auto src_port  = strings_to_host(info.get_column(3));
+        const auto dest_ip   = strings_to_host(info.get_column(4));
+        const auto dest_port = strings_to_host(info.get_column(5));
+
+        // Null payload sizes are skipped by the sum of their flow
+        for (const auto& value : ColumnUtil::integers_to_host(info.get_column(6)))
+        {
+            data_len.push_back(value.value_or(0));
+        }
+
+        // Packets with a null endpoint don't belong to any flow
+        flow_ids.resize(timestamps.size());
+        for (std::size_t row = 0; row < flow_ids.size(); ++row)
+        {
+            if (src_ip.is_valid(row) && src_port.is_valid(row) && dest_ip.is_valid(row) && dest_port.is_valid(row))
+            {
+                flow_ids[row] =
+                    PcapUtil::flow_id(src_ip.get(row), src_port.get(row), dest_ip.get(row), dest_port.get(row));
+            }
+        }
+    }
+
+    auto features = PcapUtil::compute_features(timestamps, flags, data_len, flow_ids);
+
+    const auto num_rows = static_cast<TensorIndex>(timestamps.size());
+    const auto fea_len  = static_cast<TensorIndex>(PcapUtil::feature_names().size());
+
+    // Features are already row-major `[num_rows, fea_len]`
+    auto input__0 = Tensor::create(
+        std::make_shared<rmm::device_buffer>(
+            features.features.data(), features.features.size() * sizeof(float), rmm::cuda_stream_per_thread),
+        DType::create<float>(),
+        {num_rows, fea_len},
+        {},
+        0);
+
+    auto seq_id_dtype = DType::create<TensorIndex>();
+    auto seq_ids      = Tensor::create(
+        MatxUtil::create_seq_ids(num_rows, fea_len, seq_id_dtype.type_id(), input__0.get_memory(), x->mess_offset),
+        seq_id_dtype,
+        {num_rows, 3},
+        {},
+        0);
+
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    cudf::io::table_metadata metadata;
+
+    columns.push_back(ColumnUtil::make_strings_column(flow_ids));
+    metadata.schema_info.emplace_back("flow_id");
+
+    std::vector<std::optional<std::string>> rollup_time(features.rollup_time.begin(), features.rollup_time.end());
+    columns.push_back(ColumnUtil::make_strings_column(rollup_time));
+    metadata.schema_info.emplace_back("rollup_time");
+
+    cudf::io::table_with_metadata table{std::make_unique<cudf::table>(std::move(columns)), std::move(metadata)};
+
+    {
+        pybind11::gil_scoped_acquire gil;
+
+        // Strings can't be written in place, set the columns of the message's rows from python
+        auto df = CudfHelper::table_from_table_with_metadata(std::move(table), 0);
+        for (const auto& column_name : {"flow_id", "rollup_time"})
+        {
+            MultiMessageInterfaceProxy::set_meta(*x, pybind11::str(column_name), df[pybind11::str(column_name)]);
+        }
+    }
+
+    auto memory = std::make_shared<InferenceMemoryFIL>(num_rows, std::move(input__0), std::move(seq_ids));
+
+    return std::make_shared<MultiInferenceMessage>(
+        x->meta, x->mess_offset, x->mess_count, std::move(memory), 0, num_rows);
+}
+
+// ************ PreprocessPcapStageInterfaceProxy *********** //
+std::shared_ptr<mrc::segment::Object<PreprocessPcapStage>> PreprocessPcapStageInterfaceProxy::init(
+    mrc::segment::Builder& builder, const std::string& name)
+{
+    return builder.construct_object<PreprocessPcapStage>(name);
+}
+
+}  // namespace morpheus
@@ -0,0 +1,191 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/rss_source.hpp"
+
+#include "morpheus/utilities/column_util.hpp"  // for ColumnUtil
+
+#include <boost/fiber/operations.hpp>  // for sleep_for
+#include <cudf/column/column.hpp>      // for column
+#include <cudf/io/types.hpp>           // for table_with_metadata, table_metadata
+#include <cudf/table/table.hpp>        // for table
+#include <glog/logging.h>              // for LOG
+
+#include <algorithm>  // for min
+#include <cstdint>    // for int64_t
+#include <exception>  // for exception, current_exception
+#include <iterator>   // for make_move_iterator
+#include <optional>   // for optional, nullopt
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace {
+// Longest sleep between checks for the pipeline being stopped
+constexpr std::chrono::milliseconds MaxSleep{100};
+
+const std::vector<std::pair<std::string, std::string FeedEntry::*>> EntryColumns = {
+    {"id", &FeedEntry::id},
+    {"title", &FeedEntry::title},
+    {"link", &FeedEntry::link},
+    {"summary", &FeedEntry::summary},
+    {"content", &FeedEntry::content},
+    {"published", &FeedEntry::published},
+    {"updated", &FeedEntry::updated},
+    {"author", &FeedEntry::author}};
+
+// Strings column of a field of the entries, empty values are null
+std::unique_ptr<cudf::column> make_field_column(const std::vector<FeedEntry>& entries, std::string FeedEntry::*field)
+{
+    std::vector<std::optional<std::string>> values;
+    values.reserve(entries.size());
+    for (const auto& entry : entries)
+    {
+        const auto& value = entry.*field;
+        values.push_back(value.empty() ? std::nullopt : std::optional<std::string>(value));
+    }
+
+    return ColumnUtil::make_strings_column(values);
+}
+}  // namespace
+
+// Component public implementations
+// ************ RSSSourceStage ****************************** //
+RSSSourceStage::RSSSourceStage(std::shared_ptr<FeedReader> reader,
+                               std::chrono::milliseconds interval,
+                               std::size_t stop_after,
+                               bool run_indefinitely,
+                               std::size_t batch_size) :
+  PythonSource(build()),
+  m_reader(std::move(reader)),
+  m_interval(interval),
+  m_stop_after(stop_after),
+  m_run_indefinitely(run_indefinitely),
+  m_batch_size(batch_size)
+{}
+
+std::shared_ptr<MessageMeta> RSSSourceStage::make_message(const std::vector<FeedEntry>& entries)
+{
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    cudf::io::table_metadata metadata;
+
+    for (const auto& [name, field] : EntryColumns)
+    {
+        columns.push_back(make_field_column(entries, field));
+        metadata.schema_info.emplace_back(name);
+    }
+
+    return MessageMeta::create_from_cpp(
+        cudf::io::table_with_metadata{std::make_unique<cudf::table>(std::move(columns)), std::move(metadata)}, 0);
+}
+
+RSSSourceStage::subscriber_fn_t RSSSourceStage::build()
+{
+    return [this](rxcpp::subscriber<source_type_t> output) {
+        std::size_t records_emitted = 0;
+        bool stop_requested         = false;
+
+        while (output.is_subscribed() && !stop_requested)
+        {
+            try
+            {
+                auto entries = m_reader->poll();
+                LOG_IF(INFO, entries.empty()) << "No new feed entries found";
+
+                const auto batch_size = m_batch_size == 0 ? entries.size() : m_batch_size;
+                for (std::size_t start = 0; start < entries.size() && output.is_subscribed(); start += batch_size)
+                {
+                    auto end = std::min(start + batch_size, entries.size());
+                    std::vector<FeedEntry> batch(std::make_move_iterator(entries.begin() + start),
+                                                 std::make_move_iterator(entries.begin() + end));
+
+                    output.on_next(make_message(batch));
+                    records_emitted += batch.size();
+
+                    if (m_stop_after > 0 && records_emitted >= m_stop_after)
+                    {
+                        LOG(INFO) << "Stop limit reached after emitting " << records_emitted << " feed entries";
+                        stop_requested = true;
+                        break;
+                    }
+                }
+            } catch (const std::exception& e)
+            {
+                LOG(ERROR) << "Failed to poll the feeds: " << e.what();
+                if (!m_run_indefinitely)
+                {
+                    output.on_error(std::current_exception());
+                    return;
+                }
+            }
+
+            if (!m_run_indefinitely)
+            {
+                break;
+            }
+
+            // Sleep in short steps so that stopping the pipeline isn't delayed by the interval
+            const auto wake_time = std::chrono::steady_clock::now() + m_interval;
+            while (!stop_requested && output.is_subscribed() && std::chrono::steady_clock::now() < wake_time)
+            {
+                const auto remaining = wake_time - std::chrono::steady_clock::now();
+                boost::this_fiber::sleep_for(std::min<std::chrono::steady_clock::duration>(MaxSleep, remaining));
+            }
+        }
+
+        output.on_completed();
+    };
+}
+
+// ************ RSSSourceStageInterfaceProxy ************** //
+std::shared_ptr<mrc::segment::Object<RSSSourceStage>> RSSSourceStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::vector<std::string> feed_input,
+    double interval_secs,
+    std::size_t stop_after,
+    bool run_indefinitely,
+    std::size_t batch_size,
+    double cooldown_interval,
+    bool strip_markup,
+    std::size_t max_seen_entries,
+    std::size_t num_threads,
+    std::shared_ptr<WebFetcher> fetcher)
+{
+    FeedReaderConfig config;
+    config.feeds             = std::move(feed_input);
+    config.num_threads       = num_threads;
+    config.max_seen_entries  = max_seen_entries;
+    config.cooldown_interval = std::chrono::milliseconds(static_cast<std::int64_t>(cooldown_interval * 1000));
+    config.strip_markup      = strip_markup;
+
+    FeedReader::fetch_fn_t fetch_fn;
+    if (fetcher != nullptr)
+    {
+        fetch_fn = [fetcher](const std::vector<std::string>& urls) {
+            return fetcher->fetch(urls);
+        };
+    }
+
+    auto reader   = std::make_shared<FeedReader>(std::move(config), std::move(fetch_fn));
+    auto interval = std::chrono::milliseconds(static_cast<std::int64_t>(interval_secs * 1000));
+
+    return builder.construct_object<RSSSourceStage>(
+        name, std::move(reader), interval, stop_after, run_indefinitely, batch_size);
+}
+
+}  // namespace morpheus
@@ -0,0 +1,215 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/string_features.hpp"
+
+#include "morpheus/objects/table_info.hpp"         // for TableInfo, MutableTableInfo
+#include "morpheus/objects/table_transaction.hpp"  // for TableTransaction
+#include "morpheus/utilities/column_util.hpp"      // for ColumnUtil, HostStringsColumn
+#include "morpheus/utilities/string_util.hpp"      // for MORPHEUS_CONCAT_STR
+
+#include <cudf/types.hpp>       // for size_type, type_id
+#include <pybind11/pybind11.h>  // for cast
+#include <pybind11/stl.h>       // IWYU pragma: keep
+
+#include <algorithm>  // for find, find_if, max
+#include <cstdint>    // for int32_t
+#include <iterator>   // for prev
+#include <stdexcept>  // for invalid_argument
+#include <thread>     // for hardware_concurrency
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace py = pybind11;
+
+namespace {
+// Output column `output` of the row major `values`, which hold `num_outputs` values per row
+template <typename T>
+std::unique_ptr<cudf::column> make_output_column(const std::vector<double>& values,
+                                                 std::size_t num_outputs,
+                                                 std::size_t output,
+                                                 cudf::type_id type)
+{
+    std::vector<T> column(values.size() / num_outputs);
+    for (std::size_t row = 0; row < column.size(); ++row)
+    {
+        column[row] = static_cast<T>(values[row * num_outputs + output]);
+    }
+
+    return ColumnUtil::make_numeric_column(column, type);
+}
+}  // namespace
+
+// Component public implementations
+// ************ StringFeaturesStage ************************* //
+StringFeaturesStage::StringFeaturesStage(std::vector<StringFeature> features, std::size_t num_threads) :
+  base_t(rxcpp::operators::map([this](sink_type_t x) {
+      return this->on_data(std::move(x));
+  })),
+  m_num_threads(num_threads == 0 ? std::max(1U, std::thread::hardware_concurrency()) : num_threads)
+{
+    std::vector<std::vector<StringFeature>> grouped;
+    std::vector<std::size_t> group_outputs;
+    for (auto& feature : features)
+    {
+        auto group = std::find_if(grouped.begin(), grouped.end(), [&feature](const auto& group) {
+            return group.front().column == feature.column;
+        });
+
+        if (group == grouped.end())
+        {
+            grouped.emplace_back();
+            group_outputs.push_back(0);
+            group = std::prev(grouped.end());
+        }
+
+        const auto extractor = static_cast<std::size_t>(group - grouped.begin());
+        for (auto& output_name : feature.output_names())
+        {
+            auto found = std::find_if(m_output_columns.begin(), m_output_columns.end(), [&](const auto& output) {
+                return output.name == output_name;
+            });
+
+            if (found != m_output_columns.end())
+            {
+                throw std::invalid_argument(MORPHEUS_CONCAT_STR("Duplicate feature column '" << output_name << "'"));
+            }
+
+            m_output_columns.push_back({std::move(output_name), extractor, group_outputs[extractor]++});
+        }
+
+        group->push_back(std::move(feature));
+    }
+
+    for (auto& group : grouped)
+    {
+        m_extractors.emplace_back(std::move(group));
+    }
+}
+
+std::vector<std::unique_ptr<cudf::column>> StringFeaturesStage::compute_features(
+    const StringFeatureExtractor& extractor, const cudf::column_view& column) const
+{
+    const auto num_rows    = static_cast<std::size_t>(column.size());
+    const auto num_outputs = extractor.num_outputs();
+
+    std::vector<double> values(num_rows * num_outputs, 0.0);
+    if (num_rows > 0)
+    {
+        const HostStringsColumn strings{column};
+
+        // Each range of rows writes to its own part of `values`
+        ColumnUtil::parallel_for_rows(num_rows, m_num_threads, [&](std::size_t, std::size_t start, std::size_t stop) {
+            for (std::size_t row = start; row < stop; ++row)
+            {
+                // Null rows keep the features of an empty string
+                if (strings.is_valid(row))
+                {
+                    extractor.extract(strings.get(row), values.data() + row * num_outputs);
+                }
+            }
+        });
+    }
+
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    std::size_t output = 0;
+    for (const auto& feature : extractor.features())
+    {
+        for (std::size_t i = 0; i < feature.output_names().size(); ++i, ++output)
+        {
+            columns.push_back(feature.is_integral()
+                                  ? make_output_column<std::int32_t>(values, num_outputs, output, cudf::type_id::INT32)
+                                  : make_output_column<float>(values, num_outputs, output, cudf::type_id::FLOAT32));
+        }
+    }
+
+    return columns;
+}
+
+StringFeaturesStage::source_type_t StringFeaturesStage::on_data(sink_type_t x)
+{
+    TableTransaction transaction;
+
+    {
+        auto info         = x->get_info();
+        auto column_names = info.get_column_names();
+
+        std::vector<std::vector<std::unique_ptr<cudf::column>>> computed;
+        for (const auto& extractor : m_extractors)
+        {
+            const auto& column_name = extractor.features().front().column;
+
+            auto found = std::find(column_names.begin(), column_names.end(), column_name);
+            if (found == column_names.end())
+            {
+                throw std::invalid_argument(MORPHEUS_CONCAT_STR("Column '" << column_name << "' not found"));
+            }
+
+            const auto& column = info.get_column(static_cast<cudf::size_type>(found - column_names.begin()));
+            if (column.type().id() != cudf::type_id::STRING)
+            {
+                throw std::invalid_argument(MORPHEUS_CONCAT_STR(
+                    "String features require a string column, column '" << column_name << "' is not"));
+            }
+
+            computed.push_back(compute_features(extractor, column));
+        }
+
+        // The columns are computed per source column but appended in the order of the features
+        for (const auto& output : m_output_columns)
+        {
+            transaction.add_column(output.name, std::move(computed[output.extractor][output.output]));
+        }
+    }
+
+    x->get_mutable_info().commit(std::move(transaction));
+
+    return x;
+}
+
+// ************ StringFeaturesStageInterfaceProxy ********** //
+std::shared_ptr<mrc::segment::Object<StringFeaturesStage>> StringFeaturesStageInterfaceProxy::init(
+    mrc::segment::Builder& builder, const std::string& name, const py::list& features, std::size_t num_threads)
+{
+    std::vector<StringFeature> configs;
+    for (const auto& item : features)
+    {
+        auto feature = item.cast<py::dict>();
+
+        StringFeature config;
+        config.column = feature["column"].cast<std::string>();
+        config.type   = parse_string_feature_type(feature["type"].cast<std::string>());
+        config.name   = feature["name"].cast<std::string>();
+
+        if (feature.contains("n") && !feature["n"].is_none())
+        {
+            config.ngram_size = feature["n"].cast<std::size_t>();
+        }
+
+        if (feature.contains("num_buckets") && !feature["num_buckets"].is_none())
+        {
+            config.num_buckets = feature["num_buckets"].cast<std::size_t>();
+        }
+
+        configs.push_back(std::move(config));
+    }
+
+    return builder.construct_object<StringFeaturesStage>(name, std::move(configs), num_threads);
+}
+
+}  // namespace morpheus
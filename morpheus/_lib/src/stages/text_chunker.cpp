@@ -0,0 +1,210 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/text_chunker.hpp"
+
+#include "morpheus/messages/meta.hpp"          // for MessageMeta
+#include "morpheus/objects/table_info.hpp"     // for TableInfo
+#include "morpheus/utilities/column_util.hpp"  // for ColumnUtil, HostStringsColumn
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <cudf/column/column.hpp>     // for column
+#include <cudf/copying.hpp>           // for gather
+#include <cudf/io/types.hpp>          // for table_with_metadata, table_metadata
+#include <cudf/table/table.hpp>       // for table
+#include <cudf/table/table_view.hpp>  // for table_view
+#include <cudf/types.hpp>             // for size_type, type_id
+#include <glog/logging.h>             // for CHECK
+
+#include <algorithm>  // for find, max
+#include <iterator>   // for distance
+#include <limits>     // for numeric_limits
+#include <stdexcept>  // for invalid_argument
+#include <thread>     // for hardware_concurrency
+#include <utility>    // for move
+
+namespace morpheus {
+
+// Component public implementations
+// ************ TextChunkerStage **************************** //
+TextChunkerStage::TextChunkerStage(std::string column,
+                                   TextSplitter splitter,
+                                   std::string row_id_column,
+                                   std::string offset_column,
+                                   std::size_t num_threads) :
+  base_t(rxcpp::operators::map([this](sink_type_t x) {
+      return this->on_data(std::move(x));
+  })),
+  m_column(std::move(column)),
+  m_splitter(std::move(splitter)),
+  m_row_id_column(std::move(row_id_column)),
+  m_offset_column(std::move(offset_column)),
+  m_num_threads(num_threads == 0 ? std::max(1U, std::thread::hardware_concurrency()) : num_threads)
+{}
+
+TextChunkerStage::Chunks TextChunkerStage::split_column(const cudf::column_view& column) const
+{
+    const auto num_rows = static_cast<std::size_t>(column.size());
+    if (num_rows == 0)
+    {
+        return {};
+    }
+
+    const HostStringsColumn strings{column};
+
+    // Each range of rows is split into its own chunks, which are concatenated in order
+    std::vector<Chunks> ranges(ColumnUtil::num_row_chunks(num_rows, m_num_threads));
+    ColumnUtil::parallel_for_rows(num_rows, m_num_threads, [&](std::size_t range, std::size_t start, std::size_t stop) {
+        auto& chunks = ranges[range];
+        for (std::size_t row = start; row < stop; ++row)
+        {
+            // Null rows don't produce any chunks
+            if (!strings.is_valid(row))
+            {
+                continue;
+            }
+
+            for (auto& [chunk, offset] : m_splitter.split_text_with_offsets(strings.get(row)))
+            {
+                chunks.chars += chunk;
+                chunks.lengths.push_back(static_cast<std::int32_t>(chunk.size()));
+                chunks.rows.push_back(static_cast<std::int32_t>(row));
+                chunks.offsets.push_back(offset);
+            }
+        }
+    });
+
+    auto result = std::move(ranges[0]);
+    for (std::size_t range = 1; range < ranges.size(); ++range)
+    {
+        const auto& chunks = ranges[range];
+        result.chars += chunks.chars;
+        result.lengths.insert(result.lengths.end(), chunks.lengths.begin(), chunks.lengths.end());
+        result.rows.insert(result.rows.end(), chunks.rows.begin(), chunks.rows.end());
+        result.offsets.insert(result.offsets.end(), chunks.offsets.begin(), chunks.offsets.end());
+    }
+
+    CHECK(result.chars.size() <= static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()))
+        << "Chunked strings column exceeds the maximum size of a cudf strings column";
+
+    return result;
+}
+
+TextChunkerStage::source_type_t TextChunkerStage::on_data(sink_type_t x)
+{
+    auto payload = x->payload();
+
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    cudf::io::table_metadata metadata;
+
+    {
+        auto info         = payload->get_info();
+        auto column_names = info.get_column_names();
+
+        auto found = std::find(column_names.begin(), column_names.end(), m_column);
+        if (found == column_names.end())
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Column '" << m_column << "' not found"));
+        }
+
+        for (const auto& name : {m_row_id_column, m_offset_column})
+        {
+            if (std::find(column_names.begin(), column_names.end(), name) != column_names.end())
+            {
+                throw std::invalid_argument(MORPHEUS_CONCAT_STR("Output column '" << name << "' already exists"));
+            }
+        }
+
+        const auto text_idx = static_cast<cudf::size_type>(std::distance(column_names.begin(), found));
+        const auto& text    = info.get_column(text_idx);
+        if (text.type().id() != cudf::type_id::STRING)
+        {
+            throw std::invalid_argument(
+                MORPHEUS_CONCAT_STR("Text chunking requires a string column, column '" << m_column << "' is not"));
+        }
+
+        auto chunks = split_column(text);
+
+        // Repeat the remaining columns for each chunk of their row
+        std::vector<cudf::column_view> other_views;
+        for (cudf::size_type i = 0; i < info.num_columns(); ++i)
+        {
+            if (i != text_idx)
+            {
+                other_views.push_back(info.get_column(i));
+            }
+        }
+
+        auto row_ids  = ColumnUtil::make_numeric_column(chunks.rows, cudf::type_id::INT32);
+        auto gathered = cudf::gather(cudf::table_view{other_views}, row_ids->view())->release();
+
+        std::vector<cudf::size_type> chunk_offsets{0};
+        chunk_offsets.reserve(chunks.lengths.size() + 1);
+        for (auto length : chunks.lengths)
+        {
+            chunk_offsets.push_back(chunk_offsets.back() + length);
+        }
+
+        auto text_column = ColumnUtil::make_strings_column(chunks.chars, chunk_offsets);
+
+        // Keep the original column order, with the chunks in place of the text column
+        std::size_t gathered_idx = 0;
+        for (cudf::size_type i = 0; i < info.num_columns(); ++i)
+        {
+            columns.push_back(i == text_idx ? std::move(text_column) : std::move(gathered[gathered_idx++]));
+            metadata.schema_info.emplace_back(column_names[i]);
+        }
+
+        std::vector<std::int64_t> source_rows(chunks.rows.begin(), chunks.rows.end());
+        columns.push_back(ColumnUtil::make_numeric_column(source_rows, cudf::type_id::INT64));
+        metadata.schema_info.emplace_back(m_row_id_column);
+
+        columns.push_back(ColumnUtil::make_numeric_column(chunks.offsets, cudf::type_id::INT64));
+        metadata.schema_info.emplace_back(m_offset_column);
+    }
+
+    x->payload(MessageMeta::create_from_cpp(
+        cudf::io::table_with_metadata{std::make_unique<cudf::table>(std::move(columns)), std::move(metadata)}, 0));
+
+    return x;
+}
+
+// ************ TextChunkerStageInterfaceProxy ************* //
+std::shared_ptr<mrc::segment::Object<TextChunkerStage>> TextChunkerStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::string column,
+    std::size_t chunk_size,
+    std::size_t chunk_overlap,
+    std::vector<std::string> separators,
+    bool keep_separator,
+    bool strip_whitespace,
+    TextLengthUnit length_unit,
+    std::string row_id_column,
+    std::string offset_column,
+    std::size_t num_threads)
+{
+    return builder.construct_object<TextChunkerStage>(
+        name,
+        std::move(column),
+        TextSplitter(chunk_size, chunk_overlap, std::move(separators), keep_separator, strip_whitespace, length_unit),
+        std::move(row_id_column),
+        std::move(offset_column),
+        num_threads);
+}
+
+}  // namespace morpheus
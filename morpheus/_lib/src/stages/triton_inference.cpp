@@ -23,7 +23,7 @@
 #include "morpheus/objects/triton_in_out.hpp"  // for TritonInOut
 #include "morpheus/types.hpp"                  // for TensorIndex, TensorMap
 #include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
-#include "morpheus/utilities/tensor_util.hpp"  // for get_elem_count
+#include "morpheus/utilities/tensor_util.hpp"  // for get_elem_count, cast_host
 
 #include <cuda_runtime.h>  // for cudaMemcpy, cudaMemcpy2D, cudaMemcpyDeviceToHost, cudaMemcpyHostToDevice
 #include <glog/logging.h>
@@ -40,6 +40,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <sstream>
 #include <stdexcept>  // for runtime_error, out_of_range
 #include <string>
@@ -354,6 +355,20 @@ std::vector<TensorModelMapping> TritonInferenceClientSession::get_output_mapping
     return mappings;
 }
 
+void TritonInferenceClientSession::notify_converted_input(const TritonInOut& model_input, const DType& input_type)
+{
+    // The session is shared by the concurrent inference calls of the stage
+    std::lock_guard<std::mutex> lock(m_notified_mutex);
+
+    if (m_notified_inputs.insert(model_input.name).second)
+    {
+        LOG(WARNING) << "Unexpected dtype for Triton input. Automatically converting dtype since no data loss will "
+                        "occur. Model: '"
+                     << m_model_name << "', Input Name: '" << model_input.name
+                     << "', Expected dtype: " << model_input.datatype.name() << ", Actual dtype: " << input_type.name();
+    }
+}
+
 mrc::coroutines::Task<TensorMap> TritonInferenceClientSession::infer(TensorMap&& inputs)
 {
     CHECK_EQ(inputs.size(), m_model_inputs.size()) << "Input tensor count does not match model input count";
@@ -396,12 +411,28 @@ mrc::coroutines::Task<TensorMap> TritonInferenceClientSession::infer(TensorMap&&
         for (auto model_input : m_model_inputs)
         {
             auto inference_input_slice = inputs.at(model_input.name).slice({start, 0}, {stop, -1});
+            std::vector<uint8_t> host_data;
 
-            if (inference_input_slice.dtype() != model_input.datatype)
+            if (inference_input_slice.dtype() == model_input.datatype)
             {
-                if (m_force_convert_inputs)
+                host_data = inference_input_slice.get_host_data();
+            }
+            else
+            {
+                // Compact inputs (i.e. int16 token ids or float16 features) are widened automatically since no data
+                // will be lost, anything else requires force_convert_inputs
+                if (inference_input_slice.dtype().can_safely_cast_to(model_input.datatype))
+                {
+                    this->notify_converted_input(model_input, inference_input_slice.dtype());
+
+                    // Widened on the host once copied, so that only the compact values are transferred off the device
+                    host_data = TensorUtils::cast_host(
+                        inference_input_slice.get_host_data(), inference_input_slice.dtype(), model_input.datatype);
+                }
+                else if (m_force_convert_inputs)
                 {
                     inference_input_slice.swap(inference_input_slice.as_type(model_input.datatype));
+                    host_data = inference_input_slice.get_host_data();
                 }
                 else
                 {
@@ -418,7 +449,7 @@ mrc::coroutines::Task<TensorMap> TritonInferenceClientSession::infer(TensorMap&&
                 TritonInferInput{model_input.name,
                                  {inference_input_slice.shape(0), inference_input_slice.shape(1)},
                                  model_input.datatype.triton_str(),
-                                 inference_input_slice.get_host_data()});
+                                 std::move(host_data)});
         }
 
         // create batch outputs
@@ -0,0 +1,299 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/web_fetch.hpp"
+
+#include "morpheus/objects/table_info.hpp"     // for TableInfo
+#include "morpheus/types.hpp"                  // for TensorIndex
+#include "morpheus/utilities/column_util.hpp"  // for ColumnUtil, HostStringsColumn
+#include "morpheus/utilities/dedup_util.hpp"   // for DedupUtil
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <cudf/column/column.hpp>  // for column
+#include <cudf/io/types.hpp>       // for table_with_metadata, table_metadata
+#include <cudf/table/table.hpp>    // for table
+#include <cudf/types.hpp>          // for size_type, type_id
+#include <glog/logging.h>          // for LOG
+
+#include <algorithm>  // for find, transform
+#include <cctype>     // for tolower
+#include <cstdint>    // for int32_t
+#include <exception>  // for exception
+#include <iterator>   // for distance
+#include <stdexcept>  // for invalid_argument
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace {
+// Values of a string column, null values are returned as `std::nullopt`
+std::vector<std::optional<std::string>> strings_to_host(const cudf::column_view& column)
+{
+    const HostStringsColumn strings{column};
+
+    std::vector<std::optional<std::string>> result(strings.size());
+    for (std::size_t row = 0; row < result.size(); ++row)
+    {
+        if (strings.is_valid(row))
+        {
+            result[row] = std::string(strings.get(row));
+        }
+    }
+
+    return result;
+}
+
+// Lower case media type of a `Content-Type` header, without its parameters
+std::string media_type(const std::string& content_type)
+{
+    auto end   = content_type.find(';');
+    auto value = content_type.substr(0, end);
+
+    auto first = value.find_first_not_of(" \t");
+    auto last  = value.find_last_not_of(" \t");
+    value      = first == std::string::npos ? std::string{} : value.substr(first, last - first + 1);
+
+    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+
+    return value;
+}
+
+bool looks_like_html(const std::string& body)
+{
+    auto start = body.substr(0, 1024);
+    std::transform(start.begin(), start.end(), start.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+
+    return start.find("<html") != std::string::npos || start.find("<!doctype html") != std::string::npos;
+}
+
+std::string join_texts(const std::vector<std::string>& texts)
+{
+    std::string result;
+    for (const auto& text : texts)
+    {
+        if (!result.empty() && !text.empty())
+        {
+            result += '\n';
+        }
+
+        result += text;
+    }
+
+    return result;
+}
+}  // namespace
+
+// Component public implementations
+// ************ WebFetchStage ******************************* //
+WebFetchStage::WebFetchStage(std::shared_ptr<WebFetcher> fetcher,
+                             std::string link_column,
+                             std::string content_column,
+                             bool remove_boilerplate) :
+  PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
+  m_fetcher(std::move(fetcher)),
+  m_link_column(std::move(link_column)),
+  m_content_column(std::move(content_column)),
+  m_html_converter(remove_boilerplate)
+{
+    if (m_fetcher == nullptr)
+    {
+        throw std::invalid_argument("WebFetchStage requires a fetcher");
+    }
+}
+
+WebFetchStage::subscribe_fn_t WebFetchStage::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t msg) {
+                auto fetched = this->on_data(*msg);
+
+                // Messages whose pages all failed are dropped
+                if (fetched != nullptr)
+                {
+                    output.on_next(std::move(fetched));
+                }
+            },
+            [&](std::exception_ptr error_ptr) {
+                output.on_error(error_ptr);
+            },
+            [&]() {
+                output.on_completed();
+            }));
+    };
+}
+
+std::optional<std::string> WebFetchStage::extract_text(const WebResponse& response) const
+{
+    const auto type = media_type(response.content_type);
+
+    if (type == "text/html" || type == "application/xhtml+xml" || (type.empty() && looks_like_html(response.body)))
+    {
+        return join_texts(m_html_converter.convert(response.body));
+    }
+
+    if (type.empty() || type.rfind("text/", 0) == 0)
+    {
+        return join_texts(m_text_converter.convert(response.body));
+    }
+
+    return std::nullopt;
+}
+
+std::shared_ptr<MessageMeta> WebFetchStage::on_data(const MessageMeta& meta)
+{
+    const auto info         = meta.get_info();
+    const auto num_indices  = info.num_indices();
+    const auto column_names = info.get_column_names();
+
+    auto found = std::find(column_names.begin(), column_names.end(), m_link_column);
+    if (found == column_names.end())
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Column '" << m_link_column << "' not found"));
+    }
+
+    const auto& link_column = info.get_column(static_cast<cudf::size_type>(std::distance(column_names.begin(), found)));
+    if (link_column.type().id() != cudf::type_id::STRING)
+    {
+        throw std::invalid_argument(
+            MORPHEUS_CONCAT_STR("Web fetching requires a string column, column '" << m_link_column << "' is not"));
+    }
+
+    // Null rows don't hold a link
+    std::vector<std::string> urls;
+    std::vector<TensorIndex> url_rows;
+    auto links = strings_to_host(link_column);
+    for (std::size_t row = 0; row < links.size(); ++row)
+    {
+        if (links[row].has_value())
+        {
+            urls.push_back(std::move(*links[row]));
+            url_rows.push_back(static_cast<TensorIndex>(row));
+        }
+    }
+
+    auto responses = m_fetcher->fetch(urls);
+
+    std::vector<TensorIndex> rows;
+    std::vector<std::string> contents;
+    std::vector<std::string> final_urls;
+    std::vector<std::int32_t> statuses;
+    std::vector<std::string> content_types;
+
+    for (std::size_t i = 0; i < responses.size(); ++i)
+    {
+        auto& response = responses[i];
+        if (!response.error.empty())
+        {
+            LOG(WARNING) << "Failed to fetch " << response.url << ": " << response.error;
+            continue;
+        }
+
+        if (!response.ok())
+        {
+            LOG(WARNING) << "Failed to fetch " << response.url << ": status " << response.status;
+            continue;
+        }
+
+        std::optional<std::string> text;
+        try
+        {
+            text = extract_text(response);
+        } catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Failed to extract the text of " << response.url << ": " << e.what();
+            continue;
+        }
+
+        if (!text.has_value())
+        {
+            LOG(WARNING) << "Skipping " << response.url << ", unsupported content type '" << response.content_type
+                         << "'";
+            continue;
+        }
+
+        if (text->empty())
+        {
+            continue;
+        }
+
+        rows.push_back(url_rows[i]);
+        contents.push_back(std::move(*text));
+        final_urls.push_back(std::move(response.final_url));
+        statuses.push_back(static_cast<std::int32_t>(response.status));
+        content_types.push_back(std::move(response.content_type));
+    }
+
+    if (rows.empty())
+    {
+        return nullptr;
+    }
+
+    // Columns of the result by position, starting with the index and columns of `meta`
+    std::vector<std::string> names = info.get_index_names();
+    names.insert(names.end(), column_names.begin(), column_names.end());
+
+    auto columns = DedupUtil::gather_rows(info.get_view(), rows)->release();
+
+    auto set_column = [&](const std::string& name, std::unique_ptr<cudf::column> column) {
+        auto existing = std::find(names.begin() + num_indices, names.end(), name);
+        if (existing != names.end())
+        {
+            columns[std::distance(names.begin(), existing)] = std::move(column);
+        }
+        else
+        {
+            names.push_back(name);
+            columns.push_back(std::move(column));
+        }
+    };
+
+    set_column(m_content_column, ColumnUtil::make_strings_column(contents));
+    set_column("final_url", ColumnUtil::make_strings_column(final_urls));
+    set_column("status_code", ColumnUtil::make_numeric_column(statuses, cudf::type_id::INT32));
+    set_column("content_type", ColumnUtil::make_strings_column(content_types));
+
+    cudf::io::table_metadata metadata;
+    metadata.schema_info.reserve(names.size());
+    for (const auto& name : names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    return MessageMeta::create_from_cpp(
+        cudf::io::table_with_metadata{std::make_unique<cudf::table>(std::move(columns)), std::move(metadata)},
+        num_indices);
+}
+
+// ************ WebFetchStageInterfaceProxy ***************** //
+std::shared_ptr<mrc::segment::Object<WebFetchStage>> WebFetchStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::shared_ptr<WebFetcher> fetcher,
+    std::string link_column,
+    std::string content_column,
+    bool remove_boilerplate)
+{
+    return builder.construct_object<WebFetchStage>(
+        name, std::move(fetcher), std::move(link_column), std::move(content_column), remove_boilerplate);
+}
+
+}  // namespace morpheus
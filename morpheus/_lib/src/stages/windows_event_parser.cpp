@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/windows_event_parser.hpp"
+
+#include "morpheus/objects/decoded_table.hpp"      // for DecodedTable
+#include "morpheus/objects/syslog_parser.hpp"      // for parse_log_extension_type
+#include "morpheus/objects/table_info.hpp"         // for TableInfo, MutableTableInfo
+#include "morpheus/objects/table_transaction.hpp"  // for TableTransaction
+#include "morpheus/utilities/column_util.hpp"      // for ColumnUtil, HostStringsColumn
+#include "morpheus/utilities/string_util.hpp"      // for MORPHEUS_CONCAT_STR
+
+#include <cudf/column/column.hpp>  // for column
+#include <cudf/table/table.hpp>    // for table
+#include <cudf/types.hpp>          // for size_type, type_id
+#include <pybind11/pybind11.h>     // for cast
+#include <pybind11/stl.h>          // IWYU pragma: keep
+
+#include <algorithm>  // for find, find_if, max
+#include <cstdint>    // for int64_t
+#include <optional>   // for optional, nullopt
+#include <stdexcept>  // for invalid_argument, runtime_error
+#include <thread>     // for hardware_concurrency
+#include <utility>    // for move
+
+namespace morpheus {
+
+namespace py = pybind11;
+
+// Component public implementations
+// ************ WindowsEventParserStage ************************* //
+WindowsEventParserStage::WindowsEventParserStage(WindowsEventParser parser,
+                                                 std::string column,
+                                                 std::string error_column,
+                                                 std::size_t num_threads) :
+  base_t(rxcpp::operators::map([this](sink_type_t x) {
+      return this->on_data(std::move(x));
+  })),
+  m_parser(std::move(parser)),
+  m_column(std::move(column)),
+  m_error_column(std::move(error_column)),
+  m_num_threads(num_threads == 0 ? std::max(1U, std::thread::hardware_concurrency()) : num_threads)
+{
+    for (const auto& spec : m_parser.columns())
+    {
+        if (spec.name == m_error_column)
+        {
+            throw std::invalid_argument(
+                MORPHEUS_CONCAT_STR("Duplicate Windows event column '" << m_error_column << "'"));
+        }
+    }
+}
+
+cudf::io::table_with_metadata WindowsEventParserStage::parse_column(const cudf::column_view& column) const
+{
+    return ColumnUtil::parse_strings_column_parallel(
+        column,
+        m_num_threads,
+        [this](const HostStringsColumn& strings, std::size_t start, std::size_t stop, DecodedTable& table) {
+            const auto columns      = table.get_columns(m_parser.columns());
+            const auto error_column = table.get_column(m_error_column, cudf::type_id::STRING);
+
+            for (std::size_t row = start; row < stop; ++row)
+            {
+                table.begin_row();
+
+                // Null rows are null in every column, including the error column
+                if (strings.is_valid(row))
+                {
+                    try
+                    {
+                        m_parser.parse(strings.get(row), table, columns);
+                    } catch (const std::runtime_error& e)
+                    {
+                        table.abort_row();
+                        table.begin_row();
+                        table.set_string(error_column, e.what());
+                    }
+                }
+
+                table.end_row();
+            }
+        });
+}
+
+WindowsEventParserStage::source_type_t WindowsEventParserStage::on_data(sink_type_t x)
+{
+    TableTransaction transaction;
+
+    {
+        auto info         = x->get_info();
+        auto column_names = info.get_column_names();
+
+        auto found = std::find(column_names.begin(), column_names.end(), m_column);
+        if (found == column_names.end())
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Column '" << m_column << "' not found"));
+        }
+
+        const auto& column = info.get_column(static_cast<cudf::size_type>(found - column_names.begin()));
+        if (column.type().id() != cudf::type_id::STRING)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Windows event parsing requires a string column, column '"
+                                                            << m_column << "' is not"));
+        }
+
+        auto parsed  = parse_column(column);
+        auto columns = parsed.tbl->release();
+        for (std::size_t i = 0; i < columns.size(); ++i)
+        {
+            transaction.add_column(parsed.metadata.schema_info[i].name, std::move(columns[i]));
+        }
+    }
+
+    x->get_mutable_info().commit(std::move(transaction));
+
+    return x;
+}
+
+// ************ WindowsEventParserStageInterfaceProxy ********** //
+std::shared_ptr<mrc::segment::Object<WindowsEventParserStage>> WindowsEventParserStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::string column,
+    const py::list& fields,
+    const py::dict& schemas,
+    std::string event_id_key,
+    std::string error_column,
+    std::size_t num_threads)
+{
+    std::vector<WindowsEventField> configs;
+    auto add_fields = [&configs](const py::list& items, std::optional<std::int64_t> event_id) {
+        for (const auto& item : items)
+        {
+            auto field = item.cast<py::dict>();
+
+            WindowsEventField config;
+            config.key = field["key"].cast<std::string>();
+
+            if (field.contains("name") && !field["name"].is_none())
+            {
+                config.name = field["name"].cast<std::string>();
+            }
+
+            if (field.contains("type") && !field["type"].is_none())
+            {
+                config.type = parse_log_extension_type(field["type"].cast<std::string>());
+            }
+
+            if (!event_id.has_value())
+            {
+                configs.push_back(std::move(config));
+                continue;
+            }
+
+            // A field declared by several schemas is kept once with all of their event IDs
+            auto found = std::find_if(configs.begin(), configs.end(), [&config](const auto& other) {
+                return !other.event_ids.empty() && other.key == config.key && other.name == config.name &&
+                       other.type == config.type;
+            });
+
+            if (found == configs.end())
+            {
+                config.event_ids.push_back(*event_id);
+                configs.push_back(std::move(config));
+            }
+            else
+            {
+                found->event_ids.push_back(*event_id);
+            }
+        }
+    };
+
+    add_fields(fields, std::nullopt);
+    for (const auto& [event_id, schema] : schemas)
+    {
+        add_fields(schema.cast<py::list>(), event_id.cast<std::int64_t>());
+    }
+
+    WindowsEventParser parser(std::move(configs), std::move(event_id_key));
+
+    return builder.construct_object<WindowsEventParserStage>(
+        name, std::move(parser), std::move(column), std::move(error_column), num_threads);
+}
+
+}  // namespace morpheus
@@ -35,12 +35,17 @@ namespace morpheus {
 
 // Component public implementations
 // ************ WriteToFileStage **************************** //
-WriteToFileStage::WriteToFileStage(
-    const std::string& filename, std::ios::openmode mode, FileTypes file_type, bool include_index_col, bool flush) :
+WriteToFileStage::WriteToFileStage(const std::string& filename,
+                                   std::ios::openmode mode,
+                                   FileTypes file_type,
+                                   bool include_index_col,
+                                   bool flush,
+                                   std::string na_rep) :
   PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
   m_is_first(true),
   m_include_index_col(include_index_col),
-  m_flush(flush)
+  m_flush(flush),
+  m_na_rep(std::move(na_rep))
 {
     if (file_type == FileTypes::Auto)
     {
@@ -88,7 +93,7 @@ void WriteToFileStage::write_json(WriteToFileStage::sink_type_t& msg)
 void WriteToFileStage::write_csv(WriteToFileStage::sink_type_t& msg)
 {
     // Call df_to_csv passing our fstream
-    df_to_csv(msg->get_info(), m_fstream, m_is_first, m_include_index_col, m_flush);
+    df_to_csv(msg->get_info(), m_fstream, m_is_first, m_include_index_col, m_flush, m_na_rep);
 }
 
 void WriteToFileStage::write_parquet(WriteToFileStage::sink_type_t& msg)
@@ -133,7 +138,8 @@ std::shared_ptr<mrc::segment::Object<WriteToFileStage>> WriteToFileStageInterfac
     const std::string& mode,
     FileTypes file_type,
     bool include_index_col,
-    bool flush)
+    bool flush,
+    const std::string& na_rep)
 {
     std::ios::openmode fsmode = std::ios::out;
 
@@ -169,8 +175,8 @@ std::shared_ptr<mrc::segment::Object<WriteToFileStage>> WriteToFileStageInterfac
         throw std::runtime_error(std::string("Unsupported file mode. Must choose either 'w' or 'a'. Mode: ") + mode);
     }
 
-    auto stage =
-        builder.construct_object<WriteToFileStage>(name, filename, fsmode, file_type, include_index_col, flush);
+    auto stage = builder.construct_object<WriteToFileStage>(
+        name, filename, fsmode, file_type, include_index_col, flush, na_rep);
 
     return stage;
 }
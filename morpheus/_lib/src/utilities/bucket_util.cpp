@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/bucket_util.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <algorithm>  // for lower_bound, sort, stable_sort, unique
+#include <numeric>    // for iota
+#include <stdexcept>  // for invalid_argument
+
+namespace morpheus {
+
+std::vector<TensorIndex> BucketUtil::default_bucket_lengths(TensorIndex max_length)
+{
+    if (max_length <= 0)
+    {
+        throw std::invalid_argument("max_length must be greater than 0");
+    }
+
+    std::vector<TensorIndex> bucket_lengths;
+    for (TensorIndex length = 16; length < max_length; length *= 2)
+    {
+        bucket_lengths.push_back(length);
+    }
+
+    bucket_lengths.push_back(max_length);
+
+    return bucket_lengths;
+}
+
+std::vector<TensorIndex> BucketUtil::normalize_bucket_lengths(std::vector<TensorIndex> bucket_lengths,
+                                                              TensorIndex max_length)
+{
+    if (bucket_lengths.empty())
+    {
+        return default_bucket_lengths(max_length);
+    }
+
+    if (max_length <= 0)
+    {
+        throw std::invalid_argument("max_length must be greater than 0");
+    }
+
+    std::sort(bucket_lengths.begin(), bucket_lengths.end());
+    bucket_lengths.erase(std::unique(bucket_lengths.begin(), bucket_lengths.end()), bucket_lengths.end());
+
+    if (bucket_lengths.front() <= 0)
+    {
+        throw std::invalid_argument("Bucket lengths must be greater than 0");
+    }
+
+    bucket_lengths.erase(std::lower_bound(bucket_lengths.begin(), bucket_lengths.end(), max_length),
+                         bucket_lengths.end());
+    bucket_lengths.push_back(max_length);
+
+    return bucket_lengths;
+}
+
+std::vector<TensorIndex> BucketUtil::stable_length_order(const std::vector<TensorIndex>& lengths)
+{
+    std::vector<TensorIndex> order(lengths.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    std::stable_sort(order.begin(), order.end(), [&lengths](TensorIndex lhs, TensorIndex rhs) {
+        return lengths[lhs] < lengths[rhs];
+    });
+
+    return order;
+}
+
+TensorIndex BucketUtil::padded_length(TensorIndex length, const std::vector<TensorIndex>& bucket_lengths)
+{
+    auto found = std::lower_bound(bucket_lengths.begin(), bucket_lengths.end(), length);
+    if (found == bucket_lengths.end())
+    {
+        throw std::invalid_argument(
+            MORPHEUS_CONCAT_STR("Sequence of " << length << " tokens is longer than the largest bucket"));
+    }
+
+    return *found;
+}
+
+std::vector<LengthBucket> BucketUtil::make_buckets(const std::vector<TensorIndex>& lengths,
+                                                   const std::vector<TensorIndex>& bucket_lengths,
+                                                   TensorIndex max_rows)
+{
+    std::vector<LengthBucket> buckets;
+
+    // Rows are visited in ascending length, so each bucket is filled before moving on to the next
+    for (auto row : stable_length_order(lengths))
+    {
+        auto padded = padded_length(lengths[row], bucket_lengths);
+
+        if (buckets.empty() || buckets.back().padded_length != padded ||
+            (max_rows > 0 && static_cast<TensorIndex>(buckets.back().rows.size()) >= max_rows))
+        {
+            buckets.push_back(LengthBucket{padded, {}});
+        }
+
+        buckets.back().rows.push_back(row);
+    }
+
+    return buckets;
+}
+
+}  // namespace morpheus
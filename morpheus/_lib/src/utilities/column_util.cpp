@@ -0,0 +1,266 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/column_util.hpp"
+
+#include "morpheus/objects/decoded_table.hpp"  // for DecodedTable
+
+#include <cuda_runtime.h>                        // for cudaMemcpy
+#include <cudf/column/column_factories.hpp>      // for make_strings_column
+#include <cudf/null_mask.hpp>                    // for num_bitmask_words
+#include <cudf/strings/strings_column_view.hpp>  // for strings_column_view
+#include <cudf/unary.hpp>                        // for cast
+#include <cudf/utilities/bit.hpp>                // for bit_is_set, size_in_bits
+#include <glog/logging.h>                        // for CHECK
+#include <mrc/cuda/common.hpp>                   // for MRC_CHECK_CUDA
+
+#include <algorithm>  // for max, min
+#include <cstdint>    // for int64_t
+#include <future>     // for async, future
+#include <limits>     // for numeric_limits
+
+namespace morpheus {
+
+namespace {
+std::size_t chunk_size(std::size_t num_rows, std::size_t num_threads, std::size_t min_rows_per_thread)
+{
+    const auto max_chunks = std::max<std::size_t>(1, std::min(num_threads, num_rows / min_rows_per_thread));
+
+    return std::max<std::size_t>(1, (num_rows + max_chunks - 1) / max_chunks);
+}
+
+// Host copy of the null mask of `column`, including the bits before its offset. Empty when `column` has no null mask.
+std::vector<cudf::bitmask_type> null_mask_to_host(const cudf::column_view& column)
+{
+    std::vector<cudf::bitmask_type> null_mask;
+    if (column.nullable())
+    {
+        null_mask.resize(cudf::num_bitmask_words(column.offset() + column.size()));
+        MRC_CHECK_CUDA(cudaMemcpy(null_mask.data(),
+                                  column.null_mask(),
+                                  null_mask.size() * sizeof(cudf::bitmask_type),
+                                  cudaMemcpyDeviceToHost));
+    }
+
+    return null_mask;
+}
+}  // namespace
+
+// Component public implementations
+// ************ HostStringsColumn ************************* //
+HostStringsColumn::HostStringsColumn(const cudf::column_view& column) : m_offset(column.offset())
+{
+    const auto num_rows = static_cast<std::size_t>(column.size());
+    if (num_rows == 0)
+    {
+        m_offsets.push_back(0);
+        return;
+    }
+
+    cudf::strings_column_view strings{column};
+    auto stream = rmm::cuda_stream_per_thread;
+
+    m_offsets.resize(num_rows + 1);
+    MRC_CHECK_CUDA(cudaMemcpy(m_offsets.data(),
+                              strings.offsets_begin(),
+                              m_offsets.size() * sizeof(cudf::size_type),
+                              cudaMemcpyDeviceToHost));
+
+    m_chars.resize(m_offsets.back() - m_offsets.front());
+    MRC_CHECK_CUDA(cudaMemcpy(
+        m_chars.data(), strings.chars_begin(stream) + m_offsets.front(), m_chars.size(), cudaMemcpyDeviceToHost));
+
+    m_null_mask = null_mask_to_host(column);
+}
+
+std::size_t HostStringsColumn::size() const
+{
+    return m_offsets.size() - 1;
+}
+
+bool HostStringsColumn::is_valid(std::size_t row) const
+{
+    return m_null_mask.empty() || cudf::bit_is_set(m_null_mask.data(), m_offset + static_cast<cudf::size_type>(row));
+}
+
+std::string_view HostStringsColumn::get(std::size_t row) const
+{
+    return std::string_view(m_chars).substr(m_offsets[row] - m_offsets.front(), m_offsets[row + 1] - m_offsets[row]);
+}
+
+// ************ ColumnUtil ************************* //
+std::vector<std::optional<std::int64_t>> ColumnUtil::integers_to_host(const cudf::column_view& column)
+{
+    std::vector<std::optional<std::int64_t>> result(column.size());
+    if (column.size() == 0)
+    {
+        return result;
+    }
+
+    auto values = cudf::cast(column, cudf::data_type{cudf::type_id::INT64});
+
+    std::vector<std::int64_t> host_values(column.size());
+    MRC_CHECK_CUDA(cudaMemcpy(host_values.data(),
+                              values->view().data<std::int64_t>(),
+                              host_values.size() * sizeof(std::int64_t),
+                              cudaMemcpyDeviceToHost));
+
+    const auto null_mask = null_mask_to_host(column);
+    for (std::size_t row = 0; row < result.size(); ++row)
+    {
+        if (null_mask.empty() ||
+            cudf::bit_is_set(null_mask.data(), column.offset() + static_cast<cudf::size_type>(row)))
+        {
+            result[row] = host_values[row];
+        }
+    }
+
+    return result;
+}
+
+std::size_t ColumnUtil::num_row_chunks(std::size_t num_rows, std::size_t num_threads, std::size_t min_rows_per_thread)
+{
+    const auto size = chunk_size(num_rows, num_threads, min_rows_per_thread);
+
+    return std::max<std::size_t>(1, (num_rows + size - 1) / size);
+}
+
+void ColumnUtil::parallel_for_rows(std::size_t num_rows,
+                                   std::size_t num_threads,
+                                   const std::function<void(std::size_t, std::size_t, std::size_t)>& fn,
+                                   std::size_t min_rows_per_thread)
+{
+    const auto size       = chunk_size(num_rows, num_threads, min_rows_per_thread);
+    const auto num_chunks = num_row_chunks(num_rows, num_threads, min_rows_per_thread);
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t chunk = 1; chunk < num_chunks; ++chunk)
+    {
+        futures.emplace_back(
+            std::async(std::launch::async, fn, chunk, chunk * size, std::min((chunk + 1) * size, num_rows)));
+    }
+
+    // The calling thread handles the first range
+    fn(0, 0, std::min(size, num_rows));
+    for (auto& future : futures)
+    {
+        future.get();
+    }
+}
+
+cudf::io::table_with_metadata ColumnUtil::parse_strings_column_parallel(const cudf::column_view& column,
+                                                                        std::size_t num_threads,
+                                                                        const parse_rows_fn_t& parse_rows)
+{
+    const HostStringsColumn strings{column};
+
+    // Each range of rows is parsed into its own table, the tables are appended in order once all are parsed
+    std::vector<DecodedTable> tables(num_row_chunks(strings.size(), num_threads));
+    parallel_for_rows(strings.size(), num_threads, [&](std::size_t chunk, std::size_t start, std::size_t stop) {
+        parse_rows(strings, start, stop, tables[chunk]);
+    });
+
+    for (std::size_t chunk = 1; chunk < tables.size(); ++chunk)
+    {
+        tables[0].append(tables[chunk]);
+    }
+
+    return tables[0].to_table();
+}
+
+rmm::device_buffer ColumnUtil::make_null_mask(const std::vector<bool>& valid, cudf::size_type& null_count)
+{
+    std::vector<cudf::bitmask_type> null_mask(cudf::num_bitmask_words(static_cast<cudf::size_type>(valid.size())), 0);
+    null_count = 0;
+
+    for (std::size_t row = 0; row < valid.size(); ++row)
+    {
+        if (valid[row])
+        {
+            null_mask[row / cudf::detail::size_in_bits<cudf::bitmask_type>()] |=
+                cudf::bitmask_type{1} << (row % cudf::detail::size_in_bits<cudf::bitmask_type>());
+        }
+        else
+        {
+            ++null_count;
+        }
+    }
+
+    if (null_count == 0)
+    {
+        return rmm::device_buffer{};
+    }
+
+    return rmm::device_buffer(
+        null_mask.data(), null_mask.size() * sizeof(cudf::bitmask_type), rmm::cuda_stream_per_thread);
+}
+
+std::unique_ptr<cudf::column> ColumnUtil::make_strings_column(const std::string& chars,
+                                                              const std::vector<cudf::size_type>& offsets,
+                                                              const std::vector<bool>& valid)
+{
+    cudf::size_type null_count = 0;
+    auto null_mask             = make_null_mask(valid, null_count);
+
+    return cudf::make_strings_column(static_cast<cudf::size_type>(offsets.size() - 1),
+                                     make_numeric_column(offsets, cudf::type_id::INT32),
+                                     rmm::device_buffer(chars.data(), chars.size(), rmm::cuda_stream_per_thread),
+                                     null_count,
+                                     std::move(null_mask));
+}
+
+std::unique_ptr<cudf::column> ColumnUtil::make_strings_column(const std::vector<std::string>& values)
+{
+    std::string chars;
+    std::vector<cudf::size_type> offsets{0};
+    offsets.reserve(values.size() + 1);
+    for (const auto& value : values)
+    {
+        chars += value;
+        CHECK(chars.size() <= static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()))
+            << "Values exceed the maximum size of a cudf strings column";
+
+        offsets.push_back(static_cast<cudf::size_type>(chars.size()));
+    }
+
+    return make_strings_column(chars, offsets);
+}
+
+std::unique_ptr<cudf::column> ColumnUtil::make_strings_column(const std::vector<std::optional<std::string>>& values)
+{
+    std::string chars;
+    std::vector<cudf::size_type> offsets{0};
+    std::vector<bool> valid;
+    offsets.reserve(values.size() + 1);
+    valid.reserve(values.size());
+    for (const auto& value : values)
+    {
+        if (value.has_value())
+        {
+            chars += *value;
+            CHECK(chars.size() <= static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()))
+                << "Values exceed the maximum size of a cudf strings column";
+        }
+
+        offsets.push_back(static_cast<cudf::size_type>(chars.size()));
+        valid.push_back(value.has_value());
+    }
+
+    return make_strings_column(chars, offsets, valid);
+}
+
+}  // namespace morpheus
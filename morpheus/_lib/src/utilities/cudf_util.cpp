@@ -74,11 +74,11 @@ pybind11::object CudfHelper::table_from_table_info(const TableInfoBase& table_in
     // Get the table info data from the table_into
     auto table_info_data = table_info.get_data();
 
-    auto py_object_parent = table_info.get_parent()->get_py_object();
-
-    // Need to guarantee that we have the gil here
+    // Need to guarantee that we have the gil here, before holding a reference to the python object
     pybind11::gil_scoped_acquire gil;
 
+    auto py_object_parent = table_info.get_parent()->get_py_object();
+
     return pybind11::reinterpret_steal<pybind11::object>(
         (PyObject*)make_table_from_table_info_data(std::move(table_info_data), py_object_parent.ptr()));
 }
@@ -0,0 +1,281 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/dedup_util.hpp"
+
+#include "morpheus/messages/meta.hpp"         // for MessageMeta
+#include "morpheus/objects/dev_mem_info.hpp"  // for DevMemInfo
+#include "morpheus/objects/dtype.hpp"         // for DType
+#include "morpheus/objects/table_info.hpp"    // for TableInfo
+#include "morpheus/objects/tensor.hpp"        // for Tensor
+#include "morpheus/utilities/matx_util.hpp"   // for MatxUtil
+
+#include <cuda_runtime.h>               // for cudaMemcpy, cudaMemcpy2D
+#include <cudf/binaryop.hpp>            // for binary_operation, binary_operator
+#include <cudf/column/column.hpp>       // for column
+#include <cudf/column/column_view.hpp>  // for column_view
+#include <cudf/copying.hpp>             // for gather
+#include <cudf/hashing.hpp>             // for murmurhash3_x86_32
+#include <glog/logging.h>               // for CHECK
+#include <mrc/cuda/common.hpp>          // for MRC_CHECK_CUDA
+#include <rmm/cuda_stream_view.hpp>     // for cuda_stream_per_thread
+#include <rmm/device_buffer.hpp>        // for device_buffer
+
+#include <algorithm>  // for find
+#include <cstddef>    // for size_t
+#include <unordered_map>
+#include <utility>  // for move
+
+namespace {
+using namespace morpheus;
+
+// Seeds for the two 32-bit hashes combined into a single 64-bit row hash
+constexpr std::uint32_t HashSeedHigh = 0;
+constexpr std::uint32_t HashSeedLow  = 0x9e3779b9;
+
+template <typename T>
+std::vector<T> column_to_host(const cudf::column_view& column)
+{
+    CHECK(column.type().id() == DType::create<T>().cudf_type_id())
+        << "Unexpected column type for dedup column, expected " << DType::create<T>().name();
+
+    std::vector<T> host_values(column.size());
+    MRC_CHECK_CUDA(
+        cudaMemcpy(host_values.data(), column.data<T>(), host_values.size() * sizeof(T), cudaMemcpyDeviceToHost));
+
+    return host_values;
+}
+
+}  // namespace
+
+namespace morpheus {
+
+std::vector<TensorIndex> DedupIndex::unique_rows() const
+{
+    std::vector<TensorIndex> rows;
+
+    for (std::size_t i = 0; i < representative.size(); ++i)
+    {
+        if (representative[i] == static_cast<TensorIndex>(i))
+        {
+            rows.push_back(representative[i]);
+        }
+    }
+
+    return rows;
+}
+
+bool DedupIndex::has_duplicates() const
+{
+    for (std::size_t i = 0; i < representative.size(); ++i)
+    {
+        if (representative[i] != static_cast<TensorIndex>(i))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::vector<std::uint64_t> DedupUtil::hash_rows(const cudf::table_view& table)
+{
+    auto high = cudf::hashing::murmurhash3_x86_32(table, HashSeedHigh);
+    auto low  = cudf::hashing::murmurhash3_x86_32(table, HashSeedLow);
+
+    auto host_high = column_to_host<std::uint32_t>(high->view());
+    auto host_low  = column_to_host<std::uint32_t>(low->view());
+
+    std::vector<std::uint64_t> hashes(host_high.size());
+    for (std::size_t i = 0; i < hashes.size(); ++i)
+    {
+        hashes[i] = (static_cast<std::uint64_t>(host_high[i]) << 32) | host_low[i];
+    }
+
+    return hashes;
+}
+
+DedupIndex DedupUtil::build_index(std::vector<std::uint64_t> hashes)
+{
+    DedupIndex index;
+    index.representative.resize(hashes.size());
+
+    std::unordered_map<std::uint64_t, TensorIndex> first_seen;
+    first_seen.reserve(hashes.size());
+
+    for (std::size_t i = 0; i < hashes.size(); ++i)
+    {
+        auto [pos, inserted]    = first_seen.try_emplace(hashes[i], static_cast<TensorIndex>(i));
+        index.representative[i] = pos->second;
+    }
+
+    index.hashes = std::move(hashes);
+
+    return index;
+}
+
+void DedupUtil::verify_index(const cudf::table_view& table, DedupIndex& index)
+{
+    std::vector<TensorIndex> duplicates;
+    std::vector<TensorIndex> representatives;
+    for (std::size_t i = 0; i < index.representative.size(); ++i)
+    {
+        if (index.representative[i] != static_cast<TensorIndex>(i))
+        {
+            duplicates.push_back(static_cast<TensorIndex>(i));
+            representatives.push_back(index.representative[i]);
+        }
+    }
+
+    if (duplicates.empty() || table.num_columns() == 0)
+    {
+        return;
+    }
+
+    auto duplicate_rows      = gather_rows(table, duplicates);
+    auto representative_rows = gather_rows(table, representatives);
+
+    // Rows are equal when all of their columns are, null values being equal to each other
+    const cudf::data_type bool_type{cudf::type_id::BOOL8};
+    std::unique_ptr<cudf::column> equal;
+    for (cudf::size_type i = 0; i < table.num_columns(); ++i)
+    {
+        auto column_equal = cudf::binary_operation(duplicate_rows->get_column(i).view(),
+                                                   representative_rows->get_column(i).view(),
+                                                   cudf::binary_operator::NULL_EQUALS,
+                                                   bool_type);
+
+        if (equal == nullptr)
+        {
+            equal = std::move(column_equal);
+        }
+        else
+        {
+            equal = cudf::binary_operation(
+                equal->view(), column_equal->view(), cudf::binary_operator::LOGICAL_AND, bool_type);
+        }
+    }
+
+    std::vector<std::uint8_t> host_equal(duplicates.size());
+    MRC_CHECK_CUDA(
+        cudaMemcpy(host_equal.data(), equal->view().data<bool>(), host_equal.size(), cudaMemcpyDeviceToHost));
+
+    for (std::size_t i = 0; i < duplicates.size(); ++i)
+    {
+        if (host_equal[i] == 0)
+        {
+            index.representative[duplicates[i]] = duplicates[i];
+        }
+    }
+}
+
+std::optional<DedupIndex> DedupUtil::read_index(const MessageMeta& meta)
+{
+    auto column_names = meta.get_column_names();
+
+    if (std::find(column_names.begin(), column_names.end(), HashColumn) == column_names.end() ||
+        std::find(column_names.begin(), column_names.end(), IndexColumn) == column_names.end())
+    {
+        return std::nullopt;
+    }
+
+    auto info = meta.get_info({HashColumn, IndexColumn});
+
+    DedupIndex index;
+    index.hashes         = column_to_host<std::uint64_t>(info.get_column(0));
+    index.representative = column_to_host<TensorIndex>(info.get_column(1));
+
+    return index;
+}
+
+std::vector<RangeType> DedupUtil::to_row_ranges(const std::vector<TensorIndex>& rows)
+{
+    std::vector<RangeType> ranges;
+
+    for (auto row : rows)
+    {
+        if (!ranges.empty() && ranges.back().second == row)
+        {
+            ++ranges.back().second;
+        }
+        else
+        {
+            ranges.emplace_back(row, row + 1);
+        }
+    }
+
+    return ranges;
+}
+
+std::unique_ptr<cudf::table> DedupUtil::gather_rows(const cudf::table_view& table, const std::vector<TensorIndex>& rows)
+{
+    rmm::device_buffer gather_map_buffer(rows.data(), rows.size() * sizeof(TensorIndex), rmm::cuda_stream_per_thread);
+
+    cudf::column_view gather_map(cudf::data_type{DType::create<TensorIndex>().cudf_type_id()},
+                                 static_cast<cudf::size_type>(rows.size()),
+                                 gather_map_buffer.data(),
+                                 nullptr,
+                                 0);
+
+    return cudf::gather(table, gather_map);
+}
+
+void DedupUtil::remap_seq_ids(TensorObject& seq_ids, const std::vector<TensorIndex>& unique_rows)
+{
+    CHECK(seq_ids.dtype() == DType::create<TensorIndex>())
+        << "seq_ids must be of type " << DType::create<TensorIndex>().name();
+
+    const auto num_rows  = static_cast<std::size_t>(seq_ids.shape(0));
+    const auto item_size = sizeof(TensorIndex);
+    const auto stride    = static_cast<std::size_t>(seq_ids.stride(0));
+
+    std::vector<TensorIndex> host_ids(num_rows);
+    MRC_CHECK_CUDA(cudaMemcpy2D(host_ids.data(),
+                                item_size,
+                                seq_ids.data(),
+                                stride * item_size,
+                                item_size,
+                                num_rows,
+                                cudaMemcpyDeviceToHost));
+
+    for (auto& id : host_ids)
+    {
+        id = unique_rows[id];
+    }
+
+    MRC_CHECK_CUDA(cudaMemcpy2D(seq_ids.data(),
+                                stride * item_size,
+                                host_ids.data(),
+                                item_size,
+                                item_size,
+                                num_rows,
+                                cudaMemcpyHostToDevice));
+}
+
+TensorObject DedupUtil::gather_tensor_rows(const TensorObject& tensor, const std::vector<TensorIndex>& source_rows)
+{
+    auto shape  = tensor.get_shape();
+    auto stride = tensor.get_stride();
+
+    auto buffer = MatxUtil::gather_rows(DevMemInfo{tensor.data(), tensor.dtype(), tensor.get_memory(), shape, stride},
+                                        source_rows);
+
+    return Tensor::create(
+        std::move(buffer), tensor.dtype(), {static_cast<TensorIndex>(source_rows.size()), shape[1]}, {}, 0);
+}
+
+}  // namespace morpheus
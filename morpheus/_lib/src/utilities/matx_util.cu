@@ -19,9 +19,11 @@
 #include "morpheus/utilities/matx_util.hpp"
 
 #include <boost/numeric/conversion/cast.hpp>  // for numeric_cast
+#include <cuda_runtime.h>                     // for cudaMemcpyAsync
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <matx.h>
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
 #include <mrc/cuda/sync.hpp>
 
 #include <array>
@@ -74,6 +76,45 @@ struct MatxUtil__MatxCast
     }
 };
 
+// ************ MatxUtil__MatxCastHalf**************//
+/**
+ * @brief Casts between FLOAT16, which cudf has no type for, and the other numeric types. Dispatched on the non-half
+ * type, `ToHalf` selects the direction of the conversion.
+ */
+template <bool ToHalf>
+struct MatxUtil__MatxCastHalf
+{
+    TensorIndex element_count;
+    rmm::cuda_stream_view stream;
+
+    template <typename T, std::enable_if_t<!cudf::is_numeric<T>()>* = nullptr>
+    void operator()(void* input_data, void* output_data)
+    {
+        throw std::invalid_argument("Unsupported conversion");
+    }
+
+    template <typename T, std::enable_if_t<cudf::is_numeric<T>()>* = nullptr>
+    void operator()(void* input_data, void* output_data)
+    {
+        tensorShape_1d shape({element_count});
+
+        if constexpr (ToHalf)
+        {
+            auto input_tensor  = matx::make_tensor<T>(static_cast<T*>(input_data), shape);
+            auto output_tensor = matx::make_tensor<matx::matxFp16>(static_cast<matx::matxFp16*>(output_data), shape);
+
+            (output_tensor = matx::as_type<matx::matxFp16>(input_tensor)).run(stream.value());
+        }
+        else
+        {
+            auto input_tensor  = matx::make_tensor<matx::matxFp16>(static_cast<matx::matxFp16*>(input_data), shape);
+            auto output_tensor = matx::make_tensor<T>(static_cast<T*>(output_data), shape);
+
+            (output_tensor = matx::as_type<T>(input_tensor)).run(stream.value());
+        }
+    }
+};
+
 // ************ MatxUtil__MatxCreateSegIds**************//
 /**
  * TODO(Documentation)
@@ -365,6 +406,35 @@ struct MatxUtil__MatxReduceMax
         (output_slice = matx::rmax(input_slice.Permute({1, 0}))).run(stream.value());
     }
 };
+
+struct MatxUtil__MatxGatherRows
+{
+    matx::index_t num_input_rows;
+    matx::index_t num_output_rows;
+    matx::index_t num_cols;
+    std::vector<matx::index_t> input_stride;
+    rmm::cuda_stream_view stream;
+
+    template <typename InputT, std::enable_if_t<!cudf::is_numeric<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* output_data, TensorIndex* rows_data)
+    {
+        throw std::invalid_argument("Unsupported conversion");
+    }
+
+    template <typename InputT, std::enable_if_t<cudf::is_numeric<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* output_data, TensorIndex* rows_data)
+    {
+        matx::DefaultDescriptor<2> input_desc{{num_input_rows, num_cols}, {input_stride[0], input_stride[1]}};
+        auto input_tensor = matx::make_tensor<InputT, matx::DefaultDescriptor<2>>(static_cast<InputT*>(input_data),
+                                                                                  std::move(input_desc));
+
+        auto output_tensor =
+            matx::make_tensor<InputT>(static_cast<InputT*>(output_data), tensorShape_2d({num_output_rows, num_cols}));
+        auto rows_tensor = matx::make_tensor<TensorIndex>(rows_data, tensorShape_1d({num_output_rows}));
+
+        (output_tensor = matx::remap<0>(input_tensor, rows_tensor)).run(stream.value());
+    }
+};
 }  // namespace
 
 namespace morpheus {
@@ -377,11 +447,35 @@ std::shared_ptr<rmm::device_buffer> MatxUtil::cast(const DevMemInfo& input, Type
     // Create the output
     auto output = input.make_new_buffer(output_dtype.item_size() * input.count());
 
-    cudf::double_type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
-                                 cudf::data_type{output_dtype.cudf_type_id()},
-                                 MatxUtil__MatxCast{boost::numeric_cast<TensorIndex>(input.count()), output->stream()},
-                                 input.data(),
-                                 output->data());
+    const auto element_count = boost::numeric_cast<TensorIndex>(input.count());
+
+    if (input.dtype().type_id() == TypeId::FLOAT16 && output_type == TypeId::FLOAT16)
+    {
+        MRC_CHECK_CUDA(cudaMemcpyAsync(
+            output->data(), input.data(), output->size(), cudaMemcpyDeviceToDevice, output->stream().value()));
+    }
+    else if (output_type == TypeId::FLOAT16)
+    {
+        cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                              MatxUtil__MatxCastHalf<true>{element_count, output->stream()},
+                              input.data(),
+                              output->data());
+    }
+    else if (input.dtype().type_id() == TypeId::FLOAT16)
+    {
+        cudf::type_dispatcher(cudf::data_type{output_dtype.cudf_type_id()},
+                              MatxUtil__MatxCastHalf<false>{element_count, output->stream()},
+                              input.data(),
+                              output->data());
+    }
+    else
+    {
+        cudf::double_type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                                     cudf::data_type{output_dtype.cudf_type_id()},
+                                     MatxUtil__MatxCast{element_count, output->stream()},
+                                     input.data(),
+                                     output->data());
+    }
 
     mrc::enqueue_stream_sync_event(output->stream()).get();
 
@@ -493,4 +587,24 @@ std::shared_ptr<rmm::device_buffer> MatxUtil::reduce_max(const DevMemInfo& input
     mrc::enqueue_stream_sync_event(output->stream()).get();
     return output;
 }
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::gather_rows(const DevMemInfo& input, const ShapeType& rows)
+{
+    const auto num_output_rows = static_cast<TensorIndex>(rows.size());
+    const auto num_cols        = input.shape(1);
+
+    auto output = input.make_new_buffer(input.dtype().item_size() * num_output_rows * num_cols);
+    rmm::device_buffer rows_buffer(rows.data(), rows.size() * sizeof(TensorIndex), output->stream());
+
+    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                          MatxUtil__MatxGatherRows{
+                              input.shape(0), num_output_rows, num_cols, input.stride(), output->stream()},
+                          input.data(),
+                          output->data(),
+                          static_cast<TensorIndex*>(rows_buffer.data()));
+
+    // `rows_buffer` is released on return
+    mrc::enqueue_stream_sync_event(output->stream()).get();
+    return output;
+}
 }  // namespace morpheus
@@ -0,0 +1,207 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/pcap_util.hpp"
+
+#include "morpheus/utilities/timestamp_util.hpp"  // for TimestampUtil
+
+#include <glog/logging.h>  // for CHECK_EQ
+
+#include <array>          // for array
+#include <cstdio>         // for snprintf
+#include <limits>         // for numeric_limits
+#include <unordered_map>  // for unordered_map
+
+namespace morpheus {
+
+namespace {
+constexpr std::int64_t MicrosecondsPerMinute = 60'000'000;
+constexpr std::int64_t MinutesPerDay         = 24 * 60;
+
+std::int64_t floor_div(std::int64_t value, std::int64_t divisor)
+{
+    auto quotient = value / divisor;
+    return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+}
+
+struct FlowGroup
+{
+    std::array<std::int64_t, 5> flags{};  // ack, psh, rst, syn, fin
+    std::int64_t data_len{0};
+    std::int64_t packets{0};
+};
+}  // namespace
+
+const std::vector<std::string>& PcapUtil::feature_names()
+{
+    static const std::vector<std::string> names{"ack",
+                                                "psh",
+                                                "rst",
+                                                "syn",
+                                                "fin",
+                                                "ppm",
+                                                "data_len",
+                                                "bpp",
+                                                "all",
+                                                "ackpush/all",
+                                                "rst/all",
+                                                "syn/all",
+                                                "fin/all"};
+    return names;
+}
+
+std::int64_t PcapUtil::rollup_time(std::int64_t timestamp)
+{
+    // Python's modulo takes the sign of the divisor
+    auto remainder = timestamp % RollupMicroseconds;
+    if (remainder < 0)
+    {
+        remainder += RollupMicroseconds;
+    }
+
+    const auto secs  = static_cast<double>(RollupMicroseconds);
+    const auto delta = (1.0 - (static_cast<double>(remainder) / secs)) * secs;
+
+    return static_cast<std::int64_t>(static_cast<double>(timestamp) + delta);
+}
+
+std::string PcapUtil::format_minute(std::int64_t timestamp)
+{
+    const auto minutes = floor_div(timestamp, MicrosecondsPerMinute);
+    const auto days    = floor_div(minutes, MinutesPerDay);
+    const auto minute  = minutes - days * MinutesPerDay;
+
+    std::int64_t year;
+    unsigned month;
+    unsigned day;
+    TimestampUtil::civil_from_days(days, year, month, day);
+
+    std::array<char, 32> buffer{};
+    std::snprintf(buffer.data(),
+                  buffer.size(),
+                  "%04lld-%02u-%02u %02d:%02d",
+                  static_cast<long long>(year),
+                  month,
+                  day,
+                  static_cast<int>(minute / 60),
+                  static_cast<int>(minute % 60));
+
+    return buffer.data();
+}
+
+std::string PcapUtil::flow_id(std::string_view src_ip,
+                              std::string_view src_port,
+                              std::string_view dest_ip,
+                              std::string_view dest_port)
+{
+    std::string id;
+    id.reserve(src_ip.size() + src_port.size() + dest_ip.size() + dest_port.size() + 3);
+    id.append(src_ip).append(1, ':').append(src_port).append(1, '=').append(dest_ip).append(1, ':').append(dest_port);
+
+    return id;
+}
+
+PcapFlowFeatures PcapUtil::compute_features(const std::vector<std::int64_t>& timestamps,
+                                            const std::vector<std::int64_t>& flags,
+                                            const std::vector<std::int64_t>& data_len,
+                                            const std::vector<std::optional<std::string>>& flow_ids)
+{
+    const auto num_packets = timestamps.size();
+    CHECK_EQ(flags.size(), num_packets);
+    CHECK_EQ(data_len.size(), num_packets);
+    CHECK_EQ(flow_ids.size(), num_packets);
+
+    PcapFlowFeatures result;
+    result.rollup_time.reserve(num_packets);
+
+    // Group of each packet, -1 for packets without a flow id
+    std::vector<std::int64_t> packet_groups(num_packets, -1);
+    std::vector<FlowGroup> groups;
+    std::unordered_map<std::string, std::int64_t> group_ids;
+
+    std::string key;
+    for (std::size_t i = 0; i < num_packets; ++i)
+    {
+        const auto rollup = rollup_time(timestamps[i]);
+        result.rollup_time.push_back(format_minute(rollup));
+
+        if (!flow_ids[i].has_value())
+        {
+            continue;
+        }
+
+        // The formatted minute identifies the window, the flow id never contains a newline
+        key.assign(result.rollup_time.back()).append(1, '\n').append(*flow_ids[i]);
+
+        auto [found, inserted] = group_ids.try_emplace(key, static_cast<std::int64_t>(groups.size()));
+        if (inserted)
+        {
+            groups.emplace_back();
+        }
+
+        packet_groups[i] = found->second;
+        auto& group      = groups[found->second];
+
+        // Flags are ACK=16, PSH=8, RST=4, SYN=2 and FIN=1
+        for (std::size_t bit = 0; bit < group.flags.size(); ++bit)
+        {
+            group.flags[bit] += (flags[i] >> (4 - bit)) & 1;
+        }
+
+        group.data_len += static_cast<std::int16_t>(data_len[i]);
+        group.packets += 1;
+    }
+
+    const auto num_features = feature_names().size();
+    result.features.assign(num_packets * num_features, std::numeric_limits<float>::quiet_NaN());
+
+    for (std::size_t i = 0; i < num_packets; ++i)
+    {
+        if (packet_groups[i] < 0)
+        {
+            continue;
+        }
+
+        const auto& group = groups[packet_groups[i]];
+        const auto ack    = static_cast<double>(group.flags[0]);
+        const auto psh    = static_cast<double>(group.flags[1]);
+        const auto rst    = static_cast<double>(group.flags[2]);
+        const auto syn    = static_cast<double>(group.flags[3]);
+        const auto fin    = static_cast<double>(group.flags[4]);
+        const auto all    = ack + psh + rst + syn + fin;
+
+        // Ratios are computed in double precision before being narrowed, as the Python stage does
+        auto* row = result.features.data() + i * num_features;
+        row[0]    = static_cast<float>(ack);
+        row[1]    = static_cast<float>(psh);
+        row[2]    = static_cast<float>(rst);
+        row[3]    = static_cast<float>(syn);
+        row[4]    = static_cast<float>(fin);
+        row[5]    = static_cast<float>(group.packets);
+        row[6]    = static_cast<float>(group.data_len);
+        row[7]    = static_cast<float>(static_cast<double>(group.data_len) / static_cast<double>(group.packets));
+        row[8]    = static_cast<float>(all);
+        row[9]    = static_cast<float>((ack + psh) / all);
+        row[10]   = static_cast<float>(rst / all);
+        row[11]   = static_cast<float>(syn / all);
+        row[12]   = static_cast<float>(fin / all);
+    }
+
+    return result;
+}
+
+}  // namespace morpheus
@@ -0,0 +1,839 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/pii_util.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <algorithm>  // for all_of, count, max, sort, transform
+#include <array>
+#include <cctype>     // for isspace, tolower
+#include <stdexcept>  // for invalid_argument
+#include <tuple>      // for tie
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+using namespace morpheus;
+
+// Labels are limited to 63 characters by RFC 1035
+constexpr std::size_t MaxLabelLength = 63;
+
+// Common file extensions, two label names ending in one of these are never treated as hostnames
+const std::unordered_set<std::string> FileExtensions{
+    "bat", "cfg", "conf", "csv", "dll", "doc", "docx", "exe", "gz", "htm", "html", "ini", "jar", "js", "json",
+    "log", "pdf", "png", "ps1", "py", "sh", "sys", "tar", "tmp", "txt", "xls", "xlsx", "xml", "yaml", "yml", "zip"};
+
+bool is_alpha(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+bool is_alnum(char c)
+{
+    return is_alpha(c) || is_digit(c);
+}
+
+bool is_hex(char c)
+{
+    return is_digit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+bool is_word(char c)
+{
+    return is_alnum(c) || c == '_';
+}
+
+// Characters which can continue one of the entities, scanners only start where the previous character is not one of
+// these to avoid matching the tail end of a longer token
+bool is_token_char(char c)
+{
+    return is_word(c) || c == '.' || c == '-' || c == '@' || c == '%' || c == '+';
+}
+
+bool is_email_local_char(char c)
+{
+    return is_word(c) || c == '.' || c == '%' || c == '+' || c == '-';
+}
+
+std::string to_lower(std::string_view value)
+{
+    std::string lower(value);
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+
+    return lower;
+}
+
+/**
+ * @brief Result of scanning a dot separated sequence of DNS labels
+ */
+struct DomainScan
+{
+    std::size_t end{0};
+    std::size_t num_labels{0};
+    std::string_view last_label;
+};
+
+DomainScan scan_domain(std::string_view text, std::size_t pos)
+{
+    DomainScan result;
+    std::size_t i = pos;
+
+    while (i < text.size())
+    {
+        std::size_t label_start = i;
+        while (i < text.size() && (is_alnum(text[i]) || text[i] == '-') && i - label_start < MaxLabelLength)
+        {
+            ++i;
+        }
+
+        if (i == label_start || text[label_start] == '-' || text[i - 1] == '-')
+        {
+            // Invalid label, backtrack to the end of the previous label
+            break;
+        }
+
+        result.end        = i;
+        result.last_label = text.substr(label_start, i - label_start);
+        ++result.num_labels;
+
+        if (i + 1 < text.size() && text[i] == '.' && is_alnum(text[i + 1]))
+        {
+            ++i;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
+bool is_tld_like(std::string_view label)
+{
+    return label.size() >= 2 && std::all_of(label.begin(), label.end(), is_alpha);
+}
+
+std::size_t scan_email(std::string_view text, std::size_t pos)
+{
+    if (!is_word(text[pos]))
+    {
+        return 0;
+    }
+
+    std::size_t i = pos;
+    while (i < text.size() && is_email_local_char(text[i]))
+    {
+        ++i;
+    }
+
+    if (i >= text.size() || text[i] != '@')
+    {
+        return 0;
+    }
+
+    auto domain = scan_domain(text, i + 1);
+    if (domain.num_labels < 2 || !is_tld_like(domain.last_label))
+    {
+        return 0;
+    }
+
+    return domain.end;
+}
+
+std::size_t scan_ipv4(std::string_view text, std::size_t pos)
+{
+    std::size_t i = pos;
+
+    for (int octet = 0; octet < 4; ++octet)
+    {
+        if (octet > 0)
+        {
+            if (i >= text.size() || text[i] != '.')
+            {
+                return 0;
+            }
+            ++i;
+        }
+
+        std::size_t start = i;
+        int value         = 0;
+        while (i < text.size() && is_digit(text[i]) && i - start < 3)
+        {
+            value = value * 10 + (text[i] - '0');
+            ++i;
+        }
+
+        if (i == start || value > 255)
+        {
+            return 0;
+        }
+    }
+
+    // Reject longer dotted numbers such as version strings
+    if (i < text.size() && (is_alnum(text[i]) || (text[i] == '.' && i + 1 < text.size() && is_digit(text[i + 1]))))
+    {
+        return 0;
+    }
+
+    return i;
+}
+
+std::size_t scan_ipv6(std::string_view text, std::size_t pos)
+{
+    std::size_t end = pos;
+    while (end < text.size() && (is_hex(text[end]) || text[end] == ':' || text[end] == '.'))
+    {
+        ++end;
+    }
+
+    // A trailing '.' or single ':' is punctuation rather than part of the address
+    while (end > pos && (text[end - 1] == '.' || (text[end - 1] == ':' && (end - pos < 2 || text[end - 2] != ':'))))
+    {
+        --end;
+    }
+
+    if (end < text.size() && is_alnum(text[end]))
+    {
+        return 0;
+    }
+
+    auto candidate = text.substr(pos, end - pos);
+    if (std::count(candidate.begin(), candidate.end(), ':') < 2)
+    {
+        return 0;
+    }
+
+    std::size_t num_groups = 0;
+    bool compressed        = false;
+    std::size_t i          = 0;
+
+    if (candidate.substr(0, 2) == "::")
+    {
+        compressed = true;
+        i          = 2;
+    }
+    else if (candidate[0] == ':')
+    {
+        return 0;
+    }
+
+    while (i < candidate.size())
+    {
+        std::size_t group_start = i;
+        while (i < candidate.size() && is_hex(candidate[i]))
+        {
+            ++i;
+        }
+
+        if (i < candidate.size() && candidate[i] == '.')
+        {
+            // Embedded IPv4 address, must be the final group
+            auto ipv4_end = scan_ipv4(candidate, group_start);
+            if (ipv4_end != candidate.size())
+            {
+                return 0;
+            }
+
+            num_groups += 2;
+            i = candidate.size();
+            break;
+        }
+
+        if (i == group_start || i - group_start > 4)
+        {
+            return 0;
+        }
+
+        ++num_groups;
+
+        if (i == candidate.size())
+        {
+            break;
+        }
+
+        // candidate[i] == ':'
+        if (i + 1 < candidate.size() && candidate[i + 1] == ':')
+        {
+            if (compressed)
+            {
+                return 0;
+            }
+
+            compressed = true;
+            i += 2;
+        }
+        else
+        {
+            ++i;
+            if (i == candidate.size())
+            {
+                return 0;
+            }
+        }
+    }
+
+    if ((compressed && num_groups > 7) || (!compressed && num_groups != 8))
+    {
+        return 0;
+    }
+
+    return end;
+}
+
+std::size_t scan_credit_card(std::string_view text, std::size_t pos)
+{
+    // Digit groups are separated by a single space or dash. A card number may be followed by more digits, such as a
+    // quantity, each group ending 13 to 19 digits in is a candidate and the longest one passing the Luhn check wins.
+    std::size_t i          = pos;
+    std::size_t num_digits = 0;
+    std::size_t end        = 0;
+
+    while (i < text.size() && is_digit(text[i]) && num_digits < 19)
+    {
+        ++num_digits;
+        ++i;
+
+        const bool group_end = i == text.size() || !is_digit(text[i]);
+        if (group_end && num_digits >= 13 && (i == text.size() || !is_alnum(text[i])) &&
+            PiiUtil::luhn_valid(text.substr(pos, i - pos)))
+        {
+            end = i;
+        }
+
+        if (i + 1 < text.size() && (text[i] == ' ' || text[i] == '-') && is_digit(text[i + 1]))
+        {
+            ++i;
+        }
+    }
+
+    return end;
+}
+
+std::size_t scan_hostname(std::string_view text, std::size_t pos)
+{
+    if (!is_alnum(text[pos]))
+    {
+        return 0;
+    }
+
+    auto domain = scan_domain(text, pos);
+    if (domain.num_labels < 2 || !is_tld_like(domain.last_label))
+    {
+        return 0;
+    }
+
+    if (domain.end < text.size() && (is_word(text[domain.end]) || text[domain.end] == '@'))
+    {
+        return 0;
+    }
+
+    static const std::unordered_set<std::string> HostnameTlds(PiiUtil::hostname_tlds().begin(),
+                                                              PiiUtil::hostname_tlds().end());
+
+    auto tld = to_lower(domain.last_label);
+    if (HostnameTlds.count(tld) == 0 && (domain.num_labels < 3 || FileExtensions.count(tld) > 0))
+    {
+        return 0;
+    }
+
+    return domain.end;
+}
+
+bool is_username_value_char(char c)
+{
+    return !(std::isspace(static_cast<unsigned char>(c)) || c == '"' || c == '\'' || c == ',' || c == ';' ||
+             c == '&' || c == '|');
+}
+
+// Matches `user=alice`, `username: "alice"` and `CORP\alice` returning the range of the user name
+std::pair<std::size_t, std::size_t> scan_username(std::string_view text, std::size_t pos)
+{
+    std::size_t i = pos;
+    while (i < text.size() && (is_word(text[i]) || text[i] == '.' || text[i] == '-'))
+    {
+        ++i;
+    }
+
+    if (i == pos || i >= text.size())
+    {
+        return {0, 0};
+    }
+
+    if (text[i] == '\\')
+    {
+        if (pos > 0 && (text[pos - 1] == '\\' || text[pos - 1] == ':' || text[pos - 1] == '/'))
+        {
+            // Part of a file path rather than a DOMAIN\user pair
+            return {0, 0};
+        }
+
+        std::size_t user_start = i + 1;
+        std::size_t user_end   = user_start;
+        while (user_end < text.size() &&
+               (is_word(text[user_end]) || text[user_end] == '.' || text[user_end] == '-' || text[user_end] == '$'))
+        {
+            ++user_end;
+        }
+
+        if (user_end == user_start || (user_end < text.size() && text[user_end] == '\\'))
+        {
+            return {0, 0};
+        }
+
+        return {user_start, user_end};
+    }
+
+    static const std::unordered_set<std::string> UsernameKeys(PiiUtil::username_keys().begin(),
+                                                              PiiUtil::username_keys().end());
+
+    if (UsernameKeys.count(to_lower(text.substr(pos, i - pos))) == 0)
+    {
+        return {0, 0};
+    }
+
+    while (i < text.size() && text[i] == ' ')
+    {
+        ++i;
+    }
+
+    if (i >= text.size() || (text[i] != '=' && text[i] != ':'))
+    {
+        return {0, 0};
+    }
+    ++i;
+
+    while (i < text.size() && (text[i] == ' ' || text[i] == '"' || text[i] == '\''))
+    {
+        ++i;
+    }
+
+    std::size_t value_start = i;
+    while (i < text.size() && is_username_value_char(text[i]))
+    {
+        ++i;
+    }
+
+    if (i == value_start)
+    {
+        return {0, 0};
+    }
+
+    return {value_start, i};
+}
+
+std::uint64_t rotl(std::uint64_t x, int b)
+{
+    return (x << b) | (x >> (64 - b));
+}
+
+void sip_round(std::uint64_t& v0, std::uint64_t& v1, std::uint64_t& v2, std::uint64_t& v3)
+{
+    v0 += v1;
+    v1 = rotl(v1, 13);
+    v1 ^= v0;
+    v0 = rotl(v0, 32);
+    v2 += v3;
+    v3 = rotl(v3, 16);
+    v3 ^= v2;
+    v0 += v3;
+    v3 = rotl(v3, 21);
+    v3 ^= v0;
+    v2 += v1;
+    v1 = rotl(v1, 17);
+    v1 ^= v2;
+    v2 = rotl(v2, 32);
+}
+
+}  // namespace
+
+namespace morpheus {
+
+// Component public implementations
+// ************ PiiEntity ********************************** //
+std::vector<std::string> PiiEntity::all()
+{
+    return {Email, IpAddress, CreditCard, Username, Hostname};
+}
+
+// ************ PiiMasker ********************************** //
+struct PiiMasker::TrieNode
+{
+    std::unordered_map<char, std::unique_ptr<TrieNode>> children;
+    std::string label;
+    bool terminal{false};
+};
+
+PiiMasker::PiiMasker(const std::vector<std::string>& entities,
+                     const std::map<std::string, std::string>& literals,
+                     const std::map<std::string, std::string>& patterns,
+                     bool pseudonymize,
+                     const std::string& key) :
+  m_email(false),
+  m_ip_address(false),
+  m_credit_card(false),
+  m_username(false),
+  m_hostname(false),
+  m_pseudonymize(pseudonymize)
+{
+    for (const auto& entity : entities)
+    {
+        if (entity == PiiEntity::Email)
+        {
+            m_email = true;
+        }
+        else if (entity == PiiEntity::IpAddress)
+        {
+            m_ip_address = true;
+        }
+        else if (entity == PiiEntity::CreditCard)
+        {
+            m_credit_card = true;
+        }
+        else if (entity == PiiEntity::Username)
+        {
+            m_username = true;
+        }
+        else if (entity == PiiEntity::Hostname)
+        {
+            m_hostname = true;
+        }
+        else
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unknown PII entity '" << entity << "'"));
+        }
+    }
+
+    if (!literals.empty())
+    {
+        m_literals = std::make_shared<TrieNode>();
+
+        for (const auto& [literal, label] : literals)
+        {
+            if (literal.empty())
+            {
+                throw std::invalid_argument("PII literals must not be empty");
+            }
+
+            auto* node = m_literals.get();
+            for (char c : literal)
+            {
+                auto& child = node->children[c];
+                if (!child)
+                {
+                    child = std::make_unique<TrieNode>();
+                }
+                node = child.get();
+            }
+
+            node->terminal = true;
+            node->label    = label;
+        }
+    }
+
+    for (const auto& [pattern, label] : patterns)
+    {
+        try
+        {
+            m_patterns.emplace_back(GrokMatcher(GrokLibrary(), {pattern}), label);
+        } catch (const std::invalid_argument& e)
+        {
+            throw std::invalid_argument(MORPHEUS_CONCAT_STR("Invalid PII pattern '" << pattern << "': " << e.what()));
+        }
+    }
+
+    if (m_pseudonymize)
+    {
+        if (key.empty())
+        {
+            throw std::invalid_argument("A key is required to pseudonymize PII");
+        }
+
+        std::tie(m_key0, m_key1) = PiiUtil::derive_key(key);
+    }
+}
+
+std::size_t PiiMasker::match_literal(std::string_view text, std::size_t pos, std::string& label) const
+{
+    std::size_t longest = 0;
+    const auto* node    = m_literals.get();
+
+    for (std::size_t i = pos; i < text.size(); ++i)
+    {
+        auto found = node->children.find(text[i]);
+        if (found == node->children.end())
+        {
+            break;
+        }
+
+        node = found->second.get();
+
+        // Literals ending in a word character must end on a word boundary
+        if (node->terminal && (!is_word(text[i]) || i + 1 == text.size() || !is_word(text[i + 1])))
+        {
+            longest = i + 1;
+            label   = node->label;
+        }
+    }
+
+    return longest;
+}
+
+std::vector<PiiMatch> PiiMasker::scan(std::string_view text) const
+{
+    std::vector<PiiMatch> pattern_matches;
+    for (const auto& [matcher, label] : m_patterns)
+    {
+        std::size_t start = 0;
+        while (auto found = matcher.find(text, start))
+        {
+            if (found->end > found->begin)
+            {
+                pattern_matches.push_back({found->begin, found->end, label});
+            }
+
+            // Empty matches are skipped, the search resumes at the next byte
+            start = std::max(found->end, found->begin + 1);
+        }
+    }
+
+    std::sort(pattern_matches.begin(), pattern_matches.end(), [](const PiiMatch& a, const PiiMatch& b) {
+        return a.begin < b.begin;
+    });
+
+    std::vector<PiiMatch> matches;
+    std::size_t next_pattern = 0;
+    std::size_t i            = 0;
+
+    while (i < text.size())
+    {
+        while (next_pattern < pattern_matches.size() && pattern_matches[next_pattern].begin < i)
+        {
+            ++next_pattern;
+        }
+
+        if (next_pattern < pattern_matches.size() && pattern_matches[next_pattern].begin == i)
+        {
+            i = pattern_matches[next_pattern].end;
+            matches.push_back(std::move(pattern_matches[next_pattern]));
+            continue;
+        }
+
+        std::size_t end = 0;
+        std::string label;
+
+        if (m_literals && (i == 0 || !is_word(text[i - 1])))
+        {
+            end = match_literal(text, i, label);
+        }
+
+        if (end == 0 && (i == 0 || !is_token_char(text[i - 1])))
+        {
+            if (m_email && (end = scan_email(text, i)) > 0)
+            {
+                label = PiiEntity::Email;
+            }
+            else if (m_ip_address && ((end = scan_ipv4(text, i)) > 0 || (end = scan_ipv6(text, i)) > 0))
+            {
+                label = PiiEntity::IpAddress;
+            }
+            else if (m_credit_card && (end = scan_credit_card(text, i)) > 0)
+            {
+                label = PiiEntity::CreditCard;
+            }
+            else if (m_hostname && (end = scan_hostname(text, i)) > 0)
+            {
+                label = PiiEntity::Hostname;
+            }
+            else if (m_username)
+            {
+                auto [value_begin, value_end] = scan_username(text, i);
+                if (value_end > 0)
+                {
+                    matches.push_back({value_begin, value_end, PiiEntity::Username});
+                    i = value_end;
+                    continue;
+                }
+            }
+        }
+
+        if (end > 0)
+        {
+            matches.push_back({i, end, std::move(label)});
+            i = end;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    return matches;
+}
+
+void PiiMasker::mask_into(std::string_view text, std::string& output) const
+{
+    std::size_t last = 0;
+    for (const auto& match : scan(text))
+    {
+        output.append(text.substr(last, match.begin - last));
+        output.append(replacement(match.label, text.substr(match.begin, match.end - match.begin)));
+        last = match.end;
+    }
+
+    output.append(text.substr(last));
+}
+
+std::string PiiMasker::mask(std::string_view text) const
+{
+    std::string output;
+    output.reserve(text.size());
+    mask_into(text, output);
+
+    return output;
+}
+
+std::string PiiMasker::replacement(std::string_view label, std::string_view value) const
+{
+    if (!m_pseudonymize)
+    {
+        return MORPHEUS_CONCAT_STR("[" << label << "]");
+    }
+
+    static constexpr std::array<char, 16> HexDigits{
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+    auto hash = PiiUtil::siphash(m_key0, m_key1, value);
+
+    std::string pseudonym(label);
+    pseudonym.push_back('_');
+    for (int shift = 60; shift >= 0; shift -= 4)
+    {
+        pseudonym.push_back(HexDigits[(hash >> shift) & 0xf]);
+    }
+
+    return pseudonym;
+}
+
+// ************ PiiUtil ************************************ //
+bool PiiUtil::luhn_valid(std::string_view number)
+{
+    int sum         = 0;
+    bool double_it  = false;
+    int digit_count = 0;
+
+    for (auto it = number.rbegin(); it != number.rend(); ++it)
+    {
+        if (!is_digit(*it))
+        {
+            continue;
+        }
+
+        int digit = *it - '0';
+        if (double_it)
+        {
+            digit *= 2;
+            if (digit > 9)
+            {
+                digit -= 9;
+            }
+        }
+
+        sum += digit;
+        double_it = !double_it;
+        ++digit_count;
+    }
+
+    return digit_count > 0 && sum % 10 == 0;
+}
+
+std::uint64_t PiiUtil::siphash(std::uint64_t key0, std::uint64_t key1, std::string_view data)
+{
+    std::uint64_t v0 = 0x736f6d6570736575ULL ^ key0;
+    std::uint64_t v1 = 0x646f72616e646f6dULL ^ key1;
+    std::uint64_t v2 = 0x6c7967656e657261ULL ^ key0;
+    std::uint64_t v3 = 0x7465646279746573ULL ^ key1;
+
+    const auto* bytes     = reinterpret_cast<const unsigned char*>(data.data());
+    const std::size_t len = data.size();
+    const std::size_t end = len - (len % 8);
+
+    for (std::size_t i = 0; i < end; i += 8)
+    {
+        std::uint64_t m = 0;
+        for (int b = 7; b >= 0; --b)
+        {
+            m = (m << 8) | bytes[i + b];
+        }
+
+        v3 ^= m;
+        sip_round(v0, v1, v2, v3);
+        sip_round(v0, v1, v2, v3);
+        v0 ^= m;
+    }
+
+    std::uint64_t last = static_cast<std::uint64_t>(len & 0xff) << 56;
+    for (std::size_t i = end; i < len; ++i)
+    {
+        last |= static_cast<std::uint64_t>(bytes[i]) << (8 * (i - end));
+    }
+
+    v3 ^= last;
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    v0 ^= last;
+
+    v2 ^= 0xff;
+    for (int r = 0; r < 4; ++r)
+    {
+        sip_round(v0, v1, v2, v3);
+    }
+
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+const std::vector<std::string>& PiiUtil::username_keys()
+{
+    static const std::vector<std::string> Keys{
+        "account", "dst_user", "duser", "login", "logon_user", "src_user", "suser", "user", "user_name", "username"};
+
+    return Keys;
+}
+
+const std::vector<std::string>& PiiUtil::hostname_tlds()
+{
+    static const std::vector<std::string> Tlds{"arpa", "biz",      "co", "com", "corp",  "de",  "edu",
+                                               "gov",  "home",     "info", "int", "internal", "io", "lan",
+                                               "local", "mil",     "net", "org", "uk",    "us"};
+
+    return Tlds;
+}
+
+std::pair<std::uint64_t, std::uint64_t> PiiUtil::derive_key(std::string_view key)
+{
+    return {siphash(0, 0, key), siphash(0, 1, key)};
+}
+
+}  // namespace morpheus
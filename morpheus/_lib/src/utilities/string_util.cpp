@@ -17,10 +17,129 @@
 
 #include "morpheus/utilities/string_util.hpp"
 
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <iomanip>  // for setw, setfill
+#include <string_view>
+#include <utility>  // for move
+
 namespace morpheus {
+
+namespace {
+constexpr std::string_view ReplacementCharacter = "\xEF\xBF\xBD";
+
+// Number of bytes of `text` from `pos` which start a valid UTF-8 sequence, `valid` is set when they form a complete
+// sequence
+std::size_t utf8_prefix(const std::string& text, std::size_t pos, bool& valid)
+{
+    const auto lead = static_cast<unsigned char>(text[pos]);
+
+    valid = lead < 0x80;
+    if (valid)
+    {
+        return 1;
+    }
+
+    // Length of the sequence and range of its second byte, the remaining bytes are in [0x80, 0xBF]
+    std::size_t length;
+    unsigned char low  = 0x80;
+    unsigned char high = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF)
+    {
+        length = 2;
+    }
+    else if (lead >= 0xE0 && lead <= 0xEF)
+    {
+        length = 3;
+        low    = lead == 0xE0 ? 0xA0 : 0x80;
+        high   = lead == 0xED ? 0x9F : 0xBF;
+    }
+    else if (lead >= 0xF0 && lead <= 0xF4)
+    {
+        length = 4;
+        low    = lead == 0xF0 ? 0x90 : 0x80;
+        high   = lead == 0xF4 ? 0x8F : 0xBF;
+    }
+    else
+    {
+        return 1;
+    }
+
+    std::size_t matched = 1;
+    while (matched < length && pos + matched < text.size())
+    {
+        const auto byte = static_cast<unsigned char>(text[pos + matched]);
+        if (byte < low || byte > high)
+        {
+            break;
+        }
+
+        low  = 0x80;
+        high = 0xBF;
+        ++matched;
+    }
+
+    valid = matched == length;
+
+    return matched;
+}
+}  // namespace
+
 bool StringUtil::str_contains(const std::string& str, const std::string& search_str)
 {
     return str.find(search_str) != std::string::npos;
 }
 
+bool StringUtil::replace_invalid_utf8(std::string& text)
+{
+    // Most texts are valid, they are only copied once an invalid sequence is found
+    std::string replaced;
+    std::size_t copied = 0;
+    std::size_t pos    = 0;
+    while (pos < text.size())
+    {
+        bool valid;
+        const auto length = utf8_prefix(text, pos, valid);
+        if (!valid)
+        {
+            replaced.append(text, copied, pos - copied);
+            replaced.append(ReplacementCharacter);
+            copied = pos + length;
+        }
+
+        pos += length;
+    }
+
+    if (copied == 0)
+    {
+        return false;
+    }
+
+    replaced.append(text, copied);
+    text = std::move(replaced);
+
+    return true;
+}
+
+std::string StringUtil::hash_fields(std::initializer_list<std::string_view> fields)
+{
+    constexpr std::uint64_t OffsetBasis = 0xcbf29ce484222325ULL;
+    constexpr std::uint64_t Prime       = 0x100000001b3ULL;
+
+    std::uint64_t hash = OffsetBasis;
+    for (const auto& field : fields)
+    {
+        for (const unsigned char c : field)
+        {
+            hash = (hash ^ c) * Prime;
+        }
+
+        hash = (hash ^ 0xffU) * Prime;
+    }
+
+    std::ostringstream key;
+    key << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return key.str();
+}
+
 }  // namespace morpheus
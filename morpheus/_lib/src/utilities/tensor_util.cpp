@@ -21,11 +21,179 @@
 #include <mrc/utils/sort_indexes.hpp>  // for sort_indexes
                                        // clang-format off
 // prevent from moving this into the third-party section
+#include <cmath>                  // for ldexp
+#include <cstddef>                // for size_t
+#include <cstdint>                // for uint8_t, uint16_t, uint32_t
+#include <cstring>                // for memcpy
 #include <experimental/iterator>  // for make_ostream_joiner
 #include <ostream>      // for operator<<, ostream, stringstream
+#include <stdexcept>    // for invalid_argument
 #include <string>       // for char_traits, string
+#include <type_traits>  // for is_same_v
 #include <vector>       // for vector
 
+namespace {
+using namespace morpheus;
+
+// Host stand-ins for the FLOAT16 and BOOL8 types, which have no C++ arithmetic type with the same representation
+struct HostHalf
+{
+    std::uint16_t bits;
+};
+
+struct HostBool
+{
+    std::uint8_t value;
+};
+
+float half_to_float(std::uint16_t half)
+{
+    const std::uint32_t sign     = (half & 0x8000U) << 16;
+    const std::uint32_t exponent = (half >> 10) & 0x1fU;
+    const std::uint32_t mantissa = half & 0x3ffU;
+
+    if (exponent == 0)
+    {
+        // Zero or subnormal, mantissa * 2^-24
+        const float value = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign != 0 ? -value : value;
+    }
+
+    std::uint32_t bits = sign | (mantissa << 13);
+    bits |= exponent == 0x1fU ? 0x7f800000U : (exponent + 127 - 15) << 23;
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::uint16_t float_to_half(float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const auto sign         = static_cast<std::uint16_t>((bits >> 16) & 0x8000U);
+    const std::uint32_t abs = bits & 0x7fffffffU;
+
+    // Infinity and NaN
+    if (abs >= 0x7f800000U)
+    {
+        return static_cast<std::uint16_t>(sign | 0x7c00U | (abs > 0x7f800000U ? 0x200U : 0U));
+    }
+
+    // Rounds to 65520 or more, past the largest half
+    if (abs >= 0x477ff000U)
+    {
+        return static_cast<std::uint16_t>(sign | 0x7c00U);
+    }
+
+    std::uint32_t half;
+    std::uint32_t remainder;
+    std::uint32_t halfway;
+
+    if (abs < 0x38800000U)
+    {
+        // Below the smallest normal half, values under 2^-25 round to zero
+        if (abs < 0x33000000U)
+        {
+            return sign;
+        }
+
+        const std::uint32_t mantissa = (abs & 0x7fffffU) | 0x800000U;
+        const std::uint32_t shift    = 126 - (abs >> 23);
+
+        half      = mantissa >> shift;
+        remainder = mantissa & ((1U << shift) - 1);
+        halfway   = 1U << (shift - 1);
+    }
+    else
+    {
+        half      = (abs >> 13) - ((127 - 15) << 10);
+        remainder = abs & 0x1fffU;
+        halfway   = 0x1000U;
+    }
+
+    // Round to nearest, ties to even, a carry out of the mantissa correctly increments the exponent
+    if (remainder > halfway || (remainder == halfway && (half & 1U) != 0))
+    {
+        ++half;
+    }
+
+    return static_cast<std::uint16_t>(sign | half);
+}
+
+template <typename T>
+auto load_host_value(const T& value)
+{
+    if constexpr (std::is_same_v<T, HostHalf>)
+    {
+        return half_to_float(value.bits);
+    }
+    else if constexpr (std::is_same_v<T, HostBool>)
+    {
+        return value.value != 0;
+    }
+    else
+    {
+        return value;
+    }
+}
+
+template <typename T, typename ValueT>
+T store_host_value(ValueT value)
+{
+    if constexpr (std::is_same_v<T, HostHalf>)
+    {
+        return HostHalf{float_to_half(static_cast<float>(value))};
+    }
+    else if constexpr (std::is_same_v<T, HostBool>)
+    {
+        return HostBool{static_cast<std::uint8_t>(value != 0)};
+    }
+    else
+    {
+        return static_cast<T>(value);
+    }
+}
+
+/**
+ * @brief Invokes `func` with a value of the host type holding elements of `type_id`
+ */
+template <typename FuncT>
+void dispatch_host_type(TypeId type_id, FuncT&& func)
+{
+    switch (type_id)
+    {
+    case TypeId::INT8:
+        return func(std::int8_t{});
+    case TypeId::INT16:
+        return func(std::int16_t{});
+    case TypeId::INT32:
+        return func(std::int32_t{});
+    case TypeId::INT64:
+        return func(std::int64_t{});
+    case TypeId::UINT8:
+        return func(std::uint8_t{});
+    case TypeId::UINT16:
+        return func(std::uint16_t{});
+    case TypeId::UINT32:
+        return func(std::uint32_t{});
+    case TypeId::UINT64:
+        return func(std::uint64_t{});
+    case TypeId::FLOAT16:
+        return func(HostHalf{});
+    case TypeId::FLOAT32:
+        return func(float{});
+    case TypeId::FLOAT64:
+        return func(double{});
+    case TypeId::BOOL8:
+        return func(HostBool{});
+    default:
+        throw std::invalid_argument("Unsupported conversion");
+    }
+}
+}  // namespace
+
 namespace morpheus {
 void TensorUtils::write_shape_to_stream(const ShapeType& shape, std::ostream& os)
 {
@@ -81,4 +249,76 @@ bool TensorUtils::validate_shape_and_stride(const ShapeType& shape,
     return true;
 }
 
+std::vector<RangeType> TensorUtils::split_seq_id_batches(const ShapeType& seq_ids, TensorIndex max_batch_size)
+{
+    std::vector<RangeType> batches;
+
+    if (seq_ids.empty())
+    {
+        return batches;
+    }
+
+    // Start offsets of each message in the tensor rows followed by the total row count
+    ShapeType message_starts{0};
+    for (std::size_t i = 1; i < seq_ids.size(); ++i)
+    {
+        if (seq_ids[i] != seq_ids[i - 1])
+        {
+            message_starts.push_back(static_cast<TensorIndex>(i));
+        }
+    }
+    message_starts.push_back(static_cast<TensorIndex>(seq_ids.size()));
+
+    std::size_t head = 0;
+    std::size_t tail = 0;
+
+    for (std::size_t i = 1; i < message_starts.size(); ++i)
+    {
+        if (message_starts[i] - message_starts[head] > max_batch_size && tail > head)
+        {
+            batches.emplace_back(message_starts[head], message_starts[tail]);
+            head = tail;
+        }
+
+        tail = i;
+    }
+
+    batches.emplace_back(message_starts[head], message_starts[tail]);
+
+    return batches;
+}
+
+std::vector<uint8_t> TensorUtils::cast_host(const std::vector<uint8_t>& input,
+                                            const DType& input_type,
+                                            const DType& output_type)
+{
+    if (input_type == output_type)
+    {
+        return input;
+    }
+
+    const auto count = input.size() / input_type.item_size();
+    std::vector<uint8_t> output(count * output_type.item_size());
+
+    dispatch_host_type(input_type.type_id(), [&](auto input_tag) {
+        using InputT = decltype(input_tag);
+
+        dispatch_host_type(output_type.type_id(), [&](auto output_tag) {
+            using OutputT = decltype(output_tag);
+
+            // Copied value by value, the buffers carry no alignment guarantee for the element types
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                InputT value;
+                std::memcpy(&value, input.data() + i * sizeof(InputT), sizeof(InputT));
+
+                const auto converted = store_host_value<OutputT>(load_host_value(value));
+                std::memcpy(output.data() + i * sizeof(OutputT), &converted, sizeof(OutputT));
+            }
+        });
+    });
+
+    return output;
+}
+
 }  // namespace morpheus
@@ -0,0 +1,980 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/timestamp_util.hpp"
+
+#include <array>
+#include <chrono>  // for system_clock
+#include <cstddef>
+#include <map>
+
+namespace morpheus {
+
+namespace {
+constexpr std::int64_t NanosPerSecond = 1'000'000'000;
+constexpr std::int64_t SecondsPerDay  = 86'400;
+
+// FILETIME of the Unix epoch
+constexpr std::int64_t FileTimeEpoch = 116'444'736'000'000'000;
+
+// Years representable in nanoseconds as an int64, the same range as pandas.Timestamp
+constexpr std::int64_t MinYear = 1678;
+constexpr std::int64_t MaxYear = 2261;
+
+constexpr std::array<std::string_view, 12> MonthNames{
+    "jan", "feb", "mar", "apr", "may", "jun", "jul", "aug", "sep", "oct", "nov", "dec"};
+
+bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+char to_lower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+// Reads exactly `count` digits starting at `pos`, used by the fixed layout parsers
+bool read_digits(std::string_view text, std::size_t pos, std::size_t count, int& value)
+{
+    if (pos + count > text.size())
+    {
+        return false;
+    }
+
+    int result = 0;
+    for (std::size_t i = pos; i < pos + count; ++i)
+    {
+        if (!is_digit(text[i]))
+        {
+            return false;
+        }
+        result = result * 10 + (text[i] - '0');
+    }
+
+    value = result;
+    return true;
+}
+
+unsigned days_in_month(std::int64_t year, unsigned month)
+{
+    static constexpr std::array<unsigned, 12> Days{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month == 2 && (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)))
+    {
+        return 29;
+    }
+
+    return Days[month - 1];
+}
+
+std::int64_t current_year()
+{
+    auto days = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
+                    .count() /
+                SecondsPerDay;
+
+    std::int64_t year;
+    unsigned month;
+    unsigned day;
+    TimestampUtil::civil_from_days(days, year, month, day);
+
+    return year;
+}
+
+struct CivilTime
+{
+    std::int64_t year{0};
+    unsigned month{0};
+    unsigned day{0};
+    int hour{0};
+    int minute{0};
+    int second{0};
+    std::int64_t fraction{0};  // nanoseconds
+    std::int64_t offset{0};    // seconds east of UTC
+};
+
+bool to_nanos(const CivilTime& time, std::int64_t& nanos)
+{
+    if (time.year < MinYear || time.year > MaxYear || time.month < 1 || time.month > 12 || time.day < 1 ||
+        time.day > days_in_month(time.year, time.month) || time.hour > 23 || time.minute > 59 || time.second > 59)
+    {
+        return false;
+    }
+
+    const std::int64_t seconds = TimestampUtil::days_from_civil(time.year, time.month, time.day) * SecondsPerDay +
+                                 time.hour * 3600 + time.minute * 60 + time.second - time.offset;
+
+    nanos = seconds * NanosPerSecond + time.fraction;
+    return true;
+}
+
+// Sequential reader used by the parsers of the variable width formats
+class Cursor
+{
+  public:
+    explicit Cursor(std::string_view text) : m_text(text) {}
+
+    bool done() const
+    {
+        return m_pos == m_text.size();
+    }
+
+    char peek() const
+    {
+        return done() ? '\0' : m_text[m_pos];
+    }
+
+    bool accept(char c)
+    {
+        if (peek() == c)
+        {
+            ++m_pos;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool skip_spaces()
+    {
+        const auto start = m_pos;
+        while (peek() == ' ')
+        {
+            ++m_pos;
+        }
+
+        return m_pos != start;
+    }
+
+    // Case-insensitive match of `word`
+    bool accept_word(std::string_view word)
+    {
+        if (m_text.size() - m_pos < word.size())
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < word.size(); ++i)
+        {
+            if (to_lower(m_text[m_pos + i]) != word[i])
+            {
+                return false;
+            }
+        }
+
+        m_pos += word.size();
+        return true;
+    }
+
+    bool digits(std::size_t min_count, std::size_t max_count, int& value)
+    {
+        std::size_t count = 0;
+        int result        = 0;
+        while (count < max_count && is_digit(peek()))
+        {
+            result = result * 10 + (m_text[m_pos++] - '0');
+            ++count;
+        }
+
+        value = result;
+        return count >= min_count;
+    }
+
+    bool month(unsigned& value)
+    {
+        for (std::size_t i = 0; i < MonthNames.size(); ++i)
+        {
+            if (accept_word(MonthNames[i]))
+            {
+                value = static_cast<unsigned>(i + 1);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Digits following a '.' or ',' separator already consumed by the caller, digits past nanoseconds are ignored
+    bool fraction(std::int64_t& nanos)
+    {
+        std::int64_t result = 0;
+        std::size_t count   = 0;
+        while (is_digit(peek()))
+        {
+            if (count < 9)
+            {
+                result = result * 10 + (m_text[m_pos] - '0');
+            }
+            ++m_pos;
+            ++count;
+        }
+
+        for (auto i = count; i < 9; ++i)
+        {
+            result *= 10;
+        }
+
+        nanos = result;
+        return count > 0;
+    }
+
+    // `Z`, `+HH:MM`, `+HHMM` or `+HH`, and when not strict `UTC`, `GMT` and `UT`
+    bool zone(std::int64_t& offset, bool strict)
+    {
+        if (accept('Z') || (!strict && accept('z')))
+        {
+            offset = 0;
+            return true;
+        }
+
+        if (!strict && (accept_word("utc") || accept_word("gmt") || accept_word("ut")))
+        {
+            offset = 0;
+            return true;
+        }
+
+        const char sign = peek();
+        if (sign != '+' && sign != '-')
+        {
+            return false;
+        }
+        ++m_pos;
+
+        int hours   = 0;
+        int minutes = 0;
+        if (!digits(2, 2, hours))
+        {
+            return false;
+        }
+
+        if (accept(':'))
+        {
+            if (!digits(2, 2, minutes))
+            {
+                return false;
+            }
+        }
+        else if (is_digit(peek()) && !digits(2, 2, minutes))
+        {
+            return false;
+        }
+
+        if (hours > 23 || minutes > 59)
+        {
+            return false;
+        }
+
+        offset = (sign == '-' ? -1 : 1) * (hours * 3600 + minutes * 60);
+        return true;
+    }
+
+    // `HH:MM:SS[.fraction]`, seconds are optional when not strict
+    bool time_of_day(CivilTime& time, bool strict)
+    {
+        if (!digits(2, 2, time.hour) || !accept(':') || !digits(2, 2, time.minute))
+        {
+            return false;
+        }
+
+        if (!accept(':'))
+        {
+            return !strict;
+        }
+
+        if (!digits(2, 2, time.second))
+        {
+            return false;
+        }
+
+        if (accept('.') || (!strict && accept(',')))
+        {
+            return fraction(time.fraction);
+        }
+
+        return true;
+    }
+
+  private:
+    std::string_view m_text;
+    std::size_t m_pos{0};
+};
+
+std::string_view trim(std::string_view value)
+{
+    while (!value.empty() && (value.front() == ' ' || value.front() == '\t'))
+    {
+        value.remove_prefix(1);
+    }
+
+    while (!value.empty() && (value.back() == ' ' || value.back() == '\t' || value.back() == '\r' ||
+                              value.back() == '\n'))
+    {
+        value.remove_suffix(1);
+    }
+
+    return value;
+}
+
+// The ISO 8601 basic date `YYYYMMDD`
+bool parse_basic_date(std::string_view value, std::int64_t& nanos)
+{
+    CivilTime time;
+    int year  = 0;
+    int month = 0;
+    int day   = 0;
+
+    if (value.size() != 8 || !read_digits(value, 0, 4, year) || !read_digits(value, 4, 2, month) ||
+        !read_digits(value, 6, 2, day))
+    {
+        return false;
+    }
+
+    time.year  = year;
+    time.month = static_cast<unsigned>(month);
+    time.day   = static_cast<unsigned>(day);
+
+    return to_nanos(time, nanos);
+}
+
+// The canonical layout `YYYY-MM-DD[T ]HH:MM:SS[.fraction][zone]`, `YYYY-MM-DD` or `YYYYMMDD`, date and time fields are
+// read from fixed offsets
+bool parse_iso8601_strict(std::string_view value, std::int64_t& nanos)
+{
+    if (value.size() == 8)
+    {
+        return parse_basic_date(value, nanos);
+    }
+
+    CivilTime time;
+    int year  = 0;
+    int month = 0;
+    int day   = 0;
+
+    if (!read_digits(value, 0, 4, year) || value.size() < 10 || value[4] != '-' || !read_digits(value, 5, 2, month) ||
+        value[7] != '-' || !read_digits(value, 8, 2, day))
+    {
+        return false;
+    }
+
+    time.year  = year;
+    time.month = static_cast<unsigned>(month);
+    time.day   = static_cast<unsigned>(day);
+
+    if (value.size() > 10)
+    {
+        if ((value[10] != 'T' && value[10] != ' ') || value.size() < 19 || !read_digits(value, 11, 2, time.hour) ||
+            value[13] != ':' || !read_digits(value, 14, 2, time.minute) || value[16] != ':' ||
+            !read_digits(value, 17, 2, time.second))
+        {
+            return false;
+        }
+
+        Cursor cursor(value.substr(19));
+        if (cursor.accept('.') && !cursor.fraction(time.fraction))
+        {
+            return false;
+        }
+
+        if (!cursor.done() && (!cursor.zone(time.offset, true) || !cursor.done()))
+        {
+            return false;
+        }
+    }
+
+    return to_nanos(time, nanos);
+}
+
+// ISO 8601 variants: `/` date separators, single digit months and days, lowercase designators, `,` fraction separator,
+// missing seconds and a `UTC` suffix
+bool parse_iso8601_lenient(std::string_view value, std::int64_t& nanos)
+{
+    Cursor cursor(value);
+    CivilTime time;
+
+    int year  = 0;
+    int month = 0;
+    int day   = 0;
+    if (!cursor.digits(4, 4, year))
+    {
+        return false;
+    }
+
+    const char separator = cursor.peek();
+    if ((separator != '-' && separator != '/') || !cursor.accept(separator) || !cursor.digits(1, 2, month) ||
+        !cursor.accept(separator) || !cursor.digits(1, 2, day))
+    {
+        return false;
+    }
+
+    time.year  = year;
+    time.month = static_cast<unsigned>(month);
+    time.day   = static_cast<unsigned>(day);
+
+    if (cursor.accept('T') || cursor.accept('t') || cursor.skip_spaces())
+    {
+        if (!cursor.time_of_day(time, false))
+        {
+            return false;
+        }
+
+        cursor.skip_spaces();
+        if (!cursor.done() && (!cursor.zone(time.offset, false) || !cursor.done()))
+        {
+            return false;
+        }
+    }
+
+    return cursor.done() && to_nanos(time, nanos);
+}
+
+// `[Ddd, ]DD Mmm YYYY HH:MM:SS zone`
+bool parse_rfc2822(std::string_view value, std::int64_t& nanos, bool strict)
+{
+    Cursor cursor(value);
+    CivilTime time;
+
+    if (!is_digit(cursor.peek()))
+    {
+        // Day of the week, which is redundant
+        static constexpr std::array<std::string_view, 7> DayNames{"mon", "tue", "wed", "thu", "fri", "sat", "sun"};
+
+        bool found = false;
+        for (const auto& name : DayNames)
+        {
+            if (cursor.accept_word(name))
+            {
+                found = true;
+                break;
+            }
+        }
+
+        if (!found || !cursor.accept(',') || !cursor.skip_spaces())
+        {
+            return false;
+        }
+    }
+
+    int day  = 0;
+    int year = 0;
+    if (!cursor.digits(1, 2, day) || !cursor.skip_spaces() || !cursor.month(time.month) || !cursor.skip_spaces() ||
+        !cursor.digits(4, 4, year) || !cursor.skip_spaces() || !cursor.time_of_day(time, strict))
+    {
+        return false;
+    }
+
+    time.year = year;
+    time.day  = static_cast<unsigned>(day);
+
+    const bool has_space = cursor.skip_spaces();
+    if (!cursor.done())
+    {
+        // Unlike ISO 8601 RFC 2822 always permits the `UT` and `GMT` zone names
+        if (!has_space || !(cursor.zone(time.offset, false)) || !cursor.done())
+        {
+            return false;
+        }
+    }
+    else if (strict)
+    {
+        return false;
+    }
+
+    return to_nanos(time, nanos);
+}
+
+// `DD/Mmm/YYYY:HH:MM:SS zone`, the timestamp of the Apache/NCSA common log format
+bool parse_common_log(std::string_view value, std::int64_t& nanos, bool strict)
+{
+    if (value.size() > 2 && value.front() == '[' && value.back() == ']')
+    {
+        value = value.substr(1, value.size() - 2);
+    }
+
+    Cursor cursor(value);
+    CivilTime time;
+
+    int day  = 0;
+    int year = 0;
+    if (!cursor.digits(2, 2, day) || !cursor.accept('/') || !cursor.month(time.month) || !cursor.accept('/') ||
+        !cursor.digits(4, 4, year) || !cursor.accept(':') || !cursor.time_of_day(time, strict))
+    {
+        return false;
+    }
+
+    time.year = year;
+    time.day  = static_cast<unsigned>(day);
+
+    if (cursor.skip_spaces())
+    {
+        if (!cursor.zone(time.offset, strict))
+        {
+            return false;
+        }
+    }
+    else if (strict)
+    {
+        return false;
+    }
+
+    return cursor.done() && to_nanos(time, nanos);
+}
+
+// `Mmm dd HH:MM:SS` of RFC 3164, the day is padded with a space
+bool parse_syslog(std::string_view value, std::int64_t& nanos, int syslog_year, bool strict)
+{
+    Cursor cursor(value);
+    CivilTime time;
+
+    int day = 0;
+    if (!cursor.month(time.month) || !cursor.accept(' '))
+    {
+        return false;
+    }
+
+    if (strict)
+    {
+        // Either `dd` or ` d`
+        if (!(cursor.accept(' ') ? cursor.digits(1, 1, day) : cursor.digits(2, 2, day)))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        cursor.skip_spaces();
+        if (!cursor.digits(1, 2, day))
+        {
+            return false;
+        }
+    }
+
+    if (!cursor.accept(' ') || !cursor.time_of_day(time, strict) || !cursor.done())
+    {
+        return false;
+    }
+
+    time.day = static_cast<unsigned>(day);
+
+    if (syslog_year != 0)
+    {
+        time.year = syslog_year;
+        return to_nanos(time, nanos);
+    }
+
+    // Without a year assume the value is recent, a December value read in January belongs to the previous year
+    time.year = current_year();
+    if (!to_nanos(time, nanos))
+    {
+        // Feb 29th of the previous leap year
+        time.year -= 1;
+        return to_nanos(time, nanos);
+    }
+
+    const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+    if (nanos > now + SecondsPerDay * NanosPerSecond)
+    {
+        time.year -= 1;
+        return to_nanos(time, nanos);
+    }
+
+    return true;
+}
+
+// Number of integer digits permitted for each epoch unit by the strict parser
+struct EpochUnit
+{
+    std::int64_t nanos_per_unit;
+    std::size_t min_digits;
+    std::size_t max_digits;
+    bool fraction;
+};
+
+EpochUnit epoch_unit(TimestampFormat format)
+{
+    switch (format)
+    {
+    case TimestampFormat::EpochSeconds:
+        return {NanosPerSecond, 1, 10, true};
+    case TimestampFormat::EpochMillis:
+        return {1'000'000, 11, 13, true};
+    case TimestampFormat::EpochMicros:
+        return {1'000, 14, 16, true};
+    case TimestampFormat::EpochNanos:
+        return {1, 17, 19, false};
+    default:
+        return {100, 17, 18, false};  // FileTime
+    }
+}
+
+// Splits `[-]digits[.digits]`, returning false for anything else or an integer part which overflows
+bool split_number(std::string_view value,
+                  bool& negative,
+                  std::int64_t& integer,
+                  std::size_t& num_digits,
+                  std::string_view& fraction)
+{
+    negative = !value.empty() && value.front() == '-';
+    if (negative)
+    {
+        value.remove_prefix(1);
+    }
+
+    const auto point = value.find('.');
+    fraction         = point == std::string_view::npos ? std::string_view{} : value.substr(point + 1);
+    value            = value.substr(0, point);
+
+    if (value.empty() || value.size() > 19 || (point != std::string_view::npos && fraction.empty()))
+    {
+        return false;
+    }
+
+    std::uint64_t result = 0;
+    for (char c : value)
+    {
+        if (!is_digit(c))
+        {
+            return false;
+        }
+        result = result * 10 + static_cast<std::uint64_t>(c - '0');
+    }
+
+    for (char c : fraction)
+    {
+        if (!is_digit(c))
+        {
+            return false;
+        }
+    }
+
+    if (result > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+    {
+        return false;
+    }
+
+    integer    = static_cast<std::int64_t>(result);
+    num_digits = value.size();
+    return true;
+}
+
+bool parse_hex_file_time(std::string_view value, std::int64_t& nanos)
+{
+    if (value.size() < 3 || value.size() > 18 || value[0] != '0' || (value[1] != 'x' && value[1] != 'X'))
+    {
+        return false;
+    }
+
+    std::uint64_t result = 0;
+    for (char c : value.substr(2))
+    {
+        const char lower = to_lower(c);
+        if (is_digit(lower))
+        {
+            result = result * 16 + static_cast<std::uint64_t>(lower - '0');
+        }
+        else if (lower >= 'a' && lower <= 'f')
+        {
+            result = result * 16 + static_cast<std::uint64_t>(lower - 'a' + 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    const auto intervals = static_cast<std::int64_t>(result & 0x7fffffffffffffffULL);
+    if (intervals < FileTimeEpoch || intervals - FileTimeEpoch > std::numeric_limits<std::int64_t>::max() / 100)
+    {
+        return false;
+    }
+
+    nanos = (intervals - FileTimeEpoch) * 100;
+    return true;
+}
+
+bool parse_epoch(std::string_view value, TimestampFormat format, std::int64_t& nanos, bool strict)
+{
+    if (format == TimestampFormat::FileTime && parse_hex_file_time(value, nanos))
+    {
+        return true;
+    }
+
+    bool negative = false;
+    std::int64_t integer{0};
+    std::size_t num_digits{0};
+    std::string_view fraction;
+    if (!split_number(value, negative, integer, num_digits, fraction))
+    {
+        return false;
+    }
+
+    const auto unit = epoch_unit(format);
+    if ((strict && (num_digits < unit.min_digits || num_digits > unit.max_digits)) ||
+        (!fraction.empty() && !unit.fraction) || (negative && format == TimestampFormat::FileTime))
+    {
+        return false;
+    }
+
+    if (format == TimestampFormat::FileTime)
+    {
+        if (integer < FileTimeEpoch)
+        {
+            return false;
+        }
+        integer -= FileTimeEpoch;
+    }
+
+    if (integer > std::numeric_limits<std::int64_t>::max() / unit.nanos_per_unit - 1)
+    {
+        return false;
+    }
+
+    std::int64_t result = integer * unit.nanos_per_unit;
+
+    // Scale the fraction digits to the unit, ignoring digits below a nanosecond
+    std::int64_t scale = unit.nanos_per_unit;
+    for (char c : fraction)
+    {
+        scale /= 10;
+        if (scale == 0)
+        {
+            break;
+        }
+        result += (c - '0') * scale;
+    }
+
+    nanos = negative ? -result : result;
+    return true;
+}
+
+// The epoch unit of a number, from the number of integer digits. Values with 18 digits are ambiguous between
+// nanoseconds before 2001 and FILETIME, since the former is far less likely in practice FILETIME is chosen when the
+// value falls after the Unix epoch.
+TimestampFormat classify_number(std::string_view value)
+{
+    bool negative = false;
+    std::int64_t integer{0};
+    std::size_t num_digits{0};
+    std::string_view fraction;
+    if (!split_number(value, negative, integer, num_digits, fraction))
+    {
+        return TimestampFormat::Unknown;
+    }
+
+    TimestampFormat format = TimestampFormat::EpochNanos;
+    if (num_digits <= 10)
+    {
+        format = TimestampFormat::EpochSeconds;
+    }
+    else if (num_digits <= 13)
+    {
+        format = TimestampFormat::EpochMillis;
+    }
+    else if (num_digits <= 16)
+    {
+        format = TimestampFormat::EpochMicros;
+    }
+    else if (num_digits == 18 && !negative && integer >= FileTimeEpoch)
+    {
+        format = TimestampFormat::FileTime;
+    }
+
+    if (!fraction.empty() && !epoch_unit(format).fraction)
+    {
+        return TimestampFormat::Unknown;
+    }
+
+    return format;
+}
+
+bool parse_lenient(std::string_view value, TimestampFormat format, std::int64_t& nanos, int syslog_year)
+{
+    switch (format)
+    {
+    case TimestampFormat::Iso8601:
+        return parse_iso8601_lenient(value, nanos);
+    case TimestampFormat::Rfc2822:
+        return parse_rfc2822(value, nanos, false);
+    case TimestampFormat::CommonLog:
+        return parse_common_log(value, nanos, false);
+    case TimestampFormat::Syslog:
+        return parse_syslog(value, nanos, syslog_year, false);
+    case TimestampFormat::Unknown:
+        return false;
+    default:
+        return parse_epoch(value, format, nanos, false);
+    }
+}
+
+TimestampFormat detect_and_parse(std::string_view value, std::int64_t& nanos, int syslog_year)
+{
+    value = trim(value);
+    if (value.empty())
+    {
+        return TimestampFormat::Unknown;
+    }
+
+    if (is_digit(value.front()) || value.front() == '-')
+    {
+        // Eight digits forming a valid date are a date rather than epoch seconds in 1970
+        if (parse_basic_date(value, nanos))
+        {
+            return TimestampFormat::Iso8601;
+        }
+
+        // Checked first since the number of digits decides between a year and an epoch value
+        if (auto format = classify_number(value); format != TimestampFormat::Unknown)
+        {
+            return parse_epoch(value, format, nanos, false) ? format : TimestampFormat::Unknown;
+        }
+
+        if (parse_hex_file_time(value, nanos))
+        {
+            return TimestampFormat::FileTime;
+        }
+    }
+
+    for (auto format : {TimestampFormat::Iso8601,
+                        TimestampFormat::CommonLog,
+                        TimestampFormat::Rfc2822,
+                        TimestampFormat::Syslog})
+    {
+        if (parse_lenient(value, format, nanos, syslog_year))
+        {
+            return format;
+        }
+    }
+
+    return TimestampFormat::Unknown;
+}
+}  // namespace
+
+/****** Component public implementations *******************/
+/****** TimestampUtil***************************************/
+TimestampFormat TimestampUtil::classify(std::string_view value)
+{
+    std::int64_t nanos{0};
+
+    // A fixed year avoids reading the clock, it doesn't change the outcome
+    return detect_and_parse(value, nanos, 2000);
+}
+
+TimestampFormat TimestampUtil::detect_format(const std::vector<std::string_view>& sample)
+{
+    std::map<TimestampFormat, std::size_t> counts;
+    for (const auto& value : sample)
+    {
+        if (auto format = classify(value); format != TimestampFormat::Unknown)
+        {
+            ++counts[format];
+        }
+    }
+
+    TimestampFormat detected = TimestampFormat::Unknown;
+    std::size_t max_count    = 0;
+    for (const auto& [format, count] : counts)
+    {
+        if (count > max_count)
+        {
+            detected  = format;
+            max_count = count;
+        }
+    }
+
+    return detected;
+}
+
+bool TimestampUtil::parse(std::string_view value, TimestampFormat format, std::int64_t& nanos, int syslog_year)
+{
+    switch (format)
+    {
+    case TimestampFormat::Iso8601:
+        return parse_iso8601_strict(value, nanos);
+    case TimestampFormat::Rfc2822:
+        return parse_rfc2822(value, nanos, true);
+    case TimestampFormat::CommonLog:
+        return parse_common_log(value, nanos, true);
+    case TimestampFormat::Syslog:
+        return parse_syslog(value, nanos, syslog_year, true);
+    case TimestampFormat::Unknown:
+        return false;
+    default:
+        return parse_epoch(value, format, nanos, true);
+    }
+}
+
+bool TimestampUtil::parse_any(std::string_view value, std::int64_t& nanos, int syslog_year)
+{
+    return detect_and_parse(value, nanos, syslog_year) != TimestampFormat::Unknown;
+}
+
+std::int64_t TimestampUtil::days_from_civil(std::int64_t year, unsigned month, unsigned day)
+{
+    // See http://howardhinnant.github.io/date_algorithms.html
+    year -= month <= 2 ? 1 : 0;
+    const std::int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const auto yoe         = static_cast<unsigned>(year - era * 400);
+    const unsigned doy     = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const unsigned doe     = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return era * 146097 + static_cast<std::int64_t>(doe) - 719468;
+}
+
+void TimestampUtil::civil_from_days(std::int64_t days, std::int64_t& year, unsigned& month, unsigned& day)
+{
+    // Inverse of days_from_civil, see http://howardhinnant.github.io/date_algorithms.html
+    days += 719468;
+    const std::int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const std::int64_t doe = days - era * 146097;
+    const std::int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const std::int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const std::int64_t mp  = (5 * doy + 2) / 153;
+
+    day   = static_cast<unsigned>(doy - (153 * mp + 2) / 5 + 1);
+    month = static_cast<unsigned>(mp < 10 ? mp + 3 : mp - 9);
+    year  = yoe + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+std::string TimestampUtil::format_name(TimestampFormat format)
+{
+    switch (format)
+    {
+    case TimestampFormat::Iso8601:
+        return "ISO8601";
+    case TimestampFormat::Rfc2822:
+        return "RFC2822";
+    case TimestampFormat::CommonLog:
+        return "CommonLog";
+    case TimestampFormat::Syslog:
+        return "Syslog";
+    case TimestampFormat::EpochSeconds:
+        return "EpochSeconds";
+    case TimestampFormat::EpochMillis:
+        return "EpochMillis";
+    case TimestampFormat::EpochMicros:
+        return "EpochMicros";
+    case TimestampFormat::EpochNanos:
+        return "EpochNanos";
+    case TimestampFormat::FileTime:
+        return "FileTime";
+    default:
+        return "Unknown";
+    }
+}
+
+}  // namespace morpheus
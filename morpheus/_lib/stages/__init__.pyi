@@ -9,6 +9,8 @@ from __future__ import annotations
 import morpheus._lib.stages
 import typing
 from morpheus._lib.common import FilterSource
+from morpheus._lib.common import TextLengthUnit
+from morpheus._lib.common import WebFetcher
 import morpheus._lib.common
 import mrc.core.segment
 import os
@@ -18,25 +20,44 @@ __all__ = [
     "AddClassificationsMultiResponseMessageStage",
     "AddScoresControlMessageStage",
     "AddScoresMultiResponseMessageStage",
+    "DeduplicateStage",
     "DeserializeControlMessageStage",
     "DeserializeMultiMessageStage",
+    "DocumentExtractorStage",
+    "DriftStatsControlMessageStage",
+    "DriftStatsMultiResponseMessageStage",
+    "EnrichStage",
     "FileSourceStage",
     "FilterDetectionsControlMessageStage",
     "FilterDetectionsMultiMessageStage",
     "FilterSource",
+    "GrokStage",
     "HttpServerSourceStage",
     "InferenceClientStageCM",
     "InferenceClientStageMM",
+    "InferenceWorkerPoolControlMessageStage",
+    "InferenceWorkerPoolMultiMessageStage",
     "KafkaSourceStage",
+    "PiiMaskStage",
     "PreallocateControlMessageStage",
     "PreallocateMessageMetaStage",
     "PreallocateMultiMessageStage",
+    "PreprocessEmbeddingStage",
     "PreprocessFILControlMessageStage",
     "PreprocessFILMultiMessageStage",
     "PreprocessNLPControlMessageStage",
     "PreprocessNLPMultiMessageStage",
+    "PreprocessPcapStage",
+    "RSSSourceStage",
     "SerializeControlMessageStage",
     "SerializeMultiMessageStage",
+    "StringFeaturesStage",
+    "SyslogParserStage",
+    "TextChunkerStage",
+    "TextLengthUnit",
+    "WebFetchStage",
+    "WebFetcher",
+    "WindowsEventParserStage",
     "WriteToFileStage"
 ]
 
@@ -53,12 +74,27 @@ class AddScoresControlMessageStage(mrc.core.segment.SegmentObject):
 class AddScoresMultiResponseMessageStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, idx2label: typing.Dict[int, str]) -> None: ...
     pass
+class DeduplicateStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, columns: typing.List[str]) -> None: ...
+    pass
 class DeserializeControlMessageStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, batch_size: int, ensure_sliceable_index: bool = True, task_type: object = None, task_payload: object = None) -> None: ...
     pass
 class DeserializeMultiMessageStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, batch_size: int, ensure_sliceable_index: bool = True) -> None: ...
     pass
+class DocumentExtractorStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, path_column: str = 'file_path', converters: dict = {}, csv_text_columns: typing.List[str] = ['content'], csv_delimiter: str = ',', num_threads: int = 0) -> None: ...
+    pass
+class DriftStatsControlMessageStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, tensor_name: str, labels: typing.List[str], feature_ranges: typing.Dict[str, typing.Tuple[float, float]], window_size: int, num_buckets: int, reference_windows: int, reference: typing.Dict[str, typing.List[float]]) -> None: ...
+    pass
+class DriftStatsMultiResponseMessageStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, tensor_name: str, labels: typing.List[str], feature_ranges: typing.Dict[str, typing.Tuple[float, float]], window_size: int, num_buckets: int, reference_windows: int, reference: typing.Dict[str, typing.List[float]]) -> None: ...
+    pass
+class EnrichStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, references: list, refresh_interval: float = 5.0) -> None: ...
+    pass
 class FileSourceStage(mrc.core.segment.SegmentObject):
     @typing.overload
     def __init__(self, builder: mrc.core.segment.Builder, name: str, filename: os.PathLike, repeat: int, filter_null: bool, filter_null_columns: typing.List[str], parser_kwargs: dict) -> None: ...
@@ -71,20 +107,36 @@ class FilterDetectionsControlMessageStage(mrc.core.segment.SegmentObject):
 class FilterDetectionsMultiMessageStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, threshold: float, copy: bool, filter_source: morpheus._lib.common.FilterSource, field_name: str = 'probs') -> None: ...
     pass
+class GrokStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, column: str, patterns: typing.List[str], pattern_files: typing.List[str] = [], custom_patterns: typing.Dict[str, str] = {}, pattern_column: str = 'grok_pattern', syslog_year: int = 0, num_threads: int = 0) -> None: ...
+    pass
 class HttpServerSourceStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, bind_address: str = '127.0.0.1', port: int = 8080, endpoint: str = '/message', live_endpoint: str = '/live', ready_endpoint: str = '/ready', method: str = 'POST', live_method: str = 'GET', ready_method: str = 'GET', accept_status: int = 201, sleep_time: float = 0.10000000149011612, queue_timeout: int = 5, max_queue_size: int = 1024, num_server_threads: int = 1, max_payload_size: int = 10485760, request_timeout: int = 30, lines: bool = False, stop_after: int = 0) -> None: ...
     pass
 class InferenceClientStageCM(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, server_url: str, model_name: str, needs_logits: bool, force_convert_inputs: bool, input_mapping: typing.Dict[str, str] = {}, output_mapping: typing.Dict[str, str] = {}) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, server_url: str, model_name: str, needs_logits: bool, force_convert_inputs: bool, input_mapping: typing.Dict[str, str] = {}, output_mapping: typing.Dict[str, str] = {}, dedup_cache_size: int = 0) -> None: ...
     pass
 class InferenceClientStageMM(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, server_url: str, model_name: str, needs_logits: bool, force_convert_inputs: bool, input_mapping: typing.Dict[str, str] = {}, output_mapping: typing.Dict[str, str] = {}) -> None: ...
     pass
+class InferenceWorkerPoolControlMessageStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, worker_factory: function, num_workers: int, max_batch_size: int, max_queue_size: int = 0) -> None: ...
+    def get_stats(self) -> dict: ...
+    def shutdown(self) -> None: ...
+    pass
+class InferenceWorkerPoolMultiMessageStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, worker_factory: function, num_workers: int, max_batch_size: int, max_queue_size: int = 0) -> None: ...
+    def get_stats(self) -> dict: ...
+    def shutdown(self) -> None: ...
+    pass
 class KafkaSourceStage(mrc.core.segment.SegmentObject):
     @typing.overload
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, max_batch_size: int, topic: str, batch_timeout_ms: int, config: typing.Dict[str, str], disable_commits: bool = False, disable_pre_filtering: bool = False, stop_after: int = 0, async_commits: bool = True, oauth_callback: typing.Optional[function] = None) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, max_batch_size: int, topic: str, batch_timeout_ms: int, config: typing.Dict[str, str], disable_commits: bool = False, disable_pre_filtering: bool = False, stop_after: int = 0, async_commits: bool = True, oauth_callback: typing.Optional[function] = None, metadata_columns: typing.List[str] = [], header_columns: typing.List[str] = [], column_prefix: str = 'kafka_', key_filter: typing.List[str] = [], header_filters: typing.Dict[str, typing.List[str]] = {}, payload_format: str = 'json', schema_files: typing.Dict[int, str] = {}, schema_registry: typing.Optional[function] = None, confluent_framing: bool = True, schema_id: int = 0, message_name: str = '') -> None: ...
     @typing.overload
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, max_batch_size: int, topics: typing.List[str], batch_timeout_ms: int, config: typing.Dict[str, str], disable_commits: bool = False, disable_pre_filtering: bool = False, stop_after: int = 0, async_commits: bool = True, oauth_callback: typing.Optional[function] = None) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, max_batch_size: int, topics: typing.List[str], batch_timeout_ms: int, config: typing.Dict[str, str], disable_commits: bool = False, disable_pre_filtering: bool = False, stop_after: int = 0, async_commits: bool = True, oauth_callback: typing.Optional[function] = None, metadata_columns: typing.List[str] = [], header_columns: typing.List[str] = [], column_prefix: str = 'kafka_', key_filter: typing.List[str] = [], header_filters: typing.Dict[str, typing.List[str]] = {}, payload_format: str = 'json', schema_files: typing.Dict[int, str] = {}, schema_registry: typing.Optional[function] = None, confluent_framing: bool = True, schema_id: int = 0, message_name: str = '') -> None: ...
+    pass
+class PiiMaskStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, columns: typing.List[str], entities: typing.List[str], literals: typing.Dict[str, str] = {}, patterns: typing.Dict[str, str] = {}, pseudonymize: bool = False, key: str = '', num_threads: int = 0, use_gpu: bool = False) -> None: ...
     pass
 class PreallocateControlMessageStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, needed_columns: typing.List[typing.Tuple[str, morpheus._lib.common.TypeId]]) -> None: ...
@@ -95,17 +147,26 @@ class PreallocateMessageMetaStage(mrc.core.segment.SegmentObject):
 class PreallocateMultiMessageStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, needed_columns: typing.List[typing.Tuple[str, morpheus._lib.common.TypeId]]) -> None: ...
     pass
+class PreprocessEmbeddingStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, vocab_hash_file: str, max_length: int, do_lower_case: bool, bucket_lengths: typing.List[int] = [], batch_size: int = 0, column: str = 'content', row_index_column: str = '_row_index', input_ids_type: morpheus._lib.common.TypeId = TypeId.INT32, input_mask_type: morpheus._lib.common.TypeId = TypeId.INT32) -> None: ...
+    pass
 class PreprocessFILControlMessageStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, features: typing.List[str]) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, features: typing.List[str], input_type: morpheus._lib.common.TypeId = TypeId.FLOAT32) -> None: ...
     pass
 class PreprocessFILMultiMessageStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, features: typing.List[str]) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, features: typing.List[str], input_type: morpheus._lib.common.TypeId = TypeId.FLOAT32) -> None: ...
     pass
 class PreprocessNLPControlMessageStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, vocab_hash_file: str, sequence_length: int, truncation: bool, do_lower_case: bool, add_special_token: bool, stride: int, column: str) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, vocab_hash_file: str, sequence_length: int, truncation: bool, do_lower_case: bool, add_special_token: bool, stride: int, column: str, input_ids_type: morpheus._lib.common.TypeId = TypeId.INT32, input_mask_type: morpheus._lib.common.TypeId = TypeId.INT32) -> None: ...
     pass
 class PreprocessNLPMultiMessageStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, vocab_hash_file: str, sequence_length: int, truncation: bool, do_lower_case: bool, add_special_token: bool, stride: int, column: str) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, vocab_hash_file: str, sequence_length: int, truncation: bool, do_lower_case: bool, add_special_token: bool, stride: int, column: str, input_ids_type: morpheus._lib.common.TypeId = TypeId.INT32, input_mask_type: morpheus._lib.common.TypeId = TypeId.INT32) -> None: ...
+    pass
+class PreprocessPcapStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str) -> None: ...
+    pass
+class RSSSourceStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, feed_input: typing.List[str], interval_secs: float = 600.0, stop_after: int = 0, run_indefinitely: bool = False, batch_size: int = 32, cooldown_interval: float = 600.0, strip_markup: bool = False, max_seen_entries: int = 100000, num_threads: int = 0, fetcher: morpheus._lib.common.WebFetcher = None) -> None: ...
     pass
 class SerializeControlMessageStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, include: typing.List[str], exclude: typing.List[str], fixed_columns: bool = True) -> None: ...
@@ -113,7 +174,22 @@ class SerializeControlMessageStage(mrc.core.segment.SegmentObject):
 class SerializeMultiMessageStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, include: typing.List[str], exclude: typing.List[str], fixed_columns: bool = True) -> None: ...
     pass
+class StringFeaturesStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, features: list, num_threads: int = 0) -> None: ...
+    pass
+class SyslogParserStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, column: str, header_fields: typing.List[str], extension_fields: list = [], column_prefix: str = '', error_column: str = 'parse_error', syslog_year: int = 0, num_threads: int = 0) -> None: ...
+    pass
+class TextChunkerStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, column: str, chunk_size: int, chunk_overlap: int, separators: typing.List[str] = [], keep_separator: bool = True, strip_whitespace: bool = True, length_unit: morpheus._lib.common.TextLengthUnit = TextLengthUnit.CHARACTERS, row_id_column: str = 'source_row_id', offset_column: str = 'chunk_offset', num_threads: int = 0) -> None: ...
+    pass
+class WebFetchStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, fetcher: morpheus._lib.common.WebFetcher, link_column: str = 'link', content_column: str = 'page_content', remove_boilerplate: bool = True) -> None: ...
+    pass
+class WindowsEventParserStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, column: str, fields: list, schemas: dict = {}, event_id_key: str = 'EventID', error_column: str = 'parse_error', num_threads: int = 0) -> None: ...
+    pass
 class WriteToFileStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, filename: str, mode: str = 'w', file_type: morpheus._lib.common.FileTypes = FileTypes.Auto, include_index_col: bool = True, flush: bool = False) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, filename: str, mode: str = 'w', file_type: morpheus._lib.common.FileTypes = FileTypes.Auto, include_index_col: bool = True, flush: bool = False, na_rep: str = '') -> None: ...
     pass
 __version__ = '24.10.0'
@@ -20,20 +20,38 @@
 #include "morpheus/messages/multi.hpp"
 #include "morpheus/messages/multi_inference.hpp"
 #include "morpheus/messages/multi_response.hpp"
+#include "morpheus/objects/dtype.hpp"
 #include "morpheus/objects/file_types.hpp"
+#include "morpheus/objects/text_splitter.hpp"
 #include "morpheus/stages/add_classification.hpp"
 #include "morpheus/stages/add_scores.hpp"
+#include "morpheus/stages/deduplicate.hpp"
 #include "morpheus/stages/deserialize.hpp"
+#include "morpheus/stages/document_extractor.hpp"
+#include "morpheus/stages/drift_stats.hpp"
+#include "morpheus/stages/enrich.hpp"
 #include "morpheus/stages/file_source.hpp"
 #include "morpheus/stages/filter_detections.hpp"
+#include "morpheus/stages/grok.hpp"
 #include "morpheus/stages/http_server_source_stage.hpp"
 #include "morpheus/stages/inference_client_stage.hpp"
+#include "morpheus/stages/inference_worker_pool.hpp"
 #include "morpheus/stages/kafka_source.hpp"
+#include "morpheus/stages/pii_mask.hpp"
 #include "morpheus/stages/preallocate.hpp"
+#include "morpheus/stages/preprocess_embedding.hpp"
 #include "morpheus/stages/preprocess_fil.hpp"
 #include "morpheus/stages/preprocess_nlp.hpp"
+#include "morpheus/stages/preprocess_pcap.hpp"
+#include "morpheus/stages/rss_source.hpp"
 #include "morpheus/stages/serialize.hpp"
+#include "morpheus/stages/string_features.hpp"
+#include "morpheus/stages/syslog_parser.hpp"
+#include "morpheus/stages/text_chunker.hpp"
+#include "morpheus/stages/web_fetch.hpp"
+#include "morpheus/stages/windows_event_parser.hpp"
 #include "morpheus/stages/write_to_file.hpp"
+#include "morpheus/types.hpp"
 #include "morpheus/utilities/cudf_util.hpp"
 #include "morpheus/utilities/http_server.hpp"
 #include "morpheus/version.hpp"
@@ -44,11 +62,13 @@
 #include <pybind11/attr.h>            // for multiple_inheritance
 #include <pybind11/pybind11.h>        // for arg, init, class_, module_, str_attr_accessor, PYBIND11_MODULE, pybind11
 #include <pybind11/pytypes.h>         // for dict, sequence
+#include <pybind11/stl.h>             // IWYU pragma: keep
 #include <pybind11/stl/filesystem.h>  // IWYU pragma: keep
 #include <pymrc/utils.hpp>            // for pymrc::import
 #include <rxcpp/rx.hpp>
 
 #include <filesystem>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -74,6 +94,11 @@ PYBIND11_MODULE(stages, _module)
     mrc::pymrc::import(_module, "mrc.core.segment");
 
     mrc::pymrc::from_import(_module, "morpheus._lib.common", "FilterSource");
+    mrc::pymrc::from_import(_module, "morpheus._lib.common", "TextLengthUnit");
+    mrc::pymrc::from_import(_module, "morpheus._lib.common", "WebFetcher");
+
+    // Required for the inference worker pool to pass messages to python workers
+    mrc::pymrc::import(_module, "morpheus._lib.messages");
 
     py::class_<mrc::segment::Object<AddClassificationsStageMM>,
                mrc::segment::ObjectProperties,
@@ -113,6 +138,15 @@ PYBIND11_MODULE(stages, _module)
              py::arg("name"),
              py::arg("idx2label"));
 
+    py::class_<mrc::segment::Object<DeduplicateStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<DeduplicateStage>>>(
+        _module, "DeduplicateStage", py::multiple_inheritance())
+        .def(py::init<>(&DeduplicateStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("columns"));
+
     py::class_<mrc::segment::Object<DeserializeStage<MultiMessage>>,
                mrc::segment::ObjectProperties,
                std::shared_ptr<mrc::segment::Object<DeserializeStage<MultiMessage>>>>(
@@ -135,6 +169,58 @@ PYBIND11_MODULE(stages, _module)
              py::arg("task_type")              = py::none(),
              py::arg("task_payload")           = py::none());
 
+    py::class_<mrc::segment::Object<DocumentExtractorStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<DocumentExtractorStage>>>(
+        _module, "DocumentExtractorStage", py::multiple_inheritance())
+        .def(py::init<>(&DocumentExtractorStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("path_column")      = "file_path",
+             py::arg("converters")       = py::dict(),
+             py::arg("csv_text_columns") = std::vector<std::string>{"content"},
+             py::arg("csv_delimiter")    = ',',
+             py::arg("num_threads")      = 0);
+
+    py::class_<mrc::segment::Object<DriftStatsStageMM>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<DriftStatsStageMM>>>(
+        _module, "DriftStatsMultiResponseMessageStage", py::multiple_inheritance())
+        .def(py::init<>(&DriftStatsStageInterfaceProxy::init_multi),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("tensor_name"),
+             py::arg("labels"),
+             py::arg("feature_ranges"),
+             py::arg("window_size"),
+             py::arg("num_buckets"),
+             py::arg("reference_windows"),
+             py::arg("reference"));
+
+    py::class_<mrc::segment::Object<DriftStatsStageCM>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<DriftStatsStageCM>>>(
+        _module, "DriftStatsControlMessageStage", py::multiple_inheritance())
+        .def(py::init<>(&DriftStatsStageInterfaceProxy::init_cm),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("tensor_name"),
+             py::arg("labels"),
+             py::arg("feature_ranges"),
+             py::arg("window_size"),
+             py::arg("num_buckets"),
+             py::arg("reference_windows"),
+             py::arg("reference"));
+
+    py::class_<mrc::segment::Object<EnrichStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<EnrichStage>>>(_module, "EnrichStage", py::multiple_inheritance())
+        .def(py::init<>(&EnrichStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("references"),
+             py::arg("refresh_interval") = 5.0);
+
     py::class_<mrc::segment::Object<FileSourceStage>,
                mrc::segment::ObjectProperties,
                std::shared_ptr<mrc::segment::Object<FileSourceStage>>>(
@@ -192,6 +278,20 @@ PYBIND11_MODULE(stages, _module)
              py::arg("filter_source"),
              py::arg("field_name") = "probs");
 
+    py::class_<mrc::segment::Object<GrokStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<GrokStage>>>(_module, "GrokStage", py::multiple_inheritance())
+        .def(py::init<>(&GrokStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("column"),
+             py::arg("patterns"),
+             py::arg("pattern_files")   = std::vector<std::string>(),
+             py::arg("custom_patterns") = std::map<std::string, std::string>(),
+             py::arg("pattern_column")  = "grok_pattern",
+             py::arg("syslog_year")     = 0,
+             py::arg("num_threads")     = 0);
+
     py::class_<
         mrc::segment::Object<InferenceClientStage<MultiInferenceMessage, MultiResponseMessage>>,
         mrc::segment::ObjectProperties,
@@ -218,8 +318,45 @@ PYBIND11_MODULE(stages, _module)
              py::arg("model_name"),
              py::arg("needs_logits"),
              py::arg("force_convert_inputs"),
-             py::arg("input_mapping")  = py::dict(),
-             py::arg("output_mapping") = py::dict());
+             py::arg("input_mapping")    = py::dict(),
+             py::arg("output_mapping")   = py::dict(),
+             py::arg("dedup_cache_size") = 0);
+
+    py::class_<mrc::segment::Object<InferenceWorkerPoolStageMM>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<InferenceWorkerPoolStageMM>>>(
+        _module, "InferenceWorkerPoolMultiMessageStage", py::multiple_inheritance())
+        .def(py::init<>(&InferenceWorkerPoolStageInterfaceProxy::init_multi),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("worker_factory"),
+             py::arg("num_workers"),
+             py::arg("max_batch_size"),
+             py::arg("max_queue_size") = 0)
+        .def("get_stats",
+             py::overload_cast<mrc::segment::Object<InferenceWorkerPoolStageMM>&>(
+                 &InferenceWorkerPoolStageInterfaceProxy::get_stats))
+        .def("shutdown",
+             py::overload_cast<mrc::segment::Object<InferenceWorkerPoolStageMM>&>(
+                 &InferenceWorkerPoolStageInterfaceProxy::shutdown));
+
+    py::class_<mrc::segment::Object<InferenceWorkerPoolStageCM>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<InferenceWorkerPoolStageCM>>>(
+        _module, "InferenceWorkerPoolControlMessageStage", py::multiple_inheritance())
+        .def(py::init<>(&InferenceWorkerPoolStageInterfaceProxy::init_cm),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("worker_factory"),
+             py::arg("num_workers"),
+             py::arg("max_batch_size"),
+             py::arg("max_queue_size") = 0)
+        .def("get_stats",
+             py::overload_cast<mrc::segment::Object<InferenceWorkerPoolStageCM>&>(
+                 &InferenceWorkerPoolStageInterfaceProxy::get_stats))
+        .def("shutdown",
+             py::overload_cast<mrc::segment::Object<InferenceWorkerPoolStageCM>&>(
+                 &InferenceWorkerPoolStageInterfaceProxy::shutdown));
 
     py::class_<mrc::segment::Object<KafkaSourceStage>,
                mrc::segment::ObjectProperties,
@@ -236,7 +373,18 @@ PYBIND11_MODULE(stages, _module)
              py::arg("disable_pre_filtering") = false,
              py::arg("stop_after")            = 0,
              py::arg("async_commits")         = true,
-             py::arg("oauth_callback")        = py::none())
+             py::arg("oauth_callback")        = py::none(),
+             py::arg("metadata_columns")      = py::list(),
+             py::arg("header_columns")        = py::list(),
+             py::arg("column_prefix")         = "kafka_",
+             py::arg("key_filter")            = py::list(),
+             py::arg("header_filters")        = py::dict(),
+             py::arg("payload_format")        = "json",
+             py::arg("schema_files")          = py::dict(),
+             py::arg("schema_registry")       = py::none(),
+             py::arg("confluent_framing")     = true,
+             py::arg("schema_id")             = 0,
+             py::arg("message_name")          = "")
         .def(py::init<>(&KafkaSourceStageInterfaceProxy::init_with_multiple_topics),
              py::arg("builder"),
              py::arg("name"),
@@ -248,7 +396,34 @@ PYBIND11_MODULE(stages, _module)
              py::arg("disable_pre_filtering") = false,
              py::arg("stop_after")            = 0,
              py::arg("async_commits")         = true,
-             py::arg("oauth_callback")        = py::none());
+             py::arg("oauth_callback")        = py::none(),
+             py::arg("metadata_columns")      = py::list(),
+             py::arg("header_columns")        = py::list(),
+             py::arg("column_prefix")         = "kafka_",
+             py::arg("key_filter")            = py::list(),
+             py::arg("header_filters")        = py::dict(),
+             py::arg("payload_format")        = "json",
+             py::arg("schema_files")          = py::dict(),
+             py::arg("schema_registry")       = py::none(),
+             py::arg("confluent_framing")     = true,
+             py::arg("schema_id")             = 0,
+             py::arg("message_name")          = "");
+
+    py::class_<mrc::segment::Object<PiiMaskStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<PiiMaskStage>>>(
+        _module, "PiiMaskStage", py::multiple_inheritance())
+        .def(py::init<>(&PiiMaskStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("columns"),
+             py::arg("entities"),
+             py::arg("literals")     = py::dict(),
+             py::arg("patterns")     = py::dict(),
+             py::arg("pseudonymize") = false,
+             py::arg("key")          = "",
+             py::arg("num_threads")  = 0,
+             py::arg("use_gpu")      = false);
 
     py::class_<mrc::segment::Object<PreallocateStage<ControlMessage>>,
                mrc::segment::ObjectProperties,
@@ -277,6 +452,23 @@ PYBIND11_MODULE(stages, _module)
              py::arg("name"),
              py::arg("needed_columns"));
 
+    py::class_<mrc::segment::Object<PreprocessEmbeddingStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<PreprocessEmbeddingStage>>>(
+        _module, "PreprocessEmbeddingStage", py::multiple_inheritance())
+        .def(py::init<>(&PreprocessEmbeddingStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("vocab_hash_file"),
+             py::arg("max_length"),
+             py::arg("do_lower_case"),
+             py::arg("bucket_lengths")   = std::vector<TensorIndex>{},
+             py::arg("batch_size")       = 0,
+             py::arg("column")           = "content",
+             py::arg("row_index_column") = "_row_index",
+             py::arg("input_ids_type")   = TypeId::INT32,
+             py::arg("input_mask_type")  = TypeId::INT32);
+
     py::class_<mrc::segment::Object<PreprocessFILStageMM>,
                mrc::segment::ObjectProperties,
                std::shared_ptr<mrc::segment::Object<PreprocessFILStageMM>>>(
@@ -284,7 +476,8 @@ PYBIND11_MODULE(stages, _module)
         .def(py::init<>(&PreprocessFILStageInterfaceProxy::init_multi),
              py::arg("builder"),
              py::arg("name"),
-             py::arg("features"));
+             py::arg("features"),
+             py::arg("input_type") = TypeId::FLOAT32);
 
     py::class_<mrc::segment::Object<PreprocessFILStageCM>,
                mrc::segment::ObjectProperties,
@@ -293,7 +486,8 @@ PYBIND11_MODULE(stages, _module)
         .def(py::init<>(&PreprocessFILStageInterfaceProxy::init_cm),
              py::arg("builder"),
              py::arg("name"),
-             py::arg("features"));
+             py::arg("features"),
+             py::arg("input_type") = TypeId::FLOAT32);
 
     py::class_<mrc::segment::Object<PreprocessNLPStageMM>,
                mrc::segment::ObjectProperties,
@@ -308,7 +502,9 @@ PYBIND11_MODULE(stages, _module)
              py::arg("do_lower_case"),
              py::arg("add_special_token"),
              py::arg("stride"),
-             py::arg("column"));
+             py::arg("column"),
+             py::arg("input_ids_type")  = TypeId::INT32,
+             py::arg("input_mask_type") = TypeId::INT32);
 
     py::class_<mrc::segment::Object<PreprocessNLPStageCM>,
                mrc::segment::ObjectProperties,
@@ -323,7 +519,15 @@ PYBIND11_MODULE(stages, _module)
              py::arg("do_lower_case"),
              py::arg("add_special_token"),
              py::arg("stride"),
-             py::arg("column"));
+             py::arg("column"),
+             py::arg("input_ids_type")  = TypeId::INT32,
+             py::arg("input_mask_type") = TypeId::INT32);
+
+    py::class_<mrc::segment::Object<PreprocessPcapStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<PreprocessPcapStage>>>(
+        _module, "PreprocessPcapStage", py::multiple_inheritance())
+        .def(py::init<>(&PreprocessPcapStageInterfaceProxy::init), py::arg("builder"), py::arg("name"));
 
     py::class_<mrc::segment::Object<HttpServerSourceStage>,
                mrc::segment::ObjectProperties,
@@ -350,6 +554,24 @@ PYBIND11_MODULE(stages, _module)
              py::arg("lines")              = false,
              py::arg("stop_after")         = 0);
 
+    py::class_<mrc::segment::Object<RSSSourceStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<RSSSourceStage>>>(
+        _module, "RSSSourceStage", py::multiple_inheritance())
+        .def(py::init<>(&RSSSourceStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("feed_input"),
+             py::arg("interval_secs")     = 600.0,
+             py::arg("stop_after")        = 0,
+             py::arg("run_indefinitely")  = false,
+             py::arg("batch_size")        = 32,
+             py::arg("cooldown_interval") = 600.0,
+             py::arg("strip_markup")      = false,
+             py::arg("max_seen_entries")  = 100000,
+             py::arg("num_threads")       = 0,
+             py::arg("fetcher")           = py::none());
+
     py::class_<mrc::segment::Object<SerializeStageMM>,
                mrc::segment::ObjectProperties,
                std::shared_ptr<mrc::segment::Object<SerializeStageMM>>>(
@@ -372,6 +594,75 @@ PYBIND11_MODULE(stages, _module)
              py::arg("exclude"),
              py::arg("fixed_columns") = true);
 
+    py::class_<mrc::segment::Object<StringFeaturesStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<StringFeaturesStage>>>(
+        _module, "StringFeaturesStage", py::multiple_inheritance())
+        .def(py::init<>(&StringFeaturesStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("features"),
+             py::arg("num_threads") = 0);
+
+    py::class_<mrc::segment::Object<SyslogParserStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<SyslogParserStage>>>(
+        _module, "SyslogParserStage", py::multiple_inheritance())
+        .def(py::init<>(&SyslogParserStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("column"),
+             py::arg("header_fields"),
+             py::arg("extension_fields") = py::list(),
+             py::arg("column_prefix")    = "",
+             py::arg("error_column")     = "parse_error",
+             py::arg("syslog_year")      = 0,
+             py::arg("num_threads")      = 0);
+
+    py::class_<mrc::segment::Object<TextChunkerStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<TextChunkerStage>>>(
+        _module, "TextChunkerStage", py::multiple_inheritance())
+        .def(py::init<>(&TextChunkerStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("column"),
+             py::arg("chunk_size"),
+             py::arg("chunk_overlap"),
+             py::arg("separators")       = py::list(),
+             py::arg("keep_separator")   = true,
+             py::arg("strip_whitespace") = true,
+             py::arg("length_unit")      = TextLengthUnit::Characters,
+             py::arg("row_id_column")    = "source_row_id",
+             py::arg("offset_column")    = "chunk_offset",
+             py::arg("num_threads")      = 0);
+
+    py::class_<mrc::segment::Object<WebFetchStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<WebFetchStage>>>(
+        _module, "WebFetchStage", py::multiple_inheritance())
+        .def(py::init<>(&WebFetchStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("fetcher"),
+             py::arg("link_column")        = "link",
+             py::arg("content_column")     = "page_content",
+             py::arg("remove_boilerplate") = true);
+
+    py::class_<mrc::segment::Object<WindowsEventParserStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<WindowsEventParserStage>>>(
+        _module, "WindowsEventParserStage", py::multiple_inheritance())
+        .def(py::init<>(&WindowsEventParserStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("column"),
+             py::arg("fields"),
+             py::arg("schemas")      = py::dict(),
+             py::arg("event_id_key") = "EventID",
+             py::arg("error_column") = "parse_error",
+             py::arg("num_threads")  = 0);
+
     py::class_<mrc::segment::Object<WriteToFileStage>,
                mrc::segment::ObjectProperties,
                std::shared_ptr<mrc::segment::Object<WriteToFileStage>>>(
@@ -383,7 +674,8 @@ PYBIND11_MODULE(stages, _module)
              py::arg("mode")              = "w",
              py::arg("file_type")         = FileTypes::Auto,
              py::arg("include_index_col") = true,
-             py::arg("flush")             = false);
+             py::arg("flush")             = false,
+             py::arg("na_rep")            = "");
 
     _module.attr("__version__") =
         MRC_CONCAT_STR(morpheus_VERSION_MAJOR << "." << morpheus_VERSION_MINOR << "." << morpheus_VERSION_PATCH);
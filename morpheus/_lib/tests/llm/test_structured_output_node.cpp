@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/llm/structured_output_node.hpp"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+using llm::StructuredFieldType;
+using llm::StructuredOutputError;
+using llm::StructuredOutputParser;
+
+namespace {
+StructuredOutputParser make_parser(bool allow_key_value = true)
+{
+    return StructuredOutputParser({{"severity", StructuredFieldType::Integer},
+                                   {"malicious", StructuredFieldType::Boolean},
+                                   {"summary", StructuredFieldType::String},
+                                   {"tags", StructuredFieldType::List, false}},
+                                  allow_key_value);
+}
+}  // namespace
+
+TEST_CLASS(StructuredOutputParser);
+
+TEST_F(TestStructuredOutputParser, ParseLenient)
+{
+    auto value = StructuredOutputParser::parse_lenient(R"({
+        // LLMs tend to add comments
+        name: 'eve', "count": 3, 'ratio': 0.5,
+        flags: [True, False, None,],
+        "nested": {"text": "a \"quoted\"\nline é"},
+    } trailing text)");
+
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ((*value)["name"], "eve");
+    EXPECT_EQ((*value)["count"], 3);
+    EXPECT_EQ((*value)["ratio"], 0.5);
+    EXPECT_EQ((*value)["flags"], nlohmann::json::parse("[true, false, null]"));
+    EXPECT_EQ((*value)["nested"]["text"], "a \"quoted\"\nline \xc3\xa9");
+
+    EXPECT_FALSE(StructuredOutputParser::parse_lenient(R"({"unterminated": "value)").has_value());
+    EXPECT_FALSE(StructuredOutputParser::parse_lenient(R"({"missing": })").has_value());
+    EXPECT_FALSE(StructuredOutputParser::parse_lenient("not json").has_value());
+    EXPECT_FALSE(StructuredOutputParser::parse_lenient(std::string(1000, '[')).has_value());
+}
+
+TEST_F(TestStructuredOutputParser, Coerce)
+{
+    EXPECT_EQ(StructuredOutputParser::coerce("42", StructuredFieldType::Integer), nlohmann::json(42));
+    EXPECT_EQ(StructuredOutputParser::coerce(3.0, StructuredFieldType::Integer), nlohmann::json(3));
+    EXPECT_FALSE(StructuredOutputParser::coerce(3.5, StructuredFieldType::Integer).has_value());
+    EXPECT_FALSE(StructuredOutputParser::coerce("high", StructuredFieldType::Integer).has_value());
+
+    EXPECT_EQ(StructuredOutputParser::coerce(" 1.5 ", StructuredFieldType::Float), nlohmann::json(1.5));
+    EXPECT_EQ(StructuredOutputParser::coerce(2, StructuredFieldType::Float), nlohmann::json(2.0));
+
+    EXPECT_EQ(StructuredOutputParser::coerce("Yes", StructuredFieldType::Boolean), nlohmann::json(true));
+    EXPECT_EQ(StructuredOutputParser::coerce(0, StructuredFieldType::Boolean), nlohmann::json(false));
+    EXPECT_FALSE(StructuredOutputParser::coerce("maybe", StructuredFieldType::Boolean).has_value());
+
+    EXPECT_EQ(StructuredOutputParser::coerce(7, StructuredFieldType::String), nlohmann::json("7"));
+    EXPECT_FALSE(StructuredOutputParser::coerce(nlohmann::json::object(), StructuredFieldType::String).has_value());
+
+    EXPECT_EQ(StructuredOutputParser::coerce("a, b,", StructuredFieldType::List), nlohmann::json({"a", "b"}));
+    EXPECT_EQ(StructuredOutputParser::coerce(1, StructuredFieldType::List), nlohmann::json::array({1}));
+}
+
+TEST_F(TestStructuredOutputParser, ParseFencedBlock)
+{
+    auto parser = make_parser();
+
+    auto result = parser.parse(R"(Here is the analysis {of the event}:
+```json
+{"severity": "4", "malicious": true, "summary": "Port scan", "tags": ["recon",],}
+```)");
+
+    EXPECT_EQ(result.error, StructuredOutputError::Ok);
+    EXPECT_EQ(result.fields["severity"], 4);
+    EXPECT_EQ(result.fields["malicious"], true);
+    EXPECT_EQ(result.fields["summary"], "Port scan");
+    EXPECT_EQ(result.fields["tags"], nlohmann::json({"recon"}));
+}
+
+TEST_F(TestStructuredOutputParser, ParseKeyValue)
+{
+    auto parser = make_parser();
+
+    auto result = parser.parse("Severity: 2\n- **Malicious**: no\nSummary: Benign login\nunrelated = 1\n");
+
+    EXPECT_EQ(result.error, StructuredOutputError::Ok);
+    EXPECT_EQ(result.fields["severity"], 2);
+    EXPECT_EQ(result.fields["malicious"], false);
+    EXPECT_EQ(result.fields["summary"], "Benign login");
+    EXPECT_TRUE(result.fields["tags"].is_null());
+
+    EXPECT_EQ(make_parser(false).parse("Severity: 2").error, StructuredOutputError::NoStructure);
+}
+
+TEST_F(TestStructuredOutputParser, Errors)
+{
+    auto parser = make_parser();
+
+    EXPECT_EQ(parser.parse("I cannot help with that.").error, StructuredOutputError::NoStructure);
+    EXPECT_EQ(parser.parse(R"({"severity": 1, "malicious": )").error, StructuredOutputError::Malformed);
+
+    auto missing = parser.parse(R"({"severity": 1, "malicious": false})");
+    EXPECT_EQ(missing.error, StructuredOutputError::MissingField);
+    EXPECT_EQ(missing.fields["severity"], 1);
+
+    auto mismatch = parser.parse(R"({"severity": "high", "malicious": false, "summary": null})");
+    EXPECT_EQ(mismatch.error, StructuredOutputError::TypeMismatch);
+    EXPECT_TRUE(mismatch.fields["severity"].is_null());
+}
+
+TEST_F(TestStructuredOutputParser, ParseBatch)
+{
+    auto parser = make_parser();
+
+    auto responses = nlohmann::json::array(
+        {R"({"severity": 5, "malicious": "true", "summary": "Exfiltration"})", "no structure", nullptr});
+
+    auto output = parser.parse_batch(responses, "error_code");
+
+    EXPECT_EQ(output["severity"], nlohmann::json({5, nullptr, nullptr}));
+    EXPECT_EQ(output["malicious"], nlohmann::json({true, nullptr, nullptr}));
+    EXPECT_EQ(output["summary"], nlohmann::json({"Exfiltration", nullptr, nullptr}));
+    EXPECT_EQ(output["tags"], nlohmann::json({nullptr, nullptr, nullptr}));
+    EXPECT_EQ(output["error_code"], nlohmann::json({0, 1, 1}));
+}
+
+TEST_F(TestStructuredOutputParser, InvalidSchema)
+{
+    EXPECT_THROW(StructuredOutputParser({}), std::invalid_argument);
+    EXPECT_THROW(StructuredOutputParser({{"a", StructuredFieldType::String}, {"a", StructuredFieldType::Integer}}),
+                 std::invalid_argument);
+    EXPECT_THROW(StructuredOutputParser::type_from_string("tuple"), std::invalid_argument);
+    EXPECT_EQ(StructuredOutputParser::type_from_string("Number"), StructuredFieldType::Float);
+}
@@ -18,6 +18,7 @@
 #include "../test_utils/common.hpp"  // IWYU pragma: associated
 #include "test_messages.hpp"         // for TestMessages
 
+#include "morpheus/messages/attachment.hpp"            // for MessageAttachment
 #include "morpheus/messages/control.hpp"               // for ControlMessage
 #include "morpheus/messages/memory/tensor_memory.hpp"  // for TensorMemory
 #include "morpheus/messages/meta.hpp"                  // for MessageMeta
@@ -340,3 +341,52 @@ TEST_F(TestControlMessage, GetTensorMemoryWhenNoneSet)
     // Verify that the retrieved tensor memory is nullptr
     EXPECT_EQ(nullptr, retrievedTensorMemory);
 }
+
+// Test setting and retrieving a host attachment
+TEST_F(TestControlMessage, SetAndGetAttachment)
+{
+    auto msg = ControlMessage();
+
+    std::string data("\x00\x01\x02model", 8);
+    msg.set_attachment("model", std::make_shared<MessageAttachment>(data));
+
+    EXPECT_TRUE(msg.has_attachment("model"));
+    EXPECT_FALSE(msg.has_metadata("model"));
+    EXPECT_EQ(msg.list_attachments(), std::vector<std::string>{"model"});
+
+    auto attachment = msg.get_attachment("model");
+    ASSERT_NE(attachment, nullptr);
+    EXPECT_FALSE(attachment->is_device());
+    EXPECT_EQ(attachment->size(), data.size());
+    EXPECT_EQ(attachment->host_data(), data);
+    EXPECT_THROW(attachment->tensor(), std::runtime_error);
+}
+
+// Test retrieving and removing an attachment which does not exist
+TEST_F(TestControlMessage, GetNonexistentAttachment)
+{
+    auto msg = ControlMessage();
+
+    EXPECT_FALSE(msg.has_attachment("model"));
+    EXPECT_EQ(msg.get_attachment("model"), nullptr);
+    EXPECT_THROW(auto const x = msg.get_attachment("model", true), std::runtime_error);
+    EXPECT_EQ(msg.remove_attachment("model"), nullptr);
+    EXPECT_THROW(msg.set_attachment("model", nullptr), std::invalid_argument);
+}
+
+// Test that copies of a message share its attachments
+TEST_F(TestControlMessage, CopySharesAttachments)
+{
+    auto msg = ControlMessage();
+    msg.set_attachment("model", std::make_shared<MessageAttachment>(std::string(1024, 'm')));
+
+    auto copy = ControlMessage(msg);
+    EXPECT_EQ(copy.get_attachment("model"), msg.get_attachment("model"));
+    EXPECT_EQ(copy.get_attachment("model")->host_data().data(), msg.get_attachment("model")->host_data().data());
+
+    // Removing the attachment from the copy leaves the original untouched
+    auto removed = copy.remove_attachment("model");
+    EXPECT_EQ(removed, msg.get_attachment("model"));
+    EXPECT_FALSE(copy.has_attachment("model"));
+    EXPECT_TRUE(msg.has_attachment("model"));
+}
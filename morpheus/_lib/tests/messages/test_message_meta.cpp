@@ -19,21 +19,29 @@
 #include "../test_utils/tensor_utils.hpp"  // for assert_eq_device_to_host
 #include "test_messages.hpp"               // for TestMessages
 
-#include "morpheus/io/deserializers.hpp"    // for load_table_from_file
-#include "morpheus/messages/meta.hpp"       // for MessageMeta
-#include "morpheus/objects/dtype.hpp"       // for DType
-#include "morpheus/objects/table_info.hpp"  // for TableInfo
-#include "morpheus/objects/tensor.hpp"      // for Tensor
-#include "morpheus/types.hpp"               // for RangeType
+#include "morpheus/io/deserializers.hpp"           // for load_table_from_file
+#include "morpheus/messages/meta.hpp"              // for MessageMeta, SlicedMessageMeta
+#include "morpheus/objects/dtype.hpp"              // for DType
+#include "morpheus/objects/table_info.hpp"         // for TableInfo, MutableTableInfo
+#include "morpheus/objects/table_transaction.hpp"  // for TableTransaction
+#include "morpheus/objects/tensor.hpp"             // for Tensor
+#include "morpheus/types.hpp"                      // for RangeType
 
+#include <cudf/column/column.hpp>    // for column
+#include <cudf/types.hpp>            // for data_type, type_id
 #include <gtest/gtest.h>             // for TestInfo, TEST_F
-#include <pybind11/gil.h>            // for gil_scoped_release
+#include <pybind11/gil.h>            // for gil_scoped_release, gil_scoped_acquire
+#include <pybind11/pybind11.h>       // for module_
+#include <pybind11/pytypes.h>        // for object, dict, list
+#include <pybind11/stl.h>            // IWYU pragma: keep
 #include <rmm/cuda_stream_view.hpp>  // for cuda_stream_per_thread
 #include <rmm/device_buffer.hpp>     // for device_buffer
 
-#include <cstdint>     // for int64_t
+#include <cstdint>     // for int64_t, int32_t
 #include <filesystem>  // for operator/, path
 #include <memory>      // for allocator, __shared_ptr_access, shared_ptr, make_shared
+#include <stdexcept>   // for invalid_argument, runtime_error
+#include <string>      // for string
 #include <vector>      // for vector
 
 using namespace morpheus;
@@ -82,3 +90,138 @@ TEST_F(TestMessageMeta, CopyRangeAndSlicing)
     assert_eq_device_to_host(sliced_meta->get_info().get_column(0), sliced_expected_int);
     assert_eq_device_to_host(sliced_meta->get_info().get_column(1), sliced_expected_double);
 }
+
+TEST_F(TestMessageMeta, CommitTransaction)
+{
+    pybind11::gil_scoped_release no_gil;
+    auto test_data_dir               = test::get_morpheus_root() / "tests/tests_data";
+    std::filesystem::path input_file = test_data_dir / "csv_sample.csv";
+
+    auto meta = MessageMeta::create_from_cpp(load_table_from_file(input_file));
+
+    auto column_names   = meta->get_column_names();
+    const auto num_rows = meta->count();
+    ASSERT_EQ(column_names[0], "int");
+    ASSERT_GE(column_names.size(), 2);
+
+    auto int_values = convert_to_host<int64_t>(meta->get_info().get_column(0));
+
+    std::vector<int32_t> scores(num_rows);
+    for (std::size_t i = 0; i < scores.size(); ++i)
+    {
+        scores[i] = static_cast<int32_t>(i * 10);
+    }
+
+    auto make_column = [](const std::vector<int32_t>& values) {
+        rmm::device_buffer buffer(values.data(), values.size() * sizeof(int32_t), rmm::cuda_stream_per_thread);
+        return std::make_unique<cudf::column>(cudf::data_type{cudf::type_id::INT32},
+                                              static_cast<cudf::size_type>(values.size()),
+                                              std::move(buffer),
+                                              rmm::device_buffer{},
+                                              0);
+    };
+
+    {
+        auto mutable_info = meta->get_mutable_info();
+
+        // Invalid transactions leave the table unchanged
+        TableTransaction unknown_column;
+        unknown_column.drop_column(column_names[1]).drop_column("missing");
+        EXPECT_THROW(mutable_info.commit(std::move(unknown_column)), std::invalid_argument);
+
+        TableTransaction wrong_size;
+        wrong_size.add_column("scores", make_column({1, 2}));
+        EXPECT_THROW(mutable_info.commit(std::move(wrong_size)), std::invalid_argument);
+
+        EXPECT_EQ(mutable_info.get_column_names(), column_names);
+
+        TableTransaction transaction;
+        transaction.rename_column("int", "old_int").add_column("int", make_column(scores)).drop_column(column_names[1]);
+        mutable_info.commit(std::move(transaction));
+    }
+
+    column_names[0] = "old_int";
+    column_names.erase(column_names.begin() + 1);
+    column_names.emplace_back("int");
+
+    EXPECT_EQ(meta->get_column_names(), column_names);
+    assert_eq_device_to_host(meta->get_info("old_int").get_column(0), int_values);
+    assert_eq_device_to_host(meta->get_info("int").get_column(0), scores);
+
+    // Preallocated columns are committed natively
+    {
+        auto mutable_info = meta->get_mutable_info();
+        mutable_info.insert_missing_columns({{"int", DType(TypeId::INT32)}, {"zeros", DType(TypeId::FLOAT32)}});
+    }
+
+    assert_eq_device_to_host(meta->get_info("zeros").get_column(0), std::vector<float>(num_rows, 0));
+
+    // The python object sees the changes and can't be changed while a transaction is committed
+    {
+        auto mutable_info = meta->get_mutable_info();
+
+        pybind11::gil_scoped_acquire gil;
+        auto df = mutable_info.checkout_obj();
+
+        column_names.emplace_back("zeros");
+        EXPECT_EQ(df->attr("columns").attr("to_list")().cast<std::vector<std::string>>(), column_names);
+
+        TableTransaction transaction;
+        transaction.drop_column("zeros");
+        EXPECT_THROW(mutable_info.commit(std::move(transaction)), std::runtime_error);
+
+        mutable_info.return_obj(std::move(df));
+    }
+}
+
+TEST_F(TestMessageMeta, InsertColumnsIntoSlice)
+{
+    pybind11::gil_scoped_release no_gil;
+    auto test_data_dir               = test::get_morpheus_root() / "tests/tests_data";
+    std::filesystem::path input_file = test_data_dir / "csv_sample.csv";
+
+    auto meta         = MessageMeta::create_from_cpp(load_table_from_file(input_file));
+    auto column_names = meta->get_column_names();
+    auto sliced_meta  = std::make_shared<SlicedMessageMeta>(meta, 2, 4, std::vector<std::string>{"int"});
+
+    {
+        auto mutable_info = sliced_meta->get_mutable_info();
+
+        // Columns of the whole table outside of the slice already exist and aren't inserted again
+        mutable_info.insert_missing_columns(
+            {{column_names[1], DType(TypeId::FLOAT64)}, {"zeros", DType(TypeId::FLOAT32)}});
+
+        EXPECT_EQ(mutable_info.get_column_names(), (std::vector<std::string>{"int", "zeros"}));
+        EXPECT_EQ(mutable_info.num_rows(), 2);
+    }
+
+    column_names.emplace_back("zeros");
+    EXPECT_EQ(meta->get_column_names(), column_names);
+    assert_eq_device_to_host(sliced_meta->get_info("zeros").get_column(0), std::vector<float>(2, 0));
+}
+
+TEST_F(TestMessageMeta, CommitNonStringLabels)
+{
+    pybind11::dict data;
+    data[pybind11::int_(0)] = std::vector<int32_t>{1, 2, 3};
+    data["b"]               = std::vector<int32_t>{4, 5, 6};
+
+    auto meta = MessageMeta::create_from_python(pybind11::module_::import("cudf").attr("DataFrame")(data));
+
+    {
+        auto mutable_info = meta->get_mutable_info();
+        mutable_info.insert_columns({{"scores", DType(TypeId::INT32)}});
+    }
+
+    // The existing columns keep their labels once the committed columns are converted into a new DataFrame
+    auto mutable_info = meta->get_mutable_info();
+    auto df           = mutable_info.checkout_obj();
+
+    pybind11::list expected_labels;
+    expected_labels.append(0);
+    expected_labels.append("b");
+    expected_labels.append("scores");
+    EXPECT_TRUE(df->attr("columns").attr("to_list")().equal(expected_labels));
+
+    mutable_info.return_obj(std::move(df));
+}
@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/anomaly_scorer.hpp"  // for AnomalyScorer, LossScaler
+
+#include <gtest/gtest.h>
+
+#include <cmath>      // for isnan, nan
+#include <cstddef>    // for size_t
+#include <stdexcept>  // for invalid_argument
+#include <utility>    // for pair
+#include <vector>     // for vector
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(AnomalyScorer);
+
+TEST_F(TestAnomalyScorer, Score)
+{
+    AnomalyScorer scorer({"a", "b"});
+    EXPECT_FALSE(scorer.has_thresholds());
+
+    std::vector<double> a{1.0, 10.0, std::nan(""), std::nan("")};
+    std::vector<double> b{0.0, 0.0, 12.0, std::nan("")};
+
+    auto scores = scorer.score({a.data(), b.data()}, 4, {LossScaler{0.0, 1.0}, LossScaler{2.0, 2.0}});
+
+    EXPECT_EQ(scores.num_rows, 4);
+    ASSERT_EQ(scores.feature_abs_z.size(), 8);
+    EXPECT_DOUBLE_EQ(scores.feature_abs_z[1], 10.0);
+    EXPECT_DOUBLE_EQ(scores.feature_abs_z[4], 1.0);
+    EXPECT_DOUBLE_EQ(scores.feature_abs_z[6], 5.0);
+
+    // Null losses are skipped, a row without any loss has null scores
+    EXPECT_DOUBLE_EQ(scores.max_abs_z[0], 1.0);
+    EXPECT_DOUBLE_EQ(scores.mean_abs_z[0], 1.0);
+    EXPECT_DOUBLE_EQ(scores.max_abs_z[1], 10.0);
+    EXPECT_DOUBLE_EQ(scores.mean_abs_z[1], 5.5);
+    EXPECT_DOUBLE_EQ(scores.max_abs_z[2], 5.0);
+    EXPECT_DOUBLE_EQ(scores.mean_abs_z[2], 5.0);
+    EXPECT_TRUE(std::isnan(scores.max_abs_z[3]));
+    EXPECT_TRUE(std::isnan(scores.mean_abs_z[3]));
+
+    // Without thresholds every row is an anomaly
+    std::vector<std::pair<std::size_t, std::size_t>> expected_ranges{{0, 4}};
+    EXPECT_EQ(scores.anomaly_ranges, expected_ranges);
+
+    EXPECT_THROW(scorer.score({a.data()}, 4, {LossScaler{}}), std::invalid_argument);
+}
+
+TEST_F(TestAnomalyScorer, Thresholds)
+{
+    std::vector<double> a{1.0, 10.0, 0.0, 0.0, 3.0};
+    std::vector<double> b{0.0, 0.0, 0.0, 6.0, 3.0};
+    std::vector<LossScaler> scalers{LossScaler{}, LossScaler{}};
+
+    AnomalyScorer mean_threshold({"a", "b"}, 2.0);
+    std::vector<std::pair<std::size_t, std::size_t>> expected_ranges{{1, 2}, {3, 5}};
+    EXPECT_EQ(mean_threshold.score({a.data(), b.data()}, 5, scalers).anomaly_ranges, expected_ranges);
+
+    // Rows exceeding either the mean threshold or the threshold of a feature are anomalies
+    AnomalyScorer feature_threshold({"a", "b"}, 5.0, {{"a", 0.5}});
+    EXPECT_TRUE(feature_threshold.has_thresholds());
+    expected_ranges = {{0, 2}, {4, 5}};
+    EXPECT_EQ(feature_threshold.score({a.data(), b.data()}, 5, scalers).anomaly_ranges, expected_ranges);
+
+    EXPECT_THROW(AnomalyScorer({"a", "b"}, std::nullopt, {{"c", 1.0}}), std::invalid_argument);
+}
+
+TEST_F(TestAnomalyScorer, AnomalyRanges)
+{
+    // Scores computed elsewhere, such as by the model, null scores never exceed a threshold
+    std::vector<double> a{1.0, std::nan(""), 0.0, 0.0};
+    std::vector<double> b{0.0, 0.0, 6.0, std::nan("")};
+    std::vector<double> mean_abs_z{0.5, 0.0, 3.0, std::nan("")};
+
+    AnomalyScorer scorer({"a", "b"}, 2.0, {{"a", 0.5}});
+    std::vector<std::pair<std::size_t, std::size_t>> expected_ranges{{0, 1}, {2, 3}};
+    EXPECT_EQ(scorer.anomaly_ranges({a.data(), b.data()}, mean_abs_z.data(), 4), expected_ranges);
+
+    expected_ranges = {{0, 4}};
+    EXPECT_EQ(AnomalyScorer({"a", "b"}).anomaly_ranges({a.data(), b.data()}, mean_abs_z.data(), 4), expected_ranges);
+
+    EXPECT_THROW(scorer.anomaly_ranges({a.data()}, mean_abs_z.data(), 4), std::invalid_argument);
+}
@@ -0,0 +1,166 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/document_converter.hpp"  // for CsvDocumentConverter, DocxDocumentConverter
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+namespace {
+// A DOCX archive written by Python's `zipfile` with deflated entries, `word/document.xml` holds the paragraphs
+// "Hello<tab>world & all", an empty paragraph and "Line<break>break", along with a tab stop in the paragraph properties
+constexpr char DocxBytes[] =
+    "\x50\x4b\x03\x04\x14\x00\x00\x00\x08\x00\x29\xa2\x52\x5d\xc7\x1c\x17\x3c\x0a\x00\x00\x00\x08\x00\x00"
+    "\x00\x13\x00\x00\x00\x5b\x43\x6f\x6e\x74\x65\x6e\x74\x5f\x54\x79\x70\x65\x73\x5d\x2e\x78\x6d\x6c\xb3"
+    "\x09\xa9\x2c\x48\x2d\xd6\xb7\x03\x00\x50\x4b\x03\x04\x14\x00\x00\x00\x08\x00\x29\xa2\x52\x5d\xf0\x60"
+    "\x4b\xde\xf1\x00\x00\x00\x93\x01\x00\x00\x11\x00\x00\x00\x77\x6f\x72\x64\x2f\x64\x6f\x63\x75\x6d\x65"
+    "\x6e\x74\x2e\x78\x6d\x6c\x6d\x50\xcb\x52\xc3\x30\x0c\xfc\x15\x8f\x0e\xdc\xa8\x42\x0f\xc0\x84\xd8\xbd"
+    "\x31\x1c\x38\x70\x80\x0f\x50\x62\xb5\xcd\xd4\xaf\xb1\x4d\x42\xff\x1e\x27\x4d\x0a\xcc\x70\xd1\x8e\x66"
+    "\xa5\xd5\xae\x9a\xdd\x97\x35\x62\xe0\x98\x7a\xef\x24\xdc\x6d\x2a\x10\xec\x3a\xaf\x7b\x77\x90\xf0\xf1"
+    "\xfe\x7c\xfb\x08\x22\x65\x72\x9a\x8c\x77\x2c\xe1\xcc\x09\x76\xaa\x19\x6b\xed\xbb\x4f\xcb\x2e\x8b\x22"
+    "\xe0\x52\x3d\x4a\x38\xe6\x1c\x6a\xc4\xd4\x1d\xd9\x52\xda\xf8\xc0\xae\x70\x7b\x1f\x2d\xe5\xd2\xc6\x03"
+    "\x8e\x3e\xea\x10\x7d\xc7\x29\x15\x7d\x6b\x70\x5b\x55\xf7\x68\xa9\x77\x30\x49\xb6\x5e\x9f\x27\x0c\x73"
+    "\x79\x8b\x13\x64\x6a\xd3\x82\x62\xac\x07\x32\x12\x0c\xef\x33\x94\x26\xf8\x24\xe1\x61\x5b\x01\xaa\x06"
+    "\xd7\x49\xbc\x6e\x5e\xd6\xd5\x0b\x1b\xe3\x67\x7e\x26\x7f\x51\xd4\xe2\x8c\x53\x82\x3a\x05\xea\x4a\xbc"
+    "\x10\x39\x71\x1c\x18\x54\xf1\x6a\xb4\xb8\x21\x1b\x9e\x04\x19\xf3\x47\x01\x57\x8f\x78\xb5\xbb\x5c\x7b"
+    "\xed\x1d\x2f\xa3\x25\x4f\xbc\x1c\x50\x6d\x64\x3a\xfd\xa3\x80\x6b\x66\xfc\xf9\xa7\xfa\x06\x50\x4b\x01"
+    "\x02\x14\x03\x14\x00\x00\x00\x08\x00\x29\xa2\x52\x5d\xc7\x1c\x17\x3c\x0a\x00\x00\x00\x08\x00\x00\x00"
+    "\x13\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x01\x00\x00\x00\x00\x5b\x43\x6f\x6e\x74\x65\x6e"
+    "\x74\x5f\x54\x79\x70\x65\x73\x5d\x2e\x78\x6d\x6c\x50\x4b\x01\x02\x14\x03\x14\x00\x00\x00\x08\x00\x29"
+    "\xa2\x52\x5d\xf0\x60\x4b\xde\xf1\x00\x00\x00\x93\x01\x00\x00\x11\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x80\x01\x3b\x00\x00\x00\x77\x6f\x72\x64\x2f\x64\x6f\x63\x75\x6d\x65\x6e\x74\x2e\x78\x6d\x6c"
+    "\x50\x4b\x05\x06\x00\x00\x00\x00\x02\x00\x02\x00\x80\x00\x00\x00\x5b\x01\x00\x00\x00\x00";
+
+const std::string DocxArchive(DocxBytes, sizeof(DocxBytes) - 1);
+}  // namespace
+
+TEST_CLASS(DocumentConverter);
+
+TEST_F(TestDocumentConverter, Text)
+{
+    TextDocumentConverter converter;
+
+    EXPECT_EQ(converter.convert("plain text\n"), std::vector<std::string>{"plain text\n"});
+    EXPECT_EQ(converter.convert("\xEF\xBB\xBFwith a byte order mark"),
+              std::vector<std::string>{"with a byte order mark"});
+}
+
+TEST_F(TestDocumentConverter, CsvParse)
+{
+    auto records = CsvDocumentConverter::parse("a,b,c\r\n1,\"two, three\",\"say \"\"hi\"\"\"\n\n\"multi\nline\",,\n");
+
+    std::vector<std::vector<std::string>> expected{
+        {"a", "b", "c"}, {"1", "two, three", "say \"hi\""}, {"multi\nline", "", ""}};
+    EXPECT_EQ(records, expected);
+
+    EXPECT_EQ(CsvDocumentConverter::parse("a;b\n1;2", ';'),
+              (std::vector<std::vector<std::string>>{{"a", "b"}, {"1", "2"}}));
+    EXPECT_THROW(CsvDocumentConverter::parse("a\n\"unterminated"), std::invalid_argument);
+}
+
+TEST_F(TestDocumentConverter, Csv)
+{
+    const std::string_view document = "id,title,content\n1,First,Some text\n2,,\"More, text\"\n3\n";
+
+    EXPECT_EQ(CsvDocumentConverter().convert(document), (std::vector<std::string>{"Some text", "More, text", ""}));
+
+    // Columns are joined in sorted order
+    EXPECT_EQ(CsvDocumentConverter({"title", "content"}).convert(document),
+              (std::vector<std::string>{"Some text First", "More, text ", " "}));
+
+    EXPECT_THROW(CsvDocumentConverter({"missing"}).convert(document), std::invalid_argument);
+    EXPECT_THROW(CsvDocumentConverter(std::vector<std::string>{}), std::invalid_argument);
+}
+
+TEST_F(TestDocumentConverter, Html)
+{
+    const std::string_view document =
+        "<!DOCTYPE html><html><head><title>Page &amp; Title</title>"
+        "<style>p { color: red; }</style><script type=\"text/javascript\">if (a < b) { x = \"</p>\"; }</script>"
+        "</head><body><!-- a <b>comment</b> --><h1>Heading</h1>"
+        "<p class=\"x > y\">Some   <b>bold</b>\n text&nbsp;&#8212;&#x41;&unknown;</p>"
+        "<ul><li>One</li><li>Two<br/>lines</li></ul>"
+        "<table><tr><td>a</td><td>b</td></tr></table>1 < 2</body></html>";
+
+    const std::string expected =
+        "Page & Title\nHeading\nSome bold text \xE2\x80\x94"
+        "A&unknown;\nOne\nTwo\nlines\na b\n1 < 2";
+
+    EXPECT_EQ(HtmlDocumentConverter().convert(document), std::vector<std::string>{expected});
+}
+
+TEST_F(TestDocumentConverter, HtmlBoilerplate)
+{
+    const std::string_view document =
+        "<html><body><header><nav><a href=\"/\">Home</a></nav><h1>Site</h1></header>"
+        "<main><h1>Article</h1><p>Text</p><aside>Related <NAV>links</NAV> and ads</Aside><p>More</p></main>"
+        "<form><input name=\"q\"/></form><footer>Copyright <nav>unclosed</footer>End</body></html>";
+
+    const std::string expected =
+        "Home\nSite\nArticle\nText\nRelated\nlinks\nand ads\nMore\nCopyright\nunclosed\nEnd";
+
+    EXPECT_EQ(HtmlDocumentConverter().convert(document), std::vector<std::string>{expected});
+    EXPECT_EQ(HtmlDocumentConverter(true).convert(document), std::vector<std::string>{"Article\nText\nMore\nEnd"});
+}
+
+TEST_F(TestDocumentConverter, Docx)
+{
+    EXPECT_EQ(DocxDocumentConverter::read_zip_entry(DocxArchive, "[Content_Types].xml"), "<Types/>");
+    EXPECT_EQ(DocxDocumentConverter().convert(DocxArchive),
+              std::vector<std::string>{"Hello\tworld & all\n\nLine\nbreak"});
+
+    EXPECT_THROW(DocxDocumentConverter::read_zip_entry(DocxArchive, "word/missing.xml"), std::invalid_argument);
+    EXPECT_THROW(DocxDocumentConverter().convert("not a zip archive"), std::invalid_argument);
+
+    // Truncated archives are rejected rather than read out of bounds
+    EXPECT_THROW(DocxDocumentConverter().convert(DocxArchive.substr(0, DocxArchive.size() / 2)), std::invalid_argument);
+
+    // An entry claiming more than deflate can produce from its compressed size is rejected before allocating
+    std::string bomb(DocxArchive);
+    bomb.replace(436, 4, "\xff\xff\xff\x7f", 4);  // uncompressed size of `word/document.xml` in the central directory
+    EXPECT_THROW(DocxDocumentConverter().convert(bomb), std::runtime_error);
+}
+
+TEST_F(TestDocumentConverter, Registry)
+{
+    auto registry = DocumentConverterRegistry::create_default();
+
+    EXPECT_EQ(registry.file_types(), (std::vector<std::string>{"csv", "docx", "htm", "html", "txt"}));
+    EXPECT_NE(std::dynamic_pointer_cast<HtmlDocumentConverter>(registry.find_converter("HTML")), nullptr);
+
+    // Types without a converter use the text converter by default
+    EXPECT_NE(std::dynamic_pointer_cast<TextDocumentConverter>(registry.find_converter("md")), nullptr);
+    registry.set_default_converter(nullptr);
+    EXPECT_EQ(registry.find_converter("md"), nullptr);
+
+    registry.register_converter("PDF", std::make_shared<FunctionDocumentConverter>([](std::string_view /*data*/) {
+        return std::vector<std::string>{"page 1", "page 2"};
+    }));
+
+    EXPECT_EQ(registry.find_converter("pdf")->convert("%PDF"), (std::vector<std::string>{"page 1", "page 2"}));
+    EXPECT_THROW(registry.register_converter("txt", nullptr), std::invalid_argument);
+}
@@ -78,6 +78,11 @@ TEST_F(TestDType, FromNumpyValidStr)
     ASSERT_EQ(dtype.item_size(), 1);
     ASSERT_EQ(dtype.type_str(), "|b1");
 
+    dtype = DType::from_numpy("<f2");
+    ASSERT_EQ(dtype.type_id(), TypeId::FLOAT16);
+    ASSERT_EQ(dtype.item_size(), 2);
+    ASSERT_EQ(dtype.type_str(), "<f2");
+
     dtype = DType::from_numpy("<f4");
     ASSERT_EQ(dtype.type_id(), TypeId::FLOAT32);
     ASSERT_EQ(dtype.item_size(), 4);
@@ -166,6 +171,12 @@ TEST_F(TestDType, FromTritonValidStr)
     ASSERT_EQ(dtype.item_size(), 1);
     ASSERT_EQ(dtype.type_str(), "|b1");
 
+    dtype = DType::from_triton("FP16");
+    ASSERT_EQ(dtype.type_id(), TypeId::FLOAT16);
+    ASSERT_EQ(dtype.triton_str(), "FP16");
+    ASSERT_EQ(dtype.item_size(), 2);
+    ASSERT_EQ(dtype.type_str(), "<f2");
+
     dtype = DType::from_triton("FP32");
     ASSERT_EQ(dtype.type_id(), TypeId::FLOAT32);
     ASSERT_EQ(dtype.triton_str(), "FP32");
@@ -289,7 +300,8 @@ TEST_F(TestDType, FromCudfNotSupported)
 
 TEST_F(TestDType, IsFullySupported)
 {
-    std::set<TypeId> unsupported_types = {TypeId::EMPTY, TypeId::STRING, TypeId::NUM_TYPE_IDS};
+    // FLOAT16 is only supported by tensors, cudf has no half precision type
+    std::set<TypeId> unsupported_types = {TypeId::EMPTY, TypeId::STRING, TypeId::FLOAT16, TypeId::NUM_TYPE_IDS};
     for (auto type_id = static_cast<int32_t>(TypeId::EMPTY); type_id <= static_cast<int32_t>(TypeId::NUM_TYPE_IDS);
          ++type_id)
     {
@@ -299,3 +311,36 @@ TEST_F(TestDType, IsFullySupported)
         ASSERT_EQ(dtype.is_fully_supported(), !unsupported_types.contains(enum_type_id));
     }
 }
+
+TEST_F(TestDType, IsIntegral)
+{
+    EXPECT_TRUE(DType(TypeId::INT8).is_integral());
+    EXPECT_TRUE(DType(TypeId::INT16).is_integral());
+    EXPECT_TRUE(DType(TypeId::UINT32).is_integral());
+    EXPECT_TRUE(DType(TypeId::UINT64).is_integral());
+
+    EXPECT_FALSE(DType(TypeId::BOOL8).is_integral());
+    EXPECT_FALSE(DType(TypeId::FLOAT16).is_integral());
+    EXPECT_FALSE(DType(TypeId::FLOAT32).is_integral());
+    EXPECT_FALSE(DType(TypeId::STRING).is_integral());
+    EXPECT_FALSE(DType(TypeId::EMPTY).is_integral());
+}
+
+TEST_F(TestDType, CanSafelyCastTo)
+{
+    EXPECT_TRUE(DType(TypeId::INT16).can_safely_cast_to(DType(TypeId::INT16)));
+    EXPECT_TRUE(DType(TypeId::INT16).can_safely_cast_to(DType(TypeId::INT32)));
+    EXPECT_TRUE(DType(TypeId::UINT8).can_safely_cast_to(DType(TypeId::INT16)));
+    EXPECT_TRUE(DType(TypeId::UINT8).can_safely_cast_to(DType(TypeId::FLOAT16)));
+    EXPECT_TRUE(DType(TypeId::INT32).can_safely_cast_to(DType(TypeId::FLOAT64)));
+    EXPECT_TRUE(DType(TypeId::FLOAT16).can_safely_cast_to(DType(TypeId::FLOAT32)));
+    EXPECT_TRUE(DType(TypeId::BOOL8).can_safely_cast_to(DType(TypeId::UINT8)));
+
+    EXPECT_FALSE(DType(TypeId::INT32).can_safely_cast_to(DType(TypeId::INT16)));
+    EXPECT_FALSE(DType(TypeId::INT8).can_safely_cast_to(DType(TypeId::UINT16)));
+    EXPECT_FALSE(DType(TypeId::UINT8).can_safely_cast_to(DType(TypeId::INT8)));
+    EXPECT_FALSE(DType(TypeId::INT32).can_safely_cast_to(DType(TypeId::FLOAT32)));
+    EXPECT_FALSE(DType(TypeId::FLOAT32).can_safely_cast_to(DType(TypeId::FLOAT16)));
+    EXPECT_FALSE(DType(TypeId::FLOAT32).can_safely_cast_to(DType(TypeId::INT64)));
+    EXPECT_FALSE(DType(TypeId::STRING).can_safely_cast_to(DType(TypeId::INT64)));
+}
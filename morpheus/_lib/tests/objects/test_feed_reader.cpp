@@ -0,0 +1,216 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/bounded_hash_set.hpp"  // for BoundedHashSet
+#include "morpheus/objects/feed_reader.hpp"       // for FeedParser, FeedReader, FeedEntry
+
+#include <gtest/gtest.h>
+#include <unistd.h>  // for getpid
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+namespace {
+const std::string RssFeed =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<!-- comment <item> -->\n"
+    "<rss version=\"2.0\" xmlns:content=\"http://purl.org/rss/1.0/modules/content/\" "
+    "xmlns:dc=\"http://purl.org/dc/elements/1.1/\">"
+    "<channel><title>Channel</title><link>https://example.com/</link>"
+    "<item><title>First &amp; &#8220;best&#x201D;</title><link> https://example.com/1 </link>"
+    "<guid isPermaLink=\"false\">id-1</guid><description><![CDATA[<p>Some <b>bold</b> text</p>]]></description>"
+    "<content:encoded>&lt;p&gt;Full&lt;/p&gt;</content:encoded><pubDate>Mon, 01 Jan 2024 00:00:00 GMT</pubDate>"
+    "<dc:creator>Jane</dc:creator><media:title>ignored</media:title></item>"
+    "<item><title>No guid</title><link>https://example.com/2</link></item>"
+    "</channel></rss>";
+
+const std::string AtomFeed =
+    "<?xml version=\"1.0\"?><feed xmlns=\"http://www.w3.org/2005/Atom\"><title>Feed</title>"
+    "<entry><id>urn:1</id><title type=\"html\">Entry</title>"
+    "<link rel=\"self\" href=\"https://example.com/self\"/><link href=\"https://example.com/a?x=1&amp;y=2\"/>"
+    "<author><name>John</name><email>john@example.com</email></author>"
+    "<summary>Short</summary><content type=\"xhtml\"><div><p>Rich</p></div></content>"
+    "<published>2024-01-01T00:00:00Z</published><updated>2024-01-02T00:00:00Z</updated></entry>"
+    "</feed>";
+}  // namespace
+
+class TestFeedReader : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        m_temp_dir = std::filesystem::temp_directory_path() / ("test_feed_reader_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(m_temp_dir);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(m_temp_dir);
+    }
+
+    std::string write_file(const std::string& name, const std::string& content)
+    {
+        auto path = m_temp_dir / name;
+        std::ofstream(path) << content;
+        return path.string();
+    }
+
+    std::filesystem::path m_temp_dir;
+};
+
+TEST_F(TestFeedReader, ParseRss)
+{
+    auto entries = FeedParser::parse(RssFeed);
+    ASSERT_EQ(entries.size(), 2);
+
+    FeedEntry expected;
+    expected.id        = "id-1";
+    expected.title     = "First & \xE2\x80\x9C" "best\xE2\x80\x9D";
+    expected.link      = "https://example.com/1";
+    expected.summary   = "<p>Some <b>bold</b> text</p>";
+    expected.content   = "<p>Full</p>";
+    expected.published = "Mon, 01 Jan 2024 00:00:00 GMT";
+    expected.author    = "Jane";
+    EXPECT_EQ(entries[0], expected);
+
+    // Entries without an id are identified by their link
+    EXPECT_EQ(entries[1].id, "https://example.com/2");
+}
+
+TEST_F(TestFeedReader, ParseAtom)
+{
+    auto entries = FeedParser::parse(AtomFeed);
+    ASSERT_EQ(entries.size(), 1);
+
+    FeedEntry expected;
+    expected.id        = "urn:1";
+    expected.title     = "Entry";
+    expected.link      = "https://example.com/a?x=1&y=2";
+    expected.summary   = "Short";
+    expected.content   = "Rich";
+    expected.published = "2024-01-01T00:00:00Z";
+    expected.updated   = "2024-01-02T00:00:00Z";
+    expected.author    = "John";
+    EXPECT_EQ(entries[0], expected);
+}
+
+TEST_F(TestFeedReader, ParseIncremental)
+{
+    // Splitting the document anywhere gives the same entries
+    const auto expected = FeedParser::parse(RssFeed);
+    for (std::size_t split = 1; split < RssFeed.size(); ++split)
+    {
+        FeedParser parser;
+        parser.feed(std::string_view(RssFeed).substr(0, split));
+        parser.feed(std::string_view(RssFeed).substr(split));
+        ASSERT_EQ(parser.finish(), expected) << "split at " << split;
+    }
+
+    FeedParser byte_parser;
+    for (char c : AtomFeed)
+    {
+        byte_parser.feed(std::string_view(&c, 1));
+    }
+
+    EXPECT_EQ(byte_parser.finish(), FeedParser::parse(AtomFeed));
+}
+
+TEST_F(TestFeedReader, ParseInvalid)
+{
+    EXPECT_THROW(FeedParser::parse("<html><body><item>x</item></body></html>"), std::invalid_argument);
+    EXPECT_THROW(FeedParser::parse("<rss><channel><item><title>x</title"), std::invalid_argument);
+    EXPECT_THROW(FeedParser::parse("<rss>< 1</rss>"), std::invalid_argument);
+    EXPECT_TRUE(FeedParser::parse("<rss><channel></channel></rss>").empty());
+}
+
+TEST_F(TestFeedReader, BoundedHashSet)
+{
+    BoundedHashSet set(2);
+    EXPECT_TRUE(set.insert("a"));
+    EXPECT_FALSE(set.insert("a"));
+    EXPECT_TRUE(set.insert("b"));
+    EXPECT_TRUE(set.insert("c"));
+
+    // The oldest key was forgotten
+    EXPECT_EQ(set.size(), 2);
+    EXPECT_FALSE(set.contains("a"));
+    EXPECT_TRUE(set.contains("c"));
+    EXPECT_TRUE(set.insert("a"));
+
+    BoundedHashSet disabled(0);
+    EXPECT_TRUE(disabled.insert("a"));
+    EXPECT_TRUE(disabled.insert("a"));
+}
+
+TEST_F(TestFeedReader, Poll)
+{
+    auto rss_path  = write_file("feed.xml", RssFeed);
+    auto atom_path = write_file("atom.xml", AtomFeed);
+    auto bad_path  = write_file("bad.xml", "not a feed");
+
+    std::vector<std::string> fetched;
+    FeedReaderConfig config;
+    config.feeds        = {rss_path, "http://example.com/feed", atom_path, bad_path, rss_path};
+    config.num_threads  = 2;
+    config.strip_markup = true;
+
+    FeedReader reader(config, [&fetched](const std::vector<std::string>& urls) {
+        fetched.insert(fetched.end(), urls.begin(), urls.end());
+
+        WebResponse response;
+        response.url    = urls[0];
+        response.status = 200;
+        response.body   = "<rss><channel><item><guid>id-1</guid></item><item><guid>id-3</guid></item></channel></rss>";
+
+        return std::vector<WebResponse>{response};
+    });
+
+    EXPECT_EQ(reader.feeds(), (std::vector<std::string>{rss_path, "http://example.com/feed", atom_path, bad_path}));
+
+    // Entries are returned in the order of the feeds, once
+    auto entries = reader.poll();
+    ASSERT_EQ(entries.size(), 4);
+    EXPECT_EQ(entries[0].id, "id-1");
+    EXPECT_EQ(entries[0].summary, "Some bold text");
+    EXPECT_EQ(entries[1].id, "https://example.com/2");
+    EXPECT_EQ(entries[2].id, "id-3");
+    EXPECT_EQ(entries[3].id, "urn:1");
+    EXPECT_EQ(fetched, std::vector<std::string>{"http://example.com/feed"});
+
+    EXPECT_EQ(reader.feed_stats(rss_path).success_count, 1);
+    EXPECT_EQ(reader.feed_stats(bad_path).failure_count, 1);
+
+    // Only new entries are returned, the failed feed is cooling down
+    write_file("atom.xml", "<feed><entry><id>urn:1</id></entry><entry><id>urn:2</id></entry></feed>");
+    entries = reader.poll();
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries[0].id, "urn:2");
+    EXPECT_EQ(reader.feed_stats(bad_path).failure_count, 1);
+
+    EXPECT_THROW(reader.feed_stats("other"), std::invalid_argument);
+    EXPECT_THROW(FeedReader({{"missing.xml"}}), std::invalid_argument);
+    EXPECT_THROW(FeedReader({{"http://example.com/feed"}}), std::invalid_argument);
+}
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/messages/meta.hpp"             // for MessageMeta
+#include "morpheus/objects/file_batch_cache.hpp"  // for FileBatchCache
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <unistd.h>  // for getpid
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+class TestFileBatchCache : public TestWithPythonInterpreter
+{
+  protected:
+    void SetUp() override
+    {
+        TestWithPythonInterpreter::SetUp();
+
+        m_cache_dir = std::filesystem::temp_directory_path() /
+                      ("morpheus_test_file_batch_cache_" + std::to_string(::getpid()));
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(m_cache_dir);
+
+        TestWithPythonInterpreter::TearDown();
+    }
+
+    std::filesystem::path m_cache_dir;
+};
+
+TEST_F(TestFileBatchCache, Key)
+{
+    FileBatchCache cache(m_cache_dir, 1 << 20, "v1");
+    FileBatchCache other_version(m_cache_dir, 1 << 20, "v2");
+
+    const auto key = cache.key("/data/a.json", 100, "1700000000.0");
+    EXPECT_EQ(key.size(), 16);
+    EXPECT_EQ(key, cache.key("/data/a.json", 100, "1700000000.0"));
+
+    EXPECT_NE(key, cache.key("/data/b.json", 100, "1700000000.0"));
+    EXPECT_NE(key, cache.key("/data/a.json", 101, "1700000000.0"));
+    EXPECT_NE(key, cache.key("/data/a.json", 100, "1700000001.0"));
+    EXPECT_NE(key, other_version.key("/data/a.json", 100, "1700000000.0"));
+}
+
+TEST_F(TestFileBatchCache, PutAndGet)
+{
+    FileBatchCache cache(m_cache_dir, 1 << 20);
+    const auto key = cache.key("/data/a.json", 100, "1700000000.0");
+
+    EXPECT_EQ(cache.get(key), nullptr);
+
+    auto meta = create_mock_msg_meta({"col1", "col2", "col3"}, {"int32", "float32", "string"}, 5);
+    cache.put(key, *meta);
+    EXPECT_TRUE(cache.contains(key));
+
+    auto cached = cache.get(key);
+    ASSERT_NE(cached, nullptr);
+    EXPECT_EQ(cached->count(), 5);
+    EXPECT_EQ(cached->get_column_names(), (std::vector<std::string>{"col1", "col2", "col3"}));
+
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.writes, 1);
+    EXPECT_EQ(stats.entries, 1);
+    EXPECT_GT(stats.bytes, 0);
+
+    // The cached Parquet file as is, for callers parsing it on the host
+    auto contents = cache.get_bytes(key);
+    ASSERT_TRUE(contents.has_value());
+    EXPECT_EQ(contents->size(), stats.bytes);
+    EXPECT_EQ(contents->substr(0, 4), "PAR1");
+    EXPECT_EQ(cache.get_bytes("missing"), std::nullopt);
+    EXPECT_EQ(cache.stats().hits, 2);
+
+    // Entries written by a previous instance are found again
+    FileBatchCache reopened(m_cache_dir, 1 << 20);
+    EXPECT_TRUE(reopened.contains(key));
+    EXPECT_EQ(reopened.stats().bytes, stats.bytes);
+}
+
+TEST_F(TestFileBatchCache, Eviction)
+{
+    auto meta = create_mock_msg_meta({"col1", "col2", "col3"}, {"int32", "float32", "string"}, 5);
+
+    std::size_t entry_bytes;
+    {
+        FileBatchCache sizing(m_cache_dir / "sizing", 1 << 20);
+        sizing.put("sizing", *meta);
+        entry_bytes = sizing.stats().bytes;
+    }
+
+    // Room for two entries
+    FileBatchCache cache(m_cache_dir, entry_bytes * 2 + entry_bytes / 2);
+    cache.put("a", *meta);
+    cache.put("b", *meta);
+
+    // Reading a makes b the least recently used entry, which is evicted to make room for c
+    ASSERT_NE(cache.get("a"), nullptr);
+    cache.put("c", *meta);
+
+    EXPECT_TRUE(cache.contains("a"));
+    EXPECT_FALSE(cache.contains("b"));
+    EXPECT_TRUE(cache.contains("c"));
+    EXPECT_FALSE(std::filesystem::exists(m_cache_dir / "b.parquet"));
+    EXPECT_EQ(cache.stats().evictions, 1);
+
+    // Entries larger than the budget are not kept
+    FileBatchCache small(m_cache_dir / "small", entry_bytes / 2);
+    small.put("a", *meta);
+    EXPECT_FALSE(small.contains("a"));
+    EXPECT_EQ(small.stats().bytes, 0);
+}
+
+TEST_F(TestFileBatchCache, UnreadableEntry)
+{
+    std::filesystem::create_directories(m_cache_dir);
+    {
+        std::ofstream file(m_cache_dir / "a.parquet");
+        file << "not parquet";
+    }
+
+    FileBatchCache cache(m_cache_dir, 1 << 20);
+    ASSERT_TRUE(cache.contains("a"));
+
+    // The entry is removed, a later put stores it again
+    EXPECT_EQ(cache.get("a"), nullptr);
+    EXPECT_FALSE(cache.contains("a"));
+    EXPECT_FALSE(std::filesystem::exists(m_cache_dir / "a.parquet"));
+    EXPECT_EQ(cache.stats().hits, 0);
+    EXPECT_EQ(cache.stats().misses, 1);
+
+    auto meta = create_mock_msg_meta({"col1", "col2", "col3"}, {"int32", "float32", "string"}, 5);
+    cache.put("a", *meta);
+    ASSERT_NE(cache.get("a"), nullptr);
+    EXPECT_EQ(cache.stats().bytes, std::filesystem::file_size(m_cache_dir / "a.parquet"));
+}
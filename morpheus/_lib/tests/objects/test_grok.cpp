@@ -0,0 +1,295 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/decoded_table.hpp"  // for DecodedTable
+#include "morpheus/objects/grok.hpp"           // for GrokLibrary, GrokMatcher
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(Grok);
+
+namespace {
+GrokLibrary make_library()
+{
+    GrokLibrary library;
+    library.add_pattern("INT", "(?:[+-]?(?:[0-9]+))");
+    library.add_pattern("WORD", "\\b\\w+\\b");
+    library.add_pattern("NOTSPACE", "\\S+");
+    library.add_pattern("DATA", ".*?");
+    library.add_pattern("GREEDYDATA", ".*");
+    library.add_pattern("IPV4",
+                        "(?<![0-9])(?:(?:[0-1]?[0-9]{1,2}|2[0-4][0-9]|25[0-5])[.]){3}"
+                        "(?:[0-1]?[0-9]{1,2}|2[0-4][0-9]|25[0-5])(?![0-9])");
+    library.add_pattern("QS", "\"(?>\\\\.|[^\\\\\"]+)*\"");
+
+    return library;
+}
+
+struct MatchResult
+{
+    std::optional<std::size_t> pattern;
+    DecodedTable table;
+};
+
+MatchResult match_line(const GrokMatcher& matcher, std::string_view line)
+{
+    MatchResult result;
+    auto columns = result.table.get_columns(matcher.columns());
+
+    result.table.begin_row();
+    result.pattern = matcher.match(line, result.table, columns);
+    result.table.end_row();
+
+    return result;
+}
+
+std::optional<std::string> get_string(const DecodedTable& table, const std::string& name)
+{
+    for (std::size_t column = 0; column < table.num_columns(); ++column)
+    {
+        if (table.column_spec(column).name == name)
+        {
+            auto value = table.get_string(column, 0);
+            return value.has_value() ? std::optional<std::string>(*value) : std::nullopt;
+        }
+    }
+
+    throw std::invalid_argument(name);
+}
+
+std::optional<std::int64_t> get_int(const DecodedTable& table, const std::string& name)
+{
+    for (std::size_t column = 0; column < table.num_columns(); ++column)
+    {
+        if (table.column_spec(column).name == name)
+        {
+            return table.get_int(column, 0);
+        }
+    }
+
+    throw std::invalid_argument(name);
+}
+}  // namespace
+
+TEST_F(TestGrok, Expand)
+{
+    auto library   = make_library();
+    auto expansion = library.expand("%{IPV4:src} %{INT:port:int} %{WORD}");
+
+    EXPECT_TRUE(expansion.regex.starts_with("(?<src>(?<![0-9])"));
+    EXPECT_TRUE(expansion.regex.ends_with(" (?<port>(?:[+-]?(?:[0-9]+))) (?:\\b\\w+\\b)"));
+    ASSERT_EQ(expansion.captures.size(), 2);
+    EXPECT_EQ(expansion.captures[0].name, "src");
+    EXPECT_EQ(expansion.captures[0].type, cudf::type_id::STRING);
+    EXPECT_EQ(expansion.captures[1].type, cudf::type_id::INT64);
+
+    // Escaped references are kept as they are
+    EXPECT_EQ(library.expand("\\%{INT}").regex, "\\%{INT}");
+
+    library.add_pattern("LOOP", "a%{LOOP}");
+    EXPECT_THROW(library.expand("%{LOOP}"), std::invalid_argument);
+    EXPECT_THROW(library.expand("%{MISSING:x}"), std::invalid_argument);
+    EXPECT_THROW(library.expand("%{INT:x"), std::invalid_argument);
+    EXPECT_THROW(library.expand("%{INT:x:long}"), std::invalid_argument);
+    EXPECT_THROW(library.expand("%{INT:x:int} %{WORD:x}"), std::invalid_argument);
+}
+
+TEST_F(TestGrok, LoadFile)
+{
+    auto path = std::filesystem::temp_directory_path() / "morpheus_test_grok_patterns";
+    {
+        std::ofstream file(path);
+        file << "# Comment\n\nNUM [0-9]+\r\n  KEYVALUE\t%{NUM:key}=%{NUM:value:int}\n";
+    }
+
+    GrokLibrary library;
+    library.load_file(path);
+    std::filesystem::remove(path);
+
+    GrokMatcher matcher(library, {"%{KEYVALUE}"});
+    auto result = match_line(matcher, "x 12=34");
+    EXPECT_EQ(result.pattern, 0);
+    EXPECT_EQ(get_string(result.table, "key"), "12");
+    EXPECT_EQ(get_int(result.table, "value"), 34);
+
+    EXPECT_THROW(library.load_file(path), std::invalid_argument);
+}
+
+TEST_F(TestGrok, FirstMatchingPattern)
+{
+    GrokMatcher matcher(make_library(),
+                        {"^%{IPV4:src} %{WORD:action} %{INT:bytes:int}$",
+                         "^%{IPV4:src} %{WORD:action}",
+                         "user=%{NOTSPACE:user}"});
+
+    ASSERT_EQ(matcher.num_patterns(), 3);
+    ASSERT_EQ(matcher.columns().size(), 4);
+    EXPECT_EQ(matcher.columns()[2].name, "bytes");
+    EXPECT_EQ(matcher.columns()[2].type, cudf::type_id::INT64);
+
+    auto result = match_line(matcher, "10.1.2.3 accept 1500");
+    EXPECT_EQ(result.pattern, 0);
+    EXPECT_EQ(get_string(result.table, "src"), "10.1.2.3");
+    EXPECT_EQ(get_string(result.table, "action"), "accept");
+    EXPECT_EQ(get_int(result.table, "bytes"), 1500);
+    EXPECT_EQ(get_string(result.table, "user"), std::nullopt);
+
+    // The first pattern fails at the end of the line, the captures are those of the second
+    result = match_line(matcher, "10.1.2.3 drop 1500 extra user=bob");
+    EXPECT_EQ(result.pattern, 1);
+    EXPECT_EQ(get_string(result.table, "action"), "drop");
+    EXPECT_EQ(get_int(result.table, "bytes"), std::nullopt);
+    EXPECT_EQ(get_string(result.table, "user"), std::nullopt);
+
+    // Lookarounds reject the address, the third pattern matches in the middle of the line
+    result = match_line(matcher, "10.1.2.300 drop user=bob");
+    EXPECT_EQ(result.pattern, 2);
+    EXPECT_EQ(get_string(result.table, "src"), std::nullopt);
+    EXPECT_EQ(get_string(result.table, "user"), "bob");
+
+    result = match_line(matcher, "no match here");
+    EXPECT_EQ(result.pattern, std::nullopt);
+    EXPECT_EQ(get_string(result.table, "src"), std::nullopt);
+}
+
+TEST_F(TestGrok, BacktrackingSemantics)
+{
+    auto library = make_library();
+    GrokMatcher matcher(library,
+                        {"^%{DATA:first},%{GREEDYDATA:rest}$",
+                         "(?<word>a+?)b",
+                         "(?i)HELLO (?<quoted>%{QS})"});
+
+    // Lazy and greedy quantifiers prefer the same split as a backtracking engine
+    auto result = match_line(matcher, "a,b,c");
+    EXPECT_EQ(result.pattern, 0);
+    EXPECT_EQ(get_string(result.table, "first"), "a");
+    EXPECT_EQ(get_string(result.table, "rest"), "b,c");
+
+    // The leftmost match is found, a lazy quantifier extends as needed
+    result = match_line(matcher, "xxaaab");
+    EXPECT_EQ(result.pattern, 1);
+    EXPECT_EQ(get_string(result.table, "word"), "aaa");
+
+    result = match_line(matcher, "say hello \"a \\\" b\" end");
+    EXPECT_EQ(result.pattern, 2);
+    EXPECT_EQ(get_string(result.table, "quoted"), "\"a \\\" b\"");
+
+    // A loop ends once an iteration matches the empty string
+    GrokMatcher loops(library, {"(?<a>(?:[ab]{0,2}?)*)(?<b>(?:.+){1,2})"});
+    result = match_line(loops, "ba");
+    EXPECT_EQ(result.pattern, 0);
+    EXPECT_EQ(get_string(result.table, "a"), "");
+    EXPECT_EQ(get_string(result.table, "b"), "ba");
+
+    GrokMatcher empty_loops(library, {"^(?<c>(?:x??)*y?)(?<d>.*)"});
+    result = match_line(empty_loops, "xy");
+    EXPECT_EQ(result.pattern, 0);
+    EXPECT_EQ(get_string(result.table, "c"), "");
+    EXPECT_EQ(get_string(result.table, "d"), "xy");
+
+    // Captures which can't be converted are null
+    GrokMatcher numbers(library, {"(?<n>%{WORD:value:int})"});
+    result = match_line(numbers, "abc");
+    EXPECT_EQ(result.pattern, 0);
+    EXPECT_EQ(get_int(result.table, "value"), std::nullopt);
+    EXPECT_EQ(get_string(result.table, "n"), "abc");
+}
+
+TEST_F(TestGrok, Syntax)
+{
+    GrokLibrary library;
+    GrokMatcher matcher(library,
+                        {"^[[:upper:]][^\\s,]{2,3}\\x2C(?<a>\\d{2,})$",
+                         "^(?<b>[a-c-]+)\\.(?<c>x{,2})$",
+                         "^(?:a|)(?<d>b*?)(?<e>\\bc\\B)c$"});
+
+    auto result = match_line(matcher, "Abc,123");
+    EXPECT_EQ(result.pattern, 0);
+    EXPECT_EQ(get_string(result.table, "a"), "123");
+
+    EXPECT_EQ(match_line(matcher, "Abcde,123").pattern, std::nullopt);
+    EXPECT_EQ(match_line(matcher, "abc,123").pattern, std::nullopt);
+
+    result = match_line(matcher, "a-b.xx");
+    EXPECT_EQ(result.pattern, 1);
+    EXPECT_EQ(get_string(result.table, "b"), "a-b");
+    EXPECT_EQ(get_string(result.table, "c"), "xx");
+    EXPECT_EQ(match_line(matcher, "a-b.xxx").pattern, std::nullopt);
+
+    result = match_line(matcher, "bbcc");
+    EXPECT_EQ(result.pattern, std::nullopt);
+
+    result = match_line(matcher, "abcc");
+    EXPECT_EQ(result.pattern, std::nullopt);
+
+    result = match_line(matcher, "cc");
+    EXPECT_EQ(result.pattern, 2);
+    EXPECT_EQ(get_string(result.table, "d"), "");
+    EXPECT_EQ(get_string(result.table, "e"), "c");
+
+    for (const auto* pattern : {"(a", "a)", "[a", "*a", "a{2,1}", "(?<=ab)c", "(a)\\1", "\\q", "(?<>a)", "[[:foo:]]"})
+    {
+        EXPECT_THROW(GrokMatcher(library, {pattern}), std::invalid_argument);
+    }
+
+    EXPECT_THROW(GrokMatcher(library, {}), std::invalid_argument);
+}
+
+TEST_F(TestGrok, SharedAcrossThreads)
+{
+    GrokMatcher matcher(make_library(), {"^%{IPV4:src} %{WORD:action}$", "%{INT:code:int}"});
+
+    // The DFA states are built by whichever thread first needs them
+    std::vector<std::future<std::size_t>> results;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        results.push_back(std::async(std::launch::async, [&matcher]() {
+            std::size_t matched = 0;
+            for (int i = 0; i < 200; ++i)
+            {
+                auto result = match_line(matcher, i % 2 == 0 ? "10.0.0.1 allow\r\n" : "code 42");
+                if (result.pattern == static_cast<std::size_t>(i % 2))
+                {
+                    ++matched;
+                }
+            }
+
+            return matched;
+        }));
+    }
+
+    for (auto& result : results)
+    {
+        EXPECT_EQ(result.get(), 200);
+    }
+}
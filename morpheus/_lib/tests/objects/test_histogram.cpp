@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/histogram.hpp"  // for FixedWidthHistogram, DriftMetrics
+
+#include <gtest/gtest.h>
+
+#include <cmath>      // for nan
+#include <cstdint>    // for uint64_t
+#include <stdexcept>  // for invalid_argument
+#include <vector>     // for vector
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(Histogram);
+
+TEST_F(TestHistogram, Buckets)
+{
+    FixedWidthHistogram hist(4, 0.0, 1.0);
+
+    // Out of range values are clamped, NaN is ignored
+    std::vector<double> values{-1.0, 0.0, 0.24, 0.25, 0.5, 0.99, 1.0, 2.0, std::nan("")};
+    hist.add(values.data(), values.size());
+
+    EXPECT_EQ(hist.counts(), (std::vector<std::uint64_t>{3, 1, 1, 3}));
+    EXPECT_EQ(hist.total(), 8);
+
+    // Strided input only reads every other value
+    FixedWidthHistogram strided(4, 0.0, 1.0);
+    strided.add(values.data(), 4, 2);
+    EXPECT_EQ(strided.counts(), (std::vector<std::uint64_t>{2, 0, 1, 1}));
+
+    hist.merge(strided);
+    EXPECT_EQ(hist.total(), 12);
+
+    hist.clear();
+    EXPECT_EQ(hist.total(), 0);
+    EXPECT_EQ(hist.counts(), (std::vector<std::uint64_t>{0, 0, 0, 0}));
+}
+
+TEST_F(TestHistogram, InvalidArguments)
+{
+    EXPECT_THROW(FixedWidthHistogram(0, 0.0, 1.0), std::invalid_argument);
+    EXPECT_THROW(FixedWidthHistogram(4, 1.0, 1.0), std::invalid_argument);
+
+    FixedWidthHistogram a(4, 0.0, 1.0);
+    FixedWidthHistogram b(5, 0.0, 1.0);
+    EXPECT_THROW(a.merge(b), std::invalid_argument);
+    EXPECT_THROW(a.compare(b), std::invalid_argument);
+}
+
+TEST_F(TestHistogram, CompareIdentical)
+{
+    FixedWidthHistogram reference(10, 0.0, 1.0);
+    FixedWidthHistogram current(10, 0.0, 1.0);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        reference.add(i / 100.0);
+        current.add(i / 100.0);
+    }
+
+    auto metrics = current.compare(reference);
+    EXPECT_DOUBLE_EQ(metrics.psi, 0.0);
+    EXPECT_DOUBLE_EQ(metrics.kl, 0.0);
+    EXPECT_DOUBLE_EQ(metrics.ks, 0.0);
+}
+
+TEST_F(TestHistogram, CompareShifted)
+{
+    auto metrics = FixedWidthHistogram::compare({0.5, 0.5, 1e-6, 1e-6}, {1e-6, 1e-6, 0.5, 0.5});
+
+    EXPECT_NEAR(metrics.ks, 1.0, 1e-5);
+    EXPECT_GT(metrics.psi, 10.0);
+    EXPECT_GT(metrics.kl, 5.0);
+
+    // PSI is symmetric, KL is not
+    auto reversed = FixedWidthHistogram::compare({1e-6, 1e-6, 0.5, 0.5}, {0.5, 0.5, 1e-6, 1e-6});
+    EXPECT_DOUBLE_EQ(metrics.psi, reversed.psi);
+
+    auto skewed  = FixedWidthHistogram::compare({0.25, 0.25, 0.25, 0.25}, {0.7, 0.1, 0.1, 0.1});
+    auto inverse = FixedWidthHistogram::compare({0.7, 0.1, 0.1, 0.1}, {0.25, 0.25, 0.25, 0.25});
+    EXPECT_NE(skewed.kl, inverse.kl);
+    EXPECT_DOUBLE_EQ(skewed.psi, inverse.psi);
+}
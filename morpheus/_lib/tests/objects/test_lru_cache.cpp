@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/lru_cache.hpp"  // for LRUCache
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(LRUCache);
+
+TEST_F(TestLRUCache, Eviction)
+{
+    LRUCache<int, std::string> cache(2);
+
+    cache.put(1, "a");
+    cache.put(2, "b");
+
+    // Reading 1 makes 2 the least recently used entry
+    ASSERT_NE(cache.get(1), nullptr);
+    cache.put(3, "c");
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.get(2), nullptr);
+    ASSERT_NE(cache.get(1), nullptr);
+    EXPECT_EQ(*cache.get(1), "a");
+    ASSERT_NE(cache.get(3), nullptr);
+    EXPECT_EQ(*cache.get(3), "c");
+
+    EXPECT_EQ(cache.hits(), 5);
+    EXPECT_EQ(cache.misses(), 1);
+}
+
+TEST_F(TestLRUCache, Replace)
+{
+    LRUCache<int, std::string> cache(2);
+
+    cache.put(1, "a");
+    cache.put(2, "b");
+    cache.put(1, "z");
+
+    // Replacing 1 refreshes it, so 2 is evicted
+    cache.put(3, "c");
+
+    EXPECT_EQ(cache.size(), 2);
+    ASSERT_NE(cache.get(1), nullptr);
+    EXPECT_EQ(*cache.get(1), "z");
+    EXPECT_EQ(cache.get(2), nullptr);
+}
+
+TEST_F(TestLRUCache, Disabled)
+{
+    LRUCache<int, std::string> cache(0);
+
+    cache.put(1, "a");
+
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.get(1), nullptr);
+}
@@ -0,0 +1,166 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/model_registry.hpp"  // for ModelRegistry
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>  // for invalid_argument
+#include <string>
+#include <unistd.h>  // for getpid
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+class TestModelRegistry : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        m_model_dir = std::filesystem::temp_directory_path() /
+                      ("morpheus_test_model_registry_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(m_model_dir);
+
+        write_model("dfp-alice", std::string(100, 'a'));
+        write_model("dfp-bob", std::string(100, 'b'));
+        write_model("dfp-carol", std::string(100, 'c'));
+        write_model("dfp-generic", std::string(50, 'g'));
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(m_model_dir);
+    }
+
+    void write_model(const std::string& name, const std::string& data)
+    {
+        std::ofstream file(m_model_dir / name, std::ios::binary);
+        file << data;
+    }
+
+    std::filesystem::path m_model_dir;
+};
+
+TEST_F(TestModelRegistry, Get)
+{
+    ModelRegistry registry(m_model_dir, 1000, {"generic"}, "dfp-{user_id}");
+
+    EXPECT_EQ(registry.model_name("alice"), "dfp-alice");
+
+    auto entry = registry.get("alice");
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(entry->entity, "alice");
+    EXPECT_EQ(entry->model_name, "dfp-alice");
+    EXPECT_EQ(*entry->blob, std::string(100, 'a'));
+
+    // The second lookup is served from memory
+    ASSERT_TRUE(registry.get("alice").has_value());
+
+    auto stats = registry.stats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.loads, 1);
+    EXPECT_EQ(stats.resident_models, 1);
+    EXPECT_EQ(stats.resident_bytes, 100);
+}
+
+TEST_F(TestModelRegistry, Fallback)
+{
+    ModelRegistry registry(m_model_dir, 1000, {"missing", "generic"}, "dfp-{user_id}");
+
+    auto entry = registry.get("dave");
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(entry->entity, "generic");
+    EXPECT_EQ(entry->model_name, "dfp-generic");
+    EXPECT_EQ(*entry->blob, std::string(50, 'g'));
+
+    ModelRegistry no_fallback(m_model_dir, 1000, {}, "dfp-{user_id}");
+    EXPECT_FALSE(no_fallback.get("dave").has_value());
+    EXPECT_EQ(no_fallback.stats().not_found, 1);
+}
+
+TEST_F(TestModelRegistry, Eviction)
+{
+    ModelRegistry registry(m_model_dir, 250, {}, "dfp-{user_id}");
+
+    ASSERT_TRUE(registry.get("alice").has_value());
+    ASSERT_TRUE(registry.get("bob").has_value());
+
+    // Reading alice makes bob the least recently used model, which is evicted to make room for carol
+    ASSERT_TRUE(registry.get("alice").has_value());
+    ASSERT_TRUE(registry.get("carol").has_value());
+
+    EXPECT_TRUE(registry.is_resident("dfp-alice"));
+    EXPECT_FALSE(registry.is_resident("dfp-bob"));
+    EXPECT_TRUE(registry.is_resident("dfp-carol"));
+
+    auto stats = registry.stats();
+    EXPECT_EQ(stats.evictions, 1);
+    EXPECT_EQ(stats.resident_bytes, 200);
+
+    // Models larger than the budget are returned without being kept
+    ModelRegistry small(m_model_dir, 60, {}, "dfp-{user_id}");
+    ASSERT_TRUE(small.get("alice").has_value());
+    EXPECT_FALSE(small.is_resident("dfp-alice"));
+    EXPECT_EQ(small.stats().resident_bytes, 0);
+}
+
+TEST_F(TestModelRegistry, Prefetch)
+{
+    ModelRegistry registry(m_model_dir, 1000, {"generic"}, "dfp-{user_id}", 2);
+
+    registry.prefetch({"alice", "bob", "dave"});
+    registry.wait_for_prefetch();
+
+    // Dave has no model, the fallback model is prefetched instead
+    EXPECT_TRUE(registry.is_resident("dfp-alice"));
+    EXPECT_TRUE(registry.is_resident("dfp-bob"));
+    EXPECT_TRUE(registry.is_resident("dfp-generic"));
+
+    ASSERT_TRUE(registry.get("alice").has_value());
+    ASSERT_TRUE(registry.get("bob").has_value());
+
+    auto stats = registry.stats();
+    EXPECT_EQ(stats.prefetches, 3);
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 0);
+}
+
+TEST_F(TestModelRegistry, OutsideModelDir)
+{
+    write_model("secret", "s");
+
+    ModelRegistry registry(m_model_dir / "models", 1000, {}, "{user_id}");
+    std::filesystem::create_directories(m_model_dir / "models");
+
+    EXPECT_THROW(registry.get("../secret"), std::invalid_argument);
+    EXPECT_THROW(registry.get((m_model_dir / "secret").string()), std::invalid_argument);
+    EXPECT_THROW(registry.get(".."), std::invalid_argument);
+    EXPECT_THROW(registry.get(""), std::invalid_argument);
+
+    // Names which stay inside of the directory are still looked up
+    EXPECT_FALSE(registry.get("sub/../missing").has_value());
+
+    // Prefetches of such names are skipped
+    registry.prefetch({"../secret"});
+    registry.wait_for_prefetch();
+    EXPECT_EQ(registry.stats().prefetches, 0);
+}
@@ -0,0 +1,406 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/avro_decoder.hpp"      // for AvroRecordDecoder
+#include "morpheus/objects/decoded_table.hpp"     // for DecodedTable
+#include "morpheus/objects/protobuf_decoder.hpp"  // for ProtobufSchema, ProtobufRecordDecoder
+#include "morpheus/objects/record_decoder.hpp"    // for PayloadDecoder, LocalSchemaRegistry
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(RecordDecoder);
+
+namespace {
+const std::string AvroSchema = R"({
+    "type": "record", "name": "Event", "namespace": "test",
+    "fields": [
+        {"name": "id", "type": "long"},
+        {"name": "user", "type": ["null", "string"]},
+        {"name": "ok", "type": "boolean"},
+        {"name": "score", "type": "double"},
+        {"name": "level", "type": {"type": "enum", "name": "Level", "symbols": ["LOW", "HIGH"]}},
+        {"name": "src", "type": {"type": "record", "name": "Host", "fields": [
+            {"name": "ip", "type": "string"}, {"name": "port", "type": "int"}]}},
+        {"name": "tags", "type": {"type": "array", "items": "string"}},
+        {"name": "ts", "type": {"type": "long", "logicalType": "timestamp-millis"}}
+    ]
+})";
+
+const std::string ProtobufText = R"(
+syntax = "proto3";
+package test;
+
+// Events of the test
+message Event {
+  int64 id = 1;
+  optional string user = 2;
+  Host src = 3;
+  repeated int32 ports = 4;
+  Level level = 5;
+  map<string, string> labels = 6;
+  bool ok = 7 [deprecated = true];
+
+  enum Level { LOW = 0; HIGH = 1; }
+  message Host { string ip = 1; uint32 port = 2; }
+}
+
+message Other { string name = 1; }
+)";
+
+std::string varint(std::uint64_t value)
+{
+    std::string bytes;
+    do
+    {
+        auto byte = static_cast<char>(value & 0x7F);
+        value >>= 7;
+        bytes += value != 0 ? static_cast<char>(byte | 0x80) : byte;
+    } while (value != 0);
+
+    return bytes;
+}
+
+std::string zigzag(std::int64_t value)
+{
+    return varint((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+}
+
+std::string avro_string(const std::string& value)
+{
+    return zigzag(static_cast<std::int64_t>(value.size())) + value;
+}
+
+std::string avro_double(double value)
+{
+    std::string bytes(sizeof(value), '\0');
+    std::memcpy(bytes.data(), &value, sizeof(value));
+
+    return bytes;
+}
+
+std::string avro_event(std::int64_t id, const char* user)
+{
+    return zigzag(id) + (user != nullptr ? zigzag(1) + avro_string(user) : zigzag(0)) + "\x01" + avro_double(1.5) +
+           zigzag(1) + avro_string("10.0.0.1") + zigzag(443) + zigzag(2) + avro_string("a") + avro_string("b") +
+           zigzag(0) + zigzag(1000);
+}
+
+std::string proto_field(std::uint32_t number, std::uint32_t wire, const std::string& value)
+{
+    return varint((number << 3) | wire) + (wire == 2 ? varint(value.size()) : "") + value;
+}
+
+void decode_one(const RecordDecoder& decoder, DecodedTable& table, const std::string& record)
+{
+    auto columns = table.get_columns(decoder.columns());
+
+    table.begin_row();
+    decoder.decode(record, table, columns);
+    table.end_row();
+}
+}  // namespace
+
+TEST_F(TestRecordDecoder, DecodedTableRows)
+{
+    DecodedTable table;
+    auto count = table.get_column("count", cudf::type_id::INT32);
+
+    table.begin_row();
+    table.set_int(count, 1);
+    table.set_int(count, 2);
+    table.end_row();
+
+    // Columns added later are null in the rows written before
+    auto name = table.get_column("name", cudf::type_id::STRING);
+    EXPECT_EQ(table.get_column("count", cudf::type_id::INT32), count);
+    EXPECT_THROW(table.get_column("count", cudf::type_id::FLOAT64), std::invalid_argument);
+
+    table.begin_row();
+    table.set_string(name, "partial");
+    table.abort_row();
+
+    table.begin_row();
+    table.set_string(name, "abc");
+    EXPECT_TRUE(table.is_set(name));
+    EXPECT_FALSE(table.is_set(count));
+    table.end_row();
+
+    ASSERT_EQ(table.num_rows(), 2);
+    EXPECT_EQ(table.get_int(count, 0), 2);
+    EXPECT_EQ(table.get_int(count, 1), std::nullopt);
+    EXPECT_EQ(table.get_string(name, 0), std::nullopt);
+    EXPECT_EQ(table.get_string(name, 1), "abc");
+}
+
+TEST_F(TestRecordDecoder, DecodedTableAppend)
+{
+    DecodedTable first;
+    auto a = first.get_column("a", cudf::type_id::STRING);
+    first.begin_row();
+    first.set_string(a, "x");
+    first.end_row();
+
+    DecodedTable second;
+    auto b = second.get_column("b", cudf::type_id::INT64);
+    a      = second.get_column("a", cudf::type_id::STRING);
+    second.begin_row();
+    second.set_int(b, 7);
+    second.end_row();
+    second.begin_row();
+    second.set_string(a, "yz");
+    second.end_row();
+
+    first.append(second);
+    ASSERT_EQ(first.num_rows(), 3);
+    ASSERT_EQ(first.num_columns(), 2);
+    EXPECT_EQ(first.get_string(0, 0), "x");
+    EXPECT_EQ(first.get_string(0, 1), std::nullopt);
+    EXPECT_EQ(first.get_string(0, 2), "yz");
+    EXPECT_EQ(first.get_int(1, 0), std::nullopt);
+    EXPECT_EQ(first.get_int(1, 1), 7);
+    EXPECT_EQ(first.get_int(1, 2), std::nullopt);
+}
+
+TEST_F(TestRecordDecoder, Avro)
+{
+    AvroRecordDecoder decoder(AvroSchema);
+
+    std::vector<std::string> names;
+    for (const auto& column : decoder.columns())
+    {
+        names.push_back(column.name);
+    }
+
+    EXPECT_EQ(names,
+              std::vector<std::string>({"id", "user", "ok", "score", "level", "src.ip", "src.port", "tags", "ts"}));
+    EXPECT_EQ(decoder.columns()[8].type, cudf::type_id::TIMESTAMP_MILLISECONDS);
+
+    DecodedTable table;
+    decode_one(decoder, table, avro_event(5, "bob"));
+    decode_one(decoder, table, avro_event(-6, nullptr));
+
+    ASSERT_EQ(table.num_rows(), 2);
+    EXPECT_EQ(table.get_int(0, 0), 5);
+    EXPECT_EQ(table.get_int(0, 1), -6);
+    EXPECT_EQ(table.get_string(1, 0), "bob");
+    EXPECT_EQ(table.get_string(1, 1), std::nullopt);
+    EXPECT_EQ(table.get_int(2, 0), 1);
+    EXPECT_EQ(table.get_float(3, 0), 1.5);
+    EXPECT_EQ(table.get_string(4, 0), "HIGH");
+    EXPECT_EQ(table.get_string(5, 0), "10.0.0.1");
+    EXPECT_EQ(table.get_int(6, 0), 443);
+    EXPECT_EQ(table.get_string(7, 0), R"(["a","b"])");
+    EXPECT_EQ(table.get_int(8, 0), 1000);
+
+    // Truncated records and trailing bytes are errors
+    auto record = avro_event(5, "bob");
+    table.begin_row();
+    auto columns = table.get_columns(decoder.columns());
+    EXPECT_THROW(decoder.decode(record.substr(0, record.size() - 1), table, columns), std::runtime_error);
+    EXPECT_THROW(decoder.decode(record + "x", table, columns), std::runtime_error);
+    table.abort_row();
+
+    EXPECT_THROW(AvroRecordDecoder("\"string\""), std::invalid_argument);
+    EXPECT_THROW(AvroRecordDecoder(R"({"type": "record", "name": "A", "fields": [{"name": "b", "type": "B"}]})"),
+                 std::invalid_argument);
+}
+
+TEST_F(TestRecordDecoder, AvroRecursiveRecord)
+{
+    AvroRecordDecoder decoder(R"({"type": "record", "name": "Node", "fields": [
+        {"name": "value", "type": "int"}, {"name": "next", "type": ["null", "Node"]}]})");
+
+    ASSERT_EQ(decoder.columns().size(), 2);
+    EXPECT_EQ(decoder.columns()[1].type, cudf::type_id::STRING);
+
+    DecodedTable table;
+    decode_one(decoder, table, zigzag(1) + zigzag(1) + zigzag(2) + zigzag(0));
+
+    EXPECT_EQ(table.get_int(0, 0), 1);
+    EXPECT_EQ(table.get_string(1, 0), R"({"next":null,"value":2})");
+}
+
+TEST_F(TestRecordDecoder, AvroMalformedValues)
+{
+    AvroRecordDecoder recursive(R"({"type": "record", "name": "Node", "fields": [
+        {"name": "value", "type": "int"}, {"name": "next", "type": ["null", "Node"]}]})");
+
+    DecodedTable table;
+    auto columns = table.get_columns(recursive.columns());
+
+    // Each pair of bytes nests another node
+    table.begin_row();
+    EXPECT_THROW(recursive.decode(std::string(100000, '\x02'), table, columns), std::runtime_error);
+    table.abort_row();
+
+    AvroRecordDecoder decoder(R"({"type": "record", "name": "A", "fields": [
+        {"name": "nulls", "type": {"type": "array", "items": "null"}},
+        {"name": "ints", "type": {"type": "array", "items": "int"}}]})");
+
+    // Items encoded in zero bytes aren't bounded by the size of the record
+    DecodedTable arrays;
+    decode_one(decoder, arrays, zigzag(3) + zigzag(0) + zigzag(0));
+    EXPECT_EQ(arrays.get_string(0, 0), "[null,null,null]");
+
+    columns = arrays.get_columns(decoder.columns());
+    arrays.begin_row();
+    EXPECT_THROW(decoder.decode(zigzag(std::int64_t{1} << 40) + zigzag(0) + zigzag(0), arrays, columns),
+                 std::runtime_error);
+
+    // The lowest count of a block followed by its size
+    const auto lowest = zigzag(std::numeric_limits<std::int64_t>::min());
+    EXPECT_THROW(decoder.decode(zigzag(0) + lowest + zigzag(1), arrays, columns), std::runtime_error);
+    arrays.abort_row();
+}
+
+TEST_F(TestRecordDecoder, Protobuf)
+{
+    auto schema = std::make_shared<const ProtobufSchema>(ProtobufText);
+    EXPECT_EQ(schema->message("Event").name, "test.Event");
+    EXPECT_EQ(schema->message(std::vector<std::int64_t>{1}).name, "test.Other");
+    EXPECT_EQ(schema->message(std::vector<std::int64_t>{0, 0}).name, "test.Event.Host");
+
+    ProtobufRecordDecoder decoder(schema, "test.Event");
+
+    std::vector<std::string> names;
+    for (const auto& column : decoder.columns())
+    {
+        names.push_back(column.name);
+    }
+
+    EXPECT_EQ(names,
+              std::vector<std::string>({"id", "user", "src.ip", "src.port", "ports", "level", "labels", "ok"}));
+    EXPECT_EQ(decoder.columns()[3].type, cudf::type_id::UINT32);
+
+    DecodedTable table;
+    decode_one(decoder,
+               table,
+               proto_field(1, 0, varint(7)) +
+                   proto_field(3, 2, proto_field(1, 2, "h") + proto_field(2, 0, varint(80))) +
+                   proto_field(4, 2, "\x01\x02") + proto_field(4, 0, varint(3)) +
+                   proto_field(6, 2, proto_field(1, 2, "k") + proto_field(2, 2, "v")) + proto_field(99, 0, varint(1)));
+
+    // An empty record holds the defaults of the fields without presence
+    decode_one(decoder, table, "");
+
+    ASSERT_EQ(table.num_rows(), 2);
+    EXPECT_EQ(table.get_int(0, 0), 7);
+    EXPECT_EQ(table.get_string(1, 0), std::nullopt);
+    EXPECT_EQ(table.get_string(2, 0), "h");
+    EXPECT_EQ(table.get_int(3, 0), 80);
+    EXPECT_EQ(table.get_string(4, 0), "[1,2,3]");
+    EXPECT_EQ(table.get_string(5, 0), "LOW");
+    EXPECT_EQ(table.get_string(6, 0), R"({"k":"v"})");
+    EXPECT_EQ(table.get_int(7, 0), 0);
+
+    EXPECT_EQ(table.get_int(0, 1), 0);
+    EXPECT_EQ(table.get_string(2, 1), std::nullopt);
+    EXPECT_EQ(table.get_string(4, 1), std::nullopt);
+    EXPECT_EQ(table.get_string(5, 1), "LOW");
+
+    // A string field encoded as a varint
+    table.begin_row();
+    auto columns = table.get_columns(decoder.columns());
+    EXPECT_THROW(decoder.decode(proto_field(2, 0, varint(1)), table, columns), std::runtime_error);
+    table.abort_row();
+
+    EXPECT_THROW(ProtobufSchema("message A { Missing b = 1; }"), std::invalid_argument);
+    EXPECT_THROW(schema->message("Missing"), std::invalid_argument);
+}
+
+TEST_F(TestRecordDecoder, PayloadDecoderAvro)
+{
+    const std::string schema_v2 = R"({"type": "record", "name": "Event", "fields": [
+        {"name": "id", "type": "long"}, {"name": "host", "type": "string"}]})";
+
+    auto registry = std::make_shared<LocalSchemaRegistry>(std::map<std::int32_t, std::string>{{1, AvroSchema},
+                                                                                              {258, schema_v2}});
+    PayloadDecoder decoder({PayloadFormat::Avro}, registry);
+
+    std::vector<std::string> payloads = {std::string("\0\0\0\0\x01", 5) + avro_event(1, "bob"),
+                                         std::string("\0\0\0\x01\x02", 5) + zigzag(2) + avro_string("web"),
+                                         std::string("\x01\0\0\0\x01", 5) + avro_event(3, "bad magic"),
+                                         std::string("\0\0\0\0\x07", 5) + avro_event(4, "unknown schema"),
+                                         std::string("\0\0\0\0\x01", 5) + "\x01"};
+
+    std::vector<std::string_view> views(payloads.begin(), payloads.end());
+    std::vector<bool> decoded;
+    auto table = decoder.decode(views, decoded);
+
+    EXPECT_EQ(decoded, std::vector<bool>({true, true, false, false, false}));
+    ASSERT_EQ(table.num_rows(), 2);
+
+    // The columns of both schemas, `id` is shared
+    ASSERT_EQ(table.num_columns(), 10);
+    EXPECT_EQ(table.column_spec(9).name, "host");
+    EXPECT_EQ(table.get_int(0, 0), 1);
+    EXPECT_EQ(table.get_int(0, 1), 2);
+    EXPECT_EQ(table.get_string(1, 1), std::nullopt);
+    EXPECT_EQ(table.get_string(9, 0), std::nullopt);
+    EXPECT_EQ(table.get_string(9, 1), "web");
+
+    EXPECT_THROW(PayloadDecoder({PayloadFormat::JSON}, registry), std::invalid_argument);
+    EXPECT_THROW(parse_payload_format("xml"), std::invalid_argument);
+}
+
+TEST_F(TestRecordDecoder, PayloadDecoderProtobuf)
+{
+    auto registry =
+        std::make_shared<LocalSchemaRegistry>(std::map<std::int32_t, std::string>{{1, ProtobufText}});
+
+    // The first message is selected by a count of zero, `Other` by the indices [1]
+    std::vector<std::string> payloads = {std::string("\0\0\0\0\x01\0", 6) + proto_field(1, 0, varint(9)),
+                                         std::string("\0\0\0\0\x01", 5) + zigzag(1) + zigzag(1) +
+                                             proto_field(1, 2, "other")};
+
+    std::vector<std::string_view> views(payloads.begin(), payloads.end());
+    std::vector<bool> decoded;
+
+    PayloadDecoder decoder({PayloadFormat::Protobuf}, registry);
+    auto table = decoder.decode(views, decoded);
+
+    EXPECT_EQ(decoded, std::vector<bool>({true, true}));
+    ASSERT_EQ(table.num_rows(), 2);
+    ASSERT_EQ(table.num_columns(), 9);
+    EXPECT_EQ(table.get_int(0, 0), 9);
+    EXPECT_EQ(table.get_int(0, 1), std::nullopt);
+    EXPECT_EQ(table.column_spec(8).name, "name");
+    EXPECT_EQ(table.get_string(8, 1), "other");
+
+    // Bare records of a named message
+    PayloadDecoder bare_decoder({PayloadFormat::Protobuf, false, 1, "Other"}, registry);
+    std::string bare = proto_field(1, 2, "bare");
+
+    table = bare_decoder.decode({bare}, decoded);
+    EXPECT_EQ(decoded, std::vector<bool>({true}));
+    ASSERT_EQ(table.num_columns(), 1);
+    EXPECT_EQ(table.get_string(0, 0), "bare");
+}
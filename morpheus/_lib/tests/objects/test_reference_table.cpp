@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"        // IWYU pragma: associated
+#include "../test_utils/tensor_utils.hpp"  // for assert_eq_device_to_host
+
+#include "morpheus/io/deserializers.hpp"         // for load_table_from_file
+#include "morpheus/messages/meta.hpp"            // for MessageMeta
+#include "morpheus/objects/reference_table.hpp"  // for ReferenceTable, enrich_message_meta
+
+#include <gtest/gtest.h>
+
+#include <cstdint>  // for int64_t
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>  // for invalid_argument
+#include <memory>
+#include <string>
+#include <unistd.h>  // for getpid
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+class TestReferenceTable : public TestWithPythonInterpreter
+{
+  protected:
+    void SetUp() override
+    {
+        TestWithPythonInterpreter::SetUp();
+
+        m_dir = std::filesystem::temp_directory_path() /
+                ("morpheus_test_reference_table_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(m_dir);
+
+        // User 2 occurs twice, only the first row is kept
+        write_file("users.csv", "user_id,dept,level\n1,10,100\n2,20,200\n2,21,201\n4,40,400\n");
+        write_file("events.csv", "user_id,value\n4,1\n3,2\n1,3\n2,4\n");
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(m_dir);
+
+        TestWithPythonInterpreter::TearDown();
+    }
+
+    std::filesystem::path write_file(const std::string& name, const std::string& contents)
+    {
+        const auto path = m_dir / name;
+        std::ofstream(path) << contents;
+        return path;
+    }
+
+    std::shared_ptr<MessageMeta> load_events()
+    {
+        return MessageMeta::create_from_cpp(load_table_from_file((m_dir / "events.csv").string()));
+    }
+
+    ReferenceTableConfig users_config()
+    {
+        ReferenceTableConfig config;
+        config.path        = m_dir / "users.csv";
+        config.key_columns = {"user_id"};
+        return config;
+    }
+
+    std::filesystem::path m_dir;
+};
+
+TEST_F(TestReferenceTable, Load)
+{
+    auto table = ReferenceTable::load(users_config());
+    EXPECT_EQ(table->num_rows(), 3);
+    EXPECT_EQ(table->column_names(), std::vector<std::string>({"dept", "level"}));
+
+    auto config    = users_config();
+    config.columns = {"level"};
+    config.prefix  = "user_";
+    EXPECT_EQ(ReferenceTable::load(config)->column_names(), std::vector<std::string>({"user_level"}));
+
+    config.columns = {"missing"};
+    EXPECT_THROW(ReferenceTable::load(config), std::invalid_argument);
+
+    config             = users_config();
+    config.key_columns = {"missing"};
+    EXPECT_THROW(ReferenceTable::load(config), std::invalid_argument);
+}
+
+TEST_F(TestReferenceTable, LeftJoin)
+{
+    auto meta     = load_events();
+    auto enriched = enrich_message_meta(*meta, {ReferenceTable::load(users_config())});
+    ASSERT_NE(enriched, nullptr);
+
+    // The rows keep their order, the unmatched row has null reference columns
+    auto info = enriched->get_info();
+    EXPECT_EQ(info.num_rows(), 4);
+    EXPECT_EQ(info.get_column_names(), std::vector<std::string>({"user_id", "value", "dept", "level"}));
+
+    assert_eq_device_to_host(info.get_column(0), std::vector<std::int64_t>({4, 3, 1, 2}));
+    EXPECT_EQ(info.get_column(2).null_count(), 1);
+
+    // An appended column replaces the existing column with the same name
+    write_file("values.csv", "user_id,value\n1,30\n");
+
+    ReferenceTableConfig config;
+    config.path        = m_dir / "values.csv";
+    config.key_columns = {"user_id"};
+
+    enriched = enrich_message_meta(*meta, {ReferenceTable::load(config)});
+    info     = enriched->get_info();
+    EXPECT_EQ(info.get_column_names(), std::vector<std::string>({"user_id", "value"}));
+    EXPECT_EQ(info.get_column(1).null_count(), 3);
+}
+
+TEST_F(TestReferenceTable, InnerJoin)
+{
+    auto config = users_config();
+    config.how  = JoinType::Inner;
+
+    auto enriched = enrich_message_meta(*load_events(), {ReferenceTable::load(config)});
+    ASSERT_NE(enriched, nullptr);
+
+    auto info = enriched->get_info();
+    EXPECT_EQ(info.num_rows(), 3);
+    assert_eq_device_to_host(info.get_column(0), std::vector<std::int64_t>({4, 1, 2}));
+    assert_eq_device_to_host(info.get_column(1), std::vector<std::int64_t>({1, 3, 4}));
+    assert_eq_device_to_host(info.get_column(2), std::vector<std::int64_t>({40, 10, 20}));
+    assert_eq_device_to_host(info.get_column(3), std::vector<std::int64_t>({400, 100, 200}));
+
+    // No rows are left when none of the keys match
+    write_file("events.csv", "user_id,value\n5,1\n6,2\n");
+    EXPECT_EQ(enrich_message_meta(*load_events(), {ReferenceTable::load(config)}), nullptr);
+}
+
+TEST_F(TestReferenceTable, KeyTypeMismatch)
+{
+    write_file("hosts.csv", "user_id,host\nalice,a\nbob,b\n");
+
+    ReferenceTableConfig config;
+    config.path        = m_dir / "hosts.csv";
+    config.key_columns = {"user_id"};
+
+    EXPECT_THROW(enrich_message_meta(*load_events(), {ReferenceTable::load(config)}), std::invalid_argument);
+}
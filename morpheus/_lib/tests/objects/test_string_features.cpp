@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/string_features.hpp"  // for StringFeatureExtractor, StringFeature, StringFeatureType
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(StringFeatures);
+
+namespace {
+std::vector<double> extract(const StringFeatureExtractor& extractor, const std::string& text)
+{
+    std::vector<double> values(extractor.num_outputs(), -1.0);
+    extractor.extract(text, values.data());
+
+    return values;
+}
+}  // namespace
+
+TEST_F(TestStringFeatures, CharacterFeatures)
+{
+    StringFeatureExtractor extractor({{"text", StringFeatureType::Length, "length"},
+                                      {"text", StringFeatureType::Entropy, "entropy"},
+                                      {"text", StringFeatureType::DigitRatio, "digits"},
+                                      {"text", StringFeatureType::UpperRatio, "upper"}});
+
+    ASSERT_EQ(extractor.num_outputs(), 4);
+
+    // Lengths are measured in code points, the same as Python's `len`
+    auto values = extract(extractor, "AAb1\xC3\xA9\xC3\xA9\xC3\xA9");
+    EXPECT_DOUBLE_EQ(values[0], 7.0);
+    EXPECT_NEAR(values[1], 1.8423709931771086, 1e-12);
+    EXPECT_DOUBLE_EQ(values[2], 1.0 / 7.0);
+    EXPECT_DOUBLE_EQ(values[3], 2.0 / 7.0);
+
+    EXPECT_DOUBLE_EQ(extract(extractor, "aaaa")[1], 0.0);
+    EXPECT_DOUBLE_EQ(extract(extractor, "abcd")[1], 2.0);
+
+    EXPECT_EQ(extract(extractor, ""), std::vector<double>(4, 0.0));
+}
+
+TEST_F(TestStringFeatures, NgramHash)
+{
+    StringFeature feature{"text", StringFeatureType::NgramHash, "ngram", 2, 8};
+    EXPECT_EQ(feature.output_names(),
+              std::vector<std::string>({"ngram_0", "ngram_1", "ngram_2", "ngram_3", "ngram_4", "ngram_5", "ngram_6",
+                                        "ngram_7"}));
+    EXPECT_FALSE(feature.is_integral());
+
+    StringFeatureExtractor extractor({feature});
+
+    // "abab" holds the bigrams "ab" twice and "ba" once
+    auto values = extract(extractor, "abab");
+    std::vector<double> expected(8, 0.0);
+    expected[fnv1a_32("ab") % 8] += 2.0;
+    expected[fnv1a_32("ba") % 8] += 1.0;
+    EXPECT_EQ(values, expected);
+
+    // N-grams are made of code points, not bytes
+    values   = extract(extractor, "\xC3\xA9\xC3\xA9");
+    expected = std::vector<double>(8, 0.0);
+    expected[fnv1a_32("\xC3\xA9\xC3\xA9") % 8] = 1.0;
+    EXPECT_EQ(values, expected);
+
+    // Strings shorter than an n-gram have none
+    EXPECT_EQ(extract(extractor, "a"), std::vector<double>(8, 0.0));
+
+    EXPECT_EQ(fnv1a_32(""), 2166136261U);
+    EXPECT_EQ(fnv1a_32("a"), 0xE40C292CU);
+}
+
+TEST_F(TestStringFeatures, UrlFeatures)
+{
+    StringFeatureExtractor extractor({{"url", StringFeatureType::DomainLabelCount, "labels"},
+                                      {"url", StringFeatureType::PathDepth, "depth"}});
+
+    EXPECT_EQ(extract(extractor, "https://user@www.example.com:8080/a//b/c.html?q=/x#/y"),
+              std::vector<double>({3.0, 3.0}));
+    EXPECT_EQ(extract(extractor, "mail.google.co.uk"), std::vector<double>({4.0, 1.0}));
+    EXPECT_EQ(extract(extractor, "http://example.com"), std::vector<double>({2.0, 0.0}));
+    EXPECT_EQ(extract(extractor, "http://[::1]:80/x"), std::vector<double>({1.0, 1.0}));
+    EXPECT_EQ(extract(extractor, "C:\\Users\\admin\\file.exe"), std::vector<double>({1.0, 4.0}));
+    EXPECT_EQ(extract(extractor, "/usr//bin/"), std::vector<double>({0.0, 2.0}));
+}
+
+TEST_F(TestStringFeatures, InvalidFeatures)
+{
+    EXPECT_THROW(parse_string_feature_type("length_ratio"), std::invalid_argument);
+    EXPECT_EQ(parse_string_feature_type("path_depth"), StringFeatureType::PathDepth);
+
+    EXPECT_THROW(StringFeatureExtractor({{"a", StringFeatureType::Length, "a_length"},
+                                         {"b", StringFeatureType::Length, "b_length"}}),
+                 std::invalid_argument);
+    EXPECT_THROW(StringFeatureExtractor({{"a", StringFeatureType::Length, ""}}), std::invalid_argument);
+    EXPECT_THROW(StringFeatureExtractor({{"a", StringFeatureType::NgramHash, "ngram", 0, 4}}), std::invalid_argument);
+}
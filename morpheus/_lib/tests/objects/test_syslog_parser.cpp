@@ -0,0 +1,251 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/decoded_table.hpp"     // for DecodedTable
+#include "morpheus/objects/syslog_parser.hpp"     // for SyslogParser, LogHeaderField, LogExtensionField
+#include "morpheus/utilities/timestamp_util.hpp"  // for TimestampUtil
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(SyslogParser);
+
+namespace {
+// Parse `line` into a new table of a single row
+DecodedTable parse_line(const SyslogParser& parser, std::string_view line)
+{
+    DecodedTable table;
+    auto columns = table.get_columns(parser.columns());
+
+    table.begin_row();
+    parser.parse(line, table, columns);
+    table.end_row();
+
+    return table;
+}
+
+std::optional<std::string> get_string(const DecodedTable& table, const std::string& name)
+{
+    for (std::size_t column = 0; column < table.num_columns(); ++column)
+    {
+        if (table.column_spec(column).name == name)
+        {
+            auto value = table.get_string(column, 0);
+            return value.has_value() ? std::optional<std::string>(*value) : std::nullopt;
+        }
+    }
+
+    throw std::invalid_argument(name);
+}
+
+std::optional<std::int64_t> get_int(const DecodedTable& table, const std::string& name)
+{
+    for (std::size_t column = 0; column < table.num_columns(); ++column)
+    {
+        if (table.column_spec(column).name == name)
+        {
+            return table.get_int(column, 0);
+        }
+    }
+
+    throw std::invalid_argument(name);
+}
+
+std::int64_t timestamp(std::string_view value)
+{
+    std::int64_t nanos = 0;
+    TimestampUtil::parse_any(value, nanos, 2024);
+
+    return nanos;
+}
+}  // namespace
+
+TEST_F(TestSyslogParser, Rfc5424)
+{
+    SyslogParser parser(all_log_header_fields(), {{"src", "src", cudf::type_id::STRING}}, "", 2024);
+
+    auto table = parse_line(parser,
+                            "<165>1 2024-03-01T12:34:56.789Z host.example.com app 1234 ID47 "
+                            "[exampleSDID@32473 iut=\"3\" eventSource=\"Appli]cation\"][other a=\"\\\"\"] "
+                            "\xEF\xBB\xBF"
+                            "CEF:0|Vendor|Product|1.0|100|Worm stopped|10|src=10.0.0.1\r\n");
+
+    EXPECT_EQ(get_string(table, "log_format"), "cef");
+    EXPECT_EQ(get_int(table, "syslog_facility"), 20);
+    EXPECT_EQ(get_int(table, "syslog_severity"), 5);
+    EXPECT_EQ(get_int(table, "syslog_timestamp"), timestamp("2024-03-01T12:34:56.789Z"));
+    EXPECT_EQ(get_string(table, "syslog_hostname"), "host.example.com");
+    EXPECT_EQ(get_string(table, "syslog_app_name"), "app");
+    EXPECT_EQ(get_string(table, "syslog_proc_id"), "1234");
+    EXPECT_EQ(get_string(table, "syslog_msg_id"), "ID47");
+    EXPECT_EQ(get_string(table, "syslog_structured_data"),
+              "[exampleSDID@32473 iut=\"3\" eventSource=\"Appli]cation\"][other a=\"\\\"\"]");
+    EXPECT_EQ(get_string(table, "event_name"), "Worm stopped");
+    EXPECT_EQ(get_string(table, "src"), "10.0.0.1");
+
+    // Nil values are null, a header without a message is valid
+    table = parse_line(parser, "<34>1 - - su - - -");
+    EXPECT_EQ(get_string(table, "log_format"), "syslog");
+    EXPECT_EQ(get_int(table, "syslog_timestamp"), std::nullopt);
+    EXPECT_EQ(get_string(table, "syslog_hostname"), std::nullopt);
+    EXPECT_EQ(get_string(table, "syslog_app_name"), "su");
+    EXPECT_EQ(get_string(table, "syslog_structured_data"), std::nullopt);
+    EXPECT_EQ(get_string(table, "syslog_message"), std::nullopt);
+    EXPECT_EQ(get_string(table, "device_vendor"), std::nullopt);
+
+    EXPECT_THROW(parse_line(parser, "<34>1 2024-03-01T12:34:56Z host"), std::runtime_error);
+    EXPECT_THROW(parse_line(parser, "<34>1 - - - - - [id a=\"1\""), std::runtime_error);
+    EXPECT_THROW(parse_line(parser, "<34>1 - - - - - oops"), std::runtime_error);
+}
+
+TEST_F(TestSyslogParser, Rfc3164)
+{
+    SyslogParser parser(all_log_header_fields(), {}, "log_", 2024);
+
+    auto table = parse_line(parser, "<34>Oct 11 22:14:15 mymachine su[230]: 'su root' failed on /dev/pts/8");
+    EXPECT_EQ(get_string(table, "log_log_format"), "syslog");
+    EXPECT_EQ(get_int(table, "log_syslog_facility"), 4);
+    EXPECT_EQ(get_int(table, "log_syslog_severity"), 2);
+    EXPECT_EQ(get_int(table, "log_syslog_timestamp"), timestamp("Oct 11 22:14:15"));
+    EXPECT_EQ(get_string(table, "log_syslog_hostname"), "mymachine");
+    EXPECT_EQ(get_string(table, "log_syslog_app_name"), "su");
+    EXPECT_EQ(get_string(table, "log_syslog_proc_id"), "230");
+    EXPECT_EQ(get_string(table, "log_syslog_message"), "'su root' failed on /dev/pts/8");
+
+    // Without a priority or a hostname
+    table = parse_line(parser, "Mar  1 02:03:04 sshd: Accepted publickey");
+    EXPECT_EQ(get_int(table, "log_syslog_facility"), std::nullopt);
+    EXPECT_EQ(get_string(table, "log_syslog_hostname"), std::nullopt);
+    EXPECT_EQ(get_string(table, "log_syslog_app_name"), "sshd");
+    EXPECT_EQ(get_string(table, "log_syslog_message"), "Accepted publickey");
+
+    // The event may directly follow the hostname
+    table = parse_line(parser, "<13>Mar  1 02:03:04 fw01 CEF:0|V|P|1|2|N|3|");
+    EXPECT_EQ(get_string(table, "log_log_format"), "cef");
+    EXPECT_EQ(get_string(table, "log_syslog_hostname"), "fw01");
+    EXPECT_EQ(get_string(table, "log_syslog_app_name"), std::nullopt);
+    EXPECT_EQ(get_string(table, "log_device_vendor"), "V");
+
+    // The text following a priority without a timestamp is the message
+    table = parse_line(parser, "<13>free form text");
+    EXPECT_EQ(get_string(table, "log_syslog_message"), "free form text");
+
+    EXPECT_THROW(parse_line(parser, "free form text"), std::runtime_error);
+    EXPECT_THROW(parse_line(parser, "<192>Oct 11 22:14:15 host x"), std::runtime_error);
+    EXPECT_THROW(parse_line(parser, "<1a>Oct 11 22:14:15 host x"), std::runtime_error);
+}
+
+TEST_F(TestSyslogParser, Cef)
+{
+    SyslogParser parser({LogHeaderField::LogFormatVersion,
+                         LogHeaderField::DeviceVendor,
+                         LogHeaderField::DeviceProduct,
+                         LogHeaderField::EventId,
+                         LogHeaderField::EventSeverity},
+                        {{"msg", "message", cudf::type_id::STRING},
+                         {"cnt", "count", cudf::type_id::INT64},
+                         {"cn1", "score", cudf::type_id::FLOAT64},
+                         {"blocked", "blocked", cudf::type_id::BOOL8},
+                         {"rt", "receipt_time", cudf::type_id::TIMESTAMP_NANOSECONDS},
+                         {"request", "", cudf::type_id::STRING},
+                         {"missing", "missing", cudf::type_id::STRING}});
+
+    auto table = parse_line(parser,
+                            "CEF:0|Pipe\\|Co|Back\\\\slash|1.0|sig\\x|Name|High|msg=Detected a \\= sign\\nnext "
+                            "cnt=42 cn1=-1.5 unused=a=b blocked=TRUE rt=1709296496789 "
+                            "request=https://example.com/?a=1&b=2 cnt=43  ");
+
+    EXPECT_EQ(get_string(table, "log_format_version"), "0");
+    EXPECT_EQ(get_string(table, "device_vendor"), "Pipe|Co");
+    EXPECT_EQ(get_string(table, "device_product"), "Back\\slash");
+    EXPECT_EQ(get_string(table, "event_id"), "sig\\x");
+    EXPECT_EQ(get_string(table, "event_severity"), "High");
+    EXPECT_EQ(get_string(table, "message"), "Detected a = sign\nnext");
+    EXPECT_EQ(get_int(table, "count"), 43);
+    EXPECT_EQ(get_int(table, "blocked"), 1);
+    EXPECT_EQ(get_int(table, "receipt_time"), 1709296496789000000);
+    EXPECT_EQ(get_string(table, "request"), "https://example.com/?a=1&b=2");
+    EXPECT_EQ(get_string(table, "missing"), std::nullopt);
+
+    auto score = table.get_float(2 + 5, 0);
+    EXPECT_TRUE(score.has_value());
+    EXPECT_DOUBLE_EQ(*score, -1.5);
+
+    // Values which can't be converted are null
+    table = parse_line(parser, "CEF:1|V|P|1|2|N|3|cnt=many blocked=maybe rt=never msg=");
+    EXPECT_EQ(get_int(table, "count"), std::nullopt);
+    EXPECT_EQ(get_int(table, "blocked"), std::nullopt);
+    EXPECT_EQ(get_int(table, "receipt_time"), std::nullopt);
+    EXPECT_EQ(get_string(table, "message"), "");
+
+    EXPECT_THROW(parse_line(parser, "CEF:0|V|P|1|2|N"), std::runtime_error);
+    EXPECT_THROW(parse_line(parser, "CEF:0|V|P|1|2|N|3|text msg=x"), std::runtime_error);
+    EXPECT_THROW(parse_line(parser, "CEF:0|V|P|1|2|N|3|text"), std::runtime_error);
+}
+
+TEST_F(TestSyslogParser, Leef)
+{
+    SyslogParser parser({LogHeaderField::LogFormat, LogHeaderField::LogFormatVersion, LogHeaderField::EventId},
+                        {{"src", "src", cudf::type_id::STRING}, {"sev", "sev", cudf::type_id::INT64}});
+
+    auto table = parse_line(parser, "LEEF:1.0|Microsoft|MSExchange|4.0 SP1|15345|src=10.0.0.1\tsev=5\tnokey\t=x");
+    EXPECT_EQ(get_string(table, "log_format"), "leef");
+    EXPECT_EQ(get_string(table, "log_format_version"), "1.0");
+    EXPECT_EQ(get_string(table, "event_id"), "15345");
+    EXPECT_EQ(get_string(table, "src"), "10.0.0.1");
+    EXPECT_EQ(get_int(table, "sev"), 5);
+
+    table = parse_line(parser, "<13>Mar  1 02:03:04 host LEEF:2.0|Lancope|StealthWatch|1.0|41|^|src=10.0.0.2^sev=7");
+    EXPECT_EQ(get_string(table, "src"), "10.0.0.2");
+    EXPECT_EQ(get_int(table, "sev"), 7);
+
+    table = parse_line(parser, "LEEF:2.0|V|P|1.0|41|0x7C|src=10.0.0.3|sev=1");
+    EXPECT_EQ(get_string(table, "src"), "10.0.0.3");
+    EXPECT_EQ(get_int(table, "sev"), 1);
+
+    // LEEF 2.0 events without a delimiter use tabs
+    table = parse_line(parser, "LEEF:2.0|V|P|1.0|41|src=10.0.0.4\tsev=2");
+    EXPECT_EQ(get_string(table, "src"), "10.0.0.4");
+
+    EXPECT_THROW(parse_line(parser, "LEEF:1.0|V|P|1.0"), std::runtime_error);
+    EXPECT_THROW(parse_line(parser, "LEEF:2.0|V|P|1.0|41|0xZZ|src=1"), std::runtime_error);
+}
+
+TEST_F(TestSyslogParser, InvalidConfig)
+{
+    EXPECT_THROW(SyslogParser({LogHeaderField::EventId}, {{"event_id", "", cudf::type_id::STRING}}),
+                 std::invalid_argument);
+    EXPECT_THROW(SyslogParser({}, {{"", "x", cudf::type_id::STRING}}), std::invalid_argument);
+    EXPECT_THROW(SyslogParser({}, {{"x", "x", cudf::type_id::INT8}}), std::invalid_argument);
+
+    EXPECT_EQ(parse_log_header_field("syslog_hostname"), LogHeaderField::SyslogHostname);
+    EXPECT_EQ(log_header_field_name(LogHeaderField::EventSeverity), "event_severity");
+    EXPECT_THROW(parse_log_header_field("hostname"), std::invalid_argument);
+    EXPECT_EQ(parse_log_extension_type("timestamp"), cudf::type_id::TIMESTAMP_NANOSECONDS);
+    EXPECT_THROW(parse_log_extension_type("date"), std::invalid_argument);
+}
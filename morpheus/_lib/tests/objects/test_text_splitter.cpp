@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/text_splitter.hpp"  // for TextSplitter, TextLengthUnit
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(TextSplitter);
+
+// Expected values are the output of LangChain's RecursiveCharacterTextSplitter with the same parameters
+TEST_F(TestTextSplitter, RecursiveSplit)
+{
+    const std::string text =
+        "Hi.\n\nI'm Harrison.\n\nHow? Are? You?\nOkay then f f f f.\n"
+        "This is a weird text to write, but gotta test the splittingggg some how.\n\n"
+        "Bye!\n\n-H.";
+
+    TextSplitter splitter(10, 1);
+
+    std::vector<std::string> expected{"Hi.",
+                                      "I'm",
+                                      "Harrison.",
+                                      "How? Are?",
+                                      "You?",
+                                      "Okay then",
+                                      "f f f f.",
+                                      "This is a",
+                                      "weird",
+                                      "text to",
+                                      "write,",
+                                      "but gotta",
+                                      "test the",
+                                      "splitting",
+                                      "gggg",
+                                      "some how.",
+                                      "Bye!",
+                                      "-H."};
+
+    EXPECT_EQ(splitter.split_text(text), expected);
+}
+
+TEST_F(TestTextSplitter, KeepSeparator)
+{
+    TextSplitter splitter(10, 0, {",", "."});
+
+    std::vector<std::string> expected{"Apple", ",banana", ",orange and tomato", "."};
+    EXPECT_EQ(splitter.split_text("Apple,banana,orange and tomato."), expected);
+}
+
+TEST_F(TestTextSplitter, Offsets)
+{
+    TextSplitter splitter(7, 3, {" "}, false);
+
+    std::vector<std::pair<std::string, std::int64_t>> expected{{"foo bar", 0}, {"bar baz", 4}, {"baz 123", 8}};
+    EXPECT_EQ(splitter.split_text_with_offsets("foo bar baz 123"), expected);
+
+    // Offsets are in characters, not bytes
+    std::vector<std::pair<std::string, std::int64_t>> expected_utf8{
+        {"\xc3\xa9t\xc3\xa9 caf\xc3\xa9", 0}, {"caf\xc3\xa9 na\xc3\xafve", 4}};
+    EXPECT_EQ(TextSplitter(10, 4, {" "}, false).split_text_with_offsets("\xc3\xa9t\xc3\xa9 caf\xc3\xa9 na\xc3\xafve"),
+              expected_utf8);
+}
+
+TEST_F(TestTextSplitter, CharacterLevel)
+{
+    // Multi-byte characters are never split
+    TextSplitter splitter(2, 0, {""});
+
+    std::vector<std::string> expected{"\xc3\xa9\xe2\x82\xac", "ab"};
+    EXPECT_EQ(splitter.split_text("\xc3\xa9\xe2\x82\xac" "ab"), expected);
+}
+
+TEST_F(TestTextSplitter, Words)
+{
+    TextSplitter splitter(3, 1, {}, true, true, TextLengthUnit::Words);
+
+    EXPECT_EQ(splitter.length("  one two\tthree\n"), 3);
+
+    std::vector<std::string> expected{"one two three", "three four five"};
+    EXPECT_EQ(splitter.split_text("one two three four five"), expected);
+}
+
+TEST_F(TestTextSplitter, StripWhitespace)
+{
+    EXPECT_TRUE(TextSplitter(5, 0).split_text(" \n\n \n\n ").empty());
+
+    std::vector<std::string> expected{"ab\n\n", "\n\ncd"};
+    EXPECT_EQ(TextSplitter(5, 0, {}, true, false).split_text("ab\n\n\n\ncd"), expected);
+}
+
+TEST_F(TestTextSplitter, InvalidOverlap)
+{
+    EXPECT_THROW(TextSplitter(10, 11), std::invalid_argument);
+}
@@ -0,0 +1,165 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/web_fetcher.hpp"  // for ParsedUrl, WebFetcher, WebResponse
+
+#include <gtest/gtest.h>
+
+#include <algorithm>   // for sort
+#include <filesystem>  // for directory_iterator, remove_all, temp_directory_path
+#include <map>
+#include <mutex>  // for mutex, lock_guard
+#include <string>
+#include <unistd.h>  // for getpid
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(WebFetcher);
+
+TEST_F(TestWebFetcher, ParseUrl)
+{
+    auto url = ParsedUrl::parse("HTTP://Example.COM/a/b?q=1#section");
+    ASSERT_TRUE(url.has_value());
+    EXPECT_EQ(url->scheme, "http");
+    EXPECT_EQ(url->host, "example.com");
+    EXPECT_EQ(url->port, "80");
+    EXPECT_EQ(url->target, "/a/b?q=1");
+    EXPECT_EQ(url->str(), "http://example.com/a/b?q=1");
+
+    auto ipv6 = ParsedUrl::parse("https://[::1]:8443");
+    ASSERT_TRUE(ipv6.has_value());
+    EXPECT_EQ(ipv6->host, "::1");
+    EXPECT_EQ(ipv6->port, "8443");
+    EXPECT_EQ(ipv6->target, "/");
+    EXPECT_EQ(ipv6->str(), "https://[::1]:8443/");
+
+    EXPECT_FALSE(ParsedUrl::parse("ftp://example.com/file").has_value());
+    EXPECT_FALSE(ParsedUrl::parse("/relative/path").has_value());
+    EXPECT_FALSE(ParsedUrl::parse("http://").has_value());
+}
+
+TEST_F(TestWebFetcher, ResolveLocation)
+{
+    auto base = *ParsedUrl::parse("http://example.com:8080/docs/page.html?x=1");
+
+    EXPECT_EQ(base.resolve("other.html")->str(), "http://example.com:8080/docs/other.html");
+    EXPECT_EQ(base.resolve("/root")->str(), "http://example.com:8080/root");
+    EXPECT_EQ(base.resolve("?y=2")->str(), "http://example.com:8080/docs/page.html?y=2");
+    EXPECT_EQ(base.resolve("//cdn.example.com/lib")->str(), "http://cdn.example.com/lib");
+    EXPECT_EQ(base.resolve("https://secure.example.com/")->str(), "https://secure.example.com/");
+}
+
+TEST_F(TestWebFetcher, Fallback)
+{
+    // Without a fallback only `http` URLs can be fetched, failures are reported in the responses
+    WebFetcher fetcher;
+    auto responses = fetcher.fetch({"not a url", "https://example.com/"});
+
+    ASSERT_EQ(responses.size(), 2);
+    EXPECT_EQ(responses[0].url, "not a url");
+    EXPECT_FALSE(responses[0].ok());
+    EXPECT_FALSE(responses[0].error.empty());
+    EXPECT_FALSE(responses[1].ok());
+    EXPECT_FALSE(responses[1].error.empty());
+
+    // The fallback function is called from several threads
+    std::mutex mutex;
+    std::vector<std::string> fallback_urls;
+    WebFetcher with_fallback({}, [&](const std::string& url, const std::map<std::string, std::string>& headers) {
+        std::lock_guard<std::mutex> lock(mutex);
+        fallback_urls.push_back(url);
+
+        WebResponse response;
+        response.url          = url;
+        response.final_url    = url;
+        response.status       = 200;
+        response.content_type = "text/plain";
+        response.body         = "fetched " + url;
+        return response;
+    });
+
+    responses = with_fallback.fetch({"https://example.com/a", "https://example.com/b"});
+
+    ASSERT_EQ(responses.size(), 2);
+    std::sort(fallback_urls.begin(), fallback_urls.end());
+    EXPECT_EQ(fallback_urls, (std::vector<std::string>{"https://example.com/a", "https://example.com/b"}));
+    EXPECT_TRUE(responses[1].ok());
+    EXPECT_EQ(responses[1].body, "fetched https://example.com/b");
+    EXPECT_EQ(with_fallback.num_idle_connections(), 0);
+}
+
+TEST_F(TestWebFetcher, FallbackCache)
+{
+    WebFetcherConfig config;
+    config.cache_dir = std::filesystem::temp_directory_path() / ("test_web_fetcher_" + std::to_string(::getpid()));
+
+    // Answers `304 Not Modified` when the request carries the validator of the page
+    std::vector<std::map<std::string, std::string>> requests;
+    WebFetcher fetcher(config, [&requests](const std::string& url, const std::map<std::string, std::string>& headers) {
+        requests.push_back(headers);
+
+        WebResponse response;
+        response.etag = "\"v1\"";
+        auto validator = headers.find("If-None-Match");
+        if (validator != headers.end() && validator->second == response.etag)
+        {
+            response.status = 304;
+            return response;
+        }
+
+        response.status       = 200;
+        response.content_type = "text/plain";
+        response.body         = "fetched " + url;
+        return response;
+    });
+
+    const std::vector<std::string> urls{"https://example.com/a"};
+    auto fetched = fetcher.fetch(urls);
+    ASSERT_TRUE(fetched[0].ok());
+    EXPECT_FALSE(fetched[0].from_cache);
+    EXPECT_TRUE(requests.back().empty());
+
+    auto cached = fetcher.fetch(urls);
+    ASSERT_TRUE(cached[0].ok());
+    EXPECT_TRUE(cached[0].from_cache);
+    EXPECT_EQ(cached[0].body, "fetched https://example.com/a");
+    EXPECT_EQ(cached[0].content_type, "text/plain");
+    EXPECT_EQ(requests.back().at("If-None-Match"), "\"v1\"");
+
+    // Without its body the cached entry is useless, the page is requested again without the validator
+    for (const auto& file : std::filesystem::directory_iterator(config.cache_dir))
+    {
+        if (file.path().extension() == ".body")
+        {
+            std::filesystem::remove(file.path());
+        }
+    }
+
+    requests.clear();
+    auto refetched = fetcher.fetch(urls);
+    ASSERT_TRUE(refetched[0].ok());
+    EXPECT_FALSE(refetched[0].from_cache);
+    EXPECT_EQ(refetched[0].body, "fetched https://example.com/a");
+    ASSERT_EQ(requests.size(), 2);
+    EXPECT_TRUE(requests.back().empty());
+
+    std::filesystem::remove_all(config.cache_dir);
+}
@@ -0,0 +1,237 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/decoded_table.hpp"         // for DecodedTable
+#include "morpheus/objects/windows_event_parser.hpp"  // for WindowsEventParser, WindowsEventField
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(WindowsEventParser);
+
+namespace {
+const std::string LogonEvent =
+    "<?xml version='1.0' encoding='utf-8'?>"
+    "<Event xmlns='http://schemas.microsoft.com/win/2004/08/events/event'>"
+    "<System>"
+    "<Provider Name='Microsoft-Windows-Security-Auditing' Guid='{54849625-5478-4994-a5ba-3e3b0328c30d}'/>"
+    "<EventID>4624</EventID><Version>2</Version><Level>0</Level>"
+    "<TimeCreated SystemTime='2024-03-01T12:34:56.1234567Z'/>"
+    "<EventRecordID>1163</EventRecordID>"
+    "<Execution ProcessID='652' ThreadID='2996'/>"
+    "<Channel>Security</Channel><Computer>dc01.example.com</Computer><Security/>"
+    "</System>\n"
+    "<EventData>"
+    "<Data Name='SubjectUserName'>DC01$</Data>"
+    "<Data Name='TargetUserName'>bob &amp; alice</Data>"
+    "<Data Name='LogonType'>10</Data>"
+    "<Data Name='IpAddress'>10.0.0.5</Data>"
+    "<Data Name='ProcessName'><![CDATA[C:\\Windows\\<system32>\\svchost.exe]]></Data>"
+    "<Data Name='WorkstationName'/>"
+    "</EventData>"
+    "<RenderingInfo Culture='en-US'><Message>An account was successfully logged on.&#x0A;</Message></RenderingInfo>"
+    "</Event>\r\n";
+
+DecodedTable parse_event(const WindowsEventParser& parser, std::string_view event)
+{
+    DecodedTable table;
+    auto columns = table.get_columns(parser.columns());
+
+    table.begin_row();
+    parser.parse(event, table, columns);
+    table.end_row();
+
+    return table;
+}
+
+std::size_t find_column(const DecodedTable& table, const std::string& name)
+{
+    for (std::size_t column = 0; column < table.num_columns(); ++column)
+    {
+        if (table.column_spec(column).name == name)
+        {
+            return column;
+        }
+    }
+
+    throw std::invalid_argument(name);
+}
+
+std::optional<std::string> get_string(const DecodedTable& table, const std::string& name)
+{
+    auto value = table.get_string(find_column(table, name), 0);
+    return value.has_value() ? std::optional<std::string>(*value) : std::nullopt;
+}
+
+std::optional<std::int64_t> get_int(const DecodedTable& table, const std::string& name)
+{
+    return table.get_int(find_column(table, name), 0);
+}
+}  // namespace
+
+TEST_F(TestWindowsEventParser, XmlEvent)
+{
+    WindowsEventParser parser({{"EventID", "event_id", cudf::type_id::INT64},
+                               {"Provider.Name", "provider"},
+                               {"TimeCreated.SystemTime", "timestamp", cudf::type_id::TIMESTAMP_NANOSECONDS},
+                               {"Execution.ProcessID", "pid", cudf::type_id::INT64},
+                               {"Computer"},
+                               {"Security.UserID"},
+                               {"TargetUserName"},
+                               {"LogonType", "", cudf::type_id::INT64},
+                               {"ProcessName"},
+                               {"WorkstationName"},
+                               {"RenderingInfo.Culture"},
+                               {"RenderingInfo.Message", "message"}});
+
+    auto table = parse_event(parser, LogonEvent);
+    EXPECT_EQ(get_int(table, "event_id"), 4624);
+    EXPECT_EQ(get_string(table, "provider"), "Microsoft-Windows-Security-Auditing");
+    EXPECT_EQ(get_int(table, "timestamp"), 1709296496123456700);
+    EXPECT_EQ(get_int(table, "pid"), 652);
+    EXPECT_EQ(get_string(table, "Computer"), "dc01.example.com");
+    EXPECT_EQ(get_string(table, "Security.UserID"), std::nullopt);
+    EXPECT_EQ(get_string(table, "TargetUserName"), "bob & alice");
+    EXPECT_EQ(get_int(table, "LogonType"), 10);
+    EXPECT_EQ(get_string(table, "ProcessName"), "C:\\Windows\\<system32>\\svchost.exe");
+    EXPECT_EQ(get_string(table, "WorkstationName"), "");
+    EXPECT_EQ(get_string(table, "RenderingInfo.Culture"), "en-US");
+    EXPECT_EQ(get_string(table, "message"), "An account was successfully logged on.\n");
+
+    // Namespace prefixes are dropped and the sections of UserData are keyed below their wrapper element. Line breaks
+    // are normalized as by an XML processor.
+    table = parse_event(parser,
+                        "<e:Event xmlns:e='urn:x'><e:System><e:EventID Qualifiers='0'>1102</e:EventID>"
+                        "<e:Provider Name='a\r\nb'/></e:System><e:UserData><LogFileCleared>"
+                        "<TargetUserName>admin\r\n</TargetUserName></LogFileCleared></e:UserData></e:Event>");
+    EXPECT_EQ(get_int(table, "event_id"), 1102);
+    EXPECT_EQ(get_string(table, "provider"), "a b");
+    EXPECT_EQ(get_string(table, "TargetUserName"), "admin\n");
+    EXPECT_EQ(get_string(table, "Computer"), std::nullopt);
+}
+
+TEST_F(TestWindowsEventParser, JsonEvent)
+{
+    WindowsEventParser parser({{"event_id", "event_id", cudf::type_id::INT64},
+                               {"computer_name", "computer"},
+                               {"event_data.LogonType", "logon_type", cudf::type_id::INT64},
+                               {"TargetUserName"},
+                               {"process.pid", "pid", cudf::type_id::INT64},
+                               {"elevated", "", cudf::type_id::BOOL8}},
+                              "event_id");
+
+    // Winlogbeat
+    auto table = parse_event(parser,
+                             R"({"@timestamp": "2024-03-01T12:34:56Z", "process": {"pid": 652, "name": null},
+                                 "winlog": {"event_id": "4624", "computer_name": "dc01", "elevated": true,
+                                            "event_data": {"LogonType": "10", "TargetUserName": "bob\u00e9\n"},
+                                            "keywords": ["Audit Success"]}})");
+    EXPECT_EQ(get_int(table, "event_id"), 4624);
+    EXPECT_EQ(get_string(table, "computer"), "dc01");
+    EXPECT_EQ(get_int(table, "logon_type"), 10);
+    EXPECT_EQ(get_string(table, "TargetUserName"), "bob\xC3\xA9\n");
+    EXPECT_EQ(get_int(table, "pid"), 652);
+    EXPECT_EQ(get_int(table, "elevated"), 1);
+
+    // Events converted from XML, with attributes, text members and named data objects
+    WindowsEventParser converted({{"EventID", "event_id", cudf::type_id::INT64},
+                                  {"Provider.Name", "provider"},
+                                  {"LogonType", "", cudf::type_id::INT64},
+                                  {"TargetUserName"}});
+    table = parse_event(converted,
+                        R"({"Event": {"System": {"Provider": {"@Name": "Security"},
+                                                 "EventID": {"@Qualifiers": "0", "#text": "4625"}},
+                                      "EventData": {"Data": [{"@Name": "TargetUserName", "#text": "eve"},
+                                                             {"@Name": "LogonType", "#text": "3"}]}}})");
+    EXPECT_EQ(get_int(table, "event_id"), 4625);
+    EXPECT_EQ(get_string(table, "provider"), "Security");
+    EXPECT_EQ(get_int(table, "LogonType"), 3);
+    EXPECT_EQ(get_string(table, "TargetUserName"), "eve");
+}
+
+TEST_F(TestWindowsEventParser, EventIdSchemas)
+{
+    WindowsEventParser parser({{"EventID", "event_id", cudf::type_id::INT64},
+                               {"TargetUserName", "user", cudf::type_id::STRING, {4624, 4625}},
+                               {"LogonType", "logon_type", cudf::type_id::INT64, {4624}},
+                               {"SubjectUserName", "user", cudf::type_id::STRING, {4688}},
+                               {"NewProcessName", "process", cudf::type_id::STRING, {4688}}});
+
+    ASSERT_EQ(parser.columns().size(), 4);
+    EXPECT_EQ(parser.columns()[1].name, "user");
+
+    auto table = parse_event(parser, LogonEvent);
+    EXPECT_EQ(get_string(table, "user"), "bob & alice");
+    EXPECT_EQ(get_int(table, "logon_type"), 10);
+    EXPECT_EQ(get_string(table, "process"), std::nullopt);
+
+    table = parse_event(parser,
+                        "<Event><System><EventID>4688</EventID></System><EventData>"
+                        "<Data Name='TargetUserName'>-</Data><Data Name='LogonType'>2</Data>"
+                        "<Data Name='SubjectUserName'>carol</Data><Data Name='NewProcessName'>cmd.exe</Data>"
+                        "</EventData></Event>");
+    EXPECT_EQ(get_int(table, "event_id"), 4688);
+    EXPECT_EQ(get_string(table, "user"), "carol");
+    EXPECT_EQ(get_int(table, "logon_type"), std::nullopt);
+    EXPECT_EQ(get_string(table, "process"), "cmd.exe");
+
+    // Without an event ID only the fields of every event are written
+    table = parse_event(parser, R"({"TargetUserName": "dave"})");
+    EXPECT_EQ(get_int(table, "event_id"), std::nullopt);
+    EXPECT_EQ(get_string(table, "user"), std::nullopt);
+
+    EXPECT_THROW(WindowsEventParser({{"a", "x", cudf::type_id::INT64}, {"b", "x"}}), std::invalid_argument);
+    EXPECT_THROW(WindowsEventParser({{""}}), std::invalid_argument);
+    EXPECT_THROW(WindowsEventParser({{"a", "", cudf::type_id::INT32}}), std::invalid_argument);
+    EXPECT_THROW(WindowsEventParser({}, ""), std::invalid_argument);
+}
+
+TEST_F(TestWindowsEventParser, Malformed)
+{
+    WindowsEventParser parser({{"EventID"}, {"Message"}});
+
+    for (const auto* event : {"",
+                              "EventID=4624",
+                              "<Event><System><EventID>1</EventID></Event>",
+                              "<Event><System>",
+                              "<Event></Event><Event></Event>",
+                              "<Event a=1></Event>",
+                              "<Event><Message>&bogus;</Message></Event>",
+                              "<Event><!-- </Event>",
+                              "{\"EventID\": 1",
+                              "{\"EventID\": 1} x",
+                              "{\"EventID\": \"\\q\"}",
+                              "{\"EventID\": tru}",
+                              "[1]"})
+    {
+        EXPECT_THROW(parse_event(parser, event), std::runtime_error);
+    }
+
+    std::string nested(100, '[');
+    EXPECT_THROW(parse_event(parser, "{\"a\": " + nested + "}"), std::runtime_error);
+}
@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // for TEST_CLASS_WITH_PYTHON, morpheus
+
+#include "morpheus/stages/inference_worker_pool.hpp"  // for InferenceWorkerPool
+
+#include <gtest/gtest.h>        // for EXPECT_THROW, TestInfo, TestPartResult, TEST_F
+#include <pybind11/gil.h>       // for gil_scoped_release
+#include <pybind11/pybind11.h>  // for cpp_function, error_already_set
+
+#include <stdexcept>  // for runtime_error
+
+using namespace morpheus;
+
+TEST_CLASS_WITH_PYTHON(InferenceWorkerPool);
+
+TEST_F(TestInferenceWorkerPool, WorkerFactoryError)
+{
+    InferenceWorkerPool pool(pybind11::cpp_function([]() -> pybind11::object {
+                                 throw std::runtime_error("Failed to load the model");
+                             }),
+                             2,
+                             4);
+
+    // The workers need the GIL to be created
+    pybind11::gil_scoped_release no_gil;
+
+    // Batches queued before the workers failed, and batches submitted afterwards, are failed rather than left waiting
+    auto first  = pool.submit(nullptr);
+    auto second = pool.submit(nullptr);
+
+    EXPECT_THROW(first.get(), pybind11::error_already_set);
+    EXPECT_THROW(second.get(), pybind11::error_already_set);
+    EXPECT_THROW(pool.submit(nullptr).get(), pybind11::error_already_set);
+}
+
+TEST_F(TestInferenceWorkerPool, SubmitAfterShutdown)
+{
+    InferenceWorkerPool pool(pybind11::cpp_function([]() {
+                                 return pybind11::none();
+                             }),
+                             1,
+                             1);
+
+    pool.shutdown();
+
+    pybind11::gil_scoped_release no_gil;
+
+    auto result = pool.submit(nullptr);
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
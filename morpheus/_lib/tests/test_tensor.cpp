@@ -33,10 +33,15 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
-#include <cstddef>  // for size_t
-#include <memory>   // shared_ptr
-#include <string>   // for allocator, operator==, basic_string, string
-#include <vector>   // for vector
+#include <cmath>      // for ldexp
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t, uint16_t
+#include <cstring>    // for memcpy
+#include <limits>     // for numeric_limits
+#include <memory>     // shared_ptr
+#include <stdexcept>  // for invalid_argument
+#include <string>     // for allocator, operator==, basic_string, string
+#include <vector>     // for vector
 
 // IWYU pragma: no_include "morpheus/utilities/string_util.hpp"
 // IWYU thinks we need ext/new_allocator.h for size_t for some reason
@@ -181,3 +186,70 @@ TEST_F(TestTensor, UtilsValidateShapeAndStride)
 
     EXPECT_EQ(stride, ShapeType({320 * 320, 320, 1}));
 }
+
+TEST_F(TestTensor, UtilsSplitSeqIdBatches)
+{
+    // Rows belonging to the same message are never split across batches
+    EXPECT_EQ(TensorUtils::split_seq_id_batches({0, 0, 1, 2, 2, 2, 3, 4}, 3),
+              (std::vector<RangeType>{{0, 3}, {3, 6}, {6, 8}}));
+
+    // A single message larger than the batch size is kept whole rather than producing an empty batch
+    EXPECT_EQ(TensorUtils::split_seq_id_batches({0, 0, 0, 0, 0, 1}, 2), (std::vector<RangeType>{{0, 5}, {5, 6}}));
+
+    EXPECT_EQ(TensorUtils::split_seq_id_batches({5}, 4), (std::vector<RangeType>{{0, 1}}));
+    EXPECT_TRUE(TensorUtils::split_seq_id_batches({}, 4).empty());
+}
+
+namespace {
+template <typename T>
+std::vector<uint8_t> to_bytes(const std::vector<T>& values)
+{
+    std::vector<uint8_t> bytes(values.size() * sizeof(T));
+    std::memcpy(bytes.data(), values.data(), bytes.size());
+    return bytes;
+}
+
+template <typename T>
+std::vector<T> from_bytes(const std::vector<uint8_t>& bytes)
+{
+    std::vector<T> values(bytes.size() / sizeof(T));
+    std::memcpy(values.data(), bytes.data(), bytes.size());
+    return values;
+}
+}  // namespace
+
+TEST_F(TestTensor, UtilsCastHost)
+{
+    auto widened = TensorUtils::cast_host(to_bytes<int16_t>({-3, 0, 32767}), TypeId::INT16, TypeId::INT32);
+    EXPECT_EQ(from_bytes<int32_t>(widened), (std::vector<int32_t>{-3, 0, 32767}));
+
+    auto masks = TensorUtils::cast_host(to_bytes<uint8_t>({0, 1, 2}), TypeId::UINT8, TypeId::BOOL8);
+    EXPECT_EQ(masks, (std::vector<uint8_t>{0, 1, 1}));
+
+    // 1.5, -2, the largest half, the smallest subnormal half and infinity
+    auto halves = TensorUtils::cast_host(
+        to_bytes<uint16_t>({0x3e00, 0xc000, 0x7bff, 0x0001, 0x7c00}), TypeId::FLOAT16, TypeId::FLOAT32);
+    const auto infinity = std::numeric_limits<float>::infinity();
+    EXPECT_EQ(from_bytes<float>(halves), (std::vector<float>{1.5F, -2.0F, 65504.0F, std::ldexp(1.0F, -24), infinity}));
+
+    // Rounded to nearest even, overflowing to infinity and underflowing to zero
+    auto narrowed = TensorUtils::cast_host(
+        to_bytes<float>({1.5F, 65519.0F, 65520.0F, 1e-8F, 0.1F}), TypeId::FLOAT32, TypeId::FLOAT16);
+    EXPECT_EQ(from_bytes<uint16_t>(narrowed), (std::vector<uint16_t>{0x3e00, 0x7bff, 0x7c00, 0x0000, 0x2e66}));
+
+    // Every half other than NaN survives a round trip through float
+    std::vector<uint16_t> all_halves;
+    for (uint32_t bits = 0; bits <= 0xffff; ++bits)
+    {
+        if ((bits & 0x7c00) != 0x7c00 || (bits & 0x3ff) == 0)
+        {
+            all_halves.push_back(static_cast<uint16_t>(bits));
+        }
+    }
+
+    auto as_float   = TensorUtils::cast_host(to_bytes(all_halves), TypeId::FLOAT16, TypeId::FLOAT32);
+    auto round_trip = TensorUtils::cast_host(as_float, TypeId::FLOAT32, TypeId::FLOAT16);
+    EXPECT_EQ(from_bytes<uint16_t>(round_trip), all_halves);
+
+    EXPECT_THROW(TensorUtils::cast_host({0}, TypeId::STRING, TypeId::INT32), std::invalid_argument);
+}
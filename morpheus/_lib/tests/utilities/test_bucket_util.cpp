@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/types.hpp"                  // for TensorIndex
+#include "morpheus/utilities/bucket_util.hpp"  // for BucketUtil, LengthBucket
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>  // for invalid_argument
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(BucketUtil);
+
+TEST_F(TestBucketUtil, BucketLengths)
+{
+    EXPECT_EQ(BucketUtil::default_bucket_lengths(128), (std::vector<TensorIndex>{16, 32, 64, 128}));
+    EXPECT_EQ(BucketUtil::default_bucket_lengths(100), (std::vector<TensorIndex>{16, 32, 64, 100}));
+    EXPECT_EQ(BucketUtil::default_bucket_lengths(8), (std::vector<TensorIndex>{8}));
+
+    EXPECT_EQ(BucketUtil::normalize_bucket_lengths({}, 64), (std::vector<TensorIndex>{16, 32, 64}));
+    EXPECT_EQ(BucketUtil::normalize_bucket_lengths({256, 48, 24, 48}, 128), (std::vector<TensorIndex>{24, 48, 128}));
+    EXPECT_EQ(BucketUtil::normalize_bucket_lengths({128, 32}, 128), (std::vector<TensorIndex>{32, 128}));
+
+    EXPECT_THROW(BucketUtil::normalize_bucket_lengths({0, 32}, 128), std::invalid_argument);
+    EXPECT_THROW(BucketUtil::default_bucket_lengths(0), std::invalid_argument);
+}
+
+TEST_F(TestBucketUtil, PaddedLength)
+{
+    std::vector<TensorIndex> bucket_lengths{16, 32, 64};
+
+    EXPECT_EQ(BucketUtil::padded_length(0, bucket_lengths), 16);
+    EXPECT_EQ(BucketUtil::padded_length(16, bucket_lengths), 16);
+    EXPECT_EQ(BucketUtil::padded_length(17, bucket_lengths), 32);
+    EXPECT_EQ(BucketUtil::padded_length(64, bucket_lengths), 64);
+    EXPECT_THROW(BucketUtil::padded_length(65, bucket_lengths), std::invalid_argument);
+}
+
+TEST_F(TestBucketUtil, StableLengthOrder)
+{
+    EXPECT_TRUE(BucketUtil::stable_length_order({}).empty());
+
+    // Rows of equal length keep their order
+    EXPECT_EQ(BucketUtil::stable_length_order({5, 3, 5, 1, 3, 5}), (std::vector<TensorIndex>{3, 1, 4, 0, 2, 5}));
+}
+
+TEST_F(TestBucketUtil, MakeBuckets)
+{
+    std::vector<TensorIndex> bucket_lengths{4, 8, 16};
+    std::vector<TensorIndex> lengths{10, 2, 7, 3, 16, 4, 5, 1};
+
+    auto buckets = BucketUtil::make_buckets(lengths, bucket_lengths);
+    ASSERT_EQ(buckets.size(), 3);
+
+    EXPECT_EQ(buckets[0].padded_length, 4);
+    EXPECT_EQ(buckets[0].rows, (std::vector<TensorIndex>{7, 1, 3, 5}));
+    EXPECT_EQ(buckets[1].padded_length, 8);
+    EXPECT_EQ(buckets[1].rows, (std::vector<TensorIndex>{6, 2}));
+    EXPECT_EQ(buckets[2].padded_length, 16);
+    EXPECT_EQ(buckets[2].rows, (std::vector<TensorIndex>{0, 4}));
+
+    // Large buckets are split into batches of at most `max_rows`
+    auto limited = BucketUtil::make_buckets(lengths, bucket_lengths, 3);
+    ASSERT_EQ(limited.size(), 4);
+
+    EXPECT_EQ(limited[0].rows, (std::vector<TensorIndex>{7, 1, 3}));
+    EXPECT_EQ(limited[1].padded_length, 4);
+    EXPECT_EQ(limited[1].rows, (std::vector<TensorIndex>{5}));
+    EXPECT_EQ(limited[2].rows, (std::vector<TensorIndex>{6, 2}));
+    EXPECT_EQ(limited[3].rows, (std::vector<TensorIndex>{0, 4}));
+
+    EXPECT_TRUE(BucketUtil::make_buckets({}, bucket_lengths).empty());
+    EXPECT_THROW(BucketUtil::make_buckets({17}, bucket_lengths), std::invalid_argument);
+}
@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/utilities/column_util.hpp"  // for ColumnUtil, HostStringsColumn
+
+#include <cudf/column/column.hpp>       // for column
+#include <cudf/column/column_view.hpp>  // for column_view
+#include <cudf/copying.hpp>             // for slice
+#include <gtest/gtest.h>
+
+#include <atomic>     // for atomic
+#include <cstddef>    // for size_t
+#include <cstdint>    // for int32_t, int64_t
+#include <mutex>      // for mutex, lock_guard
+#include <optional>   // for optional, nullopt
+#include <stdexcept>  // for runtime_error
+#include <string>
+#include <utility>  // for pair
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(ColumnUtil);
+
+TEST_F(TestColumnUtil, ParallelForRowsCoversEveryRow)
+{
+    for (std::size_t num_rows : {0, 1, 63, 64, 130, 1000, 1001})
+    {
+        std::vector<int> visits(num_rows, 0);
+        std::vector<std::pair<std::size_t, std::size_t>> ranges(ColumnUtil::num_row_chunks(num_rows, 8));
+        std::mutex mutex;
+
+        ColumnUtil::parallel_for_rows(num_rows, 8, [&](std::size_t chunk, std::size_t start, std::size_t stop) {
+            for (std::size_t row = start; row < stop; ++row)
+            {
+                ++visits[row];
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            ranges[chunk] = {start, stop};
+        });
+
+        EXPECT_EQ(visits, std::vector<int>(num_rows, 1));
+
+        // The ranges are contiguous and in order of their chunk
+        std::size_t next = 0;
+        for (const auto& [start, stop] : ranges)
+        {
+            EXPECT_EQ(start, next);
+            next = stop;
+        }
+        EXPECT_EQ(next, num_rows);
+    }
+
+    // Small inputs stay on the calling thread
+    EXPECT_EQ(ColumnUtil::num_row_chunks(100, 8), 1);
+    EXPECT_EQ(ColumnUtil::num_row_chunks(1000, 8), 8);
+    EXPECT_EQ(ColumnUtil::num_row_chunks(1000, 8, 1024), 1);
+}
+
+TEST_F(TestColumnUtil, ParallelForRowsRethrows)
+{
+    std::atomic<std::size_t> completed{0};
+    EXPECT_THROW(ColumnUtil::parallel_for_rows(1000,
+                                               4,
+                                               [&](std::size_t chunk, std::size_t, std::size_t) {
+                                                   if (chunk == 2)
+                                                   {
+                                                       throw std::runtime_error("bad row");
+                                                   }
+                                                   ++completed;
+                                               }),
+                 std::runtime_error);
+
+    EXPECT_EQ(completed, 3);
+}
+
+TEST_F(TestColumnUtil, MakeStringsColumn)
+{
+    auto column = ColumnUtil::make_strings_column(
+        std::vector<std::optional<std::string>>{"alpha", std::nullopt, "", "gamma"});
+
+    EXPECT_EQ(column->size(), 4);
+    EXPECT_EQ(column->null_count(), 1);
+
+    HostStringsColumn strings{column->view()};
+    ASSERT_EQ(strings.size(), 4);
+    EXPECT_TRUE(strings.is_valid(0));
+    EXPECT_FALSE(strings.is_valid(1));
+    EXPECT_TRUE(strings.is_valid(2));
+    EXPECT_EQ(strings.get(0), "alpha");
+    EXPECT_EQ(strings.get(1), "");
+    EXPECT_EQ(strings.get(3), "gamma");
+
+    auto all_valid = ColumnUtil::make_strings_column(std::vector<std::string>{"a", "bc"});
+    EXPECT_EQ(all_valid->null_count(), 0);
+    EXPECT_EQ(HostStringsColumn{all_valid->view()}.get(1), "bc");
+}
+
+TEST_F(TestColumnUtil, IntegersToHost)
+{
+    auto column = ColumnUtil::make_numeric_column(
+        std::vector<std::int32_t>{7, 0, -3, 40000}, cudf::type_id::INT32, {true, false, true, true});
+
+    auto values = ColumnUtil::integers_to_host(column->view());
+    EXPECT_EQ(values, (std::vector<std::optional<std::int64_t>>{7, std::nullopt, -3, 40000}));
+
+    // The null mask of a slice is read from its offset
+    auto sliced = cudf::slice(column->view(), {1, 3})[0];
+    EXPECT_EQ(ColumnUtil::integers_to_host(sliced), (std::vector<std::optional<std::int64_t>>{std::nullopt, -3}));
+
+    EXPECT_TRUE(ColumnUtil::integers_to_host(cudf::slice(column->view(), {0, 0})[0]).empty());
+}
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/objects/dtype.hpp"          // for DType
+#include "morpheus/objects/tensor.hpp"         // for Tensor
+#include "morpheus/objects/tensor_object.hpp"  // for TensorObject
+#include "morpheus/types.hpp"                  // for TensorIndex, RangeType
+#include "morpheus/utilities/column_util.hpp"  // for ColumnUtil
+#include "morpheus/utilities/dedup_util.hpp"   // for DedupUtil, DedupIndex
+
+#include <cudf/table/table_view.hpp>  // for table_view
+#include <cudf/types.hpp>             // for type_id
+#include <gtest/gtest.h>
+#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_per_thread
+#include <rmm/device_buffer.hpp>     // for device_buffer
+
+#include <cstdint>  // for uint64_t
+#include <memory>   // for make_shared
+#include <string>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(DedupUtil);
+
+TEST_F(TestDedupUtil, BuildIndex)
+{
+    auto index = DedupUtil::build_index({7, 3, 7, 9, 3, 7});
+
+    EXPECT_EQ(index.hashes, (std::vector<std::uint64_t>{7, 3, 7, 9, 3, 7}));
+    EXPECT_EQ(index.representative, (std::vector<TensorIndex>{0, 1, 0, 3, 1, 0}));
+    EXPECT_EQ(index.unique_rows(), (std::vector<TensorIndex>{0, 1, 3}));
+    EXPECT_TRUE(index.has_duplicates());
+
+    auto unique = DedupUtil::build_index({1, 2, 3});
+    EXPECT_EQ(unique.unique_rows(), (std::vector<TensorIndex>{0, 1, 2}));
+    EXPECT_FALSE(unique.has_duplicates());
+
+    auto empty = DedupUtil::build_index({});
+    EXPECT_TRUE(empty.unique_rows().empty());
+    EXPECT_FALSE(empty.has_duplicates());
+}
+
+TEST_F(TestDedupUtil, ToRowRanges)
+{
+    EXPECT_TRUE(DedupUtil::to_row_ranges({}).empty());
+
+    EXPECT_EQ(DedupUtil::to_row_ranges({0, 1, 2, 5, 6, 9}),
+              (std::vector<RangeType>{{0, 3}, {5, 7}, {9, 10}}));
+
+    // Repeated rows, as produced when scattering to duplicates, start a new range
+    EXPECT_EQ(DedupUtil::to_row_ranges({0, 1, 0, 0, 1, 2}),
+              (std::vector<RangeType>{{0, 2}, {0, 1}, {0, 3}}));
+}
+
+TEST_F(TestDedupUtil, VerifyIndex)
+{
+    auto numbers = ColumnUtil::make_numeric_column(std::vector<std::int32_t>{1, 2, 1, 3, 2}, cudf::type_id::INT32);
+    auto strings = ColumnUtil::make_strings_column(std::vector<std::string>{"a", "b", "a", "c", "x"});
+    cudf::table_view table({numbers->view(), strings->view()});
+
+    // Rows 3 and 4 share the hash of rows 0 and 1 without sharing their contents
+    auto index = DedupUtil::build_index({7, 8, 7, 7, 8});
+    DedupUtil::verify_index(table, index);
+
+    EXPECT_EQ(index.representative, (std::vector<TensorIndex>{0, 1, 0, 3, 4}));
+    EXPECT_EQ(index.unique_rows(), (std::vector<TensorIndex>{0, 1, 3, 4}));
+}
+
+TEST_F(TestDedupUtil, GatherTensorRows)
+{
+    std::vector<float> values{0, 1, 10, 11, 20, 21, 30, 31};
+    auto buffer = std::make_shared<rmm::device_buffer>(
+        values.data(), values.size() * sizeof(float), rmm::cuda_stream_per_thread);
+    auto tensor = Tensor::create(buffer, DType::create<float>(), {4, 2}, {}, 0);
+
+    // Interleaved and repeated rows are gathered at once
+    auto gathered = DedupUtil::gather_tensor_rows(tensor, {3, 0, 3, 1, 0});
+
+    EXPECT_EQ(gathered.get_shape(), (std::vector<TensorIndex>{5, 2}));
+    EXPECT_EQ(gathered.get_host_data<float>(), (std::vector<float>{30, 31, 0, 1, 30, 31, 10, 11, 0, 1}));
+}
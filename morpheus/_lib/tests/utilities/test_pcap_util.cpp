@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/utilities/pcap_util.hpp"  // for PcapUtil, PcapFlowFeatures
+
+#include <gtest/gtest.h>
+
+#include <cmath>  // for isnan
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(PcapUtil);
+
+TEST_F(TestPcapUtil, RollupTime)
+{
+    // 2023-11-14 22:13:20 rolls up to the end of its minute
+    EXPECT_EQ(PcapUtil::rollup_time(1'700'000'000'000'000), 1'700'000'040'000'000);
+
+    // A timestamp on a minute boundary falls into the following minute
+    EXPECT_EQ(PcapUtil::rollup_time(1'699'999'980'000'000), 1'700'000'040'000'000);
+
+    EXPECT_EQ(PcapUtil::format_minute(1'700'000'040'000'000), "2023-11-14 22:14");
+    EXPECT_EQ(PcapUtil::format_minute(0), "1970-01-01 00:00");
+    EXPECT_EQ(PcapUtil::format_minute(-1), "1969-12-31 23:59");
+}
+
+TEST_F(TestPcapUtil, FlowId)
+{
+    EXPECT_EQ(PcapUtil::flow_id("10.0.0.1", "443", "10.0.0.2", "51234"), "10.0.0.1:443=10.0.0.2:51234");
+}
+
+TEST_F(TestPcapUtil, ComputeFeatures)
+{
+    const std::string flow_a = PcapUtil::flow_id("10.0.0.1", "443", "10.0.0.2", "51234");
+    const std::string flow_b = PcapUtil::flow_id("10.0.0.3", "80", "10.0.0.2", "51235");
+
+    // The last packet belongs to flow a, but is in the next minute
+    std::vector<std::int64_t> timestamps{
+        1'700'000'000'000'000, 1'700'000'001'000'000, 1'700'000'002'000'000, 1'700'000'003'000'000,
+        1'700'000'050'000'000};
+    std::vector<std::int64_t> flags{24, 16, 2, 0, 1};
+    std::vector<std::int64_t> data_len{100, 50, 0, 10, 70000};
+    std::vector<std::optional<std::string>> flow_ids{flow_a, flow_a, flow_b, std::nullopt, flow_a};
+
+    auto result = PcapUtil::compute_features(timestamps, flags, data_len, flow_ids);
+
+    const auto num_features = PcapUtil::feature_names().size();
+    ASSERT_EQ(num_features, 13);
+    ASSERT_EQ(result.features.size(), timestamps.size() * num_features);
+    EXPECT_EQ(result.rollup_time,
+              (std::vector<std::string>{
+                  "2023-11-14 22:14", "2023-11-14 22:14", "2023-11-14 22:14", "2023-11-14 22:14", "2023-11-14 22:15"}));
+
+    auto row = [&](std::size_t i) {
+        return std::vector<float>(result.features.begin() + i * num_features,
+                                  result.features.begin() + (i + 1) * num_features);
+    };
+
+    // Flow a: ACK+PSH and ACK, 150 bytes over two packets
+    const std::vector<float> expected_a{2, 1, 0, 0, 0, 2, 150, 75, 3, 1, 0, 0, 0};
+    EXPECT_EQ(row(0), expected_a);
+    EXPECT_EQ(row(1), expected_a);
+
+    // Flow b: a single SYN
+    EXPECT_EQ(row(2), (std::vector<float>{0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 1, 0}));
+
+    // Packets without a flow id are not aggregated
+    for (auto value : row(3))
+    {
+        EXPECT_TRUE(std::isnan(value));
+    }
+
+    // A FIN in the next minute, with the data length truncated to 16 bits
+    EXPECT_EQ(row(4), (std::vector<float>{0, 0, 0, 0, 1, 1, 4464, 4464, 1, 0, 0, 0, 1}));
+}
+
+TEST_F(TestPcapUtil, ComputeFeaturesWithoutFlags)
+{
+    std::vector<std::optional<std::string>> flow_ids{PcapUtil::flow_id("10.0.0.1", "443", "10.0.0.2", "51234")};
+
+    auto result = PcapUtil::compute_features({1'700'000'000'000'000}, {0}, {20}, flow_ids);
+
+    // The flag ratios are undefined when a flow has no flags set
+    EXPECT_EQ(result.features[5], 1);
+    EXPECT_EQ(result.features[7], 20);
+    EXPECT_EQ(result.features[8], 0);
+    for (std::size_t i = 9; i < 13; ++i)
+    {
+        EXPECT_TRUE(std::isnan(result.features[i]));
+    }
+}
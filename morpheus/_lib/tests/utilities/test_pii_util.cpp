@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/utilities/pii_util.hpp"  // for PiiMasker, PiiUtil, PiiEntity
+
+#include <gtest/gtest.h>
+
+#include <cstdint>  // for uint64_t
+#include <map>
+#include <stdexcept>  // for invalid_argument
+#include <string>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_CLASS(PiiUtil);
+
+TEST_F(TestPiiUtil, LuhnValid)
+{
+    EXPECT_TRUE(PiiUtil::luhn_valid("4111111111111111"));
+    EXPECT_TRUE(PiiUtil::luhn_valid("4111-1111-1111-1111"));
+    EXPECT_TRUE(PiiUtil::luhn_valid("378282246310005"));
+    EXPECT_FALSE(PiiUtil::luhn_valid("4111111111111112"));
+    EXPECT_FALSE(PiiUtil::luhn_valid(""));
+}
+
+TEST_F(TestPiiUtil, SipHash)
+{
+    // Reference vectors from the SipHash paper, key 00 01 02 ... 0f and messages 00 01 02 ...
+    const std::uint64_t key0 = 0x0706050403020100ULL;
+    const std::uint64_t key1 = 0x0f0e0d0c0b0a0908ULL;
+
+    EXPECT_EQ(PiiUtil::siphash(key0, key1, ""), 0x726fdb47dd0e0e31ULL);
+
+    std::string message;
+    for (char c = 0; c < 15; ++c)
+    {
+        message.push_back(c);
+    }
+    EXPECT_EQ(PiiUtil::siphash(key0, key1, message), 0xa129ca6149be45e5ULL);
+}
+
+TEST_F(TestPiiUtil, RedactBuiltinEntities)
+{
+    PiiMasker masker(PiiEntity::all());
+
+    EXPECT_EQ(masker.mask("contact alice.smith+tag@example.com now"), "contact [EMAIL] now");
+    EXPECT_EQ(masker.mask("src=10.1.2.3 dst=192.168.0.255:443"), "src=[IP_ADDRESS] dst=[IP_ADDRESS]:443");
+    EXPECT_EQ(masker.mask("from fe80::1ff:fe23:4567:890a to ::1"), "from [IP_ADDRESS] to [IP_ADDRESS]");
+    EXPECT_EQ(masker.mask("card 4111 1111 1111 1111 charged"), "card [CREDIT_CARD] charged");
+
+    // Digits following the card number are not part of it
+    EXPECT_EQ(masker.mask("card 4111 1111 1111 1111 5 items"), "card [CREDIT_CARD] 5 items");
+    EXPECT_EQ(masker.mask("card 4111-1111-1111-1111-2024"), "card [CREDIT_CARD]-2024");
+    EXPECT_EQ(masker.mask("user=bob action=login"), "user=[USERNAME] action=login");
+    EXPECT_EQ(masker.mask("logon by CORP\\jdoe failed"), "logon by CORP\\[USERNAME] failed");
+    EXPECT_EQ(masker.mask("resolved dc01.corp.example.com and www.nvidia.com"),
+              "resolved [HOSTNAME] and [HOSTNAME]");
+}
+
+TEST_F(TestPiiUtil, IgnoresLookalikes)
+{
+    PiiMasker masker(PiiEntity::all());
+
+    // Version strings, times, MAC addresses, failed Luhn checks and file names are left alone
+    for (const std::string text : {"version 1.2.3.4.5",
+                                   "at 12:30:45",
+                                   "mac 00:1a:2b:3c:4d:5e",
+                                   "order 4111111111111112",
+                                   "opened report.txt",
+                                   "C:\\Windows\\System32",
+                                   "account_id=42"})
+    {
+        EXPECT_EQ(masker.mask(text), text);
+    }
+}
+
+TEST_F(TestPiiUtil, SelectedEntities)
+{
+    PiiMasker masker({PiiEntity::IpAddress});
+
+    EXPECT_EQ(masker.mask("alice@example.com from 10.0.0.1"), "alice@example.com from [IP_ADDRESS]");
+}
+
+TEST_F(TestPiiUtil, LiteralsAndPatterns)
+{
+    PiiMasker masker({},
+                     {{"svc_backup", "USERNAME"}, {"buildhost", "HOSTNAME"}},
+                     {{"EMP-[0-9]{6}", "EMPLOYEE_ID"}});
+
+    EXPECT_EQ(masker.mask("svc_backup ran on buildhost for EMP-123456"),
+              "[USERNAME] ran on [HOSTNAME] for [EMPLOYEE_ID]");
+
+    // Literals only match on word boundaries
+    EXPECT_EQ(masker.mask("svc_backup2 buildhosts"), "svc_backup2 buildhosts");
+
+    EXPECT_THROW(PiiMasker({}, {}, {{"EMP-(", "EMPLOYEE_ID"}}), std::invalid_argument);
+}
+
+TEST_F(TestPiiUtil, PatternsOnLongLines)
+{
+    PiiMasker masker({}, {}, {{"token=[^ ]+", "TOKEN"}, {"\\bEMP-[0-9]{6}\\b", "EMPLOYEE_ID"}});
+
+    // Matching takes time linear in the length of the line, without recursing for each byte of a match
+    const std::string token(50000, 'x');
+    EXPECT_EQ(masker.mask("token=" + token + " EMP-123456 EMP-1234567 EMP-654321"),
+              "[TOKEN] [EMPLOYEE_ID] EMP-1234567 [EMPLOYEE_ID]");
+}
+
+TEST_F(TestPiiUtil, Pseudonymize)
+{
+    PiiMasker masker({PiiEntity::Email}, {}, {}, true, "secret");
+    PiiMasker other_key({PiiEntity::Email}, {}, {}, true, "other");
+
+    auto first  = masker.mask("alice@example.com");
+    auto second = masker.mask("to: alice@example.com");
+
+    EXPECT_EQ(first.substr(0, 6), "EMAIL_");
+    EXPECT_EQ(first.size(), 6 + 16);
+
+    // Stable for a given key, but different across keys and values
+    EXPECT_EQ(second, "to: " + first);
+    EXPECT_NE(other_key.mask("alice@example.com"), first);
+    EXPECT_NE(masker.mask("bob@example.com"), first);
+
+    EXPECT_THROW(PiiMasker({PiiEntity::Email}, {}, {}, true, ""), std::invalid_argument);
+}
+
+TEST_F(TestPiiUtil, UnknownEntity)
+{
+    EXPECT_THROW(PiiMasker({"PHONE"}), std::invalid_argument);
+}
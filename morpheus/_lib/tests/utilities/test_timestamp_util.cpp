@@ -0,0 +1,178 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/utilities/timestamp_util.hpp"  // for TimestampUtil, TimestampFormat
+
+#include <gtest/gtest.h>
+
+#include <cstdint>  // for int64_t
+#include <string_view>
+#include <tuple>  // for make_tuple
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+namespace {
+// 2024-03-01T12:34:56Z
+constexpr std::int64_t ExpectedSeconds = 1709296496;
+constexpr std::int64_t ExpectedNanos   = ExpectedSeconds * 1'000'000'000;
+
+std::int64_t parse_any(std::string_view value)
+{
+    std::int64_t nanos = TimestampUtil::NaT;
+    EXPECT_TRUE(TimestampUtil::parse_any(value, nanos, 2024)) << value;
+    return nanos;
+}
+}  // namespace
+
+TEST_CLASS(TimestampUtil);
+
+TEST_F(TestTimestampUtil, DaysFromCivil)
+{
+    EXPECT_EQ(TimestampUtil::days_from_civil(1970, 1, 1), 0);
+    EXPECT_EQ(TimestampUtil::days_from_civil(2000, 3, 1), 11017);
+    EXPECT_EQ(TimestampUtil::days_from_civil(1969, 12, 31), -1);
+}
+
+TEST_F(TestTimestampUtil, CivilFromDays)
+{
+    std::int64_t year;
+    unsigned month;
+    unsigned day;
+
+    TimestampUtil::civil_from_days(0, year, month, day);
+    EXPECT_EQ(std::make_tuple(year, month, day), std::make_tuple(1970, 1u, 1u));
+
+    TimestampUtil::civil_from_days(11017, year, month, day);
+    EXPECT_EQ(std::make_tuple(year, month, day), std::make_tuple(2000, 3u, 1u));
+
+    TimestampUtil::civil_from_days(-1, year, month, day);
+    EXPECT_EQ(std::make_tuple(year, month, day), std::make_tuple(1969, 12u, 31u));
+
+    // Round trips through the leap day
+    for (std::int64_t days = 18300; days < 18400; ++days)
+    {
+        TimestampUtil::civil_from_days(days, year, month, day);
+        EXPECT_EQ(TimestampUtil::days_from_civil(year, month, day), days);
+    }
+}
+
+TEST_F(TestTimestampUtil, Classify)
+{
+    EXPECT_EQ(TimestampUtil::classify("2024-03-01T12:34:56.789+02:00"), TimestampFormat::Iso8601);
+    EXPECT_EQ(TimestampUtil::classify("2024-03-01"), TimestampFormat::Iso8601);
+    EXPECT_EQ(TimestampUtil::classify("20240102"), TimestampFormat::Iso8601);
+    EXPECT_EQ(TimestampUtil::classify("Fri, 01 Mar 2024 12:34:56 +0200"), TimestampFormat::Rfc2822);
+    EXPECT_EQ(TimestampUtil::classify("01/Mar/2024:12:34:56 +0200"), TimestampFormat::CommonLog);
+    EXPECT_EQ(TimestampUtil::classify("Mar  1 12:34:56"), TimestampFormat::Syslog);
+    EXPECT_EQ(TimestampUtil::classify("1709296496"), TimestampFormat::EpochSeconds);
+    EXPECT_EQ(TimestampUtil::classify("1709296496.5"), TimestampFormat::EpochSeconds);
+    EXPECT_EQ(TimestampUtil::classify("20241301"), TimestampFormat::EpochSeconds);
+    EXPECT_EQ(TimestampUtil::classify("1709296496789"), TimestampFormat::EpochMillis);
+    EXPECT_EQ(TimestampUtil::classify("1709296496789000"), TimestampFormat::EpochMicros);
+    EXPECT_EQ(TimestampUtil::classify("1709296496789000000"), TimestampFormat::EpochNanos);
+    EXPECT_EQ(TimestampUtil::classify("133537700960000000"), TimestampFormat::FileTime);
+    EXPECT_EQ(TimestampUtil::classify("0x01DA6BD4DDD7D800"), TimestampFormat::FileTime);
+    EXPECT_EQ(TimestampUtil::classify("not a timestamp"), TimestampFormat::Unknown);
+    EXPECT_EQ(TimestampUtil::classify(""), TimestampFormat::Unknown);
+}
+
+TEST_F(TestTimestampUtil, ParseAnyNormalizesToUtc)
+{
+    EXPECT_EQ(parse_any("2024-03-01T12:34:56Z"), ExpectedNanos);
+    EXPECT_EQ(parse_any("2024-03-01T14:34:56+02:00"), ExpectedNanos);
+    EXPECT_EQ(parse_any("2024-03-01 07:34:56-0500"), ExpectedNanos);
+    EXPECT_EQ(parse_any("2024-03-01 12:34:56 UTC"), ExpectedNanos);
+    EXPECT_EQ(parse_any(" 2024/3/1 12:34:56 "), ExpectedNanos);
+    EXPECT_EQ(parse_any("2024-03-01T12:34:56.123456789Z"), ExpectedNanos + 123456789);
+    EXPECT_EQ(parse_any("2024-03-01T12:34:56,5"), ExpectedNanos + 500000000);
+    EXPECT_EQ(parse_any("Fri, 01 Mar 2024 14:34:56 +0200"), ExpectedNanos);
+    EXPECT_EQ(parse_any("1 Mar 2024 12:34:56 GMT"), ExpectedNanos);
+    EXPECT_EQ(parse_any("[01/Mar/2024:07:34:56 -0500]"), ExpectedNanos);
+    EXPECT_EQ(parse_any("Mar  1 12:34:56"), ExpectedNanos);
+    EXPECT_EQ(parse_any("1709296496"), ExpectedNanos);
+    EXPECT_EQ(parse_any("1709296496.25"), ExpectedNanos + 250000000);
+    EXPECT_EQ(parse_any("1709296496000"), ExpectedNanos);
+    EXPECT_EQ(parse_any("1709296496000000"), ExpectedNanos);
+    EXPECT_EQ(parse_any("1709296496000000000"), ExpectedNanos);
+    EXPECT_EQ(parse_any("133537700960000000"), ExpectedNanos);
+    EXPECT_EQ(parse_any("0x01DA6BD4DDD7D800"), ExpectedNanos);
+    EXPECT_EQ(parse_any("-86400"), -86400LL * 1'000'000'000);
+
+    // Eight digits are a basic ISO 8601 date when they form a valid date, otherwise epoch seconds
+    EXPECT_EQ(parse_any("20240301"), TimestampUtil::days_from_civil(2024, 3, 1) * 86400 * 1'000'000'000);
+    EXPECT_EQ(parse_any("20240230"), 20240230LL * 1'000'000'000);
+}
+
+TEST_F(TestTimestampUtil, ParseStrict)
+{
+    std::int64_t nanos = 0;
+
+    EXPECT_TRUE(TimestampUtil::parse("2024-03-01T12:34:56Z", TimestampFormat::Iso8601, nanos));
+    EXPECT_EQ(nanos, ExpectedNanos);
+    EXPECT_TRUE(TimestampUtil::parse("2024-03-01", TimestampFormat::Iso8601, nanos));
+    EXPECT_EQ(nanos, TimestampUtil::days_from_civil(2024, 3, 1) * 86400 * 1'000'000'000);
+    EXPECT_TRUE(TimestampUtil::parse("20240301", TimestampFormat::Iso8601, nanos));
+    EXPECT_EQ(nanos, TimestampUtil::days_from_civil(2024, 3, 1) * 86400 * 1'000'000'000);
+    EXPECT_FALSE(TimestampUtil::parse("20240230", TimestampFormat::Iso8601, nanos));
+
+    // Variants only accepted by the general parser
+    EXPECT_FALSE(TimestampUtil::parse("2024/03/01 12:34:56", TimestampFormat::Iso8601, nanos));
+    EXPECT_FALSE(TimestampUtil::parse(" 2024-03-01T12:34:56Z", TimestampFormat::Iso8601, nanos));
+    EXPECT_FALSE(TimestampUtil::parse("2024-03-01T12:34Z", TimestampFormat::Iso8601, nanos));
+
+    // The epoch unit must match the number of digits
+    EXPECT_TRUE(TimestampUtil::parse("1709296496789", TimestampFormat::EpochMillis, nanos));
+    EXPECT_EQ(nanos, ExpectedNanos + 789000000);
+    EXPECT_FALSE(TimestampUtil::parse("1709296496", TimestampFormat::EpochMillis, nanos));
+
+    EXPECT_TRUE(TimestampUtil::parse("Mar  1 12:34:56", TimestampFormat::Syslog, nanos, 2024));
+    EXPECT_EQ(nanos, ExpectedNanos);
+    EXPECT_TRUE(TimestampUtil::parse("Dec 31 23:59:59", TimestampFormat::Syslog, nanos, 2023));
+    EXPECT_EQ(nanos, (TimestampUtil::days_from_civil(2024, 1, 1) * 86400 - 1) * 1'000'000'000);
+}
+
+TEST_F(TestTimestampUtil, RejectsInvalid)
+{
+    std::int64_t nanos = 0;
+
+    for (std::string_view value : {"2024-02-30T00:00:00Z",
+                                   "2024-13-01",
+                                   "2024-03-01T24:00:00",
+                                   "2024-03-01T12:34:56+25:00",
+                                   "2024-03-01T12:34:56 junk",
+                                   "3000-01-01",
+                                   "Foo 1 12:34:56",
+                                   "12345678901234567890",
+                                   "1709296496789000000.5"})
+    {
+        EXPECT_FALSE(TimestampUtil::parse_any(value, nanos)) << value;
+    }
+}
+
+TEST_F(TestTimestampUtil, DetectFormat)
+{
+    std::vector<std::string_view> sample{"1709296496", "1709296497", "2024-03-01T12:34:56Z", "", "1709296498"};
+    EXPECT_EQ(TimestampUtil::detect_format(sample), TimestampFormat::EpochSeconds);
+
+    EXPECT_EQ(TimestampUtil::detect_format({"20240102", "20240103", "20240104"}), TimestampFormat::Iso8601);
+
+    EXPECT_EQ(TimestampUtil::detect_format({"garbage", ""}), TimestampFormat::Unknown);
+}
@@ -15,30 +15,52 @@ Module for common utilities and classes in the Morpheus library.
 """
 
 # Export symbols from the morpheus._lib.common module. Users should never be directly importing morpheus._lib
+from morpheus._lib.common import AnomalyScorer
+from morpheus._lib.common import DocumentExtractor
 from morpheus._lib.common import FiberQueue
+from morpheus._lib.common import FileBatchCache
 from morpheus._lib.common import FileTypes
 from morpheus._lib.common import FilterSource
+from morpheus._lib.common import HtmlDocumentConverter
 from morpheus._lib.common import HttpEndpoint
 from morpheus._lib.common import HttpServer
+from morpheus._lib.common import ModelRegistry
+from morpheus._lib.common import PiiMasker
 from morpheus._lib.common import Tensor
+from morpheus._lib.common import TextLengthUnit
+from morpheus._lib.common import TextSplitter
+from morpheus._lib.common import TimestampParser
 from morpheus._lib.common import TypeId
+from morpheus._lib.common import WebFetcher
 from morpheus._lib.common import determine_file_type
+from morpheus._lib.common import normalize_bucket_lengths
 from morpheus._lib.common import read_file_to_df
 from morpheus._lib.common import typeid_is_fully_supported
 from morpheus._lib.common import typeid_to_numpy_str
 from morpheus._lib.common import write_df_to_file
 
 __all__ = [
+    "AnomalyScorer",
     "determine_file_type",
+    "DocumentExtractor",
     "FiberQueue",
+    "FileBatchCache",
     "FileTypes",
     "FilterSource",
+    "HtmlDocumentConverter",
     "HttpEndpoint",
     "HttpServer",
+    "ModelRegistry",
+    "normalize_bucket_lengths",
+    "PiiMasker",
     "read_file_to_df",
     "Tensor",
+    "TextLengthUnit",
+    "TextSplitter",
+    "TimestampParser",
     "typeid_is_fully_supported",
     "typeid_to_numpy_str",
     "TypeId",
+    "WebFetcher",
     "write_df_to_file",
 ]
@@ -14,6 +14,7 @@
 """Morpheus pipeline module for fetching files and emitting them as DataFrames."""
 
 import hashlib
+import io
 import json
 import logging
 import os
@@ -26,6 +27,8 @@ import pandas as pd
 
 import cudf
 
+from morpheus._lib.messages import MessageMeta as CppMessageMeta
+from morpheus.common import FileBatchCache
 from morpheus.common import FileTypes
 from morpheus.io.deserializers import read_file_to_df
 from morpheus.utils.column_info import DataFrameInputSchema
@@ -35,6 +38,10 @@ from morpheus.utils.downloader import Downloader
 
 logger = logging.getLogger(__name__)
 
+# Increment when the way files are parsed changes in a way not captured by the controller's arguments, invalidating the
+# entries of the native file cache
+NATIVE_CACHE_SCHEMA_VERSION = 1
+
 
 def single_object_to_dataframe(file_object: fsspec.core.OpenFile,
                                schema: DataFrameInputSchema,
@@ -105,6 +112,10 @@ class FileToDFController:
         Directory where cache will be stored.
     timestamp_column_name : str
         Name of the timestamp column.
+    native_cache_max_bytes : int, default = 0
+        When greater than zero, the DataFrame parsed from each file is cached individually by the native
+        `FileBatchCache` in `cache_dir/file_cache/files`, up to the given total size. Batches which share files with a
+        previous batch only read the files which aren't cached. When zero, whole batches are cached as pickles.
     """
 
     def __init__(self,
@@ -113,7 +124,8 @@ class FileToDFController:
                  file_type: FileTypes,
                  parser_kwargs: dict,
                  cache_dir: str,
-                 timestamp_column_name: str):
+                 timestamp_column_name: str,
+                 native_cache_max_bytes: int = 0):
 
         self._schema = schema
         self._file_type = file_type
@@ -124,6 +136,91 @@ class FileToDFController:
 
         self._downloader = Downloader()
 
+        self._native_cache = None
+        if (native_cache_max_bytes > 0):
+            self._native_cache = FileBatchCache(os.path.join(self._cache_dir, "files"),
+                                                native_cache_max_bytes,
+                                                schema_version=self._native_cache_schema_version())
+
+    def _native_cache_schema_version(self) -> str:
+        # Everything which affects the DataFrame parsed from an individual file
+        schema_data = {
+            "version": NATIVE_CACHE_SCHEMA_VERSION,
+            "file_type": str(self._file_type),
+            "filter_null": self._filter_null,
+            "parser_kwargs": self._parser_kwargs,
+            "json_columns": self._schema.json_columns,
+            "input_columns": self._schema.input_columns,
+        }
+
+        return hashlib.md5(json.dumps(schema_data, sort_keys=True, default=str).encode()).hexdigest()
+
+    def _download_files(self, file_objects: typing.List[fsspec.core.OpenFile]) -> typing.List[pd.DataFrame]:
+        download_method_func = partial(single_object_to_dataframe,
+                                       file_type=self._file_type,
+                                       schema=self._schema,
+                                       filter_null=self._filter_null,
+                                       parser_kwargs=self._parser_kwargs)
+
+        # Fetch and parse each file, returning one dataframe per file
+        try:
+            dfs = self._downloader.download(file_objects, download_method_func)
+        except Exception:
+            logger.exception("Failed to download logs. Error: ", exc_info=True)
+            raise
+
+        if (dfs is None or len(dfs) == 0):
+            raise ValueError("No logs were downloaded")
+
+        return dfs
+
+    def _get_or_create_dataframes_from_native_cache(
+            self, file_list: fsspec.core.OpenFiles,
+            infos: typing.List[dict]) -> typing.Tuple[typing.List[pd.DataFrame], bool]:
+        dfs: typing.List[pd.DataFrame] = [None] * len(file_list)
+        missing: typing.List[typing.Tuple[int, str]] = []
+
+        for (i, (file_object, info)) in enumerate(zip(file_list, infos)):
+            # Local file systems report `mtime`, object stores `LastModified`
+            modified = info.get("mtime", info.get("LastModified", info.get("created", "")))
+            key = self._native_cache.key(file_object.path, int(info.get("size") or 0), str(modified))
+
+            # The cached Parquet file is parsed on the host, the batch is processed with pandas
+            data = self._native_cache.get_bytes(key)
+            if (data is not None):
+                try:
+                    dfs[i] = pd.read_parquet(io.BytesIO(data))
+                except Exception:
+                    logger.warning("Failed to read file cache. Reading %s again.", file_object.path, exc_info=True)
+
+            if (dfs[i] is None):
+                missing.append((i, key))
+
+        if (len(missing) > 0):
+            downloaded = self._download_files([file_list[i] for (i, _) in missing])
+
+            for ((i, key), df) in zip(missing, downloaded):
+                dfs[i] = df
+
+                try:
+                    self._native_cache.put(key, CppMessageMeta(cudf.from_pandas(df, nan_as_null=False)))
+                except Exception:
+                    logger.warning("Failed to save file cache. Skipping cache for %s.",
+                                   file_list[i].path,
+                                   exc_info=True)
+
+        return (dfs, len(missing) == 0)
+
+    def _process_batch(self, output_df: pd.DataFrame) -> pd.DataFrame:
+        output_df = process_dataframe(df_in=output_df, input_schema=self._schema)
+
+        # Finally sort by timestamp and then reset the index
+        output_df.sort_values(by=[self._timestamp_column_name], inplace=True)
+
+        output_df.reset_index(drop=True, inplace=True)
+
+        return output_df
+
     def _get_or_create_dataframe_from_batch(
             self, file_object_batch: typing.Tuple[fsspec.core.OpenFiles, int]) -> typing.Tuple[cudf.DataFrame, bool]:
 
@@ -135,13 +232,31 @@ class FileToDFController:
 
         file_system: fsspec.AbstractFileSystem = file_list.fs
 
+        infos = None
+        if (self._native_cache is not None):
+            # The cache keys need the output of `info()` as well, which is fetched once per file and hashed the same
+            # way as the default `ukey`
+            infos = [file_system.info(file_object.path) for file_object in file_list]
+            ukeys = [hashlib.sha256(str(info).encode()).hexdigest() for info in infos]
+        else:
+            ukeys = [file_system.ukey(file_object.path) for file_object in file_list]
+
         # Create a list of dictionaries that only contains the information we are interested in hashing. `ukey` just
         # hashes all of the output of `info()` which is perfect
-        hash_data = [{"ukey": file_system.ukey(file_object.path)} for file_object in file_list]
+        hash_data = [{"ukey": ukey} for ukey in ukeys]
 
         # Convert to base 64 encoding to remove - values
         objects_hash_hex = hashlib.md5(json.dumps(hash_data, sort_keys=True).encode()).hexdigest()
 
+        if (self._native_cache is not None):
+            (dfs, cache_hit) = self._get_or_create_dataframes_from_native_cache(file_list, infos)
+
+            output_df = self._process_batch(pd.concat(dfs))
+            output_df["batch_count"] = batch_count
+            output_df["origin_hash"] = objects_hash_hex
+
+            return (output_df, cache_hit)
+
         batch_cache_location = os.path.join(self._cache_dir, "batches", f"{objects_hash_hex}.pkl")
 
         # Return the cache if it exists
@@ -153,32 +268,9 @@ class FileToDFController:
             return (output_df, True)
 
         # Cache miss
-        download_method_func = partial(single_object_to_dataframe,
-                                       file_type=self._file_type,
-                                       schema=self._schema,
-                                       filter_null=self._filter_null,
-                                       parser_kwargs=self._parser_kwargs)
-
-        download_buckets = file_list
+        dfs = self._download_files(file_list)
 
-        # Loop over dataframes and concat into one
-        try:
-            dfs = self._downloader.download(download_buckets, download_method_func)
-        except Exception:
-            logger.exception("Failed to download logs. Error: ", exc_info=True)
-            raise
-
-        if (dfs is None or len(dfs) == 0):
-            raise ValueError("No logs were downloaded")
-
-        output_df: pd.DataFrame = pd.concat(dfs)
-
-        output_df = process_dataframe(df_in=output_df, input_schema=self._schema)
-
-        # Finally sort by timestamp and then reset the index
-        output_df.sort_values(by=[self._timestamp_column_name], inplace=True)
-
-        output_df.reset_index(drop=True, inplace=True)
+        output_df = self._process_batch(pd.concat(dfs))
 
         # Save dataframe to cache future runs
         os.makedirs(os.path.dirname(batch_cache_location), exist_ok=True)
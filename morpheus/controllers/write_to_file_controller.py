@@ -40,9 +40,17 @@ class WriteToFileController:
         Flag to indicate whether to include the index column in the output.
     flush : bool
         Flag to indicate whether to flush the output file after writing.
+    na_rep : str
+        String written for null values of CSV files.
     """
 
-    def __init__(self, filename: str, overwrite: bool, file_type: FileTypes, include_index_col: bool, flush: bool):
+    def __init__(self,
+                 filename: str,
+                 overwrite: bool,
+                 file_type: FileTypes,
+                 include_index_col: bool,
+                 flush: bool,
+                 na_rep: str = ""):
         self._output_file = filename
         self._overwrite = overwrite
 
@@ -64,6 +72,7 @@ class WriteToFileController:
         self._is_first = True
         self._include_index_col = include_index_col
         self._flush = flush
+        self._na_rep = na_rep
 
     @property
     def output_file(self):
@@ -100,13 +109,21 @@ class WriteToFileController:
         """
         return self._flush
 
+    @property
+    def na_rep(self):
+        """
+        Get the string written for null values of CSV files.
+        """
+        return self._na_rep
+
     def _convert_to_strings(self, df: DataFrameType):
         if self._file_type in (FileTypes.JSON, 'JSON'):
             output_strs = serializers.df_to_json(df, include_index_col=self._include_index_col)
         elif self._file_type in (FileTypes.CSV, 'CSV'):
             output_strs = serializers.df_to_csv(df,
                                                 include_header=self._is_first,
-                                                include_index_col=self._include_index_col)
+                                                include_index_col=self._include_index_col,
+                                                na_rep=self._na_rep)
             self._is_first = False
         else:
             raise NotImplementedError(f"Unknown file type: {self._file_type}")
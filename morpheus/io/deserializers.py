@@ -77,6 +77,12 @@ def _read_file_to_df_py(*,
     elif (mode == FileTypes.PARQUET):
         df = df_class.read_parquet(file_name, **kwargs)
 
+    elif (mode == FileTypes.AVRO):
+        if (df_type != "cudf"):
+            raise ValueError("Avro files can only be read into a cudf DataFrame")
+
+        df = cudf.read_avro(file_name, **kwargs)
+
     else:
         assert False, f"Unsupported file type mode: {mode}"
 
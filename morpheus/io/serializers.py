@@ -28,7 +28,7 @@ from morpheus.config import CppConfig
 from morpheus.utils.type_aliases import DataFrameType
 
 
-def df_to_stream_csv(df: DataFrameType, stream: IOBase, include_header=False, include_index_col=True):
+def df_to_stream_csv(df: DataFrameType, stream: IOBase, include_header=False, include_index_col=True, na_rep=""):
     """
     Serializes a DataFrame into CSV into the provided stream object.
 
@@ -42,8 +42,10 @@ def df_to_stream_csv(df: DataFrameType, stream: IOBase, include_header=False, in
         Whether or not to include the header, by default False.
     include_index_col: bool, optional
         Write out the index as a column, by default True.
+    na_rep : str, optional
+        String written for null values, by default "".
     """
-    df.to_csv(stream, header=include_header, index=include_index_col)
+    df.to_csv(stream, header=include_header, index=include_index_col, na_rep=na_rep)
 
     return stream
 
@@ -87,7 +89,8 @@ def df_to_stream_parquet(df: DataFrameType, stream: IOBase):
 def df_to_csv(df: DataFrameType,
               include_header=False,
               strip_newlines=False,
-              include_index_col=True) -> typing.List[str]:
+              include_index_col=True,
+              na_rep="") -> typing.List[str]:
     """
     Serializes a DataFrame into CSV and returns the serialized output seperated by lines.
 
@@ -101,6 +104,8 @@ def df_to_csv(df: DataFrameType,
         Whether or not to strip the newline characters from each string, by default False.
     include_index_col: bool, optional
         Write out the index as a column, by default True.
+    na_rep : str, optional
+        String written for null values, by default "".
 
     Returns
     -------
@@ -109,7 +114,11 @@ def df_to_csv(df: DataFrameType,
     """
     str_buf = StringIO()
 
-    df_to_stream_csv(df=df, stream=str_buf, include_header=include_header, include_index_col=include_index_col)
+    df_to_stream_csv(df=df,
+                     stream=str_buf,
+                     include_header=include_header,
+                     include_index_col=include_index_col,
+                     na_rep=na_rep)
 
     # Start from beginning
     str_buf.seek(0)
@@ -24,6 +24,8 @@ from morpheus._lib.llm import LLMNodeBase
 from morpheus._lib.llm import LLMNodeRunner
 from morpheus._lib.llm import LLMTask
 from morpheus._lib.llm import LLMTaskHandler
+from morpheus._lib.llm import StructuredOutputError
+from morpheus._lib.llm import StructuredOutputNode
 
 __all__ = [
     "InputMap",
@@ -35,4 +37,6 @@ __all__ = [
     "LLMNodeRunner",
     "LLMTask",
     "LLMTaskHandler",
+    "StructuredOutputError",
+    "StructuredOutputNode",
 ]
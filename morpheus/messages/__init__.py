@@ -20,6 +20,7 @@ Message classes, which contain data being transfered between pipeline stages
 
 from morpheus._lib.messages import ControlMessage
 from morpheus._lib.messages import DataLoaderRegistry
+from morpheus._lib.messages import MessageAttachment
 from morpheus._lib.messages import RawPacketMessage
 from morpheus.messages.memory.tensor_memory import TensorMemory
 from morpheus.messages.memory.inference_memory import InferenceMemory
@@ -49,6 +50,7 @@ __all__ = [
     "InferenceMemoryAE",
     "InferenceMemoryFIL",
     "InferenceMemoryNLP",
+    "MessageAttachment",
     "MessageBase",
     "MessageMeta",
     "MultiAEMessage",
@@ -43,6 +43,7 @@ def write_to_file(builder: mrc.Builder):
             - file_type (FileTypes): Type of file to write; Example: `FileTypes.CSV`; Default: `FileTypes.Auto`
             - flush (bool): If true, flush the file after each write; Example: `false`; Default: false
             - include_index_col (bool): If true, include the index column; Example: `false`; Default: true
+            - na_rep (str): String written for null values of CSV files; Example: `NaN`; Default: ""
             - overwrite (bool): If true, overwrite the file if it exists; Example: `true`; Default: false
     """
     config = builder.get_current_module_config()
@@ -52,12 +53,14 @@ def write_to_file(builder: mrc.Builder):
     flush = config.get("flush", False)
     file_type = config.get("file_type", FileTypes.Auto)
     include_index_col = config.get("include_index_col", True)
+    na_rep = config.get("na_rep", "")
 
     controller = WriteToFileController(filename=filename,
                                        overwrite=overwrite,
                                        file_type=file_type,
                                        include_index_col=include_index_col,
-                                       flush=flush)
+                                       flush=flush,
+                                       na_rep=na_rep)
 
     node = builder.make_node(WRITE_TO_FILE, mrc.core.operators.build(controller.node_fn))
 
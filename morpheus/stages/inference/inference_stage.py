@@ -23,9 +23,11 @@ from mrc.core import operators as ops
 
 import cudf
 
+import morpheus._lib.stages as _stages
 # pylint: disable=morpheus-incorrect-lib-from-import
 from morpheus._lib.messages import MessageMeta as CppMessageMeta
 from morpheus.config import Config
+from morpheus.config import CppConfig
 from morpheus.messages import ControlMessage
 from morpheus.messages import InferenceMemoryNLP
 from morpheus.messages import MessageMeta
@@ -157,6 +159,11 @@ class InferenceStage(MultiMessageStage):
     implementation by setting `use_cpp` to True in your pipeline configuration. See developer documentation for
     more details.
 
+    Stages whose workers only operate on the inputs of the batch they are given can implement
+    `supports_native_worker_pool` to return True. When `use_cpp` is True and no C++ inference node is available, the
+    batching, queueing and response assembly are then performed by a native worker pool, with each of the
+    `num_threads` workers driving its own `InferenceWorker` instance.
+
     Parameters
     ----------
     c : `morpheus.config.Config`
@@ -175,6 +182,8 @@ class InferenceStage(MultiMessageStage):
 
         self._max_batch_size = c.model_max_batch_size
 
+        self._worker_pool_node = None
+
         # Mark these stages to log timestamps if requested
         self._should_log_timestamps = True
 
@@ -203,6 +212,24 @@ class InferenceStage(MultiMessageStage):
         # Default to False unless derived classes override this value
         return False
 
+    def supports_native_worker_pool(self) -> bool:
+        """
+        Indicates whether the inference workers of this stage can be driven by the native worker pool. Workers must
+        accept the C++ `MultiInferenceMessage` and must not rely on `build_output_message` being called.
+        """
+        # Default to False unless derived classes override this value
+        return False
+
+    def get_worker_pool_stats(self) -> typing.Optional[dict]:
+        """
+        Returns the queue depth and worker utilization statistics of the native worker pool, or `None` when the stage
+        is not using the native worker pool.
+        """
+        if (self._worker_pool_node is None):
+            return None
+
+        return self._worker_pool_node.get_stats()
+
     @abstractmethod
     def _get_inference_worker(self, inf_queue: ProducerConsumerQueue) -> InferenceWorker:
         """
@@ -302,6 +329,28 @@ class InferenceStage(MultiMessageStage):
 
         if (self._build_cpp_node()):
             node = self._get_cpp_inference_node(builder)
+        elif (CppConfig.get_should_use_cpp() and self.supports_native_worker_pool()):
+            worker_factory = partial(self._get_inference_worker, self._inf_queue)
+
+            if (self._schema.input_type == ControlMessage):
+                node = _stages.InferenceWorkerPoolControlMessageStage(builder,
+                                                                      self.unique_name,
+                                                                      worker_factory,
+                                                                      num_workers=self._thread_count,
+                                                                      max_batch_size=self._max_batch_size)
+            else:
+                node = _stages.InferenceWorkerPoolMultiMessageStage(builder,
+                                                                    self.unique_name,
+                                                                    worker_factory,
+                                                                    num_workers=self._thread_count,
+                                                                    max_batch_size=self._max_batch_size)
+
+            self._worker_pool_node = node
+
+            # The pool owns the worker threads, leave `pe_count` at its default
+            builder.make_edge(input_node, node)
+
+            return node
         else:
             node = builder.make_node(self.unique_name, ops.build(py_inference_fn))
 
@@ -319,6 +368,9 @@ class InferenceStage(MultiMessageStage):
         for worker in self._workers:
             worker.stop()
 
+        if (self._worker_pool_node is not None):
+            self._worker_pool_node.shutdown()
+
         # Now stop the _inf_queue to unblock workers
         self._inf_queue.close()
 
@@ -334,6 +386,9 @@ class InferenceStage(MultiMessageStage):
         for worker in self._workers:
             await worker.join()
 
+        if (self._worker_pool_node is not None):
+            self._worker_pool_node.shutdown()
+
         return await super().join()
 
     @staticmethod
@@ -128,6 +128,9 @@ class PyTorchInferenceStage(InferenceStage):
         self._config = c
         self._model_filename = str(model_filename)
 
+    def supports_native_worker_pool(self) -> bool:
+        return True
+
     def _get_inference_worker(self, inf_queue: ProducerConsumerQueue) -> InferenceWorker:
 
         return _PyTorchInferenceWorker(inf_queue, self._config, model_filename=self._model_filename)
@@ -686,6 +686,10 @@ class TritonInferenceStage(InferenceStage):
         which will be inroduced as:
 
             inout_mapping={"mask": "input_mask", "output": "probs"}
+    dedup_cache_size : int, default = 0
+        Maximum number of row hashes kept in a cross-batch cache of model outputs. Only used by the C++
+        implementation for messages which have been processed by `DeduplicateStage`, rows found in the cache are not
+        sent to Triton. A value of 0 disables the cache.
     """
 
     _INFERENCE_WORKER_DEFAULT_INOUT_MAPPING = {
@@ -712,7 +716,8 @@ class TritonInferenceStage(InferenceStage):
                  needs_logits: bool = None,
                  inout_mapping: dict[str, str] = None,
                  input_mapping: dict[str, str] = None,
-                 output_mapping: dict[str, str] = None):
+                 output_mapping: dict[str, str] = None,
+                 dedup_cache_size: int = 0):
         super().__init__(c)
 
         self._config = c
@@ -753,6 +758,7 @@ class TritonInferenceStage(InferenceStage):
         self._input_mapping = input_mapping_
         self._output_mapping = output_mapping_
         self._needs_logits = needs_logits
+        self._dedup_cache_size = dedup_cache_size
 
     def supports_cpp_node(self) -> bool:
         # Get the value from the worker class
@@ -790,7 +796,8 @@ class TritonInferenceStage(InferenceStage):
                                                   self._needs_logits,
                                                   self._force_convert_inputs,
                                                   self._input_mapping,
-                                                  self._output_mapping)
+                                                  self._output_mapping,
+                                                  self._dedup_cache_size)
 
         return _stages.InferenceClientStageMM(builder,
                                               self.unique_name,
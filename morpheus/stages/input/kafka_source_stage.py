@@ -37,6 +37,11 @@ from morpheus.pipeline.stage_schema import StageSchema
 logger = logging.getLogger(__name__)
 
 
+METADATA_FIELDS = ("key", "topic", "partition", "offset", "timestamp", "timestamp_type")
+
+PAYLOAD_FORMATS = ("json", "avro", "protobuf")
+
+
 class AutoOffsetReset(Enum):
     """The supported offset options in Kafka"""
     EARLIEST = "earliest"
@@ -78,6 +83,42 @@ class KafkaSourceStage(PreallocatorMixin, SingleOutputSource):
         Stops ingesting after emitting `stop_after` records (rows in the dataframe). Useful for testing. Disabled if `0`
     async_commits: bool, default = True
         Enable commits to be performed asynchronously. Ignored if `disable_commit` is `True`.
+    metadata_columns : typing.List[str], default = None
+        Fields of the Kafka records added to each message as columns named `{column_prefix}{field}`, any of `key`,
+        `topic`, `partition`, `offset`, `timestamp` and `timestamp_type`. The timestamp is either the time the record
+        was created or appended to the log by the broker, depending on the configuration of the topic, and
+        `timestamp_type` holds either `'create_time'` or `'log_append_time'`.
+    header_columns : typing.List[str], default = None
+        Headers of the Kafka records added to each message as string columns named `{column_prefix}header_{name}`,
+        null for records without the header. Together with the `key` column this allows routing messages without
+        parsing their payload.
+    column_prefix : str, default = "kafka_"
+        Prepended to the names of the metadata and header columns.
+    key_filter : typing.List[str], default = None
+        Only records with one of these keys are emitted, the other records are skipped before their payload is parsed.
+        Skipped records are still committed.
+    header_filters : typing.Dict[str, typing.List[str]], default = None
+        Only records holding one of the accepted values of every header are emitted, the other records are skipped
+        before their payload is parsed. Skipped records are still committed.
+    payload_format : str, default = "json"
+        Format of the payloads, one of `json`, `avro` and `protobuf`. Avro and Protobuf payloads are decoded straight
+        into columns by the C++ implementation, payloads which fail to decode are logged and skipped. Nested records
+        and messages are flattened into columns named `{parent}.{field}`, while arrays, maps and repeated fields are
+        written as JSON strings.
+    schema_files : typing.Dict[int, str], default = None
+        Files holding the Avro schema (`.avsc`) or Protobuf schema (`.proto`) of each schema id.
+    schema_registry : typing.Callable[[int], str], default = None
+        Called with a schema id to fetch the text of its schema, for instance from a Confluent schema registry, instead
+        of reading `schema_files`. Each schema is fetched once.
+    confluent_framing : bool, default = True
+        Whether the payloads follow the Confluent wire format, starting with a magic byte and the id of their schema,
+        followed by the message indices for Protobuf. Otherwise every payload is a bare record of the schema
+        `schema_id`.
+    schema_id : int, default = 0
+        Schema of the payloads when `confluent_framing` is disabled.
+    message_name : str, default = None
+        Protobuf message of the payloads when `confluent_framing` is disabled, defaults to the first message of the
+        schema.
     """
 
     def __init__(self,
@@ -91,9 +132,32 @@ class KafkaSourceStage(PreallocatorMixin, SingleOutputSource):
                  disable_pre_filtering: bool = False,
                  auto_offset_reset: AutoOffsetReset = AutoOffsetReset.LATEST,
                  stop_after: int = 0,
-                 async_commits: bool = True):
+                 async_commits: bool = True,
+                 metadata_columns: typing.List[str] = None,
+                 header_columns: typing.List[str] = None,
+                 column_prefix: str = "kafka_",
+                 key_filter: typing.List[str] = None,
+                 header_filters: typing.Dict[str, typing.List[str]] = None,
+                 payload_format: str = "json",
+                 schema_files: typing.Dict[int, str] = None,
+                 schema_registry: typing.Callable[[int], str] = None,
+                 confluent_framing: bool = True,
+                 schema_id: int = 0,
+                 message_name: str = None):
         super().__init__(config)
 
+        if (payload_format not in PAYLOAD_FORMATS):
+            raise ValueError(f"Unknown payload format '{payload_format}', must be one of {PAYLOAD_FORMATS}")
+
+        schema_files = {int(schema): filename for (schema, filename) in (schema_files or {}).items()}
+        if (payload_format != "json" and len(schema_files) == 0 and schema_registry is None):
+            raise ValueError(f"Payload format '{payload_format}' requires either schema_files or a schema_registry")
+
+        metadata_columns = list(metadata_columns or [])
+        unknown_columns = [field for field in metadata_columns if field not in METADATA_FIELDS]
+        if (len(unknown_columns) > 0):
+            raise ValueError(f"Unknown Kafka metadata columns {unknown_columns}, must be one of {METADATA_FIELDS}")
+
         if (input_topic is None):
             input_topic = ["test_pcap"]
 
@@ -123,6 +187,22 @@ class KafkaSourceStage(PreallocatorMixin, SingleOutputSource):
         self._disable_pre_filtering = disable_pre_filtering
         self._stop_after = stop_after
         self._async_commits = async_commits
+        self._metadata_columns = metadata_columns
+        self._header_columns = list(header_columns or [])
+        self._column_prefix = column_prefix
+        self._key_filter = list(key_filter or [])
+
+        # A single accepted value may be given as a string, as is the case from the command line
+        self._header_filters = {
+            name: [values] if isinstance(values, str) else list(values)
+            for (name, values) in (header_filters or {}).items()
+        }
+        self._payload_format = payload_format
+        self._schema_files = schema_files
+        self._schema_registry = schema_registry
+        self._confluent_framing = confluent_framing
+        self._schema_id = schema_id
+        self._message_name = message_name or ""
         self._client = None
 
         # Flag to indicate whether or not we should stop
@@ -154,23 +234,93 @@ class KafkaSourceStage(PreallocatorMixin, SingleOutputSource):
 
         return super().stop()
 
+    def _accept_record(self, msg: ck.Message) -> bool:
+        if (len(self._key_filter) > 0):
+            key = msg.key()
+            if (key is None or key.decode("utf-8", errors="replace") not in self._key_filter):
+                return False
+
+        if (len(self._header_filters) > 0):
+            headers = self._get_headers(msg)
+            for (name, values) in self._header_filters.items():
+                if (headers.get(name) not in values):
+                    return False
+
+        return True
+
+    @staticmethod
+    def _get_headers(msg: ck.Message) -> dict[str, str]:
+        # The last value of a repeated header wins, the same as the C++ implementation
+        headers = {}
+        for (name, value) in msg.headers() or []:
+            headers[name] = None if value is None else value.decode("utf-8", errors="replace")
+
+        return headers
+
+    def _add_metadata_columns(self, df: cudf.DataFrame, records: list[ck.Message]):
+        if (len(self._metadata_columns) == 0 and len(self._header_columns) == 0):
+            return
+
+        if (len(df) != len(records)):
+            raise RuntimeError(f"Parsed {len(df)} rows from {len(records)} records, metadata columns require one row "
+                               "each")
+
+        timestamp_types = {ck.TIMESTAMP_CREATE_TIME: "create_time", ck.TIMESTAMP_LOG_APPEND_TIME: "log_append_time"}
+
+        for field in self._metadata_columns:
+            if (field == "key"):
+                values = [None if msg.key() is None else msg.key().decode("utf-8", errors="replace") for msg in records]
+                series = cudf.Series(values, dtype="str")
+            elif (field == "topic"):
+                series = cudf.Series([msg.topic() for msg in records], dtype="str")
+            elif (field == "partition"):
+                series = cudf.Series([msg.partition() for msg in records], dtype="int32")
+            elif (field == "offset"):
+                series = cudf.Series([msg.offset() for msg in records], dtype="int64")
+            elif (field == "timestamp"):
+                values = [
+                    None if msg.timestamp()[0] == ck.TIMESTAMP_NOT_AVAILABLE else msg.timestamp()[1] for msg in records
+                ]
+                series = cudf.Series(values, dtype="int64").astype("datetime64[ms]")
+            else:
+                series = cudf.Series([timestamp_types.get(msg.timestamp()[0]) for msg in records], dtype="str")
+
+            df[self._column_prefix + field] = series
+
+        for header in self._header_columns:
+            values = [self._get_headers(msg).get(header) for msg in records]
+            df[f"{self._column_prefix}header_{header}"] = cudf.Series(values, dtype="str")
+
     def _process_batch(self, consumer, batch):
         message_meta = None
         if len(batch):
             buffer = StringIO()
 
+            # Line breaks are only allowed between JSON tokens, the metadata columns need each record on a single
+            # line. Otherwise a record may hold several JSON lines, each of which is a row.
+            single_line = len(self._metadata_columns) > 0 or len(self._header_columns) > 0
+
+            records = []
             for msg in batch:
                 payload = msg.value()
-                if payload is not None:
-                    buffer.write(payload.decode("utf-8"))
+                if payload is not None and len(payload) > 0 and self._accept_record(msg):
+                    payload = payload.decode("utf-8")
+                    if single_line:
+                        payload = payload.replace("\r", " ").replace("\n", " ")
+
+                    buffer.write(payload)
                     buffer.write("\n")
+                    records.append(msg)
 
             df = None
             try:
-                buffer.seek(0)
-                df = cudf.io.read_json(buffer, engine='cudf', lines=True, orient='records')
+                if (len(records) > 0):
+                    buffer.seek(0)
+                    df = cudf.io.read_json(buffer, engine='cudf', lines=True, orient='records')
+                    self._add_metadata_columns(df, records)
             except Exception as e:
                 logger.error("Error parsing payload into a dataframe : %s", e)
+                df = None
             finally:
                 if (not self._disable_commit):
                     for msg in batch:
@@ -248,12 +398,27 @@ class KafkaSourceStage(PreallocatorMixin, SingleOutputSource):
                                               self._disable_commit,
                                               self._disable_pre_filtering,
                                               self._stop_after,
-                                              self._async_commits)
+                                              self._async_commits,
+                                              metadata_columns=self._metadata_columns,
+                                              header_columns=self._header_columns,
+                                              column_prefix=self._column_prefix,
+                                              key_filter=self._key_filter,
+                                              header_filters=self._header_filters,
+                                              payload_format=self._payload_format,
+                                              schema_files=self._schema_files,
+                                              schema_registry=self._schema_registry,
+                                              confluent_framing=self._confluent_framing,
+                                              schema_id=self._schema_id,
+                                              message_name=self._message_name)
 
             # Only use multiple progress engines with C++. The python implementation will duplicate messages with
             # multiple threads
             source.launch_options.pe_count = self._max_concurrent
         else:
+            if (self._payload_format != "json"):
+                raise RuntimeError(f"The '{self._payload_format}' payload format is only supported by the C++ "
+                                   "implementation")
+
             source = builder.make_source(self.unique_name, self._source_generator)
 
         return source
@@ -13,16 +13,22 @@
 # limitations under the License.
 
 import logging
+from functools import partial
 
 import mrc
 
+import morpheus._lib.stages as _stages
 from morpheus.cli import register_stage
+from morpheus.common import WebFetcher
 from morpheus.config import Config
+from morpheus.controllers.rss_controller import RSSController
 from morpheus.messages import MessageMeta
 from morpheus.modules.input.rss_source import RSSSourceLoaderFactory
 from morpheus.pipeline.preallocator_mixin import PreallocatorMixin
 from morpheus.pipeline.single_output_source import SingleOutputSource
 from morpheus.pipeline.stage_schema import StageSchema
+from morpheus.utils.http_utils import fetch_with_requests
+from morpheus.utils.http_utils import make_fallback_session
 
 logger = logging.getLogger(__name__)
 
@@ -32,6 +38,10 @@ class RSSSourceStage(PreallocatorMixin, SingleOutputSource):
     """
     Load RSS feed items into a DataFrame.
 
+    When built as a C++ node, the feeds are parsed with a native streaming parser on a pool of threads, `http` feeds
+    are downloaded without holding the GIL and `https` feeds with `requests`. The ids of up to `max_seen_entries`
+    entries are remembered across polls, so that only new entries are emitted.
+
     Parameters
     ----------
     c : morpheus.config.Config
@@ -54,6 +64,8 @@ class RSSSourceStage(PreallocatorMixin, SingleOutputSource):
         Request timeout in secs to fetch the feed.
     strip_markup : bool, optional, default = False
         When true, strip HTML & XML markup from the from the content, summary and title fields.
+    max_seen_entries : int, optional, default = 100000
+        Number of entry ids remembered by the C++ node to skip the entries which were already emitted.
     """
 
     def __init__(self,
@@ -67,7 +79,8 @@ class RSSSourceStage(PreallocatorMixin, SingleOutputSource):
                  cache_dir: str = "./.cache/http",
                  cooldown_interval: int = 600,
                  request_timeout: float = 2.0,
-                 strip_markup: bool = False):
+                 strip_markup: bool = False,
+                 max_seen_entries: int = 100000):
         super().__init__(c)
         self._stop_requested = False
 
@@ -80,6 +93,21 @@ class RSSSourceStage(PreallocatorMixin, SingleOutputSource):
 
             run_indefinitely = False
 
+        if (isinstance(feed_input, str)):
+            feed_input = [feed_input]
+
+        self._feed_input = feed_input
+        self._interval_secs = interval_secs
+        self._stop_after = stop_after
+        self._run_indefinitely = run_indefinitely
+        self._batch_size = batch_size
+        self._enable_cache = enable_cache
+        self._cache_dir = cache_dir
+        self._cooldown_interval = cooldown_interval
+        self._request_timeout = request_timeout
+        self._strip_markup = strip_markup
+        self._max_seen_entries = max_seen_entries
+
         self._module_config = {
             "rss_source": {
                 "feed_input": feed_input,
@@ -109,12 +137,44 @@ class RSSSourceStage(PreallocatorMixin, SingleOutputSource):
         return super().stop()
 
     def supports_cpp_node(self):
-        return False
+        return True
 
     def compute_schema(self, schema: StageSchema):
         schema.output_schema.set_type(MessageMeta)
 
     def _build_source(self, builder: mrc.Builder) -> mrc.SegmentObject:
+        if self._build_cpp_node():
+            fetcher = None
+            if any(RSSController.is_url(f) for f in self._feed_input):
+                max_connections = 16
+                user_agent = "Morpheus"
+                max_redirects = 5
+                max_body_size = 16 * 1024 * 1024
+                fetcher = WebFetcher(max_connections=max_connections,
+                                     timeout=self._request_timeout,
+                                     user_agent=user_agent,
+                                     max_redirects=max_redirects,
+                                     max_body_size=max_body_size,
+                                     cache_dir=self._cache_dir if self._enable_cache else "",
+                                     fallback_fn=partial(fetch_with_requests,
+                                                         user_agent=user_agent,
+                                                         timeout=self._request_timeout,
+                                                         max_redirects=max_redirects,
+                                                         max_body_size=max_body_size,
+                                                         session=make_fallback_session(max_connections)))
+
+            return _stages.RSSSourceStage(builder,
+                                          self.unique_name,
+                                          feed_input=self._feed_input,
+                                          interval_secs=self._interval_secs,
+                                          stop_after=self._stop_after,
+                                          run_indefinitely=self._run_indefinitely,
+                                          batch_size=self._batch_size,
+                                          cooldown_interval=self._cooldown_interval,
+                                          strip_markup=self._strip_markup,
+                                          max_seen_entries=self._max_seen_entries,
+                                          fetcher=fetcher)
+
         module = self._module_loader.load(builder=builder)
 
         mod_out_node = module.output_port("output")
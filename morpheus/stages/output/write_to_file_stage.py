@@ -50,6 +50,8 @@ class WriteToFileStage(PassThruTypeMixin, SinglePortStage):
         Write out the index as a column, by default True.
     flush : bool, default = False, is_flag = True
         When `True` flush the output buffer to disk on each message.
+    na_rep : str, default = ""
+        String written for null values of CSV files.
     """
 
     def __init__(self,
@@ -58,7 +60,8 @@ class WriteToFileStage(PassThruTypeMixin, SinglePortStage):
                  overwrite: bool = False,
                  file_type: FileTypes = FileTypes.Auto,
                  include_index_col: bool = True,
-                 flush: bool = False):
+                 flush: bool = False,
+                 na_rep: str = ""):
 
         super().__init__(c)
 
@@ -66,7 +69,8 @@ class WriteToFileStage(PassThruTypeMixin, SinglePortStage):
                                                  overwrite=overwrite,
                                                  file_type=file_type,
                                                  include_index_col=include_index_col,
-                                                 flush=flush)
+                                                 flush=flush,
+                                                 na_rep=na_rep)
 
     @property
     def name(self) -> str:
@@ -98,7 +102,8 @@ class WriteToFileStage(PassThruTypeMixin, SinglePortStage):
                                                     "w",
                                                     self._controller.file_type,
                                                     self._controller.include_index_col,
-                                                    self._controller.flush)
+                                                    self._controller.flush,
+                                                    self._controller.na_rep)
         else:
 
             to_file_node = builder.make_node(self.unique_name, ops.build(self._controller.node_fn))
@@ -0,0 +1,284 @@
+# Copyright (c) 2024, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import logging
+import typing
+
+import cupy as cp
+import mrc
+import numpy as np
+from mrc.core import operators as ops
+
+import cudf
+
+import morpheus._lib.stages as _stages
+from morpheus.cli.register_stage import register_stage
+from morpheus.config import Config
+from morpheus.config import PipelineModes
+from morpheus.messages import ControlMessage
+from morpheus.messages import MessageMeta
+from morpheus.messages import MultiResponseMessage
+from morpheus.pipeline.single_port_stage import SinglePortStage
+from morpheus.pipeline.stage_schema import StageSchema
+
+logger = logging.getLogger(__name__)
+
+_EPSILON = 1e-6
+
+
+class _TrackedColumn:
+
+    def __init__(self, name: str, num_buckets: int, lower: float, upper: float, reference: np.ndarray | None):
+        self.name = name
+        self.lower = lower
+        self.upper = upper
+        self.num_buckets = num_buckets
+        self.current = np.zeros(num_buckets, dtype=np.uint64)
+        self.reference = np.zeros(num_buckets, dtype=np.uint64)
+        self.reference_proportions = reference
+
+    def add(self, values: np.ndarray):
+        values = values[~np.isnan(values)]
+        buckets = np.floor((values - self.lower) * (self.num_buckets / (self.upper - self.lower)))
+        buckets = np.clip(buckets, 0, self.num_buckets - 1).astype(np.int64)
+        self.current += np.bincount(buckets, minlength=self.num_buckets).astype(np.uint64)
+
+    @staticmethod
+    def proportions(counts: np.ndarray) -> np.ndarray:
+        total = counts.sum()
+        if (total == 0):
+            return np.full(len(counts), _EPSILON)
+
+        return np.maximum(counts / total, _EPSILON)
+
+
+@register_stage("drift-stats", modes=[PipelineModes.FIL, PipelineModes.NLP, PipelineModes.OTHER])
+class DriftStatsStage(SinglePortStage):
+    """
+    Compute model drift statistics over tumbling windows.
+
+    Maintains fixed width histograms of each column of a model output tensor, and of a set of numeric feature columns,
+    and computes the Population Stability Index (PSI), Kullback-Leibler divergence (KL) and Kolmogorov-Smirnov (KS)
+    statistics of each window against a reference distribution. A `MessageMeta` is emitted for each window with one row
+    per tracked column containing the columns `window`, `name`, `count`, `psi`, `kl` and `ks`.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    tensor_name : str, default = "probs"
+        Name of the output tensor to track. Each column of the tensor is tracked separately.
+    labels : typing.List[str], default = None, multiple = True, show_default = "[Config.class_labels]"
+        Names of the columns of the output tensor.
+    feature_ranges : typing.Dict[str, typing.Tuple[float, float]], optional
+        Numeric DataFrame columns to track mapped to the `(lower, upper)` range of their histogram buckets.
+    window_size : int, default = -1
+        Number of rows in each tumbling window. Default is -1 which will use the pipeline batch_size.
+    num_buckets : int, default = 20
+        Number of histogram buckets for each tracked column.
+    reference_windows : int, default = 1
+        Number of initial windows used to build the reference distribution when `reference` is not provided. These
+        windows do not produce any output.
+    reference : typing.Dict[str, typing.List[float]], optional
+        Reference bucket proportions keyed by label or feature name. Each list must contain `num_buckets` values.
+    """
+
+    def __init__(self,
+                 c: Config,
+                 tensor_name: str = "probs",
+                 labels: typing.List[str] = None,
+                 feature_ranges: typing.Dict[str, typing.Tuple[float, float]] = None,
+                 window_size: int = -1,
+                 num_buckets: int = 20,
+                 reference_windows: int = 1,
+                 reference: typing.Dict[str, typing.List[float]] = None):
+        super().__init__(c)
+
+        self._tensor_name = tensor_name
+        self._labels = list(c.class_labels if labels is None or len(labels) == 0 else labels)
+        self._feature_ranges = dict(feature_ranges or {})
+        self._window_size = c.pipeline_batch_size if window_size == -1 else window_size
+        self._num_buckets = num_buckets
+        self._reference_windows = reference_windows
+        self._reference = {name: list(values) for (name, values) in (reference or {}).items()}
+
+        if (self._window_size <= 0):
+            raise ValueError("window_size must be greater than zero")
+
+        if (self._num_buckets <= 0):
+            raise ValueError("num_buckets must be greater than zero")
+
+        if (len(self._reference) == 0 and self._reference_windows <= 0):
+            raise ValueError("Either a reference distribution or a number of reference windows must be provided")
+
+        for (name, values) in self._reference.items():
+            if (len(values) != self._num_buckets):
+                raise ValueError(f"Reference distribution for '{name}' has {len(values)} buckets, "
+                                 f"expected {self._num_buckets}")
+
+    @property
+    def name(self) -> str:
+        return "drift-stats"
+
+    def accepted_types(self) -> typing.Tuple:
+        """
+        Accepted input types for this stage are returned.
+
+        Returns
+        -------
+        typing.Tuple[`morpheus.pipeline.messages.MultiResponseMessage`, ControlMessage]
+            Accepted input types.
+
+        """
+        return (MultiResponseMessage, ControlMessage)
+
+    def compute_schema(self, schema: StageSchema):
+        schema.output_schema.set_type(MessageMeta)
+
+    def supports_cpp_node(self):
+        return True
+
+    def _make_column(self, name: str, lower: float, upper: float) -> _TrackedColumn:
+        reference = self._reference.get(name)
+        if (reference is not None):
+            reference = np.maximum(np.asarray(reference, dtype=np.float64), _EPSILON)
+
+        return _TrackedColumn(name, self._num_buckets, lower, upper, reference)
+
+    def _build_py_node(self, builder: mrc.Builder) -> mrc.SegmentObject:
+        tensor_columns: typing.List[_TrackedColumn] = []
+        feature_columns = [
+            self._make_column(name, lower, upper) for (name, (lower, upper)) in self._feature_ranges.items()
+        ]
+
+        state = {"window_rows": 0, "windows_closed": 0, "window_id": 0}
+
+        def close_window():
+            window_id = state["window_id"]
+            window_rows = state["window_rows"]
+            state["window_id"] += 1
+            state["window_rows"] = 0
+
+            # Without an explicit reference the first windows are merged into the reference
+            if (len(self._reference) == 0 and state["windows_closed"] < self._reference_windows):
+                state["windows_closed"] += 1
+
+                for column in tensor_columns + feature_columns:
+                    column.reference += column.current
+                    column.current[:] = 0
+
+                    if (state["windows_closed"] == self._reference_windows):
+                        column.reference_proportions = _TrackedColumn.proportions(column.reference)
+
+                return None
+
+            state["windows_closed"] += 1
+
+            rows = []
+            for column in tensor_columns + feature_columns:
+                if (column.reference_proportions is not None):
+                    ref = column.reference_proportions
+                    cur = _TrackedColumn.proportions(column.current)
+                    ratio = np.log(cur / ref)
+
+                    rows.append({
+                        "window": window_id,
+                        "name": column.name,
+                        "count": window_rows,
+                        "psi": float(((cur - ref) * ratio).sum()),
+                        "kl": float((cur * ratio).sum()),
+                        "ks": float(np.abs(np.cumsum(cur) - np.cumsum(ref)).max())
+                    })
+
+                column.current[:] = 0
+
+            if (len(rows) == 0):
+                return None
+
+            return MessageMeta(cudf.DataFrame(rows))
+
+        def on_next(x: MultiResponseMessage | ControlMessage) -> typing.List[MessageMeta]:
+            if (isinstance(x, ControlMessage)):
+                tensor = x.tensors().get_tensor(self._tensor_name)
+                features = x.payload().get_data(list(self._feature_ranges.keys())) if feature_columns else None
+            else:
+                tensor = x.get_output(self._tensor_name)
+                features = x.get_meta(list(self._feature_ranges.keys())) if feature_columns else None
+
+            if (len(tensor.shape) == 1):
+                tensor = cp.expand_dims(tensor, axis=1)
+
+            host_tensor = cp.asnumpy(tensor).astype(np.float64)
+
+            for i in range(len(tensor_columns), host_tensor.shape[1]):
+                name = self._labels[i] if i < len(self._labels) else str(i)
+                tensor_columns.append(self._make_column(name, 0.0, 1.0))
+
+            host_features = []
+            for column in feature_columns:
+                host_features.append(features[column.name].astype(np.float64).fillna(np.nan).to_numpy())
+
+            output = []
+            num_rows = host_tensor.shape[0]
+            row = 0
+            while (row < num_rows):
+                chunk_rows = min(self._window_size - state["window_rows"], num_rows - row)
+
+                for (i, column) in enumerate(tensor_columns):
+                    column.add(host_tensor[row:row + chunk_rows, i])
+
+                for (i, column) in enumerate(feature_columns):
+                    column.add(host_features[i][row:row + chunk_rows])
+
+                row += chunk_rows
+                state["window_rows"] += chunk_rows
+
+                if (state["window_rows"] == self._window_size):
+                    output.append(close_window())
+
+            return [meta for meta in output if meta is not None]
+
+        def on_completed() -> typing.List[MessageMeta]:
+            # Emit the final, partial, window
+            if (state["window_rows"] > 0):
+                meta = close_window()
+                if (meta is not None):
+                    return [meta]
+
+            return []
+
+        return builder.make_node(self.unique_name, ops.map(on_next), ops.on_completed(on_completed), ops.flatten())
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+        if (self._build_cpp_node()):
+            args = (builder,
+                    self.unique_name,
+                    self._tensor_name,
+                    self._labels,
+                    self._feature_ranges,
+                    self._window_size,
+                    self._num_buckets,
+                    self._reference_windows,
+                    self._reference)
+
+            if (self._schema.input_type == ControlMessage):
+                node = _stages.DriftStatsControlMessageStage(*args)
+            else:
+                node = _stages.DriftStatsMultiResponseMessageStage(*args)
+        else:
+            node = self._build_py_node(builder)
+
+        builder.make_edge(input_node, node)
+
+        return node
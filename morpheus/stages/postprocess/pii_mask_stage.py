@@ -0,0 +1,149 @@
+# Copyright (c) 2024, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import typing
+
+import mrc
+from mrc.core import operators as ops
+
+import cudf
+
+import morpheus._lib.stages as _stages
+from morpheus.cli.register_stage import register_stage
+from morpheus.common import PiiMasker
+from morpheus.config import Config
+from morpheus.config import PipelineModes
+from morpheus.messages import ControlMessage
+from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
+from morpheus.pipeline.single_port_stage import SinglePortStage
+
+PII_ENTITIES = ["EMAIL", "IP_ADDRESS", "CREDIT_CARD", "USERNAME", "HOSTNAME"]
+
+
+@register_stage("pii-mask", modes=[PipelineModes.FIL, PipelineModes.NLP, PipelineModes.OTHER])
+class PiiMaskStage(PassThruTypeMixin, SinglePortStage):
+    """
+    Mask personally identifiable information in string columns.
+
+    Detects emails, IPv4 and IPv6 addresses, credit card numbers (validated with the Luhn check), usernames following a
+    `user=` style key or in `DOMAIN\\user` form, and hostnames, along with any additional literals and regular
+    expressions. Each match is replaced either with a `[LABEL]` redaction token or, when `pseudonymize` is set, with a
+    `LABEL_<hex>` pseudonym computed with a keyed hash of the value. Pseudonyms are stable for a given key, allowing
+    masked values to still be joined and counted downstream.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    columns : typing.List[str], multiple = True
+        String columns to mask.
+    entities : typing.List[str], default = None, multiple = True
+        Built-in entities to detect, any of `EMAIL`, `IP_ADDRESS`, `CREDIT_CARD`, `USERNAME` and `HOSTNAME`. Leave as
+        None to detect all of them.
+    literals : typing.Dict[str, str], optional
+        Literal values, such as known usernames or hostnames, mapped to their label. Literals are matched on word
+        boundaries.
+    patterns : typing.Dict[str, str], optional
+        Regular expressions mapped to their label. They are matched in linear time by the Grok regular expression
+        engine, which supports the common syntax but not backreferences or lookarounds of more than one character.
+    pseudonymize : bool, default = False
+        Replace matches with keyed-hash pseudonyms instead of redaction tokens.
+    key : str, default = ""
+        Key of the pseudonym hash, required when `pseudonymize` is set.
+    num_threads : int, default = 0
+        Number of host threads used to mask each batch by the C++ implementation. Default is 0 which will use the
+        number of hardware threads.
+    use_gpu : bool, default = False
+        Mask on the device using cudf regular expressions. Only supports redaction, the card numbers found are copied to
+        the host for the Luhn check.
+    """
+
+    def __init__(self,
+                 c: Config,
+                 columns: typing.List[str],
+                 entities: typing.List[str] = None,
+                 literals: typing.Dict[str, str] = None,
+                 patterns: typing.Dict[str, str] = None,
+                 pseudonymize: bool = False,
+                 key: str = "",
+                 num_threads: int = 0,
+                 use_gpu: bool = False):
+        super().__init__(c)
+
+        self._columns = list(columns)
+        self._entities = list(PII_ENTITIES if entities is None else entities)
+        self._literals = dict(literals or {})
+        self._patterns = dict(patterns or {})
+        self._pseudonymize = pseudonymize
+        self._key = key
+        self._num_threads = num_threads
+        self._use_gpu = use_gpu
+
+        if (len(self._columns) == 0):
+            raise ValueError("At least one column to mask must be provided")
+
+        if (self._pseudonymize and self._use_gpu):
+            raise ValueError("Pseudonymization is not supported by the device implementation")
+
+        # Also validates the entities, literals, patterns and key
+        self._masker = PiiMasker(self._entities, self._literals, self._patterns, self._pseudonymize, self._key)
+
+    @property
+    def name(self) -> str:
+        return "pii-mask"
+
+    def accepted_types(self) -> typing.Tuple:
+        """
+        Accepted input types for this stage are returned.
+
+        Returns
+        -------
+        typing.Tuple[`morpheus.messages.ControlMessage`, ]
+            Accepted input types.
+
+        """
+        return (ControlMessage, )
+
+    def supports_cpp_node(self):
+        return True
+
+    def _on_data(self, message: ControlMessage) -> ControlMessage:
+        meta = message.payload()
+
+        with meta.mutable_dataframe() as df:
+            for col in self._columns:
+                masked = cudf.from_pandas(df[col].to_pandas().map(self._masker.mask, na_action="ignore"))
+                masked.index = df.index
+                df[col] = masked.astype("str")
+
+        return message
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+        if self._build_cpp_node():
+            node = _stages.PiiMaskStage(builder,
+                                        self.unique_name,
+                                        columns=self._columns,
+                                        entities=self._entities,
+                                        literals=self._literals,
+                                        patterns=self._patterns,
+                                        pseudonymize=self._pseudonymize,
+                                        key=self._key,
+                                        num_threads=self._num_threads,
+                                        use_gpu=self._use_gpu)
+        else:
+            node = builder.make_node(self.unique_name, ops.map(self._on_data))
+
+        builder.make_edge(input_node, node)
+
+        return node
@@ -0,0 +1,117 @@
+# Copyright (c) 2024, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import typing
+
+import cupy as cp
+import mrc
+import numpy as np
+from mrc.core import operators as ops
+
+import morpheus._lib.stages as _stages
+from morpheus.cli.register_stage import register_stage
+from morpheus.common import TypeId
+from morpheus.config import Config
+from morpheus.config import PipelineModes
+from morpheus.messages import ControlMessage
+from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
+from morpheus.pipeline.single_port_stage import SinglePortStage
+
+DEDUP_HASH_COLUMN = "_dedup_hash"
+DEDUP_INDEX_COLUMN = "_dedup_index"
+
+# Seeds for the two 32-bit hashes combined into a single 64-bit row hash, matching the C++ implementation
+_HASH_SEED_HIGH = 0
+_HASH_SEED_LOW = 0x9e3779b9
+
+
+@register_stage("deduplicate", modes=[PipelineModes.FIL, PipelineModes.NLP, PipelineModes.OTHER])
+class DeduplicateStage(PassThruTypeMixin, SinglePortStage):
+    """
+    Identify duplicate rows within each batch so that only unique rows are preprocessed and inferred.
+
+    Hashes the selected columns of each row, recording the 64-bit row hash in the `_dedup_hash` column and the index of
+    the first row in the batch with the same hash in the `_dedup_index` column. When these columns are present the C++
+    implementations of `PreprocessNLPStage`, `PreprocessFILStage` and `TritonInferenceStage` only process the unique
+    rows and copy the results to the duplicate rows. Combined with the `dedup_cache_size` option of
+    `TritonInferenceStage`, rows seen in recent batches skip inference entirely.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    columns : typing.List[str], default = None, multiple = True
+        Columns used to identify duplicate rows. For NLP pipelines this should be the column being tokenized, for FIL
+        pipelines the feature columns. Leave as None to use all columns.
+    """
+
+    def __init__(self, c: Config, columns: typing.List[str] = None):
+        super().__init__(c)
+
+        self._columns = list(columns or [])
+
+        self._needed_columns[DEDUP_HASH_COLUMN] = TypeId.UINT64
+        self._needed_columns[DEDUP_INDEX_COLUMN] = TypeId.INT32
+
+    @property
+    def name(self) -> str:
+        return "deduplicate"
+
+    def accepted_types(self) -> typing.Tuple:
+        """
+        Accepted input types for this stage are returned.
+
+        Returns
+        -------
+        typing.Tuple[`morpheus.messages.ControlMessage`, ]
+            Accepted input types.
+
+        """
+        return (ControlMessage, )
+
+    def supports_cpp_node(self):
+        return True
+
+    def _on_data(self, message: ControlMessage) -> ControlMessage:
+        columns = self._columns
+        if (len(columns) == 0):
+            columns = [
+                col for col in message.payload().get_column_names()
+                if col not in (DEDUP_HASH_COLUMN, DEDUP_INDEX_COLUMN)
+            ]
+
+        df = message.payload().get_data(columns)
+
+        high = cp.asarray(df.hash_values(method="murmur3", seed=_HASH_SEED_HIGH).values).astype(cp.uint64)
+        low = cp.asarray(df.hash_values(method="murmur3", seed=_HASH_SEED_LOW).values).astype(cp.uint64)
+        hashes = cp.asnumpy((high << np.uint64(32)) | low)
+
+        # np.unique returns the index of the first occurrence of each hash
+        _, first_index, inverse = np.unique(hashes, return_index=True, return_inverse=True)
+        representative = first_index[inverse].astype(np.int32)
+
+        message.payload().set_data(DEDUP_HASH_COLUMN, cp.asarray(hashes))
+        message.payload().set_data(DEDUP_INDEX_COLUMN, cp.asarray(representative))
+
+        return message
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+        if self._build_cpp_node():
+            node = _stages.DeduplicateStage(builder, self.unique_name, self._columns)
+        else:
+            node = builder.make_node(self.unique_name, ops.map(self._on_data))
+
+        builder.make_edge(input_node, node)
+
+        return node
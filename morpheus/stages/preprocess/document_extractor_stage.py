@@ -0,0 +1,138 @@
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import typing
+
+import mrc
+from mrc.core import operators as ops
+
+import cudf
+
+import morpheus._lib.stages as _stages
+from morpheus.cli.register_stage import register_stage
+from morpheus.common import DocumentExtractor
+from morpheus.config import Config
+from morpheus.config import PipelineModes
+from morpheus.messages import ControlMessage
+from morpheus.messages import MessageMeta
+from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
+from morpheus.pipeline.single_port_stage import SinglePortStage
+
+ConverterFn = typing.Callable[[bytes], typing.Union[str, typing.List[str], None]]
+
+
+@register_stage("document-extractor",
+                modes=[PipelineModes.FIL, PipelineModes.NLP, PipelineModes.OTHER],
+                ignore_args=["converters"])
+class DocumentExtractorStage(PassThruTypeMixin, SinglePortStage):
+    """
+    Extract the text of the files listed in a column of the payload, typically ahead of the `TextChunkerStage`.
+
+    Plain text, CSV, HTML and DOCX files are converted natively, files are read and converted in parallel by a pool of
+    threads without holding the GIL. The type of a file is the lower case extension of its name, files with other
+    types are read as plain text unless a converter is given for the type in `converters`. Each CSV record produces
+    its own text, made of the values of `csv_text_columns` joined with a space.
+
+    The payload of each message is replaced with a table holding one row per text with the string columns
+    `file_path`, `file_name`, `file_type`, `content` and `error`. Files which can't be read or converted are logged and
+    skipped, as are empty texts. Invalid UTF-8 in the text of a file, such as a binary file read as plain text, is
+    replaced with U+FFFD and noted in the `error` column, which is null for the other texts.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    path_column : str, default = "file_path"
+        String column holding the paths of the files to extract.
+    converters : typing.Dict[str, typing.Callable[[bytes], typing.Union[str, typing.List[str]]]], default = None
+        Converters for additional file types such as `pdf`, keyed by file type. Each receives the content of a file
+        and returns its text, or a list of texts. These replace the native converter of the same type. Python
+        converters hold the GIL while converting and don't run concurrently.
+    csv_text_columns : typing.List[str], default = ["content"], multiple = True
+        Columns joined into the text of each record of CSV files, all of which must exist in each file.
+    csv_delimiter : str, default = ","
+        Character separating the values of CSV files.
+    num_threads : int, default = 0
+        Number of threads reading and converting files. Default is 0 which will use the number of hardware threads.
+    """
+
+    def __init__(self,
+                 c: Config,
+                 path_column: str = "file_path",
+                 converters: typing.Dict[str, ConverterFn] = None,
+                 csv_text_columns: typing.List[str] = None,
+                 csv_delimiter: str = ",",
+                 num_threads: int = 0):
+        super().__init__(c)
+
+        if len(csv_delimiter) != 1:
+            raise ValueError("csv_delimiter must be a single character")
+
+        self._path_column = path_column
+        self._converters = dict(converters or {})
+        self._csv_text_columns = list(csv_text_columns or ["content"])
+        self._csv_delimiter = csv_delimiter
+        self._num_threads = num_threads
+
+        # Also validates the converters
+        self._extractor = DocumentExtractor(converters=self._converters,
+                                            csv_text_columns=self._csv_text_columns,
+                                            csv_delimiter=self._csv_delimiter,
+                                            num_threads=self._num_threads)
+
+    @property
+    def name(self) -> str:
+        return "document-extractor"
+
+    def accepted_types(self) -> typing.Tuple:
+        """
+        Accepted input types for this stage are returned.
+
+        Returns
+        -------
+        typing.Tuple[`morpheus.messages.ControlMessage`, ]
+            Accepted input types.
+
+        """
+        return (ControlMessage, )
+
+    def supports_cpp_node(self):
+        return True
+
+    def _on_data(self, message: ControlMessage) -> ControlMessage:
+        paths = message.payload().get_data(self._path_column).dropna().to_arrow().to_pylist()
+
+        documents = self._extractor.extract(paths)
+        df = cudf.DataFrame({name: cudf.Series(values, dtype="str") for (name, values) in documents.items()})
+
+        message.payload(MessageMeta(df))
+
+        return message
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+        if self._build_cpp_node():
+            node = _stages.DocumentExtractorStage(builder,
+                                                  self.unique_name,
+                                                  path_column=self._path_column,
+                                                  converters=self._converters,
+                                                  csv_text_columns=self._csv_text_columns,
+                                                  csv_delimiter=self._csv_delimiter,
+                                                  num_threads=self._num_threads)
+        else:
+            node = builder.make_node(self.unique_name, ops.map(self._on_data))
+
+        builder.make_edge(input_node, node)
+
+        return node
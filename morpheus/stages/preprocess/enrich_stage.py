@@ -0,0 +1,218 @@
+# Copyright (c) 2024, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import logging
+import os
+import time
+import typing
+
+import mrc
+import pandas as pd
+from mrc.core import operators as ops
+
+import cudf
+
+import morpheus._lib.stages as _stages
+from morpheus.common import FileTypes
+from morpheus.config import Config
+from morpheus.io.deserializers import read_file_to_df
+from morpheus.messages import MessageMeta
+from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
+from morpheus.pipeline.single_port_stage import SinglePortStage
+
+logger = logging.getLogger(__name__)
+
+_ROW_POSITION_COLUMN = "_enrich_row_position"
+
+
+class _ReferenceTable:
+    """
+    Python equivalent of the C++ `ReferenceTable`, holds the selected columns of a reference file with unique keys.
+    """
+
+    def __init__(self, reference: dict, df_type: typing.Literal["cudf", "pandas"]):
+        self.path = reference["path"]
+        self.on = list(reference["on"])
+        self.reference_on = list(reference.get("reference_on") or self.on)
+        self.prefix = reference.get("prefix") or ""
+        self.how = reference.get("how") or "left"
+
+        if (len(self.on) == 0):
+            raise ValueError("At least one key column is required to join a reference table")
+
+        if (len(self.reference_on) != len(self.on)):
+            raise ValueError(f"Expected {len(self.on)} key columns for reference table {self.path}, "
+                             f"got {len(self.reference_on)}")
+
+        if (self.how not in ("left", "inner")):
+            raise ValueError(f"Unsupported join type '{self.how}', must be either 'left' or 'inner'")
+
+        self.modified = os.path.getmtime(self.path)
+
+        df = read_file_to_df(self.path,
+                             file_type=reference.get("file_type") or FileTypes.Auto,
+                             filter_nulls=False,
+                             df_type=df_type)
+
+        columns = list(reference.get("columns") or [col for col in df.columns if col not in self.reference_on])
+        missing = [col for col in self.reference_on + columns if col not in df.columns]
+        if (len(missing) > 0):
+            raise ValueError(f"Columns {missing} not found in reference table {self.path}")
+
+        num_rows = len(df)
+        df = df[self.reference_on + columns].drop_duplicates(subset=self.reference_on, keep="first")
+        if (len(df) < num_rows):
+            logger.warning("Dropped %d rows with duplicate keys from reference table %s", num_rows - len(df), self.path)
+
+        # Null keys never match
+        df = df.dropna(subset=self.reference_on)
+
+        self.column_names = [self.prefix + col for col in columns]
+        self.df = df.rename(columns=dict(zip(self.reference_on + columns, self.on + self.column_names)))
+
+
+class EnrichStage(PassThruTypeMixin, SinglePortStage):
+    """
+    Enrich each message by joining its rows to one or more reference tables, such as an asset inventory or a user
+    directory, appending the selected reference columns.
+
+    Each reference table is loaded once and held as a hash index keyed on its key columns, which is probed by every
+    message. Reference keys are expected to be unique, when a key occurs more than once only its first row is kept. The
+    rows and index of each message are preserved, except for rows dropped by an inner join. Existing columns with the
+    name of an appended column are replaced, and messages left without any rows are dropped.
+
+    When `refresh_interval` is non-zero the modification time of the reference files is checked at that interval, and
+    changed files are reloaded and swapped in atomically. A file which fails to load leaves the previous table in place.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    references : typing.List[dict]
+        Reference tables, joined in order. Each is a dictionary with the keys:
+        - `path`: Path of the reference file, in any format supported by `read_file_to_df`.
+        - `on`: Key column or columns of the incoming rows.
+        - `reference_on`: Key columns of the reference table, defaults to `on`.
+        - `columns`: Reference columns to append, defaults to all non-key columns.
+        - `prefix`: Prepended to the names of the appended columns, defaults to no prefix.
+        - `how`: Either `'left'` to keep rows without a match, or `'inner'` to drop them, defaults to `'left'`.
+        - `file_type`: Type of the reference file, defaults to `FileTypes.Auto`.
+    refresh_interval : float, default = 5.0
+        Interval in seconds at which the reference files are checked for changes, zero disables refreshing.
+    """
+
+    def __init__(self, c: Config, references: typing.List[dict], refresh_interval: float = 5.0):
+        super().__init__(c)
+
+        if (len(references) == 0):
+            raise ValueError("At least one reference table is required")
+
+        if (refresh_interval < 0):
+            raise ValueError("refresh_interval must not be negative")
+
+        self._references = []
+        for reference in references:
+            reference = dict(reference)
+            if (isinstance(reference["on"], str)):
+                reference["on"] = [reference["on"]]
+
+            if (isinstance(reference.get("reference_on"), str)):
+                reference["reference_on"] = [reference["reference_on"]]
+
+            reference["path"] = os.fspath(reference["path"])
+            self._references.append(reference)
+
+        self._refresh_interval = refresh_interval
+
+        self._tables: typing.List[_ReferenceTable] = []
+        self._last_refresh = 0.0
+
+    @property
+    def name(self) -> str:
+        return "enrich"
+
+    def accepted_types(self) -> typing.Tuple:
+        """
+        Accepted input types for this stage are returned.
+
+        Returns
+        -------
+        typing.Tuple[`morpheus.messages.MessageMeta`, ]
+            Accepted input types.
+
+        """
+        return (MessageMeta, )
+
+    def supports_cpp_node(self):
+        return True
+
+    def _refresh(self, df_type: typing.Literal["cudf", "pandas"]):
+        if (len(self._tables) == 0):
+            self._tables = [_ReferenceTable(reference, df_type) for reference in self._references]
+            self._last_refresh = time.monotonic()
+            return
+
+        if (self._refresh_interval == 0 or time.monotonic() - self._last_refresh < self._refresh_interval):
+            return
+
+        self._last_refresh = time.monotonic()
+
+        for (i, table) in enumerate(self._tables):
+            try:
+                if (os.path.getmtime(table.path) == table.modified):
+                    continue
+
+                self._tables[i] = _ReferenceTable(self._references[i], df_type)
+            except Exception:
+                logger.exception("Failed to reload reference table %s, keeping the previous table", table.path)
+
+    def _on_data(self, message: MessageMeta) -> MessageMeta | None:
+        df = message.copy_dataframe()
+        df_type = "pandas" if isinstance(df, pd.DataFrame) else "cudf"
+
+        self._refresh(df_type)
+
+        index = df.index
+        df = df.reset_index(drop=True)
+        df[_ROW_POSITION_COLUMN] = range(len(df))
+
+        columns = list(df.columns)
+        for table in self._tables:
+            # Replace any existing columns with the same name as an appended column, keeping their position
+            df = df.drop(columns=[col for col in table.column_names if col in df.columns])
+            df = df.merge(table.df, how=table.how, on=table.on, sort=False)
+            columns.extend(col for col in table.column_names if col not in columns)
+
+        # Merging doesn't preserve the order of the rows, restore the original order and index
+        df = df[columns].sort_values(_ROW_POSITION_COLUMN)
+        positions = df.pop(_ROW_POSITION_COLUMN)
+        if (len(df) == 0):
+            return None
+
+        if (isinstance(df, cudf.DataFrame)):
+            positions = positions.values
+
+        df.index = index.take(positions)
+
+        return MessageMeta(df)
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+        if self._build_cpp_node():
+            node = _stages.EnrichStage(builder, self.unique_name, self._references, self._refresh_interval)
+        else:
+            node = builder.make_node(self.unique_name, ops.map(self._on_data), ops.filter(lambda x: x is not None))
+
+        builder.make_edge(input_node, node)
+
+        return node
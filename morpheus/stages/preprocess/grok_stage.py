@@ -0,0 +1,503 @@
+# Copyright (c) 2024, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import re
+import typing
+
+import mrc
+from mrc.core import operators as ops
+
+import cudf
+
+import morpheus
+import morpheus._lib.stages as _stages
+from morpheus.common import TimestampParser
+from morpheus.config import Config
+from morpheus.messages import MessageMeta
+from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
+from morpheus.pipeline.single_port_stage import SinglePortStage
+from morpheus.stages.preprocess.syslog_parser_stage import EXTENSION_DTYPES
+from morpheus.stages.preprocess.syslog_parser_stage import EXTENSION_TYPES
+from morpheus.stages.preprocess.syslog_parser_stage import convert_log_value
+
+DEFAULT_PATTERN_FILE = os.path.join(morpheus.DATA_DIR, "grok_patterns.txt")
+
+_POSIX_CLASSES = {
+    "alpha": "a-zA-Z",
+    "digit": "0-9",
+    "alnum": "a-zA-Z0-9",
+    "upper": "A-Z",
+    "lower": "a-z",
+    "space": "\\t-\\r ",
+    "blank": " \\t",
+    "xdigit": "0-9a-fA-F",
+    "punct": "!-/:-@\\[-`{-~",
+    "word": "a-zA-Z0-9_",
+    "cntrl": "\\x00-\\x1f\\x7f",
+    "print": " -~",
+    "graph": "!-~",
+}
+
+_INTERVAL_RE = re.compile(r"\{(\d+(,\d*)?|,\d+)\}")
+
+
+def load_grok_patterns(path: str, patterns: dict = None) -> dict:
+    """
+    Load a Grok pattern file, each line holding a name followed by whitespace and the pattern. Blank lines and lines
+    starting with `#` are skipped.
+
+    Parameters
+    ----------
+    path : str
+        Path of the pattern file.
+    patterns : dict, default = None
+        Patterns to add the patterns of the file to, replacing patterns of the same name.
+
+    Returns
+    -------
+    dict
+        The patterns by name.
+    """
+    patterns = {} if patterns is None else patterns
+
+    try:
+        with open(path, encoding="utf-8") as f:
+            lines = f.read().splitlines()
+    except OSError as e:
+        raise ValueError(f"Unable to read the Grok pattern file '{path}'") from e
+
+    for line in lines:
+        line = line.strip(" \t")
+        if (len(line) == 0 or line.startswith("#")):
+            continue
+
+        parts = line.split(None, 1)
+        if (len(parts) < 2):
+            raise ValueError(f"Missing the pattern of '{line}' in the Grok pattern file '{path}'")
+
+        patterns[parts[0]] = parts[1]
+
+    return patterns
+
+
+def expand_grok_pattern(pattern: str, patterns: dict) -> typing.Tuple[str, typing.List[typing.Tuple[str, str]]]:
+    """
+    Expand the `%{NAME}`, `%{NAME:field}` and `%{NAME:field:type}` references of a Grok pattern recursively, the same
+    way as the C++ implementation of `GrokStage`. A reference naming a field becomes the named group `(?<field>...)`.
+
+    Parameters
+    ----------
+    pattern : str
+        Grok pattern.
+    patterns : dict
+        Patterns referenced by `pattern`, by name.
+
+    Returns
+    -------
+    typing.Tuple[str, typing.List[typing.Tuple[str, str]]]
+        The expanded regular expression, in the Oniguruma syntax of Grok, and the name and type of each field.
+    """
+    captures = {}
+
+    def expand(text: str, stack: list) -> str:
+        chunks = []
+        pos = 0
+        while (pos < len(text)):
+            # Escaped characters are copied as they are, `\%{` isn't a reference
+            if (text[pos] == "\\"):
+                chunks.append(text[pos:pos + 2])
+                pos += 2
+                continue
+
+            if (not text.startswith("%{", pos)):
+                chunks.append(text[pos])
+                pos += 1
+                continue
+
+            end = text.find("}", pos)
+            if (end < 0):
+                raise ValueError(f"Unterminated Grok reference in '{text}'")
+
+            (name, _, field) = text[pos + 2:end].partition(":")
+            (field, _, value_type) = field.partition(":")
+            value_type = value_type or "str"
+
+            if (name not in patterns):
+                raise ValueError(f"Unknown Grok pattern '{name}'")
+
+            if (name in stack):
+                raise ValueError(f"Recursive Grok pattern '{name}'")
+
+            if (len(field) == 0):
+                chunks.append("(?:")
+            else:
+                if (any(c in field for c in "<>'")):
+                    raise ValueError(f"Invalid Grok field name '{field}'")
+
+                if (value_type not in EXTENSION_TYPES):
+                    raise ValueError(f"Unknown type '{value_type}' of the Grok field '{field}', must be one of: "
+                                     f"{', '.join(EXTENSION_TYPES)}")
+
+                if (captures.setdefault(field, value_type) != value_type):
+                    raise ValueError(f"The Grok field '{field}' is captured with different types")
+
+                chunks.append(f"(?<{field}>")
+
+            chunks.append(expand(patterns[name], stack + [name]))
+            chunks.append(")")
+            pos = end + 1
+
+        return "".join(chunks)
+
+    regex = expand(pattern, [])
+
+    return (regex, list(captures.items()))
+
+
+def _translate_class(regex: str, pos: int) -> typing.Tuple[str, int]:
+    # Translate the class starting after the '[' at `pos`, a ']' first in the class is a literal
+    chunks = ["["]
+    if (regex.startswith("^", pos)):
+        chunks.append("^")
+        pos += 1
+
+    first = True
+    while (True):
+        if (pos >= len(regex)):
+            raise ValueError(f"Missing ']' in '{regex}'")
+
+        c = regex[pos]
+        if (c == "]" and not first):
+            chunks.append("]")
+            return ("".join(chunks), pos + 1)
+
+        first = False
+        if (c == "\\"):
+            escaped = regex[pos + 1:pos + 2]
+            chunks.append("0-9a-fA-F" if escaped == "h" else "\\x1b" if escaped == "e" else regex[pos:pos + 2])
+            pos += 2
+        elif (regex.startswith("[:", pos) and regex.find(":]", pos + 2) >= 0):
+            end = regex.find(":]", pos + 2)
+            name = regex[pos + 2:end]
+            if (name not in _POSIX_CLASSES):
+                raise ValueError(f"Unsupported POSIX class '{name}' in '{regex}'")
+
+            chunks.append(_POSIX_CLASSES[name])
+            pos = end + 2
+        elif (c in "[&~|"):
+            # Escaped as Python reserves these for set operations
+            chunks.append("\\" + c)
+            pos += 1
+        else:
+            chunks.append(c)
+            pos += 1
+
+
+def _translate_regex(regex: str) -> typing.Tuple[str, typing.List[str]]:
+    # Translate the Oniguruma syntax of Grok to Python, which only differs in group names, unnamed groups which don't
+    # capture, atomic groups and possessive quantifiers matched as regular ones, inline flags and a few escapes. Named
+    # groups are renamed `g0`, `g1`... as a name may repeat, the names of the groups are returned in order.
+    chunks = []
+    names = []
+
+    # Inline flags apply to the rest of the enclosing group, which closes the scoped flags they are translated to
+    open_flags = [0]
+    after_quantifier = False
+
+    pos = 0
+    while (pos < len(regex)):
+        c = regex[pos]
+        quantifier = False
+
+        if (c == "\\"):
+            escaped = regex[pos + 1:pos + 2]
+            chunks.append({
+                "z": "\\Z", "h": "[0-9a-fA-F]", "H": "[^0-9a-fA-F]", "e": "\\x1b"
+            }.get(escaped, regex[pos:pos + 2]))
+            pos += 2
+        elif (c == "["):
+            (translated, pos) = _translate_class(regex, pos + 1)
+            chunks.append(translated)
+        elif (c == "("):
+            for (flag, scoped) in (("(?i)", "(?i:"), ("(?-i)", "(?-i:")):
+                if (regex.startswith(flag, pos)):
+                    chunks.append(scoped)
+                    open_flags[-1] += 1
+                    pos += len(flag)
+                    break
+            else:
+                name_match = re.match(r"\(\?(?:P?<(?![=!])([^>]*)>|'([^']*)')", regex[pos:])
+                if (name_match is not None):
+                    name = name_match.group(1) if name_match.group(1) is not None else name_match.group(2)
+                    if (len(name) == 0):
+                        raise ValueError(f"Invalid group name in '{regex}'")
+
+                    chunks.append(f"(?P<g{len(names)}>")
+                    names.append(name)
+                    pos += name_match.end()
+                elif (regex.startswith("(?>", pos)):
+                    chunks.append("(?:")
+                    pos += 3
+                elif (regex.startswith("(?", pos)):
+                    chunks.append("(?")
+                    pos += 2
+                else:
+                    chunks.append("(?:")
+                    pos += 1
+
+                open_flags.append(0)
+        elif (c == ")"):
+            if (len(open_flags) == 1):
+                raise ValueError(f"Unbalanced ')' in '{regex}'")
+
+            chunks.append(")" * (open_flags.pop() + 1))
+            pos += 1
+        elif (c in "*+?"):
+            if (c == "+" and after_quantifier):
+                # Possessive quantifiers are matched greedily
+                pos += 1
+                continue
+
+            chunks.append(c)
+            pos += 1
+            quantifier = c != "?" or not after_quantifier
+        elif (c == "{"):
+            interval = _INTERVAL_RE.match(regex, pos)
+            if (interval is not None):
+                chunks.append(interval.group(0))
+                pos = interval.end()
+                quantifier = True
+            else:
+                chunks.append("\\{")
+                pos += 1
+        else:
+            chunks.append(c)
+            pos += 1
+
+        after_quantifier = quantifier
+
+    chunks.append(")" * open_flags[0])
+
+    return ("".join(chunks), names)
+
+
+class GrokStage(PassThruTypeMixin, SinglePortStage):
+    """
+    Match a column of raw log lines against a list of Grok patterns, appending the named captures of the first
+    matching pattern to each message as typed columns, along with the index of that pattern. The stage is placed before
+    `DeserializeStage`.
+
+    Patterns reference the patterns of `pattern_files` and `custom_patterns` as `%{NAME}`, `%{NAME:field}` or
+    `%{NAME:field:type}`, where the type is one of `'str'`, `'int'` (int64), `'float'` (float64), `'bool'` and
+    `'timestamp'` (datetime64[ns]), `'str'` by default. Each field, as well as each named group `(?<name>...)` of the
+    patterns, is written to the column of the same name. Captures which don't participate in the match, and values
+    which can't be converted, are null. Lines which match none of the patterns, and null lines, are null in every new
+    column. Trailing line breaks are removed before matching.
+
+    The patterns use the subset of Oniguruma found in Grok pattern libraries. Lookarounds are limited to a single
+    character or class, atomic groups and possessive quantifiers are matched as regular groups and quantifiers, classes
+    and `\\w` are ASCII.
+
+    In C++ mode the patterns are compiled into a single program, matched in time linear in the length of each line
+    across `num_threads` host threads, and the new columns are added without converting the DataFrame in Python.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    column : str
+        String column holding the raw log lines.
+    patterns : typing.List[str]
+        Grok patterns, in order of preference. The first pattern matching anywhere in a line wins.
+    pattern_files : typing.List[str], default = None
+        Pattern files loaded in order, the Logstash compatible patterns shipped in `morpheus/data/grok_patterns.txt` by
+        default. Each line holds a name followed by whitespace and the pattern.
+    custom_patterns : typing.Dict[str, str], default = None
+        Additional patterns by name, replacing those of the pattern files.
+    pattern_column : str, default = "grok_pattern"
+        Column holding the index of the matching pattern, int32.
+    syslog_year : int, default = 0
+        Year of RFC 3164 timestamps captured as `timestamp`, 0 infers the year from the current date.
+    num_threads : int, default = 0
+        Number of host threads used to match the lines in C++ mode, 0 uses the number of hardware threads.
+    """
+
+    def __init__(self,
+                 c: Config,
+                 column: str,
+                 patterns: typing.List[str],
+                 pattern_files: typing.List[str] = None,
+                 custom_patterns: typing.Dict[str, str] = None,
+                 pattern_column: str = "grok_pattern",
+                 syslog_year: int = 0,
+                 num_threads: int = 0):
+        super().__init__(c)
+
+        if (len(patterns) == 0):
+            raise ValueError("At least one Grok pattern is required")
+
+        self._column = column
+        self._patterns = list(patterns)
+        self._pattern_files = list([DEFAULT_PATTERN_FILE] if pattern_files is None else pattern_files)
+        self._custom_patterns = dict(custom_patterns or {})
+        self._pattern_column = pattern_column
+        self._syslog_year = syslog_year
+        self._num_threads = num_threads
+
+        library = {}
+        for pattern_file in self._pattern_files:
+            load_grok_patterns(pattern_file, library)
+
+        library.update(self._custom_patterns)
+
+        # Compile the patterns for the Python implementation, which also validates them in C++ mode
+        self._regexes = []
+        self._group_names = []
+        self._fields = {}
+        for (i, pattern) in enumerate(self._patterns):
+            (regex, captures) = expand_grok_pattern(pattern, library)
+            for (field, value_type) in captures:
+                if (self._fields.setdefault(field, value_type) != value_type):
+                    raise ValueError(f"The Grok field '{field}' is captured with different types")
+
+            (translated, names) = _translate_regex(regex)
+            try:
+                self._regexes.append(re.compile(translated, re.ASCII | re.MULTILINE))
+            except re.error as e:
+                raise ValueError(f"Invalid Grok pattern {i}: {e}") from e
+
+            self._group_names.append(names)
+
+        # Columns in order of first appearance, named groups written in the patterns are strings
+        self._columns = {}
+        for names in self._group_names:
+            for name in names:
+                self._columns.setdefault(name, self._fields.get(name, "str"))
+
+        if (pattern_column in self._columns):
+            raise ValueError(f"Duplicate Grok column '{pattern_column}'")
+
+        self._timestamp_parser = None
+
+    @property
+    def name(self) -> str:
+        return "grok"
+
+    def accepted_types(self) -> typing.Tuple:
+        """
+        Accepted input types for this stage are returned.
+
+        Returns
+        -------
+        typing.Tuple[`morpheus.messages.MessageMeta`, ]
+            Accepted input types.
+
+        """
+        return (MessageMeta, )
+
+    def supports_cpp_node(self):
+        return True
+
+    def match_line(self, line: str) -> typing.Tuple[typing.Optional[int], dict]:
+        """
+        Match a line against the patterns, the same way as the C++ implementation.
+
+        Parameters
+        ----------
+        line : str
+            Raw log line.
+
+        Returns
+        -------
+        typing.Tuple[typing.Optional[int], dict]
+            The index of the first matching pattern, `None` when none of the patterns match, and the unconverted values
+            of the captures which participated in the match.
+        """
+        line = line.rstrip("\r\n")
+        for (i, (regex, names)) in enumerate(zip(self._regexes, self._group_names)):
+            match = regex.search(line)
+            if (match is None):
+                continue
+
+            values = {}
+            for (group, value) in enumerate(match.groups()):
+                if (value is not None):
+                    values[names[group]] = value
+
+            return (i, values)
+
+        return (None, {})
+
+    def _on_data(self, message: MessageMeta) -> MessageMeta:
+        with message.mutable_dataframe() as df:
+            if (self._column not in df.columns):
+                raise ValueError(f"Column '{self._column}' not found")
+
+            lines = df[self._column]
+            if (isinstance(lines, cudf.Series)):
+                lines = lines.to_pandas()
+
+            if (lines.dtype != object):
+                raise ValueError(f"Grok matching requires a string column, column '{self._column}' is not")
+
+            values = {name: [] for name in self._columns}
+            matched_patterns = []
+            for line in lines:
+                (pattern, captures) = self.match_line(line) if isinstance(line, str) else (None, {})
+                for (name, column_values) in values.items():
+                    column_values.append(convert_log_value(captures.get(name), self._columns[name]))
+
+                matched_patterns.append(pattern)
+
+            columns = {}
+            for (name, column_values) in values.items():
+                value_type = self._columns[name]
+                if (value_type == "timestamp"):
+                    if (self._timestamp_parser is None):
+                        self._timestamp_parser = TimestampParser(syslog_year=self._syslog_year)
+
+                    columns[name] = cudf.Series(
+                        self._timestamp_parser.parse(name, column_values).view("datetime64[ns]"))
+                else:
+                    columns[name] = cudf.Series(column_values, dtype=EXTENSION_DTYPES[value_type])
+
+            columns[self._pattern_column] = cudf.Series(matched_patterns, dtype="int32")
+
+            for (name, series) in columns.items():
+                if (name in df.columns):
+                    raise ValueError(f"Column already exists: {name}")
+
+                series.index = df.index
+                df[name] = series
+
+        return message
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+        if self._build_cpp_node():
+            node = _stages.GrokStage(builder,
+                                     self.unique_name,
+                                     column=self._column,
+                                     patterns=self._patterns,
+                                     pattern_files=self._pattern_files,
+                                     custom_patterns=self._custom_patterns,
+                                     pattern_column=self._pattern_column,
+                                     syslog_year=self._syslog_year,
+                                     num_threads=self._num_threads)
+        else:
+            node = builder.make_node(self.unique_name, ops.map(self._on_data))
+
+        builder.make_edge(input_node, node)
+
+        return node
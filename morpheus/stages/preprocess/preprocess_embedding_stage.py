@@ -0,0 +1,234 @@
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import typing
+
+import cupy as cp
+import mrc
+import numpy as np
+from mrc.core import operators as ops
+
+import cudf
+
+import morpheus._lib.messages as _messages
+import morpheus._lib.stages as _stages
+from morpheus.cli.register_stage import register_stage
+from morpheus.cli.utils import MorpheusRelativePath
+from morpheus.cli.utils import get_package_relative_file
+from morpheus.common import TypeId
+from morpheus.common import normalize_bucket_lengths
+from morpheus.common import typeid_to_numpy_str
+from morpheus.config import Config
+from morpheus.config import PipelineModes
+from morpheus.messages import ControlMessage
+from morpheus.messages import MessageMeta
+from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
+from morpheus.pipeline.single_port_stage import SinglePortStage
+from morpheus.utils.cudf_subword_helper import tokenize_text_series
+
+
+@register_stage("preprocess-embedding",
+                modes=[PipelineModes.FIL, PipelineModes.NLP, PipelineModes.OTHER],
+                option_args={
+                    "vocab_hash_file": {
+                        "type": MorpheusRelativePath(exists=True, dir_okay=False, resolve_path=True)
+                    }
+                })
+class PreprocessEmbeddingStage(PassThruTypeMixin, SinglePortStage):
+    """
+    Tokenize a text column for an embedding model, producing length bucketed `input_ids` and `input_mask` tensors.
+
+    Each row is truncated to `max_length` tokens producing exactly one sequence. Rows are then sorted by their number
+    of tokens and grouped into buckets, each bucket only being padded to its bucket length rather than `max_length`,
+    which avoids running the model over padding when most texts are short. One message is emitted per bucket, split
+    into messages of at most `batch_size` rows, allowing the inference stage to send full batches of evenly sized
+    sequences.
+
+    The payload of each emitted message holds the rows of the bucket, along with the `row_index_column` holding the
+    position of each row in the incoming payload. Sorting the concatenated outputs by this column restores the
+    original order of the rows. The `input_ids`, `input_mask` and `seq_ids` tensors line up with the rows of the
+    payload, such that the outputs of the inference stage don't need to be reduced.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    vocab_hash_file : str
+        Path to hash file containing vocabulary of words with token-ids. This can be created from the raw vocabulary
+        using the `cudf.utils.hash_vocab_utils.hash_vocab` function.
+    max_length : int, default = None
+        Maximum number of tokens of a sequence, longer rows are truncated. Defaults to the `feature_length` of the
+        pipeline config.
+    do_lower_case : bool
+        If set to true, original text will be lowercased before encoding.
+    bucket_lengths : typing.List[int], default = None
+        Lengths the sequences are padded to, lengths greater than `max_length` are ignored. Defaults to the powers of
+        two from 16 up to `max_length`.
+    batch_size : int, default = 0
+        Maximum number of rows of each emitted message, typically the maximum batch size of the model. Default is 0
+        which doesn't limit the number of rows.
+    column : str, default = "content"
+        Name of the string column to tokenize.
+    row_index_column : str, default = "_row_index"
+        Name of the int64 column added to the payload, holding the position of each row in the incoming payload.
+    input_ids_type : `morpheus.common.TypeId`, default = "int32"
+        Integral type of the `input_ids` tensor.
+    input_mask_type : `morpheus.common.TypeId`, default = "int32"
+        Integral type of the `input_mask` tensor.
+    """
+
+    def __init__(self,
+                 c: Config,
+                 vocab_hash_file: str = "data/bert-base-uncased-hash.txt",
+                 max_length: int = None,
+                 do_lower_case: bool = True,
+                 bucket_lengths: typing.List[int] = None,
+                 batch_size: int = 0,
+                 column: str = "content",
+                 row_index_column: str = "_row_index",
+                 input_ids_type: TypeId = TypeId.INT32,
+                 input_mask_type: TypeId = TypeId.INT32):
+        super().__init__(c)
+
+        for type_id in (input_ids_type, input_mask_type):
+            if (not np.issubdtype(np.dtype(typeid_to_numpy_str(type_id)), np.integer)):
+                raise ValueError(f"Token tensors must be an integral type, got {type_id}")
+
+        if (batch_size < 0):
+            raise ValueError("batch_size must not be negative")
+
+        self._vocab_hash_file = get_package_relative_file(vocab_hash_file)
+        self._max_length = max_length if max_length is not None else c.feature_length
+        self._do_lower_case = do_lower_case
+        self._bucket_lengths = normalize_bucket_lengths(list(bucket_lengths or []), self._max_length)
+        self._batch_size = batch_size
+        self._column = column
+        self._row_index_column = row_index_column
+        self._input_ids_type = input_ids_type
+        self._input_mask_type = input_mask_type
+
+    @property
+    def name(self) -> str:
+        return "preprocess-embedding"
+
+    def accepted_types(self) -> typing.Tuple:
+        """
+        Accepted input types for this stage are returned.
+
+        Returns
+        -------
+        typing.Tuple[`morpheus.messages.ControlMessage`, ]
+            Accepted input types.
+
+        """
+        return (ControlMessage, )
+
+    def supports_cpp_node(self):
+        return True
+
+    def _tokenize(self, text: cudf.Series) -> typing.Tuple[cp.ndarray, cp.ndarray]:
+        # The tokenizer fails when none of the strings contain any characters, every row is then an empty sequence
+        if (text.str.strip().str.len().sum() == 0):
+            zeros = cp.zeros((len(text), self._max_length), dtype=cp.int32)
+            return zeros, zeros.copy()
+
+        tokenized = tokenize_text_series(vocab_hash_file=self._vocab_hash_file,
+                                         do_lower_case=self._do_lower_case,
+                                         text_ser=text,
+                                         seq_len=self._max_length,
+                                         stride=self._max_length,
+                                         truncation=True,
+                                         add_special_tokens=False)
+
+        return tokenized.input_ids, tokenized.input_mask
+
+    def _on_data(self, message: ControlMessage) -> typing.List[ControlMessage]:
+        df: cudf.DataFrame = message.payload().copy_dataframe().reset_index(drop=True)
+
+        if (self._column not in df.columns):
+            raise ValueError(f"Column '{self._column}' not found")
+
+        if (self._row_index_column in df.columns):
+            raise ValueError(f"Output column '{self._row_index_column}' already exists")
+
+        if (len(df) == 0):
+            return []
+
+        input_ids, input_mask = self._tokenize(df[self._column])
+
+        # Sequences are padded at the end, the number of tokens of each row is the number of set values of its mask
+        lengths = cp.count_nonzero(input_mask, axis=1).get()
+        order = np.argsort(lengths, kind="stable")
+        padded = np.asarray(self._bucket_lengths)[np.searchsorted(self._bucket_lengths, lengths[order])]
+
+        # Start of each bucket, large buckets are split into batches of at most `batch_size` rows
+        starts = []
+        for start in np.flatnonzero(np.r_[True, padded[1:] != padded[:-1]]).tolist() + [len(order)]:
+            while (starts and self._batch_size > 0 and start - starts[-1] > self._batch_size):
+                starts.append(starts[-1] + self._batch_size)
+
+            starts.append(start)
+
+        output = []
+        for (start, stop) in zip(starts[:-1], starts[1:]):
+            rows = order[start:stop]
+            padded_length = int(padded[start])
+            device_rows = cp.asarray(rows)
+
+            seq_ids = cp.zeros((len(rows), 3), dtype=cp.int64)
+            seq_ids[:, 0] = cp.arange(len(rows), dtype=cp.int64)
+            seq_ids[:, 2] = cp.maximum(cp.asarray(lengths[rows]) - 1, 0)
+
+            bucket_df = df.take(rows).reset_index(drop=True)
+            bucket_df[self._row_index_column] = cudf.Series(rows, dtype="int64")
+
+            bucket_message = ControlMessage(message)
+            bucket_message.payload(MessageMeta(bucket_df))
+            bucket_message.tensors(
+                _messages.TensorMemory(
+                    count=len(rows),
+                    tensors={
+                        "input_ids":
+                            input_ids[device_rows, :padded_length].astype(typeid_to_numpy_str(self._input_ids_type)),
+                        "input_mask":
+                            input_mask[device_rows, :padded_length].astype(typeid_to_numpy_str(self._input_mask_type)),
+                        "seq_ids":
+                            seq_ids
+                    }))
+            bucket_message.set_metadata("inference_memory_params", {"inference_type": "nlp"})
+
+            output.append(bucket_message)
+
+        return output
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+        if self._build_cpp_node():
+            node = _stages.PreprocessEmbeddingStage(builder,
+                                                    self.unique_name,
+                                                    vocab_hash_file=self._vocab_hash_file,
+                                                    max_length=self._max_length,
+                                                    do_lower_case=self._do_lower_case,
+                                                    bucket_lengths=self._bucket_lengths,
+                                                    batch_size=self._batch_size,
+                                                    column=self._column,
+                                                    row_index_column=self._row_index_column,
+                                                    input_ids_type=self._input_ids_type,
+                                                    input_mask_type=self._input_mask_type)
+        else:
+            node = builder.make_node(self.unique_name, ops.map(self._on_data), ops.flatten())
+
+        builder.make_edge(input_node, node)
+
+        return node
@@ -26,6 +26,8 @@ import cudf
 import morpheus._lib.messages as _messages
 import morpheus._lib.stages as _stages
 from morpheus.cli.register_stage import register_stage
+from morpheus.common import TypeId
+from morpheus.common import typeid_to_numpy_str
 from morpheus.config import Config
 from morpheus.config import PipelineModes
 from morpheus.messages import ControlMessage
@@ -47,12 +49,20 @@ class PreprocessFILStage(PreprocessBaseStage):
     ----------
     c : `morpheus.config.Config`
         Pipeline configuration instance.
+    input_type : `morpheus.common.TypeId`, default = "float32"
+        Floating point type of the `input__0` tensor. Using `float16` halves the size of the tensor sent to inference,
+        the inference stage widens it back to the type expected by the model when no data would be lost.
 
     """
 
-    def __init__(self, c: Config):
+    def __init__(self, c: Config, input_type: TypeId = TypeId.FLOAT32):
         super().__init__(c)
 
+        if (input_type not in (TypeId.FLOAT16, TypeId.FLOAT32, TypeId.FLOAT64)):
+            raise ValueError(f"input_type must be a floating point type, got {input_type}")
+
+        self._input_type = input_type
+
         self._fea_length = c.feature_length
         self.features = c.fil.feature_columns
 
@@ -67,8 +77,10 @@ class PreprocessFILStage(PreprocessBaseStage):
         return True
 
     @staticmethod
-    def pre_process_batch(x: typing.Union[MultiMessage, ControlMessage], fea_len: int,
-                          fea_cols: typing.List[str]) -> typing.Union[MultiMessage, ControlMessage]:
+    def pre_process_batch(x: typing.Union[MultiMessage, ControlMessage],
+                          fea_len: int,
+                          fea_cols: typing.List[str],
+                          input_type: TypeId = TypeId.FLOAT32) -> typing.Union[MultiMessage, ControlMessage]:
         """
         For FIL category usecases, this function performs pre-processing.
 
@@ -80,6 +92,8 @@ class PreprocessFILStage(PreprocessBaseStage):
             Number features are being used in the inference.
         fea_cols : typing.Tuple[str]
             List of columns that are used as features.
+        input_type : `morpheus.common.TypeId`
+            Floating point type of the `input__0` tensor.
 
         Returns
         -------
@@ -88,13 +102,16 @@ class PreprocessFILStage(PreprocessBaseStage):
 
         """
         if isinstance(x, ControlMessage):
-            return PreprocessFILStage.process_control_message(x, fea_len, fea_cols)
+            return PreprocessFILStage.process_control_message(x, fea_len, fea_cols, input_type)
         if isinstance(x, MultiMessage):
-            return PreprocessFILStage.process_multi_message(x, fea_len, fea_cols)
+            return PreprocessFILStage.process_multi_message(x, fea_len, fea_cols, input_type)
         raise TypeError(f"Unsupported message type: {type(x)}")
 
     @staticmethod
-    def process_control_message(x: ControlMessage, fea_len: int, fea_cols: typing.List[str]) -> ControlMessage:
+    def process_control_message(x: ControlMessage,
+                                fea_len: int,
+                                fea_cols: typing.List[str],
+                                input_type: TypeId = TypeId.FLOAT32) -> ControlMessage:
 
         try:
             df: cudf.DataFrame = x.payload().get_data(fea_cols)
@@ -116,7 +133,7 @@ class PreprocessFILStage(PreprocessBaseStage):
             df = cudf.from_pandas(df)
 
         # Convert the dataframe to cupy the same way cuml does
-        data = cp.asarray(df.to_cupy())
+        data = cp.asarray(df.to_cupy()).astype(typeid_to_numpy_str(input_type), copy=False)
 
         count = data.shape[0]
 
@@ -129,7 +146,10 @@ class PreprocessFILStage(PreprocessBaseStage):
         return x
 
     @staticmethod
-    def process_multi_message(x: MultiMessage, fea_len: int, fea_cols: typing.List[str]) -> MultiInferenceFILMessage:
+    def process_multi_message(x: MultiMessage,
+                              fea_len: int,
+                              fea_cols: typing.List[str],
+                              input_type: TypeId = TypeId.FLOAT32) -> MultiInferenceFILMessage:
         try:
             df = x.get_meta(fea_cols)
         except KeyError:
@@ -150,7 +170,7 @@ class PreprocessFILStage(PreprocessBaseStage):
             df = cudf.from_pandas(df)
 
         # Convert the dataframe to cupy the same way cuml does
-        data = cp.asarray(df.to_cupy())
+        data = cp.asarray(df.to_cupy()).astype(typeid_to_numpy_str(input_type), copy=False)
 
         count = data.shape[0]
 
@@ -169,10 +189,13 @@ class PreprocessFILStage(PreprocessBaseStage):
         self
     ) -> typing.Callable[[typing.Union[MultiMessage, ControlMessage]],
                          typing.Union[MultiInferenceMessage, ControlMessage]]:
-        return partial(PreprocessFILStage.pre_process_batch, fea_len=self._fea_length, fea_cols=self.features)
+        return partial(PreprocessFILStage.pre_process_batch,
+                       fea_len=self._fea_length,
+                       fea_cols=self.features,
+                       input_type=self._input_type)
 
     def _get_preprocess_node(self, builder: mrc.Builder):
         if (self._use_control_message):
-            return _stages.PreprocessFILControlMessageStage(builder, self.unique_name, self.features)
+            return _stages.PreprocessFILControlMessageStage(builder, self.unique_name, self.features, self._input_type)
 
-        return _stages.PreprocessFILMultiMessageStage(builder, self.unique_name, self.features)
+        return _stages.PreprocessFILMultiMessageStage(builder, self.unique_name, self.features, self._input_type)
@@ -29,6 +29,8 @@ import morpheus._lib.stages as _stages
 from morpheus.cli.register_stage import register_stage
 from morpheus.cli.utils import MorpheusRelativePath
 from morpheus.cli.utils import get_package_relative_file
+from morpheus.common import TypeId
+from morpheus.common import typeid_to_numpy_str
 from morpheus.config import Config
 from morpheus.config import PipelineModes
 from morpheus.messages import ControlMessage
@@ -72,6 +74,20 @@ def base64_to_cupyarray(base64_str):
     return cp_array
 
 
+def cast_token_ids(input_ids: cp.ndarray, input_ids_type: TypeId) -> cp.ndarray:
+    """
+    Casts the token ids to `input_ids_type`, raising a `ValueError` rather than wrapping ids which don't fit in it.
+    """
+    dtype = np.dtype(typeid_to_numpy_str(input_ids_type))
+    if (dtype.itemsize < input_ids.dtype.itemsize and input_ids.size > 0):
+        max_id = int(input_ids.max())
+        if (max_id > np.iinfo(dtype).max):
+            raise ValueError(f"Token id {max_id} does not fit in input_ids_type {input_ids_type}, "
+                             "use a wider type for this vocabulary")
+
+    return input_ids.astype(dtype)
+
+
 @register_stage(
     "preprocess",
     modes=[PipelineModes.NLP],
@@ -104,6 +120,13 @@ class PreprocessNLPStage(PreprocessBaseStage):
         the second sequence and so on until the entire sentence is encoded.
     column : str
         Name of the column containing the data that needs to be preprocessed.
+    input_ids_type : `morpheus.common.TypeId`, default = "int32"
+        Integral type of the `input_ids` tensor. Token ids fit in `int16` for vocabularies with fewer than 32768
+        entries, halving the size of the tensor sent to inference. A batch holding a token id which doesn't fit in the
+        type raises a `ValueError`. The inference stage widens the tensor back to the type expected by the model when
+        no data would be lost.
+    input_mask_type : `morpheus.common.TypeId`, default = "int32"
+        Integral type of the `input_mask` tensor. The mask only contains 0 and 1 values, allowing `int8` or `uint8`.
 
     """
 
@@ -114,9 +137,18 @@ class PreprocessNLPStage(PreprocessBaseStage):
                  do_lower_case: bool = False,
                  add_special_tokens: bool = False,
                  stride: int = -1,
-                 column: str = "data"):
+                 column: str = "data",
+                 input_ids_type: TypeId = TypeId.INT32,
+                 input_mask_type: TypeId = TypeId.INT32):
         super().__init__(c)
 
+        for type_id in (input_ids_type, input_mask_type):
+            if (not np.issubdtype(np.dtype(typeid_to_numpy_str(type_id)), np.integer)):
+                raise ValueError(f"Token tensors must be an integral type, got {type_id}")
+
+        self._input_ids_type = input_ids_type
+        self._input_mask_type = input_mask_type
+
         self._column = column
         self._seq_length = c.feature_length
         self._vocab_hash_file = get_package_relative_file(vocab_hash_file)
@@ -148,7 +180,10 @@ class PreprocessNLPStage(PreprocessBaseStage):
                           stride: int,
                           truncation: bool,
                           add_special_tokens: bool,
-                          column: str) -> typing.Union[MultiInferenceNLPMessage, ControlMessage]:
+                          column: str,
+                          input_ids_type: TypeId = TypeId.INT32,
+                          input_mask_type: TypeId = TypeId.INT32) -> typing.Union[MultiInferenceNLPMessage,
+                                                                                  ControlMessage]:
         """
         For NLP category use cases, this function performs pre-processing.
 
@@ -168,7 +203,9 @@ class PreprocessNLPStage(PreprocessBaseStage):
                                                               stride,
                                                               truncation,
                                                               add_special_tokens,
-                                                              column)
+                                                              column,
+                                                              input_ids_type,
+                                                              input_mask_type)
         if isinstance(message, MultiMessage):
             return PreprocessNLPStage.process_multi_message(message,
                                                             vocab_hash_file,
@@ -177,7 +214,9 @@ class PreprocessNLPStage(PreprocessBaseStage):
                                                             stride,
                                                             truncation,
                                                             add_special_tokens,
-                                                            column)
+                                                            column,
+                                                            input_ids_type,
+                                                            input_mask_type)
 
         raise TypeError("Unsupported message type")
 
@@ -189,7 +228,9 @@ class PreprocessNLPStage(PreprocessBaseStage):
                                 stride: int,
                                 truncation: bool,
                                 add_special_tokens: bool,
-                                column: str) -> ControlMessage:
+                                column: str,
+                                input_ids_type: TypeId = TypeId.INT32,
+                                input_mask_type: TypeId = TypeId.INT32) -> ControlMessage:
 
         with message.payload().mutable_dataframe() as mdf:
             text_series = cudf.Series(mdf[column])
@@ -204,12 +245,15 @@ class PreprocessNLPStage(PreprocessBaseStage):
 
         del text_series
 
+        input_ids = cast_token_ids(tokenized.input_ids, input_ids_type)
+        input_mask = tokenized.input_mask.astype(typeid_to_numpy_str(input_mask_type))
+
         # We need the C++ impl of TensorMemory until #1646 is resolved
         message.tensors(
             _messages.TensorMemory(count=tokenized.input_ids.shape[0],
                                    tensors={
-                                       "input_ids": tokenized.input_ids,
-                                       "input_mask": tokenized.input_mask,
+                                       "input_ids": input_ids,
+                                       "input_mask": input_mask,
                                        "seq_ids": tokenized.segment_ids
                                    }))
 
@@ -224,7 +268,9 @@ class PreprocessNLPStage(PreprocessBaseStage):
                               stride: int,
                               truncation: bool,
                               add_special_tokens: bool,
-                              column: str) -> MultiInferenceNLPMessage:
+                              column: str,
+                              input_ids_type: TypeId = TypeId.INT32,
+                              input_mask_type: TypeId = TypeId.INT32) -> MultiInferenceNLPMessage:
         # Existing logic for MultiMessage
         text_ser = cudf.Series(message.get_meta(column))
 
@@ -241,8 +287,8 @@ class PreprocessNLPStage(PreprocessBaseStage):
         seg_ids[:, 0] = seg_ids[:, 0] + message.mess_offset
 
         memory = InferenceMemoryNLP(count=tokenized.input_ids.shape[0],
-                                    input_ids=tokenized.input_ids,
-                                    input_mask=tokenized.input_mask,
+                                    input_ids=cast_token_ids(tokenized.input_ids, input_ids_type),
+                                    input_mask=tokenized.input_mask.astype(typeid_to_numpy_str(input_mask_type)),
                                     seq_ids=seg_ids)
 
         infer_message = MultiInferenceNLPMessage.from_message(message, memory=memory)
@@ -260,7 +306,9 @@ class PreprocessNLPStage(PreprocessBaseStage):
                        seq_len=self._seq_length,
                        truncation=self._truncation,
                        add_special_tokens=self._add_special_tokens,
-                       column=self._column)
+                       column=self._column,
+                       input_ids_type=self._input_ids_type,
+                       input_mask_type=self._input_mask_type)
 
     def _get_preprocess_node(self, builder: mrc.Builder):
         if (self._use_control_message):
@@ -272,7 +320,9 @@ class PreprocessNLPStage(PreprocessBaseStage):
                                                             self._do_lower_case,
                                                             self._add_special_tokens,
                                                             self._stride,
-                                                            self._column)
+                                                            self._column,
+                                                            self._input_ids_type,
+                                                            self._input_mask_type)
 
         return _stages.PreprocessNLPMultiMessageStage(builder,
                                                       self.unique_name,
@@ -282,4 +332,6 @@ class PreprocessNLPStage(PreprocessBaseStage):
                                                       self._do_lower_case,
                                                       self._add_special_tokens,
                                                       self._stride,
-                                                      self._column)
+                                                      self._column,
+                                                      self._input_ids_type,
+                                                      self._input_mask_type)
@@ -0,0 +1,246 @@
+# Copyright (c) 2024, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import collections
+import math
+import re
+import typing
+
+import mrc
+import numpy as np
+from mrc.core import operators as ops
+
+import cudf
+
+import morpheus._lib.stages as _stages
+from morpheus.config import Config
+from morpheus.messages import MessageMeta
+from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
+from morpheus.pipeline.single_port_stage import SinglePortStage
+
+FEATURE_TYPES = ("length", "entropy", "digit_ratio", "upper_ratio", "ngram_hash", "domain_label_count", "path_depth")
+
+# Features which are counts, stored as int32, the others are stored as float32
+_INTEGRAL_FEATURE_TYPES = ("length", "domain_label_count", "path_depth")
+
+
+def fnv1a_32(data: bytes) -> int:
+    """
+    32-bit FNV-1a hash, the hash used by the C++ implementation to assign n-grams to buckets.
+    """
+    value = 2166136261
+    for byte in data:
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+
+    return value
+
+
+def _count_segments(text: str, separators: str) -> int:
+    return sum(1 for segment in re.split(f"[{re.escape(separators)}]", text) if segment)
+
+
+def _url_host(text: str) -> str:
+    scheme_end = text.find("://")
+    if (scheme_end >= 0):
+        text = text[scheme_end + 3:]
+
+    text = re.match(r"[^/?#]*", text).group()
+    text = text[text.rfind("@") + 1:]
+
+    # IPv6 addresses are a single label
+    if (text.startswith("[")):
+        close = text.find("]")
+        return text if close < 0 else text[:close + 1]
+
+    return text.split(":", 1)[0]
+
+
+def _url_path(text: str) -> str:
+    scheme_end = text.find("://")
+    if (scheme_end >= 0):
+        text = text[scheme_end + 3:]
+
+        path_start = re.search(r"[/?#]", text)
+        text = "" if path_start is None else text[path_start.start():]
+        text = re.match(r"[^?#]*", text).group()
+
+    return text
+
+
+def _output_names(feature: dict) -> list[str]:
+    if (feature["type"] == "ngram_hash"):
+        return [f"{feature['name']}_{i}" for i in range(feature["num_buckets"])]
+
+    return [feature["name"]]
+
+
+def _extract(text: str, features: list[dict]) -> list[float]:
+    values = []
+    for feature in features:
+        feature_type = feature["type"]
+        if (feature_type == "ngram_hash"):
+            buckets = [0.0] * feature["num_buckets"]
+            n = feature["n"]
+            for i in range(len(text) - n + 1):
+                buckets[fnv1a_32(text[i:i + n].encode("utf-8")) % len(buckets)] += 1.0
+
+            values.extend(buckets)
+        elif (len(text) == 0):
+            values.append(0.0)
+        elif (feature_type == "length"):
+            values.append(float(len(text)))
+        elif (feature_type == "entropy"):
+            counts = collections.Counter(text).values()
+            values.append(-sum(count / len(text) * math.log2(count / len(text)) for count in counts))
+        elif (feature_type == "digit_ratio"):
+            values.append(sum(1 for c in text if "0" <= c <= "9") / len(text))
+        elif (feature_type == "upper_ratio"):
+            values.append(sum(1 for c in text if "A" <= c <= "Z") / len(text))
+        elif (feature_type == "domain_label_count"):
+            values.append(float(_count_segments(_url_host(text), ".")))
+        else:
+            values.append(float(_count_segments(_url_path(text), "/\\")))
+
+    return values
+
+
+class StringFeaturesStage(PassThruTypeMixin, SinglePortStage):
+    """
+    Compute numeric features of string columns, such as the entropy of a domain name or the depth of a URL path, and
+    append them to each message as int32 and float32 columns ready to be packed into the input tensor of a FIL or
+    autoencoder model by `PreprocessFILStage` or `PreprocessAEStage`. The stage is placed before `DeserializeStage`.
+
+    All of the features of a column are computed in a single pass over its strings. In C++ mode the strings are
+    processed on the host across `num_threads` threads, and the new columns are added without converting the
+    DataFrame in Python. Null and empty strings produce zero for every feature.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    features : typing.List[dict]
+        Features to compute, the output columns are appended in this order. Each is a dictionary with the keys:
+        - `column`: String column to compute the feature of.
+        - `type`: One of:
+            - `'length'`: Number of characters, int32.
+            - `'entropy'`: Shannon entropy in bits of the distribution of the characters, float32.
+            - `'digit_ratio'`: Fraction of the characters which are ASCII digits, float32.
+            - `'upper_ratio'`: Fraction of the characters which are ASCII uppercase letters, float32.
+            - `'ngram_hash'`: Counts of the character n-grams hashed into `num_buckets` buckets, stored as the float32
+              columns `name_0` to `name_{num_buckets - 1}`.
+            - `'domain_label_count'`: Number of dot separated labels of the host of a URL or domain name, int32.
+            - `'path_depth'`: Number of segments of the path of a URL or file path, int32.
+        - `name`: Name of the output column.
+        - `n`: Size of the n-grams of `'ngram_hash'`, defaults to 3.
+        - `num_buckets`: Number of buckets of `'ngram_hash'`, defaults to 16.
+    num_threads : int, default = 0
+        Number of host threads used to compute the features of a column in C++ mode, 0 uses the number of hardware
+        threads.
+    """
+
+    def __init__(self, c: Config, features: typing.List[dict], num_threads: int = 0):
+        super().__init__(c)
+
+        if (len(features) == 0):
+            raise ValueError("At least one feature is required")
+
+        self._features = []
+        output_names = set()
+        for feature in features:
+            feature = {"n": 3, "num_buckets": 16, **feature}
+            if (feature["type"] not in FEATURE_TYPES):
+                raise ValueError(f"Unknown string feature type '{feature['type']}', must be one of {FEATURE_TYPES}")
+
+            if (not feature.get("name")):
+                raise ValueError(f"A feature of column '{feature['column']}' has an empty name")
+
+            if (feature["type"] == "ngram_hash" and (feature["n"] <= 0 or feature["num_buckets"] <= 0)):
+                raise ValueError(
+                    f"The n-gram size and number of buckets of feature '{feature['name']}' must be positive")
+
+            for name in _output_names(feature):
+                if (name in output_names):
+                    raise ValueError(f"Duplicate feature column '{name}'")
+
+                output_names.add(name)
+
+            self._features.append(feature)
+
+        self._num_threads = num_threads
+
+    @property
+    def name(self) -> str:
+        return "string-features"
+
+    def accepted_types(self) -> typing.Tuple:
+        """
+        Accepted input types for this stage are returned.
+
+        Returns
+        -------
+        typing.Tuple[`morpheus.messages.MessageMeta`, ]
+            Accepted input types.
+
+        """
+        return (MessageMeta, )
+
+    def supports_cpp_node(self):
+        return True
+
+    def _on_data(self, message: MessageMeta) -> MessageMeta:
+        with message.mutable_dataframe() as df:
+            columns = {}
+            for column in dict.fromkeys(feature["column"] for feature in self._features):
+                if (column not in df.columns):
+                    raise ValueError(f"Column '{column}' not found")
+
+                features = [feature for feature in self._features if feature["column"] == column]
+
+                series = df[column]
+                if (isinstance(series, cudf.Series)):
+                    series = series.to_pandas()
+
+                if (series.dtype != object):
+                    raise ValueError(f"String features require a string column, column '{column}' is not")
+
+                names = [name for feature in features for name in _output_names(feature)]
+                values = np.array([_extract(text if isinstance(text, str) else "", features) for text in series],
+                                  dtype=np.float64).reshape(len(series), len(names))
+
+                i = 0
+                for feature in features:
+                    dtype = np.int32 if feature["type"] in _INTEGRAL_FEATURE_TYPES else np.float32
+                    for name in _output_names(feature):
+                        columns[name] = values[:, i].astype(dtype)
+                        i += 1
+
+            # Append the columns in the order of the features
+            for feature in self._features:
+                for name in _output_names(feature):
+                    if (name in df.columns):
+                        raise ValueError(f"Column already exists: {name}")
+
+                    df[name] = columns[name]
+
+        return message
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+        if self._build_cpp_node():
+            node = _stages.StringFeaturesStage(builder, self.unique_name, self._features, self._num_threads)
+        else:
+            node = builder.make_node(self.unique_name, ops.map(self._on_data))
+
+        builder.make_edge(input_node, node)
+
+        return node
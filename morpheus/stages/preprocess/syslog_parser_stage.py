@@ -0,0 +1,609 @@
+# Copyright (c) 2024, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import re
+import string
+import typing
+
+import mrc
+from mrc.core import operators as ops
+
+import cudf
+
+import morpheus._lib.stages as _stages
+from morpheus.common import TimestampParser
+from morpheus.config import Config
+from morpheus.messages import MessageMeta
+from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
+from morpheus.pipeline.single_port_stage import SinglePortStage
+
+HEADER_FIELDS = ("log_format",
+                 "log_format_version",
+                 "syslog_facility",
+                 "syslog_severity",
+                 "syslog_timestamp",
+                 "syslog_hostname",
+                 "syslog_app_name",
+                 "syslog_proc_id",
+                 "syslog_msg_id",
+                 "syslog_structured_data",
+                 "syslog_message",
+                 "device_vendor",
+                 "device_product",
+                 "device_version",
+                 "event_id",
+                 "event_name",
+                 "event_severity")
+
+EXTENSION_TYPES = ("str", "int", "float", "bool", "timestamp")
+EXTENSION_DTYPES = {"str": "str", "int": "int64", "float": "float64", "bool": "bool", "timestamp": "datetime64[ns]"}
+
+_HEADER_DTYPES = {"syslog_facility": "int32", "syslog_severity": "int32", "syslog_timestamp": "datetime64[ns]"}
+
+_MONTHS = ("Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec")
+_KEY_CHARS = frozenset(string.ascii_letters + string.digits + "_.-[]")
+
+_CEF_FIELDS = ("log_format_version",
+               "device_vendor",
+               "device_product",
+               "device_version",
+               "event_id",
+               "event_name",
+               "event_severity")
+_LEEF_FIELDS = ("log_format_version", "device_vendor", "device_product", "device_version", "event_id")
+
+# Numbers accepted by the C++ implementation, which uses `std::from_chars`
+_INT_RE = re.compile(r"[+-]?[0-9]+")
+_FLOAT_RE = re.compile(r"[+-]?([0-9]+\.?[0-9]*|\.[0-9]+)([eE][+-]?[0-9]+)?|[+-]?(inf|infinity|nan)", re.IGNORECASE)
+
+
+class _LogParseError(Exception):
+    pass
+
+
+def _is_digit(c: str) -> bool:
+    return "0" <= c <= "9"
+
+
+def _rfc3164_timestamp_length(text: str) -> int:
+    # `Mmm dd hh:mm:ss` with optional fractional seconds, or an ISO 8601 timestamp written by many devices instead
+    if (len(text) >= 11 and all(_is_digit(c) for c in text[:4]) and text[4] == "-" and text[7] == "-"
+            and text[10] == "T"):
+        end = text.find(" ")
+        return len(text) if end < 0 else end
+
+    if (len(text) < 15 or text[3] != " " or text[6] != " " or text[9] != ":" or text[12] != ":"):
+        return 0
+
+    if (text[:3] not in _MONTHS or not all(_is_digit(text[i]) for i in (5, 7, 8, 10, 11, 13, 14))
+            or (text[4] != " " and not _is_digit(text[4]))):
+        return 0
+
+    length = 15
+    if (length + 1 < len(text) and text[length] == "." and _is_digit(text[length + 1])):
+        length += 1
+        while (length < len(text) and _is_digit(text[length])):
+            length += 1
+
+    return length
+
+
+def _parse_syslog(line: str, header: dict) -> str:
+    rest = line
+    has_header = False
+
+    if (rest.startswith("<")):
+        close = rest.find(">")
+        if (close < 2 or close > 4 or not all(_is_digit(c) for c in rest[1:close]) or int(rest[1:close]) > 191):
+            raise _LogParseError("Invalid syslog priority")
+
+        priority = int(rest[1:close])
+        header["syslog_facility"] = priority // 8
+        header["syslog_severity"] = priority % 8
+        rest = rest[close + 1:]
+        has_header = True
+
+        # RFC 5424 headers start with a version, RFC 3164 headers with a timestamp
+        digits = 0
+        while (digits < len(rest) and digits < 3 and _is_digit(rest[digits])):
+            digits += 1
+
+        if (0 < digits < len(rest) and rest[digits] == " " and rest[0] != "0"):
+            rest = rest[digits + 1:]
+            header["log_format"] = "syslog"
+
+            for field in ("syslog_timestamp", "syslog_hostname", "syslog_app_name", "syslog_proc_id", "syslog_msg_id"):
+                end = rest.find(" ")
+                if (end <= 0):
+                    raise _LogParseError("Malformed RFC 5424 header")
+
+                if (rest[:end] != "-"):
+                    header[field] = rest[:end]
+
+                rest = rest[end + 1:]
+
+            pos = 0
+            if (rest.startswith("-")):
+                pos = 1
+            else:
+                while (pos < len(rest) and rest[pos] == "["):
+                    quoted = False
+                    pos += 1
+                    while (pos < len(rest) and (quoted or rest[pos] != "]")):
+                        if (quoted and rest[pos] == "\\"):
+                            pos += 1
+                        elif (rest[pos] == '"'):
+                            quoted = not quoted
+
+                        pos += 1
+
+                    if (pos >= len(rest)):
+                        raise _LogParseError("Malformed RFC 5424 structured data")
+
+                    pos += 1
+
+                if (pos == 0):
+                    raise _LogParseError("Malformed RFC 5424 structured data")
+
+                header["syslog_structured_data"] = rest[:pos]
+
+            rest = rest[pos:]
+            if (len(rest) == 0):
+                return rest
+
+            if (rest[0] != " "):
+                raise _LogParseError("Malformed RFC 5424 structured data")
+
+            # The message may start with a byte order mark
+            rest = rest[1:]
+            if (rest.startswith("\ufeff")):
+                rest = rest[1:]
+
+            header["syslog_message"] = rest
+
+            return rest
+
+    timestamp_length = _rfc3164_timestamp_length(rest)
+    if (timestamp_length > 0):
+        has_header = True
+        header["syslog_timestamp"] = rest[:timestamp_length]
+        rest = rest[timestamp_length + 1:]
+
+        # The hostname is missing when the timestamp is followed by the tag or the event
+        token = rest.split(" ", 1)[0]
+        if (len(token) > 0 and not token.endswith(":") and not token.startswith(("CEF:", "LEEF:"))):
+            header["syslog_hostname"] = token
+            rest = rest[len(token) + 1:]
+
+        # TAG, optionally followed by the process id in brackets, and a colon
+        token = rest.split(" ", 1)[0]
+        if (len(token) > 1 and token.endswith(":") and not token.startswith(("CEF:", "LEEF:"))):
+            rest = rest[len(token) + 1:]
+            token = token[:-1]
+
+            open_bracket = token.find("[")
+            if (open_bracket >= 0 and token.endswith("]")):
+                header["syslog_proc_id"] = token[open_bracket + 1:-1]
+                token = token[:open_bracket]
+
+            header["syslog_app_name"] = token
+
+    if (not has_header):
+        return line
+
+    # Without a timestamp the text following the priority is the message
+    header["log_format"] = "syslog"
+    header["syslog_message"] = rest
+
+    return rest
+
+
+def _unescape(text: str, is_extension: bool) -> str:
+    chars = []
+    i = 0
+    while (i < len(text)):
+        if (text[i] != "\\" or i + 1 == len(text)):
+            chars.append(text[i])
+            i += 1
+            continue
+
+        escaped = text[i + 1]
+        if (escaped == "\\" or (not is_extension and escaped == "|") or (is_extension and escaped == "=")):
+            chars.append(escaped)
+        elif (is_extension and escaped == "n"):
+            chars.append("\n")
+        elif (is_extension and escaped == "r"):
+            chars.append("\r")
+        else:
+            chars.append(text[i:i + 2])
+
+        i += 2
+
+    return "".join(chars)
+
+
+def _parse_cef(text: str, header: dict) -> str:
+    pos = 0
+    for field in _CEF_FIELDS:
+        start = pos
+        escaped = False
+        while (pos < len(text) and text[pos] != "|"):
+            if (text[pos] == "\\" and pos + 1 < len(text)):
+                escaped = True
+                pos += 1
+
+            pos += 1
+
+        if (pos >= len(text)):
+            raise _LogParseError("Malformed CEF header, expected 7 fields separated by '|'")
+
+        header[field] = _unescape(text[start:pos], False) if escaped else text[start:pos]
+        pos += 1
+
+    return text[pos:]
+
+
+def _parse_cef_extension(text: str, keys: set, values: dict):
+    # A key is a run of key characters preceded by a space or the start of the extension and followed by an unescaped
+    # '=', its value extends to the space preceding the next key
+    key = None
+    value_start = -1
+    escaped = False
+
+    pos = 0
+    while (pos < len(text)):
+        if (text[pos] == "\\"):
+            escaped = True
+            pos += 2
+            continue
+
+        if (text[pos] != "="):
+            pos += 1
+            continue
+
+        key_start = pos
+        while (key_start > 0 and text[key_start - 1] in _KEY_CHARS):
+            key_start -= 1
+
+        if (key_start == pos or (key_start > 0 and text[key_start - 1] != " ")
+                or (value_start >= 0 and key_start <= value_start)):
+            pos += 1
+            continue
+
+        if (value_start >= 0):
+            if (key in keys):
+                value = text[value_start:key_start].rstrip(" ")
+                values[key] = _unescape(value, True) if escaped else value
+        elif (len(text[:key_start].strip(" ")) > 0):
+            raise _LogParseError("Malformed CEF extension, expected key=value pairs")
+
+        key = text[key_start:pos]
+        value_start = pos + 1
+        escaped = False
+        pos += 1
+
+    if (value_start >= 0):
+        if (key in keys):
+            value = text[value_start:].rstrip(" ")
+            values[key] = _unescape(value, True) if escaped else value
+    elif (len(text.strip(" ")) > 0):
+        raise _LogParseError("Malformed CEF extension, expected key=value pairs")
+
+
+def _parse_leef(text: str, header: dict) -> typing.Tuple[str, str]:
+    pos = 0
+    for field in _LEEF_FIELDS:
+        end = text.find("|", pos)
+        if (end < 0):
+            raise _LogParseError("Malformed LEEF header, expected 5 fields separated by '|'")
+
+        header[field] = text[pos:end]
+        pos = end + 1
+
+    extension = text[pos:]
+    end = extension.find("|")
+
+    # A field holding '=' is already the extension of an event without a delimiter
+    if (not header["log_format_version"].startswith("2") or end < 0 or "=" in extension[:end]):
+        return (extension, "\t")
+
+    # The delimiter is a single character or its hexadecimal code, such as `0x5E` or `x5E`, tabs by default
+    spec = extension[:end]
+    delimiter = "\t"
+    if (len(spec) == 1):
+        delimiter = spec
+    elif (len(spec) > 0):
+        code = spec[2:] if spec.startswith(("0x", "0X")) else spec[1:] if spec.startswith(("x", "X")) else spec
+        if (len(code) == 0 or len(code) == len(spec) or not all(c in string.hexdigits for c in code)
+                or int(code, 16) > 255):
+            raise _LogParseError(f"Invalid LEEF delimiter '{spec}'")
+
+        delimiter = chr(int(code, 16))
+
+    return (extension[end + 1:], delimiter)
+
+
+def parse_log_line(line: str, keys: set) -> typing.Tuple[dict, dict]:
+    """
+    Parse a raw syslog, CEF or LEEF line, the same way as the C++ implementation of `SyslogParserStage`.
+
+    Parameters
+    ----------
+    line : str
+        Raw log line.
+    keys : set
+        Extension keys to return the values of.
+
+    Returns
+    -------
+    typing.Tuple[dict, dict]
+        The header fields present in the line, and the unescaped values of the extension keys present in the line.
+
+    Raises
+    ------
+    ValueError
+        When the line is malformed.
+    """
+    line = line.rstrip("\r\n")
+    header = {}
+    values = {}
+
+    try:
+        message = _parse_syslog(line, header).lstrip(" ")
+        if (message.startswith("CEF:")):
+            header["log_format"] = "cef"
+            _parse_cef_extension(_parse_cef(message[4:], header), keys, values)
+        elif (message.startswith("LEEF:")):
+            header["log_format"] = "leef"
+            (extension, delimiter) = _parse_leef(message[5:], header)
+            for pair in extension.split(delimiter):
+                # Pairs without a key are skipped
+                equals = pair.find("=")
+                if (equals > 0 and pair[:equals] in keys):
+                    values[pair[:equals]] = pair[equals + 1:]
+        elif ("log_format" not in header):
+            raise _LogParseError("Unrecognized log line, expected a syslog header or a CEF or LEEF event")
+    except _LogParseError as e:
+        raise ValueError(str(e)) from e
+
+    return (header, values)
+
+
+def convert_log_value(value: typing.Optional[str], value_type: str) -> typing.Any:
+    """
+    Convert a value the same way as the C++ implementation of the log parsing stages, returning `None` for values
+    which can't be converted. Timestamps are returned as they are, to be parsed by `TimestampParser`.
+
+    Parameters
+    ----------
+    value : typing.Optional[str]
+        Value to convert.
+    value_type : str
+        One of `EXTENSION_TYPES`.
+
+    Returns
+    -------
+    typing.Any
+        The converted value.
+    """
+    if (value is None or value_type in ("str", "timestamp")):
+        return value
+
+    if (value_type == "bool"):
+        return {"true": True, "1": True, "yes": True, "false": False, "0": False, "no": False}.get(value.lower())
+
+    value = value.strip(" ")
+    if (value_type == "int"):
+        if (_INT_RE.fullmatch(value) is None or not -2**63 <= int(value) < 2**63):
+            return None
+
+        return int(value)
+
+    if (_FLOAT_RE.fullmatch(value) is None):
+        return None
+
+    return float(value)
+
+
+class SyslogParserStage(PassThruTypeMixin, SinglePortStage):
+    """
+    Parse a column of raw log lines into header fields and CEF or LEEF extension values, appending them to each message
+    as typed columns. The stage is placed before `DeserializeStage`.
+
+    A line holds an RFC 5424 or RFC 3164 syslog header followed by a message, a bare CEF or LEEF event, or a syslog
+    header wrapping a CEF or LEEF event. The escapes of CEF are decoded, `\\|` and `\\\\` in the header and `\\=`,
+    `\\\\`, `\\n` and `\\r` in the extension. LEEF values are taken as they are, the extension is split on tabs or on
+    the delimiter declared by LEEF 2.0 events.
+
+    Lines which can't be parsed are null in every parsed column and the reason is written to `error_column`, which is
+    null for the other lines. Null lines are null in every column. In C++ mode the lines are parsed in a single pass on
+    the host across `num_threads` threads, and the new columns are added without converting the DataFrame in Python.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    column : str
+        String column holding the raw log lines.
+    header_fields : typing.List[str], default = None
+        Header fields to write, each to the column `{column_prefix}{field}`, all of them by default:
+        - `log_format`: `syslog`, `cef` or `leef`.
+        - `log_format_version`: Version of the CEF or LEEF event.
+        - `syslog_facility`, `syslog_severity`: Decoded from the priority, int32.
+        - `syslog_timestamp`: datetime64[ns], RFC 3164 timestamps are in the year `syslog_year`.
+        - `syslog_hostname`, `syslog_app_name`, `syslog_proc_id`, `syslog_msg_id`, `syslog_structured_data`: Fields of
+          the syslog header, the RFC 3164 TAG is the app name.
+        - `syslog_message`: Message following the syslog header, including the CEF or LEEF event.
+        - `device_vendor`, `device_product`, `device_version`, `event_id`: Fields of the CEF or LEEF header.
+        - `event_name`, `event_severity`: Fields of the CEF header.
+    extension_fields : typing.List[dict], default = None
+        Extension keys to write, after the header fields. Each is a dictionary with the keys:
+        - `key`: Key of the extension.
+        - `name`: Name of the output column, defaults to the key.
+        - `type`: One of `'str'`, `'int'` (int64), `'float'` (float64), `'bool'` and `'timestamp'` (datetime64[ns]),
+          defaults to `'str'`. Values which can't be converted are null.
+    column_prefix : str, default = ""
+        Prepended to the names of the header columns.
+    error_column : str, default = "parse_error"
+        Column holding the reason a line couldn't be parsed.
+    syslog_year : int, default = 0
+        Year of RFC 3164 timestamps, 0 infers the year from the current date.
+    num_threads : int, default = 0
+        Number of host threads used to parse the lines in C++ mode, 0 uses the number of hardware threads.
+    """
+
+    def __init__(self,
+                 c: Config,
+                 column: str,
+                 header_fields: typing.List[str] = None,
+                 extension_fields: typing.List[dict] = None,
+                 column_prefix: str = "",
+                 error_column: str = "parse_error",
+                 syslog_year: int = 0,
+                 num_threads: int = 0):
+        super().__init__(c)
+
+        self._column = column
+        self._header_fields = list(HEADER_FIELDS if header_fields is None else header_fields)
+        for field in self._header_fields:
+            if (field not in HEADER_FIELDS):
+                raise ValueError(f"Unknown log header field '{field}', must be one of {HEADER_FIELDS}")
+
+        self._extension_fields = []
+        for field in (extension_fields or []):
+            field = {"type": "str", **field}
+            if (not field.get("key")):
+                raise ValueError("Log extension keys can't be empty")
+
+            if (field["type"] not in EXTENSION_TYPES):
+                raise ValueError(f"Unknown log extension type '{field['type']}', must be one of {EXTENSION_TYPES}")
+
+            field["name"] = field.get("name") or field["key"]
+            self._extension_fields.append(field)
+
+        self._column_prefix = column_prefix
+        self._error_column = error_column
+
+        names = [column_prefix + field for field in self._header_fields]
+        names.extend(field["name"] for field in self._extension_fields)
+        names.append(error_column)
+        for (i, name) in enumerate(names):
+            if (name in names[:i]):
+                raise ValueError(f"Duplicate log column '{name}'")
+
+        self._syslog_year = syslog_year
+        self._num_threads = num_threads
+        self._timestamp_parser = None
+
+    @property
+    def name(self) -> str:
+        return "syslog-parser"
+
+    def accepted_types(self) -> typing.Tuple:
+        """
+        Accepted input types for this stage are returned.
+
+        Returns
+        -------
+        typing.Tuple[`morpheus.messages.MessageMeta`, ]
+            Accepted input types.
+
+        """
+        return (MessageMeta, )
+
+    def supports_cpp_node(self):
+        return True
+
+    def _parse_timestamps(self, name: str, values: list) -> cudf.Series:
+        if (self._timestamp_parser is None):
+            self._timestamp_parser = TimestampParser(syslog_year=self._syslog_year)
+
+        return cudf.Series(self._timestamp_parser.parse(name, values).view("datetime64[ns]"))
+
+    def _on_data(self, message: MessageMeta) -> MessageMeta:
+        with message.mutable_dataframe() as df:
+            if (self._column not in df.columns):
+                raise ValueError(f"Column '{self._column}' not found")
+
+            lines = df[self._column]
+            if (isinstance(lines, cudf.Series)):
+                lines = lines.to_pandas()
+
+            if (lines.dtype != object):
+                raise ValueError(f"Log parsing requires a string column, column '{self._column}' is not")
+
+            keys = {field["key"] for field in self._extension_fields}
+            header_values = {field: [] for field in self._header_fields}
+            extension_values = [[] for _ in self._extension_fields]
+            errors = []
+
+            for line in lines:
+                (header, values, error) = ({}, {}, None)
+                if (isinstance(line, str)):
+                    try:
+                        (header, values) = parse_log_line(line, keys)
+                    except ValueError as e:
+                        error = str(e)
+
+                for (field, column_values) in header_values.items():
+                    column_values.append(header.get(field))
+
+                for (field, column_values) in zip(self._extension_fields, extension_values):
+                    column_values.append(convert_log_value(values.get(field["key"]), field["type"]))
+
+                errors.append(error)
+
+            columns = {}
+            for (field, values) in header_values.items():
+                name = self._column_prefix + field
+                dtype = _HEADER_DTYPES.get(field, "str")
+                if (dtype == "datetime64[ns]"):
+                    columns[name] = self._parse_timestamps(name, values)
+                else:
+                    columns[name] = cudf.Series(values, dtype=dtype)
+
+            for (field, values) in zip(self._extension_fields, extension_values):
+                if (field["type"] == "timestamp"):
+                    columns[field["name"]] = self._parse_timestamps(field["name"], values)
+                else:
+                    columns[field["name"]] = cudf.Series(values, dtype=EXTENSION_DTYPES[field["type"]])
+
+            columns[self._error_column] = cudf.Series(errors, dtype="str")
+
+            for (name, series) in columns.items():
+                if (name in df.columns):
+                    raise ValueError(f"Column already exists: {name}")
+
+                series.index = df.index
+                df[name] = series
+
+        return message
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+        if self._build_cpp_node():
+            node = _stages.SyslogParserStage(builder,
+                                             self.unique_name,
+                                             column=self._column,
+                                             header_fields=self._header_fields,
+                                             extension_fields=self._extension_fields,
+                                             column_prefix=self._column_prefix,
+                                             error_column=self._error_column,
+                                             syslog_year=self._syslog_year,
+                                             num_threads=self._num_threads)
+        else:
+            node = builder.make_node(self.unique_name, ops.map(self._on_data))
+
+        builder.make_edge(input_node, node)
+
+        return node
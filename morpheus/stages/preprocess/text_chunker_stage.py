@@ -0,0 +1,179 @@
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import typing
+
+import mrc
+from mrc.core import operators as ops
+
+import cudf
+
+import morpheus._lib.stages as _stages
+from morpheus.cli.register_stage import register_stage
+from morpheus.common import TextLengthUnit
+from morpheus.common import TextSplitter
+from morpheus.config import Config
+from morpheus.config import PipelineModes
+from morpheus.messages import ControlMessage
+from morpheus.messages import MessageMeta
+from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
+from morpheus.pipeline.single_port_stage import SinglePortStage
+
+
+@register_stage("text-chunker", modes=[PipelineModes.FIL, PipelineModes.NLP, PipelineModes.OTHER])
+class TextChunkerStage(PassThruTypeMixin, SinglePortStage):
+    """
+    Split a text column into overlapping chunks, typically ahead of computing embeddings for a vector database.
+
+    Text is split on the first of `separators` which occurs in it, and consecutive pieces are merged into chunks of at
+    most `chunk_size`, repeating up to `chunk_overlap` of the previous chunk. Pieces which are still too large are
+    split again with the remaining separators. The chunks are identical to those of LangChain's
+    `RecursiveCharacterTextSplitter` configured with the same parameters.
+
+    The payload of each message is replaced with a table holding one row per chunk. The other columns of the payload
+    are repeated for each chunk of their row, and the position of the source row in the incoming payload and the
+    character offset of the chunk in the source text are added as the `row_id_column` and `offset_column` columns.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    column : str, default = "content"
+        String column holding the text to split.
+    chunk_size : int, default = 1024
+        Maximum size of a chunk, measured in `length_unit`.
+    chunk_overlap : int, default = 102
+        Maximum overlap between consecutive chunks, must not exceed `chunk_size`.
+    separators : typing.List[str], default = None, multiple = True
+        Separators tried in order, an empty separator splits between characters. Leave as None to use
+        `["\\n\\n", "\\n", " ", ""]`.
+    keep_separator : bool, default = True
+        Keep each separator at the start of the piece following it.
+    strip_whitespace : bool, default = True
+        Strip leading and trailing whitespace from each chunk.
+    length_unit : `morpheus.common.TextLengthUnit`, default = CHARACTERS
+        Unit of `chunk_size` and `chunk_overlap`, either characters or whitespace separated words. Words approximate a
+        token count without requiring a tokenizer.
+    row_id_column : str, default = "source_row_id"
+        Name of the output column holding the position of the source row.
+    offset_column : str, default = "chunk_offset"
+        Name of the output column holding the character offset of each chunk in its source text.
+    num_threads : int, default = 0
+        Number of host threads used to split each batch by the C++ implementation. Default is 0 which will use the
+        number of hardware threads.
+    """
+
+    def __init__(self,
+                 c: Config,
+                 column: str = "content",
+                 chunk_size: int = 1024,
+                 chunk_overlap: int = 102,
+                 separators: typing.List[str] = None,
+                 keep_separator: bool = True,
+                 strip_whitespace: bool = True,
+                 length_unit: TextLengthUnit = TextLengthUnit.CHARACTERS,
+                 row_id_column: str = "source_row_id",
+                 offset_column: str = "chunk_offset",
+                 num_threads: int = 0):
+        super().__init__(c)
+
+        self._column = column
+        self._chunk_size = chunk_size
+        self._chunk_overlap = chunk_overlap
+        self._separators = list(separators or [])
+        self._keep_separator = keep_separator
+        self._strip_whitespace = strip_whitespace
+        self._length_unit = length_unit
+        self._row_id_column = row_id_column
+        self._offset_column = offset_column
+        self._num_threads = num_threads
+
+        # Also validates the chunk size and overlap
+        self._splitter = TextSplitter(chunk_size=self._chunk_size,
+                                      chunk_overlap=self._chunk_overlap,
+                                      separators=self._separators,
+                                      keep_separator=self._keep_separator,
+                                      strip_whitespace=self._strip_whitespace,
+                                      length_unit=self._length_unit)
+
+    @property
+    def name(self) -> str:
+        return "text-chunker"
+
+    def accepted_types(self) -> typing.Tuple:
+        """
+        Accepted input types for this stage are returned.
+
+        Returns
+        -------
+        typing.Tuple[`morpheus.messages.ControlMessage`, ]
+            Accepted input types.
+
+        """
+        return (ControlMessage, )
+
+    def supports_cpp_node(self):
+        return True
+
+    def _on_data(self, message: ControlMessage) -> ControlMessage:
+        df = message.payload().copy_dataframe().to_pandas()
+
+        for name in (self._row_id_column, self._offset_column):
+            if name in df.columns:
+                raise ValueError(f"Output column '{name}' already exists")
+
+        rows = []
+        chunks = []
+        offsets = []
+        for (row, text) in enumerate(df[self._column]):
+            if not isinstance(text, str):
+                continue
+
+            for (chunk, offset) in self._splitter.split_text_with_offsets(text):
+                rows.append(row)
+                chunks.append(chunk)
+                offsets.append(offset)
+
+        chunked_df = df.iloc[rows].reset_index(drop=True)
+        chunked_df[self._column] = chunks
+        chunked_df[self._column] = chunked_df[self._column].astype("str")
+        chunked_df[self._row_id_column] = rows
+        chunked_df[self._offset_column] = offsets
+        chunked_df = chunked_df.astype({self._row_id_column: "int64", self._offset_column: "int64"})
+
+        message.payload(MessageMeta(cudf.from_pandas(chunked_df)))
+
+        return message
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+        if self._build_cpp_node():
+            node = _stages.TextChunkerStage(builder,
+                                            self.unique_name,
+                                            column=self._column,
+                                            chunk_size=self._chunk_size,
+                                            chunk_overlap=self._chunk_overlap,
+                                            separators=self._separators,
+                                            keep_separator=self._keep_separator,
+                                            strip_whitespace=self._strip_whitespace,
+                                            length_unit=self._length_unit,
+                                            row_id_column=self._row_id_column,
+                                            offset_column=self._offset_column,
+                                            num_threads=self._num_threads)
+        else:
+            node = builder.make_node(self.unique_name, ops.map(self._on_data))
+
+        builder.make_edge(input_node, node)
+
+        return node
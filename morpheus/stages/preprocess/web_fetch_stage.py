@@ -0,0 +1,208 @@
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import logging
+import typing
+from functools import partial
+
+import mrc
+from mrc.core import operators as ops
+
+import cudf
+
+import morpheus._lib.stages as _stages
+from morpheus.cli.register_stage import register_stage
+from morpheus.common import HtmlDocumentConverter
+from morpheus.common import WebFetcher
+from morpheus.config import Config
+from morpheus.config import PipelineModes
+from morpheus.messages import MessageMeta
+from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
+from morpheus.pipeline.single_port_stage import SinglePortStage
+from morpheus.utils.http_utils import fetch_with_requests
+from morpheus.utils.http_utils import make_fallback_session
+
+logger = logging.getLogger(__name__)
+
+
+@register_stage("web-fetch", modes=[PipelineModes.FIL, PipelineModes.NLP, PipelineModes.OTHER])
+class WebFetchStage(PassThruTypeMixin, SinglePortStage):
+    """
+    Fetch the web pages linked by a column of each message and extract their text, typically ahead of the
+    `TextChunkerStage` when building a vector database.
+
+    The `http` pages of a message are fetched concurrently without holding the GIL, over a pool of keep-alive
+    connections shared by all messages. Other URLs, such as `https` pages and redirects to them, are fetched with
+    `requests`. When `cache_dir` is set, pages served with an `ETag` or `Last-Modified` header are cached on disk and
+    only downloaded again once the server reports that they changed.
+
+    HTML pages are converted to text natively, other `text` types are kept as is. Each row whose page produced a
+    non-empty text is emitted with the text in `content_column`, along with the `final_url`, `status_code` and
+    `content_type` columns. Rows whose page couldn't be fetched or has another content type are logged and dropped.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    link_column : str, default = "link"
+        String column holding the URLs of the pages.
+    content_column : str, default = "page_content"
+        Column receiving the text of the pages.
+    remove_boilerplate : bool, default = True
+        Remove the navigation, headers, footers, sidebars and forms of HTML pages.
+    max_connections : int, default = 16
+        Maximum number of requests in flight at once.
+    timeout : float, default = 30.0
+        Timeout in seconds of each step of a request.
+    user_agent : str, default = "Morpheus"
+        Value of the `User-Agent` header.
+    max_redirects : int, default = 5
+        Maximum number of redirects followed for each URL.
+    max_body_size : int, default = 16777216
+        Maximum size in bytes of a page, larger pages are dropped.
+    cache_dir : str, default = None
+        Directory of the page cache, caching is disabled by default.
+    """
+
+    def __init__(self,
+                 c: Config,
+                 link_column: str = "link",
+                 content_column: str = "page_content",
+                 remove_boilerplate: bool = True,
+                 max_connections: int = 16,
+                 timeout: float = 30.0,
+                 user_agent: str = "Morpheus",
+                 max_redirects: int = 5,
+                 max_body_size: int = 16 * 1024 * 1024,
+                 cache_dir: str = None):
+        super().__init__(c)
+
+        if max_connections < 1:
+            raise ValueError("max_connections must be at least 1")
+
+        self._link_column = link_column
+        self._content_column = content_column
+        self._remove_boilerplate = remove_boilerplate
+
+        self._fetcher = WebFetcher(max_connections=max_connections,
+                                   timeout=timeout,
+                                   user_agent=user_agent,
+                                   max_redirects=max_redirects,
+                                   max_body_size=max_body_size,
+                                   cache_dir=cache_dir or "",
+                                   fallback_fn=partial(fetch_with_requests,
+                                                       user_agent=user_agent,
+                                                       timeout=timeout,
+                                                       max_redirects=max_redirects,
+                                                       max_body_size=max_body_size,
+                                                       session=make_fallback_session(max_connections)))
+
+        self._html_converter = HtmlDocumentConverter(remove_boilerplate=remove_boilerplate)
+
+    @property
+    def name(self) -> str:
+        return "web-fetch"
+
+    def accepted_types(self) -> typing.Tuple:
+        """
+        Accepted input types for this stage are returned.
+
+        Returns
+        -------
+        typing.Tuple[`morpheus.messages.MessageMeta`, ]
+            Accepted input types.
+
+        """
+        return (MessageMeta, )
+
+    def supports_cpp_node(self):
+        return True
+
+    def _extract_text(self, response: dict) -> typing.Optional[str]:
+        media_type = response["content_type"].split(";", 1)[0].strip().lower()
+        body: bytes = response["body"]
+
+        start = body[:1024].lower()
+        if (media_type in ("text/html", "application/xhtml+xml")
+                or (media_type == "" and (b"<html" in start or b"<!doctype html" in start))):
+            return "\n".join(text for text in self._html_converter.convert(body) if text)
+
+        if media_type == "" or media_type.startswith("text/"):
+            return body.decode("utf-8", errors="replace").removeprefix("\ufeff")
+
+        return None
+
+    def _on_data(self, message: MessageMeta) -> typing.Optional[MessageMeta]:
+        df = message.copy_dataframe()
+
+        # Null rows don't hold a link
+        links = df[self._link_column].to_arrow().to_pylist()
+        positions = [position for (position, link) in enumerate(links) if link is not None]
+        urls = [links[position] for position in positions]
+
+        rows = []
+        columns = {self._content_column: [], "final_url": [], "status_code": [], "content_type": []}
+
+        for (position, response) in zip(positions, self._fetcher.fetch(urls)):
+            if response["error"]:
+                logger.warning("Failed to fetch %s: %s", response["url"], response["error"])
+                continue
+
+            if not 200 <= response["status"] < 300:
+                logger.warning("Failed to fetch %s: status %d", response["url"], response["status"])
+                continue
+
+            try:
+                text = self._extract_text(response)
+            except Exception as e:  # pylint: disable=broad-exception-caught
+                logger.warning("Failed to extract the text of %s: %s", response["url"], e)
+                continue
+
+            if text is None:
+                logger.warning("Skipping %s, unsupported content type '%s'", response["url"], response["content_type"])
+                continue
+
+            if not text:
+                continue
+
+            rows.append(position)
+            columns[self._content_column].append(text)
+            columns["final_url"].append(response["final_url"])
+            columns["status_code"].append(response["status"])
+            columns["content_type"].append(response["content_type"])
+
+        if not rows:
+            return None
+
+        df = df.iloc[rows]
+        for (name, values) in columns.items():
+            df[name] = cudf.Series(values, index=df.index, dtype="int32" if name == "status_code" else "str")
+
+        return MessageMeta(df)
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+        if self._build_cpp_node():
+            node = _stages.WebFetchStage(builder,
+                                         self.unique_name,
+                                         fetcher=self._fetcher,
+                                         link_column=self._link_column,
+                                         content_column=self._content_column,
+                                         remove_boilerplate=self._remove_boilerplate)
+        else:
+            node = builder.make_node(self.unique_name, ops.map(self._on_data), ops.filter(lambda x: x is not None))
+
+        builder.make_edge(input_node, node)
+
+        return node
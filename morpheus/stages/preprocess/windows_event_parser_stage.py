@@ -0,0 +1,423 @@
+# Copyright (c) 2024, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import json
+import re
+import typing
+import xml.etree.ElementTree as ET
+
+import mrc
+from mrc.core import operators as ops
+
+import cudf
+
+import morpheus._lib.stages as _stages
+from morpheus.common import TimestampParser
+from morpheus.config import Config
+from morpheus.messages import MessageMeta
+from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
+from morpheus.pipeline.single_port_stage import SinglePortStage
+from morpheus.stages.preprocess.syslog_parser_stage import EXTENSION_DTYPES
+from morpheus.stages.preprocess.syslog_parser_stage import EXTENSION_TYPES
+from morpheus.stages.preprocess.syslog_parser_stage import convert_log_value
+
+# Deeper JSON events are rejected, the same as the C++ implementation
+_MAX_JSON_DEPTH = 64
+
+_EVENT_ID_RE = re.compile(r"-?[0-9]+")
+
+
+class _JsonObject(list):
+    """Members of a JSON object in document order, including repeated names."""
+
+
+def _local_name(name: str) -> str:
+    # ElementTree writes qualified names as `{uri}name`
+    return name.rsplit("}", 1)[-1].rsplit(":", 1)[-1]
+
+
+def _flatten_xml(element: ET.Element, path: typing.List[str], pairs: typing.List[typing.Tuple[str, str]]):
+    path.append(_local_name(element.tag))
+
+    # The System and EventData sections, and the UserData section along with its wrapper element, are left out
+    first = 1
+    if (len(path) > 1):
+        if (path[1] in ("System", "EventData")):
+            first = 2
+        elif (path[1] == "UserData"):
+            first = 3
+
+    data_name = None
+    if (len(path) == 3 and path[1] == "EventData" and path[2] == "Data"):
+        data_name = element.attrib.get("Name") or None
+
+    key = data_name if data_name is not None else ".".join(path[first:])
+    for (attribute, value) in element.attrib.items():
+        if (data_name is not None and attribute == "Name"):
+            continue
+
+        name = _local_name(attribute)
+        pairs.append((f"{key}.{name}" if key else name, value))
+
+    if (len(element) == 0):
+        pairs.append((key, element.text or ""))
+    else:
+        for child in element:
+            _flatten_xml(child, path, pairs)
+
+    path.pop()
+
+
+def _json_scalar(value: typing.Any) -> typing.Optional[str]:
+    if (isinstance(value, bool)):
+        return "true" if value else "false"
+
+    return value if isinstance(value, str) else None
+
+
+def _flatten_json(value: typing.Any,
+                  depth: int,
+                  path: typing.List[str],
+                  pairs: typing.List[typing.Tuple[str, str]]) -> typing.Optional[str]:
+    if (depth > _MAX_JSON_DEPTH):
+        raise ValueError("Malformed JSON event, nested too deeply")
+
+    if (isinstance(value, list) and not isinstance(value, _JsonObject)):
+        # The elements of an array share the path of the array
+        for item in value:
+            _flatten_json(item, depth + 1, path, pairs)
+
+        return None
+
+    if (not isinstance(value, _JsonObject)):
+        scalar = _json_scalar(value)
+        if (scalar is not None):
+            pairs.extend((".".join(path[i:]), scalar) for i in range(len(path)))
+
+        return scalar
+
+    # Members of objects produced from `Data` elements, such as `{"@Name": "LogonType", "#text": "2"}`
+    data_name = None
+    data_value = None
+    for (name, member) in value:
+        # Attribute names and text produced by XML converters
+        if (name.startswith("@")):
+            name = name[1:]
+
+        is_text = name == "#text"
+        if (not is_text):
+            path.append(name)
+
+        scalar = _flatten_json(member, depth + 1, path, pairs)
+        if (not is_text):
+            path.pop()
+
+        if (name == "Name"):
+            data_name = scalar
+        elif (is_text or name == "Value"):
+            data_value = scalar
+
+    if (data_name is not None and data_value is not None):
+        pairs.append((data_name, data_value))
+
+    return None
+
+
+def _reject_constant(name: str):
+    raise ValueError(f"Malformed JSON event, unexpected value '{name}'")
+
+
+def flatten_windows_event(event: str) -> typing.List[typing.Tuple[str, str]]:
+    """
+    Flatten a Windows event rendered as XML or JSON into `(key, value)` pairs in document order, the same way as the
+    C++ implementation of `WindowsEventParserStage`.
+
+    Parameters
+    ----------
+    event : str
+        Raw event.
+
+    Returns
+    -------
+    typing.List[typing.Tuple[str, str]]
+        The keys of the event along with their unconverted values. A key may appear more than once.
+
+    Raises
+    ------
+    ValueError
+        When the event is malformed.
+    """
+    event = event.removeprefix("\ufeff").strip(" \t\r\n")
+    pairs = []
+
+    if (event.startswith("<")):
+        try:
+            root = ET.fromstring(event)
+        except ET.ParseError as e:
+            raise ValueError(f"Malformed XML event, {e}") from e
+
+        _flatten_xml(root, [], pairs)
+    elif (event.startswith("{")):
+        try:
+            value = json.loads(event,
+                               object_pairs_hook=_JsonObject,
+                               parse_int=str,
+                               parse_float=str,
+                               parse_constant=_reject_constant)
+        except json.JSONDecodeError as e:
+            raise ValueError(f"Malformed JSON event, {e}") from e
+
+        _flatten_json(value, 0, [], pairs)
+    else:
+        raise ValueError("Unrecognized Windows event, expected XML or JSON")
+
+    return pairs
+
+
+class WindowsEventParserStage(PassThruTypeMixin, SinglePortStage):
+    """
+    Normalize a column of Windows events, rendered as XML or as JSON by collection agents such as Winlogbeat, into
+    typed columns appended to each message, ready for DFP style feature engineering. The stage is placed before
+    `DeserializeStage`.
+
+    The keys of an XML event are the dotted paths of its leaf elements below the root element, with the `System` and
+    `EventData` sections and the `UserData` section along with its wrapper element left out. An attribute is keyed by
+    its element followed by a dot and the attribute name, and the `Data` elements of `EventData` are keyed by their
+    `Name` attribute, so `EventID`, `TimeCreated.SystemTime`, `Security.UserID`, `TargetUserName` and
+    `RenderingInfo.Message` are all keys. Namespace prefixes are dropped.
+
+    The keys of a JSON event are the dotted paths of its scalar values, and a configured key matches a path equal to it
+    or ending with a dot followed by it, so both `event_data.LogonType` and `LogonType` match the Winlogbeat path
+    `winlog.event_data.LogonType`. The `@` prefix of attribute names and `#text` members produced by XML converters
+    are dropped, and an object holding a `Name` and a `#text` or `Value` member is also keyed by its name.
+
+    The first value of each column in document order is written. Values which can't be converted, and keys missing
+    from an event, are null. Events which can't be parsed are null in every parsed column and the reason is written to
+    `error_column`, which is null for the other events. Null events are null in every column. In C++ mode XML events
+    are read in a single pass without building a document, across `num_threads` host threads, and the new columns are
+    added without converting the DataFrame in Python. The C++ reader only checks the markup needed to flatten an event
+    and only decodes the values of configured keys, so it accepts some malformed events rejected in Python mode.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    column : str
+        String column holding the raw events.
+    fields : typing.List[dict]
+        Keys written for every event. Each is a dictionary with the keys:
+        - `key`: Flattened key of the event.
+        - `name`: Name of the output column, defaults to the key.
+        - `type`: One of `'str'`, `'int'` (int64), `'float'` (float64), `'bool'` and `'timestamp'` (datetime64[ns]),
+          defaults to `'str'`.
+    schemas : typing.Dict[int, typing.List[dict]], default = None
+        Keys written only for events of a given ID, in the same form as `fields`, by event ID. Fields naming the same
+        column, such as the fields of several event IDs, share it and must have the same type.
+    event_id_key : str, default = "EventID"
+        Key holding the ID of an event, such as `event_id` for Winlogbeat events.
+    error_column : str, default = "parse_error"
+        Column holding the reason an event couldn't be parsed.
+    num_threads : int, default = 0
+        Number of host threads used to parse the events in C++ mode, 0 uses the number of hardware threads.
+    """
+
+    def __init__(self,
+                 c: Config,
+                 column: str,
+                 fields: typing.List[dict],
+                 schemas: typing.Dict[int, typing.List[dict]] = None,
+                 event_id_key: str = "EventID",
+                 error_column: str = "parse_error",
+                 num_threads: int = 0):
+        super().__init__(c)
+
+        if (not event_id_key):
+            raise ValueError("The Windows event ID key can't be empty")
+
+        self._column = column
+        self._fields = [self._check_field(field) for field in fields]
+        self._schemas = {int(event_id): [self._check_field(field) for field in schema]
+                         for (event_id, schema) in (schemas or {}).items()}
+        self._event_id_key = event_id_key
+        self._error_column = error_column
+        self._num_threads = num_threads
+
+        # Columns in order of first appearance, and where the values of each key are written
+        self._columns = {}
+        self._targets = {event_id_key: []}
+        for (field, event_ids) in self._merged_fields():
+            if (self._columns.setdefault(field["name"], field["type"]) != field["type"]):
+                raise ValueError(f"The Windows event column '{field['name']}' is declared with different types")
+
+            self._targets.setdefault(field["key"], []).append((field["name"], field["type"], event_ids))
+
+        if (error_column in self._columns):
+            raise ValueError(f"Duplicate Windows event column '{error_column}'")
+
+        self._timestamp_parser = None
+
+    @staticmethod
+    def _check_field(field: dict) -> dict:
+        field = {"type": "str", **field}
+        if (not field.get("key")):
+            raise ValueError("Windows event keys can't be empty")
+
+        if (field["type"] not in EXTENSION_TYPES):
+            raise ValueError(f"Unknown Windows event type '{field['type']}', must be one of {EXTENSION_TYPES}")
+
+        field["name"] = field.get("name") or field["key"]
+
+        return field
+
+    def _merged_fields(self) -> typing.List[typing.Tuple[dict, typing.List[int]]]:
+        merged = [(field, []) for field in self._fields]
+
+        # A field declared by several schemas is kept once with all of their event IDs
+        for (event_id, schema) in self._schemas.items():
+            for field in schema:
+                found = next((event_ids for (other, event_ids) in merged
+                              if len(event_ids) > 0 and all(other[k] == field[k] for k in ("key", "name", "type"))),
+                             None)
+                if (found is None):
+                    merged.append((field, [event_id]))
+                else:
+                    found.append(event_id)
+
+        return merged
+
+    @property
+    def name(self) -> str:
+        return "windows-event-parser"
+
+    def accepted_types(self) -> typing.Tuple:
+        """
+        Accepted input types for this stage are returned.
+
+        Returns
+        -------
+        typing.Tuple[`morpheus.messages.MessageMeta`, ]
+            Accepted input types.
+
+        """
+        return (MessageMeta, )
+
+    def supports_cpp_node(self):
+        return True
+
+    def parse_event(self, event: str) -> dict:
+        """
+        Parse an event into the configured columns, the same way as the C++ implementation.
+
+        Parameters
+        ----------
+        event : str
+            Raw event.
+
+        Returns
+        -------
+        dict
+            The unconverted values of the columns found in the event, by column name.
+
+        Raises
+        ------
+        ValueError
+            When the event is malformed.
+        """
+        pairs = [(key, value) for (key, value) in flatten_windows_event(event) if key in self._targets]
+
+        event_id = None
+        for (key, value) in pairs:
+            if (key == self._event_id_key):
+                value = value.strip(" \t\r\n")
+                if (_EVENT_ID_RE.fullmatch(value) is not None and -2**63 <= int(value) < 2**63):
+                    event_id = int(value)
+
+                break
+
+        values = {}
+        for (key, value) in pairs:
+            for (name, _, event_ids) in self._targets[key]:
+                if (name in values or (len(event_ids) > 0 and event_id not in event_ids)):
+                    continue
+
+                values[name] = value
+
+        return values
+
+    def _on_data(self, message: MessageMeta) -> MessageMeta:
+        with message.mutable_dataframe() as df:
+            if (self._column not in df.columns):
+                raise ValueError(f"Column '{self._column}' not found")
+
+            events = df[self._column]
+            if (isinstance(events, cudf.Series)):
+                events = events.to_pandas()
+
+            if (events.dtype != object):
+                raise ValueError(f"Windows event parsing requires a string column, column '{self._column}' is not")
+
+            values = {name: [] for name in self._columns}
+            errors = []
+            for event in events:
+                (parsed, error) = ({}, None)
+                if (isinstance(event, str)):
+                    try:
+                        parsed = self.parse_event(event)
+                    except ValueError as e:
+                        error = str(e)
+
+                for (name, column_values) in values.items():
+                    column_values.append(convert_log_value(parsed.get(name), self._columns[name]))
+
+                errors.append(error)
+
+            columns = {}
+            for (name, column_values) in values.items():
+                value_type = self._columns[name]
+                if (value_type == "timestamp"):
+                    if (self._timestamp_parser is None):
+                        self._timestamp_parser = TimestampParser()
+
+                    timestamps = self._timestamp_parser.parse(name, column_values)
+                    columns[name] = cudf.Series(timestamps.view("datetime64[ns]"))
+                else:
+                    columns[name] = cudf.Series(column_values, dtype=EXTENSION_DTYPES[value_type])
+
+            columns[self._error_column] = cudf.Series(errors, dtype="str")
+
+            for (name, series) in columns.items():
+                if (name in df.columns):
+                    raise ValueError(f"Column already exists: {name}")
+
+                series.index = df.index
+                df[name] = series
+
+        return message
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+        if self._build_cpp_node():
+            node = _stages.WindowsEventParserStage(builder,
+                                                   self.unique_name,
+                                                   column=self._column,
+                                                   fields=self._fields,
+                                                   schemas=self._schemas,
+                                                   event_id_key=self._event_id_key,
+                                                   error_column=self._error_column,
+                                                   num_threads=self._num_threads)
+        else:
+            node = builder.make_node(self.unique_name, ops.map(self._on_data))
+
+        builder.make_edge(input_node, node)
+
+        return node
@@ -25,6 +25,8 @@ import pandas as pd
 
 import cudf
 
+from morpheus.common import TimestampParser
+
 if (typing.TYPE_CHECKING):
     with warnings.catch_warnings():
         # Ignore warning regarding tensorflow not being installed
@@ -359,6 +361,11 @@ class DateTimeColumn(RenameColumn):
     Subclass of `RenameColumn`, specific to casting UTC localized datetime values. When incoming values contain a
     time-zone offset string the values are converted to UTC, while values without a time-zone are assumed to be UTC.
 
+    String values are parsed by a native parser which detects the format of the column from a sample of the first
+    batch and caches it, supporting ISO-8601, RFC-2822, common log format, syslog, epoch seconds/milliseconds/
+    microseconds/nanoseconds and Windows FILETIME values. The rare values which the native parser can't handle are
+    parsed with `pandas.to_datetime`.
+
     Methods
     -------
     _process_column(df: pandas.DataFrame) -> pandas.Series
@@ -366,6 +373,14 @@ class DateTimeColumn(RenameColumn):
 
     """
 
+    _parser: TimestampParser = dataclasses.field(init=False, default=None, repr=False, compare=False)
+
+    def __getstate__(self):
+        # The native parser can't be pickled, the formats it detected are cheap to detect again
+        state = self.__dict__.copy()
+        state["_parser"] = None
+        return state
+
     def get_input_column_types(self) -> dict[str, str]:
         """
         Return a dictionary of input column names and types needed for processing. This is used for schema
@@ -373,6 +388,53 @@ class DateTimeColumn(RenameColumn):
         """
         return {self.input_name: ColumnInfo.convert_pandas_dtype(str)}
 
+    def parse_timestamps(self, series: pd.Series | cudf.Series) -> pd.Series | cudf.Series:
+        """
+        Parse the values of `series` into tz-naive UTC `datetime64[ns]` values.
+
+        Parameters
+        ----------
+        series : pandas.Series or cudf.Series
+            The input column.
+
+        Returns
+        -------
+        pandas.Series or cudf.Series
+            The parsed column, of the same type as `series`.
+        """
+        if (self._parser is None):
+            self._parser = TimestampParser()
+
+        if (isinstance(series, cudf.Series)):
+            if (series.dtype != "object"):
+                return series.astype("datetime64[ns]")
+
+            parsed = self._parser.parse_dataframe(cudf.DataFrame({self.input_name: series}),
+                                                  self.input_name)[self.input_name]
+            parsed.index = series.index
+
+            if ((parsed.isna() & series.notna()).any()):
+                parsed = cudf.from_pandas(self._parse_outliers(parsed.to_pandas(), series.to_pandas()))
+
+            return parsed
+
+        if (not (pd.api.types.is_object_dtype(series) or pd.api.types.is_string_dtype(series))):
+            return pd.to_datetime(series, utc=True).dt.tz_localize(None)
+
+        values = self._parser.parse(self.input_name, series.to_numpy(dtype=object))
+        parsed = pd.Series(values.view("datetime64[ns]"), index=series.index, name=series.name)
+
+        return self._parse_outliers(parsed, series)
+
+    @staticmethod
+    def _parse_outliers(parsed: pd.Series, series: pd.Series) -> pd.Series:
+        outliers = (parsed.isna() & series.notna()).to_numpy()
+        if (outliers.any()):
+            parsed = parsed.copy()
+            parsed[outliers] = pd.to_datetime(series[outliers], utc=True).dt.tz_localize(None).to_numpy()
+
+        return parsed
+
     def _process_column(self, df: pd.DataFrame) -> pd.Series:
         """
         Convert the values in the column to datetime and return the result as a Series.
@@ -388,14 +450,13 @@ class DateTimeColumn(RenameColumn):
             The processed column as a datetime Series.
         """
 
-        dt_series = pd.to_datetime(df[self.input_name], infer_datetime_format=True, utc=True)
+        dt_series = self.parse_timestamps(df[self.input_name])
 
         dtype = self.get_pandas_dtype()
         if dtype == 'datetime64[ns]':
-            # avoid deprecation warning about using .astype to convert from a tz-aware type to a tz-naive type
-            return dt_series.dt.tz_localize(None)
+            return dt_series
 
-        return dt_series.astype(dtype)
+        return dt_series.dt.tz_localize("UTC").astype(dtype)
 
 
 @dataclasses.dataclass
@@ -161,3 +161,58 @@ def prepare_url(url: str) -> str:
         logger.warning("No protocol scheme provided in URL, using: %s", url)
 
     return parsed_url.url
+
+
+def make_fallback_session(max_connections: int) -> requests.Session:
+    """
+    Create a `requests.Session` to be shared by the calls of `fetch_with_requests` made by a
+    `morpheus.common.WebFetcher`, which are concurrent, keeping up to `max_connections` connections to each host.
+    """
+    session = requests.Session()
+    adapter = requests.adapters.HTTPAdapter(pool_connections=max_connections, pool_maxsize=max_connections)
+    session.mount("http://", adapter)
+    session.mount("https://", adapter)
+
+    return session
+
+
+def fetch_with_requests(url: str,
+                        user_agent: str,
+                        timeout: float,
+                        max_redirects: int,
+                        max_body_size: int,
+                        headers: dict[str, str] = None,
+                        session: requests.Session = None) -> dict:
+    """
+    Fetch `url` with `requests`, returning the response in the form expected of the `fallback_fn` of
+    `morpheus.common.WebFetcher`, used for the URLs which it doesn't fetch natively such as `https` URLs.
+
+    `headers` are sent along with the `User-Agent` header, the fetcher passes the conditional headers of its cached
+    response. When `session` is given its connections are reused, otherwise a new session is used for the request.
+    """
+    if session is None:
+        with requests.Session() as new_session:
+            return fetch_with_requests(url,
+                                       user_agent=user_agent,
+                                       timeout=timeout,
+                                       max_redirects=max_redirects,
+                                       max_body_size=max_body_size,
+                                       headers=headers,
+                                       session=new_session)
+
+    session.max_redirects = max_redirects
+    response = session.get(url, headers={**(headers or {}), "User-Agent": user_agent}, timeout=timeout, stream=True)
+
+    with response:
+        body = response.raw.read(max_body_size + 1, decode_content=True)
+        if len(body) > max_body_size:
+            raise ValueError(f"The page exceeds the maximum size of {max_body_size} bytes")
+
+        return {
+            "status": response.status_code,
+            "content_type": response.headers.get("Content-Type", ""),
+            "body": body,
+            "final_url": response.url,
+            "etag": response.headers.get("ETag"),
+            "last_modified": response.headers.get("Last-Modified")
+        }
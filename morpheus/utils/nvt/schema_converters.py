@@ -337,7 +337,9 @@ ColumnInfoProcessingMap = {
         lambda ci,
         deps: [
             Rename(f=lambda name: ci.name if name == ci.input_name else name),
-            LambdaOp(lambda series: series.astype(ci.dtype), dtype=ci.dtype, label=f"[DateTimeColumn] '{ci.name}'")
+            LambdaOp(lambda series: ci.parse_timestamps(series).astype(ci.dtype),
+                     dtype=ci.dtype,
+                     label=f"[DateTimeColumn] '{ci.name}'")
         ],
     IncrementColumn:
         lambda ci,
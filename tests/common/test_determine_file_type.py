@@ -23,7 +23,7 @@ from morpheus.common import determine_file_type
 @pytest.mark.parametrize("use_pathlib", [False, True])
 @pytest.mark.parametrize("ext, expected_result",
                          [("csv", FileTypes.CSV), ("json", FileTypes.JSON), ("jsonlines", FileTypes.JSON),
-                          ("parquet", FileTypes.PARQUET)])
+                          ("parquet", FileTypes.PARQUET), ("avro", FileTypes.AVRO)])
 def test_determine_file_type(ext: str, expected_result: FileTypes, use_pathlib: bool):
     file_path = f"test.{ext}"
     if use_pathlib:
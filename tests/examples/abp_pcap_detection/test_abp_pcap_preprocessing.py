@@ -31,6 +31,10 @@ from morpheus.config import PipelineModes
 from morpheus.messages import MessageMeta
 from morpheus.messages import MultiInferenceFILMessage
 from morpheus.messages import MultiMessage
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.preprocess.deserialize_stage import DeserializeStage
 
 
 def check_inf_message(msg: MultiInferenceFILMessage,
@@ -128,3 +132,54 @@ def test_abp_pcap_preprocessing(config: Config, dataset_cudf: DatasetManager,
                       expected_flow_ids=expected_flow_ids[10:],
                       expected_rollup_time='2021-04-07 15:55',
                       expected_input__0=expected_input__0[10:])
+
+
+@pytest.mark.use_cpp
+@pytest.mark.import_mod([os.path.join(TEST_DIRS.examples_dir, 'abp_pcap_detection/abp_pcap_preprocessing.py')])
+def test_abp_pcap_preprocessing_cpp_pipe(config: Config,
+                                         dataset_cudf: DatasetManager,
+                                         import_mod: typing.List[types.ModuleType]):
+    config.mode = PipelineModes.FIL
+    config.feature_length = 13
+    config.pipeline_batch_size = 10
+
+    abp_pcap_preprocessing = import_mod[0]
+
+    input_file = os.path.join(TEST_DIRS.tests_data_dir, 'examples/abp_pcap_detection/abp_pcap.jsonlines')
+    input_df = dataset_cudf.get_df(input_file, no_cache=True, filter_nulls=False)
+
+    expected_flow_ids = input_df.src_ip + ":" + input_df.src_port + "=" + input_df.dest_ip + ":" + input_df.dest_port
+    expected_input__0 = cp.asarray(np.loadtxt(os.path.join(TEST_DIRS.tests_data_dir,
+                                                           'examples/abp_pcap_detection/abp_pcap_expected_input_0.csv'),
+                                              delimiter=",",
+                                              skiprows=0,
+                                              dtype=np.float32),
+                                   order='C')
+
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [input_df]))
+    pipe.add_stage(DeserializeStage(config))
+    pipe.add_stage(abp_pcap_preprocessing.AbpPcapPreprocessingStage(config))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    messages = sink.get_messages()
+    assert [msg.mess_offset for msg in messages] == [0, 10]
+
+    # The native stage aggregates each message on its own, matching `pre_process_batch`
+    for msg in messages:
+        start = msg.mess_offset
+        stop = start + msg.mess_count
+
+        df = msg.get_meta()
+        assert (df.flow_id == expected_flow_ids[start:stop]).all()
+        assert (df.rollup_time == '2021-04-07 15:55').all()
+
+        input__0 = msg.memory.get_tensor('input__0')
+        assert input__0.shape == (msg.mess_count, config.feature_length)
+        assert input__0.dtype == cp.float32
+        assert (input__0 == expected_input__0[start:stop]).all()
+
+        seq_ids = msg.memory.get_tensor('seq_ids')
+        assert (seq_ids[:, 0] == cp.arange(start, stop)).all()
+        assert (seq_ids[:, 2] == config.feature_length - 1).all()
@@ -281,3 +281,56 @@ def test_get_or_create_dataframe_from_batch_none_noop(mock_obf_to_df: mock.Magic
     mock_dask_config.assert_not_called()
 
     assert os.listdir(tmp_path) == []
+
+
+@pytest.mark.usefixtures("restore_environ")
+@mock.patch('morpheus.controllers.file_to_df_controller.single_object_to_dataframe')
+@mock.patch('morpheus.controllers.file_to_df_controller.process_dataframe')
+def test_get_or_create_dataframe_from_batch_native_cache(mock_proc_df: mock.MagicMock,
+                                                         mock_obf_to_df: mock.MagicMock,
+                                                         config: Config,
+                                                         tmp_path: str,
+                                                         dataset_pandas: DatasetManager):
+    from dfp.stages.dfp_file_to_df import DFPFileToDataFrameStage
+    config.ae.timestamp_column_name = 'v1'
+    mock_proc_df.side_effect = lambda df_in, input_schema: df_in
+    mock_obf_to_df.side_effect = lambda file_object, **kwargs: pd.read_csv(file_object.path)
+
+    # Split the input across two files
+    df = dataset_pandas['filter_probs.csv']
+    input_files = []
+    for (i, file_df) in enumerate([df.iloc[:10], df.iloc[10:]]):
+        input_file = os.path.join(tmp_path, f"input_{i}.csv")
+        file_df.to_csv(input_file, index=False)
+        input_files.append(input_file)
+
+    os.environ['MORPHEUS_FILE_DOWNLOAD_TYPE'] = "single_thread"
+    stage = DFPFileToDataFrameStage(config,
+                                    DataFrameInputSchema(),
+                                    cache_dir=os.path.join(tmp_path, "cache"),
+                                    native_cache_max_bytes=1 << 20)
+    controller = stage._controller
+
+    file_specs = fsspec.open_files(input_files)
+    first_batch = fsspec.core.OpenFiles(file_specs[:1], fs=file_specs.fs)
+
+    (_, cache_hit) = controller._get_or_create_dataframe_from_batch((first_batch, 1))
+    assert not cache_hit
+    assert mock_obf_to_df.call_count == 1
+
+    # The batch overlaps the first one, only the file which isn't cached yet is read
+    (_, cache_hit) = controller._get_or_create_dataframe_from_batch((file_specs, 2))
+    assert not cache_hit
+    assert mock_obf_to_df.call_count == 2
+
+    (output_df, cache_hit) = controller._get_or_create_dataframe_from_batch((file_specs, 3))
+    assert cache_hit
+    assert mock_obf_to_df.call_count == 2
+
+    # No batch pickles are written when the native cache is used
+    assert not os.path.exists(os.path.join(controller._cache_dir, "batches"))
+    assert controller._native_cache.stats()["entries"] == 2
+
+    expected_df = df.sort_values(by=['v1']).reset_index(drop=True)
+    expected_df['batch_count'] = 3
+    dataset_pandas.assert_df_equal(output_df.drop(columns=["origin_hash"]), expected_df)
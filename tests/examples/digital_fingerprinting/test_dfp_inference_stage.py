@@ -127,3 +127,67 @@ def test_on_data_get_model_error(
 
     stage = DFPInferenceStage(config, model_name_formatter="test_model_name-{user_id}")
     assert stage.on_data(dfp_multi_message) is None
+
+
+def test_on_data_model_dir(
+        config: Config,
+        mock_model_manager: mock.MagicMock,
+        dfp_multi_message: "MultiDFPMessage",  # noqa: F821
+        tmp_path: str):
+    from dfp.stages.dfp_inference_stage import DFPInferenceStage
+
+    # Only the model of the fallback user exists, the registry resolves the user to it
+    (tmp_path / f"test_model_name-{config.ae.fallback_username}").write_bytes(b"serialized model")
+
+    expected_results = list(range(1000, dfp_multi_message.mess_count + 1000))
+
+    mock_model = mock.MagicMock()
+    mock_model.get_results.return_value = pd.DataFrame({"results": expected_results})
+
+    stage = DFPInferenceStage(config, model_name_formatter="test_model_name-{user_id}", model_dir=str(tmp_path))
+
+    with mock.patch("dfp.stages.dfp_inference_stage.torch.load", return_value=mock_model) as mock_load:
+        results = stage.on_data(dfp_multi_message)
+
+    assert mock_load.call_args[0][0].getvalue() == b"serialized model"
+    mock_model_manager.load_user_model.assert_not_called()
+
+    results_df = results.get_meta()
+    assert results_df["results"].tolist() == expected_results
+    assert (results_df["model_version"] == f"test_model_name-{config.ae.fallback_username}").all()
+
+    stats = stage.model_registry.stats()
+    assert stats["loads"] == 1
+    assert stats["resident_models"] == 1
+
+
+def test_on_data_model_dir_cached(config: Config, dfp_multi_message: "MultiDFPMessage", tmp_path: str):  # noqa: F821
+    from dfp.stages.dfp_inference_stage import DFPInferenceStage
+
+    (tmp_path / f"test_model_name-{config.ae.fallback_username}").write_bytes(b"serialized model")
+
+    mock_model = mock.MagicMock()
+    mock_model.get_results.return_value = pd.DataFrame({"results": list(range(dfp_multi_message.mess_count))})
+
+    stage = DFPInferenceStage(config, model_name_formatter="test_model_name-{user_id}", model_dir=str(tmp_path))
+
+    with mock.patch("dfp.stages.dfp_inference_stage.torch.load", return_value=mock_model) as mock_load:
+        assert stage.on_data(dfp_multi_message) is not None
+        assert stage.on_data(dfp_multi_message) is not None
+
+        # Another user without a model shares the deserialized model of the fallback user
+        (model, model_name) = stage._load_local_model("other-user")  # pylint: disable=protected-access
+
+    mock_load.assert_called_once()
+    assert model is mock_model
+    assert model_name == f"test_model_name-{config.ae.fallback_username}"
+    assert stage.model_registry.stats()["hits"] == 1
+
+
+def test_model_dir_outside(config: Config, tmp_path: str):
+    from dfp.stages.dfp_inference_stage import DFPInferenceStage
+
+    stage = DFPInferenceStage(config, model_dir=str(tmp_path))
+
+    with pytest.raises(ValueError):
+        stage._load_local_model("../../etc/passwd")  # pylint: disable=protected-access
@@ -48,7 +48,7 @@ def test_process_events_on_data(mock_datetime: mock.MagicMock,
     mock_dt_obj.strftime.return_value = '2021-01-01T00:00:00Z'
     mock_datetime.now.return_value = mock_dt_obj
 
-    # post-process should replace nans, lets add a nan to the DF
+    # post-process should leave nans in place, lets add a nan to the DF
     with dfp_multi_ae_message.meta.mutable_dataframe() as df:
         df.loc[10, 'v2'] = np.nan
         df['event_time'] = ''
@@ -65,7 +65,104 @@ def test_process_events_on_data(mock_datetime: mock.MagicMock,
     assert isinstance(dfp_multi_ae_message, MultiAEMessage)
     result_df = dfp_multi_ae_message.meta.copy_dataframe()
     assert (result_df['event_time'] == '2021-01-01T00:00:00Z').all()
-    assert result_df['v2'][10] == 'NaN'
+    assert np.isnan(result_df['v2'][10])
+
+
+@pytest.mark.parametrize('z_score_threshold', [None, 0.5])
+def test_process_events_scores(config: Config, dfp_multi_ae_message: MultiAEMessage, z_score_threshold: float):
+    from dfp.stages.dfp_postprocessing_stage import DFPPostprocessingStage
+
+    from morpheus.models.dfencoder.scalers import StandardScaler
+
+    config.ae.feature_columns = ['v1', 'v2']
+
+    scaler = StandardScaler()
+    scaler.mean = 0.25
+    scaler.std = 0.5
+    dfp_multi_ae_message.model.feature_loss_stats = {ft: {'scaler': scaler} for ft in config.ae.feature_columns}
+
+    with dfp_multi_ae_message.meta.mutable_dataframe() as df:
+        for ft in config.ae.feature_columns:
+            df[f'{ft}_loss'] = df[ft]
+            df[f'{ft}_z_loss'] = 0.0
+        df['max_abs_z'] = 0.0
+        df['mean_abs_z'] = 0.0
+        df['event_time'] = ''
+
+        expected_z = ((df[['v1', 'v2']] - 0.25) / 0.5).abs()
+
+    expected_df = df.copy(deep=True)
+    expected_df['v1_z_loss'] = expected_z['v1']
+    expected_df['v2_z_loss'] = expected_z['v2']
+    expected_df['max_abs_z'] = expected_z.max(axis=1)
+    expected_df['mean_abs_z'] = expected_z.mean(axis=1)
+    if z_score_threshold is not None:
+        expected_df = expected_df[expected_df['mean_abs_z'] > z_score_threshold]
+
+    stage = DFPPostprocessingStage(config, z_score_threshold=z_score_threshold)
+    result = stage.on_data(dfp_multi_ae_message)
+
+    assert isinstance(result, MultiAEMessage)
+    assert result.meta.user_id == dfp_multi_ae_message.meta.user_id
+
+    result_df = result.meta.copy_dataframe()
+    assert result_df.index.tolist() == expected_df.index.tolist()
+    for col in ['v1_z_loss', 'v2_z_loss', 'max_abs_z', 'mean_abs_z']:
+        np.testing.assert_allclose(result_df[col].to_numpy(), expected_df[col].to_numpy())
+
+
+@pytest.mark.parametrize('z_score_threshold', [None, 0.5])
+def test_process_events_reuses_scores(config: Config, dfp_multi_ae_message: MultiAEMessage, z_score_threshold: float):
+    from dfp.stages.dfp_postprocessing_stage import DFPPostprocessingStage
+
+    config.ae.feature_columns = ['v1', 'v2']
+
+    # Scores written by the inference stage are kept as is, the losses are not scored again
+    with dfp_multi_ae_message.meta.mutable_dataframe() as df:
+        for ft in config.ae.feature_columns:
+            df[f'{ft}_loss'] = df[ft]
+            df[f'{ft}_z_loss'] = df[ft].abs()
+        df['max_abs_z'] = df[['v1_z_loss', 'v2_z_loss']].max(axis=1)
+        df['mean_abs_z'] = df[['v1_z_loss', 'v2_z_loss']].mean(axis=1)
+        df['z_loss_scaler_type'] = 'standard'
+        df['event_time'] = ''
+
+    expected_df = df.copy(deep=True)
+    if z_score_threshold is not None:
+        expected_df = expected_df[expected_df['mean_abs_z'] > z_score_threshold]
+
+    stage = DFPPostprocessingStage(config, z_score_threshold=z_score_threshold)
+    stage._scorer = mock.MagicMock(wraps=stage._scorer)
+    result = stage.on_data(dfp_multi_ae_message)
+    stage._scorer.score.assert_not_called()
+
+    assert isinstance(result, MultiAEMessage)
+
+    result_df = result.meta.copy_dataframe()
+    assert result_df.index.tolist() == expected_df.index.tolist()
+    for col in ['v1_z_loss', 'v2_z_loss', 'max_abs_z', 'mean_abs_z']:
+        np.testing.assert_allclose(result_df[col].to_numpy(), expected_df[col].to_numpy())
+
+
+@pytest.mark.parametrize('z_score_threshold', [None, 0.5])
+def test_process_events_missing_losses(config: Config, dfp_multi_ae_message: MultiAEMessage, z_score_threshold: float):
+    from dfp.stages.dfp_postprocessing_stage import DFPPostprocessingStage
+
+    config.ae.feature_columns = ['v1', 'v2']
+    stage = DFPPostprocessingStage(config, z_score_threshold=z_score_threshold)
+
+    # Without the loss columns the anomalies can't be selected, passing every row through would hide that
+    if z_score_threshold is not None:
+        with pytest.raises(ValueError, match="v1_loss"):
+            stage.on_data(dfp_multi_ae_message)
+    else:
+        with mock.patch("dfp.stages.dfp_postprocessing_stage.logger") as mock_logger:
+            assert stage.on_data(dfp_multi_ae_message) is dfp_multi_ae_message
+            assert stage.on_data(dfp_multi_ae_message) is dfp_multi_ae_message
+
+        # Warned about once rather than for every message
+        mock_logger.warning.assert_called_once()
+        assert "v1_loss" in mock_logger.warning.call_args[0][1]
 
 
 def test_on_data_none(config: Config):
@@ -78,3 +78,13 @@ def test_serializers(dataset: DatasetManager,
     result_df = deserialize_fn(results, **deserialize_kwargs)
 
     dataset.assert_compare_df(df, result_df)
+
+
+@pytest.mark.parametrize("na_rep", ["", "NaN"])
+def test_df_to_csv_na_rep(dataset: DatasetManager, na_rep: str):
+    df = dataset['filter_probs.csv']
+    df.iloc[1, 0] = None
+
+    results = df_to_csv(df, include_header=True, include_index_col=False, na_rep=na_rep)
+
+    assert results[2].startswith(f"{na_rep},")
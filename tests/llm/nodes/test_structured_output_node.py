@@ -0,0 +1,67 @@
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+
+from _utils.llm import execute_node
+from morpheus.llm import LLMNodeBase
+from morpheus.llm import StructuredOutputError
+from morpheus.llm import StructuredOutputNode
+
+SCHEMA = {"severity": int, "malicious": "bool", "summary": "str", "tags": list}
+
+
+def test_constructor():
+    node = StructuredOutputNode(SCHEMA)
+    assert isinstance(node, LLMNodeBase)
+
+
+def test_get_input_names():
+    assert StructuredOutputNode(SCHEMA).get_input_names() == ["response"]
+    assert StructuredOutputNode(SCHEMA, input_name="generated").get_input_names() == ["generated"]
+
+
+@pytest.mark.parametrize("schema", [{}, {"a": "tuple"}, {"error_code": "int"}])
+def test_constructor_errors(schema: dict):
+    with pytest.raises(ValueError):
+        StructuredOutputNode(schema)
+
+
+def test_execute():
+    responses = [
+        '```json\n{"severity": "4", "malicious": True, "summary": "Port scan", "tags": ["recon",],}\n```',
+        "Severity: 2\nMalicious: no\nSummary: Benign login",
+        "I'm sorry, I can't help with that.",
+        '{"severity": 1, "malicious": ',
+        "{severity: 3, malicious: false}",
+        '{"severity": "high", "malicious": false, "summary": "Unknown"}',
+    ]
+
+    node = StructuredOutputNode(SCHEMA, required=["severity", "malicious", "summary"])
+
+    assert execute_node(node, response=responses) == {
+        "severity": [4, 2, None, None, 3, None],
+        "malicious": [True, False, None, None, False, False],
+        "summary": ["Port scan", "Benign login", None, None, None, "Unknown"],
+        "tags": [["recon"], None, None, None, None, None],
+        "error_code": [
+            int(StructuredOutputError.OK),
+            int(StructuredOutputError.OK),
+            int(StructuredOutputError.NO_STRUCTURE),
+            int(StructuredOutputError.MALFORMED),
+            int(StructuredOutputError.MISSING_FIELD),
+            int(StructuredOutputError.TYPE_MISMATCH),
+        ]
+    }
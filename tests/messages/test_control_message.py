@@ -480,3 +480,49 @@ def test_tasks_hold_non_serializable_python_obj(py_object):
 
     # Check that the nested non-serializable object is the same
     assert obj is metadata_dict_with_obj["nested_obj"]
+
+
+@pytest.mark.usefixtures("config_only_cpp")
+def test_set_and_get_attachment():
+    message = messages.ControlMessage()
+    data = bytes(range(256)) * 4
+
+    message.set_attachment("model", data)
+    assert message.has_attachment("model")
+    assert not message.has_metadata("model")
+    assert message.list_attachments() == ["model"]
+
+    attachment = message.get_attachment("model")
+    assert isinstance(attachment, messages.MessageAttachment)
+    assert not attachment.is_device
+    assert len(attachment) == len(data)
+    assert attachment.to_bytes() == data
+
+    # The buffer protocol exposes the data without copying it
+    view = memoryview(attachment)
+    assert view.readonly
+    assert view.tobytes() == data
+
+    assert message.get_attachment("missing") is None
+    assert message.get_attachment("missing", "default") == "default"
+
+    # Copies of the message share the attachment
+    message_copy = message.copy()
+    assert message_copy.get_attachment("model").to_bytes() == data
+    assert message_copy.remove_attachment("model") is not None
+    assert not message_copy.has_attachment("model")
+    assert message.has_attachment("model")
+    assert message_copy.remove_attachment("model") is None
+
+
+@pytest.mark.usefixtures("config_only_cpp")
+def test_set_device_attachment():
+    message = messages.ControlMessage()
+    array = cp.arange(16, dtype=cp.uint8)
+
+    message.set_attachment("array", array)
+    attachment = message.get_attachment("array")
+    assert attachment.is_device
+    assert attachment.size == array.nbytes
+    assert cp.array_equal(attachment.to_cupy(), array)
+    assert attachment.to_bytes() == array.get().tobytes()
@@ -21,6 +21,7 @@ import typing_utils
 
 import cudf
 
+from morpheus.common import TypeId
 from morpheus.config import Config
 from morpheus.config import ConfigFIL
 from morpheus.messages import ControlMessage
@@ -63,6 +64,26 @@ def test_process_control_message(config: Config):
     assert cp.array_equal(output_cm.tensors().get_tensor("seq_ids"), expect_seg_ids)
 
 
+def test_constructor_invalid_input_type(config: Config):
+    with pytest.raises(ValueError):
+        PreprocessFILStage(config, input_type=TypeId.INT32)
+
+
+def test_process_control_message_float16(config: Config):
+    stage = PreprocessFILStage(config, input_type=TypeId.FLOAT16)
+    input_cm = ControlMessage()
+    df = cudf.DataFrame({"data": [1.5, 2.25, 3.0]})
+    input_cm.payload(MessageMeta(df))
+
+    output_cm = stage._get_preprocess_fn()(input_cm)
+
+    input__0 = output_cm.tensors().get_tensor("input__0")
+    assert input__0.dtype == cp.float16
+
+    # These values are exactly representable in float16, widening matches the default float32 path
+    assert cp.array_equal(input__0.astype(cp.float32), cp.asarray(df.to_cupy()).astype(cp.float32))
+
+
 def test_process_multi_message(config: Config):
     stage = PreprocessFILStage(config)
     df = cudf.DataFrame({"data": [1, 2, 3]})
@@ -23,6 +23,7 @@ import typing_utils
 
 import cudf
 
+from morpheus.common import TypeId
 from morpheus.config import Config
 from morpheus.messages import ControlMessage
 from morpheus.messages import MessageMeta
@@ -96,6 +97,52 @@ def test_process_control_message(mock_tokenize_text_series, config: Config):
     assert cp.array_equal(output_cm.tensors().get_tensor("seq_ids"), mock_tokenized.segment_ids)
 
 
+def test_constructor_invalid_input_type(config: Config):
+    with pytest.raises(ValueError):
+        PreprocessNLPStage(config, input_ids_type=TypeId.FLOAT32)
+
+
+@patch("morpheus.stages.preprocess.preprocess_nlp_stage.tokenize_text_series")
+def test_process_control_message_compact_types(mock_tokenize_text_series, config: Config):
+    mock_tokenized = Mock()
+    mock_tokenized.input_ids = cp.array([[101, 2054], [101, 102]], dtype=cp.uint32)
+    mock_tokenized.input_mask = cp.array([[1, 1], [1, 0]], dtype=cp.uint32)
+    mock_tokenized.segment_ids = cp.array([[0, 0, 1], [1, 0, 1]], dtype=cp.uint32)
+    mock_tokenize_text_series.return_value = mock_tokenized
+
+    stage = PreprocessNLPStage(config, input_ids_type=TypeId.INT16, input_mask_type=TypeId.UINT8)
+    input_cm = ControlMessage()
+    input_cm.payload(MessageMeta(cudf.DataFrame({"data": ["a", "b"]})))
+
+    output_cm = stage._get_preprocess_fn()(input_cm)
+
+    input_ids = output_cm.tensors().get_tensor("input_ids")
+    input_mask = output_cm.tensors().get_tensor("input_mask")
+    assert input_ids.dtype == cp.int16
+    assert input_mask.dtype == cp.uint8
+
+    # Widening the compact tensors back results in the same values as the default int32 path
+    assert cp.array_equal(input_ids.astype(cp.int32), mock_tokenized.input_ids.astype(cp.int32))
+    assert cp.array_equal(input_mask.astype(cp.int32), mock_tokenized.input_mask.astype(cp.int32))
+
+
+@patch("morpheus.stages.preprocess.preprocess_nlp_stage.tokenize_text_series")
+def test_process_control_message_token_id_overflow(mock_tokenize_text_series, config: Config):
+    mock_tokenized = Mock()
+    mock_tokenized.input_ids = cp.array([[101, 40000], [101, 102]], dtype=cp.uint32)
+    mock_tokenized.input_mask = cp.array([[1, 1], [1, 0]], dtype=cp.uint32)
+    mock_tokenized.segment_ids = cp.array([[0, 0, 1], [1, 0, 1]], dtype=cp.uint32)
+    mock_tokenize_text_series.return_value = mock_tokenized
+
+    # Token id 40000 would wrap to a negative int16
+    stage = PreprocessNLPStage(config, input_ids_type=TypeId.INT16)
+    input_cm = ControlMessage()
+    input_cm.payload(MessageMeta(cudf.DataFrame({"data": ["a", "b"]})))
+
+    with pytest.raises(ValueError, match="40000"):
+        stage._get_preprocess_fn()(input_cm)
+
+
 @patch("morpheus.stages.preprocess.preprocess_nlp_stage.tokenize_text_series")
 def test_process_multi_message(mock_tokenize_text_series, config: Config):
     mock_tokenized = Mock()
@@ -272,6 +272,54 @@ def test_date_column():
     assert datetime_series.dtype == np.dtype("datetime64[ns]")
 
 
+@pytest.mark.use_python
+@pytest.mark.parametrize("df_type", ["pandas", "cudf"])
+@pytest.mark.parametrize("values",
+                         [
+                             ["2022-08-29T21:21:41.645157Z", "2022-08-29T23:21:41.645157+02:00"],
+                             ["2022-08-29 21:21:41.645157", "2022-08-29 16:21:41.645157-0500"],
+                             ["Mon, 29 Aug 2022 21:21:41 +0000", "29 Aug 2022 21:21:41 GMT"],
+                             ["29/Aug/2022:21:21:41 +0000", "29/Aug/2022:14:21:41 -0700"],
+                             ["1661808101", "1661808101.0"],
+                             ["1661808101000", "1661808101000000"],
+                             ["1661808101000000000", "133062817010000000"],
+                         ])
+def test_date_column_formats(values: list[str], df_type: str):
+    expected = pd.Timestamp("2022-08-29T21:21:41")
+
+    df = pd.DataFrame({"time": values + [None, "2022-08-29T21:21:41Z"]})
+    if (df_type == "cudf"):
+        df = cudf.from_pandas(df)
+
+    datetime_col = DateTimeColumn(name="timestamp", dtype=datetime, input_name="time")
+    datetime_series = datetime_col.parse_timestamps(df["time"])
+
+    if (df_type == "cudf"):
+        datetime_series = datetime_series.to_pandas()
+
+    assert datetime_series.dtype == np.dtype("datetime64[ns]")
+    assert datetime_series[0].floor("s") == expected
+    assert datetime_series[1].floor("s") == expected
+    assert pd.isna(datetime_series[2])
+
+    # Values in a different format than the rest of the column are still parsed
+    assert datetime_series[3] == expected
+
+
+@pytest.mark.use_python
+def test_date_column_outliers():
+    # Formats the native parser doesn't support are parsed by pandas
+    df = pd.DataFrame({"time": ["2022-08-29T21:21:41Z", "August 29, 2022 21:21:41"]})
+
+    datetime_col = DateTimeColumn(name="timestamp", dtype=datetime, input_name="time")
+    datetime_series = datetime_col._process_column(df)
+
+    assert (datetime_series == pd.Timestamp("2022-08-29T21:21:41")).all()
+
+    with pytest.raises(ValueError):
+        datetime_col._process_column(pd.DataFrame({"time": ["not a timestamp"]}))
+
+
 @pytest.mark.use_python
 def test_rename_column():
     time_series = pd.Series([
@@ -0,0 +1,60 @@
+#!/usr/bin/env python
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import cudf
+
+from _utils.dataset_manager import DatasetManager
+from morpheus.config import Config
+from morpheus.messages import ControlMessage
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.preprocess.deduplicate_stage import DEDUP_HASH_COLUMN
+from morpheus.stages.preprocess.deduplicate_stage import DEDUP_INDEX_COLUMN
+from morpheus.stages.preprocess.deduplicate_stage import DeduplicateStage
+from morpheus.stages.preprocess.deserialize_stage import DeserializeStage
+
+
+def test_deduplicate_stage_pipe(config: Config, dataset_cudf: DatasetManager):
+    input_df = dataset_cudf["filter_probs.csv"]
+    num_rows = len(input_df)
+
+    # Every row of the second copy is a duplicate of a row in the first
+    repeated_df = cudf.concat([input_df, input_df], ignore_index=True)
+    config.pipeline_batch_size = len(repeated_df)
+
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [repeated_df]))
+    pipe.add_stage(DeserializeStage(config, ensure_sliceable_index=True, message_type=ControlMessage))
+    pipe.add_stage(DeduplicateStage(config, columns=list(input_df.columns)))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    messages = sink.get_messages()
+    assert len(messages) == 1
+
+    output_df = messages[0].payload().copy_dataframe()
+    representative = output_df[DEDUP_INDEX_COLUMN].to_arrow().to_pylist()
+    hashes = output_df[DEDUP_HASH_COLUMN].to_arrow().to_pylist()
+
+    expected = input_df.drop_duplicates(keep="first").index.to_arrow().to_pylist()
+    assert sorted(set(representative)) == sorted(expected)
+
+    for i in range(num_rows):
+        assert representative[i + num_rows] == representative[i]
+        assert hashes[i + num_rows] == hashes[i]
+        assert representative[representative[i]] == representative[i]
@@ -0,0 +1,119 @@
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import zipfile
+
+import pytest
+
+import cudf
+
+from morpheus.common import DocumentExtractor
+from morpheus.config import Config
+from morpheus.messages import ControlMessage
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.preprocess.deserialize_stage import DeserializeStage
+from morpheus.stages.preprocess.document_extractor_stage import DocumentExtractorStage
+
+DOCX_XML = ('<?xml version="1.0" encoding="UTF-8" standalone="yes"?>'
+            '<w:document xmlns:w="http://schemas.openxmlformats.org/wordprocessingml/2006/main"><w:body>'
+            '<w:p><w:r><w:t>First paragraph</w:t></w:r></w:p>'
+            '<w:p><w:r><w:t xml:space="preserve">Second &amp; last</w:t></w:r></w:p></w:body></w:document>')
+
+
+def _fake_pdf_converter(data: bytes) -> list[str]:
+    return [page.decode() for page in data.split(b"\f")]
+
+
+@pytest.fixture(name="documents")
+def documents_fixture(tmp_path) -> dict[str, list[str]]:
+    with open(os.path.join(tmp_path, "notes.TXT"), "w", encoding="utf-8") as fh:
+        fh.write("Some notes")
+
+    with open(os.path.join(tmp_path, "records.csv"), "w", encoding="utf-8") as fh:
+        fh.write('id,title,content\n1,One,"first, record"\n2,Two,second record\n')
+
+    with open(os.path.join(tmp_path, "page.html"), "w", encoding="utf-8") as fh:
+        fh.write("<html><head><script>var x = 1;</script></head><body><h1>Title</h1><p>Body&nbsp;text</p></body>")
+
+    with zipfile.ZipFile(os.path.join(tmp_path, "report.docx"), "w", zipfile.ZIP_DEFLATED) as archive:
+        archive.writestr("word/document.xml", DOCX_XML)
+
+    with open(os.path.join(tmp_path, "scan.pdf"), "wb") as fh:
+        fh.write(b"page one\fpage two")
+
+    # Not UTF-8, the invalid bytes are replaced rather than failing the batch
+    with open(os.path.join(tmp_path, "latin1.txt"), "wb") as fh:
+        fh.write("café".encode("latin-1"))
+
+    return {
+        "notes.TXT": ["Some notes"],
+        "missing.txt": [],
+        "records.csv": ["One first, record", "Two second record"],
+        "page.html": ["Title\nBody text"],
+        "report.docx": ["First paragraph\nSecond & last"],
+        "scan.pdf": ["page one", "page two"],
+        "latin1.txt": ["caf\ufffd"],
+    }
+
+
+def test_document_extractor(tmp_path, documents: dict[str, list[str]]):
+    extractor = DocumentExtractor(converters={"pdf": _fake_pdf_converter},
+                                  csv_text_columns=["title", "content"],
+                                  num_threads=4)
+
+    paths = [os.path.join(tmp_path, name) for name in documents]
+    extracted = extractor.extract(paths)
+
+    expected = [(os.path.join(tmp_path, name), name, DocumentExtractor.get_file_type(name), text)
+                for (name, texts) in documents.items() for text in texts]
+    assert list(zip(extracted["file_path"], extracted["file_name"], extracted["file_type"],
+                    extracted["content"])) == expected
+
+    errors = {name: error for (name, error) in zip(extracted["file_name"], extracted["error"]) if error is not None}
+    assert list(errors) == ["latin1.txt"]
+
+    assert DocumentExtractor.get_file_type("notes.TXT") == "txt"
+    assert DocumentExtractor.get_file_type(".bashrc") == "none"
+
+    with pytest.raises(ValueError):
+        DocumentExtractor(converters={"pdf": "not callable"})
+
+
+def test_document_extractor_stage_pipe(config: Config, tmp_path, documents: dict[str, list[str]]):
+    names = list(documents)
+    paths = [os.path.join(tmp_path, name) for name in names]
+    input_df = cudf.DataFrame({"file_path": paths + [None]})
+
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [input_df]))
+    pipe.add_stage(DeserializeStage(config, ensure_sliceable_index=True, message_type=ControlMessage))
+    pipe.add_stage(
+        DocumentExtractorStage(config, converters={"pdf": _fake_pdf_converter}, csv_text_columns=["title", "content"]))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    messages = sink.get_messages()
+    assert len(messages) == 1
+
+    output_df = messages[0].payload().copy_dataframe().to_pandas()
+    assert list(output_df.columns) == ["file_path", "file_name", "file_type", "content", "error"]
+
+    # The missing file and the null path don't produce any rows
+    expected = [(name, text) for (name, texts) in documents.items() for text in texts]
+    assert list(zip(output_df["file_name"], output_df["content"])) == expected
+    assert output_df[output_df["error"].notna()]["file_name"].tolist() == ["latin1.txt"]
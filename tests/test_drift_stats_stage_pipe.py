@@ -0,0 +1,86 @@
+#!/usr/bin/env python
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+
+import cudf
+
+from _utils.dataset_manager import DatasetManager
+from _utils.stages.conv_msg import ConvMsg
+from morpheus.config import Config
+from morpheus.messages import ControlMessage
+from morpheus.messages import MultiMessage
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.postprocess.drift_stats_stage import DriftStatsStage
+from morpheus.stages.preprocess.deserialize_stage import DeserializeStage
+
+
+def _run_pipe(config: Config, input_df: cudf.DataFrame, message_type: type, **stage_kwargs) -> cudf.DataFrame:
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [input_df]))
+    pipe.add_stage(DeserializeStage(config, ensure_sliceable_index=True, message_type=message_type))
+    pipe.add_stage(ConvMsg(config, message_type=message_type, columns=list(input_df.columns)))
+    pipe.add_stage(DriftStatsStage(config, **stage_kwargs))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    return cudf.concat([meta.copy_dataframe() for meta in sink.get_messages()], ignore_index=True)
+
+
+@pytest.mark.parametrize('message_type', [MultiMessage, ControlMessage])
+def test_drift_stats_no_drift(config: Config, dataset_cudf: DatasetManager, message_type: type):
+    config.class_labels = ['frogs', 'lizards', 'toads', 'turtles']
+    config.pipeline_batch_size = 8
+
+    input_df = dataset_cudf["filter_probs.csv"]
+    num_rows = len(input_df)
+
+    # Repeating the same data means every window matches the reference window exactly
+    repeated_df = cudf.concat([input_df] * 3, ignore_index=True)
+
+    results = _run_pipe(config, repeated_df, message_type, window_size=num_rows, num_buckets=10)
+
+    assert sorted(results["window"].unique().to_arrow().to_pylist()) == [1, 2]
+    assert set(results["name"].to_arrow().to_pylist()) == set(config.class_labels)
+    assert (results["count"] == num_rows).all()
+
+    for col in ("psi", "kl", "ks"):
+        assert results[col].abs().max() < 1e-9
+
+
+@pytest.mark.parametrize('message_type', [MultiMessage, ControlMessage])
+def test_drift_stats_reference(config: Config, dataset_cudf: DatasetManager, message_type: type):
+    config.class_labels = ['frogs', 'lizards', 'toads', 'turtles']
+
+    input_df = dataset_cudf["filter_probs.csv"]
+
+    # All of the reference mass is in the first bucket, none of the probabilities in the dataset are below 0.5
+    reference = {label: [1.0] + [0.0] * 9 for label in config.class_labels}
+    input_df = input_df.clip(lower=0.5)
+
+    results = _run_pipe(config,
+                        input_df,
+                        message_type,
+                        window_size=len(input_df),
+                        num_buckets=10,
+                        reference=reference)
+
+    assert len(results) == len(config.class_labels)
+    assert (results["window"] == 0).all()
+    assert (results["ks"] > 0.99).all()
+    assert (results["psi"] > 0).all()
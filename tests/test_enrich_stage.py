@@ -0,0 +1,105 @@
+#!/usr/bin/env python
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+
+import pytest
+
+import cudf
+
+from morpheus.config import Config
+from morpheus.messages import MessageMeta
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.preprocess.enrich_stage import EnrichStage
+
+
+@pytest.fixture(name="users_file")
+def users_file_fixture(tmp_path: str) -> str:
+    users_file = os.path.join(tmp_path, "users.csv")
+
+    # User 2 occurs twice, only the first row is kept
+    with open(users_file, "w", encoding="utf-8") as fh:
+        fh.write("id,dept,level\n1,10,100\n2,20,200\n2,21,201\n4,40,400\n")
+
+    return users_file
+
+
+def _run_pipe(config: Config, df: cudf.DataFrame, references: list) -> list[cudf.DataFrame]:
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [df]))
+    pipe.add_stage(EnrichStage(config, references=references, refresh_interval=0))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    return [msg.copy_dataframe() for msg in sink.get_messages()]
+
+
+def test_enrich_left(config: Config, users_file: str):
+    df = cudf.DataFrame({"user_id": [4, 3, 1, 2], "value": [1, 2, 3, 4]}, index=[10, 11, 12, 13])
+
+    output = _run_pipe(config, df, [{"path": users_file, "on": "user_id", "reference_on": "id", "prefix": "user_"}])
+    assert len(output) == 1
+
+    # The rows and index are preserved, the unmatched row has null reference columns
+    output_df = output[0]
+    assert list(output_df.columns) == ["user_id", "value", "user_dept", "user_level"]
+    assert output_df.index.to_arrow().to_pylist() == [10, 11, 12, 13]
+    assert output_df["user_id"].to_arrow().to_pylist() == [4, 3, 1, 2]
+    assert output_df["user_dept"].to_arrow().to_pylist() == [40, None, 10, 20]
+    assert output_df["user_level"].to_arrow().to_pylist() == [400, None, 100, 200]
+
+
+def test_enrich_inner(config: Config, users_file: str):
+    df = cudf.DataFrame({"id": [4, 3, 1, 2], "value": [1, 2, 3, 4]})
+
+    output = _run_pipe(config, df, [{"path": users_file, "on": ["id"], "columns": ["dept"], "how": "inner"}])
+    assert len(output) == 1
+
+    output_df = output[0]
+    assert list(output_df.columns) == ["id", "value", "dept"]
+    assert output_df.index.to_arrow().to_pylist() == [0, 2, 3]
+    assert output_df["dept"].to_arrow().to_pylist() == [40, 10, 20]
+
+    # Messages without any matching rows are dropped
+    df = cudf.DataFrame({"id": [5, 6], "value": [1, 2]})
+    assert not _run_pipe(config, df, [{"path": users_file, "on": "id", "how": "inner"}])
+
+
+@pytest.mark.use_python
+def test_enrich_refresh(config: Config, users_file: str):
+    stage = EnrichStage(config, references=[{"path": users_file, "on": "id", "columns": ["dept"]}], refresh_interval=1)
+    df = cudf.DataFrame({"id": [1, 2]})
+
+    assert stage._on_data(MessageMeta(df)).copy_dataframe()["dept"].to_arrow().to_pylist() == [10, 20]
+
+    with open(users_file, "w", encoding="utf-8") as fh:
+        fh.write("id,dept\n1,11\n")
+
+    # Force the next message to check the file
+    os.utime(users_file, (0, 0))
+    stage._last_refresh = 0.0
+
+    assert stage._on_data(MessageMeta(df)).copy_dataframe()["dept"].to_arrow().to_pylist() == [11, None]
+
+
+@pytest.mark.use_python
+def test_enrich_invalid_how(config: Config, users_file: str):
+    stage = EnrichStage(config, references=[{"path": users_file, "on": "id", "how": "outer"}])
+
+    with pytest.raises(ValueError, match="Unsupported join type"):
+        stage._on_data(MessageMeta(cudf.DataFrame({"id": [1]})))
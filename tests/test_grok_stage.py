@@ -0,0 +1,128 @@
+#!/usr/bin/env python
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+
+import cudf
+
+from morpheus.config import Config
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.preprocess.grok_stage import GrokStage
+from morpheus.stages.preprocess.grok_stage import expand_grok_pattern
+
+LINES = [
+    '127.0.0.1 - frank [10/Oct/2000:13:55:36 -0700] "GET /apache_pb.gif HTTP/1.0" 200 2326 '
+    '"http://www.example.com/start.html" "Mozilla/4.08 [en] (Win98; I ;Nav)"\n',
+    "Oct 11 22:14:15 mymachine su[230]: 'su root' failed on /dev/pts/8",
+    "kernel: DROP IN=eth0 OUT= SRC=10.0.0.1 DST=10.0.0.2 LEN=60 TOS=0x00 PROTO=UDP",
+    "no pattern matches this line",
+    None,
+]
+
+
+def _run_pipe(config: Config, df: cudf.DataFrame, stage_kwargs: dict) -> cudf.DataFrame:
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [df]))
+    pipe.add_stage(GrokStage(config, **stage_kwargs))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    messages = sink.get_messages()
+    assert len(messages) == 1
+
+    return messages[0].copy_dataframe()
+
+
+def test_grok(config: Config):
+    df = cudf.DataFrame({"raw": LINES, "value": [1, 2, 3, 4, 5]}, index=[10, 11, 12, 13, 14])
+
+    output_df = _run_pipe(config,
+                          df, {
+                              "column": "raw",
+                              "patterns": ["%{HTTPD_COMMONLOG} %{QS} %{QS:agent}", "%{SYSLOGLINE}", "%{IPTABLES}"],
+                              "custom_patterns": {
+                                  "INT": "(?:[+-]?[0-9]+)", "HTTPD_COMMONLOG": "%{IP:clientip} %{USER} %{USER:auth} "
+                                  "\\[%{HTTPDATE}\\] \"%{WORD:verb} %{NOTSPACE:request}[^\"]*\" %{INT:response:int} "
+                                  "%{INT:bytes:int}"
+                              }
+                          })
+
+    assert list(output_df.columns) == ["raw", "value", "clientip", "auth", "verb", "request", "response", "bytes",
+                                       "agent", "timestamp", "facility", "priority", "logsource", "program", "pid",
+                                       "message", "prefix", "in_interface", "out_interface", "mac", "src_ip", "dst_ip",
+                                       "length", "protocol", "src_port", "dst_port", "grok_pattern"]
+    assert output_df.index.to_arrow().to_pylist() == [10, 11, 12, 13, 14]
+
+    assert output_df["response"].dtype == "int64"
+    assert output_df["length"].dtype == "int64"
+    assert output_df["grok_pattern"].dtype == "int32"
+
+    assert output_df["grok_pattern"].to_arrow().to_pylist() == [0, 1, 2, None, None]
+    assert output_df["clientip"].to_arrow().to_pylist() == ["127.0.0.1", None, None, None, None]
+    assert output_df["auth"].to_arrow().to_pylist() == ["frank", None, None, None, None]
+    assert output_df["request"].to_arrow().to_pylist() == ["/apache_pb.gif", None, None, None, None]
+    assert output_df["response"].to_arrow().to_pylist() == [200, None, None, None, None]
+    assert output_df["bytes"].to_arrow().to_pylist() == [2326, None, None, None, None]
+
+    # The trailing line break isn't part of the last capture
+    assert output_df["agent"].to_arrow().to_pylist() == ['"Mozilla/4.08 [en] (Win98; I ;Nav)"', None, None, None, None]
+
+    assert output_df["timestamp"].to_arrow().to_pylist() == [None, "Oct 11 22:14:15", None, None, None]
+    assert output_df["program"].to_arrow().to_pylist() == [None, "su", None, None, None]
+    assert output_df["pid"].to_arrow().to_pylist() == [None, "230", None, None, None]
+    assert output_df["message"].to_arrow().to_pylist() == [None, "'su root' failed on /dev/pts/8", None, None, None]
+
+    # Optional captures which didn't participate in the match are null
+    assert output_df["facility"].to_arrow().to_pylist() == [None, None, None, None, None]
+    assert output_df["out_interface"].to_arrow().to_pylist() == [None, None, None, None, None]
+    assert output_df["mac"].to_arrow().to_pylist() == [None, None, None, None, None]
+    assert output_df["src_ip"].to_arrow().to_pylist() == [None, None, "10.0.0.1", None, None]
+    assert output_df["length"].to_arrow().to_pylist() == [None, None, 60, None, None]
+    assert output_df["protocol"].to_arrow().to_pylist() == [None, None, "UDP", None, None]
+    assert output_df["src_port"].to_arrow().to_pylist() == [None, None, None, None, None]
+
+
+def test_expand_grok_pattern():
+    patterns = {"NUM": "[0-9]+", "PAIR": "%{NUM:key}=%{NUM:value:int}", "LOOP": "a%{LOOP}"}
+
+    assert expand_grok_pattern("%{PAIR} \\%{NUM}", patterns) == ("(?:(?<key>(?:[0-9]+))=(?<value>(?:[0-9]+))) \\%{NUM}",
+                                                                [("key", "str"), ("value", "int")])
+
+    with pytest.raises(ValueError, match="Recursive Grok pattern"):
+        expand_grok_pattern("%{LOOP}", patterns)
+
+
+@pytest.mark.parametrize("stage_kwargs, match",
+                         [({
+                             "patterns": []
+                         }, "At least one Grok pattern"), ({
+                             "patterns": ["%{MISSING}"]
+                         }, "Unknown Grok pattern"), ({
+                             "patterns": ["%{INT:x:long}"]
+                         }, "Unknown type"), ({
+                             "patterns": ["%{INT:x:int}", "%{WORD:x}"]
+                         }, "captured with different types"),
+                          ({
+                              "patterns": ["%{INT:x}"], "pattern_column": "x"
+                          }, "Duplicate Grok column"),
+                          ({
+                              "patterns": ["%{INT}"], "pattern_files": ["/nonexistent/grok_patterns.txt"]
+                          }, "Unable to read the Grok pattern file")])
+def test_grok_invalid(config: Config, stage_kwargs: dict, match: str):
+    with pytest.raises(ValueError, match=match):
+        GrokStage(config, column="raw", **stage_kwargs)
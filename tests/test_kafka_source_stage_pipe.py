@@ -14,12 +14,15 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import json
 import os
 import typing
 
 import pandas as pd
 import pytest
 
+import cudf
+
 from _utils import TEST_DIRS
 from _utils import assert_results
 from _utils.kafka import KafkaTopics
@@ -32,6 +35,7 @@ from morpheus.pipeline.linear_pipeline import LinearPipeline
 from morpheus.stages.general.trigger_stage import TriggerStage
 from morpheus.stages.input.kafka_source_stage import KafkaSourceStage
 from morpheus.stages.output.compare_dataframe_stage import CompareDataFrameStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
 from morpheus.stages.postprocess.serialize_stage import SerializeStage
 from morpheus.stages.preprocess.deserialize_stage import DeserializeStage
 
@@ -180,3 +184,81 @@ def test_kafka_source_batch_pipe(config: Config,
     pipe.run()
 
     assert_results(comp_stage.get_results())
+
+
+@pytest.mark.kafka
+def test_kafka_source_metadata_columns(config: Config, kafka_bootstrap_servers: str,
+                                       kafka_topics: KafkaTopics) -> None:
+    # pylint: disable=import-error
+    from kafka import KafkaProducer
+
+    records = [("a", "t1", {"v": 0}), ("b", "t2", {"v": 1}), (None, "t1", {"v": 2}), ("a", None, {"v": 3})]
+
+    producer = KafkaProducer(bootstrap_servers=kafka_bootstrap_servers, client_id='morpheus_unittest_writer')
+    for (key, tenant, value) in records:
+        headers = [] if tenant is None else [("tenant", tenant.encode("utf-8"))]
+        producer.send(kafka_topics.input_topic,
+                      json.dumps(value).encode("utf-8"),
+                      key=None if key is None else key.encode("utf-8"),
+                      headers=headers)
+    producer.flush()
+
+    pipe = LinearPipeline(config)
+    pipe.set_source(
+        KafkaSourceStage(config,
+                         bootstrap_servers=kafka_bootstrap_servers,
+                         input_topic=kafka_topics.input_topic,
+                         auto_offset_reset="earliest",
+                         poll_interval="1seconds",
+                         client_id='morpheus_kafka_source_metadata_columns',
+                         stop_after=2,
+                         metadata_columns=["key", "topic", "partition", "offset", "timestamp"],
+                         header_columns=["tenant"],
+                         header_filters={"tenant": ["t1"]}))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    df = cudf.concat([msg.copy_dataframe() for msg in sink.get_messages()]).to_pandas()
+
+    # Only the records with the `tenant` header set to `t1` are emitted
+    assert df["v"].tolist() == [0, 2]
+    assert df["kafka_key"].tolist() == ["a", None]
+    assert df["kafka_topic"].tolist() == [kafka_topics.input_topic] * 2
+    assert df["kafka_header_tenant"].tolist() == ["t1", "t1"]
+    assert df["kafka_partition"].dtype == "int32"
+    assert df["kafka_offset"].is_monotonic_increasing
+    assert df["kafka_timestamp"].notna().all()
+
+
+@pytest.mark.kafka
+def test_kafka_source_multi_line_records(config: Config, kafka_bootstrap_servers: str,
+                                         kafka_topics: KafkaTopics) -> None:
+    # pylint: disable=import-error
+    from kafka import KafkaProducer
+
+    # Without metadata columns each JSON line of a record is a row
+    producer = KafkaProducer(bootstrap_servers=kafka_bootstrap_servers, client_id='morpheus_unittest_writer')
+    producer.send(kafka_topics.input_topic, b'{"v": 0}\n{"v": 1}')
+    producer.send(kafka_topics.input_topic, b'{"v": 2}')
+    producer.flush()
+
+    pipe = LinearPipeline(config)
+    pipe.set_source(
+        KafkaSourceStage(config,
+                         bootstrap_servers=kafka_bootstrap_servers,
+                         input_topic=kafka_topics.input_topic,
+                         auto_offset_reset="earliest",
+                         poll_interval="1seconds",
+                         client_id='morpheus_kafka_source_multi_line_records',
+                         disable_pre_filtering=True,
+                         stop_after=3))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    df = cudf.concat([msg.copy_dataframe() for msg in sink.get_messages()]).to_pandas()
+    assert df["v"].tolist() == [0, 1, 2]
+
+
+def test_kafka_source_unknown_metadata_column(config: Config) -> None:
+    with pytest.raises(ValueError, match="Unknown Kafka metadata columns"):
+        KafkaSourceStage(config, bootstrap_servers="localhost:9092", metadata_columns=["headers"])
@@ -0,0 +1,98 @@
+#!/usr/bin/env python
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+
+import cudf
+
+from morpheus.config import Config
+from morpheus.messages import ControlMessage
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.postprocess.pii_mask_stage import PiiMaskStage
+from morpheus.stages.preprocess.deserialize_stage import DeserializeStage
+
+INPUT_EVENTS = [
+    "login user=alice from 10.20.30.40",
+    "mail to bob.jones@example.com via smtp.corp.example.com",
+    "card 4111 1111 1111 1111 declined, order 4111111111111112",
+    "CORP\\svc_backup ran on buildhost",
+    None,
+]
+
+
+def _run_pipe(config: Config, **kwargs) -> cudf.DataFrame:
+    input_df = cudf.DataFrame({"event": INPUT_EVENTS, "count": list(range(len(INPUT_EVENTS)))})
+
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [input_df]))
+    pipe.add_stage(DeserializeStage(config, ensure_sliceable_index=True, message_type=ControlMessage))
+    pipe.add_stage(PiiMaskStage(config, columns=["event"], **kwargs))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    messages = sink.get_messages()
+    assert len(messages) == 1
+
+    output_df = messages[0].payload().copy_dataframe()
+    assert output_df["count"].to_arrow().to_pylist() == list(range(len(INPUT_EVENTS)))
+
+    return output_df
+
+
+def test_pii_mask_stage_pipe(config: Config):
+    output_df = _run_pipe(config, literals={"buildhost": "HOSTNAME"})
+
+    assert output_df["event"].to_arrow().to_pylist() == [
+        "login user=[USERNAME] from [IP_ADDRESS]",
+        "mail to [EMAIL] via [HOSTNAME]",
+        "card [CREDIT_CARD] declined, order 4111111111111112",
+        "CORP\\[USERNAME] ran on [HOSTNAME]",
+        None,
+    ]
+
+
+def test_pii_mask_stage_pipe_pseudonymize(config: Config):
+    first = _run_pipe(config, entities=["EMAIL", "IP_ADDRESS"], pseudonymize=True, key="secret")
+    second = _run_pipe(config, entities=["EMAIL", "IP_ADDRESS"], pseudonymize=True, key="secret")
+
+    events = first["event"].to_arrow().to_pylist()
+    assert events == second["event"].to_arrow().to_pylist()
+
+    assert events[0].startswith("login user=alice from IP_ADDRESS_")
+    assert events[1].startswith("mail to EMAIL_")
+    assert "bob.jones" not in events[1]
+
+
+@pytest.mark.use_cpp
+def test_pii_mask_stage_pipe_gpu(config: Config):
+    output_df = _run_pipe(config, entities=["EMAIL", "IP_ADDRESS", "CREDIT_CARD"], use_gpu=True)
+
+    events = output_df["event"].to_arrow().to_pylist()
+    assert events[0] == "login user=alice from [IP_ADDRESS]"
+    assert events[1] == "mail to [EMAIL] via smtp.corp.example.com"
+
+    # Numbers failing the Luhn check are left alone
+    assert events[2] == "card [CREDIT_CARD] declined, order 4111111111111112"
+
+
+def test_pii_mask_stage_invalid(config: Config):
+    with pytest.raises(ValueError):
+        PiiMaskStage(config, columns=[])
+
+    with pytest.raises(ValueError):
+        PiiMaskStage(config, columns=["event"], pseudonymize=True, key="secret", use_gpu=True)
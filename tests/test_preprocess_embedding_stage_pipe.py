@@ -0,0 +1,114 @@
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cupy as cp
+import pytest
+
+import cudf
+
+from morpheus.cli.utils import get_package_relative_file
+from morpheus.common import normalize_bucket_lengths
+from morpheus.config import Config
+from morpheus.messages import ControlMessage
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.preprocess.deserialize_stage import DeserializeStage
+from morpheus.stages.preprocess.preprocess_embedding_stage import PreprocessEmbeddingStage
+from morpheus.utils.cudf_subword_helper import tokenize_text_series
+
+VOCAB_HASH_FILE = "data/bert-base-uncased-hash.txt"
+
+TEXTS = [
+    "a much longer sentence which needs quite a few more tokens than the others to be encoded",
+    "short",
+    "a sentence of medium length",
+    "",
+    "another short one",
+    "the quick brown fox jumps over the lazy dog, then the dog wakes up and chases the fox around",
+    "medium sized sentence here too",
+]
+
+
+def test_normalize_bucket_lengths():
+    assert normalize_bucket_lengths([], 128) == [16, 32, 64, 128]
+    assert normalize_bucket_lengths([256, 48, 24, 48], 128) == [24, 48, 128]
+
+    with pytest.raises(ValueError):
+        normalize_bucket_lengths([0, 32], 128)
+
+
+@pytest.mark.parametrize("batch_size", [0, 2])
+def test_preprocess_embedding_stage_pipe(config: Config, batch_size: int):
+    max_length = 16
+    bucket_lengths = [4, 8]
+
+    input_df = cudf.DataFrame({"id": list(range(len(TEXTS))), "content": TEXTS})
+
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [input_df]))
+    pipe.add_stage(DeserializeStage(config, ensure_sliceable_index=True, message_type=ControlMessage))
+    pipe.add_stage(
+        PreprocessEmbeddingStage(config,
+                                 vocab_hash_file=VOCAB_HASH_FILE,
+                                 max_length=max_length,
+                                 bucket_lengths=bucket_lengths,
+                                 batch_size=batch_size))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    expected = tokenize_text_series(vocab_hash_file=get_package_relative_file(VOCAB_HASH_FILE),
+                                    do_lower_case=True,
+                                    text_ser=input_df["content"],
+                                    seq_len=max_length,
+                                    stride=max_length,
+                                    truncation=True,
+                                    add_special_tokens=False)
+    expected_lengths = cp.count_nonzero(expected.input_mask, axis=1).get().tolist()
+
+    row_indices = []
+    previous_length = 0
+    for message in sink.get_messages():
+        df = message.payload().copy_dataframe().to_pandas()
+        rows = df["_row_index"].tolist()
+
+        # The payload is gathered along with the rows
+        assert df["id"].tolist() == rows
+        assert batch_size == 0 or len(rows) <= batch_size
+
+        input_ids = message.tensors().get_tensor("input_ids")
+        input_mask = message.tensors().get_tensor("input_mask")
+        seq_ids = message.tensors().get_tensor("seq_ids")
+
+        padded_length = input_ids.shape[1]
+        assert padded_length in bucket_lengths + [max_length]
+        assert input_ids.shape == (len(rows), padded_length)
+        assert input_mask.shape == (len(rows), padded_length)
+        assert seq_ids[:, 0].tolist() == list(range(len(rows)))
+
+        for (i, row) in enumerate(rows):
+            # Rows are emitted in ascending length, padded to the smallest bucket holding them
+            length = expected_lengths[row]
+            assert length >= previous_length
+            assert padded_length == min(bucket for bucket in bucket_lengths + [max_length] if bucket >= length)
+            previous_length = length
+
+            assert cp.array_equal(input_ids[i], expected.input_ids[row, :padded_length])
+            assert cp.array_equal(input_mask[i], expected.input_mask[row, :padded_length])
+
+        row_indices.extend(rows)
+
+    # Every row is emitted exactly once
+    assert sorted(row_indices) == list(range(len(TEXTS)))
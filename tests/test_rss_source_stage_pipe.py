@@ -18,6 +18,8 @@ import os
 
 import pytest
 
+import cudf
+
 from _utils import TEST_DIRS
 from morpheus.config import Config
 from morpheus.pipeline.pipeline import Pipeline
@@ -33,7 +35,7 @@ def test_support_cpp_node(config):
     url_feed_input = "https://fake.nvidia.com/rss/HomePage.xml"
     rss_source_stage = RSSSourceStage(config, feed_input=url_feed_input)
 
-    assert rss_source_stage.supports_cpp_node() is False
+    assert rss_source_stage.supports_cpp_node() is True
 
 
 @pytest.mark.use_python
@@ -61,6 +63,36 @@ def test_rss_source_stage_pipe(config: Config,
     assert len(sink_stage.get_messages()) == expected_count
 
 
+@pytest.mark.use_cpp
+def test_rss_source_stage_cpp_pipe(config: Config, tmp_path: str):
+    feed_path = os.path.join(tmp_path, "feed.xml")
+    with open(feed_path, "w", encoding="utf-8") as fh:
+        fh.write("<?xml version=\"1.0\"?><rss version=\"2.0\"><channel><title>Feed</title>")
+        for i in range(5):
+            fh.write(f"<item><guid>id-{i}</guid><title>Title {i}</title><description>&lt;p&gt;Text {i}&lt;/p&gt;"
+                     "</description></item>")
+        fh.write("</channel></rss>")
+
+    pipe = Pipeline(config)
+
+    # Duplicate feeds are only read once
+    rss_source_stage = pipe.add_stage(
+        RSSSourceStage(config, feed_input=[feed_path, feed_path], batch_size=2, strip_markup=True))
+    sink_stage = pipe.add_stage(InMemorySinkStage(config))
+
+    pipe.add_edge(rss_source_stage, sink_stage)
+
+    pipe.run()
+
+    messages = sink_stage.get_messages()
+    assert [len(message.df) for message in messages] == [2, 2, 1]
+
+    df = cudf.concat([message.df for message in messages])
+    assert df["id"].to_arrow().to_pylist() == [f"id-{i}" for i in range(5)]
+    assert df["summary"].to_arrow().to_pylist() == [f"Text {i}" for i in range(5)]
+    assert df["link"].isnull().all()
+
+
 # TODO(Devin): Remove before merge, this isn't a stage test, this is a test of RSSController
 # @pytest.mark.use_python
 # def test_invalid_input_rss_source_stage(config: Config):
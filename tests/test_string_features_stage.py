@@ -0,0 +1,117 @@
+#!/usr/bin/env python
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+
+import cudf
+
+from morpheus.config import Config
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.preprocess.string_features_stage import StringFeaturesStage
+from morpheus.stages.preprocess.string_features_stage import fnv1a_32
+
+
+def _run_pipe(config: Config, df: cudf.DataFrame, features: list) -> cudf.DataFrame:
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [df]))
+    pipe.add_stage(StringFeaturesStage(config, features=features))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    messages = sink.get_messages()
+    assert len(messages) == 1
+
+    return messages[0].copy_dataframe()
+
+
+def test_string_features(config: Config):
+    df = cudf.DataFrame(
+        {
+            "url": ["https://user@www.Example.com:8080/a//b/c.html?q=1", "AAb1ééé", None, ""],
+            "value": [1, 2, 3, 4],
+        },
+        index=[10, 11, 12, 13])
+
+    features = [{"column": "url", "type": feature_type, "name": feature_type}
+                for feature_type in ("length", "entropy", "digit_ratio", "upper_ratio", "domain_label_count",
+                                     "path_depth")]
+    features.append({"column": "url", "type": "ngram_hash", "name": "ngram", "n": 2, "num_buckets": 4})
+
+    output_df = _run_pipe(config, df, features)
+
+    assert list(output_df.columns) == ["url", "value", "length", "entropy", "digit_ratio", "upper_ratio",
+                                       "domain_label_count", "path_depth", "ngram_0", "ngram_1", "ngram_2", "ngram_3"]
+    assert output_df.index.to_arrow().to_pylist() == [10, 11, 12, 13]
+
+    for column in ("length", "domain_label_count", "path_depth"):
+        assert output_df[column].dtype == "int32"
+
+    for column in ("entropy", "digit_ratio", "upper_ratio", "ngram_0"):
+        assert output_df[column].dtype == "float32"
+
+    # Null and empty strings produce zero for every feature
+    assert output_df["length"].to_arrow().to_pylist() == [49, 7, 0, 0]
+    assert output_df["domain_label_count"].to_arrow().to_pylist() == [3, 1, 0, 0]
+    assert output_df["path_depth"].to_arrow().to_pylist() == [3, 1, 0, 0]
+    assert output_df["entropy"].to_arrow().to_pylist() == pytest.approx([4.501866, 1.842371, 0, 0], abs=1e-5)
+    assert output_df["digit_ratio"].to_arrow().to_pylist() == pytest.approx([5 / 49, 1 / 7, 0, 0])
+    assert output_df["upper_ratio"].to_arrow().to_pylist() == pytest.approx([1 / 49, 2 / 7, 0, 0])
+
+    expected = [0.0] * 4
+    for bigram in ("AA", "Ab", "b1", "1é", "éé", "éé"):
+        expected[fnv1a_32(bigram.encode("utf-8")) % 4] += 1.0
+
+    ngrams = output_df[[f"ngram_{i}" for i in range(4)]].to_pandas()
+    assert ngrams.iloc[1].tolist() == expected
+    assert ngrams.iloc[0].sum() == 48
+    assert ngrams.iloc[2:].to_numpy().sum() == 0
+
+
+def test_string_features_multiple_columns(config: Config):
+    df = cudf.DataFrame({"domain": ["mail.google.co.uk", "localhost"], "path": ["/usr//bin/", "C:\\Windows\\x.exe"]})
+
+    output_df = _run_pipe(config,
+                          df, [{
+                              "column": "domain", "type": "domain_label_count", "name": "labels"
+                          }, {
+                              "column": "path", "type": "path_depth", "name": "depth"
+                          }, {
+                              "column": "domain", "type": "length", "name": "domain_length"
+                          }])
+
+    assert list(output_df.columns) == ["domain", "path", "labels", "depth", "domain_length"]
+    assert output_df["labels"].to_arrow().to_pylist() == [4, 1]
+    assert output_df["depth"].to_arrow().to_pylist() == [2, 3]
+    assert output_df["domain_length"].to_arrow().to_pylist() == [17, 9]
+
+
+@pytest.mark.parametrize("features, match",
+                         [([], "At least one feature"), ([{
+                             "column": "a", "type": "vowel_ratio", "name": "a"
+                         }], "Unknown string feature type"),
+                          ([{
+                              "column": "a", "type": "length", "name": "a"
+                          }, {
+                              "column": "b", "type": "length", "name": "a"
+                          }], "Duplicate feature column"),
+                          ([{
+                              "column": "a", "type": "ngram_hash", "name": "a", "num_buckets": 0
+                          }], "must be positive")])
+def test_string_features_invalid(config: Config, features: list, match: str):
+    with pytest.raises(ValueError, match=match):
+        StringFeaturesStage(config, features=features)
@@ -0,0 +1,151 @@
+#!/usr/bin/env python
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pandas as pd
+import pytest
+
+import cudf
+
+from morpheus.config import Config
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.preprocess.syslog_parser_stage import SyslogParserStage
+from morpheus.stages.preprocess.syslog_parser_stage import parse_log_line
+
+LINES = [
+    "<165>1 2024-03-01T12:34:56.789Z host.example.com app 1234 ID47 [id a=\"1\"] "
+    "CEF:0|Vendor|Product|1.0|100|Worm stopped|10|src=10.0.0.1 cnt=5 msg=a \\= b",
+    "<34>Oct 11 22:14:15 mymachine su[230]: 'su root' failed on /dev/pts/8",
+    "LEEF:2.0|Lancope|StealthWatch|1.0|41|^|src=10.0.0.2^cnt=x^blocked=true",
+    "CEF:0|V|P|1|2|N",
+    None,
+]
+
+
+def _run_pipe(config: Config, df: cudf.DataFrame, stage_kwargs: dict) -> cudf.DataFrame:
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [df]))
+    pipe.add_stage(SyslogParserStage(config, **stage_kwargs))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    messages = sink.get_messages()
+    assert len(messages) == 1
+
+    return messages[0].copy_dataframe()
+
+
+def test_syslog_parser(config: Config):
+    df = cudf.DataFrame({"raw": LINES, "value": [1, 2, 3, 4, 5]}, index=[10, 11, 12, 13, 14])
+
+    output_df = _run_pipe(config,
+                          df, {
+                              "column": "raw",
+                              "header_fields": ["log_format", "syslog_severity", "syslog_timestamp", "syslog_app_name",
+                                                "syslog_proc_id", "device_vendor", "event_id"],
+                              "extension_fields": [{
+                                  "key": "src"
+                              }, {
+                                  "key": "cnt", "name": "count", "type": "int"
+                              }, {
+                                  "key": "blocked", "type": "bool"
+                              }, {
+                                  "key": "msg"
+                              }],
+                              "column_prefix": "log_",
+                              "syslog_year": 2023
+                          })
+
+    assert list(output_df.columns) == ["raw", "value", "log_log_format", "log_syslog_severity",
+                                       "log_syslog_timestamp", "log_syslog_app_name", "log_syslog_proc_id",
+                                       "log_device_vendor", "log_event_id", "src", "count", "blocked", "msg",
+                                       "parse_error"]
+    assert output_df.index.to_arrow().to_pylist() == [10, 11, 12, 13, 14]
+
+    assert output_df["log_syslog_severity"].dtype == "int32"
+    assert output_df["log_syslog_timestamp"].dtype == "datetime64[ns]"
+    assert output_df["count"].dtype == "int64"
+    assert output_df["blocked"].dtype == "bool"
+
+    assert output_df["log_log_format"].to_arrow().to_pylist() == ["cef", "syslog", "leef", None, None]
+    assert output_df["log_syslog_severity"].to_arrow().to_pylist() == [5, 2, None, None, None]
+    assert output_df["log_syslog_timestamp"].to_pandas().tolist()[:2] == [
+        pd.Timestamp("2024-03-01T12:34:56.789"), pd.Timestamp("2023-10-11T22:14:15")
+    ]
+    assert output_df["log_syslog_timestamp"].isna().to_arrow().to_pylist() == [False, False, True, True, True]
+    assert output_df["log_syslog_app_name"].to_arrow().to_pylist() == ["app", "su", None, None, None]
+    assert output_df["log_syslog_proc_id"].to_arrow().to_pylist() == ["1234", "230", None, None, None]
+    assert output_df["log_device_vendor"].to_arrow().to_pylist() == ["Vendor", None, "Lancope", None, None]
+    assert output_df["log_event_id"].to_arrow().to_pylist() == ["100", None, "41", None, None]
+
+    # Values which can't be converted are null, CEF escapes are decoded
+    assert output_df["src"].to_arrow().to_pylist() == ["10.0.0.1", None, "10.0.0.2", None, None]
+    assert output_df["count"].to_arrow().to_pylist() == [5, None, None, None, None]
+    assert output_df["blocked"].to_arrow().to_pylist() == [None, None, True, None, None]
+    assert output_df["msg"].to_arrow().to_pylist() == ["a = b", None, None, None, None]
+
+    # Malformed lines are null in every parsed column, null lines are null in the error column as well
+    assert output_df["parse_error"].to_arrow().to_pylist() == [
+        None, None, None, "Malformed CEF header, expected 7 fields separated by '|'", None
+    ]
+
+
+def test_parse_log_line():
+    (header, values) = parse_log_line("<13>Mar  1 02:03:04 host LEEF:1.0|V|P|1.0|7|src=1\tsev=2\t=x\r\n", {"sev"})
+
+    assert header == {
+        "log_format": "leef",
+        "log_format_version": "1.0",
+        "syslog_facility": 1,
+        "syslog_severity": 5,
+        "syslog_timestamp": "Mar  1 02:03:04",
+        "syslog_hostname": "host",
+        "syslog_message": "LEEF:1.0|V|P|1.0|7|src=1\tsev=2\t=x",
+        "device_vendor": "V",
+        "device_product": "P",
+        "device_version": "1.0",
+        "event_id": "7"
+    }
+    assert values == {"sev": "2"}
+
+    with pytest.raises(ValueError, match="Unrecognized log line"):
+        parse_log_line("plain text", set())
+
+
+@pytest.mark.parametrize("stage_kwargs, match",
+                         [({
+                             "header_fields": ["hostname"]
+                         }, "Unknown log header field"), ({
+                             "extension_fields": [{
+                                 "key": ""
+                             }]
+                         }, "keys can't be empty"),
+                          ({
+                              "extension_fields": [{
+                                  "key": "a", "type": "ip"
+                              }]
+                          }, "Unknown log extension type"),
+                          ({
+                              "extension_fields": [{
+                                  "key": "log_format"
+                              }]
+                          }, "Duplicate log column"), ({
+                              "error_column": "syslog_message"
+                          }, "Duplicate log column")])
+def test_syslog_parser_invalid(config: Config, stage_kwargs: dict, match: str):
+    with pytest.raises(ValueError, match=match):
+        SyslogParserStage(config, column="raw", **stage_kwargs)
@@ -0,0 +1,95 @@
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+
+import cudf
+
+from morpheus.common import TextSplitter
+from morpheus.config import Config
+from morpheus.messages import ControlMessage
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.preprocess.deserialize_stage import DeserializeStage
+from morpheus.stages.preprocess.text_chunker_stage import TextChunkerStage
+
+DOCUMENTS = [
+    "Hi.\n\nI'm Harrison.\n\nHow? Are? You?\nOkay then f f f f.\n"
+    "This is a weird text to write, but gotta test the splittingggg some how.\n\nBye!\n\n-H.",
+    None,
+    "foo bar baz 123",
+    "",
+]
+TITLES = ["a", "b", "c", "d"]
+
+
+def test_text_splitter():
+    # Expected values are the output of LangChain's RecursiveCharacterTextSplitter with the same parameters
+    assert TextSplitter(chunk_size=10, chunk_overlap=1).split_text(DOCUMENTS[0]) == [
+        "Hi.",
+        "I'm",
+        "Harrison.",
+        "How? Are?",
+        "You?",
+        "Okay then",
+        "f f f f.",
+        "This is a",
+        "weird",
+        "text to",
+        "write,",
+        "but gotta",
+        "test the",
+        "splitting",
+        "gggg",
+        "some how.",
+        "Bye!",
+        "-H.",
+    ]
+
+    splitter = TextSplitter(chunk_size=7, chunk_overlap=3, separators=[" "], keep_separator=False)
+    assert splitter.split_text_with_offsets("foo bar baz 123") == [("foo bar", 0), ("bar baz", 4), ("baz 123", 8)]
+
+    with pytest.raises(ValueError):
+        TextSplitter(chunk_size=10, chunk_overlap=11)
+
+
+def test_text_chunker_stage_pipe(config: Config):
+    input_df = cudf.DataFrame({"title": TITLES, "content": DOCUMENTS})
+    splitter = TextSplitter(chunk_size=10, chunk_overlap=1)
+
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [input_df]))
+    pipe.add_stage(DeserializeStage(config, ensure_sliceable_index=True, message_type=ControlMessage))
+    pipe.add_stage(TextChunkerStage(config, column="content", chunk_size=10, chunk_overlap=1))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    messages = sink.get_messages()
+    assert len(messages) == 1
+
+    output_df = messages[0].payload().copy_dataframe().to_pandas()
+    assert list(output_df.columns) == ["title", "content", "source_row_id", "chunk_offset"]
+
+    expected = []
+    for (row, text) in enumerate(DOCUMENTS):
+        if text is not None:
+            expected.extend((TITLES[row], row, chunk, offset)
+                            for (chunk, offset) in splitter.split_text_with_offsets(text))
+
+    # The null and empty documents don't produce any chunks
+    assert set(output_df["source_row_id"]) == {0, 2}
+    assert list(zip(output_df["title"], output_df["source_row_id"], output_df["content"],
+                    output_df["chunk_offset"])) == expected
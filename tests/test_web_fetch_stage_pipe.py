@@ -0,0 +1,121 @@
+#!/usr/bin/env python
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import functools
+import os
+import threading
+import typing
+from http.server import SimpleHTTPRequestHandler
+from http.server import ThreadingHTTPServer
+
+import pytest
+
+import cudf
+
+from morpheus.common import WebFetcher
+from morpheus.config import Config
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.preprocess.web_fetch_stage import WebFetchStage
+
+
+class _Handler(SimpleHTTPRequestHandler):
+    # Keep-alive connections, which the fetcher pools
+    protocol_version = "HTTP/1.1"
+
+    def log_message(self, format, *args):  # pylint: disable=redefined-builtin
+        pass
+
+
+@pytest.fixture(name="site_url")
+def site_url_fixture(tmp_path: str) -> typing.Iterator[str]:
+    site_dir = os.path.join(tmp_path, "site")
+    os.makedirs(site_dir)
+
+    with open(os.path.join(site_dir, "article.html"), "w", encoding="utf-8") as fh:
+        fh.write("<html><body><nav>Home | About</nav><h1>Title</h1><p>Body &amp; more</p>"
+                 "<footer>Copyright</footer></body></html>")
+
+    with open(os.path.join(site_dir, "notes.txt"), "w", encoding="utf-8") as fh:
+        fh.write("plain notes")
+
+    with open(os.path.join(site_dir, "image.png"), "wb") as fh:
+        fh.write(b"\x89PNG\r\n")
+
+    server = ThreadingHTTPServer(("127.0.0.1", 0), functools.partial(_Handler, directory=site_dir))
+    thread = threading.Thread(target=server.serve_forever, daemon=True)
+    thread.start()
+
+    yield f"http://127.0.0.1:{server.server_address[1]}"
+
+    server.shutdown()
+    server.server_close()
+    thread.join()
+
+
+def test_web_fetcher_cache(site_url: str, tmp_path: str):
+    fetcher = WebFetcher(max_connections=2, cache_dir=os.path.join(tmp_path, "cache"))
+    urls = [f"{site_url}/article.html", f"{site_url}/missing.html", "not a url"]
+
+    responses = fetcher.fetch(urls)
+    assert [response["url"] for response in responses] == urls
+
+    assert responses[0]["status"] == 200
+    assert responses[0]["content_type"] == "text/html"
+    assert responses[0]["body"].startswith(b"<html>")
+    assert not responses[0]["from_cache"]
+    assert responses[1]["status"] == 404
+    assert responses[2]["status"] == 0
+    assert responses[2]["error"]
+
+    # The server answers 304 Not Modified to the `If-Modified-Since` header, the page is read from the cache
+    cached = fetcher.fetch(urls[:1])[0]
+    assert cached["status"] == 200
+    assert cached["from_cache"]
+    assert cached["body"] == responses[0]["body"]
+
+    assert fetcher.num_idle_connections > 0
+
+
+def test_web_fetch_stage(config: Config, site_url: str):
+    df = cudf.DataFrame({
+        "id": [1, 2, 3, 4, 5],
+        "link": [
+            f"{site_url}/article.html",
+            None,
+            f"{site_url}/notes.txt",
+            f"{site_url}/missing.html",
+            f"{site_url}/image.png",
+        ]
+    })
+
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [df]))
+    pipe.add_stage(WebFetchStage(config, link_column="link"))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    messages = sink.get_messages()
+    assert len(messages) == 1
+
+    # Null links, failed requests and unsupported content types are dropped
+    output_df = messages[0].copy_dataframe()
+    assert output_df["id"].to_arrow().to_pylist() == [1, 3]
+    assert output_df["page_content"].to_arrow().to_pylist() == ["Title\nBody & more", "plain notes"]
+    assert output_df["final_url"].to_arrow().to_pylist() == [f"{site_url}/article.html", f"{site_url}/notes.txt"]
+    assert output_df["status_code"].to_arrow().to_pylist() == [200, 200]
+    assert output_df["content_type"].to_arrow().to_pylist() == ["text/html", "text/plain"]
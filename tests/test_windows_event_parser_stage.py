@@ -0,0 +1,161 @@
+#!/usr/bin/env python
+# SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pandas as pd
+import pytest
+
+import cudf
+
+from morpheus.config import Config
+from morpheus.pipeline import LinearPipeline
+from morpheus.stages.input.in_memory_source_stage import InMemorySourceStage
+from morpheus.stages.output.in_memory_sink_stage import InMemorySinkStage
+from morpheus.stages.preprocess.windows_event_parser_stage import WindowsEventParserStage
+from morpheus.stages.preprocess.windows_event_parser_stage import flatten_windows_event
+
+EVENTS = [
+    "<Event xmlns='http://schemas.microsoft.com/win/2004/08/events/event'><System>"
+    "<Provider Name='Microsoft-Windows-Security-Auditing'/><EventID>4624</EventID>"
+    "<TimeCreated SystemTime='2024-03-01T12:34:56.1234567Z'/><Computer>dc01.example.com</Computer></System>"
+    "<EventData><Data Name='TargetUserName'>bob &amp; alice</Data><Data Name='LogonType'>10</Data>"
+    "<Data Name='NewProcessName'>ignored</Data></EventData></Event>\n",
+    '{"Event": {"System": {"EventID": 4688, "Computer": "ws01",'
+    ' "TimeCreated": {"@SystemTime": "2024-03-01T13:00:00Z"}},'
+    ' "EventData": {"Data": [{"@Name": "SubjectUserName", "#text": "carol"},'
+    ' {"@Name": "NewProcessName", "#text": "C:\\\\Windows\\\\System32\\\\cmd.exe"}]}}}',
+    "<Event><System><EventID>4624</EventID></System>",
+    "EventID=4624",
+    None,
+]
+
+FIELDS = [{
+    "key": "EventID", "name": "event_id", "type": "int"
+}, {
+    "key": "TimeCreated.SystemTime", "name": "timestamp", "type": "timestamp"
+}, {
+    "key": "Computer", "name": "computer"
+}]
+
+SCHEMAS = {
+    4624: [{
+        "key": "TargetUserName", "name": "user"
+    }, {
+        "key": "LogonType", "name": "logon_type", "type": "int"
+    }],
+    4688: [{
+        "key": "SubjectUserName", "name": "user"
+    }, {
+        "key": "NewProcessName", "name": "process"
+    }]
+}
+
+
+def _run_pipe(config: Config, df: cudf.DataFrame, stage_kwargs: dict) -> cudf.DataFrame:
+    pipe = LinearPipeline(config)
+    pipe.set_source(InMemorySourceStage(config, [df]))
+    pipe.add_stage(WindowsEventParserStage(config, **stage_kwargs))
+    sink = pipe.add_stage(InMemorySinkStage(config))
+    pipe.run()
+
+    messages = sink.get_messages()
+    assert len(messages) == 1
+
+    return messages[0].copy_dataframe()
+
+
+def test_windows_event_parser(config: Config):
+    df = cudf.DataFrame({"raw": EVENTS, "value": [1, 2, 3, 4, 5]}, index=[10, 11, 12, 13, 14])
+
+    output_df = _run_pipe(config, df, {"column": "raw", "fields": FIELDS, "schemas": SCHEMAS})
+
+    assert list(output_df.columns) == [
+        "raw", "value", "event_id", "timestamp", "computer", "user", "logon_type", "process", "parse_error"
+    ]
+    assert output_df.index.to_arrow().to_pylist() == [10, 11, 12, 13, 14]
+
+    assert output_df["event_id"].dtype == "int64"
+    assert output_df["timestamp"].dtype == "datetime64[ns]"
+    assert output_df["logon_type"].dtype == "int64"
+
+    assert output_df["event_id"].to_arrow().to_pylist() == [4624, 4688, None, None, None]
+    assert output_df["timestamp"].to_pandas().tolist()[:2] == [
+        pd.Timestamp("2024-03-01T12:34:56.1234567"), pd.Timestamp("2024-03-01T13:00:00")
+    ]
+    assert output_df["timestamp"].isna().to_arrow().to_pylist() == [False, False, True, True, True]
+    assert output_df["computer"].to_arrow().to_pylist() == ["dc01.example.com", "ws01", None, None, None]
+
+    # Fields of a schema are only written for events of its ID
+    assert output_df["user"].to_arrow().to_pylist() == ["bob & alice", "carol", None, None, None]
+    assert output_df["logon_type"].to_arrow().to_pylist() == [10, None, None, None, None]
+    assert output_df["process"].to_arrow().to_pylist() == [None, "C:\\Windows\\System32\\cmd.exe", None, None, None]
+
+    errors = output_df["parse_error"].to_arrow().to_pylist()
+    assert errors[:2] == [None, None]
+    assert errors[2].startswith("Malformed XML event")
+    assert errors[3] == "Unrecognized Windows event, expected XML or JSON"
+    assert errors[4] is None
+
+
+def test_flatten_windows_event():
+    assert flatten_windows_event(
+        "<e:Event xmlns:e='urn:x'><e:System><e:Execution ProcessID='4'/></e:System><e:UserData><LogFileCleared>"
+        "<SubjectUserName>admin</SubjectUserName></LogFileCleared></e:UserData>"
+        "<RenderingInfo Culture='en-US'><Message>Cleared</Message></RenderingInfo></e:Event>") == [
+            ("Execution.ProcessID", "4"), ("Execution", ""), ("SubjectUserName", "admin"),
+            ("RenderingInfo.Culture", "en-US"), ("RenderingInfo.Message", "Cleared")
+        ]
+
+    # Each scalar of a JSON event is keyed by every suffix of its path
+    assert flatten_windows_event('{"winlog": {"event_id": 4624, "event_data": {"Elevated": true, "Note": null}}}') == [
+        ("winlog.event_id", "4624"), ("event_id", "4624"), ("winlog.event_data.Elevated", "true"),
+        ("event_data.Elevated", "true"), ("Elevated", "true")
+    ]
+
+    with pytest.raises(ValueError, match="Malformed JSON event"):
+        flatten_windows_event('{"EventID": 1')
+
+
+@pytest.mark.parametrize("stage_kwargs, match",
+                         [({
+                             "fields": [{
+                                 "key": ""
+                             }]
+                         }, "Windows event keys can't be empty"),
+                          ({
+                              "fields": [{
+                                  "key": "EventID", "type": "long"
+                              }]
+                          }, "Unknown Windows event type"),
+                          ({
+                              "fields": [{
+                                  "key": "EventID", "name": "x", "type": "int"
+                              }], "schemas": {
+                                  4624: [{
+                                      "key": "TargetUserName", "name": "x"
+                                  }]
+                              }
+                          }, "declared with different types"),
+                          ({
+                              "fields": [{
+                                  "key": "Computer", "name": "parse_error"
+                              }]
+                          }, "Duplicate Windows event column"),
+                          ({
+                              "fields": [], "event_id_key": ""
+                          }, "The Windows event ID key can't be empty")])
+def test_windows_event_parser_invalid(config: Config, stage_kwargs: dict, match: str):
+    with pytest.raises(ValueError, match=match):
+        WindowsEventParserStage(config, column="raw", **stage_kwargs)